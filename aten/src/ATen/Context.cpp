@@ -2,6 +2,7 @@
 
 #include <ATen/Context.h>
 
+#include <c10/core/CPUCachingAllocator.h>
 #include <c10/core/TensorOptions.h>
 
 #include <mutex>
@@ -51,6 +52,14 @@ void Context::setUserEnabledMkldnn(bool e) {
   enabled_mkldnn = e;
 }
 
+bool Context::userEnabledCPUCachingAllocator() const {
+  return c10::CPUCachingAllocatorEnabled();
+}
+
+void Context::setUserEnabledCPUCachingAllocator(bool e) {
+  c10::SetCPUCachingAllocatorEnabled(e);
+}
+
 bool Context::deterministicCuDNN() const {
   return deterministic_cudnn;
 }
@@ -133,6 +142,12 @@ const std::vector<at::QEngine>& Context::supportedQEngines() const {
 
 #ifdef USE_FBGEMM
     if (fbgemm::fbgemmSupportedCPU()) {
+#ifdef USE_PYTORCH_QNNPACK
+      // Auto picks between FBGEMM and QNNPACK per op and shape, so it is
+      // only meaningful when both are present. Listed before FBGEMM so it
+      // never becomes the default.
+      engines.push_back(at::kAutoQEngine);
+#endif
       engines.push_back(at::kFBGEMM);
     }
 #endif
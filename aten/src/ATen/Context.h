@@ -102,6 +102,10 @@ class CAFFE2_API Context {
   void setUserEnabledCuDNN(bool e);
   bool userEnabledMkldnn() const;
   void setUserEnabledMkldnn(bool e);
+  // Process-wide switch for the caching CPU allocator; see
+  // c10/core/CPUCachingAllocator.h for the semantics.
+  bool userEnabledCPUCachingAllocator() const;
+  void setUserEnabledCPUCachingAllocator(bool e);
   bool benchmarkCuDNN() const;
   void setBenchmarkCuDNN(bool);
   bool deterministicCuDNN() const;
@@ -24,7 +24,7 @@ struct CAFFE2_API OpaqueTensorImpl : public TensorImpl {
   :   TensorImpl(key_set, data_type, device),
       opaque_handle_(std::move(opaque_handle))
   {
-    sizes_ = sizes.vec();
+    sizes_and_strides_.set_sizes(sizes);
     refresh_numel();
   }
 
@@ -79,7 +79,7 @@ struct CAFFE2_API OpaqueTensorImpl : public TensorImpl {
       const c10::VariableVersion& version_counter,
       bool allow_tensor_metadata_change) const override {
     auto impl = c10::make_intrusive<OpaqueTensorImpl<OpaqueHandle>>(
-      key_set(), dtype(), device(), opaque_handle_, sizes_);
+      key_set(), dtype(), device(), opaque_handle_, sizes_and_strides_.sizes_arrayref());
     copy_tensor_metadata(
       /*src_impl=*/this,
       /*dest_impl=*/impl.get(),
@@ -1,6 +1,7 @@
 #pragma once
 #include <ATen/ATen.h>
 #include <ATen/core/ivalue.h>
+#include <c10/util/numa.h>
 
 namespace at {
 namespace internal {
@@ -32,6 +33,16 @@ CAFFE2_API int get_thread_num();
 // Checks whether the code runs in parallel region
 CAFFE2_API bool in_parallel_region();
 
+// Binds the intra-op thread pool (and the calling thread, which executes the
+// first chunk of every parallel region) to the given NUMA node. Must be
+// called before the pool is initialized, i.e. before the first parallel
+// region. Pass -1 to clear. Only honored by the native parallel backend; the
+// OpenMP and TBB backends warn and ignore it.
+CAFFE2_API void set_intraop_numa_node_id(int numa_node_id);
+
+// The NUMA node the intra-op thread pool is bound to, or -1
+CAFFE2_API int get_intraop_numa_node_id();
+
 /*
 parallel_for
 
@@ -56,6 +67,52 @@ inline void parallel_for(
     const int64_t grain_size,
     const F& f);
 
+/*
+parallel_for_numa
+
+A `parallel_for` for kernels walking contiguous data whose pages may be
+spread across NUMA nodes. `data` points at element `begin` of the range and
+`itemsize` is the element stride in bytes. Each chunk looks up the node its
+first element resides on and makes that node the executing thread's
+preferred allocation node for the duration of the chunk, so scratch buffers
+allocated inside land next to the data being processed. Combine with
+`set_intraop_numa_node_id()` to also keep the pool's threads on one node.
+When NUMA is unavailable this is exactly `parallel_for`.
+
+The same thread-locality warning as for `parallel_for` applies.
+*/
+template <class F>
+inline void parallel_for_numa(
+    const int64_t begin,
+    const int64_t end,
+    const int64_t grain_size,
+    const void* data,
+    const size_t itemsize,
+    const F& f) {
+  if (!c10::IsNUMAEnabled() || data == nullptr || begin >= end) {
+    parallel_for(begin, end, grain_size, f);
+    return;
+  }
+  parallel_for(
+      begin, end, grain_size, [&](int64_t chunk_begin, int64_t chunk_end) {
+        const char* chunk_data = static_cast<const char*>(data) +
+            (chunk_begin - begin) * static_cast<int64_t>(itemsize);
+        const int node = c10::GetNUMANode(chunk_data);
+        if (node < 0) {
+          f(chunk_begin, chunk_end);
+          return;
+        }
+        struct PreferredNodeGuard {
+          int prev = c10::GetPreferredNUMANode();
+          ~PreferredNodeGuard() {
+            c10::SetPreferredNUMANode(prev);
+          }
+        } guard;
+        c10::SetPreferredNUMANode(node);
+        f(chunk_begin, chunk_end);
+      });
+}
+
 /*
 parallel_reduce
 
@@ -115,6 +172,25 @@ CAFFE2_API int get_num_interop_threads();
 // Launches inter-op parallel task
 CAFFE2_API void launch(std::function<void()> func);
 
+// Quality-of-service class for inter-op tasks; background tasks are only
+// dispatched when no latency-critical task is waiting in the inter-op queue.
+enum class TaskQoS : uint8_t { Latency, Background };
+
+// Launches inter-op parallel task with the given QoS class
+CAFFE2_API void launch(std::function<void()> func, TaskQoS qos);
+
+// Sets the shared core budget jointly governing the inter-op and intra-op
+// pools (see Note [Thread pool governor] in ParallelThreadPoolNative.cpp);
+// 0 disables the governor
+CAFFE2_API void set_thread_pool_budget(int budget);
+
+// Returns the shared core budget, or 0 when the governor is disabled;
+// initialized from the ATEN_THREAD_POOL_BUDGET environment variable
+CAFFE2_API int get_thread_pool_budget();
+
+// Returns the approximate number of inter-op tasks queued or running
+CAFFE2_API int get_interop_queue_depth();
+
 // Launches intra-op parallel task
 CAFFE2_API void intraop_launch(std::function<void()> func);
 
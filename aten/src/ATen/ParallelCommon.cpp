@@ -4,6 +4,8 @@
 #include <ATen/PTThreadPool.h>
 #include <ATen/Version.h>
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <thread>
 
@@ -40,8 +42,30 @@ size_t get_env_num_threads(const char* var_name, size_t def_value = 0) {
   return def_value;
 }
 
+// Shared core budget for the thread pool governor; see
+// Note [Thread pool governor] in ParallelThreadPoolNative.cpp.
+// NOT_INITIALIZED -> value from ATEN_THREAD_POOL_BUDGET (0 = disabled)
+// or any value set through set_thread_pool_budget
+const int BUDGET_NOT_INITIALIZED = -1;
+std::atomic<int> thread_pool_budget{BUDGET_NOT_INITIALIZED};
+
 } // namespace
 
+void set_thread_pool_budget(int budget) {
+  TORCH_CHECK(budget >= 0, "Expected non-negative thread pool budget");
+  thread_pool_budget.store(budget);
+}
+
+int get_thread_pool_budget() {
+  int budget = thread_pool_budget.load();
+  if (budget == BUDGET_NOT_INITIALIZED) {
+    // benign race: the environment lookup is idempotent
+    budget = (int)get_env_num_threads("ATEN_THREAD_POOL_BUDGET", 0);
+    thread_pool_budget.store(budget);
+  }
+  return budget;
+}
+
 std::string get_parallel_info() {
   std::ostringstream ss;
 
@@ -49,6 +73,10 @@ std::string get_parallel_info() {
      << at::get_num_threads() << std::endl;
   ss << "\tat::get_num_interop_threads() : "
      << at::get_num_interop_threads() << std::endl;
+  int budget = at::get_thread_pool_budget();
+  if (budget > 0) {
+    ss << "\tat::get_thread_pool_budget() : " << budget << std::endl;
+  }
 
   ss << at::get_openmp_version() << std::endl;
 #ifdef _OPENMP
@@ -103,6 +131,11 @@ int intraop_default_num_threads() {
   if (nthreads == 0) {
     nthreads = TaskThreadPoolBase::defaultNumThreads();
   }
+  // clamp the default to the shared core budget if one is set
+  int budget = get_thread_pool_budget();
+  if (budget > 0) {
+    nthreads = std::min(nthreads, (size_t)budget);
+  }
   return nthreads;
 #endif
 }
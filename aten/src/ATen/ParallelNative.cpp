@@ -9,7 +9,10 @@
 #include <caffe2/utils/threadpool/ThreadPoolMobile.h>
 #endif // C10_MOBILE
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cstdlib>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -55,6 +58,10 @@ const int CONSUMED = -2;
 //  - CONSUMED - pool is initialized
 std::atomic<int> num_intraop_threads{NOT_SET};
 
+// NUMA node the intra-op pool should be bound to; -1 means unbound.
+// Must be set before the pool is created (see set_intraop_numa_node_id).
+std::atomic<int> intraop_numa_node{-1};
+
 int _num_pool_threads(int nthreads) {
   if (nthreads == NOT_SET) {
     nthreads = intraop_default_num_threads();
@@ -67,11 +74,21 @@ int _num_pool_threads(int nthreads) {
 
 TaskThreadPoolBase& _get_intraop_pool() {
   static std::shared_ptr<TaskThreadPoolBase> pool =
-      ThreadPoolRegistry()->Create(
-          "C10",
-          /* device_id */ 0,
-          /* pool_size */ _num_pool_threads(num_intraop_threads.exchange(CONSUMED)),
-          /* create_new */ true); // create a separate thread pool for intra-op
+      []() -> std::shared_ptr<TaskThreadPoolBase> {
+    int pool_size = _num_pool_threads(num_intraop_threads.exchange(CONSUMED));
+    int numa_node_id = intraop_numa_node.load();
+    if (numa_node_id >= 0) {
+      // The registry creator signature cannot carry the node id, so build
+      // the pool directly; PTThreadPool binds each worker to the node.
+      return std::make_shared<PTThreadPool>(pool_size, numa_node_id);
+    }
+    // create a separate thread pool for intra-op
+    return ThreadPoolRegistry()->Create(
+        "C10",
+        /* device_id */ 0,
+        /* pool_size */ pool_size,
+        /* create_new */ true);
+  }();
   return *pool;
 }
 
@@ -112,10 +129,138 @@ struct ParallelRegionGuard {
   }
 };
 
+// Note [Adaptive grain size]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The grain sizes passed to parallel_for are compile-time constants tuned
+// for a particular machine; the same constant is too coarse on a large
+// server (too few tasks to keep the pool busy) and too fine on a small box
+// (task launch overhead dominates). When ATEN_ADAPTIVE_GRAIN_SIZE=1 is set,
+// _parallel_run measures the wall time spent in each call's chunks and keeps
+// a decaying per-element cost estimate in a small table. The caller's grain
+// size is used as the table key: distinct kernels overwhelmingly pass
+// distinct grain constants (often derived from their per-element work), so
+// it acts as a cheap proxy for the op site; colliding sites merely share an
+// estimate. Later calls use the estimate to pick a task count aiming at
+// ~kTargetTaskNs per task -- splitting into more tasks than threads when the
+// work is long (so the pool can rebalance uneven chunks) and into fewer when
+// chunks would be too short to amortize a pool hand-off. The caller's grain
+// size is still respected as a lower bound on chunk size.
+
+constexpr size_t kNumCostSlots = 64;
+// Aim for tasks long enough to amortize a pool hand-off but short enough
+// that the pool can still rebalance when per-chunk times are uneven.
+constexpr int64_t kTargetTaskNs = 200 * 1000;
+constexpr size_t kMaxTasksPerThread = 8;
+
+struct ChunkCostSlot {
+  std::atomic<int64_t> grain_size{0};
+  // decaying average of nanoseconds per 1024 elements for this grain size
+  std::atomic<int64_t> ns_per_kelem{0};
+};
+
+std::array<ChunkCostSlot, kNumCostSlots>& _cost_table() {
+  static std::array<ChunkCostSlot, kNumCostSlots> table;
+  return table;
+}
+
+bool _adaptive_grain_enabled() {
+  static bool enabled = []() {
+    const char* value = std::getenv("ATEN_ADAPTIVE_GRAIN_SIZE");
+    return value && std::atoi(value) != 0;
+  }();
+  return enabled;
+}
+
+size_t _cost_slot(int64_t grain_size) {
+  // Fibonacci hashing; top bits index the table
+  uint64_t h = static_cast<uint64_t>(grain_size) * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>(h >> 58);
+}
+
+std::tuple<size_t, size_t> _adaptive_num_tasks_and_chunk_size(
+    int64_t begin, int64_t end, int64_t grain_size,
+    size_t num_tasks, size_t chunk_size) {
+  auto& slot = _cost_table()[_cost_slot(grain_size)];
+  if (slot.grain_size.load(std::memory_order_relaxed) != grain_size) {
+    return std::make_tuple(num_tasks, chunk_size);
+  }
+  int64_t ns_per_kelem = slot.ns_per_kelem.load(std::memory_order_relaxed);
+  if (ns_per_kelem <= 0) {
+    return std::make_tuple(num_tasks, chunk_size);
+  }
+  int64_t range = end - begin;
+  int64_t total_ns = (range * ns_per_kelem) / 1024;
+  size_t tasks = static_cast<size_t>(
+      std::max<int64_t>(1, total_ns / kTargetTaskNs));
+  tasks = std::min(tasks, (size_t)get_num_threads() * kMaxTasksPerThread);
+  if (grain_size > 0) {
+    // keep the caller's grain size as a lower bound on chunk size
+    tasks = std::min(tasks, (size_t)divup(range, grain_size));
+  }
+  if (tasks <= 1) {
+    return std::make_tuple((size_t)1, (size_t)range);
+  }
+  chunk_size = divup(range, (int64_t)tasks);
+  num_tasks = divup(range, (int64_t)chunk_size);
+  return std::make_tuple(num_tasks, chunk_size);
+}
+
+void _record_chunk_cost(int64_t grain_size, int64_t ns, int64_t numel) {
+  auto& slot = _cost_table()[_cost_slot(grain_size)];
+  int64_t observed = (ns * 1024) / std::max<int64_t>(numel, 1);
+  if (slot.grain_size.load(std::memory_order_relaxed) != grain_size) {
+    slot.grain_size.store(grain_size, std::memory_order_relaxed);
+    slot.ns_per_kelem.store(observed, std::memory_order_relaxed);
+    return;
+  }
+  int64_t prev = slot.ns_per_kelem.load(std::memory_order_relaxed);
+  // decaying average smooths scheduling noise across calls
+  slot.ns_per_kelem.store((3 * prev + observed) / 4, std::memory_order_relaxed);
+}
+
+// See Note [Thread pool governor] in ParallelThreadPoolNative.cpp: while
+// inter-op tasks are queued or running, shrink intra-op fan-out so that
+// concurrent requests share the core budget instead of oversubscribing it.
+std::tuple<size_t, size_t> _governed_num_tasks_and_chunk_size(
+    int64_t begin, int64_t end, size_t num_tasks, size_t chunk_size) {
+  int budget = get_thread_pool_budget();
+  if (budget <= 0 || num_tasks <= 1) {
+    return std::make_tuple(num_tasks, chunk_size);
+  }
+  int depth = std::max(1, get_interop_queue_depth());
+  size_t max_tasks = static_cast<size_t>(std::max(1, budget / depth));
+  if (num_tasks <= max_tasks) {
+    return std::make_tuple(num_tasks, chunk_size);
+  }
+  int64_t range = end - begin;
+  chunk_size = divup(range, (int64_t)max_tasks);
+  num_tasks = divup(range, (int64_t)chunk_size);
+  return std::make_tuple(num_tasks, chunk_size);
+}
+
 } // namespace
 
 namespace internal {
 
+size_t _parallel_run_max_num_tasks(
+  const int64_t begin,
+  const int64_t end,
+  const int64_t grain_size) {
+  size_t num_tasks, chunk_size;
+  std::tie(num_tasks, chunk_size) =
+      internal::calc_num_tasks_and_chunk_size(begin, end, grain_size);
+  if (_adaptive_grain_enabled() && num_tasks > 1) {
+    // see Note [Adaptive grain size]; the adaptive split never exceeds
+    // kMaxTasksPerThread tasks per thread or one task per grain
+    size_t max_tasks = (size_t)get_num_threads() * kMaxTasksPerThread;
+    if (grain_size > 0) {
+      max_tasks = std::min(max_tasks, (size_t)divup(end - begin, grain_size));
+    }
+    num_tasks = std::max(num_tasks, max_tasks);
+  }
+  return num_tasks;
+}
+
 void _parallel_run(
   const int64_t begin,
   const int64_t end,
@@ -125,20 +270,43 @@ void _parallel_run(
   std::tie(num_tasks, chunk_size) =
       internal::calc_num_tasks_and_chunk_size(begin, end, grain_size);
 
+  // see Note [Adaptive grain size]
+  const bool adaptive = _adaptive_grain_enabled() && num_tasks > 1;
+  if (adaptive) {
+    std::tie(num_tasks, chunk_size) = _adaptive_num_tasks_and_chunk_size(
+        begin, end, grain_size, num_tasks, chunk_size);
+  }
+  // see Note [Thread pool governor]
+  std::tie(num_tasks, chunk_size) = _governed_num_tasks_and_chunk_size(
+      begin, end, num_tasks, chunk_size);
+  std::atomic<int64_t> measured_ns{0};
+  std::atomic<int64_t> measured_elems{0};
+
   std::atomic_flag err_flag = ATOMIC_FLAG_INIT;
   std::exception_ptr eptr;
   std::vector<std::shared_ptr<c10::ivalue::Future>> futures(num_tasks);
   for (size_t task_id = 0; task_id < num_tasks; ++task_id) {
     futures[task_id] = std::make_shared<c10::ivalue::Future>(c10::NoneType::get());
   }
-  auto task = [f, &eptr, &err_flag, &futures, begin, end, chunk_size]
+  auto task = [f, &eptr, &err_flag, &futures, begin, end, chunk_size,
+      adaptive, &measured_ns, &measured_elems]
       (int /* unused */, size_t task_id) {
     int64_t local_start = begin + task_id * chunk_size;
     if (local_start < end) {
       int64_t local_end = std::min(end, (int64_t)(chunk_size + local_start));
       try {
         ParallelRegionGuard guard(task_id);
-        f(local_start, local_end, task_id);
+        if (adaptive) {
+          auto start_time = std::chrono::steady_clock::now();
+          f(local_start, local_end, task_id);
+          auto elapsed = std::chrono::steady_clock::now() - start_time;
+          measured_ns +=
+              std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                  .count();
+          measured_elems += local_end - local_start;
+        } else {
+          f(local_start, local_end, task_id);
+        }
       } catch (...) {
         if (!err_flag.test_and_set()) {
           eptr = std::current_exception();
@@ -156,6 +324,9 @@ void _parallel_run(
   if (eptr) {
     std::rethrow_exception(eptr);
   }
+  if (adaptive && measured_elems.load() > 0) {
+    _record_chunk_cost(grain_size, measured_ns.load(), measured_elems.load());
+  }
 }
 
 } // namespace internal
@@ -218,6 +389,32 @@ int get_num_threads() {
 #endif // C10_MOBILE
 }
 
+void set_intraop_numa_node_id(int numa_node_id) {
+#ifndef C10_MOBILE
+  TORCH_CHECK(numa_node_id >= -1, "Expected a NUMA node id or -1");
+  if (num_intraop_threads.load() == CONSUMED) {
+    TORCH_WARN(
+      "Cannot set the intra-op NUMA node after parallel work has started "
+      "when using native parallel backend");
+    return;
+  }
+  intraop_numa_node.store(numa_node_id);
+  // The calling thread executes the first chunk of every parallel region,
+  // so bind it as well.
+  c10::NUMABind(numa_node_id);
+#else
+  TORCH_CHECK(false, "set_intraop_numa_node_id is not supported for mobile.");
+#endif // C10_MOBILE
+}
+
+int get_intraop_numa_node_id() {
+#ifndef C10_MOBILE
+  return intraop_numa_node.load();
+#else
+  return -1;
+#endif // C10_MOBILE
+}
+
 int get_thread_num() {
   return thread_num_;
 }
@@ -28,6 +28,14 @@ CAFFE2_API void _parallel_run(
   const int64_t grain_size,
   const std::function<void(int64_t, int64_t, size_t)>& f);
 
+// Upper bound on the number of tasks _parallel_run may split [begin, end)
+// into. Matches calc_num_tasks_and_chunk_size unless the adaptive grain
+// size mode is enabled; see Note [Adaptive grain size] in ParallelNative.cpp.
+CAFFE2_API size_t _parallel_run_max_num_tasks(
+  const int64_t begin,
+  const int64_t end,
+  const int64_t grain_size);
+
 } // namespace internal
 
 template <class F>
@@ -69,10 +77,10 @@ inline scalar_t parallel_reduce(
   if ((end - begin) < grain_size || in_parallel_region()) {
     return f(begin, end, ident);
   }
-  size_t num_tasks, chunk_size;
-  std::tie(num_tasks, chunk_size) =
-      internal::calc_num_tasks_and_chunk_size(begin, end, grain_size);
-  std::vector<scalar_t> results(num_tasks);
+  size_t max_num_tasks =
+      internal::_parallel_run_max_num_tasks(begin, end, grain_size);
+  // tasks that end up unused keep the identity and drop out of the combine
+  std::vector<scalar_t> results(max_num_tasks, ident);
   scalar_t* results_data = results.data();
   internal::_parallel_run(
       begin,
@@ -72,6 +72,16 @@ int get_thread_num() {
   return tbb::this_task_arena::current_thread_index();
 }
 
+void set_intraop_numa_node_id(int /* numa_node_id */) {
+  TORCH_WARN(
+    "set_intraop_numa_node_id is only supported with the native "
+    "parallel backend");
+}
+
+int get_intraop_numa_node_id() {
+  return -1;
+}
+
 bool in_parallel_region() {
   return tbb::this_task_arena::current_thread_index() != -1;
 }
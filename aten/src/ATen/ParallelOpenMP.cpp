@@ -70,6 +70,16 @@ int get_thread_num() {
 #endif
 }
 
+void set_intraop_numa_node_id(int /* numa_node_id */) {
+  TORCH_WARN(
+    "set_intraop_numa_node_id is only supported with the native "
+    "parallel backend");
+}
+
+int get_intraop_numa_node_id() {
+  return -1;
+}
+
 bool in_parallel_region() {
 #ifdef _OPENMP
   return omp_in_parallel();
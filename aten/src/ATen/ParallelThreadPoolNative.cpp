@@ -3,7 +3,10 @@
 #include <ATen/PTThreadPool.h>
 #include <ATen/ThreadLocalDebugInfo.h>
 
+#include <algorithm>
 #include <atomic>
+#include <deque>
+#include <mutex>
 
 namespace at {
 
@@ -11,6 +14,59 @@ namespace {
 const int NOT_SET = -1;
 const int CONSUMED = -2;
 
+// Note [Thread pool governor]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The inter-op pool (at::launch) and the intra-op pool (at::parallel_for)
+// are created independently and each defaults to one thread per core, so a
+// server driving both at once ends up roughly 2x oversubscribed. When a
+// shared core budget is configured (set_thread_pool_budget or the
+// ATEN_THREAD_POOL_BUDGET environment variable), the two lanes are governed
+// jointly:
+//  - the pools' default sizes are clamped to the budget;
+//  - inter-op tasks carry a QoS class: background tasks wait in a side
+//    queue and are only dispatched when no latency-critical task is queued;
+//  - intra-op parallel regions shrink their fan-out in proportion to the
+//    inter-op queue depth (see _governed_num_tasks in ParallelNative.cpp),
+//    so cores repartition towards concurrent requests under load and back
+//    to intra-op parallelism when the request queue drains.
+// The governor never resizes the pools themselves; it only bounds how much
+// of the budget each lane may use at a time.
+
+// number of inter-op tasks queued or running
+std::atomic<int> interop_depth{0};
+
+struct QoSQueues {
+  std::mutex mutex;
+  std::deque<std::function<void()>> latency;
+  std::deque<std::function<void()>> background;
+};
+
+QoSQueues& qos_queues() {
+  static QoSQueues queues;
+  return queues;
+}
+
+// Pops the next task latency-first; every launch enqueues exactly one task
+// and one trampoline, so each queued task is eventually run.
+void run_next_task() {
+  std::function<void()> task;
+  {
+    auto& queues = qos_queues();
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    if (!queues.latency.empty()) {
+      task = std::move(queues.latency.front());
+      queues.latency.pop_front();
+    } else if (!queues.background.empty()) {
+      task = std::move(queues.background.front());
+      queues.background.pop_front();
+    }
+  }
+  if (task) {
+    task();
+  }
+  interop_depth--;
+}
+
 // Number of inter-op threads set by the user;
 // NOT_SET -> positive value -> CONSUMED
 // (CONSUMED - thread pool is initialized)
@@ -60,14 +116,24 @@ int get_num_interop_threads() {
   if (nthreads > 0) {
     return nthreads;
   } else if (nthreads == NOT_SET) {
-    // return default value
-    return TaskThreadPoolBase::defaultNumThreads();
+    // return default value, clamped to the shared core budget if one is set
+    int default_nthreads = TaskThreadPoolBase::defaultNumThreads();
+    int budget = get_thread_pool_budget();
+    return budget > 0 ? std::min(default_nthreads, budget) : default_nthreads;
   } else {
     return get_pool().size();
   }
 }
 
+int get_interop_queue_depth() {
+  return interop_depth.load();
+}
+
 void launch(std::function<void()> func) {
+  launch(std::move(func), TaskQoS::Latency);
+}
+
+void launch(std::function<void()> func, TaskQoS qos) {
   auto fn = std::bind([](
     std::function<void()> f, std::shared_ptr<ThreadLocalDebugInfoBase> info) {
       DebugInfoGuard guard(std::move(info));
@@ -80,7 +146,17 @@ void launch(std::function<void()> func) {
 #if AT_EXPERIMENTAL_SINGLE_THREAD_POOL
   intraop_launch(fn);
 #else
-  get_pool().run(fn);
+  // see Note [Thread pool governor]: tasks pass through per-QoS queues and
+  // are drained latency-first by a trampoline submitted per task
+  interop_depth++;
+  {
+    auto& queues = qos_queues();
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    auto& queue =
+        qos == TaskQoS::Latency ? queues.latency : queues.background;
+    queue.push_back(std::move(fn));
+  }
+  get_pool().run(run_next_task);
 #endif
 }
 
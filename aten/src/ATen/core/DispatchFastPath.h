@@ -0,0 +1,38 @@
+#pragma once
+
+// Eligibility checks for the inlined hot-op fast paths emitted into the
+// generated Functions.h / TensorMethods.h when ATEN_HOT_OP_FAST_PATH is
+// defined (see fast_path_hot_ops in aten/src/ATen/function_wrapper.py).
+//
+// The generated fast path calls a backend wrapper directly, skipping
+// dispatch key extraction. That is only sound if dynamic dispatch would
+// have arrived at the same kernel, so the checks here are deliberately
+// conservative: every dispatch-relevant tensor must carry exactly the
+// CPUTensorId key and hold float data, and no thread-local dispatch key
+// overrides (profiling, variable mode, ...) may be active. Anything else
+// falls through to the regular dispatcher.
+
+#include <ATen/core/Tensor.h>
+#include <c10/core/DispatchKeySet.h>
+#include <c10/core/impl/LocalDispatchKeySet.h>
+
+namespace at {
+namespace detail {
+
+inline bool fast_path_tensor_eligible(const Tensor& t) {
+  return t.key_set() == c10::DispatchKeySet(c10::DispatchKey::CPUTensorId) &&
+      t.scalar_type() == at::kFloat;
+}
+
+inline bool fast_path_eligible() {
+  const auto tls = c10::impl::tls_local_dispatch_key_set();
+  return tls.included_.empty() && tls.excluded_.empty();
+}
+
+template <class... Rest>
+inline bool fast_path_eligible(const Tensor& t, const Rest&... rest) {
+  return fast_path_tensor_eligible(t) && fast_path_eligible(rest...);
+}
+
+} // namespace detail
+} // namespace at
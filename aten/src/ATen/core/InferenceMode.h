@@ -0,0 +1,53 @@
+#pragma once
+
+#include <ATen/core/grad_mode.h>
+#include <c10/core/DispatchKey.h>
+#include <c10/core/InferenceMode.h>
+#include <c10/core/impl/LocalDispatchKeySet.h>
+
+namespace at {
+
+/// A RAII, thread local (!) guard for inference-only execution.
+///
+/// While the guard is alive:
+///
+///  - grad mode is disabled, so no operation records history;
+///  - the VariableTensorId key is excluded from dispatch, so ops skip the
+///    VariableType layer (autograd, profiling, tracing wrappers) entirely
+///    and go straight to the backend kernel;
+///  - newly created tensors skip allocating autograd bookkeeping: they have
+///    no AutogradMeta (already the case for requires_grad=false tensors)
+///    and no version counter (see VariableVersion in c10/core/TensorImpl.h),
+///    which also defers the in-place/view version checks built on it.
+///
+/// Compared to AutoNonVariableTypeMode (ATen/core/LegacyTypeDispatch.h),
+/// which only flips the dispatch key and is an internal workaround, this is
+/// the supported way to run inference workloads without autograd overhead.
+/// Compared to NoGradGuard, ops do not traverse the variable layer at all.
+///
+/// Tensors created inside the guard must not be used in autograd once the
+/// guard is gone: they carry no version counter, so in-place modifications
+/// of them cannot be detected by the usual safety checks.
+struct CAFFE2_API InferenceMode {
+  InferenceMode()
+      : grad_guard_(/*enabled=*/false),
+        non_variable_guard_(DispatchKey::VariableTensorId),
+        prev_enabled_(c10::impl::tls_is_inference_mode_enabled()) {
+    c10::impl::tls_set_inference_mode_enabled(true);
+  }
+
+  ~InferenceMode() {
+    c10::impl::tls_set_inference_mode_enabled(prev_enabled_);
+  }
+
+  static bool is_enabled() {
+    return c10::impl::tls_is_inference_mode_enabled();
+  }
+
+ private:
+  AutoGradMode grad_guard_;
+  c10::impl::ExcludeDispatchKeyGuard non_variable_guard_;
+  bool prev_enabled_;
+};
+
+} // namespace at
@@ -475,6 +475,8 @@ _(aten, mkldnn_convolution) \
 _(aten, mkldnn_convolution_backward) \
 _(aten, mkldnn_convolution_backward_input) \
 _(aten, mkldnn_convolution_backward_weights) \
+_(aten, mkldnn_convolution_relu) \
+_(aten, mkldnn_linear) \
 _(aten, mm) \
 _(aten, mode) \
 _(aten, mse_loss) \
@@ -557,6 +559,7 @@ _(aten, reflection_pad2d) \
 _(aten, reflection_pad2d_backward) \
 _(aten, reflection_pad2d_forward) \
 _(aten, relu) \
+_(aten, relu_) \
 _(aten, remainder) \
 _(aten, renorm) \
 _(aten, repeat) \
@@ -593,6 +596,7 @@ _(aten, select) \
 _(aten, selu) \
 _(aten, set) \
 _(aten, sigmoid) \
+_(aten, sigmoid_) \
 _(aten, sign) \
 _(aten, sin) \
 _(aten, sinh) \
@@ -676,6 +680,7 @@ _(aten, threshold_backward) \
 _(aten, to) \
 _(aten, to_sparse) \
 _(aten, to_dense) \
+_(aten, to_mkldnn) \
 _(aten, topk) \
 _(aten, trace) \
 _(aten, transpose) \
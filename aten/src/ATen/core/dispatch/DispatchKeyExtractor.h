@@ -16,6 +16,19 @@ namespace impl {
 // always_included to get inlined, constexpr not necessary)
 const DispatchKeySet always_included{DispatchKey::VariableTensorId};
 
+#ifdef C10_DISPATCH_KEY_RESOLUTION_STATS
+// Opt-in instrumentation (build with -DC10_DISPATCH_KEY_RESOLUTION_STATS):
+// per-thread histogram of which dispatch key each key resolution lands on.
+// Sampling this around a region of interest (e.g. a single op in a benchmark
+// loop) gives resolution counts per op; cycle-level attribution per op comes
+// from the regular RecordFunction-based profiler.
+inline uint64_t* tls_dispatch_key_resolution_counts() {
+  static thread_local uint64_t counts[static_cast<size_t>(
+      DispatchKey::NumDispatchKeys)] = {};
+  return counts;
+}
+#endif
+
 // Take a DispatchKeySet for a Tensor and determine what the actual dispatch
 // DispatchKey should be, taking into account TLS, and skipping backends which
 // fall through.
@@ -42,7 +55,11 @@ static inline DispatchKey dispatchTypeId(
   // it's a bit troublesome, because fastpath TLS access requires the type of
   // the TLS in question to be zero-initialized, so you don't actually win
   // anyting in that case.
-  return (((ks | local.included_ | always_included) - local.excluded_) & key_mask).highestPriorityTypeId();
+  auto result = (((ks | local.included_ | always_included) - local.excluded_) & key_mask).highestPriorityTypeId();
+#ifdef C10_DISPATCH_KEY_RESOLUTION_STATS
+  tls_dispatch_key_resolution_counts()[static_cast<size_t>(result)]++;
+#endif
+  return result;
 }
 
 }
@@ -40,7 +40,8 @@ Dispatcher::Dispatcher()
 , backendFallbackKernels_()
 , backendsWithoutFallthrough_(DispatchKeySet::FULL)
 , listeners_(std::make_unique<detail::RegistrationListenerList>())
-, mutex_() {}
+, mutex_()
+, registrationEpoch_(1) {}
 
 Dispatcher::~Dispatcher() {}
 
@@ -125,6 +126,8 @@ RegistrationHandleRAII Dispatcher::registerDef(FunctionSchema schema) {
   ++op.operatorIterator_->def_count;
   ++op.operatorIterator_->def_and_impl_count;
 
+  registrationEpoch_.fetch_add(1, std::memory_order_acq_rel);
+
   return RegistrationHandleRAII([this, op, op_name] {
     deregisterDef_(op, op_name);
   });
@@ -169,6 +172,8 @@ void Dispatcher::deregisterDef_(const OperatorHandle& op, const OperatorName& op
     op.operatorIterator_->op.deregisterSchema();
   }
 
+  registrationEpoch_.fetch_add(1, std::memory_order_acq_rel);
+
   cleanup(op, op_name);
 }
 
@@ -187,6 +192,8 @@ RegistrationHandleRAII Dispatcher::registerImpl(
 
   ++op.operatorIterator_->def_and_impl_count;
 
+  registrationEpoch_.fetch_add(1, std::memory_order_acq_rel);
+
   return RegistrationHandleRAII([this, op, op_name, dispatch_key, handle] {
     deregisterImpl_(op, op_name, dispatch_key, handle);
   });
@@ -202,6 +209,8 @@ void Dispatcher::deregisterImpl_(const OperatorHandle& op, const OperatorName& o
   TORCH_INTERNAL_ASSERT(op.operatorIterator_->def_and_impl_count > 0);
   --op.operatorIterator_->def_and_impl_count;
 
+  registrationEpoch_.fetch_add(1, std::memory_order_acq_rel);
+
   cleanup(op, op_name);
 }
 
@@ -224,6 +233,8 @@ RegistrationHandleRAII Dispatcher::registerFallback(DispatchKey dispatchKey, Ker
     backendsWithoutFallthrough_ = backendsWithoutFallthrough_.remove(dispatchKey);
   }
 
+  registrationEpoch_.fetch_add(1, std::memory_order_acq_rel);
+
   return RegistrationHandleRAII([this, dispatchKey] {
     deregisterFallback_(dispatchKey);
   });
@@ -233,6 +244,7 @@ void Dispatcher::deregisterFallback_(DispatchKey dispatchKey) {
   auto result = backendFallbackKernels_.removeKernelIfExists(dispatchKey);
   backendsWithoutFallthrough_ = backendsWithoutFallthrough_.add(dispatchKey);
   TORCH_INTERNAL_ASSERT(result == impl::KernelFunctionTable::RemoveKernelIfExistsResult::REMOVED_KERNEL, "Tried to deregister a backend fallback kernel for ", dispatchKey, " but there was none registered.");
+  registrationEpoch_.fetch_add(1, std::memory_order_acq_rel);
 }
 
 
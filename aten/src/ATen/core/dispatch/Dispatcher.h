@@ -4,12 +4,15 @@
 #include <ATen/core/dispatch/RegistrationHandleRAII.h>
 #include <c10/util/Exception.h>
 #include <c10/util/LeftRight.h>
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <list>
 
 namespace c10 {
 
 class CAFFE2_API OperatorHandle;
+class CAFFE2_API CachedOperatorHandle;
 
 /**
  * Implement this interface and register your instance with the dispatcher
@@ -62,6 +65,7 @@ private:
     size_t def_and_impl_count = 0;
   };
   friend class OperatorHandle;
+  friend class CachedOperatorHandle;
 
 public:
   ~Dispatcher();
@@ -120,6 +124,16 @@ public:
   // Invoke an operator via the boxed calling convention using an IValue stack
   void callBoxed(const OperatorHandle& op, Stack* stack) const;
 
+  /**
+   * A counter that is bumped every time the set of registered kernels
+   * changes (defs, impls and backend fallbacks). CachedOperatorHandle uses
+   * it to detect when a cached kernel table has become stale. Starts at 1
+   * so that a zero-initialized cache epoch is always considered stale.
+   */
+  uint64_t registrationEpoch() const {
+    return registrationEpoch_.load(std::memory_order_acquire);
+  }
+
   // ------------------------------------------------------------------------
   //
   // Performing registrations (NON user public; use op_registration)
@@ -189,6 +203,10 @@ private:
 
   const KernelFunction& dispatch_(const DispatchTable& dispatchTable, DispatchKey dispatch_key) const;
 
+  // Like dispatch_, but returns nullptr instead of erroring if no kernel
+  // (backend, backend fallback or catch-all) is available for the key.
+  const KernelFunction* lookupKernelOrNull_(const DispatchTable& dispatchTable, DispatchKey dispatch_key) const;
+
   std::list<OperatorDef> operators_;
   LeftRight<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
   impl::KernelFunctionTable backendFallbackKernels_;
@@ -198,6 +216,7 @@ private:
   DispatchKeySet backendsWithoutFallthrough_;
   std::unique_ptr<detail::RegistrationListenerList> listeners_;
   std::mutex mutex_;
+  std::atomic<uint64_t> registrationEpoch_;
 };
 
 /**
@@ -250,10 +269,65 @@ private:
   explicit OperatorHandle(std::list<Dispatcher::OperatorDef>::iterator operatorIterator)
   : operatorIterator_(std::move(operatorIterator)) {}
   friend class Dispatcher;
+  friend class CachedOperatorHandle;
 
   std::list<Dispatcher::OperatorDef>::iterator operatorIterator_;
 };
 
+/**
+ * An OperatorHandle that additionally caches a fully resolved kernel table,
+ * i.e. a flat array mapping each DispatchKey to the kernel a call with that
+ * key would end up in after considering backend kernels, backend fallback
+ * kernels and the catch-all kernel. This turns steady-state dispatch into
+ * a single indexed load instead of the lookup chain in Dispatcher::dispatch_.
+ *
+ * The cache is stamped with the dispatcher's registration epoch and is
+ * rebuilt transparently on the first call after any kernel (de)registration.
+ * Intended for hot call sites (e.g. generated code) that dispatch through
+ * the same operator many times; construct it once and reuse it.
+ *
+ * Like the rest of the dispatcher's call path, calling through this handle
+ * concurrently with kernel (de)registrations is not synchronized.
+ */
+class CAFFE2_API CachedOperatorHandle final {
+public:
+  explicit CachedOperatorHandle(OperatorHandle op)
+  : op_(std::move(op))
+  , kernels_()
+  , epoch_(0)
+  , refreshMutex_() {}
+
+  // not copyable or movable because call sites are expected to construct
+  // this once and keep it alive (the cache is useless if it doesn't persist)
+  CachedOperatorHandle(const CachedOperatorHandle&) = delete;
+  CachedOperatorHandle& operator=(const CachedOperatorHandle&) = delete;
+
+  const OperatorHandle& operatorHandle() const {
+    return op_;
+  }
+
+  const FunctionSchema& schema() const {
+    return op_.schema();
+  }
+
+  template<class Return, class... Args>
+  Return callUnboxed(Args... args) const;
+
+  template<class Return, class... Args>
+  Return callUnboxedWithDispatchKey(DispatchKey dispatchKey, Args... args) const;
+
+  void callBoxed(Stack* stack) const;
+
+private:
+  const KernelFunction& lookup_(DispatchKey dispatchKey) const;
+  void refresh_(uint64_t currentEpoch) const;
+
+  OperatorHandle op_;
+  mutable std::array<const KernelFunction*, static_cast<uint8_t>(DispatchKey::NumDispatchKeys)> kernels_;
+  mutable std::atomic<uint64_t> epoch_;
+  mutable std::mutex refreshMutex_;
+};
+
 namespace detail {
 template<class... Args> inline void unused_arg_(const Args&...) {}
 }
@@ -282,24 +356,75 @@ inline void Dispatcher::callBoxed(const OperatorHandle& op, Stack* stack) const
   kernel.callBoxed(op, stack);
 }
 
-inline const KernelFunction& Dispatcher::dispatch_(const DispatchTable& dispatchTable, DispatchKey dispatchKey) const {
+inline const KernelFunction* Dispatcher::lookupKernelOrNull_(const DispatchTable& dispatchTable, DispatchKey dispatchKey) const {
   const KernelFunction* backendKernel = dispatchTable.lookup(dispatchKey);
 
   if (nullptr != backendKernel) {
-    return *backendKernel;
+    return backendKernel;
   }
 
   const auto& backendFallbackKernel = backendFallbackKernels_[dispatchKey];
   if (backendFallbackKernel.isValid()) {
-    return backendFallbackKernel;
+    return &backendFallbackKernel;
   }
 
-  const KernelFunction* catchallKernel = dispatchTable.lookupCatchallKernel();
-  if (C10_LIKELY(nullptr != catchallKernel)) {
-    return *catchallKernel;
+  return dispatchTable.lookupCatchallKernel();
+}
+
+inline const KernelFunction& Dispatcher::dispatch_(const DispatchTable& dispatchTable, DispatchKey dispatchKey) const {
+  const KernelFunction* kernel = lookupKernelOrNull_(dispatchTable, dispatchKey);
+  if (C10_LIKELY(nullptr != kernel)) {
+    return *kernel;
   }
 
   reportError(dispatchTable, dispatchKey);
 }
 
+inline const KernelFunction& CachedOperatorHandle::lookup_(DispatchKey dispatchKey) const {
+  const uint64_t currentEpoch = Dispatcher::singleton().registrationEpoch();
+  if (C10_UNLIKELY(epoch_.load(std::memory_order_acquire) != currentEpoch)) {
+    refresh_(currentEpoch);
+  }
+  const KernelFunction* kernel = kernels_[static_cast<uint8_t>(dispatchKey)];
+  if (C10_LIKELY(nullptr != kernel)) {
+    return *kernel;
+  }
+
+  Dispatcher::reportError(op_.operatorIterator_->op.dispatch_table(), dispatchKey);
+}
+
+inline void CachedOperatorHandle::refresh_(uint64_t currentEpoch) const {
+  std::lock_guard<std::mutex> lock(refreshMutex_);
+  const auto& dispatcher = Dispatcher::singleton();
+  const auto& dispatchTable = op_.operatorIterator_->op.dispatch_table();
+  for (uint8_t i = 0; i < static_cast<uint8_t>(DispatchKey::NumDispatchKeys); ++i) {
+    kernels_[i] = dispatcher.lookupKernelOrNull_(dispatchTable, static_cast<DispatchKey>(i));
+  }
+  // If a registration raced with the loop above, currentEpoch is already
+  // stale and the next call will refresh again.
+  epoch_.store(currentEpoch, std::memory_order_release);
+}
+
+template<class Return, class... Args>
+inline Return CachedOperatorHandle::callUnboxedWithDispatchKey(DispatchKey dispatchKey, Args... args) const {
+  detail::unused_arg_(args...);  // workaround for a false-positive warning about unused parameters in gcc 5
+  const KernelFunction& kernel = lookup_(dispatchKey);
+  return kernel.template callUnboxed<Return, Args...>(op_, std::forward<Args>(args)...);
+}
+
+template<class Return, class... Args>
+inline Return CachedOperatorHandle::callUnboxed(Args... args) const {
+  detail::unused_arg_(args...);  // workaround for a false-positive warning about unused parameters in gcc 5
+  const auto& dispatchTable = op_.operatorIterator_->op.dispatch_table();
+  auto dispatchKey = dispatchTable.dispatchKeyExtractor().getDispatchKeyUnboxed<Args...>(Dispatcher::singleton().backendsWithoutFallthrough_, args...);
+  return callUnboxedWithDispatchKey<Return, Args...>(dispatchKey, args...);
+}
+
+inline void CachedOperatorHandle::callBoxed(Stack* stack) const {
+  const auto& dispatchTable = op_.operatorIterator_->op.dispatch_table();
+  auto dispatchKey = dispatchTable.dispatchKeyExtractor().getDispatchKeyBoxed(Dispatcher::singleton().backendsWithoutFallthrough_, stack);
+  const KernelFunction& kernel = lookup_(dispatchKey);
+  kernel.callBoxed(op_, stack);
+}
+
 } // namespace c10
@@ -253,6 +253,7 @@ namespace c10 {
   _(attr, kinds)                     \
   _(attr, types)                     \
   _(attr, scope)                     \
+  _(attr, profiled_trip_count)       \
   _(attr, keepdims)                  \
   _(attr, new_axis)
 #else
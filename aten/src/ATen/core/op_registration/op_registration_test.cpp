@@ -559,6 +559,75 @@ TEST(OperatorRegistrationTest, whenRegisteringMultipleKernelsInSameOpCallAndCall
   }, "CUDATensorId");
 }
 
+TEST(OperatorRegistrationTest, givenCachedOperatorHandle_whenCalling_thenCallsCorrectKernel) {
+  bool called_kernel1 = false;
+  bool called_kernel2 = false;
+  auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options()
+    .kernel<MockKernel>(c10::DispatchKey::CPUTensorId, &called_kernel1)
+    .kernel<MockKernel>(c10::DispatchKey::CUDATensorId, &called_kernel2));
+
+  auto op = Dispatcher::singleton().findSchema({"_test::dummy", ""});
+  ASSERT_TRUE(op.has_value()); // assert schema is registered
+  c10::CachedOperatorHandle cached(*op);
+
+  auto stack = makeStack(dummyTensor(c10::DispatchKey::CPUTensorId));
+  cached.callBoxed(&stack);
+  EXPECT_TRUE(called_kernel1);
+  EXPECT_FALSE(called_kernel2);
+
+  called_kernel1 = called_kernel2 = false;
+  cached.callUnboxed<void, Tensor>(dummyTensor(c10::DispatchKey::CUDATensorId));
+  EXPECT_FALSE(called_kernel1);
+  EXPECT_TRUE(called_kernel2);
+
+  expectThrows<c10::Error>([&] {
+    cached.callUnboxed<void, Tensor>(dummyTensor(c10::DispatchKey::XLATensorId));
+  }, "Could not run '_test::dummy' with arguments from the 'XLATensorId'"
+  " backend. '_test::dummy' is only available for these backends: [");
+}
+
+TEST(OperatorRegistrationTest, givenCachedOperatorHandle_whenRegistrationsChange_thenRefreshesCache) {
+  bool called_cpu = false;
+  auto registrar1 = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options()
+    .kernel<MockKernel>(c10::DispatchKey::CPUTensorId, &called_cpu));
+
+  auto op = Dispatcher::singleton().findSchema({"_test::dummy", ""});
+  ASSERT_TRUE(op.has_value()); // assert schema is registered
+  c10::CachedOperatorHandle cached(*op);
+
+  cached.callUnboxed<void, Tensor>(dummyTensor(c10::DispatchKey::CPUTensorId));
+  EXPECT_TRUE(called_cpu);
+  expectThrows<c10::Error>([&] {
+    cached.callUnboxed<void, Tensor>(dummyTensor(c10::DispatchKey::CUDATensorId));
+  }, "Could not run '_test::dummy' with arguments from the 'CUDATensorId'");
+
+  {
+    bool called_cuda = false;
+    auto registrar2 = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options()
+      .kernel<MockKernel>(c10::DispatchKey::CUDATensorId, &called_cuda));
+
+    // a kernel registered after the handle was created must be picked up
+    cached.callUnboxed<void, Tensor>(dummyTensor(c10::DispatchKey::CUDATensorId));
+    EXPECT_TRUE(called_cuda);
+  }
+
+  // ...and a deregistered kernel must not be called anymore
+  expectThrows<c10::Error>([&] {
+    cached.callUnboxed<void, Tensor>(dummyTensor(c10::DispatchKey::CUDATensorId));
+  }, "Could not run '_test::dummy' with arguments from the 'CUDATensorId'");
+
+  called_cpu = false;
+  cached.callUnboxed<void, Tensor>(dummyTensor(c10::DispatchKey::CPUTensorId));
+  EXPECT_TRUE(called_cpu);
+}
+
+TEST(OperatorRegistrationTest, whenRegisteringKernel_thenRegistrationEpochIsBumped) {
+  auto epoch_before = Dispatcher::singleton().registrationEpoch();
+  auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options()
+    .kernel<DummyKernel>(c10::DispatchKey::CPUTensorId));
+  EXPECT_NE(epoch_before, Dispatcher::singleton().registrationEpoch());
+}
+
 TEST(OperatorRegistrationTest, whenRegisteringMultipleKernelsInSameOpCallOutOfScopeAndCalling_thenFails) {
   auto registrar0 = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()");
   {
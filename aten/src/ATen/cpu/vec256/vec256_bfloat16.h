@@ -185,14 +185,226 @@ public:
     auto o2 = vop(hi);
     return cvtfp32_bf16(o1, o2);
   }
- 
+  Vec256<BFloat16> abs() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto mask = _mm256_set1_ps(-0.f);
+    auto o1 = _mm256_andnot_ps(mask, lo);
+    auto o2 = _mm256_andnot_ps(mask, hi);
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> angle() const {
+    return _mm256_set1_epi16(0);
+  }
+  Vec256<BFloat16> real() const {
+    return *this;
+  }
+  Vec256<BFloat16> imag() const {
+    return _mm256_set1_epi16(0);
+  }
+  Vec256<BFloat16> conj() const {
+    return *this;
+  }
+  Vec256<BFloat16> acos() const {
+    return map(Sleef_acosf8_u10);
+  }
+  Vec256<BFloat16> asin() const {
+    return map(Sleef_asinf8_u10);
+  }
+  Vec256<BFloat16> atan() const {
+    return map(Sleef_atanf8_u10);
+  }
+  Vec256<BFloat16> atan2(const Vec256<BFloat16>& b) const {
+    __m256 lo, hi;
+    __m256 b1, b2;
+    cvtbf16_fp32(values, lo, hi);
+    cvtbf16_fp32(b.values, b1, b2);
+    auto o1 = Sleef_atan2f8_u10(lo, b1);
+    auto o2 = Sleef_atan2f8_u10(hi, b2);
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> erf() const {
+    return map(Sleef_erff8_u10);
+  }
+  Vec256<BFloat16> erfc() const {
+    return map(Sleef_erfcf8_u15);
+  }
   Vec256<BFloat16> exp() const {
     return map(Sleef_expf8_u10);
   }
+  Vec256<BFloat16> expm1() const {
+    return map(Sleef_expm1f8_u10);
+  }
+  Vec256<BFloat16> fmod(const Vec256<BFloat16>& q) const {
+    __m256 lo, hi;
+    __m256 q1, q2;
+    cvtbf16_fp32(values, lo, hi);
+    cvtbf16_fp32(q.values, q1, q2);
+    auto o1 = Sleef_fmodf8(lo, q1);
+    auto o2 = Sleef_fmodf8(hi, q2);
+    return cvtfp32_bf16(o1, o2);
+  }
   Vec256<BFloat16> log() const {
     return map(Sleef_logf8_u10);
   }
+  Vec256<BFloat16> log2() const {
+    return map(Sleef_log2f8_u10);
+  }
+  Vec256<BFloat16> log10() const {
+    return map(Sleef_log10f8_u10);
+  }
+  Vec256<BFloat16> log1p() const {
+    return map(Sleef_log1pf8_u10);
+  }
+  Vec256<BFloat16> frac() const;
+  Vec256<BFloat16> sin() const {
+    return map(Sleef_sinf8_u10);
+  }
+  Vec256<BFloat16> sinh() const {
+    return map(Sleef_sinhf8_u10);
+  }
+  Vec256<BFloat16> cos() const {
+    return map(Sleef_cosf8_u10);
+  }
+  Vec256<BFloat16> cosh() const {
+    return map(Sleef_coshf8_u10);
+  }
+  Vec256<BFloat16> ceil() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto o1 = _mm256_ceil_ps(lo);
+    auto o2 = _mm256_ceil_ps(hi);
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> floor() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto o1 = _mm256_floor_ps(lo);
+    auto o2 = _mm256_floor_ps(hi);
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> neg() const {
+    // bf16 keeps the fp32 sign bit in the same position, so we can negate
+    // without widening.
+    return _mm256_xor_si256(values, _mm256_set1_epi16(static_cast<int16_t>(0x8000)));
+  }
+  Vec256<BFloat16> round() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto o1 = _mm256_round_ps(lo, (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    auto o2 = _mm256_round_ps(hi, (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> tan() const {
+    return map(Sleef_tanf8_u10);
+  }
+  Vec256<BFloat16> tanh() const {
+    return map(Sleef_tanhf8_u10);
+  }
+  Vec256<BFloat16> trunc() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto o1 = _mm256_round_ps(lo, (_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+    auto o2 = _mm256_round_ps(hi, (_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> lgamma() const {
+    return map(Sleef_lgammaf8_u10);
+  }
+  Vec256<BFloat16> sqrt() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto o1 = _mm256_sqrt_ps(lo);
+    auto o2 = _mm256_sqrt_ps(hi);
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> reciprocal() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto ones = _mm256_set1_ps(1);
+    auto o1 = _mm256_div_ps(ones, lo);
+    auto o2 = _mm256_div_ps(ones, hi);
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> rsqrt() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    auto ones = _mm256_set1_ps(1);
+    auto o1 = _mm256_div_ps(ones, _mm256_sqrt_ps(lo));
+    auto o2 = _mm256_div_ps(ones, _mm256_sqrt_ps(hi));
+    return cvtfp32_bf16(o1, o2);
+  }
+  Vec256<BFloat16> pow(const Vec256<BFloat16>& b) const {
+    __m256 lo, hi;
+    __m256 b1, b2;
+    cvtbf16_fp32(values, lo, hi);
+    cvtbf16_fp32(b.values, b1, b2);
+    auto o1 = Sleef_powf8_u10(lo, b1);
+    auto o2 = Sleef_powf8_u10(hi, b2);
+    return cvtfp32_bf16(o1, o2);
+  }
 
+  Vec256<BFloat16> operator==(const Vec256<BFloat16>& other) const {
+    return compare(other, _CMP_EQ_OQ);
+  }
+  Vec256<BFloat16> operator!=(const Vec256<BFloat16>& other) const {
+    return compare(other, _CMP_NEQ_OQ);
+  }
+  Vec256<BFloat16> operator<(const Vec256<BFloat16>& other) const {
+    return compare(other, _CMP_LT_OQ);
+  }
+  Vec256<BFloat16> operator<=(const Vec256<BFloat16>& other) const {
+    return compare(other, _CMP_LE_OQ);
+  }
+  Vec256<BFloat16> operator>(const Vec256<BFloat16>& other) const {
+    return compare(other, _CMP_GT_OQ);
+  }
+  Vec256<BFloat16> operator>=(const Vec256<BFloat16>& other) const {
+    return compare(other, _CMP_GE_OQ);
+  }
+
+private:
+  // Compare in fp32 and narrow the two 32-bit lane masks back into 16-bit
+  // lane masks (all-ones or zero per bf16 element).
+  Vec256<BFloat16> compare(const Vec256<BFloat16>& other, const int predicate) const {
+    __m256 a_lo, a_hi;
+    __m256 b_lo, b_hi;
+    cvtbf16_fp32(values, a_lo, a_hi);
+    cvtbf16_fp32(other.values, b_lo, b_hi);
+    // _mm256_cmp_ps requires a compile-time constant predicate, so switch on
+    // the handful we use.
+    __m256 o1, o2;
+    switch (predicate) {
+      case _CMP_EQ_OQ:
+        o1 = _mm256_cmp_ps(a_lo, b_lo, _CMP_EQ_OQ);
+        o2 = _mm256_cmp_ps(a_hi, b_hi, _CMP_EQ_OQ);
+        break;
+      case _CMP_NEQ_OQ:
+        o1 = _mm256_cmp_ps(a_lo, b_lo, _CMP_NEQ_OQ);
+        o2 = _mm256_cmp_ps(a_hi, b_hi, _CMP_NEQ_OQ);
+        break;
+      case _CMP_LT_OQ:
+        o1 = _mm256_cmp_ps(a_lo, b_lo, _CMP_LT_OQ);
+        o2 = _mm256_cmp_ps(a_hi, b_hi, _CMP_LT_OQ);
+        break;
+      case _CMP_LE_OQ:
+        o1 = _mm256_cmp_ps(a_lo, b_lo, _CMP_LE_OQ);
+        o2 = _mm256_cmp_ps(a_hi, b_hi, _CMP_LE_OQ);
+        break;
+      case _CMP_GT_OQ:
+        o1 = _mm256_cmp_ps(a_lo, b_lo, _CMP_GT_OQ);
+        o2 = _mm256_cmp_ps(a_hi, b_hi, _CMP_GT_OQ);
+        break;
+      default:
+        o1 = _mm256_cmp_ps(a_lo, b_lo, _CMP_GE_OQ);
+        o2 = _mm256_cmp_ps(a_hi, b_hi, _CMP_GE_OQ);
+        break;
+    }
+    __m256i lo = _mm256_srli_epi32(_mm256_castps_si256(o1), 16);
+    __m256i hi = _mm256_srli_epi32(_mm256_castps_si256(o2), 16);
+    auto out = _mm256_packus_epi32(lo, hi);
+    return _mm256_permute4x64_epi64(out, 0xd8);
+  }
 };
 
 #define DEFINE_BF16_OP(op, func)                                                            \
@@ -215,6 +427,11 @@ DEFINE_BF16_OP(&, _mm256_and_ps)
 DEFINE_BF16_OP(|, _mm256_or_ps)
 DEFINE_BF16_OP(^, _mm256_xor_ps)
 
+// frac. Implement this here so we can use subtraction
+inline Vec256<BFloat16> Vec256<BFloat16>::frac() const {
+  return *this - this->trunc();
+}
+
 // Implements the IEEE 754 201X `maximum` operation, which propagates NaN if
 // either input is a NaN.
 template <>
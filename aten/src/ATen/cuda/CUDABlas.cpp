@@ -95,6 +95,17 @@ namespace at {
 namespace cuda {
 namespace blas {
 
+// See Note [Scoped BLAS math mode]
+static thread_local MathMode blas_math_mode = MathMode::Default;
+
+MathMode getMathMode() {
+  return blas_math_mode;
+}
+
+void setMathMode(MathMode mode) {
+  blas_math_mode = mode;
+}
+
 const char* _cublasGetErrorEnum(cublasStatus_t error) {
   if (error == CUBLAS_STATUS_SUCCESS) {
     return "CUBLAS_STATUS_SUCCESS";
@@ -161,6 +172,37 @@ void gemm<float>(CUDABLAS_GEMM_ARGTYPES(float)) {
   cublasOperation_t opb = _cublasOpFromChar(transb);
   _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
   GEMM_CHECK_ARGVALUES(float);
+#ifndef __HIP_PLATFORM_HCC__
+  // See Note [Scoped BLAS math mode]: Fast mode lets fp32 GEMMs run on
+  // tensor cores with implicit down-conversion of the inputs to fp16
+  // (accumulation stays fp32).
+  if (getMathMode() == MathMode::Fast &&
+      at::cuda::getCurrentDeviceProperties()->major >= 7) {
+    TORCH_CUDABLAS_CHECK(cublasSetMathMode(handle, CUBLAS_TENSOR_OP_MATH));
+    TORCH_CUDABLAS_CHECK(cublasGemmEx(
+        handle,
+        opa,
+        opb,
+        m,
+        n,
+        k,
+        &alpha,
+        a,
+        CUDA_R_32F,
+        lda,
+        b,
+        CUDA_R_32F,
+        ldb,
+        &beta,
+        c,
+        CUDA_R_32F,
+        ldc,
+        CUDA_R_32F,
+        CUBLAS_GEMM_DFALT_TENSOR_OP));
+    TORCH_CUDABLAS_CHECK(cublasSetMathMode(handle, CUBLAS_DEFAULT_MATH));
+    return;
+  }
+#endif
   TORCH_CUDABLAS_CHECK(cublasSgemm(
       handle, opa, opb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc));
 }
@@ -202,7 +244,9 @@ void gemm<at::Half>(CUDABLAS_GEMM_ARGTYPES(at::Half)) {
       0));
 #else
   cudaDeviceProp* prop = at::cuda::getCurrentDeviceProperties();
-  if (prop->major >= 5) {
+  // See Note [Scoped BLAS math mode]: Precise mode keeps fp16 GEMMs off the
+  // tensor-op path and on plain fp32-accumulating kernels.
+  if (prop->major >= 5 && getMathMode() != MathMode::Precise) {
     TORCH_CUDABLAS_CHECK(cublasSetMathMode(handle, CUBLAS_TENSOR_OP_MATH));
     TORCH_CUDABLAS_CHECK(cublasGemmEx(
         handle,
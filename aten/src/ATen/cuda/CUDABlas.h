@@ -17,6 +17,40 @@ namespace at {
 namespace cuda {
 namespace blas {
 
+// Note [Scoped BLAS math mode]
+// The global cuBLAS knobs in at::Context are process-wide, but precision
+// requirements vary per call site: attention score matmuls may need full
+// fp32 while MLP blocks tolerate reduced-precision tensor-op paths. The
+// math mode is therefore thread-local and scoped with an RAII guard (in the
+// style of at::AutoNonVariableTypeMode):
+//
+// - Default: current behavior. fp16 GEMMs use tensor ops where available,
+//   fp32 GEMMs use the full-precision SGEMM path.
+// - Fast: additionally lets fp32 GEMMs run on tensor cores with implicit
+//   down-conversion of the inputs to fp16 (fp32 accumulate), trading
+//   precision for throughput.
+// - Precise: keeps even fp16 GEMMs off the tensor-op path, using plain
+//   fp32-accumulating kernels.
+//
+// Only the cuBLAS GEMM entry points below consult the mode; CUDA-less
+// builds and ROCm ignore it.
+enum class MathMode : uint8_t { Precise, Default, Fast };
+
+TORCH_CUDA_API MathMode getMathMode();
+TORCH_CUDA_API void setMathMode(MathMode mode);
+
+struct TORCH_CUDA_API MathModeGuard {
+  explicit MathModeGuard(MathMode mode) : prev_mode_(getMathMode()) {
+    setMathMode(mode);
+  }
+  ~MathModeGuard() {
+    setMathMode(prev_mode_);
+  }
+
+ private:
+  MathMode prev_mode_;
+};
+
 /* LEVEL 3 BLAS FUNCTIONS */
 
 #define CUDABLAS_GEMM_ARGTYPES(Dtype)                                      \
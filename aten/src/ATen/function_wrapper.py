@@ -139,6 +139,7 @@ inline ${return_type} Tensor::${api_name}(${method_formals}) const {
 #ifdef USE_STATIC_DISPATCH
     ${static_dispatch_method_body}
 #else
+${fast_path_dispatch}
     static c10::OperatorHandle op = c10::Dispatcher::singleton().findSchemaOrThrow("aten::${operator_name}", "${overload_name}");
     return op.callUnboxed<${formals_types_with_return}>(${method_actuals});
 #endif
@@ -158,6 +159,7 @@ static inline ${return_type} ${api_name}(${formals}) {
 #ifdef USE_STATIC_DISPATCH
     ${static_dispatch_function_body}
 #else
+${fast_path_dispatch}
     static c10::OperatorHandle op = c10::Dispatcher::singleton()
         .findSchemaOrThrow("aten::${operator_name}", "${overload_name}");
     return op.callUnboxed<${formals_types_with_return}>(${native_actuals});
@@ -165,6 +167,20 @@ static inline ${return_type} ${api_name}(${formals}) {
 }
 """)
 
+# An inlined fast path for hot ops (see fast_path_hot_ops), enabled by
+# building with ATEN_HOT_OP_FAST_PATH. When every dispatch-relevant tensor
+# argument is a plain dense CPU float tensor and no thread-local dispatch
+# keys are in effect, dynamic dispatch provably resolves to the wrapper
+# called here (see ATen/core/DispatchFastPath.h), so we skip dispatch key
+# extraction and call it directly.
+FAST_PATH_DISPATCH = CodeTemplate("""\
+#ifdef ATEN_HOT_OP_FAST_PATH
+    if (at::detail::fast_path_eligible(${fast_path_tensors})) {
+        ${return_call} ${fast_path_target}::${type_wrapper_name}(${fast_path_arguments});
+    }
+#endif
+""")
+
 # In order to rely on the linker to strip unused ops, it requires us to dispatch statically
 # in Functions.h and TensorMethods.h.
 #
@@ -191,6 +207,18 @@ case Backend::${backend}:
     break;
 """)
 
+# When only one backend is in play for an op — the usual case for selective
+# mobile builds, where the backend whitelist prunes static_dispatch_backends
+# down to CPU — the dispatch key extraction and switch are dead weight, and
+# the switch's backend references keep the other backends' wrappers alive in
+# the binary. Emit a direct call instead. Note this drops the runtime
+# AT_ERROR for tensors of a non-generated backend; in a single-backend build
+# no such tensor can be constructed in the first place.
+STATIC_DISPATCH_FUNCTION_SINGLE_BACKEND_BODY = CodeTemplate("""\
+at::AutoNonVariableTypeMode _var_guard(true);
+${return_call} ${backend}Type::${type_wrapper_name}(${native_arguments});
+""")
+
 # add a native declaration for a native function
 NATIVE_DECLARATION = CodeTemplate("""\
 CAFFE2_API ${return_type} ${native_type_method_dispatch}(${formals_with_defaults});
@@ -245,6 +273,23 @@ scalar_types = [
 static_dispatch_backends = ['CPU', 'QuantizedCPU']
 
 
+def filter_static_dispatch_backends(backend_whitelist):
+    # type: (Optional[List[str]]) -> None
+    # Restricts static dispatch to the backends of a selective build (see
+    # gen.py --backend_whitelist), so single-backend builds get direct calls
+    # instead of a dispatch-key switch.
+    global static_dispatch_backends
+    if backend_whitelist is not None:
+        static_dispatch_backends = [
+            b for b in static_dispatch_backends if b in backend_whitelist]
+
+# Ops on this list get an additional inlined fast path in the generated
+# Functions.h / TensorMethods.h wrappers (see FAST_PATH_DISPATCH), guarded by
+# ATEN_HOT_OP_FAST_PATH. Keep the list short: every entry inlines an extra
+# branch into each call site of the op.
+fast_path_hot_ops = {'add', 'mul', 'matmul', 'copy_'}
+
+
 class NYIError(Exception):
     """Indicates we don't support this declaration yet"""
 
@@ -1065,6 +1110,33 @@ def create_generic(top_env, declarations):
                     return formal
             return None
 
+        def gen_fast_path_dispatch(multidispatch_tensors, fast_path_tensors, fast_path_arguments):
+            # type: (List[str], List[str], List[str]) -> str
+            if option['name'] not in fast_path_hot_ops or option['deprecated']:
+                return ''
+            # The eligibility check can only vouch for dispatch decisions that
+            # are entirely driven by plain Tensor arguments; skip overloads
+            # where TensorLists or TensorOptions (factories) participate in
+            # dispatch.
+            dynamic_types = {f['name']: f['dynamic_type'] for f in formals}
+            if not multidispatch_tensors or \
+                    any(dynamic_types.get(t) != 'Tensor' for t in multidispatch_tensors):
+                return ''
+            # Call exactly what dynamic dispatch would pick for CPUTensorId:
+            # the CPU backend wrapper if one is registered, otherwise the
+            # catch-all TypeDefault wrapper.
+            if isinstance(type_method_dispatch, dict):
+                if 'CPU' not in type_method_dispatch:
+                    return ''
+                fast_path_target = 'CPUType'
+            else:
+                fast_path_target = 'TypeDefault'
+            return FAST_PATH_DISPATCH.substitute(
+                option,
+                fast_path_target=fast_path_target,
+                fast_path_tensors=fast_path_tensors,
+                fast_path_arguments=fast_path_arguments)
+
         def gen_tensor_method(option, multidispatch_tensors):
             # type: (Any, List[str]) -> FunctionCode
             def swizzle_self(t):  # blegh
@@ -1090,27 +1162,40 @@ def create_generic(top_env, declarations):
                 # enabled, this switch will fail.  This is intentional: you
                 # probably need to disable variable globally in the mobile
                 # calling code.
-                for backend in static_dispatch_backends:
-                    if backend in type_method_dispatch:
+                enabled_backends = [b for b in static_dispatch_backends
+                                    if b in type_method_dispatch]
+                if len(enabled_backends) == 1:
+                    static_dispatch_method_body = STATIC_DISPATCH_FUNCTION_SINGLE_BACKEND_BODY.substitute(
+                        option,
+                        backend=enabled_backends[0],
+                        native_arguments=option['method_actuals'])
+                else:
+                    for backend in enabled_backends:
                         static_dispatch_function_switches.append(STATIC_DISPATCH_FUNCTION_SWITCH_STATEMENT.substitute(
                             option,
                             backend=backend,
                             backend_function=type_method_dispatch[backend],
                             native_arguments=option['method_actuals']))
-                static_dispatch_method_body = STATIC_DISPATCH_FUNCTION_SWITCH_BODY.substitute(
-                    option,
-                    key_set='key_set()',
-                    static_dispatch_function_switches=static_dispatch_function_switches)
+                    static_dispatch_method_body = STATIC_DISPATCH_FUNCTION_SWITCH_BODY.substitute(
+                        option,
+                        key_set='key_set()',
+                        static_dispatch_function_switches=static_dispatch_function_switches)
             else:
                 static_dispatch_method_body = STATIC_DISPATCH_FUNCTION_DEFAULT_BODY.substitute(
                     option, native_arguments=option['method_actuals'])
 
+            fast_path_dispatch = gen_fast_path_dispatch(
+                multidispatch_tensors,
+                [swizzle_self(t) for t in multidispatch_tensors],
+                option['method_actuals'])
+
             method_definition = C10_TENSOR_METHOD_DEFINITION
             return FunctionCode(
                 declaration=TENSOR_METHOD_DECLARATION.substitute(
                     option, static_dispatch_method_body=static_dispatch_method_body),
                 definition=method_definition.substitute(
-                    option, static_dispatch_method_body=static_dispatch_method_body))
+                    option, static_dispatch_method_body=static_dispatch_method_body,
+                    fast_path_dispatch=fast_path_dispatch))
 
         def gen_namespace_function(option, multidispatch_tensors):
             # type: (Any, List[str]) -> FunctionCode
@@ -1121,17 +1206,24 @@ def create_generic(top_env, declarations):
 
             if isinstance(type_method_dispatch, dict):
                 static_dispatch_function_switches = []
-                for backend in static_dispatch_backends:
-                    if backend in type_method_dispatch:
+                enabled_backends = [b for b in static_dispatch_backends
+                                    if b in type_method_dispatch]
+                if len(enabled_backends) == 1:
+                    static_dispatch_function_body = STATIC_DISPATCH_FUNCTION_SINGLE_BACKEND_BODY.substitute(
+                        option,
+                        backend=enabled_backends[0],
+                        native_arguments=option['native_actuals'])
+                else:
+                    for backend in enabled_backends:
                         static_dispatch_function_switches.append(STATIC_DISPATCH_FUNCTION_SWITCH_STATEMENT.substitute(
                             option,
                             backend=backend,
                             backend_function=type_method_dispatch[backend],
                             native_arguments=option['native_actuals']))
-                static_dispatch_function_body = STATIC_DISPATCH_FUNCTION_SWITCH_BODY.substitute(
-                    option,
-                    key_set=option['inferred_key_set'],
-                    static_dispatch_function_switches=static_dispatch_function_switches)
+                    static_dispatch_function_body = STATIC_DISPATCH_FUNCTION_SWITCH_BODY.substitute(
+                        option,
+                        key_set=option['inferred_key_set'],
+                        static_dispatch_function_switches=static_dispatch_function_switches)
             else:
                 static_dispatch_function_body = STATIC_DISPATCH_FUNCTION_DEFAULT_BODY.substitute(
                     option, native_arguments=option['native_actuals'])
@@ -1141,7 +1233,9 @@ def create_generic(top_env, declarations):
                     option, static_dispatch_function_body=static_dispatch_function_body)
             else:
                 fn_definition = C10_FUNCTION_DEFINITION.substitute(
-                    option, static_dispatch_function_body=static_dispatch_function_body)
+                    option, static_dispatch_function_body=static_dispatch_function_body,
+                    fast_path_dispatch=gen_fast_path_dispatch(
+                        multidispatch_tensors, multidispatch_tensors, option['native_actuals']))
             return FunctionCode(definition=fn_definition, declaration=fn_declaration)
 
         assert find_formal('Type', formals) is None, \
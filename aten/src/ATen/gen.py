@@ -190,6 +190,10 @@ if options.op_registration_whitelist is not None:
 else:
     op_registration_whitelist = None
 
+# restrict static dispatch to whitelisted backends so single-backend
+# selective builds get direct calls instead of a dispatch-key switch
+function_wrapper.filter_static_dispatch_backends(options.backend_whitelist)
+
 # shared environment for non-derived base classes TensorBody.h Storage.h
 top_env = {
     'cpu_type_headers': [],
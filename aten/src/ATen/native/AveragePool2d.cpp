@@ -136,6 +136,20 @@ void avg_pool2d_out_cpu_template(
     inputHeight, inputWidth,
     outputHeight, outputWidth);
 
+  /* NHWC inputs go to the channels-last kernel, which vectorizes over the
+     contiguous channel dimension instead of densifying to NCHW */
+  if (input_.ndimension() == 4 &&
+      input_.is_contiguous(at::MemoryFormat::ChannelsLast) &&
+      (input_.scalar_type() == ScalarType::Float ||
+       input_.scalar_type() == ScalarType::Double)) {
+    output.resize_({nbatch, nInputPlane, outputHeight, outputWidth},
+        at::MemoryFormat::ChannelsLast);
+    avg_pool2d_channels_last_kernel(
+        kCPU, output, input_, kW, kH, dW, dH, padW, padH,
+        count_include_pad, divisor_override, /*fuse_relu=*/false);
+    return;
+  }
+
   if (input_.ndimension() == 3) {
     output.resize_({nInputPlane, outputHeight, outputWidth});
   }
@@ -330,6 +344,8 @@ Tensor& avg_pool2d_backward_out_cpu_template(
 
 } // namespace
 
+DEFINE_DISPATCH(avg_pool2d_channels_last_kernel);
+
 Tensor& avg_pool2d_out_cpu(
   Tensor& output,
   const Tensor& input,
@@ -0,0 +1,49 @@
+#include <ATen/native/CPUBlas.h>
+
+namespace at {
+namespace native {
+namespace cpublas {
+
+DEFINE_DISPATCH(gemm_stub);
+
+void gemm(
+    TransposeType transa,
+    TransposeType transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    float alpha,
+    const float* a,
+    int64_t lda,
+    const float* b,
+    int64_t ldb,
+    float beta,
+    float* c,
+    int64_t ldc) {
+  gemm_stub(
+      kCPU, kFloat,
+      transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void gemm(
+    TransposeType transa,
+    TransposeType transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    double alpha,
+    const double* a,
+    int64_t lda,
+    const double* b,
+    int64_t ldb,
+    double beta,
+    double* c,
+    int64_t ldc) {
+  gemm_stub(
+      kCPU, kDouble,
+      transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+} // namespace cpublas
+} // namespace native
+} // namespace at
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <ATen/native/DispatchStub.h>
+#include <c10/core/ScalarType.h>
+
+namespace at {
+namespace native {
+namespace cpublas {
+
+enum class TransposeType {
+  NoTranspose,
+  Transpose,
+};
+
+using gemm_fn = void (*)(
+    at::ScalarType type,
+    TransposeType transa,
+    TransposeType transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    double alpha,
+    const void* a,
+    int64_t lda,
+    const void* b,
+    int64_t ldb,
+    double beta,
+    void* c,
+    int64_t ldc);
+
+DECLARE_DISPATCH(gemm_fn, gemm_stub);
+
+// Column-major matrix multiply following the BLAS interface:
+//   c = alpha * op(a) @ op(b) + beta * c
+// where op(a) is m x k, op(b) is k x n and c is m x n. This is the tiled,
+// at::parallel_for-parallelized fallback used when no vendor BLAS is
+// available; vendor BLAS builds should keep calling the BLAS directly.
+CAFFE2_API void gemm(
+    TransposeType transa,
+    TransposeType transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    float alpha,
+    const float* a,
+    int64_t lda,
+    const float* b,
+    int64_t ldb,
+    float beta,
+    float* c,
+    int64_t ldc);
+
+CAFFE2_API void gemm(
+    TransposeType transa,
+    TransposeType transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    double alpha,
+    const double* a,
+    int64_t lda,
+    const double* b,
+    int64_t ldb,
+    double beta,
+    double* c,
+    int64_t ldc);
+
+} // namespace cpublas
+} // namespace native
+} // namespace at
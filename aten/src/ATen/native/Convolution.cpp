@@ -2,6 +2,8 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/native/cpu/DepthwiseConvKernel.h>
+#include <ATen/native/cpu/Winograd3x3Kernel.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/native/utils/ParamUtils.h>
 #include <ATen/native/ConvUtils.h>
 
@@ -15,6 +17,7 @@ constexpr int MIOPEN_DIM_MAX = 5;
 namespace at { namespace native {
 
 DEFINE_DISPATCH(convolution_depthwise3x3_winograd_stub);
+DEFINE_DISPATCH(convolution_3x3_winograd_stub);
 
 struct ConvParams {
   std::vector<int64_t> stride;
@@ -36,6 +39,7 @@ struct ConvParams {
   bool is_stride_nonpos() const;
   void view1d_as_2d();
   bool use_cpu_depthwise3x3_winograd(const at::Tensor& input, const at::Tensor& weight) const;
+  bool use_cpu_3x3_winograd(const at::Tensor& input, const at::Tensor& weight) const;
   bool needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn_depthwise(const at::Tensor& input, const at::Tensor& weight) const;
@@ -149,6 +153,35 @@ auto ConvParams::use_cpu_depthwise3x3_winograd(
 #endif
 }
 
+auto ConvParams::use_cpu_3x3_winograd(
+    const at::Tensor& input, const at::Tensor& weight) const -> bool {
+  // Dense (groups == 1) 3x3 stride-1 float convolutions; F(2x2, 3x3) cuts
+  // the multiply count 2.25x over im2col+GEMM. The channel/filter floors
+  // keep the per-call weight transform amortized, and tiny spatial extents
+  // stay on the GEMM path where tile setup would dominate. Inference only:
+  // unlike thnn_conv2d the stub has no derivative.
+  return !at::GradMode::is_enabled() &&
+         (input.ndimension() == 4) &&
+         (weight.ndimension() == 4) &&
+         (weight.size(2) == 3) &&
+         (weight.size(3) == 3) &&
+         (input.device().type() == c10::DeviceType::CPU) &&
+         (input.scalar_type() == at::kFloat) &&
+         (weight.device().type() == c10::DeviceType::CPU) &&
+         (weight.scalar_type() == at::kFloat) &&
+         (groups == 1) &&
+         (input.size(1) >= 8) &&
+         (weight.size(0) >= 8) &&
+         (input.size(2) >= 8) &&
+         (input.size(3) >= 8) &&
+         !is_strided() &&
+         !is_dilated() &&
+         !transposed &&
+         !is_padding_neg() &&
+         (padding[0] == padding[1]) &&
+         (padding[0] <= 1);
+}
+
 auto ConvParams::needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const -> bool {
   constexpr int64_t int_max = std::numeric_limits<int>::max();
   int64_t numel_input = input.numel();
@@ -770,6 +803,13 @@ at::Tensor _convolution_nogroup(
           return at::_nnpack_spatial_convolution(
               input, weight, bias, padding, stride);
 #endif
+        } else if (params.use_cpu_3x3_winograd(input, weight)) {
+          return convolution_3x3_winograd_stub(
+              input.device().type(),
+              input.contiguous(),
+              weight.contiguous(),
+              bias.defined() ? bias.contiguous() : bias,
+              padding);
         } else {
           /* CPU implementation has specialized MM kernels
              for non-dilated case here */
@@ -171,6 +171,24 @@ void max_pool2d_with_indices_out_cpu_template(
     inputHeight, inputWidth,
     outputHeight, outputWidth);
 
+  /* NHWC inputs go to the channels-last kernel, which vectorizes over the
+     contiguous channel dimension. The float argmax lanes are exact up to
+     2^24, so larger planes keep the NCHW path. */
+  if (input_.ndimension() == 4 &&
+      input_.is_contiguous(at::MemoryFormat::ChannelsLast) &&
+      (input_.scalar_type() == ScalarType::Double ||
+       (input_.scalar_type() == ScalarType::Float &&
+        inputHeight * inputWidth <= (int64_t(1) << 24)))) {
+    output.resize_({nbatch, nInputPlane, outputHeight, outputWidth},
+        at::MemoryFormat::ChannelsLast);
+    indices.resize_({nbatch, nInputPlane, outputHeight, outputWidth},
+        at::MemoryFormat::ChannelsLast);
+    max_pool2d_channels_last_kernel(
+        kCPU, output, indices, input_, kW, kH, dW, dH, padW, padH,
+        dilationW, dilationH, /*fuse_relu=*/false);
+    return;
+  }
+
   /* get contiguous input */
   Tensor input = input_.contiguous();
 
@@ -362,6 +380,20 @@ Tensor& max_pool2d_with_indices_backward_out_cpu_template(
     inputHeight, inputWidth,
     outputHeight_for_shape_check, outputWidth_for_shape_check);
 
+  /* indices produced by the channels-last forward are laid out NHWC; route
+     them to the matching backward kernel rather than reading them with NCHW
+     pointer math */
+  if (input.ndimension() == 4 &&
+      indices.is_contiguous(at::MemoryFormat::ChannelsLast) &&
+      (input.scalar_type() == ScalarType::Float ||
+       input.scalar_type() == ScalarType::Double)) {
+    gradInput.resize_(input.sizes(), at::MemoryFormat::ChannelsLast);
+    gradInput.zero_();
+    max_pool2d_backward_channels_last_kernel(
+        kCPU, gradInput, gradOutput_, indices);
+    return gradInput;
+  }
+
   /* backprop */
   if (input.ndimension() == 3)
   {
@@ -410,6 +442,9 @@ Tensor& max_pool2d_with_indices_backward_out_cpu_template(
 
 } // namespace
 
+DEFINE_DISPATCH(max_pool2d_channels_last_kernel);
+DEFINE_DISPATCH(max_pool2d_backward_channels_last_kernel);
+
 std::tuple<Tensor&, Tensor&> max_pool2d_with_indices_out_cpu(
   Tensor& output,
   Tensor& indices,
@@ -514,10 +514,26 @@ static Tensor _embedding_bag_dense_backward_cpu_max(
   auto nonempty_max_indices = max_indices.index_select(0, bag_size.nonzero().view(-1));
   auto nonempty_grad = grad.index_select(0, bag_size.nonzero().view(-1));
 
-  for (int64_t dim = 0; dim < grad.size(1); dim++) {
-    index_grad_weight.select(1, dim).index_add_(
-      0, nonempty_max_indices.select(1, dim), nonempty_grad.select(1, dim));
-  }
+  // Each feature dim scatters into its own column of index_grad_weight, so
+  // the dims partition the output and can be accumulated in parallel without
+  // synchronization. Doing this in one kernel also avoids dispatching a
+  // separate index_add_ per feature dim.
+  int64_t ddim = grad.size(1);
+  int64_t nonempty_bags = nonempty_grad.size(0);
+  AT_DISPATCH_FLOATING_TYPES(
+      grad.scalar_type(), "embedding_bag_backward_max", [&] {
+        auto* igw_data = index_grad_weight.data_ptr<scalar_t>();
+        auto* grad_data = nonempty_grad.data_ptr<scalar_t>();
+        auto* max_indices_data = nonempty_max_indices.data_ptr<int64_t>();
+        at::parallel_for(0, ddim, 1, [&](int64_t dim_begin, int64_t dim_end) {
+          for (int64_t bag = 0; bag < nonempty_bags; bag++) {
+            for (int64_t dim = dim_begin; dim < dim_end; dim++) {
+              int64_t index = max_indices_data[bag * ddim + dim];
+              igw_data[index * ddim + dim] += grad_data[bag * ddim + dim];
+            }
+          }
+        });
+      });
   return index_grad_weight;
 }
 
@@ -596,6 +612,10 @@ void _embedding_bag_dense_backward_cpu_sum_mean(
   auto next_unique_index_idx =
       compute_counts_uniq(num_weights, indices_data, numel, counts);
 
+  int64_t ddim = grad.size(1);
+  auto igwd = index_grad_weight.data_ptr<scalar_t>();
+  auto gd = grad.data_ptr<scalar_t>();
+
   auto loop = [&](int64_t start, int64_t end) {
     for (int64_t i = start; i < end; i++) {
       int64_t start = i == 0 ? 0 : next_unique_index_idx[i - 1];
@@ -622,9 +642,6 @@ void _embedding_bag_dense_backward_cpu_sum_mean(
             }
           }
         }
-        int64_t ddim = grad.size(1);
-        auto igwd = index_grad_weight.data_ptr<scalar_t>();
-        auto gd = grad.data_ptr<scalar_t>();
         THBlas_axpy<scalar_t>(ddim, (scalar_t)scale, gd + ddim * source, 1,
                     igwd + ddim * index, 1);
       }
@@ -0,0 +1,417 @@
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/ForeachUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace at {
+namespace native {
+
+namespace {
+
+// Runs fn(tensor_index, begin, end) over the flattened element range of a
+// tensor list: one parallel sweep covers every parameter, so lists of many
+// small tensors do not pay one parallel region per tensor.
+template <typename F>
+void foreach_flat_parallel(TensorList tensors, const F& fn) {
+  std::vector<int64_t> offsets(tensors.size() + 1, 0);
+  for (size_t i = 0; i < tensors.size(); i++) {
+    offsets[i + 1] = offsets[i] + tensors[i].numel();
+  }
+  at::parallel_for(
+      0, offsets.back(), internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+        size_t t =
+            std::upper_bound(offsets.begin(), offsets.end(), begin) -
+            offsets.begin() - 1;
+        while (begin < end) {
+          int64_t stop = std::min(end, offsets[t + 1]);
+          fn(t, begin - offsets[t], stop - offsets[t]);
+          begin = stop;
+          t++;
+        }
+      });
+}
+
+template <typename scalar_t>
+std::vector<scalar_t*> collect_data_ptrs(TensorList tensors) {
+  std::vector<scalar_t*> ptrs(tensors.size());
+  for (size_t i = 0; i < tensors.size(); i++) {
+    ptrs[i] = tensors[i].data_ptr<scalar_t>();
+  }
+  return ptrs;
+}
+
+bool foreach_step_lists_match(
+    TensorList params,
+    TensorList grads,
+    std::initializer_list<TensorList> state_lists) {
+  // The flattened path addresses raw float/double storage; anything else
+  // (e.g. Half) takes the per-tensor fallback.
+  bool fast = (params[0].scalar_type() == kFloat ||
+               params[0].scalar_type() == kDouble) &&
+      can_use_fast_route(params) && can_use_fast_route(grads);
+  for (size_t i = 0; fast && i < params.size(); i++) {
+    fast = params[i].numel() == grads[i].numel();
+  }
+  for (const auto& state : state_lists) {
+    if (state.empty()) {
+      continue;
+    }
+    fast = fast && can_use_fast_route(state);
+    for (size_t i = 0; fast && i < params.size(); i++) {
+      fast = params[i].numel() == state[i].numel();
+    }
+  }
+  return fast;
+}
+
+} // namespace
+
+void foreach_add_scalar_cpu_(TensorList tensors, Scalar scalar) {
+  check_foreach_api_restrictions(tensors);
+  for (const auto& t : tensors) {
+    t.add_(scalar);
+  }
+}
+
+void foreach_mul_scalar_cpu_(TensorList tensors, Scalar scalar) {
+  check_foreach_api_restrictions(tensors);
+  for (const auto& t : tensors) {
+    t.mul_(scalar);
+  }
+}
+
+void foreach_addcdiv_scalar_cpu_(
+    TensorList tensors,
+    TensorList tensor1,
+    TensorList tensor2,
+    Scalar value) {
+  check_foreach_api_restrictions(tensors, tensor1, tensor2);
+  for (size_t i = 0; i < tensors.size(); i++) {
+    tensors[i].addcdiv_(tensor1[i], tensor2[i], value);
+  }
+}
+
+// Fused multi-tensor optimizer steps (used by the C++ optim API). The fast
+// path updates parameters, gradients and optimizer state in one flattened
+// parallel sweep; lists with non-contiguous or size-mismatched entries fall
+// back to the equivalent per-tensor ops. The math matches the per-tensor
+// optimizer implementations operation for operation.
+
+void foreach_sgd_step_cpu_(
+    TensorList params,
+    TensorList grads,
+    TensorList momentum_buffers,
+    double lr,
+    double momentum,
+    double dampening,
+    double weight_decay,
+    bool nesterov) {
+  check_foreach_api_restrictions(params);
+  TORCH_CHECK(
+      grads.size() == params.size(),
+      "params and grads must have the same length");
+  const bool has_momentum = !momentum_buffers.empty();
+  TORCH_CHECK(
+      !has_momentum || momentum_buffers.size() == params.size(),
+      "params and momentum_buffers must have the same length");
+
+  if (!foreach_step_lists_match(params, grads, {momentum_buffers})) {
+    for (size_t i = 0; i < params.size(); i++) {
+      auto d_p = grads[i];
+      if (weight_decay != 0) {
+        d_p = d_p.add(params[i], weight_decay);
+      }
+      if (has_momentum) {
+        auto& buf = momentum_buffers[i];
+        buf.mul_(momentum).add_(d_p, 1 - dampening);
+        d_p = nesterov ? d_p.add(buf, momentum) : buf;
+      }
+      params[i].add_(d_p, -lr);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(
+      params[0].scalar_type(), "foreach_sgd_step_cpu", [&] {
+        auto p_ptrs = collect_data_ptrs<scalar_t>(params);
+        auto g_ptrs = collect_data_ptrs<scalar_t>(grads);
+        auto buf_ptrs = has_momentum
+            ? collect_data_ptrs<scalar_t>(momentum_buffers)
+            : std::vector<scalar_t*>();
+        const scalar_t lr_ = lr;
+        const scalar_t momentum_ = momentum;
+        const scalar_t dampening_ = dampening;
+        const scalar_t weight_decay_ = weight_decay;
+        foreach_flat_parallel(
+            params, [&](size_t t, int64_t begin, int64_t end) {
+              scalar_t* p = p_ptrs[t];
+              const scalar_t* g = g_ptrs[t];
+              scalar_t* buf = has_momentum ? buf_ptrs[t] : nullptr;
+              for (int64_t i = begin; i < end; i++) {
+                scalar_t d = g[i] + weight_decay_ * p[i];
+                if (has_momentum) {
+                  scalar_t b = momentum_ * buf[i] + (1 - dampening_) * d;
+                  buf[i] = b;
+                  d = nesterov ? d + momentum_ * b : b;
+                }
+                p[i] -= lr_ * d;
+              }
+            });
+      });
+}
+
+void foreach_adam_step_cpu_(
+    TensorList params,
+    TensorList grads,
+    TensorList exp_avgs,
+    TensorList exp_avg_sqs,
+    TensorList max_exp_avg_sqs,
+    double lr,
+    double beta1,
+    double beta2,
+    double weight_decay,
+    double eps,
+    bool amsgrad,
+    int64_t step) {
+  check_foreach_api_restrictions(params);
+  TORCH_CHECK(
+      grads.size() == params.size() && exp_avgs.size() == params.size() &&
+          exp_avg_sqs.size() == params.size(),
+      "params, grads, exp_avgs and exp_avg_sqs must have the same length");
+  TORCH_CHECK(
+      !amsgrad || max_exp_avg_sqs.size() == params.size(),
+      "params and max_exp_avg_sqs must have the same length with amsgrad");
+  TORCH_CHECK(step > 0, "step must be > 0");
+
+  const double bias_correction1 = 1 - std::pow(beta1, step);
+  const double bias_correction2 = 1 - std::pow(beta2, step);
+  const double step_size = lr / bias_correction1;
+  const double sqrt_bias_correction2 = std::sqrt(bias_correction2);
+
+  if (!foreach_step_lists_match(
+          params, grads, {exp_avgs, exp_avg_sqs, max_exp_avg_sqs})) {
+    for (size_t i = 0; i < params.size(); i++) {
+      auto grad = grads[i];
+      if (weight_decay != 0) {
+        grad = grad.add(params[i], weight_decay);
+      }
+      exp_avgs[i].mul_(beta1).add_(grad, 1 - beta1);
+      exp_avg_sqs[i].mul_(beta2).addcmul_(grad, grad, 1 - beta2);
+      Tensor denom;
+      if (amsgrad) {
+        at::max_out(max_exp_avg_sqs[i], exp_avg_sqs[i], max_exp_avg_sqs[i]);
+        denom =
+            (max_exp_avg_sqs[i].sqrt() / sqrt_bias_correction2).add_(eps);
+      } else {
+        denom = (exp_avg_sqs[i].sqrt() / sqrt_bias_correction2).add_(eps);
+      }
+      params[i].addcdiv_(exp_avgs[i], denom, -step_size);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(
+      params[0].scalar_type(), "foreach_adam_step_cpu", [&] {
+        auto p_ptrs = collect_data_ptrs<scalar_t>(params);
+        auto g_ptrs = collect_data_ptrs<scalar_t>(grads);
+        auto m_ptrs = collect_data_ptrs<scalar_t>(exp_avgs);
+        auto v_ptrs = collect_data_ptrs<scalar_t>(exp_avg_sqs);
+        auto vm_ptrs = amsgrad
+            ? collect_data_ptrs<scalar_t>(max_exp_avg_sqs)
+            : std::vector<scalar_t*>();
+        const scalar_t beta1_ = beta1;
+        const scalar_t beta2_ = beta2;
+        const scalar_t weight_decay_ = weight_decay;
+        const scalar_t eps_ = eps;
+        const scalar_t step_size_ = step_size;
+        const scalar_t sqrt_bc2 = sqrt_bias_correction2;
+        foreach_flat_parallel(
+            params, [&](size_t t, int64_t begin, int64_t end) {
+              scalar_t* p = p_ptrs[t];
+              const scalar_t* g = g_ptrs[t];
+              scalar_t* m = m_ptrs[t];
+              scalar_t* v = v_ptrs[t];
+              scalar_t* vm = amsgrad ? vm_ptrs[t] : nullptr;
+              for (int64_t i = begin; i < end; i++) {
+                scalar_t gi = g[i] + weight_decay_ * p[i];
+                scalar_t mi = m[i] = beta1_ * m[i] + (1 - beta1_) * gi;
+                scalar_t vi = v[i] = beta2_ * v[i] + (1 - beta2_) * gi * gi;
+                if (amsgrad) {
+                  vi = vm[i] = std::max(vm[i], vi);
+                }
+                p[i] -= step_size_ * mi /
+                    (std::sqrt(vi) / sqrt_bc2 + eps_);
+              }
+            });
+      });
+}
+
+void foreach_rmsprop_step_cpu_(
+    TensorList params,
+    TensorList grads,
+    TensorList square_avgs,
+    TensorList grad_avgs,
+    TensorList momentum_buffers,
+    double lr,
+    double alpha,
+    double eps,
+    double weight_decay,
+    double momentum,
+    bool centered) {
+  check_foreach_api_restrictions(params);
+  TORCH_CHECK(
+      grads.size() == params.size() && square_avgs.size() == params.size(),
+      "params, grads and square_avgs must have the same length");
+  TORCH_CHECK(
+      !centered || grad_avgs.size() == params.size(),
+      "params and grad_avgs must have the same length when centered");
+  const bool has_momentum = momentum > 0;
+  TORCH_CHECK(
+      !has_momentum || momentum_buffers.size() == params.size(),
+      "params and momentum_buffers must have the same length with momentum");
+
+  if (!foreach_step_lists_match(
+          params, grads, {square_avgs, grad_avgs, momentum_buffers})) {
+    for (size_t i = 0; i < params.size(); i++) {
+      auto grad = grads[i];
+      if (weight_decay != 0) {
+        grad = grad.add(params[i], weight_decay);
+      }
+      square_avgs[i].mul_(alpha).addcmul_(grad, grad, 1 - alpha);
+      Tensor avg;
+      if (centered) {
+        auto& grad_avg = grad_avgs[i];
+        grad_avg.mul_(alpha).add_(grad, 1 - alpha);
+        avg = square_avgs[i]
+                  .addcmul(grad_avg, grad_avg, -1)
+                  .sqrt_()
+                  .add_(eps);
+      } else {
+        avg = square_avgs[i].sqrt().add_(eps);
+      }
+      if (has_momentum) {
+        auto& buf = momentum_buffers[i];
+        buf.mul_(momentum).addcdiv_(grad, avg);
+        params[i].add_(buf, -lr);
+      } else {
+        params[i].addcdiv_(grad, avg, -lr);
+      }
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(
+      params[0].scalar_type(), "foreach_rmsprop_step_cpu", [&] {
+        auto p_ptrs = collect_data_ptrs<scalar_t>(params);
+        auto g_ptrs = collect_data_ptrs<scalar_t>(grads);
+        auto sa_ptrs = collect_data_ptrs<scalar_t>(square_avgs);
+        auto ga_ptrs = centered
+            ? collect_data_ptrs<scalar_t>(grad_avgs)
+            : std::vector<scalar_t*>();
+        auto buf_ptrs = has_momentum
+            ? collect_data_ptrs<scalar_t>(momentum_buffers)
+            : std::vector<scalar_t*>();
+        const scalar_t lr_ = lr;
+        const scalar_t alpha_ = alpha;
+        const scalar_t eps_ = eps;
+        const scalar_t weight_decay_ = weight_decay;
+        const scalar_t momentum_ = momentum;
+        foreach_flat_parallel(
+            params, [&](size_t t, int64_t begin, int64_t end) {
+              scalar_t* p = p_ptrs[t];
+              const scalar_t* g = g_ptrs[t];
+              scalar_t* sa = sa_ptrs[t];
+              scalar_t* ga = centered ? ga_ptrs[t] : nullptr;
+              scalar_t* buf = has_momentum ? buf_ptrs[t] : nullptr;
+              for (int64_t i = begin; i < end; i++) {
+                scalar_t gi = g[i] + weight_decay_ * p[i];
+                scalar_t sai = sa[i] =
+                    alpha_ * sa[i] + (1 - alpha_) * gi * gi;
+                scalar_t avg;
+                if (centered) {
+                  scalar_t gai = ga[i] =
+                      alpha_ * ga[i] + (1 - alpha_) * gi;
+                  avg = std::sqrt(sai - gai * gai) + eps_;
+                } else {
+                  avg = std::sqrt(sai) + eps_;
+                }
+                if (has_momentum) {
+                  scalar_t b = buf[i] = momentum_ * buf[i] + gi / avg;
+                  p[i] -= lr_ * b;
+                } else {
+                  p[i] -= lr_ * gi / avg;
+                }
+              }
+            });
+      });
+}
+
+// Global norm across a tensor list (used by gradient clipping): a single
+// reduction over the flattened element range instead of one norm kernel per
+// tensor. Accumulation is in double; the result is a 0-dim tensor of the
+// list's dtype, equal to `at::stack(norms).norm(ord)`.
+Tensor foreach_global_norm_cpu(TensorList tensors, double ord) {
+  check_foreach_api_restrictions(tensors);
+  if (!foreach_step_lists_match(tensors, tensors, {})) {
+    std::vector<Tensor> norms;
+    norms.reserve(tensors.size());
+    for (const auto& t : tensors) {
+      norms.push_back(t.norm(ord));
+    }
+    return at::norm(at::stack(norms), ord);
+  }
+
+  const bool is_inf = std::isinf(ord);
+  std::vector<int64_t> offsets(tensors.size() + 1, 0);
+  for (size_t i = 0; i < tensors.size(); i++) {
+    offsets[i + 1] = offsets[i] + tensors[i].numel();
+  }
+
+  double total = 0;
+  AT_DISPATCH_FLOATING_TYPES(
+      tensors[0].scalar_type(), "foreach_global_norm_cpu", [&] {
+        auto ptrs = collect_data_ptrs<scalar_t>(tensors);
+        total = at::parallel_reduce(
+            0, offsets.back(), internal::GRAIN_SIZE, 0.0,
+            [&](int64_t begin, int64_t end, double ident) -> double {
+              double acc = ident;
+              size_t t =
+                  std::upper_bound(offsets.begin(), offsets.end(), begin) -
+                  offsets.begin() - 1;
+              while (begin < end) {
+                int64_t stop = std::min(end, offsets[t + 1]);
+                const scalar_t* data = ptrs[t];
+                for (int64_t i = begin - offsets[t]; i < stop - offsets[t];
+                     i++) {
+                  double x = std::abs(static_cast<double>(data[i]));
+                  if (is_inf) {
+                    acc = std::max(acc, x);
+                  } else if (ord == 2) {
+                    acc += x * x;
+                  } else if (ord == 1) {
+                    acc += x;
+                  } else {
+                    acc += std::pow(x, ord);
+                  }
+                }
+                begin = stop;
+                t++;
+              }
+              return acc;
+            },
+            [&](double a, double b) -> double {
+              return is_inf ? std::max(a, b) : a + b;
+            });
+      });
+  if (!is_inf && ord != 1) {
+    total = std::pow(total, 1.0 / ord);
+  }
+  return at::scalar_tensor(total, tensors[0].options());
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <ATen/ATen.h>
+
+namespace at {
+namespace native {
+
+inline void check_foreach_api_restrictions(TensorList tensors) {
+  TORCH_CHECK(tensors.size() > 0, "tensor list must not be empty");
+  auto expected_device = tensors[0].device();
+  auto expected_dtype = tensors[0].scalar_type();
+  for (const auto& t : tensors) {
+    TORCH_CHECK(
+        t.device() == expected_device,
+        "all tensors in the tensor list must be on the same device");
+    TORCH_CHECK(
+        t.scalar_type() == expected_dtype,
+        "all tensors in the tensor list must have the same dtype");
+  }
+}
+
+inline void check_foreach_api_restrictions(
+    TensorList tensors1,
+    TensorList tensors2,
+    TensorList tensors3) {
+  TORCH_CHECK(
+      tensors1.size() == tensors2.size() &&
+          tensors1.size() == tensors3.size(),
+      "all tensor lists must have the same length");
+  check_foreach_api_restrictions(tensors1);
+  check_foreach_api_restrictions(tensors2);
+  check_foreach_api_restrictions(tensors3);
+  TORCH_CHECK(
+      tensors1[0].scalar_type() == tensors2[0].scalar_type() &&
+          tensors1[0].scalar_type() == tensors3[0].scalar_type(),
+      "all tensor lists must have the same dtype");
+}
+
+// The batched CUDA launcher indexes flat contiguous buffers; anything else
+// takes the per-tensor fallback.
+inline bool can_use_fast_route(TensorList tensors) {
+  for (const auto& t : tensors) {
+    if (!t.is_contiguous() || t.layout() != at::kStrided) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace native
+} // namespace at
@@ -380,6 +380,134 @@ namespace {
     return std::make_tuple(grad_input, grad_grid);
   }
 
+  // Builds a sampling plan from a grid: for every output pixel, the (up to
+  // four) within-plane input offsets it reads and the interpolation weight of
+  // each. Out-of-bounds taps get offset 0 and weight 0, so the apply kernel
+  // can gather unconditionally. The plan depends only on the grid and the
+  // input spatial size, so it can be reused across inputs (e.g. every frame
+  // of a video warped by the same spatial transformer).
+  template<typename scalar_t>
+  std::tuple<Tensor, Tensor>
+  grid_sampler_2d_compile_impl(const Tensor& grid,
+                               int64_t inp_H, int64_t inp_W,
+                               GridSamplerInterpolation interpolation_mode,
+                               GridSamplerPadding padding_mode,
+                               bool align_corners) {
+    int64_t N = grid.size(0);
+    int64_t out_H = grid.size(1);
+    int64_t out_W = grid.size(2);
+    auto offsets = at::empty({N, out_H, out_W, 4}, grid.options().dtype(kLong));
+    auto weights = at::empty({N, out_H, out_W, 4}, grid.options());
+    int64_t grid_sN = grid.stride(0);
+    int64_t grid_sH = grid.stride(1);
+    int64_t grid_sW = grid.stride(2);
+    int64_t grid_sCoor = grid.stride(3);
+    scalar_t *grid_ptr = grid.data_ptr<scalar_t>();
+    int64_t *off_ptr = offsets.data_ptr<int64_t>();
+    scalar_t *w_ptr = weights.data_ptr<scalar_t>();
+    at::parallel_for(0, N, 0, [&](int64_t start, int64_t end) {
+      for (int64_t n = start; n < end; ++n) {
+        scalar_t *grid_ptr_N = grid_ptr + n * grid_sN;
+        int64_t *off_ptr_N = off_ptr + n * out_H * out_W * 4;
+        scalar_t *w_ptr_N = w_ptr + n * out_H * out_W * 4;
+        for (int64_t h = 0; h < out_H; ++h) {
+          for (int64_t w = 0; w < out_W; ++w) {
+            scalar_t *grid_ptr_NHW = grid_ptr_N + h * grid_sH + w * grid_sW;
+            scalar_t ix = *grid_ptr_NHW;
+            scalar_t iy = grid_ptr_NHW[grid_sCoor];
+            ix = grid_sampler_compute_source_index(ix, inp_W, padding_mode, align_corners);
+            iy = grid_sampler_compute_source_index(iy, inp_H, padding_mode, align_corners);
+            int64_t *off = off_ptr_N + (h * out_W + w) * 4;
+            scalar_t *wgt = w_ptr_N + (h * out_W + w) * 4;
+            if (interpolation_mode == GridSamplerInterpolation::Bilinear) {
+              // get NE, NW, SE, SW pixel values from (x, y)
+              int64_t ix_nw = static_cast<int64_t>(std::floor(ix));
+              int64_t iy_nw = static_cast<int64_t>(std::floor(iy));
+              int64_t ix_tap[4] = {ix_nw, ix_nw + 1, ix_nw,     ix_nw + 1};
+              int64_t iy_tap[4] = {iy_nw, iy_nw,     iy_nw + 1, iy_nw + 1};
+              scalar_t wx_e = ix - static_cast<scalar_t>(ix_nw);
+              scalar_t wy_s = iy - static_cast<scalar_t>(iy_nw);
+              scalar_t w_tap[4] = {
+                (1 - wx_e) * (1 - wy_s),  // nw
+                wx_e * (1 - wy_s),        // ne
+                (1 - wx_e) * wy_s,        // sw
+                wx_e * wy_s,              // se
+              };
+              for (int64_t t = 0; t < 4; ++t) {
+                if (within_bounds_2d(iy_tap[t], ix_tap[t], inp_H, inp_W)) {
+                  off[t] = iy_tap[t] * inp_W + ix_tap[t];
+                  wgt[t] = w_tap[t];
+                } else {
+                  off[t] = 0;
+                  wgt[t] = static_cast<scalar_t>(0);
+                }
+              }
+            } else if (interpolation_mode == GridSamplerInterpolation::Nearest) {
+              int64_t ix_nearest = static_cast<int64_t>(std::nearbyint(ix));
+              int64_t iy_nearest = static_cast<int64_t>(std::nearbyint(iy));
+              if (within_bounds_2d(iy_nearest, ix_nearest, inp_H, inp_W)) {
+                off[0] = iy_nearest * inp_W + ix_nearest;
+                wgt[0] = static_cast<scalar_t>(1);
+              } else {
+                off[0] = 0;
+                wgt[0] = static_cast<scalar_t>(0);
+              }
+              for (int64_t t = 1; t < 4; ++t) {
+                off[t] = 0;
+                wgt[t] = static_cast<scalar_t>(0);
+              }
+            }
+          }
+        }
+      }
+    });
+    return std::make_tuple(offsets, weights);
+  }
+
+  // Applies a plan produced by grid_sampler_2d_compile_impl to an input
+  // batch: each output pixel is a pure four-tap gather-weighted-sum, with
+  // all of the coordinate math already amortized into the plan.
+  template<typename scalar_t>
+  Tensor grid_sampler_2d_apply_impl(const Tensor& input,
+                                    const Tensor& offsets,
+                                    const Tensor& weights) {
+    int64_t N = input.size(0);
+    int64_t C = input.size(1);
+    int64_t inp_H = input.size(2);
+    int64_t inp_W = input.size(3);
+    int64_t out_H = offsets.size(1);
+    int64_t out_W = offsets.size(2);
+    auto inp = input.contiguous();
+    auto off = offsets.contiguous();
+    auto wgt = weights.contiguous();
+    auto output = at::empty({N, C, out_H, out_W}, input.options());
+    int64_t inp_plane = inp_H * inp_W;
+    int64_t out_plane = out_H * out_W;
+    scalar_t *inp_ptr = inp.data_ptr<scalar_t>();
+    int64_t *off_ptr = off.data_ptr<int64_t>();
+    scalar_t *w_ptr = wgt.data_ptr<scalar_t>();
+    scalar_t *out_ptr = output.data_ptr<scalar_t>();
+    // every (n, c) plane reads the plan of batch entry n
+    at::parallel_for(0, N * C, 0, [&](int64_t start, int64_t end) {
+      for (int64_t p = start; p < end; ++p) {
+        int64_t n = p / C;
+        scalar_t *inp_ptr_NC = inp_ptr + p * inp_plane;
+        int64_t *off_ptr_N = off_ptr + n * out_plane * 4;
+        scalar_t *w_ptr_N = w_ptr + n * out_plane * 4;
+        scalar_t *out_ptr_NC = out_ptr + p * out_plane;
+        for (int64_t i = 0; i < out_plane; ++i) {
+          int64_t *o = off_ptr_N + i * 4;
+          scalar_t *w = w_ptr_N + i * 4;
+          out_ptr_NC[i] = w[0] * inp_ptr_NC[o[0]]
+                        + w[1] * inp_ptr_NC[o[1]]
+                        + w[2] * inp_ptr_NC[o[2]]
+                        + w[3] * inp_ptr_NC[o[3]];
+        }
+      }
+    });
+    return output;
+  }
+
 }  // namespace
 
 // No shape checking needed here. See # NOTE [ grid_sampler Native Functions ].
@@ -426,6 +554,57 @@ grid_sampler_3d_backward_cpu(const Tensor& grad_output, const Tensor& input, con
   });
 }
 
+std::tuple<Tensor, Tensor>
+grid_sampler_2d_compile_cpu(const Tensor& grid, int64_t input_h, int64_t input_w,
+                            int64_t interpolation_mode, int64_t padding_mode,
+                            bool align_corners) {
+  TORCH_CHECK(
+    grid.dim() == 4 && grid.size(-1) == 2,
+    "grid_sampler_2d_compile(): expected 4D grid with size 2 in last "
+    "dimension, but got grid with sizes ", grid.sizes());
+  TORCH_CHECK(
+    input_h > 0 && input_w > 0,
+    "grid_sampler_2d_compile(): expected positive input spatial size, but got "
+    "input_h = ", input_h, ", input_w = ", input_w);
+  return AT_DISPATCH_FLOATING_TYPES(grid.scalar_type(), "grid_sampler_2d_compile_cpu", [&] {
+    return grid_sampler_2d_compile_impl<scalar_t>(
+      grid, input_h, input_w,
+      static_cast<GridSamplerInterpolation>(interpolation_mode),
+      static_cast<GridSamplerPadding>(padding_mode), align_corners);
+  });
+}
+
+Tensor grid_sampler_2d_apply_cpu(const Tensor& input, const Tensor& offsets,
+                                 const Tensor& weights) {
+  TORCH_CHECK(
+    input.dim() == 4,
+    "grid_sampler_2d_apply(): expected 4D input, but got input with sizes ",
+    input.sizes());
+  TORCH_CHECK(
+    offsets.dim() == 4 && offsets.size(-1) == 4 &&
+    offsets.sizes() == weights.sizes(),
+    "grid_sampler_2d_apply(): expected matching 4D offsets and weights with "
+    "size 4 in last dimension, but got offsets with sizes ", offsets.sizes(),
+    " and weights with sizes ", weights.sizes());
+  TORCH_CHECK(
+    input.size(0) == offsets.size(0),
+    "grid_sampler_2d_apply(): expected input and offsets to have same batch "
+    "size, but got input with sizes ", input.sizes(), " and offsets with "
+    "sizes ", offsets.sizes());
+  TORCH_CHECK(
+    offsets.scalar_type() == kLong,
+    "grid_sampler_2d_apply(): expected offsets to have torch.int64 dtype, "
+    "but got ", offsets.scalar_type());
+  TORCH_CHECK(
+    input.scalar_type() == weights.scalar_type(),
+    "grid_sampler_2d_apply(): expected input and weights to have same dtype, "
+    "but got input with ", input.scalar_type(), " and weights with ",
+    weights.scalar_type());
+  return AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "grid_sampler_2d_apply_cpu", [&] {
+    return grid_sampler_2d_apply_impl<scalar_t>(input, offsets, weights);
+  });
+}
+
 Tensor grid_sampler(const Tensor& input, const Tensor& grid,
                     int64_t interpolation_mode, int64_t padding_mode,
                     bool align_corners) {
@@ -16,6 +16,19 @@ Tensor linear(const Tensor& input, const Tensor& weight, const Tensor& bias) {
     return at::mkldnn_linear(input, weight, bias);
   }
 
+  // Batch-size-1 inference: a single-row matmul is a gemv against the
+  // row-major weight, where every output element reduces over one
+  // contiguous weight row. Routing it as such skips gemm's panel packing
+  // and tiling setup, which dominates at m == 1.
+  const bool single_row =
+      (input.dim() == 1) || (input.dim() == 2 && input.size(0) == 1);
+  if (single_row && weight.dim() == 2 && bias.defined() &&
+      bias.dim() == 1 && bias.size(0) == weight.size(0)) {
+    auto output =
+        at::addmv(bias, weight, input.dim() == 1 ? input : input.squeeze(0));
+    return input.dim() == 1 ? output : output.unsqueeze(0);
+  }
+
   if (input.dim() == 2 && bias.defined()) {
     // Fused op is marginally faster.
     return at::addmm(bias, input, weight.t());
@@ -444,9 +444,8 @@ Tensor matmul(
     std::vector<int64_t> tensor2_bmm_view({expand_batch_product});
     tensor2_bmm_view.insert(tensor2_bmm_view.end(), {m2, p});
 
-    // flatten expanded batches
-    Tensor tensor1_expanded = tensor1.expand(tensor1_expand_size).contiguous().view(tensor1_bmm_view);
-    Tensor tensor2_expanded = tensor2.expand(tensor2_expand_size).contiguous().view(tensor2_bmm_view);
+    Tensor tensor1_expanded = tensor1.expand(tensor1_expand_size);
+    Tensor tensor2_expanded = tensor2.expand(tensor2_expand_size);
 
     // reshape batches back into result
     std::vector<int64_t> output_shape(expand_batch_portion);
@@ -457,6 +456,51 @@ Tensor matmul(
       output_shape.push_back(p);
     }
 
+    // Folding the batch dims for bmm is only a view when the batch strides
+    // are uniform. The common attention layout (B, H, S, D) produced by a
+    // transpose is not, so the fold used to copy both operands every call.
+    // For inference on large enough matrices, run mm directly on the
+    // original strided slices instead: each (batch) matrix is perfectly
+    // BLAS-addressable without ever materializing a contiguous copy.
+    const bool t1_folds = at::detail::computeStride(
+        tensor1_expanded.sizes(), tensor1_expanded.strides(), tensor1_bmm_view)
+        .has_value();
+    const bool t2_folds = at::detail::computeStride(
+        tensor2_expanded.sizes(), tensor2_expanded.strides(), tensor2_bmm_view)
+        .has_value();
+    const bool grad_needed = at::GradMode::is_enabled() &&
+        (tensor1.requires_grad() || tensor2.requires_grad());
+    const bool big_enough = 2 * n * m1 * p >= at::internal::GRAIN_SIZE;
+    if (!has_out && !(t1_folds && t2_folds) && !grad_needed && big_enough &&
+        expand_batch_product > 1) {
+      Tensor output =
+          at::empty({expand_batch_product, n, p}, tensor1.options());
+      const int64_t num_batch_dims = expand_batch_portion.size();
+      std::vector<int64_t> index(num_batch_dims, 0);
+      for (int64_t i = 0; i < expand_batch_product; i++) {
+        Tensor slice1 = tensor1_expanded;
+        Tensor slice2 = tensor2_expanded;
+        for (int64_t d = 0; d < num_batch_dims; d++) {
+          slice1 = slice1.select(0, index[d]);
+          slice2 = slice2.select(0, index[d]);
+        }
+        Tensor out_slice = output.select(0, i);
+        at::mm_out(out_slice, slice1, slice2);
+        for (int64_t d = num_batch_dims - 1; d >= 0; d--) {
+          if (++index[d] < expand_batch_portion[d]) {
+            break;
+          }
+          index[d] = 0;
+        }
+      }
+      return at::_unsafe_view(output, output_shape);
+    }
+
+    // flatten expanded batches; reshape only copies when the fold is not
+    // expressible as a view
+    tensor1_expanded = tensor1_expanded.reshape(tensor1_bmm_view);
+    tensor2_expanded = tensor2_expanded.reshape(tensor2_bmm_view);
+
     Tensor output = has_out ? at::_unsafe_view(at::bmm_out(out, tensor1_expanded, tensor2_expanded), output_shape)
                             : at::_unsafe_view(tensor1_expanded.bmm(tensor2_expanded), output_shape);
 
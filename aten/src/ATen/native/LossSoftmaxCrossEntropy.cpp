@@ -0,0 +1,73 @@
+#include <ATen/ATen.h>
+#include <ATen/NativeFunctions.h>
+#include <ATen/native/cpu/SoftmaxKernel.h>
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(softmax_cross_entropy_kernel);
+DEFINE_DISPATCH(softmax_cross_entropy_backward_kernel);
+
+// Fused softmax + cross-entropy over the class (last) dimension of a 2d
+// logits tensor. The composition log_softmax + nll_loss materializes the
+// full [N, C] log-probability tensor, which dominates activation memory
+// for very large class counts; the fused forward computes per-row max,
+// sum-exp and the target logit in one pass and keeps only the per-row loss
+// and log-sum-exp. The backward reconstructs softmax(x) row by row from
+// the saved log-sum-exp and writes grad_input directly.
+//
+// With label smoothing eps, the target distribution mixes (1 - eps) on the
+// target class with eps spread uniformly over all classes.
+
+std::tuple<Tensor, Tensor> softmax_cross_entropy_cpu(
+    const Tensor& self,
+    const Tensor& target,
+    double label_smoothing) {
+  TORCH_CHECK(
+      self.dim() == 2,
+      "_softmax_cross_entropy: expected 2D logits tensor, but got input with sizes ",
+      self.sizes());
+  TORCH_CHECK(
+      target.dim() == 1 && target.size(0) == self.size(0),
+      "_softmax_cross_entropy: expected 1D target with ", self.size(0),
+      " elements, but got target with sizes ", target.sizes());
+  TORCH_CHECK(
+      target.scalar_type() == kLong,
+      "_softmax_cross_entropy: expected target to have torch.int64 dtype, but got ",
+      target.scalar_type());
+  TORCH_CHECK(
+      label_smoothing >= 0.0 && label_smoothing <= 1.0,
+      "_softmax_cross_entropy: label_smoothing must be in [0, 1], but got ",
+      label_smoothing);
+  auto input = self.contiguous();
+  auto target_ = target.contiguous();
+  int64_t batch_size = input.size(0);
+  Tensor loss = at::empty({batch_size}, input.options());
+  Tensor logsumexp = at::empty({batch_size}, input.options());
+  if (batch_size > 0) {
+    softmax_cross_entropy_kernel(
+        kCPU, loss, logsumexp, input, target_, label_smoothing);
+  }
+  return std::make_tuple(loss, logsumexp);
+}
+
+Tensor softmax_cross_entropy_backward_cpu(
+    const Tensor& grad_output,
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    double label_smoothing) {
+  auto grad = grad_output.contiguous();
+  auto input = self.contiguous();
+  auto target_ = target.contiguous();
+  auto logsumexp_ = logsumexp.contiguous();
+  Tensor grad_input = at::empty_like(input, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  if (input.size(0) > 0) {
+    softmax_cross_entropy_backward_kernel(
+        kCPU, grad_input, grad, input, target_, logsumexp_, label_smoothing);
+  }
+  return grad_input;
+}
+
+} // namespace native
+} // namespace at
@@ -17,6 +17,7 @@ static const int MIOPEN_DIM_MAX = 5;
 namespace at { namespace native {
 
 DEFINE_DISPATCH(batch_norm_cpu_inference_contiguous_stub);
+DEFINE_DISPATCH(batch_norm_cpu_apply_affine_stub);
 
 namespace {
   void check_dims_match_num_input_features(const char* arg_name, int64_t expected, int64_t actual){
@@ -575,6 +576,77 @@ Tensor group_norm(const Tensor& input, int64_t num_groups,
     }
 }
 
+// Folds frozen running stats (and the optional affine parameters) into
+// per-channel (scale, shift) terms once, so that repeated inference calls
+// can skip the per-call rsqrt and apply batch norm as a plain scale-bias
+// pass via _batch_norm_apply_affine.
+std::tuple<Tensor, Tensor> batch_norm_fold_affine_cpu(
+    const Tensor& weight /* optional */, const Tensor& bias /* optional */,
+    const Tensor& running_mean, const Tensor& running_var, double eps) {
+  checkBackend("batch_norm_fold_affine_cpu",
+               {weight, bias, running_mean, running_var}, Backend::CPU);
+  TORCH_CHECK(
+      running_mean.dim() == 1 && running_var.sizes() == running_mean.sizes(),
+      "_batch_norm_fold_affine: expected matching 1D running_mean and "
+      "running_var, but got sizes ", running_mean.sizes(), " and ",
+      running_var.sizes());
+  int64_t n_channel = running_mean.size(0);
+  if (weight.defined()) {
+    check_dims_match_num_input_features("weight", n_channel, weight.numel());
+  }
+  if (bias.defined()) {
+    check_dims_match_num_input_features("bias", n_channel, bias.numel());
+  }
+  auto mean = running_mean.contiguous();
+  auto var = running_var.contiguous();
+  auto weight_ = weight.defined() ? weight.contiguous() : weight;
+  auto bias_ = bias.defined() ? bias.contiguous() : bias;
+  Tensor scale = at::empty_like(mean, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor shift = at::empty_like(mean, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  AT_DISPATCH_FLOATING_TYPES(mean.scalar_type(), "batch_norm_fold_affine_cpu", [&] {
+    batch_norm_cpu_inference_collect_linear_and_constant_terms<scalar_t>(
+        scale.data_ptr<scalar_t>(), shift.data_ptr<scalar_t>(), n_channel,
+        weight_, bias_, mean, var, eps);
+  });
+  return std::make_tuple(scale, shift);
+}
+
+Tensor batch_norm_apply_affine_cpu(
+    const Tensor& self, const Tensor& scale, const Tensor& shift) {
+  checkBackend("batch_norm_apply_affine_cpu", {self, scale, shift}, Backend::CPU);
+  TORCH_CHECK(
+      self.dim() >= 2,
+      "_batch_norm_apply_affine: expected input with at least 2 dimensions, "
+      "but got input with sizes ", self.sizes());
+  TORCH_CHECK(
+      scale.dim() == 1 && scale.size(0) == self.size(1) &&
+      shift.sizes() == scale.sizes(),
+      "_batch_norm_apply_affine: expected 1D scale and shift with ",
+      self.size(1), " elements, but got sizes ", scale.sizes(), " and ",
+      shift.sizes());
+  TORCH_CHECK(
+      self.scalar_type() == scale.scalar_type() &&
+      self.scalar_type() == shift.scalar_type(),
+      "_batch_norm_apply_affine: expected input, scale and shift to have the "
+      "same dtype, but got ", self.scalar_type(), ", ", scale.scalar_type(),
+      " and ", shift.scalar_type());
+  auto scale_ = scale.contiguous();
+  auto shift_ = shift.contiguous();
+  Tensor input;
+  Tensor output;
+  if (self.dim() == 4 && self.is_contiguous(at::MemoryFormat::ChannelsLast)) {
+    input = self;
+    output = at::empty_like(self, at::MemoryFormat::ChannelsLast);
+  } else {
+    input = self.contiguous();
+    output = at::empty_like(input, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  }
+  if (input.numel() > 0) {
+    batch_norm_cpu_apply_affine_stub(kCPU, output, input, scale_, shift_);
+  }
+  return output;
+}
+
 std::tuple<Tensor, Tensor> batch_norm_update_stats_cpu(
         const Tensor& self, const Tensor& running_mean, const Tensor& running_var, double momentum) {
   return AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "batch_norm_update_stats_cpu", [&] {
@@ -2,6 +2,7 @@
 #include <ATen/Parallel.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/div_rtn.h>
+#include <ATen/native/DispatchStub.h>
 #include <tuple>
 
 #pragma once
@@ -9,6 +10,36 @@
 namespace at {
 namespace native {
 
+// Channels-last 2d pooling kernels (see cpu/PoolKernel.cpp). fuse_relu
+// clamps the pooled output at zero in the same pass, for use by fusion
+// passes; the plain ops pass false.
+using avg_pool2d_channels_last_fn = void (*)(
+    Tensor& output,
+    const Tensor& input,
+    int kW, int kH, int dW, int dH, int padW, int padH,
+    bool count_include_pad,
+    c10::optional<int64_t> divisor_override,
+    bool fuse_relu);
+
+using max_pool2d_channels_last_fn = void (*)(
+    Tensor& output,
+    Tensor& indices,
+    const Tensor& input,
+    int kW, int kH, int dW, int dH, int padW, int padH,
+    int dilationW, int dilationH,
+    bool fuse_relu);
+
+using max_pool2d_backward_channels_last_fn = void (*)(
+    Tensor& grad_input,
+    const Tensor& grad_output,
+    const Tensor& indices);
+
+DECLARE_DISPATCH(avg_pool2d_channels_last_fn, avg_pool2d_channels_last_kernel);
+DECLARE_DISPATCH(max_pool2d_channels_last_fn, max_pool2d_channels_last_kernel);
+DECLARE_DISPATCH(
+    max_pool2d_backward_channels_last_fn,
+    max_pool2d_backward_channels_last_kernel);
+
 namespace {
 
 template <typename dest_t, typename src_t>
@@ -8,6 +8,8 @@ namespace native {
 
 DEFINE_DISPATCH(min_all_stub);
 DEFINE_DISPATCH(max_all_stub);
+DEFINE_DISPATCH(min_max_all_stub);
+DEFINE_DISPATCH(reduction_stats_stub);
 
 Tensor min(const Tensor &self) {
   TORCH_CHECK(self.numel() > 0, "operation does not have an identity.");
@@ -23,4 +25,24 @@ Tensor max(const Tensor &self) {
   return result;
 }
 
+std::tuple<Tensor, Tensor> _min_max(const Tensor &self) {
+  TORCH_CHECK(self.numel() > 0, "operation does not have an identity.");
+  Tensor min_result = at::empty({}, self.options());
+  Tensor max_result = at::empty({}, self.options());
+  min_max_all_stub(kCPU, min_result, max_result, self.contiguous());
+  return std::make_tuple(min_result, max_result);
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> _reduction_stats(const Tensor &self) {
+  TORCH_CHECK(self.numel() > 0, "operation does not have an identity.");
+  TORCH_CHECK(at::isFloatingType(self.scalar_type()),
+      "_reduction_stats only supports floating point types, got: ", self.scalar_type());
+  Tensor sum_result = at::empty({}, self.options());
+  Tensor sum_sq_result = at::empty({}, self.options());
+  Tensor min_result = at::empty({}, self.options());
+  Tensor max_result = at::empty({}, self.options());
+  reduction_stats_stub(kCPU, sum_result, sum_sq_result, min_result, max_result, self.contiguous());
+  return std::make_tuple(sum_result, sum_sq_result, min_result, max_result);
+}
+
 }} // namesapce at::native
@@ -9,4 +9,14 @@ using reduce_all_fn = void (*)(Tensor & result, const Tensor & self);
 DECLARE_DISPATCH(reduce_all_fn, min_all_stub);
 DECLARE_DISPATCH(reduce_all_fn, max_all_stub);
 
+// Fused multi-output reductions: several functors share a single pass over
+// the input (see reduce_all_impl_vec_two_outputs in ReduceAllOpsKernel.cpp).
+using reduce_min_max_fn = void (*)(Tensor & min_result, Tensor & max_result, const Tensor & self);
+DECLARE_DISPATCH(reduce_min_max_fn, min_max_all_stub);
+
+using reduce_stats_fn = void (*)(
+    Tensor & sum_result, Tensor & sum_sq_result,
+    Tensor & min_result, Tensor & max_result, const Tensor & self);
+DECLARE_DISPATCH(reduce_stats_fn, reduction_stats_stub);
+
 }}
@@ -7,6 +7,7 @@
 #include <ATen/native/SortingUtils.h>
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/NamedTensorUtils.h>
+#include <ATen/LegacyTHFunctionsCPU.h>
 
 namespace at {
 namespace native {
@@ -303,7 +304,25 @@ Tensor median_cpu(const Tensor& self) {
   return result.view({});
 }
 
+std::tuple<Tensor, Tensor> sort_cpu(const Tensor& self, int64_t dim, bool descending) {
+  int64_t wrapped_dim = maybe_wrap_dim(dim, std::max<int64_t>(self.dim(), 1));
+  // A sequential comparison sort can't keep a large machine busy on a big
+  // flat tensor; hand those off to the parallel radix sort kernel. Smaller
+  // or strided inputs aren't worth the histogram passes.
+  constexpr int64_t kMinRadixSortSize = 4096;
+  if (self.dim() == 1 && wrapped_dim == 0 && self.is_contiguous() &&
+      self.numel() >= kMinRadixSortSize &&
+      radix_sort_supported_dtype(self.scalar_type())) {
+    Tensor values = at::empty_like(self);
+    Tensor indices = at::empty(self.sizes(), self.options().dtype(kLong));
+    radix_sort_stub(kCPU, values, indices, self, descending);
+    return std::make_tuple(values, indices);
+  }
+  return legacy::cpu::_th_sort(self, dim, descending);
+}
+
 DEFINE_DISPATCH(topk_stub);
+DEFINE_DISPATCH(radix_sort_stub);
 
 } // namespace native
 } // namespace at
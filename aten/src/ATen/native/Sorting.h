@@ -9,4 +9,17 @@ using topk_fn = void(*)(Tensor&, Tensor&, const Tensor&, int64_t, int64_t, bool,
 
 DECLARE_DISPATCH(topk_fn, topk_stub);
 
+// Parallel radix sort for large 1-d contiguous tensors; values/indices are
+// preallocated outputs, see sort_cpu in Sorting.cpp.
+using sort_1d_fn = void(*)(Tensor&, Tensor&, const Tensor&, bool);
+
+DECLARE_DISPATCH(sort_1d_fn, radix_sort_stub);
+
+// True for the dtypes the radix sort kernel handles (integral types except
+// bool, plus float and double).
+static inline bool radix_sort_supported_dtype(ScalarType dtype) {
+  return at::isIntegralType(dtype, /*includeBool=*/false) ||
+      dtype == ScalarType::Float || dtype == ScalarType::Double;
+}
+
 }} // at::native
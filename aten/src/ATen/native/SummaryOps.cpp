@@ -2,11 +2,46 @@
 
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 
 #include <tuple>
+#include <vector>
 
 namespace at { namespace native {
 
+namespace {
+
+// Histogram engine shared by bincount and histc. Above a size threshold the
+// input is swept with at::parallel_for using per-thread privatized bins that
+// are merged at the end, so threads never contend on the shared counters.
+// `fn(bins, begin, end)` accumulates input elements [begin, end) into `bins`.
+// Privatization only pays off when the input is much larger than the bin
+// array, so small inputs (or huge bin counts) take the serial path.
+template <typename acc_t, typename F>
+void histogram_parallel_apply(
+    int64_t n, int64_t nbins, acc_t* output_p, const F& fn) {
+  if (n < at::internal::GRAIN_SIZE || nbins > n ||
+      at::get_num_threads() == 1 || at::in_parallel_region()) {
+    fn(output_p, 0, n);
+    return;
+  }
+  int max_threads = at::get_num_threads();
+  std::vector<acc_t> buffer(max_threads * nbins, static_cast<acc_t>(0));
+  at::parallel_for(0, n, at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+        acc_t* local_bins = buffer.data() + at::get_thread_num() * nbins;
+        fn(local_bins, begin, end);
+      });
+  for (int t = 0; t < max_threads; t++) {
+    const acc_t* local_bins = buffer.data() + t * nbins;
+    for (int64_t b = 0; b < nbins; b++) {
+      output_p[b] += local_bins[b];
+    }
+  }
+}
+
+} // namespace
+
 ///////////////// bincount /////////////////
 namespace {
 
@@ -31,6 +66,7 @@ Tensor _bincount_cpu_template(
   }
 
   Tensor output;
+  int64_t self_size = self.size(0);
   int64_t nbins = static_cast<int64_t>(*self.max().data_ptr<input_t>()) + 1L;
   nbins = std::max(nbins, minlength); // at least minlength # of bins
 
@@ -39,15 +75,21 @@ Tensor _bincount_cpu_template(
     output = native::zeros({nbins}, weights.options());
     weights_t* output_p = output.data_ptr<weights_t>();
     const weights_t* weights_p = weights.data_ptr<weights_t>();
-    for (int64_t i = 0; i < self.size(0); i++) {
-      output_p[self_p[i]] += weights_p[i];
-    }
+    histogram_parallel_apply<weights_t>(self_size, nbins, output_p,
+        [&](weights_t* bins, int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; i++) {
+            bins[self_p[i]] += weights_p[i];
+          }
+        });
   } else {
     output = native::zeros({nbins}, kLong);
     int64_t* output_p = output.data_ptr<int64_t>();
-    for (int64_t i = 0; i < self.size(0); i++) {
-      output_p[self_p[i]] += 1L;
-    }
+    histogram_parallel_apply<int64_t>(self_size, nbins, output_p,
+        [&](int64_t* bins, int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; i++) {
+            bins[self_p[i]] += 1L;
+          }
+        });
   }
   return output;
 }
@@ -64,4 +106,68 @@ _bincount_cpu(const Tensor& self, const Tensor& weights, int64_t minlength) {
   });
 }
 
+///////////////// histc /////////////////
+namespace {
+
+// Keeps the binning arithmetic of the TH kernel it replaces
+// ((v - min) / (max - min) * nbins, truncated and clamped to the last bin)
+// so bin edges are bit-identical, but runs the sweep through the parallel
+// engine above.
+template <typename scalar_t>
+Tensor& _histc_cpu_template(
+    Tensor& hist,
+    const Tensor& self,
+    int64_t nbins,
+    Scalar min,
+    Scalar max) {
+  TORCH_CHECK(nbins > 0, "bins must be > 0");
+  hist.resize_({nbins});
+  hist.zero_();
+  scalar_t minval = min.to<scalar_t>();
+  scalar_t maxval = max.to<scalar_t>();
+  if (minval == maxval) {
+    minval = *self.min().data_ptr<scalar_t>();
+    maxval = *self.max().data_ptr<scalar_t>();
+  }
+  if (minval == maxval) {
+    minval = minval - 1;
+    maxval = maxval + 1;
+  }
+
+  TORCH_CHECK(
+      !(std::isinf(minval) || std::isinf(maxval) || std::isnan(minval) ||
+        std::isnan(maxval)),
+      "range of [", minval, ", ", maxval, "] is not finite");
+  TORCH_CHECK(minval < maxval, "max must be larger than min");
+
+  const scalar_t* self_p = self.data_ptr<scalar_t>();
+  scalar_t* hist_p = hist.data_ptr<scalar_t>();
+  const scalar_t range = maxval - minval;
+  histogram_parallel_apply<scalar_t>(self.numel(), nbins, hist_p,
+      [&](scalar_t* bins, int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+          const scalar_t v = self_p[i];
+          if (v >= minval && v <= maxval) {
+            const int64_t bin =
+                static_cast<int64_t>((v - minval) / range * nbins);
+            bins[std::min(bin, nbins - 1)] += 1;
+          }
+        }
+      });
+  return hist;
+}
+} // namespace
+
+Tensor& _histc_out_cpu(Tensor& hist, const Tensor& self, int64_t bins, Scalar min, Scalar max) {
+  AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "histc_cpu", [&] {
+    _histc_cpu_template<scalar_t>(hist, self.contiguous(), bins, min, max);
+  });
+  return hist;
+}
+
+Tensor _histc_cpu(const Tensor& self, int64_t bins, Scalar min, Scalar max) {
+  Tensor hist = at::empty({0}, self.options());
+  return _histc_out_cpu(hist, self, bins, min, max);
+}
+
 }} // namespace at::native
@@ -120,12 +120,29 @@ Tensor empty_cpu(IntArrayRef size, const TensorOptions& options_, c10::optional<
 
   int64_t nelements = prod_intlist(size);
   auto dtype = options.dtype();
-  auto storage_impl = c10::make_intrusive<StorageImpl>(
-    dtype,
-    nelements,
-    allocator->allocate(nelements * dtype.itemsize()),
-    allocator,
-    /*resizeable=*/true);
+  int64_t size_bytes = nelements * dtype.itemsize();
+  c10::intrusive_ptr<StorageImpl> storage_impl;
+  if (size_bytes > 0 &&
+      size_bytes <= static_cast<int64_t>(InlineStorageImpl::kMaxInlineBytes) &&
+      !options.pinned_memory()) {
+    // Small tensors keep their data inline in the StorageImpl allocation,
+    // skipping the separate data allocation and the cache miss it costs on
+    // access. Pinned memory must come from the pinned allocator, so it is
+    // excluded. Resizing past the inline capacity copies out to a heap
+    // buffer through the usual allocate-and-swap path.
+    storage_impl = c10::make_intrusive<InlineStorageImpl>(
+      dtype,
+      nelements,
+      allocator,
+      /*resizable=*/true);
+  } else {
+    storage_impl = c10::make_intrusive<StorageImpl>(
+      dtype,
+      nelements,
+      allocator->allocate(size_bytes),
+      allocator,
+      /*resizable=*/true);
+  }
 
   auto tensor = detail::make_tensor<TensorImpl>(std::move(storage_impl), at::DispatchKey::CPUTensorId);
   // Default TensorImpl has size [0]
@@ -13,6 +13,54 @@ using loop_t = TensorIterator::loop_t;
 using loop2d_t = TensorIterator::loop2d_t;
 using StrideVector = TensorIterator::StrideVector;
 
+namespace {
+
+// Note [TensorIterator plan cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// build() redoes broadcasting, stride computation, dimension reordering and
+// coalescing on every call. Workloads that repeatedly run the same op on
+// tensors with identical shapes, strides and dtypes (e.g. inference servers)
+// pay this cost over and over for the same answer. When the operands are
+// fully specified up front (all defined, unnamed, same dtype and device) we
+// cache the computed iteration plan keyed on the operand metadata so later
+// builds can skip straight to the loop. The cache is thread-local to keep
+// lookups lock-free; entries are direct-mapped and overwritten on collision.
+// Only plans from the slow (strided) setup path are cached; fast_set_up()
+// already handles the contiguous cases cheaply. Plans are recorded only when
+// build() did not mutate any operand (no resize, cast or allocation), so
+// replaying a plan on identical metadata is a pure bookkeeping shortcut.
+
+struct IterationPlan {
+  DimVector shape;
+  DimVector perm;
+  SmallVector<OperandInfo::StrideVector, 4> stride_bytes;
+  bool all_ops_same_shape = false;
+};
+
+struct PlanCacheSlot {
+  SmallVector<int64_t, 32> key;
+  IterationPlan plan;
+};
+
+constexpr size_t kPlanCacheSize = 64;
+
+std::array<PlanCacheSlot, kPlanCacheSize>& plan_cache() {
+  thread_local std::array<PlanCacheSlot, kPlanCacheSize> cache;
+  return cache;
+}
+
+size_t plan_cache_slot(const SmallVector<int64_t, 32>& key) {
+  // FNV-1a over the key words; the cache is direct-mapped so we only need a
+  // reasonable spread, not a cryptographic hash.
+  uint64_t hash = 14695981039346656037ULL;
+  for (int64_t v : key) {
+    hash = (hash ^ static_cast<uint64_t>(v)) * 1099511628211ULL;
+  }
+  return hash % kPlanCacheSize;
+}
+
+} // namespace
+
 void TensorIterator::reorder_dimensions() {
   // Sort the dimensions based on strides in ascending order with reduced dims
   // at the front. NOTE: that this inverts the order of C-contiguous tensors.
@@ -1040,6 +1088,83 @@ FastSetupType TensorIterator::compute_fast_setup_type() {
   return FastSetupType::NONE;
 }
 
+bool TensorIterator::plan_cacheable() const {
+  if (is_reduction_) {
+    return false;
+  }
+  for (auto& op : operands_) {
+    if (!op.tensor.defined() || op.tensor.has_names()) {
+      return false;
+    }
+    // Mixed dtypes can make compute_types() insert casted copies of
+    // operands, which would invalidate the cached strides. Mixed devices
+    // similarly take operand-mutating paths.
+    if (op.tensor.scalar_type() != operands_[0].tensor.scalar_type() ||
+        op.tensor.device() != operands_[0].tensor.device()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TensorIterator::PlanKey TensorIterator::compute_plan_key() const {
+  PlanKey key;
+  key.push_back(num_outputs_);
+  key.push_back(static_cast<int64_t>(common_dtype_strategy_));
+  key.push_back(resize_outputs_);
+  key.push_back(static_cast<int64_t>(operands_[0].tensor.scalar_type()));
+  for (auto& op : operands_) {
+    auto& tensor = op.tensor;
+    key.push_back((tensor.dim() << 2) | (op.is_output << 1) | op.is_read_write);
+    for (auto size : tensor.sizes()) {
+      key.push_back(size);
+    }
+    for (auto stride : tensor.strides()) {
+      key.push_back(stride);
+    }
+  }
+  return key;
+}
+
+bool TensorIterator::try_load_cached_plan(const PlanKey& key) {
+  auto& entry = plan_cache()[plan_cache_slot(key)];
+  if (entry.key != key) {
+    return false;
+  }
+  const auto& plan = entry.plan;
+  shape_ = plan.shape;
+  perm_ = plan.perm;
+  for (int i = 0; i < ntensors(); i++) {
+    operands_[i].stride_bytes = plan.stride_bytes[i];
+  }
+  all_ops_same_shape_ = plan.all_ops_same_shape;
+  has_coalesced_dimensions_ = true;
+  return true;
+}
+
+void TensorIterator::save_plan_to_cache(const PlanKey& key) {
+  // If setup casted an operand or resized an output, the keyed metadata no
+  // longer describes the operands and replaying the plan would skip that
+  // work, so don't record anything.
+  for (auto& op : operands_) {
+    if (op.original_tensor.defined()) {
+      return;
+    }
+  }
+  if (compute_plan_key() != key) {
+    return;
+  }
+  auto& entry = plan_cache()[plan_cache_slot(key)];
+  entry.key = key;
+  entry.plan.shape = shape_;
+  entry.plan.perm = perm_;
+  entry.plan.stride_bytes.clear();
+  for (auto& op : operands_) {
+    entry.plan.stride_bytes.push_back(op.stride_bytes);
+  }
+  entry.plan.all_ops_same_shape = all_ops_same_shape_;
+}
+
 void TensorIterator::build() {
   // check input tensors memory format to use it during output allocation
   analyze_memory_format();
@@ -1050,20 +1175,36 @@ void TensorIterator::build() {
   check_mem_overlaps();
   // Check that input dimensions are aligned correctly & compute outnames.
   compute_names();
-  // compute the broadcasted shape
-  compute_shape();
-  // compute the result dtype and device
-  compute_types();
-  // try fast setup output tensor, if failed, fallback to normal setup
-  if (!fast_set_up()) {
-    // compute each tensor's stride after broadcasting
-    compute_strides();
-    // re-order dimensions to improve coalescing
-    reorder_dimensions();
-    // allocate the output tensor if it's not provided
-    allocate_outputs();
-    // coalesce adjacent dimensions when possible
-    coalesce_dimensions();
+  // reuse a cached iteration plan if we've seen identical operand metadata
+  // before (see Note [TensorIterator plan cache])
+  bool cacheable = plan_cacheable();
+  PlanKey plan_key;
+  if (cacheable) {
+    plan_key = compute_plan_key();
+  }
+  if (cacheable && try_load_cached_plan(plan_key)) {
+    // compute the result dtype and device; with homogeneous operands this
+    // never mutates them, so the cached strides remain valid
+    compute_types();
+  } else {
+    // compute the broadcasted shape
+    compute_shape();
+    // compute the result dtype and device
+    compute_types();
+    // try fast setup output tensor, if failed, fallback to normal setup
+    if (!fast_set_up()) {
+      // compute each tensor's stride after broadcasting
+      compute_strides();
+      // re-order dimensions to improve coalescing
+      reorder_dimensions();
+      // allocate the output tensor if it's not provided
+      allocate_outputs();
+      // coalesce adjacent dimensions when possible
+      coalesce_dimensions();
+      if (cacheable) {
+        save_plan_to_cache(plan_key);
+      }
+    }
   }
   // perform name inference
   propagate_names_to_outputs();
@@ -360,6 +360,14 @@ struct CAFFE2_API TensorIterator {
   void build();
 
 protected:
+  // Plan caching for repeated builds with identical operand metadata.
+  // See Note [TensorIterator plan cache] in TensorIterator.cpp.
+  using PlanKey = SmallVector<int64_t, 32>;
+  bool plan_cacheable() const;
+  PlanKey compute_plan_key() const;
+  bool try_load_cached_plan(const PlanKey& key);
+  void save_plan_to_cache(const PlanKey& key);
+
   void mark_outputs();
   void check_mem_overlaps();
   void compute_shape();
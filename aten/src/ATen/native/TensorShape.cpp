@@ -21,7 +21,7 @@
 namespace at {
 namespace native {
 
-DEFINE_DISPATCH(cat_serial_stub);
+DEFINE_DISPATCH(cat_contiguous_stub);
 
 Tensor _reshape_from_tensor(const Tensor& self, const Tensor& shape_tensor) {
   TORCH_CHECK(shape_tensor.dim() == 1);
@@ -165,12 +165,12 @@ Tensor & _cat_out_cpu(Tensor& result, TensorList tensors, int64_t dim) {
   result_size[dim] = cat_dim_size;
   result.resize_(result_size);
 
-  // fast path for single thread when both inputs and result are contiguous and not empty
-  bool use_serial_kernel = result.numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1;
+  // fast path when both inputs and result are contiguous: one precomputed
+  // layout, segment copies parallelized over the outer dimension
   allContiguous = allContiguous && result.is_contiguous();
   ScalarType dtype = notSkippedTensor.scalar_type();
-  if (use_serial_kernel && allContiguous && (dtype == ScalarType::Double || dtype == ScalarType::Float)) {
-    cat_serial_stub(kCPU, result, tensors, dim);
+  if (allContiguous && !isComplexType(dtype) && !isQIntType(dtype)) {
+    cat_contiguous_stub(kCPU, result, tensors, dim);
     return result;
   }
 
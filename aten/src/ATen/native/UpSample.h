@@ -49,12 +49,14 @@ using scale_t = c10::optional<double>;
 using upsampling_1d = void(*)(Tensor& output, const Tensor& input, scale_t scales_w);
 using upsampling_2d = void(*)(Tensor& output, const Tensor& input, scale_t scales_h, scale_t scales_w);
 using upsampling_3d = void(*)(Tensor& output, const Tensor& input, scale_t scales_d, scale_t scales_h, scale_t scales_w);
+using upsampling_bilinear2d = void(*)(Tensor& output, const Tensor& input, bool align_corners, scale_t scales_h, scale_t scales_w);
 DECLARE_DISPATCH(upsampling_1d, upsample_nearest1d_kernel);
 DECLARE_DISPATCH(upsampling_2d, upsample_nearest2d_kernel);
 DECLARE_DISPATCH(upsampling_3d, upsample_nearest3d_kernel);
 DECLARE_DISPATCH(upsampling_1d, upsample_nearest1d_backward_kernel);
 DECLARE_DISPATCH(upsampling_2d, upsample_nearest2d_backward_kernel);
 DECLARE_DISPATCH(upsampling_3d, upsample_nearest3d_backward_kernel);
+DECLARE_DISPATCH(upsampling_bilinear2d, upsample_bilinear2d_kernel);
 
 static inline void upsample_1d_shape_check(
     const Tensor& input,
@@ -188,6 +188,18 @@ static void upsample_bilinear2d_out_cpu_template(
       output_height,
       output_width);
 
+  if (input_.is_contiguous(at::MemoryFormat::ChannelsLast)) {
+    // NHWC keeps the channel dimension innermost and contiguous; the
+    // dedicated channels-last kernel vectorizes across it, whereas the frame
+    // loop below would first densify the input to NCHW.
+    output.resize_(
+        {nbatch, channels, output_height, output_width},
+        at::MemoryFormat::ChannelsLast);
+    upsample_bilinear2d_kernel(
+        kCPU, output, input_, align_corners, scales_h, scales_w);
+    return;
+  }
+
   auto input = input_.contiguous();
 
   output.resize_({nbatch, channels, output_height, output_width});
@@ -328,5 +340,7 @@ Tensor upsample_bilinear2d_backward_cpu(
   return grad_input;
 }
 
+DEFINE_DISPATCH(upsample_bilinear2d_kernel);
+
 } // namespace native
 } // namespace at
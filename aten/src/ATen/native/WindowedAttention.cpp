@@ -0,0 +1,149 @@
+// Sliding-window (banded) scaled dot product attention.
+//
+// Local attention written as softmax(Q K^T / sqrt(D) + mask) V materializes
+// the full S x S score matrix only to throw away everything outside a band:
+// with a window of w, just the 2w + 1 central diagonals survive the mask.
+// _windowed_attention computes the banded product directly. For each query
+// row the kernel fills a per-thread buffer with the at most 2w + 1 in-window
+// scores, runs a max-shifted softmax over that buffer, and contracts the
+// normalized weights with the matching value rows on the spot, so peak
+// memory is O(w) per thread on top of the output and the running time is
+// O(S * w * D) instead of O(S^2 * D).
+//
+// Inputs are (batch, seq_len, dim); multi-head callers fold the head
+// dimension into the batch. Query position i attends to key positions j
+// with |i - j| <= window_size.
+
+#include <ATen/ATen.h>
+#include <ATen/NativeFunctions.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+#include <ATen/cpu/vec256/functional.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace at { namespace native {
+
+namespace {
+
+template <typename scalar_t>
+void windowed_attention_kernel(
+    scalar_t* out_data,
+    const scalar_t* q_data,
+    const scalar_t* k_data,
+    const scalar_t* v_data,
+    int64_t batch,
+    int64_t seq_len,
+    int64_t dim,
+    int64_t window_size) {
+  using Vec = vec256::Vec256<scalar_t>;
+  const scalar_t scale =
+      static_cast<scalar_t>(1) / std::sqrt(static_cast<scalar_t>(dim));
+  const int64_t band_width = 2 * window_size + 1;
+
+  at::parallel_for(
+      0,
+      batch * seq_len,
+      std::max<int64_t>(at::internal::GRAIN_SIZE / (band_width * dim), 1),
+      [&](int64_t begin, int64_t end) {
+    std::vector<scalar_t> band(band_width);
+    for (int64_t index = begin; index < end; index++) {
+      const int64_t b = index / seq_len;
+      const int64_t i = index % seq_len;
+      const int64_t j0 = std::max<int64_t>(i - window_size, 0);
+      const int64_t j1 = std::min<int64_t>(i + window_size, seq_len - 1);
+
+      const scalar_t* q_row = q_data + (b * seq_len + i) * dim;
+
+      // Banded QK^T row: scaled scores for the in-window keys only.
+      scalar_t max_score = std::numeric_limits<scalar_t>::lowest();
+      for (int64_t j = j0; j <= j1; j++) {
+        const scalar_t score = scale *
+            vec256::map2_reduce_all<scalar_t>(
+                [](Vec x, Vec y) { return x * y; },
+                [](Vec x, Vec y) { return x + y; },
+                q_row,
+                k_data + (b * seq_len + j) * dim,
+                dim);
+        band[j - j0] = score;
+        max_score = std::max(max_score, score);
+      }
+
+      // Max-shifted softmax over the band.
+      scalar_t sum = 0;
+      for (int64_t j = 0; j <= j1 - j0; j++) {
+        band[j] = std::exp(band[j] - max_score);
+        sum += band[j];
+      }
+      const scalar_t inv_sum = static_cast<scalar_t>(1) / sum;
+
+      // Windowed AV: contract the normalized band with the value rows.
+      scalar_t* out_row = out_data + (b * seq_len + i) * dim;
+      std::fill(out_row, out_row + dim, static_cast<scalar_t>(0));
+      for (int64_t j = j0; j <= j1; j++) {
+        const scalar_t* v_row = v_data + (b * seq_len + j) * dim;
+        const Vec weight(band[j - j0] * inv_sum);
+        int64_t d = 0;
+        for (; d + Vec::size() <= dim; d += Vec::size()) {
+          vec256::fmadd(Vec::loadu(v_row + d), weight, Vec::loadu(out_row + d))
+              .store(out_row + d);
+        }
+        for (; d < dim; d++) {
+          out_row[d] += band[j - j0] * inv_sum * v_row[d];
+        }
+      }
+    }
+  });
+}
+
+} // namespace
+
+Tensor windowed_attention_cpu(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    int64_t window_size) {
+  TORCH_CHECK(!query.is_cuda(), "_windowed_attention: expected CPU tensors");
+  TORCH_CHECK(query.dim() == 3 && key.dim() == 3 && value.dim() == 3,
+      "_windowed_attention: expected 3-D (batch, seq_len, dim) tensors, got ",
+      query.dim(), "-D, ", key.dim(), "-D, and ", value.dim(), "-D");
+  TORCH_CHECK(query.sizes() == key.sizes() && query.sizes() == value.sizes(),
+      "_windowed_attention: query, key and value must have matching sizes, got ",
+      query.sizes(), ", ", key.sizes(), ", and ", value.sizes());
+  TORCH_CHECK(
+      query.scalar_type() == key.scalar_type() &&
+          query.scalar_type() == value.scalar_type(),
+      "_windowed_attention: query, key and value must have matching dtypes, got ",
+      query.scalar_type(), ", ", key.scalar_type(), ", and ",
+      value.scalar_type());
+  TORCH_CHECK(window_size >= 0,
+      "_windowed_attention: window_size must be non-negative, got ",
+      window_size);
+
+  auto q = query.contiguous();
+  auto k = key.contiguous();
+  auto v = value.contiguous();
+  Tensor output = at::empty_like(q);
+
+  if (q.numel() == 0) {
+    return output;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(q.scalar_type(), "_windowed_attention", [&] {
+    windowed_attention_kernel<scalar_t>(
+        output.data_ptr<scalar_t>(),
+        q.data_ptr<scalar_t>(),
+        k.data_ptr<scalar_t>(),
+        v.data_ptr<scalar_t>(),
+        q.size(0),
+        q.size(1),
+        q.size(2),
+        window_size);
+  });
+
+  return output;
+}
+
+}} // namespace at::native
@@ -12,6 +12,14 @@ using batch_norm_fn = void (*)(Tensor&, const Tensor&, const Tensor&,
 
 DECLARE_DISPATCH(batch_norm_fn, batch_norm_cpu_inference_contiguous_stub);
 
+// Applies precomputed per-channel (scale, shift) terms as a single fused
+// pass: output(n, c, ...) = input(n, c, ...) * scale(c) + shift(c).
+// Used by the frozen-stats inference path (see _batch_norm_apply_affine).
+using batch_norm_apply_affine_fn = void (*)(Tensor&, const Tensor&,
+    const Tensor&, const Tensor&);
+
+DECLARE_DISPATCH(batch_norm_apply_affine_fn, batch_norm_cpu_apply_affine_stub);
+
 } // namespace native
 
 } // namespace at
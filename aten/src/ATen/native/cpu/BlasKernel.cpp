@@ -0,0 +1,240 @@
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+#include <ATen/native/CPUBlas.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace at {
+namespace native {
+namespace cpublas {
+namespace {
+
+using namespace vec256;
+
+// Cache blocking parameters of the classic Goto decomposition: the packed
+// B panel (KC x NR per register tile) stays L1-resident across the row
+// blocks, the packed A block (MC x KC) stays L2-resident across the column
+// tiles. The register tile is MR x NR with MR = 2 vector registers of rows,
+// so the microkernel keeps 2 * NR vector accumulators plus the two A loads
+// live, which fits the 16 architectural vector registers of both AVX2 and
+// NEON.
+constexpr int64_t KC = 256;
+constexpr int64_t MC = 128;
+constexpr int64_t NR = 4;
+
+template <typename scalar_t>
+inline scalar_t op_a(
+    const scalar_t* a, int64_t lda, bool trans, int64_t i, int64_t l) {
+  return trans ? a[l + i * lda] : a[i + l * lda];
+}
+
+template <typename scalar_t>
+inline scalar_t op_b(
+    const scalar_t* b, int64_t ldb, bool trans, int64_t l, int64_t j) {
+  return trans ? b[j + l * ldb] : b[l + j * ldb];
+}
+
+// Packs rows [i0, i0 + mb) x columns [p0, p0 + kb) of op(A) into MR-row
+// tiles laid out tile-after-tile, each tile column-major with MR contiguous
+// rows; rows past mb are zero-filled so the microkernel never needs a
+// row-remainder path.
+template <typename scalar_t>
+void pack_a(
+    scalar_t* dst, const scalar_t* a, int64_t lda, bool trans,
+    int64_t i0, int64_t mb, int64_t p0, int64_t kb) {
+  constexpr int64_t MR = 2 * Vec256<scalar_t>::size();
+  for (int64_t r = 0; r * MR < mb; r++) {
+    const int64_t rows = std::min(MR, mb - r * MR);
+    for (int64_t l = 0; l < kb; l++) {
+      scalar_t* col = dst + r * MR * kb + l * MR;
+      for (int64_t i = 0; i < rows; i++) {
+        col[i] = op_a(a, lda, trans, i0 + r * MR + i, p0 + l);
+      }
+      for (int64_t i = rows; i < MR; i++) {
+        col[i] = scalar_t(0);
+      }
+    }
+  }
+}
+
+// Packs rows [p0, p0 + kb) x columns [j0, j0 + nb) of op(B) into NR-column
+// tiles, each tile row-major with NR contiguous columns, scaled by alpha
+// and zero-padded past nb.
+template <typename scalar_t>
+void pack_b(
+    scalar_t* dst, const scalar_t* b, int64_t ldb, bool trans,
+    int64_t p0, int64_t kb, int64_t j0, int64_t nb, scalar_t alpha) {
+  for (int64_t t = 0; t * NR < nb; t++) {
+    const int64_t cols = std::min(NR, nb - t * NR);
+    for (int64_t l = 0; l < kb; l++) {
+      scalar_t* row = dst + t * NR * kb + l * NR;
+      for (int64_t j = 0; j < cols; j++) {
+        row[j] = alpha * op_b(b, ldb, trans, p0 + l, j0 + t * NR + j);
+      }
+      for (int64_t j = cols; j < NR; j++) {
+        row[j] = scalar_t(0);
+      }
+    }
+  }
+}
+
+// C tile (rows x cols, rows <= MR, cols <= NR) += packed A tile @ packed B
+// tile. The accumulators live in registers for the whole k loop; C is only
+// touched once at the end.
+template <typename scalar_t>
+inline void micro_kernel(
+    const scalar_t* pa, const scalar_t* pb, int64_t kb,
+    scalar_t* c, int64_t ldc, int64_t rows, int64_t cols) {
+  using Vec = Vec256<scalar_t>;
+  constexpr int64_t VLEN = Vec::size();
+  constexpr int64_t MR = 2 * VLEN;
+
+  Vec acc[2][NR];
+  for (int64_t j = 0; j < NR; j++) {
+    acc[0][j] = Vec(scalar_t(0));
+    acc[1][j] = Vec(scalar_t(0));
+  }
+  for (int64_t l = 0; l < kb; l++) {
+    const Vec a0 = Vec::loadu(pa + l * MR);
+    const Vec a1 = Vec::loadu(pa + l * MR + VLEN);
+    for (int64_t j = 0; j < NR; j++) {
+      const Vec bv(pb[l * NR + j]);
+      acc[0][j] = vec256::fmadd(a0, bv, acc[0][j]);
+      acc[1][j] = vec256::fmadd(a1, bv, acc[1][j]);
+    }
+  }
+
+  if (rows == MR && cols == NR) {
+    for (int64_t j = 0; j < NR; j++) {
+      scalar_t* cc = c + j * ldc;
+      (Vec::loadu(cc) + acc[0][j]).store(cc);
+      (Vec::loadu(cc + VLEN) + acc[1][j]).store(cc + VLEN);
+    }
+  } else {
+    alignas(64) scalar_t tmp[MR];
+    for (int64_t j = 0; j < cols; j++) {
+      acc[0][j].store(tmp);
+      acc[1][j].store(tmp + VLEN);
+      scalar_t* cc = c + j * ldc;
+      for (int64_t i = 0; i < rows; i++) {
+        cc[i] += tmp[i];
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void gemm_tiled(
+    bool transa, bool transb,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t* a, int64_t lda,
+    const scalar_t* b, int64_t ldb,
+    scalar_t beta,
+    scalar_t* c, int64_t ldc) {
+  if (m <= 0 || n <= 0) {
+    return;
+  }
+  constexpr int64_t MR = 2 * Vec256<scalar_t>::size();
+
+  // Tasks own complete NR-column stripes of C, so the beta scaling and all
+  // tile updates of a column happen on one thread and need no
+  // synchronization. Each task packs its own panels; the redundant A
+  // packing across threads is the usual price of slicing the n dimension.
+  const int64_t n_tiles = (n + NR - 1) / NR;
+  const int64_t work_per_tile = 2 * std::max<int64_t>(1, m * k) * NR;
+  const int64_t grain =
+      std::max<int64_t>(1, at::internal::GRAIN_SIZE / work_per_tile);
+
+  at::parallel_for(0, n_tiles, grain, [&](int64_t tile_begin, int64_t tile_end) {
+    const int64_t j0 = tile_begin * NR;
+    const int64_t j1 = std::min(tile_end * NR, n);
+    const int64_t nb = j1 - j0;
+    if (nb <= 0) {
+      return;
+    }
+
+    // beta == 0 must overwrite, not scale, so uninitialized output (which
+    // may hold NaNs) stays well-defined.
+    if (beta == scalar_t(0)) {
+      for (int64_t j = j0; j < j1; j++) {
+        std::fill(c + j * ldc, c + j * ldc + m, scalar_t(0));
+      }
+    } else if (beta != scalar_t(1)) {
+      for (int64_t j = j0; j < j1; j++) {
+        scalar_t* cc = c + j * ldc;
+        for (int64_t i = 0; i < m; i++) {
+          cc[i] *= beta;
+        }
+      }
+    }
+    if (k <= 0 || alpha == scalar_t(0)) {
+      return;
+    }
+
+    const int64_t nb_round = ((nb + NR - 1) / NR) * NR;
+    std::unique_ptr<scalar_t[]> packed_b(new scalar_t[KC * nb_round]);
+    std::unique_ptr<scalar_t[]> packed_a(new scalar_t[MC * KC]);
+
+    for (int64_t p0 = 0; p0 < k; p0 += KC) {
+      const int64_t kb = std::min(KC, k - p0);
+      pack_b(packed_b.get(), b, ldb, transb, p0, kb, j0, nb, alpha);
+      for (int64_t i0 = 0; i0 < m; i0 += MC) {
+        const int64_t mb = std::min(MC, m - i0);
+        pack_a(packed_a.get(), a, lda, transa, i0, mb, p0, kb);
+        for (int64_t t = 0; t * NR < nb; t++) {
+          const int64_t cols = std::min(NR, nb - t * NR);
+          for (int64_t r = 0; r * MR < mb; r++) {
+            const int64_t rows = std::min(MR, mb - r * MR);
+            micro_kernel(
+                packed_a.get() + r * MR * kb,
+                packed_b.get() + t * NR * kb,
+                kb,
+                c + (j0 + t * NR) * ldc + i0 + r * MR,
+                ldc,
+                rows,
+                cols);
+          }
+        }
+      }
+    }
+  });
+}
+
+void cpublas_gemm_impl(
+    at::ScalarType type,
+    TransposeType transa,
+    TransposeType transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    double alpha,
+    const void* a,
+    int64_t lda,
+    const void* b,
+    int64_t ldb,
+    double beta,
+    void* c,
+    int64_t ldc) {
+  AT_DISPATCH_FLOATING_TYPES(type, "cpublas_gemm", [&] {
+    gemm_tiled<scalar_t>(
+        transa == TransposeType::Transpose,
+        transb == TransposeType::Transpose,
+        m, n, k,
+        static_cast<scalar_t>(alpha),
+        static_cast<const scalar_t*>(a), lda,
+        static_cast<const scalar_t*>(b), ldb,
+        static_cast<scalar_t>(beta),
+        static_cast<scalar_t*>(c), ldc);
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(gemm_stub, &cpublas_gemm_impl);
+
+} // namespace cpublas
+} // namespace native
+} // namespace at
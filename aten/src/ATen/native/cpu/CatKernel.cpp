@@ -1,10 +1,13 @@
 #include <ATen/ATen.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <ATen/cpu/vec256/functional.h>
 #include <ATen/cpu/vec256/vec256.h>
 
+#include <algorithm>
+
 namespace at { namespace native {
 
 namespace {
@@ -18,8 +21,16 @@ struct InputMeta {
     , inner_size(t.size(dim) * inner) {}
 };
 
+// Concatenation of contiguous tensors along any dim reduces to interleaved
+// segment copies: for every outer index, each input contributes one
+// contiguous run of inner_size elements. All input metadata is gathered once
+// up front (a single pass of refcount traffic instead of one TensorIterator
+// setup per input) and the outer dimension is split across threads; every
+// outer slice owns a disjoint range of the output. When there is only one
+// outer slice (dim-0 cat), the flat output range is split instead so the
+// copies still parallelize.
 template <typename scalar_t>
-void cat_serial_kernel_impl(Tensor& result, TensorList tensors, int64_t dim) {
+void cat_contiguous_kernel_impl(Tensor& result, TensorList tensors, int64_t dim) {
   auto size = result.sizes().vec();
   int64_t outer = 1, inner = 1;
   for (int64_t i = 0; i < dim; i++) {
@@ -32,44 +43,88 @@ void cat_serial_kernel_impl(Tensor& result, TensorList tensors, int64_t dim) {
   int64_t ninputs = tensors.size();
   std::vector<InputMeta> inputs;
   inputs.reserve(ninputs);
+  int64_t result_inner = 0;
   for (auto const &tensor : tensors) {
     inputs.emplace_back(tensor, dim, inner);
+    result_inner += inputs.back().inner_size;
   }
- 
+
   using Vec = vec256::Vec256<scalar_t>;
-  int64_t offset = 0;
-  for (int64_t i = 0; i < outer; i++) {
+  if (outer == 1) {
+    // dim-0 cat (the common collate case) has a single outer slice, so
+    // splitting over `outer` would run serially regardless of size. Split
+    // the flat output range across threads instead and map each range back
+    // to (input, offset) pairs via the segment prefix sums.
+    std::vector<int64_t> offsets(ninputs + 1, 0);
     for (int64_t j = 0; j < ninputs; j++) {
-      scalar_t* result_ptr = result_data + offset;
-      int64_t local_inner = inputs[j].inner_size;
-      scalar_t* input_ptr = (scalar_t*)(inputs[j].data_ptr) + i * local_inner;
-      if (local_inner < Vec::size()) {
-        #ifndef _MSC_VER
-        # pragma unroll
-        #endif
-        for (int64_t k = 0; k < local_inner; k++) {
-          result_ptr[k] = input_ptr[k];
+      offsets[j + 1] = offsets[j] + inputs[j].inner_size;
+    }
+    at::parallel_for(0, result_inner, internal::GRAIN_SIZE,
+        [&](int64_t begin, int64_t end) {
+      // last input whose segment starts at or before begin
+      int64_t j = std::upper_bound(offsets.begin(), offsets.end(), begin) -
+          offsets.begin() - 1;
+      int64_t pos = begin;
+      while (pos < end) {
+        int64_t len = std::min(end, offsets[j + 1]) - pos;
+        scalar_t* result_ptr = result_data + pos;
+        scalar_t* input_ptr =
+            (scalar_t*)(inputs[j].data_ptr) + (pos - offsets[j]);
+        if (len < Vec::size()) {
+          for (int64_t k = 0; k < len; k++) {
+            result_ptr[k] = input_ptr[k];
+          }
+        } else {
+          vec256::map(
+              [](Vec x) { return x; },
+              result_ptr,
+              input_ptr,
+              len);
         }
-      } else {
-        vec256::map(
-            [](Vec x) { return x; },
-            result_ptr,
-            input_ptr,
-            local_inner);
+        pos += len;
+        j++;
       }
-      offset += local_inner;
-    }
+    });
+    return;
   }
+  int64_t grain_size = std::max(
+      static_cast<int64_t>(1), internal::GRAIN_SIZE / std::max(result_inner, static_cast<int64_t>(1)));
+  at::parallel_for(0, outer, grain_size, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      int64_t offset = i * result_inner;
+      for (int64_t j = 0; j < ninputs; j++) {
+        scalar_t* result_ptr = result_data + offset;
+        int64_t local_inner = inputs[j].inner_size;
+        scalar_t* input_ptr = (scalar_t*)(inputs[j].data_ptr) + i * local_inner;
+        if (local_inner < Vec::size()) {
+          #ifndef _MSC_VER
+          # pragma unroll
+          #endif
+          for (int64_t k = 0; k < local_inner; k++) {
+            result_ptr[k] = input_ptr[k];
+          }
+        } else {
+          vec256::map(
+              [](Vec x) { return x; },
+              result_ptr,
+              input_ptr,
+              local_inner);
+        }
+        offset += local_inner;
+      }
+    }
+  });
 }
 
-void cat_serial_kernel(Tensor& result, TensorList tensors, int64_t dim) {
-  AT_DISPATCH_FLOATING_TYPES(result.scalar_type(), "cat_serial_kernel", [&]() {
-    cat_serial_kernel_impl<scalar_t>(result, tensors, dim);
+void cat_contiguous_kernel(Tensor& result, TensorList tensors, int64_t dim) {
+  AT_DISPATCH_ALL_TYPES_AND3(at::ScalarType::Half, at::ScalarType::Bool, at::ScalarType::BFloat16,
+      result.scalar_type(), "cat_contiguous_kernel", [&]() {
+    cat_contiguous_kernel_impl<scalar_t>(result, tensors, dim);
   });
 }
 
 } // anonymous namespace
 
-REGISTER_DISPATCH(cat_serial_stub, &cat_serial_kernel);
+REGISTER_DISPATCH(cat_contiguous_stub, &cat_contiguous_kernel);
 
 }} // at::native
@@ -5,7 +5,7 @@
 
 namespace at { namespace native {
 
-using cat_serial_fn = void(*)(Tensor &, TensorList, int64_t);
-DECLARE_DISPATCH(cat_serial_fn, cat_serial_stub);
+using cat_contiguous_fn = void(*)(Tensor &, TensorList, int64_t);
+DECLARE_DISPATCH(cat_contiguous_fn, cat_contiguous_stub);
 
 }}  // namespace at::native
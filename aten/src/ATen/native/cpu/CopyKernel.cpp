@@ -1,6 +1,7 @@
 #include <ATen/ATen.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
@@ -10,9 +11,98 @@ namespace at {
 namespace native {
 namespace {
 
+// Copies between a permuted and a contiguous tensor reduce to a 2-d pattern
+// after dimension coalescing: the destination is contiguous along the inner
+// dimension and the source is contiguous along the outer one (or vice versa,
+// depending on reordering). The generic strided loop then touches a new cache
+// line of the source for every element. Instead, walk the copy in square
+// tiles small enough that both the source and destination footprints stay
+// cache resident, and parallelize over the tile grid.
+constexpr int64_t kTransposeCopyTileSize = 64;
+
+template <typename scalar_t>
+static void transpose_copy_tiled(
+    scalar_t* dst, int64_t dst_outer_stride,
+    const scalar_t* src, int64_t src_inner_stride,
+    int64_t inner_size, int64_t outer_size) {
+  int64_t inner_tiles = divup(inner_size, kTransposeCopyTileSize);
+  int64_t outer_tiles = divup(outer_size, kTransposeCopyTileSize);
+  at::parallel_for(0, inner_tiles * outer_tiles, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t tile = begin; tile < end; tile++) {
+      int64_t i0_begin = (tile % inner_tiles) * kTransposeCopyTileSize;
+      int64_t i1_begin = (tile / inner_tiles) * kTransposeCopyTileSize;
+      int64_t i0_end = std::min(i0_begin + kTransposeCopyTileSize, inner_size);
+      int64_t i1_end = std::min(i1_begin + kTransposeCopyTileSize, outer_size);
+      for (int64_t i1 = i1_begin; i1 < i1_end; i1++) {
+        scalar_t* dst_row = dst + i1 * dst_outer_stride;
+        const scalar_t* src_col = src + i1;
+        for (int64_t i0 = i0_begin; i0 < i0_end; i0++) {
+          dst_row[i0] = src_col[i0 * src_inner_stride];
+        }
+      }
+    }
+  });
+}
+
+// Returns true if iter is a same-dtype 2-d copy where the output is
+// contiguous along the inner dimension and the input along the outer one,
+// i.e. a (possibly batched and coalesced) transposition.
+static bool is_transpose_copy(TensorIterator& iter) {
+  if (iter.ndim() != 2 || iter.ntensors() != 2) {
+    return false;
+  }
+  int64_t element_size = iter.element_size(0);
+  return iter.strides(0)[0] == element_size &&
+      iter.strides(0)[1] > element_size &&
+      iter.strides(1)[1] == element_size &&
+      iter.strides(1)[0] > element_size;
+}
+
+// The tiled copy only moves bytes, so dispatch on the element size rather
+// than the scalar type.
+static bool try_transpose_copy(TensorIterator& iter) {
+  if (!is_transpose_copy(iter)) {
+    return false;
+  }
+  int64_t element_size = iter.element_size(0);
+  if (iter.strides(0)[1] % element_size != 0 ||
+      iter.strides(1)[0] % element_size != 0) {
+    return false;
+  }
+  int64_t dst_outer_stride = iter.strides(0)[1] / element_size;
+  int64_t src_inner_stride = iter.strides(1)[0] / element_size;
+  int64_t inner_size = iter.shape()[0];
+  int64_t outer_size = iter.shape()[1];
+  void* dst = iter.data_ptr(0);
+  const void* src = iter.data_ptr(1);
+  switch (element_size) {
+    case 1:
+      transpose_copy_tiled(static_cast<uint8_t*>(dst), dst_outer_stride,
+          static_cast<const uint8_t*>(src), src_inner_stride, inner_size, outer_size);
+      return true;
+    case 2:
+      transpose_copy_tiled(static_cast<uint16_t*>(dst), dst_outer_stride,
+          static_cast<const uint16_t*>(src), src_inner_stride, inner_size, outer_size);
+      return true;
+    case 4:
+      transpose_copy_tiled(static_cast<uint32_t*>(dst), dst_outer_stride,
+          static_cast<const uint32_t*>(src), src_inner_stride, inner_size, outer_size);
+      return true;
+    case 8:
+      transpose_copy_tiled(static_cast<uint64_t*>(dst), dst_outer_stride,
+          static_cast<const uint64_t*>(src), src_inner_stride, inner_size, outer_size);
+      return true;
+    default:
+      return false;
+  }
+}
+
 static void copy_kernel(TensorIterator& iter, bool non_blocking) {
   ScalarType dtype = iter.dtype(0);
   if (dtype == iter.dtype(1)) {
+    if (try_transpose_copy(iter)) {
+      return;
+    }
     if (dtype == ScalarType::Half) {
       cpu_kernel(iter, [=](at::Half a) -> at::Half { return a; });
     } else if (dtype == ScalarType::BFloat16) {
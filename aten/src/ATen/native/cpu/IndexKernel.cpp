@@ -1,6 +1,7 @@
 #include <ATen/native/TensorAdvancedIndexing.h>
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <ATen/Dispatch.h>
 #include <ATen/native/TensorIterator.h>
@@ -58,9 +59,9 @@ static bool is_constant_index(int ntensor, const int64_t* strides) {
   return true;
 }
 
-template <typename scalar_t, typename func_t>
-void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
-                      const func_t& f, bool serial_execution=false)
+template <typename scalar_t, typename func_t, typename row_func_t>
+void cpu_index_kernel_with_row(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
+                      const func_t& f, const row_func_t& row_f, bool serial_execution=false)
 {
   int ntensor = iter.ntensors();
   // When launch the index parallel version, set a relative samll grain size less than the INTERNAL::GRAIN_SIZE
@@ -75,9 +76,9 @@ void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
       // specialization for when every element uses the same index
       int64_t offset = indexer.get(0);
       if (strides[0] == sizeof(scalar_t) && strides[1] == sizeof(scalar_t)) {
-        for (int64_t i = 0; i < n; i++) {
-          f(dst + strides[0] * i, src + strides[1] * i, offset);
-        }
+        // both sides are contiguous over the inner extent, so the whole row
+        // can be handled at once (e.g. as a single memcpy for gathers)
+        row_f(dst, src, offset, n);
       } else {
         for (int64_t i = 0; i < n; i++) {
           f(dst + strides[0] * i, src + strides[1] * i, offset);
@@ -97,11 +98,30 @@ void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
   }
 }
 
+// Convenience overload for callers without a dedicated row fast path: the
+// constant-index contiguous rows just run the elementwise functor.
+template <typename scalar_t, typename func_t>
+void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
+                      const func_t& f, bool serial_execution=false)
+{
+  cpu_index_kernel_with_row<scalar_t>(iter, index_size, index_stride, f,
+      [&](char* dst, char* src, int64_t offset, int64_t n) {
+        for (int64_t i = 0; i < n; i++) {
+          f(dst + sizeof(scalar_t) * i, src + sizeof(scalar_t) * i, offset);
+        }
+      }, serial_execution);
+}
+
 void index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride) {
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(at::ScalarType::Half, at::ScalarType::Bool, at::ScalarType::BFloat16,
     iter.dtype(), "index_cpu", [&] {
-    cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+    cpu_index_kernel_with_row<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
       *(scalar_t*)dst = *(scalar_t*)(src + offset);
+    },
+    // 1-d long-index gathers from contiguous matrices (tensor[index_vector])
+    // reduce to one memcpy per output row
+    [](char* dst, char* src, int64_t offset, int64_t n) {
+      memcpy(dst, src + offset, n * sizeof(scalar_t));
     });
   });
 }
@@ -124,8 +144,14 @@ void index_put_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
         }, /*serial_execution=*/true);
       }
     } else {
-      cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+      cpu_index_kernel_with_row<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
         *(scalar_t*)(dst + offset) = *(scalar_t*)src;
+      },
+      // contiguous row scatters (self[index_vector] = values) are likewise a
+      // single memcpy per row; duplicate indices write whole rows atomically
+      // with respect to each other only in the same sense as the scalar loop
+      [](char* dst, char* src, int64_t offset, int64_t n) {
+        memcpy(dst + offset, src, n * sizeof(scalar_t));
       });
     }
   });
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+/*
+  Fused pointwise stage of the LSTM cell (gate nonlinearities and state
+  update) for CPU float tensors
+*/
+
+namespace at {
+namespace native {
+
+using lstm_cell_pointwise_fn = void (*)(
+    Tensor& /* hy */,
+    Tensor& /* cy */,
+    const Tensor& /* gates */,
+    const Tensor& /* cx */);
+
+DECLARE_DISPATCH(lstm_cell_pointwise_fn, lstm_cell_pointwise_stub);
+
+} // namespace native
+} // namespace at
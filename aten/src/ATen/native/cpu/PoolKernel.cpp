@@ -0,0 +1,316 @@
+#include <ATen/ATen.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/Pool.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+#include <vector>
+
+namespace at {
+namespace native {
+namespace {
+
+// Channels-last 2d pooling. With NHWC layout the channel dimension is
+// innermost and contiguous, so each window position contributes a dense run
+// of `channels` elements and the reduction vectorizes across channels. All
+// window clamping runs once per output pixel (and the horizontal bounds once
+// per output column, shared by every row) instead of per element as in the
+// NCHW frame loops; parallelism is over (batch, output row).
+
+template <typename scalar_t>
+void cpu_avg_pool2d_channels_last(
+    Tensor& output,
+    const Tensor& input_,
+    int kW, int kH, int dW, int dH, int padW, int padH,
+    bool count_include_pad,
+    c10::optional<int64_t> divisor_override,
+    bool fuse_relu) {
+  using Vec = vec256::Vec256<scalar_t>;
+  auto input = input_.contiguous(at::MemoryFormat::ChannelsLast);
+
+  const int64_t nbatch = input.size(0);
+  const int64_t channels = input.size(1);
+  const int64_t input_height = input.size(2);
+  const int64_t input_width = input.size(3);
+  const int64_t output_height = output.size(2);
+  const int64_t output_width = output.size(3);
+
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  scalar_t* output_data = output.data_ptr<scalar_t>();
+
+  // Horizontal window bounds depend only on the output column; every row
+  // shares the same tables. wlen_padded keeps the pre-clamp width for
+  // count_include_pad, mirroring the NCHW frame's pool_size.
+  std::vector<int64_t> wstart(output_width);
+  std::vector<int64_t> wend(output_width);
+  std::vector<int64_t> wlen_padded(output_width);
+  for (int64_t ow = 0; ow < output_width; ow++) {
+    const int64_t ws = ow * dW - padW;
+    const int64_t we = std::min<int64_t>(ws + kW, input_width + padW);
+    wlen_padded[ow] = we - ws;
+    wstart[ow] = std::max<int64_t>(ws, 0);
+    wend[ow] = std::min<int64_t>(we, input_width);
+  }
+
+  at::parallel_for(
+      0,
+      nbatch * output_height,
+      std::max<int64_t>(
+          at::internal::GRAIN_SIZE / (output_width * channels * kW * kH), 1),
+      [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; index++) {
+      const int64_t n = index / output_height;
+      const int64_t oh = index % output_height;
+      const int64_t hs = oh * dH - padH;
+      const int64_t he = std::min<int64_t>(hs + kH, input_height + padH);
+      const int64_t hlen_padded = he - hs;
+      const int64_t hstart = std::max<int64_t>(hs, 0);
+      const int64_t hend = std::min<int64_t>(he, input_height);
+      scalar_t* out_row =
+          output_data + (n * output_height + oh) * output_width * channels;
+
+      for (int64_t ow = 0; ow < output_width; ow++) {
+        scalar_t* out = out_row + ow * channels;
+
+        int64_t divide_factor;
+        if (divisor_override.has_value()) {
+          divide_factor = divisor_override.value();
+        } else if (count_include_pad) {
+          divide_factor = hlen_padded * wlen_padded[ow];
+        } else {
+          divide_factor = (hend - hstart) * (wend[ow] - wstart[ow]);
+        }
+        const scalar_t divisor = static_cast<scalar_t>(divide_factor);
+
+        int64_t c = 0;
+        for (; c + Vec::size() <= channels; c += Vec::size()) {
+          Vec acc(0);
+          for (int64_t ky = hstart; ky < hend; ky++) {
+            const scalar_t* in_row =
+                input_data + ((n * input_height + ky) * input_width) * channels;
+            for (int64_t kx = wstart[ow]; kx < wend[ow]; kx++) {
+              acc = acc + Vec::loadu(in_row + kx * channels + c);
+            }
+          }
+          Vec result = acc / Vec(divisor);
+          if (fuse_relu) {
+            result = vec256::maximum(result, Vec(0));
+          }
+          result.store(out + c);
+        }
+        for (; c < channels; c++) {
+          scalar_t sum = 0;
+          for (int64_t ky = hstart; ky < hend; ky++) {
+            const scalar_t* in_row =
+                input_data + ((n * input_height + ky) * input_width) * channels;
+            for (int64_t kx = wstart[ow]; kx < wend[ow]; kx++) {
+              sum += in_row[kx * channels + c];
+            }
+          }
+          scalar_t result = sum / divisor;
+          if (fuse_relu) {
+            result = std::max(result, scalar_t(0));
+          }
+          out[c] = result;
+        }
+      }
+    }
+  });
+}
+
+template <typename scalar_t>
+void cpu_max_pool2d_channels_last(
+    Tensor& output,
+    Tensor& indices,
+    const Tensor& input_,
+    int kW, int kH, int dW, int dH, int padW, int padH,
+    int dilationW, int dilationH,
+    bool fuse_relu) {
+  using Vec = vec256::Vec256<scalar_t>;
+  auto input = input_.contiguous(at::MemoryFormat::ChannelsLast);
+
+  const int64_t nbatch = input.size(0);
+  const int64_t channels = input.size(1);
+  const int64_t input_height = input.size(2);
+  const int64_t input_width = input.size(3);
+  const int64_t output_height = output.size(2);
+  const int64_t output_width = output.size(3);
+
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  scalar_t* output_data = output.data_ptr<scalar_t>();
+  int64_t* indices_data = indices.data_ptr<int64_t>();
+
+  at::parallel_for(
+      0,
+      nbatch * output_height,
+      std::max<int64_t>(
+          at::internal::GRAIN_SIZE / (output_width * channels * kW * kH), 1),
+      [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; index++) {
+      const int64_t n = index / output_height;
+      const int64_t oh = index % output_height;
+      int64_t hstart = oh * dH - padH;
+      const int64_t hend = std::min<int64_t>(
+          hstart + (kH - 1) * dilationH + 1, input_height);
+      while (hstart < 0) {
+        hstart += dilationH;
+      }
+      scalar_t* out_row =
+          output_data + (n * output_height + oh) * output_width * channels;
+      int64_t* ind_row =
+          indices_data + (n * output_height + oh) * output_width * channels;
+
+      for (int64_t ow = 0; ow < output_width; ow++) {
+        int64_t wstart = ow * dW - padW;
+        const int64_t wend = std::min<int64_t>(
+            wstart + (kW - 1) * dilationW + 1, input_width);
+        while (wstart < 0) {
+          wstart += dilationW;
+        }
+        scalar_t* out = out_row + ow * channels;
+        int64_t* ind = ind_row + ow * channels;
+
+        int64_t c = 0;
+        for (; c + Vec::size() <= channels; c += Vec::size()) {
+          // Every channel at a given window position shares the same spatial
+          // index, so the candidate index vector is a broadcast; the argmax
+          // is tracked in scalar_t lanes (exact for the plane sizes the
+          // router admits) and widened to int64 on store.
+          Vec maxval(-std::numeric_limits<scalar_t>::infinity());
+          Vec maxindex(static_cast<scalar_t>(hstart * input_width + wstart));
+          for (int64_t ky = hstart; ky < hend; ky += dilationH) {
+            const scalar_t* in_row = input_data +
+                ((n * input_height + ky) * input_width) * channels;
+            for (int64_t kx = wstart; kx < wend; kx += dilationW) {
+              const Vec val = Vec::loadu(in_row + kx * channels + c);
+              const Vec mask = (val > maxval) | (val != val);
+              maxval = Vec::blendv(maxval, val, mask);
+              maxindex = Vec::blendv(
+                  maxindex,
+                  Vec(static_cast<scalar_t>(ky * input_width + kx)),
+                  mask);
+            }
+          }
+          if (fuse_relu) {
+            maxval = vec256::maximum(maxval, Vec(0));
+          }
+          maxval.store(out + c);
+          scalar_t index_buffer[Vec::size()];
+          maxindex.store(index_buffer);
+          for (int64_t l = 0; l < Vec::size(); l++) {
+            ind[c + l] = static_cast<int64_t>(index_buffer[l]);
+          }
+        }
+        for (; c < channels; c++) {
+          scalar_t maxval = -std::numeric_limits<scalar_t>::infinity();
+          int64_t maxindex = hstart * input_width + wstart;
+          for (int64_t ky = hstart; ky < hend; ky += dilationH) {
+            const scalar_t* in_row = input_data +
+                ((n * input_height + ky) * input_width) * channels;
+            for (int64_t kx = wstart; kx < wend; kx += dilationW) {
+              const scalar_t val = in_row[kx * channels + c];
+              if ((val > maxval) || std::isnan(val)) {
+                maxval = val;
+                maxindex = ky * input_width + kx;
+              }
+            }
+          }
+          out[c] = fuse_relu ? std::max(maxval, scalar_t(0)) : maxval;
+          ind[c] = maxindex;
+        }
+      }
+    }
+  });
+}
+
+template <typename scalar_t>
+void cpu_max_pool2d_backward_channels_last(
+    Tensor& grad_input,
+    const Tensor& grad_output_,
+    const Tensor& indices_) {
+  auto grad_output = grad_output_.contiguous(at::MemoryFormat::ChannelsLast);
+  auto indices = indices_.contiguous(at::MemoryFormat::ChannelsLast);
+
+  const int64_t nbatch = grad_input.size(0);
+  const int64_t channels = grad_input.size(1);
+  const int64_t input_height = grad_input.size(2);
+  const int64_t input_width = grad_input.size(3);
+  const int64_t output_height = grad_output.size(2);
+  const int64_t output_width = grad_output.size(3);
+
+  scalar_t* grad_input_data = grad_input.data_ptr<scalar_t>();
+  const scalar_t* grad_output_data = grad_output.data_ptr<scalar_t>();
+  const int64_t* indices_data = indices.data_ptr<int64_t>();
+
+  // Overlapping windows scatter into the same input pixels, so only the
+  // batch dimension is safe to parallelize, as in the NCHW frame.
+  at::parallel_for(0, nbatch, 0, [&](int64_t begin, int64_t end) {
+    for (int64_t n = begin; n < end; n++) {
+      scalar_t* grad_input_image =
+          grad_input_data + n * input_height * input_width * channels;
+      const int64_t image_offset = n * output_height * output_width * channels;
+      for (int64_t i = 0; i < output_height * output_width; i++) {
+        const scalar_t* go = grad_output_data + image_offset + i * channels;
+        const int64_t* ind = indices_data + image_offset + i * channels;
+        for (int64_t c = 0; c < channels; c++) {
+          grad_input_image[ind[c] * channels + c] += go[c];
+        }
+      }
+    }
+  });
+}
+
+void avg_pool2d_channels_last_kernel_impl(
+    Tensor& output,
+    const Tensor& input,
+    int kW, int kH, int dW, int dH, int padW, int padH,
+    bool count_include_pad,
+    c10::optional<int64_t> divisor_override,
+    bool fuse_relu) {
+  AT_DISPATCH_FLOATING_TYPES(
+      input.scalar_type(), "avg_pool2d_channels_last", [&] {
+        cpu_avg_pool2d_channels_last<scalar_t>(
+            output, input, kW, kH, dW, dH, padW, padH,
+            count_include_pad, divisor_override, fuse_relu);
+      });
+}
+
+void max_pool2d_channels_last_kernel_impl(
+    Tensor& output,
+    Tensor& indices,
+    const Tensor& input,
+    int kW, int kH, int dW, int dH, int padW, int padH,
+    int dilationW, int dilationH,
+    bool fuse_relu) {
+  AT_DISPATCH_FLOATING_TYPES(
+      input.scalar_type(), "max_pool2d_channels_last", [&] {
+        cpu_max_pool2d_channels_last<scalar_t>(
+            output, indices, input, kW, kH, dW, dH, padW, padH,
+            dilationW, dilationH, fuse_relu);
+      });
+}
+
+void max_pool2d_backward_channels_last_kernel_impl(
+    Tensor& grad_input,
+    const Tensor& grad_output,
+    const Tensor& indices) {
+  AT_DISPATCH_FLOATING_TYPES(
+      grad_output.scalar_type(), "max_pool2d_backward_channels_last", [&] {
+        cpu_max_pool2d_backward_channels_last<scalar_t>(
+            grad_input, grad_output, indices);
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(
+    avg_pool2d_channels_last_kernel, &avg_pool2d_channels_last_kernel_impl);
+REGISTER_DISPATCH(
+    max_pool2d_channels_last_kernel, &max_pool2d_channels_last_kernel_impl);
+REGISTER_DISPATCH(
+    max_pool2d_backward_channels_last_kernel,
+    &max_pool2d_backward_channels_last_kernel_impl);
+
+} // namespace native
+} // namespace at
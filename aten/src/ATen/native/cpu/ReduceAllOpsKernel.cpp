@@ -1,5 +1,8 @@
 #include<ATen/native/ReduceAllOps.h>
 
+#include <array>
+#include <utility>
+
 #include <ATen/Dispatch.h>
 #include <ATen/Parallel.h>
 #include <ATen/native/SharedReduceOps.h>
@@ -58,6 +61,90 @@ inline void reduce_all_impl(
   output.fill_(result);
 }
 
+// Fused multi-output reduction: every functor pair sees each element once,
+// so k reductions over the same tensor stream the data from memory a single
+// time instead of k times.
+template <typename scalar_t, typename func_t1, typename func_t2>
+inline void reduce_all_impl_two_outputs(
+    Tensor& output1,
+    Tensor& output2,
+    const Tensor& input,
+    const std::pair<scalar_t, scalar_t>& ident_v,
+    func_t1 op1,
+    func_t2 op2) {
+  using scalar_pair = std::pair<scalar_t, scalar_t>;
+  const int64_t input_numel = input.numel();
+  auto input_data = input.data_ptr<scalar_t>();
+  scalar_pair result = at::parallel_reduce(0, input_numel, internal::GRAIN_SIZE, ident_v,
+    [&](int64_t start, int64_t end, const scalar_pair& ident) -> scalar_pair {
+      scalar_t partial_out1 = ident.first;
+      scalar_t partial_out2 = ident.second;
+      for (int64_t i = start; i < end; i++) {
+        partial_out1 = op1(partial_out1, input_data[i]);
+        partial_out2 = op2(partial_out2, input_data[i]);
+      }
+      return scalar_pair(partial_out1, partial_out2);
+    },
+    [&](scalar_pair a, scalar_pair b) -> scalar_pair {
+      return scalar_pair(op1(a.first, b.first), op2(a.second, b.second));
+    });
+  output1.fill_(result.first);
+  output2.fill_(result.second);
+}
+
+template <typename scalar_t, typename func_t1, typename vec_func_t1,
+          typename func_t2, typename vec_func_t2>
+inline void reduce_all_impl_vec_two_outputs(
+    Tensor& output1,
+    Tensor& output2,
+    const Tensor& input,
+    const std::pair<scalar_t, scalar_t>& ident_v,
+    func_t1 op1,
+    vec_func_t1 vop1,
+    func_t2 op2,
+    vec_func_t2 vop2) {
+  using Vec = Vec256<scalar_t>;
+  using scalar_pair = std::pair<scalar_t, scalar_t>;
+  const int64_t input_numel = input.numel();
+  auto input_data = input.data_ptr<scalar_t>();
+  scalar_pair result = at::parallel_reduce(0, input_numel, internal::GRAIN_SIZE, ident_v,
+    [&](int64_t start, int64_t end, const scalar_pair& ident) -> scalar_pair {
+      int64_t size = end - start;
+      const scalar_t* data = input_data + start;
+      scalar_t partial_out1 = ident.first;
+      scalar_t partial_out2 = ident.second;
+      if (size < Vec::size()) {
+        for (int64_t i = 0; i < size; i++) {
+          partial_out1 = op1(partial_out1, data[i]);
+          partial_out2 = op2(partial_out2, data[i]);
+        }
+        return scalar_pair(partial_out1, partial_out2);
+      }
+      Vec acc_vec1 = Vec::loadu(data);
+      Vec acc_vec2 = acc_vec1;
+      int64_t d = Vec::size();
+      for (; d < size - (size % Vec::size()); d += Vec::size()) {
+        Vec data_vec = Vec::loadu(data + d);
+        acc_vec1 = vop1(acc_vec1, data_vec);
+        acc_vec2 = vop2(acc_vec2, data_vec);
+      }
+      partial_out1 = op1(partial_out1, vec_reduce_all(
+          [&](Vec x, Vec y) { return vop1(x, y); }, acc_vec1, Vec::size()));
+      partial_out2 = op2(partial_out2, vec_reduce_all(
+          [&](Vec x, Vec y) { return vop2(x, y); }, acc_vec2, Vec::size()));
+      for (; d < size; d++) {
+        partial_out1 = op1(partial_out1, data[d]);
+        partial_out2 = op2(partial_out2, data[d]);
+      }
+      return scalar_pair(partial_out1, partial_out2);
+    },
+    [&](scalar_pair a, scalar_pair b) -> scalar_pair {
+      return scalar_pair(op1(a.first, b.first), op2(a.second, b.second));
+    });
+  output1.fill_(result.first);
+  output2.fill_(result.second);
+}
+
 static void min_all_kernel_impl(Tensor& result, const Tensor& input) {
   if (input.scalar_type() == ScalarType::Bool) {
     TensorIterator iter = TensorIterator();
@@ -108,9 +195,102 @@ static void max_all_kernel_impl(Tensor& result, const Tensor& input) {
   }
 }
 
+static void min_max_all_kernel_impl(Tensor& min_result, Tensor& max_result,
+    const Tensor& input) {
+  if (input.scalar_type() == ScalarType::Bool) {
+    TensorIterator iter = TensorIterator();
+    iter.add_input(input);
+    iter.build();
+    bool min_data = true;
+    bool max_data = false;
+    cpu_serial_kernel(iter, [&](const bool a) -> void {
+      min_data = min_data && a;
+      max_data = max_data || a;
+    });
+    min_result.fill_(min_data);
+    max_result.fill_(max_data);
+  } else if (input.scalar_type() == ScalarType::Long) {
+    // for int64_t, vectorized implementation have performance issue,
+    // just use scalar path
+    reduce_all_impl_two_outputs<int64_t>(min_result, max_result, input,
+      std::pair<int64_t, int64_t>(upper_bound<int64_t>(), lower_bound<int64_t>()),
+      [=](int64_t a, int64_t b) -> int64_t { return min_impl(a, b); },
+      [=](int64_t a, int64_t b) -> int64_t { return max_impl(a, b); });
+  } else {
+    AT_DISPATCH_ALL_TYPES(input.scalar_type(), "min_max_all", [&] {
+      using Vec = vec256::Vec256<scalar_t>;
+      reduce_all_impl_vec_two_outputs<scalar_t>(min_result, max_result, input,
+        std::pair<scalar_t, scalar_t>(upper_bound<scalar_t>(), lower_bound<scalar_t>()),
+        [=] (scalar_t a , scalar_t b) -> scalar_t { return min_impl(a, b); },
+        [=](Vec a, Vec b) -> Vec { return minimum(a, b); },
+        [=] (scalar_t a , scalar_t b) -> scalar_t { return max_impl(a, b); },
+        [=](Vec a, Vec b) -> Vec { return maximum(a, b); });
+    });
+  }
+}
+
+static void reduction_stats_kernel_impl(Tensor& sum_result, Tensor& sum_sq_result,
+    Tensor& min_result, Tensor& max_result, const Tensor& input) {
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "reduction_stats_cpu", [&] {
+    using Vec = Vec256<scalar_t>;
+    // (sum, sum_sq, min, max) accumulated in a single sweep
+    using stats_t = std::array<scalar_t, 4>;
+    const int64_t input_numel = input.numel();
+    auto input_data = input.data_ptr<scalar_t>();
+    stats_t ident = {scalar_t(0), scalar_t(0),
+        upper_bound<scalar_t>(), lower_bound<scalar_t>()};
+    auto combine = [](stats_t a, stats_t b) -> stats_t {
+      return {a[0] + b[0], a[1] + b[1],
+          min_impl(a[2], b[2]), max_impl(a[3], b[3])};
+    };
+    stats_t result = at::parallel_reduce(0, input_numel, internal::GRAIN_SIZE, ident,
+      [&](int64_t start, int64_t end, const stats_t& ident_v) -> stats_t {
+        int64_t size = end - start;
+        const scalar_t* data = input_data + start;
+        stats_t partial = ident_v;
+        int64_t d = 0;
+        if (size >= Vec::size()) {
+          Vec acc_sum = Vec(scalar_t(0));
+          Vec acc_sum_sq = Vec(scalar_t(0));
+          Vec acc_min = Vec::loadu(data);
+          Vec acc_max = acc_min;
+          for (; d < size - (size % Vec::size()); d += Vec::size()) {
+            Vec data_vec = Vec::loadu(data + d);
+            acc_sum = acc_sum + data_vec;
+            acc_sum_sq = vec256::fmadd(data_vec, data_vec, acc_sum_sq);
+            acc_min = minimum(acc_min, data_vec);
+            acc_max = maximum(acc_max, data_vec);
+          }
+          partial[0] += vec_reduce_all(
+              [](Vec x, Vec y) { return x + y; }, acc_sum, Vec::size());
+          partial[1] += vec_reduce_all(
+              [](Vec x, Vec y) { return x + y; }, acc_sum_sq, Vec::size());
+          partial[2] = min_impl(partial[2], vec_reduce_all(
+              [](Vec x, Vec y) { return minimum(x, y); }, acc_min, Vec::size()));
+          partial[3] = max_impl(partial[3], vec_reduce_all(
+              [](Vec x, Vec y) { return maximum(x, y); }, acc_max, Vec::size()));
+        }
+        for (; d < size; d++) {
+          scalar_t a = data[d];
+          partial[0] += a;
+          partial[1] += a * a;
+          partial[2] = min_impl(partial[2], a);
+          partial[3] = max_impl(partial[3], a);
+        }
+        return partial;
+      }, combine);
+    sum_result.fill_(result[0]);
+    sum_sq_result.fill_(result[1]);
+    min_result.fill_(result[2]);
+    max_result.fill_(result[3]);
+  });
+}
+
 } // namespace
 
 REGISTER_DISPATCH(min_all_stub, &min_all_kernel_impl);
 REGISTER_DISPATCH(max_all_stub, &max_all_kernel_impl);
+REGISTER_DISPATCH(min_max_all_stub, &min_max_all_kernel_impl);
+REGISTER_DISPATCH(reduction_stats_stub, &reduction_stats_kernel_impl);
 
 }}
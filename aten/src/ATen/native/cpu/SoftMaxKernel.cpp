@@ -184,6 +184,101 @@ inline void _vec_host_softmax_backward_lastdim(
       });
 }
 
+template <typename scalar_t>
+inline void _vec_softmax_cross_entropy(
+    scalar_t* loss_data,
+    scalar_t* lse_data,
+    scalar_t* input_data_base,
+    int64_t* target_data,
+    int64_t outer_size,
+    int64_t dim_size,
+    double label_smoothing) {
+  using Vec = vec256::Vec256<scalar_t>;
+  scalar_t smoothing = static_cast<scalar_t>(label_smoothing);
+  int64_t grain_size = internal::GRAIN_SIZE / (16 * dim_size);
+  if (grain_size < 1)
+    grain_size = 1;
+
+  parallel_for(
+      0,
+      outer_size,
+      grain_size,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+          scalar_t* input_data = input_data_base + i * dim_size;
+          int64_t target = target_data[i];
+          TORCH_CHECK(
+              target >= 0 && target < dim_size,
+              "Target ", target, " is out of bounds.");
+          scalar_t max_input = vec256::reduce_all<scalar_t>(
+              [](Vec& x, Vec& y) { return vec256::maximum(x, y); },
+              input_data,
+              dim_size);
+          scalar_t tmp_sum = vec256::map_reduce_all<scalar_t>(
+              [max_input](Vec x) { return (x - Vec(max_input)).exp(); },
+              [](Vec x, Vec y) { return x + y; },
+              input_data,
+              dim_size);
+          // See [Note AVX-SSE transitions] for why this should call the
+          // vectorized version.
+          vec256::map([](Vec x) { return x.log(); }, &tmp_sum, &tmp_sum, 1);
+          scalar_t lse = max_input + tmp_sum;
+          lse_data[i] = lse;
+          // With smoothing eps, the target distribution mixes (1 - eps) on
+          // the target class with eps spread uniformly, so the loss is
+          //   lse - (1 - eps) * x[target] - eps * mean(x).
+          scalar_t loss = lse - (1 - smoothing) * input_data[target];
+          if (smoothing != static_cast<scalar_t>(0)) {
+            scalar_t sum_input = vec256::reduce_all<scalar_t>(
+                [](Vec& x, Vec& y) { return x + y; }, input_data, dim_size);
+            loss -= smoothing * sum_input / static_cast<scalar_t>(dim_size);
+          }
+          loss_data[i] = loss;
+        }
+      });
+}
+
+template <typename scalar_t>
+inline void _vec_softmax_cross_entropy_backward(
+    scalar_t* grad_input_data_base,
+    scalar_t* grad_data,
+    scalar_t* input_data_base,
+    int64_t* target_data,
+    scalar_t* lse_data,
+    int64_t outer_size,
+    int64_t dim_size,
+    double label_smoothing) {
+  using Vec = vec256::Vec256<scalar_t>;
+  scalar_t smoothing = static_cast<scalar_t>(label_smoothing);
+  int64_t grain_size = internal::GRAIN_SIZE / (16 * dim_size);
+  if (grain_size < 1)
+    grain_size = 1;
+
+  parallel_for(
+      0,
+      outer_size,
+      grain_size,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+          scalar_t* grad_input_data = grad_input_data_base + i * dim_size;
+          scalar_t* input_data = input_data_base + i * dim_size;
+          scalar_t g = grad_data[i];
+          scalar_t lse = lse_data[i];
+          // d loss / d x[j] = softmax(x)[j] - ((1 - eps) * [j == target]
+          //                                   + eps / dim_size)
+          scalar_t uniform = g * smoothing / static_cast<scalar_t>(dim_size);
+          vec256::map(
+              [g, lse, uniform](Vec x) {
+                return (x - Vec(lse)).exp() * Vec(g) - Vec(uniform);
+              },
+              grad_input_data,
+              input_data,
+              dim_size);
+          grad_input_data[target_data[i]] -= g * (1 - smoothing);
+        }
+      });
+}
+
 template <typename scalar_t, bool LogSoftMax>
 struct vec_host_softmax_lastdim {
   static void apply(Tensor& output, const Tensor& input) {
@@ -261,9 +356,55 @@ static void log_softmax_backward_lastdim_kernel_impl(
       });
 }
 
+static void softmax_cross_entropy_kernel_impl(
+    Tensor& loss,
+    Tensor& logsumexp,
+    const Tensor& self,
+    const Tensor& target,
+    double label_smoothing) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self.scalar_type(), "softmax_cross_entropy_kernel_impl", [&] {
+        _vec_softmax_cross_entropy<scalar_t>(
+            loss.data_ptr<scalar_t>(),
+            logsumexp.data_ptr<scalar_t>(),
+            self.data_ptr<scalar_t>(),
+            target.data_ptr<int64_t>(),
+            self.size(0),
+            self.size(1),
+            label_smoothing);
+      });
+}
+
+static void softmax_cross_entropy_backward_kernel_impl(
+    Tensor& grad_input,
+    const Tensor& grad,
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    double label_smoothing) {
+  AT_DISPATCH_FLOATING_TYPES(
+      grad.scalar_type(), "softmax_cross_entropy_backward_kernel_impl", [&] {
+        _vec_softmax_cross_entropy_backward<scalar_t>(
+            grad_input.data_ptr<scalar_t>(),
+            grad.data_ptr<scalar_t>(),
+            self.data_ptr<scalar_t>(),
+            target.data_ptr<int64_t>(),
+            logsumexp.data_ptr<scalar_t>(),
+            self.size(0),
+            self.size(1),
+            label_smoothing);
+      });
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(softmax_lastdim_kernel, &softmax_lastdim_kernel_impl);
+REGISTER_DISPATCH(
+    softmax_cross_entropy_kernel,
+    &softmax_cross_entropy_kernel_impl);
+REGISTER_DISPATCH(
+    softmax_cross_entropy_backward_kernel,
+    &softmax_cross_entropy_backward_kernel_impl);
 REGISTER_DISPATCH(log_softmax_lastdim_kernel, &log_softmax_lastdim_kernel_impl);
 REGISTER_DISPATCH(
     softmax_backward_lastdim_kernel,
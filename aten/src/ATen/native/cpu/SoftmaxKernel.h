@@ -14,5 +14,21 @@ DECLARE_DISPATCH(forward_fn, log_softmax_lastdim_kernel);
 DECLARE_DISPATCH(backward_fn, softmax_backward_lastdim_kernel);
 DECLARE_DISPATCH(backward_fn, log_softmax_backward_lastdim_kernel);
 
+// Fused softmax + cross-entropy with label smoothing (see
+// native/LossSoftmaxCrossEntropy.cpp). Never materializes the [N, C]
+// log-probability tensor: the forward keeps only per-row losses and
+// log-sum-exps, and the backward writes grad_input directly.
+//
+// forward: (loss, logsumexp, input, target, label_smoothing)
+// backward: (grad_input, grad, input, target, logsumexp, label_smoothing)
+using xentropy_forward_fn =
+    void(*)(Tensor &, Tensor &, const Tensor &, const Tensor &, double);
+using xentropy_backward_fn = void(*)(
+    Tensor &, const Tensor &, const Tensor &, const Tensor &, const Tensor &,
+    double);
+
+DECLARE_DISPATCH(xentropy_forward_fn, softmax_cross_entropy_kernel);
+DECLARE_DISPATCH(xentropy_backward_fn, softmax_cross_entropy_backward_kernel);
+
 }
 }
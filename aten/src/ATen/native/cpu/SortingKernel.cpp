@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
 #include <ATen/Parallel.h>
@@ -9,6 +15,94 @@ namespace at { namespace native {
 
 namespace {
 
+// Parallel selection for the "one huge slice" topk case (e.g. ranking a
+// flat vector of retrieval scores). dim_apply already spreads many small
+// slices across threads, but a single large slice runs one sequential
+// partial sort. Here every thread selects the top k of its own block with
+// nth_element and the per-block winners are merged with one final
+// selection over num_blocks * k candidates.
+template <typename scalar_t>
+bool try_parallel_topk_1d(
+    Tensor& values,
+    Tensor& indices,
+    const Tensor& self,
+    int64_t k,
+    bool largest,
+    bool sorted) {
+  if (self.dim() != 1 || k == 0) {
+    return false;
+  }
+  int64_t n = self.size(0);
+  const int64_t min_block = std::max(k, internal::GRAIN_SIZE);
+  int64_t num_blocks = std::min<int64_t>(at::get_num_threads(), n / min_block);
+  if (num_blocks < 2 || 2 * k > n) {
+    return false;
+  }
+  int64_t block_size = divup(n, num_blocks);
+
+  auto input = self.accessor<scalar_t, 1>();
+  auto out_values = values.accessor<scalar_t, 1>();
+  auto out_indices = indices.accessor<int64_t, 1>();
+
+  using elem_t = std::pair<scalar_t, int64_t>;
+  // we want NaN to be sorted as top for numpy compatibility, matching the
+  // comparators in the slice kernel below
+  auto comp = [largest](const elem_t& x, const elem_t& y) -> bool {
+    if (largest) {
+      return (_isnan<scalar_t>(x.first) && !_isnan<scalar_t>(y.first)) ||
+          (x.first > y.first);
+    }
+    return (!_isnan<scalar_t>(x.first) && _isnan<scalar_t>(y.first)) ||
+        (x.first < y.first);
+  };
+
+  std::vector<elem_t> candidates(num_blocks * k);
+  std::vector<int64_t> counts(num_blocks);
+  at::parallel_for(0, num_blocks, 1, [&](int64_t block_begin, int64_t block_end) {
+    std::vector<elem_t> block;
+    for (int64_t b = block_begin; b < block_end; b++) {
+      int64_t begin = b * block_size;
+      int64_t end = std::min(n, begin + block_size);
+      block.resize(end - begin);
+      for (int64_t i = begin; i < end; i++) {
+        block[i - begin].first = input[i];
+        block[i - begin].second = i;
+      }
+      int64_t local_k = std::min<int64_t>(k, block.size());
+      if (local_k < (int64_t)block.size()) {
+        std::nth_element(
+            block.begin(), block.begin() + local_k - 1, block.end(), comp);
+      }
+      std::copy(block.begin(), block.begin() + local_k,
+          candidates.begin() + b * k);
+      counts[b] = local_k;
+    }
+  });
+
+  // compact away the short tail block, then select the global top k; like
+  // the sequential kernel, the first k entries are unordered unless sorted
+  int64_t total = 0;
+  for (int64_t b = 0; b < num_blocks; b++) {
+    if (total != b * k) {
+      std::copy(candidates.begin() + b * k,
+          candidates.begin() + b * k + counts[b], candidates.begin() + total);
+    }
+    total += counts[b];
+  }
+  if (k < total) {
+    std::nth_element(candidates.begin(), candidates.begin() + k - 1,
+        candidates.begin() + total, comp);
+  }
+  if (sorted) {
+    std::sort(candidates.begin(), candidates.begin() + k, comp);
+  }
+  for (int64_t j = 0; j < k; j++) {
+    out_values[j] = candidates[j].first;
+    out_indices[j] = candidates[j].second;
+  }
+  return true;
+}
+
 static void topk_kernel(
     Tensor& values,
     Tensor& indices,
@@ -18,6 +112,9 @@ static void topk_kernel(
     bool largest,
     bool sorted) {
   AT_DISPATCH_ALL_TYPES(self.scalar_type(), "topk_cpu", [&] {
+    if (try_parallel_topk_1d<scalar_t>(values, indices, self, k, largest, sorted)) {
+      return;
+    }
     dim_apply(
         {self, values, indices},
         dim,
@@ -83,8 +180,172 @@ static void topk_kernel(
   });
 }
 
+// Parallel LSD radix sort over (key, index) pairs.
+//
+// Keys are first mapped to an unsigned representation whose natural order
+// matches the source type's order (sign-bit flip for signed integers, the
+// usual total-order transform for IEEE floats, NaN sorting last to match the
+// comparison sorts). Each 8-bit digit pass builds per-chunk histograms in
+// parallel, does a small serial scan over chunks x buckets, and scatters in
+// parallel -- every chunk owns disjoint destination ranges, which also keeps
+// the sort stable. Descending order just complements the key mapping, so it
+// stays a single stable ascending machine.
+
+template <typename scalar_t>
+struct RadixSortKey {
+  static_assert(std::is_integral<scalar_t>::value, "expected integral type");
+  using key_t = typename std::make_unsigned<scalar_t>::type;
+  static key_t encode(scalar_t v) {
+    constexpr key_t sign_bit = static_cast<key_t>(1) << (8 * sizeof(key_t) - 1);
+    return std::is_signed<scalar_t>::value
+        ? static_cast<key_t>(v) ^ sign_bit
+        : static_cast<key_t>(v);
+  }
+  static scalar_t decode(key_t k) {
+    constexpr key_t sign_bit = static_cast<key_t>(1) << (8 * sizeof(key_t) - 1);
+    return std::is_signed<scalar_t>::value
+        ? static_cast<scalar_t>(k ^ sign_bit)
+        : static_cast<scalar_t>(k);
+  }
+};
+
+template <>
+struct RadixSortKey<float> {
+  using key_t = uint32_t;
+  static key_t encode(float v) {
+    key_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+  }
+  static float decode(key_t k) {
+    key_t bits = (k & 0x80000000u) ? (k & ~0x80000000u) : ~k;
+    float v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+  }
+};
+
+template <>
+struct RadixSortKey<double> {
+  using key_t = uint64_t;
+  static key_t encode(double v) {
+    key_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+  }
+  static double decode(key_t k) {
+    key_t bits = (k & 0x8000000000000000ull) ? (k & ~0x8000000000000000ull) : ~k;
+    double v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+  }
+};
+
+template <typename scalar_t>
+void radix_sort_1d(scalar_t* values, int64_t* indices, const scalar_t* input,
+    int64_t n, bool descending) {
+  using key_t = typename RadixSortKey<scalar_t>::key_t;
+  constexpr int kRadixBits = 8;
+  constexpr int kRadixSize = 1 << kRadixBits;
+  constexpr int kNumPasses = sizeof(key_t);
+
+  int num_chunks = std::max(1, std::min<int>(at::get_num_threads(),
+      static_cast<int>(n / internal::GRAIN_SIZE) + 1));
+  int64_t chunk_size = divup(n, num_chunks);
+
+  std::vector<key_t> keys(n);
+  std::vector<key_t> keys_tmp(n);
+  std::vector<int64_t> idx(n);
+  std::vector<int64_t> idx_tmp(n);
+
+  at::parallel_for(0, n, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      key_t k = RadixSortKey<scalar_t>::encode(input[i]);
+      keys[i] = descending ? static_cast<key_t>(~k) : k;
+      idx[i] = i;
+    }
+  });
+
+  key_t* src_keys = keys.data();
+  key_t* dst_keys = keys_tmp.data();
+  int64_t* src_idx = idx.data();
+  int64_t* dst_idx = idx_tmp.data();
+
+  std::vector<std::array<int64_t, kRadixSize>> chunk_counts(num_chunks);
+  for (int pass = 0; pass < kNumPasses; pass++) {
+    const int shift = pass * kRadixBits;
+    at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+      for (int64_t c = chunk_begin; c < chunk_end; c++) {
+        auto& counts = chunk_counts[c];
+        counts.fill(0);
+        int64_t begin = c * chunk_size;
+        int64_t end = std::min(begin + chunk_size, n);
+        for (int64_t i = begin; i < end; i++) {
+          counts[(src_keys[i] >> shift) & (kRadixSize - 1)]++;
+        }
+      }
+    });
+    // exclusive scan over (bucket, chunk) to give every chunk disjoint
+    // destination ranges; also detects single-bucket passes, which are
+    // no-ops (common for the high bytes of small-magnitude data)
+    int64_t total = 0;
+    bool single_bucket = false;
+    for (int bucket = 0; bucket < kRadixSize; bucket++) {
+      for (int c = 0; c < num_chunks; c++) {
+        int64_t count = chunk_counts[c][bucket];
+        chunk_counts[c][bucket] = total;
+        total += count;
+        if (count == n) {
+          single_bucket = true;
+        }
+      }
+    }
+    if (single_bucket) {
+      continue;
+    }
+    at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+      for (int64_t c = chunk_begin; c < chunk_end; c++) {
+        auto& offsets = chunk_counts[c];
+        int64_t begin = c * chunk_size;
+        int64_t end = std::min(begin + chunk_size, n);
+        for (int64_t i = begin; i < end; i++) {
+          int64_t dst = offsets[(src_keys[i] >> shift) & (kRadixSize - 1)]++;
+          dst_keys[dst] = src_keys[i];
+          dst_idx[dst] = src_idx[i];
+        }
+      }
+    });
+    std::swap(src_keys, dst_keys);
+    std::swap(src_idx, dst_idx);
+  }
+
+  at::parallel_for(0, n, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      key_t k = descending ? static_cast<key_t>(~src_keys[i]) : src_keys[i];
+      values[i] = RadixSortKey<scalar_t>::decode(k);
+      indices[i] = src_idx[i];
+    }
+  });
+}
+
+static void radix_sort_kernel(
+    Tensor& values,
+    Tensor& indices,
+    const Tensor& self,
+    bool descending) {
+  AT_DISPATCH_ALL_TYPES(self.scalar_type(), "radix_sort_cpu", [&] {
+    radix_sort_1d<scalar_t>(
+        values.data_ptr<scalar_t>(),
+        indices.data_ptr<int64_t>(),
+        self.data_ptr<scalar_t>(),
+        self.numel(),
+        descending);
+  });
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(topk_stub, &topk_kernel);
+REGISTER_DISPATCH(radix_sort_stub, &radix_sort_kernel);
 
 }} //at::native
@@ -3,6 +3,7 @@
 #include <ATen/Dispatch.h>
 #include <ATen/native/UpSample.h>
 #include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
 
 namespace at {
 namespace native {
@@ -233,6 +234,118 @@ void cpu_upsample_nearest_channels_last(
   }
 }
 
+template <typename scalar_t, typename scale_type>
+void cpu_upsample_bilinear_channels_last(
+    Tensor& output_,
+    const Tensor& input_,
+    bool align_corners,
+    const scale_type& scales) {
+  TORCH_CHECK(input_.dtype() == output_.dtype(), "expected dtype ", input_.dtype(),
+              " for `output` but got dtype ", output_.dtype());
+
+  auto input_sizes = input_.sizes().vec();
+  auto output_sizes = output_.sizes().vec();
+  TORCH_CHECK(input_sizes.size() == 4, "Bilinear upsample with NHWC format supports tensors with 4 dims.")
+
+  auto channels_last_memory_format = at::MemoryFormat::ChannelsLast;
+  auto input = input_.contiguous(channels_last_memory_format);
+  auto output = output_.contiguous(channels_last_memory_format);
+
+  auto input_data = input.data_ptr<scalar_t>();
+  auto output_data = output.data_ptr<scalar_t>();
+
+  int64_t num_batches = input_sizes[0];
+  int64_t channels = input_sizes[1];
+  int64_t input_height = input_sizes[2];
+  int64_t input_width = input_sizes[3];
+  int64_t output_height = output_sizes[2];
+  int64_t output_width = output_sizes[3];
+
+  using Vec = vec256::Vec256<scalar_t>;
+
+  const scalar_t rheight = area_pixel_compute_scale<scalar_t>(
+      input_height, output_height, align_corners, scales[0]);
+  const scalar_t rwidth = area_pixel_compute_scale<scalar_t>(
+      input_width, output_width, align_corners, scales[1]);
+
+  // The horizontal source offsets and interpolation weights depend only on
+  // the output column, so compute them once up front; every output row
+  // shares the same tables.
+  std::vector<int64_t> iw0(output_width);
+  std::vector<int64_t> iw1(output_width);
+  std::vector<scalar_t> w0lambda(output_width);
+  std::vector<scalar_t> w1lambda(output_width);
+  for (int64_t ow = 0; ow < output_width; ow++) {
+    const scalar_t w1r = area_pixel_compute_source_index<scalar_t>(
+        rwidth, ow, align_corners, /*cubic=*/false);
+    const int64_t w1 = w1r;
+    const int64_t w1p = (w1 < input_width - 1) ? 1 : 0;
+    iw0[ow] = w1 * channels;
+    iw1[ow] = (w1 + w1p) * channels;
+    w1lambda[ow] = w1r - w1;
+    w0lambda[ow] = static_cast<scalar_t>(1.) - w1lambda[ow];
+  }
+
+  // With channels innermost, the four taps of an output pixel are contiguous
+  // runs of `channels` elements, so the blend vectorizes along the channel
+  // dimension; parallelism is over output rows.
+  at::parallel_for(
+      0,
+      num_batches * output_height,
+      std::max<int64_t>(at::internal::GRAIN_SIZE / (output_width * channels), 1),
+      [&](int64_t begin, int64_t end) {
+    int64_t n = 0;
+    int64_t oh = 0;
+    data_index_init(begin, n, num_batches, oh, output_height);
+
+    for (int64_t i = begin; i < end; i++) {
+      const scalar_t h1r = area_pixel_compute_source_index<scalar_t>(
+          rheight, oh, align_corners, /*cubic=*/false);
+      const int64_t h1 = h1r;
+      const int64_t h1p = (h1 < input_height - 1) ? 1 : 0;
+      const scalar_t h1lambda = h1r - h1;
+      const scalar_t h0lambda = static_cast<scalar_t>(1.) - h1lambda;
+
+      const scalar_t* row0 = input_data +
+          (n * input_height + h1) * input_width * channels;
+      const scalar_t* row1 = row0 + h1p * input_width * channels;
+      scalar_t* out_row = output_data +
+          (n * output_height + oh) * output_width * channels;
+
+      for (int64_t ow = 0; ow < output_width; ow++) {
+        const scalar_t* p00 = row0 + iw0[ow];
+        const scalar_t* p01 = row0 + iw1[ow];
+        const scalar_t* p10 = row1 + iw0[ow];
+        const scalar_t* p11 = row1 + iw1[ow];
+        scalar_t* out = out_row + ow * channels;
+
+        const Vec v00(h0lambda * w0lambda[ow]);
+        const Vec v01(h0lambda * w1lambda[ow]);
+        const Vec v10(h1lambda * w0lambda[ow]);
+        const Vec v11(h1lambda * w1lambda[ow]);
+
+        int64_t c = 0;
+        for (; c + Vec::size() <= channels; c += Vec::size()) {
+          Vec acc = Vec::loadu(p00 + c) * v00;
+          acc = vec256::fmadd(Vec::loadu(p01 + c), v01, acc);
+          acc = vec256::fmadd(Vec::loadu(p10 + c), v10, acc);
+          acc = vec256::fmadd(Vec::loadu(p11 + c), v11, acc);
+          acc.store(out + c);
+        }
+        for (; c < channels; c++) {
+          out[c] = h0lambda * (w0lambda[ow] * p00[c] + w1lambda[ow] * p01[c]) +
+              h1lambda * (w0lambda[ow] * p10[c] + w1lambda[ow] * p11[c]);
+        }
+      }
+      data_index_step(n, num_batches, oh, output_height);
+    }
+  });
+
+  if (!output_.is_contiguous(channels_last_memory_format)) {
+    output_.copy_(output);
+  }
+}
+
 template <typename scalar_t, typename scale_type>
 void cpu_upsample_nearest_backward(
     Tensor& grad_input_,
@@ -367,6 +480,17 @@ void upsample_nearest3d_kernel_impl(
   }
 }
 
+void upsample_bilinear2d_kernel_impl(
+    Tensor& output,
+    const Tensor& input,
+    bool align_corners,
+    c10::optional<double> scales_h,
+    c10::optional<double> scales_w) {
+  AT_DISPATCH_FLOATING_TYPES_AND_HALF(input.scalar_type(), "upsample_bilinear2d_channels_last", [&] {
+    cpu_upsample_bilinear_channels_last<scalar_t, scale_t>(output, input, align_corners, {scales_h, scales_w});
+  });
+}
+
 void upsample_nearest1d_backward_kernel_impl(
     Tensor& grad_input,
     const Tensor& grad_output,
@@ -406,6 +530,7 @@ REGISTER_DISPATCH(upsample_nearest3d_kernel, &upsample_nearest3d_kernel_impl);
 REGISTER_DISPATCH(upsample_nearest1d_backward_kernel, &upsample_nearest1d_backward_kernel_impl);
 REGISTER_DISPATCH(upsample_nearest2d_backward_kernel, &upsample_nearest2d_backward_kernel_impl);
 REGISTER_DISPATCH(upsample_nearest3d_backward_kernel, &upsample_nearest3d_backward_kernel_impl);
+REGISTER_DISPATCH(upsample_bilinear2d_kernel, &upsample_bilinear2d_kernel_impl);
 
 } // namespace native
 } // namespace at
@@ -0,0 +1,181 @@
+#include <ATen/native/cpu/Winograd3x3Kernel.h>
+
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+namespace at {
+namespace native {
+namespace {
+
+// Winograd F(2x2, 3x3): each 2x2 output tile costs a 16-element elementwise
+// product per input channel instead of the 4 * 9 = 36 multiplies of direct
+// convolution — a 2.25x arithmetic reduction. Transform matrices:
+//
+//   B^T = [1  0 -1  0]   G = [ 1    0    0 ]   A^T = [1  1  1  0]
+//         [0  1  1  0]       [1/2  1/2  1/2]         [0  1 -1 -1]
+//         [0 -1  1  0]       [1/2 -1/2  1/2]
+//         [0  1  0 -1]       [ 0    0    1 ]
+//
+// with U = G g G^T (per-filter, computed once per call), V = B^T d B
+// (per 4x4 input patch), and Y = A^T (sum_c U_c ∘ V_c) A.
+//
+// The tile transforms are cheap 4x4 shuffles and stay scalar; the channel
+// accumulation, which carries all the reduced multiply work, runs on two
+// Vec256<float> lanes covering the 16-element transform domain.
+
+// u = G g G^T for one 3x3 filter slice.
+void winograd_f2k3_weight_transform(const float* g, float* u) {
+  float t[4][3];
+  for (int j = 0; j < 3; ++j) {
+    const float g0 = g[j];
+    const float g1 = g[3 + j];
+    const float g2 = g[6 + j];
+    t[0][j] = g0;
+    t[1][j] = 0.5f * (g0 + g1 + g2);
+    t[2][j] = 0.5f * (g0 - g1 + g2);
+    t[3][j] = g2;
+  }
+  for (int i = 0; i < 4; ++i) {
+    const float t0 = t[i][0];
+    const float t1 = t[i][1];
+    const float t2 = t[i][2];
+    u[i * 4 + 0] = t0;
+    u[i * 4 + 1] = 0.5f * (t0 + t1 + t2);
+    u[i * 4 + 2] = 0.5f * (t0 - t1 + t2);
+    u[i * 4 + 3] = t2;
+  }
+}
+
+// v = B^T d B for one 4x4 input patch.
+void winograd_f2k3_input_transform(const float* d, float* v) {
+  float t[4][4];
+  for (int j = 0; j < 4; ++j) {
+    t[0][j] = d[0 * 4 + j] - d[2 * 4 + j];
+    t[1][j] = d[1 * 4 + j] + d[2 * 4 + j];
+    t[2][j] = d[2 * 4 + j] - d[1 * 4 + j];
+    t[3][j] = d[1 * 4 + j] - d[3 * 4 + j];
+  }
+  for (int i = 0; i < 4; ++i) {
+    v[i * 4 + 0] = t[i][0] - t[i][2];
+    v[i * 4 + 1] = t[i][1] + t[i][2];
+    v[i * 4 + 2] = t[i][2] - t[i][1];
+    v[i * 4 + 3] = t[i][1] - t[i][3];
+  }
+}
+
+// y = A^T m A for one accumulated 4x4 tile.
+void winograd_f2k3_output_transform(const float* m, float* y) {
+  float t[2][4];
+  for (int j = 0; j < 4; ++j) {
+    t[0][j] = m[0 * 4 + j] + m[1 * 4 + j] + m[2 * 4 + j];
+    t[1][j] = m[1 * 4 + j] - m[2 * 4 + j] - m[3 * 4 + j];
+  }
+  for (int i = 0; i < 2; ++i) {
+    y[i * 2 + 0] = t[i][0] + t[i][1] + t[i][2];
+    y[i * 2 + 1] = t[i][1] - t[i][2] - t[i][3];
+  }
+}
+
+Tensor _convolution_3x3_winograd(
+    const Tensor& input,
+    const Tensor& weight,
+    const Tensor& bias,
+    IntArrayRef padding) {
+  using Vec = vec256::Vec256<float>;
+
+  const int64_t N = input.size(0);
+  const int64_t C = input.size(1);
+  const int64_t H = input.size(2);
+  const int64_t W = input.size(3);
+  const int64_t K = weight.size(0);
+  const int64_t pad = padding[0];
+  const int64_t OH = H + 2 * pad - 2;
+  const int64_t OW = W + 2 * pad - 2;
+  const int64_t tiles_h = (OH + 1) / 2;
+  const int64_t tiles_w = (OW + 1) / 2;
+
+  Tensor output = at::empty({N, K, OH, OW}, input.options());
+  Tensor transformed_weight = at::empty({K, C, 16}, weight.options());
+
+  const float* const input_p = input.data_ptr<float>();
+  const float* const weight_p = weight.data_ptr<float>();
+  const float* const bias_p = bias.defined() ? bias.data_ptr<float>() : nullptr;
+  float* const u_p = transformed_weight.data_ptr<float>();
+  float* const output_p = output.data_ptr<float>();
+
+  at::parallel_for(0, K * C, 64, [&](int64_t begin, int64_t end) {
+    for (int64_t kc = begin; kc < end; ++kc) {
+      winograd_f2k3_weight_transform(weight_p + kc * 9, u_p + kc * 16);
+    }
+  });
+
+  // One task per (image, tile row); each task transforms the row's input
+  // patches once into a per-thread scratch and reuses them for all K
+  // filters.
+  at::parallel_for(0, N * tiles_h, 1, [&](int64_t begin, int64_t end) {
+    std::vector<float> v(C * 16);
+    for (int64_t index = begin; index < end; ++index) {
+      const int64_t n = index / tiles_h;
+      const int64_t tile_y = index % tiles_h;
+      const int64_t ih0 = tile_y * 2 - pad;
+      for (int64_t tile_x = 0; tile_x < tiles_w; ++tile_x) {
+        const int64_t iw0 = tile_x * 2 - pad;
+        for (int64_t c = 0; c < C; ++c) {
+          float d[16];
+          const float* const channel_p = input_p + (n * C + c) * H * W;
+          for (int64_t r = 0; r < 4; ++r) {
+            const int64_t ih = ih0 + r;
+            for (int64_t s = 0; s < 4; ++s) {
+              const int64_t iw = iw0 + s;
+              d[r * 4 + s] = (ih >= 0 && ih < H && iw >= 0 && iw < W)
+                  ? channel_p[ih * W + iw]
+                  : 0.f;
+            }
+          }
+          winograd_f2k3_input_transform(d, v.data() + c * 16);
+        }
+        const int64_t oh = tile_y * 2;
+        const int64_t ow = tile_x * 2;
+        for (int64_t k = 0; k < K; ++k) {
+          Vec acc_lo(0.f);
+          Vec acc_hi(0.f);
+          const float* const u_k = u_p + k * C * 16;
+          for (int64_t c = 0; c < C; ++c) {
+            const float* const u_c = u_k + c * 16;
+            const float* const v_c = v.data() + c * 16;
+            acc_lo = vec256::fmadd(Vec::loadu(u_c), Vec::loadu(v_c), acc_lo);
+            acc_hi = vec256::fmadd(
+                Vec::loadu(u_c + 8), Vec::loadu(v_c + 8), acc_hi);
+          }
+          float m[16];
+          acc_lo.store(m);
+          acc_hi.store(m + 8);
+          float y[4];
+          winograd_f2k3_output_transform(m, y);
+          const float b = bias_p != nullptr ? bias_p[k] : 0.f;
+          float* const out_k = output_p + (n * K + k) * OH * OW;
+          out_k[oh * OW + ow] = y[0] + b;
+          if (ow + 1 < OW) {
+            out_k[oh * OW + ow + 1] = y[1] + b;
+          }
+          if (oh + 1 < OH) {
+            out_k[(oh + 1) * OW + ow] = y[2] + b;
+            if (ow + 1 < OW) {
+              out_k[(oh + 1) * OW + ow + 1] = y[3] + b;
+            }
+          }
+        }
+      }
+    }
+  });
+
+  return output;
+}
+
+} // namespace
+
+REGISTER_DISPATCH(convolution_3x3_winograd_stub, &_convolution_3x3_winograd);
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+/*
+  Dense 3x3 stride-1 Winograd F(2x2, 3x3) convolution operator
+*/
+
+namespace at {
+namespace native {
+
+using convolution_3x3_winograd_fn =
+    Tensor (*)(const Tensor&, const Tensor&, const Tensor&, IntArrayRef);
+
+DECLARE_DISPATCH(convolution_3x3_winograd_fn, convolution_3x3_winograd_stub);
+
+} // namespace native
+} // namespace at
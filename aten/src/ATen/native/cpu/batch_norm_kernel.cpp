@@ -100,6 +100,89 @@ void batch_norm_cpu_inference_contiguous_impl(Tensor& output,
   }
 }
 
+/// Applies precomputed per-channel (scale, shift) terms; see
+/// _batch_norm_fold_affine for how they are collected from frozen running
+/// stats. Both memory formats reduce to a single vectorized scale-bias pass:
+/// NCHW broadcasts each channel's terms across its image plane, channels
+/// last loads the terms directly along the channel dimension.
+template<typename scalar_t>
+void batch_norm_cpu_apply_affine_impl(Tensor& output, const Tensor& input,
+    const Tensor& scale, const Tensor& shift) {
+
+  using Vec = Vec256<scalar_t>;
+  int64_t n_batch = input.size(0);
+  int64_t n_channel = input.size(1);
+  int64_t image_size = input.numel() / n_batch / n_channel;
+
+  const scalar_t* scale_data = scale.data_ptr<scalar_t>();
+  const scalar_t* shift_data = shift.data_ptr<scalar_t>();
+  scalar_t* output_data = output.data_ptr<scalar_t>();
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+
+  // Like the inference fast paths above, this is memory-limited, so no
+  // parallel_for.
+  if (input.dim() == 4 && input.is_contiguous(at::MemoryFormat::ChannelsLast)) {
+    const int64_t n_pixel = n_batch * image_size;
+    const int64_t loop_size = n_channel - (n_channel % Vec::size());
+    for (int64_t p = 0; p < n_pixel; p++) {
+      int64_t offset = p * n_channel;
+      int64_t d = 0;
+      for (; d < loop_size; d += Vec::size()) {
+        Vec output_vec =
+            Vec::loadu(input_data + offset + d) * Vec::loadu(scale_data + d)
+            + Vec::loadu(shift_data + d);
+        output_vec.store(output_data + offset + d);
+      }
+      if (n_channel - d > 0) {
+        Vec output_vec =
+            Vec::loadu(input_data + offset + d, n_channel - d)
+                * Vec::loadu(scale_data + d, n_channel - d)
+            + Vec::loadu(shift_data + d, n_channel - d);
+        output_vec.store(output_data + offset + d, n_channel - d);
+      }
+    }
+    return;
+  }
+
+  if (image_size != 1) {
+    const int64_t n_offset = n_channel * image_size;
+    const int64_t loop_size = image_size - (image_size % Vec::size());
+    for (int64_t n = 0; n < n_batch; n++) {
+      for (int64_t c = 0; c < n_channel; c++) {
+        const Vec scale_vec(scale_data[c]);
+        const Vec shift_vec(shift_data[c]);
+        int64_t offset = n * n_offset + c * image_size;
+        int64_t d = 0;
+        for (; d < loop_size; d += Vec::size()) {
+          Vec data_vec = Vec::loadu(input_data + offset + d);
+          Vec output_vec = data_vec * scale_vec + shift_vec;
+          output_vec.store(output_data + offset + d);
+        }
+        if (image_size - d > 0) {
+          Vec data_vec = Vec::loadu(input_data + offset + d, image_size - d);
+          Vec output_vec = data_vec * scale_vec + shift_vec;
+          output_vec.store(output_data + offset + d, image_size - d);
+        }
+      }
+    }
+  } else {
+    // image_size == 1
+    for (int64_t n = 0; n < n_batch; ++n) {
+      for (int64_t c = 0; c < n_channel; ++c) {
+        int64_t offset = n * n_channel + c;
+        output_data[offset] = input_data[offset] * scale_data[c] + shift_data[c];
+      }
+    }
+  }
+}
+
+void batch_norm_cpu_apply_affine_kernel(Tensor& output, const Tensor& input,
+    const Tensor& scale, const Tensor& shift) {
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "batch_norm_cpu_apply_affine", [&] {
+    batch_norm_cpu_apply_affine_impl<scalar_t>(output, input, scale, shift);
+  });
+}
+
 void batch_norm_cpu_inference_contiguous_kernel(Tensor& output, const Tensor& input,
     const Tensor& weight, const Tensor& bias, const Tensor& mean, const Tensor& variance, double eps) {
   AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "batch_norm_cpu_inference_contiguous", [&] {
@@ -110,5 +193,6 @@ void batch_norm_cpu_inference_contiguous_kernel(Tensor& output, const Tensor& in
 }// anonymous namespace
 
 REGISTER_DISPATCH(batch_norm_cpu_inference_contiguous_stub, &batch_norm_cpu_inference_contiguous_kernel);
+REGISTER_DISPATCH(batch_norm_cpu_apply_affine_stub, &batch_norm_cpu_apply_affine_kernel);
 
 }} // namespace at::native
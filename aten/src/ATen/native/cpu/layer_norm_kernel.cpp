@@ -82,6 +82,96 @@ void LayerNormKernelImpl(
   });
 }
 
+template <typename T>
+void AddLayerNormKernelImplInternal(
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    T eps,
+    Tensor* Y,
+    Tensor* X,
+    Tensor* mean,
+    Tensor* rstd) {
+  using Vec = vec256::Vec256<T>;
+  DCHECK_EQ(A.numel(), M * N);
+  DCHECK_EQ(B.numel(), M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  const T* A_data = A.data_ptr<T>();
+  const T* B_data = B.data_ptr<T>();
+  const T* gamma_data = gamma.defined() ? gamma.data_ptr<T>() : nullptr;
+  const T* beta_data = beta.defined() ? beta.data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  T* X_data = X->data_ptr<T>();
+  T* mean_data = mean->data_ptr<T>();
+  T* rstd_data = rstd->data_ptr<T>();
+  const T c = T(1) / static_cast<T>(N);
+  const bool gamma_null = gamma_data == nullptr;
+  const bool beta_null = beta_data == nullptr;
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i) {
+      const T* A_ptr = A_data + i * N;
+      const T* B_ptr = B_data + i * N;
+      T* X_ptr = X_data + i * N;
+      T* Y_ptr = Y_data + i * N;
+      // Residual add and both moments in a single pass over the row; the
+      // unfused path reads the summed input twice more for the reductions.
+      Vec acc0_vec(0);
+      Vec acc1_vec(0);
+      int64_t j = 0;
+      for (; j + Vec::size() <= N; j += Vec::size()) {
+        const Vec x = Vec::loadu(A_ptr + j) + Vec::loadu(B_ptr + j);
+        x.store(X_ptr + j);
+        acc0_vec = acc0_vec + x;
+        acc1_vec = vec256::fmadd(x, x, acc1_vec);
+      }
+      T mean_val = vec256::vec_reduce_all<T>(
+          [](Vec& x, Vec& y) { return x + y; }, acc0_vec, Vec::size());
+      T rstd_val = vec256::vec_reduce_all<T>(
+          [](Vec& x, Vec& y) { return x + y; }, acc1_vec, Vec::size());
+      for (; j < N; ++j) {
+        const T x = A_ptr[j] + B_ptr[j];
+        X_ptr[j] = x;
+        mean_val += x;
+        rstd_val += x * x;
+      }
+      mean_val *= c;
+      rstd_val = std::max(rstd_val * c - mean_val * mean_val, T(0));
+      rstd_val = T(1) / std::sqrt(rstd_val + eps);
+      const T scale = rstd_val;
+      const T bias = -rstd_val * mean_val;
+      for (int64_t k = 0; k < N; ++k) {
+        const T gamma_v = gamma_null ? T(1) : gamma_data[k];
+        const T beta_v = beta_null ? T(0) : beta_data[k];
+        Y_ptr[k] = (X_ptr[k] * scale + bias) * gamma_v + beta_v;
+      }
+      mean_data[i] = mean_val;
+      rstd_data[i] = rstd_val;
+    }
+  });
+}
+
+void AddLayerNormKernelImpl(
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* X,
+    Tensor* mean,
+    Tensor* rstd) {
+  AT_DISPATCH_FLOATING_TYPES(A.scalar_type(), "AddLayerNormKernelImpl", [&]() {
+    AddLayerNormKernelImplInternal<scalar_t>(
+        A, B, gamma, beta, M, N, static_cast<scalar_t>(eps), Y, X, mean, rstd);
+  });
+}
+
 template <typename T>
 void LayerNormBackwardKernelImplInternal(
     const Tensor& dY,
@@ -151,6 +241,113 @@ void LayerNormBackwardKernelImplInternal(
   }
 }
 
+template <typename T>
+void AddLayerNormBackwardKernelImplInternal(
+    const Tensor& dY,
+    const Tensor& dsum,
+    const Tensor& X,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    Tensor* dA,
+    Tensor* dB,
+    Tensor* dgamma,
+    Tensor* dbeta) {
+  DCHECK_EQ(X.numel(), M * N);
+  DCHECK_EQ(mean.numel(), M);
+  DCHECK_EQ(rstd.numel(), M);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  const T* dY_data = dY.defined() ? dY.template data_ptr<T>() : nullptr;
+  const T* dsum_data = dsum.defined() ? dsum.template data_ptr<T>() : nullptr;
+  const T* X_data = X.template data_ptr<T>();
+  const T* mean_data = mean.template data_ptr<T>();
+  const T* rstd_data = rstd.template data_ptr<T>();
+  const T* gamma_data =
+      gamma.defined() ? gamma.template data_ptr<T>() : nullptr;
+  T* dA_data = dA->defined() ? dA->template data_ptr<T>() : nullptr;
+  T* dB_data = dB->defined() ? dB->template data_ptr<T>() : nullptr;
+  T* dgamma_data = dgamma->defined() ? dgamma->template data_ptr<T>() : nullptr;
+  if (dgamma_data != nullptr) {
+    std::memset(dgamma_data, 0, N * sizeof(T));
+  }
+  T* dbeta_data = dbeta->defined() ? dbeta->template data_ptr<T>() : nullptr;
+  if (dbeta_data != nullptr) {
+    std::memset(dbeta_data, 0, N * sizeof(T));
+  }
+  const T scale = T(1) / static_cast<T>(N);
+  const bool gamma_null = gamma_data == nullptr;
+  for (int64_t i = 0; i < M; ++i) {
+    const T* dY_ptr = dY_data != nullptr ? dY_data + i * N : nullptr;
+    const T* dsum_ptr = dsum_data != nullptr ? dsum_data + i * N : nullptr;
+    const T* X_ptr = X_data + i * N;
+    if (dA_data != nullptr || dB_data != nullptr) {
+      // The add distributes the gradient unchanged, so dinput and dresidual
+      // are the same row; compute it once and mirror it.
+      T* dX_ptr = dA_data != nullptr ? dA_data + i * N : dB_data + i * N;
+      if (dY_ptr != nullptr) {
+        T ds = 0;
+        T db = 0;
+        for (int64_t j = 0; j < N; ++j) {
+          const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+          ds += dY_ptr[j] * X_ptr[j] * gamma_v;
+          db += dY_ptr[j] * gamma_v;
+        }
+        const T a = rstd_data[i];
+        const T b = (db * mean_data[i] - ds) * a * a * a * scale;
+        const T c = -b * mean_data[i] - db * a * scale;
+        for (int64_t j = 0; j < N; ++j) {
+          const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+          dX_ptr[j] = a * dY_ptr[j] * gamma_v + b * X_ptr[j] + c;
+          if (dsum_ptr != nullptr) {
+            dX_ptr[j] += dsum_ptr[j];
+          }
+        }
+      } else if (dsum_ptr != nullptr) {
+        std::memcpy(dX_ptr, dsum_ptr, N * sizeof(T));
+      } else {
+        std::memset(dX_ptr, 0, N * sizeof(T));
+      }
+      if (dA_data != nullptr && dB_data != nullptr) {
+        std::memcpy(dB_data + i * N, dX_ptr, N * sizeof(T));
+      }
+    }
+    if (dY_ptr != nullptr && dgamma_data != nullptr) {
+      const T a = rstd_data[i];
+      const T b = -a * mean_data[i];
+      for (int64_t j = 0; j < N; ++j) {
+        dgamma_data[j] += dY_ptr[j] * (a * X_ptr[j] + b);
+      }
+    }
+    if (dY_ptr != nullptr && dbeta_data != nullptr) {
+      for (int64_t j = 0; j < N; ++j) {
+        dbeta_data[j] += dY_ptr[j];
+      }
+    }
+  }
+}
+
+void AddLayerNormBackwardKernelImpl(
+    const Tensor& dY,
+    const Tensor& dsum,
+    const Tensor& X,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    Tensor* dA,
+    Tensor* dB,
+    Tensor* dgamma,
+    Tensor* dbeta) {
+  AT_DISPATCH_FLOATING_TYPES(
+      X.scalar_type(), "AddLayerNormBackwardKernelImpl", [&]() {
+        AddLayerNormBackwardKernelImplInternal<scalar_t>(
+            dY, dsum, X, mean, rstd, gamma, M, N, dA, dB, dgamma, dbeta);
+      });
+}
+
 void LayerNormBackwardKernelImpl(
     const Tensor& dY,
     const Tensor& X,
@@ -173,6 +370,8 @@ void LayerNormBackwardKernelImpl(
 
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+REGISTER_DISPATCH(AddLayerNormKernel, &AddLayerNormKernelImpl);
+REGISTER_DISPATCH(AddLayerNormBackwardKernel, &AddLayerNormBackwardKernelImpl);
 
 } // namespace native
 } // namespace at
@@ -0,0 +1,586 @@
+#include <ATen/Dispatch.h>
+#include <ATen/native/ForeachUtils.h>
+#include <ATen/native/cuda/MultiTensorApply.cuh>
+#include <THC/THCAtomics.cuh>
+
+#include <cmath>
+
+namespace at { namespace native {
+
+namespace {
+
+template <typename scalar_t>
+struct AddScalarFunctor {
+  __device__ void operator()(
+      int chunk_size,
+      TensorListMetadata<1>& tl,
+      scalar_t scalar) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.sizes[tensor_loc] - chunk_idx * chunk_size;
+    n = n < chunk_size ? n : chunk_size;
+    scalar_t* x =
+        (scalar_t*)tl.addresses[0][tensor_loc] + chunk_idx * chunk_size;
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+      x[i] += scalar;
+    }
+  }
+};
+
+template <typename scalar_t>
+struct MulScalarFunctor {
+  __device__ void operator()(
+      int chunk_size,
+      TensorListMetadata<1>& tl,
+      scalar_t scalar) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.sizes[tensor_loc] - chunk_idx * chunk_size;
+    n = n < chunk_size ? n : chunk_size;
+    scalar_t* x =
+        (scalar_t*)tl.addresses[0][tensor_loc] + chunk_idx * chunk_size;
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+      x[i] *= scalar;
+    }
+  }
+};
+
+template <typename scalar_t>
+struct AddcdivScalarFunctor {
+  __device__ void operator()(
+      int chunk_size,
+      TensorListMetadata<3>& tl,
+      scalar_t value) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.sizes[tensor_loc] - chunk_idx * chunk_size;
+    n = n < chunk_size ? n : chunk_size;
+    int offset = chunk_idx * chunk_size;
+    scalar_t* x = (scalar_t*)tl.addresses[0][tensor_loc] + offset;
+    scalar_t* t1 = (scalar_t*)tl.addresses[1][tensor_loc] + offset;
+    scalar_t* t2 = (scalar_t*)tl.addresses[2][tensor_loc] + offset;
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+      x[i] += value * t1[i] / t2[i];
+    }
+  }
+};
+
+// Fused optimizer step functors. Each block still handles one chunk of one
+// tensor; the per-element math mirrors the per-tensor implementations in
+// torch/csrc/api/src/optim. List order is fixed by the entry points below.
+
+template <typename scalar_t, int depth>
+struct SGDStepFunctor {
+  __device__ void operator()(
+      int chunk_size,
+      TensorListMetadata<depth>& tl,
+      scalar_t lr,
+      scalar_t momentum,
+      scalar_t dampening,
+      scalar_t weight_decay,
+      bool nesterov) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.sizes[tensor_loc] - chunk_idx * chunk_size;
+    n = n < chunk_size ? n : chunk_size;
+    int offset = chunk_idx * chunk_size;
+    scalar_t* p = (scalar_t*)tl.addresses[0][tensor_loc] + offset;
+    scalar_t* g = (scalar_t*)tl.addresses[1][tensor_loc] + offset;
+    // The index is clamped so the unused branch never names an
+    // out-of-bounds constant subscript for the shallower instantiation.
+    scalar_t* buf = depth == 3
+        ? (scalar_t*)tl.addresses[depth == 3 ? 2 : 0][tensor_loc] + offset
+        : nullptr;
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+      scalar_t d = g[i] + weight_decay * p[i];
+      if (depth == 3) {
+        scalar_t b = momentum * buf[i] + (scalar_t(1) - dampening) * d;
+        buf[i] = b;
+        d = nesterov ? d + momentum * b : b;
+      }
+      p[i] -= lr * d;
+    }
+  }
+};
+
+template <typename scalar_t, int depth>
+struct AdamStepFunctor {
+  __device__ void operator()(
+      int chunk_size,
+      TensorListMetadata<depth>& tl,
+      scalar_t step_size,
+      scalar_t beta1,
+      scalar_t beta2,
+      scalar_t weight_decay,
+      scalar_t eps,
+      scalar_t sqrt_bias_correction2) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.sizes[tensor_loc] - chunk_idx * chunk_size;
+    n = n < chunk_size ? n : chunk_size;
+    int offset = chunk_idx * chunk_size;
+    scalar_t* p = (scalar_t*)tl.addresses[0][tensor_loc] + offset;
+    scalar_t* g = (scalar_t*)tl.addresses[1][tensor_loc] + offset;
+    scalar_t* m = (scalar_t*)tl.addresses[2][tensor_loc] + offset;
+    scalar_t* v = (scalar_t*)tl.addresses[3][tensor_loc] + offset;
+    scalar_t* vm = depth == 5
+        ? (scalar_t*)tl.addresses[depth == 5 ? 4 : 0][tensor_loc] + offset
+        : nullptr;
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+      scalar_t gi = g[i] + weight_decay * p[i];
+      scalar_t mi = m[i] = beta1 * m[i] + (scalar_t(1) - beta1) * gi;
+      scalar_t vi = v[i] = beta2 * v[i] + (scalar_t(1) - beta2) * gi * gi;
+      if (depth == 5) {
+        vi = vm[i] = vm[i] > vi ? vm[i] : vi;
+      }
+      p[i] -= step_size * mi / (::sqrt(vi) / sqrt_bias_correction2 + eps);
+    }
+  }
+};
+
+template <typename scalar_t, bool centered, bool has_momentum>
+struct RMSpropStepFunctor {
+  static constexpr int depth = 3 + centered + has_momentum;
+  __device__ void operator()(
+      int chunk_size,
+      TensorListMetadata<depth>& tl,
+      scalar_t lr,
+      scalar_t alpha,
+      scalar_t eps,
+      scalar_t weight_decay,
+      scalar_t momentum) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.sizes[tensor_loc] - chunk_idx * chunk_size;
+    n = n < chunk_size ? n : chunk_size;
+    int offset = chunk_idx * chunk_size;
+    scalar_t* p = (scalar_t*)tl.addresses[0][tensor_loc] + offset;
+    scalar_t* g = (scalar_t*)tl.addresses[1][tensor_loc] + offset;
+    scalar_t* sa = (scalar_t*)tl.addresses[2][tensor_loc] + offset;
+    scalar_t* ga = centered
+        ? (scalar_t*)tl.addresses[centered ? 3 : 0][tensor_loc] + offset
+        : nullptr;
+    scalar_t* buf = has_momentum
+        ? (scalar_t*)tl.addresses[has_momentum ? 3 + centered : 0][tensor_loc] +
+            offset
+        : nullptr;
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+      scalar_t gi = g[i] + weight_decay * p[i];
+      scalar_t sai = sa[i] = alpha * sa[i] + (scalar_t(1) - alpha) * gi * gi;
+      scalar_t avg;
+      if (centered) {
+        scalar_t gai = ga[i] = alpha * ga[i] + (scalar_t(1) - alpha) * gi;
+        avg = ::sqrt(sai - gai * gai) + eps;
+      } else {
+        avg = ::sqrt(sai) + eps;
+      }
+      if (has_momentum) {
+        scalar_t b = buf[i] = momentum * buf[i] + gi / avg;
+        p[i] -= lr * b;
+      } else {
+        p[i] -= lr * gi / avg;
+      }
+    }
+  }
+};
+
+// Accumulates sum(|x|^ord) over every chunk into a single scalar: each
+// thread reduces its strided slice, the block tree-reduces in shared memory
+// and contributes one atomic add. The caller applies the final root.
+template <typename scalar_t>
+struct GlobalNormFunctor {
+  __device__ void operator()(
+      int chunk_size,
+      TensorListMetadata<1>& tl,
+      scalar_t* output,
+      scalar_t ord) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.sizes[tensor_loc] - chunk_idx * chunk_size;
+    n = n < chunk_size ? n : chunk_size;
+    scalar_t* x =
+        (scalar_t*)tl.addresses[0][tensor_loc] + chunk_idx * chunk_size;
+    scalar_t acc = 0;
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+      scalar_t v = ::fabs(x[i]);
+      acc += ord == 2 ? v * v : (ord == 1 ? v : ::pow(v, ord));
+    }
+    __shared__ scalar_t vals[kMTABlockSize];
+    vals[threadIdx.x] = acc;
+    __syncthreads();
+    for (int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+      if (threadIdx.x < stride) {
+        vals[threadIdx.x] += vals[threadIdx.x + stride];
+      }
+      __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+      gpuAtomicAdd(output, vals[0]);
+    }
+  }
+};
+
+bool foreach_step_lists_match(
+    TensorList params,
+    TensorList grads,
+    std::initializer_list<TensorList> state_lists) {
+  bool fast = can_use_fast_route(params) && can_use_fast_route(grads);
+  for (size_t i = 0; fast && i < params.size(); i++) {
+    fast = params[i].numel() == grads[i].numel();
+  }
+  for (const auto& state : state_lists) {
+    if (state.empty()) {
+      continue;
+    }
+    fast = fast && can_use_fast_route(state);
+    for (size_t i = 0; fast && i < params.size(); i++) {
+      fast = params[i].numel() == state[i].numel();
+    }
+  }
+  return fast;
+}
+
+} // namespace
+
+void foreach_add_scalar_cuda_(TensorList tensors, Scalar scalar) {
+  check_foreach_api_restrictions(tensors);
+  if (!can_use_fast_route(tensors)) {
+    for (const auto& t : tensors) {
+      t.add_(scalar);
+    }
+    return;
+  }
+  std::vector<std::vector<at::Tensor>> tensor_lists;
+  tensor_lists.emplace_back(tensors.vec());
+  AT_DISPATCH_ALL_TYPES_AND(
+      at::ScalarType::Half, tensors[0].scalar_type(), "foreach_add_scalar_cuda", [&]() {
+        multi_tensor_apply<1>(
+            tensor_lists, AddScalarFunctor<scalar_t>(), scalar.to<scalar_t>());
+      });
+}
+
+void foreach_mul_scalar_cuda_(TensorList tensors, Scalar scalar) {
+  check_foreach_api_restrictions(tensors);
+  if (!can_use_fast_route(tensors)) {
+    for (const auto& t : tensors) {
+      t.mul_(scalar);
+    }
+    return;
+  }
+  std::vector<std::vector<at::Tensor>> tensor_lists;
+  tensor_lists.emplace_back(tensors.vec());
+  AT_DISPATCH_ALL_TYPES_AND(
+      at::ScalarType::Half, tensors[0].scalar_type(), "foreach_mul_scalar_cuda", [&]() {
+        multi_tensor_apply<1>(
+            tensor_lists, MulScalarFunctor<scalar_t>(), scalar.to<scalar_t>());
+      });
+}
+
+void foreach_addcdiv_scalar_cuda_(
+    TensorList tensors,
+    TensorList tensor1,
+    TensorList tensor2,
+    Scalar value) {
+  check_foreach_api_restrictions(tensors, tensor1, tensor2);
+  bool fast = can_use_fast_route(tensors) && can_use_fast_route(tensor1) &&
+      can_use_fast_route(tensor2);
+  for (size_t i = 0; fast && i < tensors.size(); i++) {
+    fast = tensors[i].numel() == tensor1[i].numel() &&
+        tensors[i].numel() == tensor2[i].numel();
+  }
+  if (!fast) {
+    for (size_t i = 0; i < tensors.size(); i++) {
+      tensors[i].addcdiv_(tensor1[i], tensor2[i], value);
+    }
+    return;
+  }
+  std::vector<std::vector<at::Tensor>> tensor_lists;
+  tensor_lists.emplace_back(tensors.vec());
+  tensor_lists.emplace_back(tensor1.vec());
+  tensor_lists.emplace_back(tensor2.vec());
+  AT_DISPATCH_ALL_TYPES_AND(
+      at::ScalarType::Half, tensors[0].scalar_type(), "foreach_addcdiv_scalar_cuda", [&]() {
+        multi_tensor_apply<3>(
+            tensor_lists,
+            AddcdivScalarFunctor<scalar_t>(),
+            value.to<scalar_t>());
+      });
+}
+
+void foreach_sgd_step_cuda_(
+    TensorList params,
+    TensorList grads,
+    TensorList momentum_buffers,
+    double lr,
+    double momentum,
+    double dampening,
+    double weight_decay,
+    bool nesterov) {
+  check_foreach_api_restrictions(params);
+  TORCH_CHECK(
+      grads.size() == params.size(),
+      "params and grads must have the same length");
+  const bool has_momentum = !momentum_buffers.empty();
+  TORCH_CHECK(
+      !has_momentum || momentum_buffers.size() == params.size(),
+      "params and momentum_buffers must have the same length");
+
+  if (!foreach_step_lists_match(params, grads, {momentum_buffers})) {
+    for (size_t i = 0; i < params.size(); i++) {
+      auto d_p = grads[i];
+      if (weight_decay != 0) {
+        d_p = d_p.add(params[i], weight_decay);
+      }
+      if (has_momentum) {
+        auto& buf = momentum_buffers[i];
+        buf.mul_(momentum).add_(d_p, 1 - dampening);
+        d_p = nesterov ? d_p.add(buf, momentum) : buf;
+      }
+      params[i].add_(d_p, -lr);
+    }
+    return;
+  }
+
+  std::vector<std::vector<at::Tensor>> tensor_lists;
+  tensor_lists.emplace_back(params.vec());
+  tensor_lists.emplace_back(grads.vec());
+  if (has_momentum) {
+    tensor_lists.emplace_back(momentum_buffers.vec());
+  }
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      at::ScalarType::Half, params[0].scalar_type(), "foreach_sgd_step_cuda", [&]() {
+        if (has_momentum) {
+          multi_tensor_apply<3>(
+              tensor_lists,
+              SGDStepFunctor<scalar_t, 3>(),
+              static_cast<scalar_t>(lr),
+              static_cast<scalar_t>(momentum),
+              static_cast<scalar_t>(dampening),
+              static_cast<scalar_t>(weight_decay),
+              nesterov);
+        } else {
+          multi_tensor_apply<2>(
+              tensor_lists,
+              SGDStepFunctor<scalar_t, 2>(),
+              static_cast<scalar_t>(lr),
+              static_cast<scalar_t>(momentum),
+              static_cast<scalar_t>(dampening),
+              static_cast<scalar_t>(weight_decay),
+              nesterov);
+        }
+      });
+}
+
+void foreach_adam_step_cuda_(
+    TensorList params,
+    TensorList grads,
+    TensorList exp_avgs,
+    TensorList exp_avg_sqs,
+    TensorList max_exp_avg_sqs,
+    double lr,
+    double beta1,
+    double beta2,
+    double weight_decay,
+    double eps,
+    bool amsgrad,
+    int64_t step) {
+  check_foreach_api_restrictions(params);
+  TORCH_CHECK(
+      grads.size() == params.size() && exp_avgs.size() == params.size() &&
+          exp_avg_sqs.size() == params.size(),
+      "params, grads, exp_avgs and exp_avg_sqs must have the same length");
+  TORCH_CHECK(
+      !amsgrad || max_exp_avg_sqs.size() == params.size(),
+      "params and max_exp_avg_sqs must have the same length with amsgrad");
+  TORCH_CHECK(step > 0, "step must be > 0");
+
+  const double bias_correction1 = 1 - std::pow(beta1, step);
+  const double bias_correction2 = 1 - std::pow(beta2, step);
+  const double step_size = lr / bias_correction1;
+  const double sqrt_bias_correction2 = std::sqrt(bias_correction2);
+
+  if (!foreach_step_lists_match(
+          params, grads, {exp_avgs, exp_avg_sqs, max_exp_avg_sqs})) {
+    for (size_t i = 0; i < params.size(); i++) {
+      auto grad = grads[i];
+      if (weight_decay != 0) {
+        grad = grad.add(params[i], weight_decay);
+      }
+      exp_avgs[i].mul_(beta1).add_(grad, 1 - beta1);
+      exp_avg_sqs[i].mul_(beta2).addcmul_(grad, grad, 1 - beta2);
+      Tensor denom;
+      if (amsgrad) {
+        at::max_out(max_exp_avg_sqs[i], exp_avg_sqs[i], max_exp_avg_sqs[i]);
+        denom =
+            (max_exp_avg_sqs[i].sqrt() / sqrt_bias_correction2).add_(eps);
+      } else {
+        denom = (exp_avg_sqs[i].sqrt() / sqrt_bias_correction2).add_(eps);
+      }
+      params[i].addcdiv_(exp_avgs[i], denom, -step_size);
+    }
+    return;
+  }
+
+  std::vector<std::vector<at::Tensor>> tensor_lists;
+  tensor_lists.emplace_back(params.vec());
+  tensor_lists.emplace_back(grads.vec());
+  tensor_lists.emplace_back(exp_avgs.vec());
+  tensor_lists.emplace_back(exp_avg_sqs.vec());
+  if (amsgrad) {
+    tensor_lists.emplace_back(max_exp_avg_sqs.vec());
+  }
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      at::ScalarType::Half, params[0].scalar_type(), "foreach_adam_step_cuda", [&]() {
+        if (amsgrad) {
+          multi_tensor_apply<5>(
+              tensor_lists,
+              AdamStepFunctor<scalar_t, 5>(),
+              static_cast<scalar_t>(step_size),
+              static_cast<scalar_t>(beta1),
+              static_cast<scalar_t>(beta2),
+              static_cast<scalar_t>(weight_decay),
+              static_cast<scalar_t>(eps),
+              static_cast<scalar_t>(sqrt_bias_correction2));
+        } else {
+          multi_tensor_apply<4>(
+              tensor_lists,
+              AdamStepFunctor<scalar_t, 4>(),
+              static_cast<scalar_t>(step_size),
+              static_cast<scalar_t>(beta1),
+              static_cast<scalar_t>(beta2),
+              static_cast<scalar_t>(weight_decay),
+              static_cast<scalar_t>(eps),
+              static_cast<scalar_t>(sqrt_bias_correction2));
+        }
+      });
+}
+
+void foreach_rmsprop_step_cuda_(
+    TensorList params,
+    TensorList grads,
+    TensorList square_avgs,
+    TensorList grad_avgs,
+    TensorList momentum_buffers,
+    double lr,
+    double alpha,
+    double eps,
+    double weight_decay,
+    double momentum,
+    bool centered) {
+  check_foreach_api_restrictions(params);
+  TORCH_CHECK(
+      grads.size() == params.size() && square_avgs.size() == params.size(),
+      "params, grads and square_avgs must have the same length");
+  TORCH_CHECK(
+      !centered || grad_avgs.size() == params.size(),
+      "params and grad_avgs must have the same length when centered");
+  const bool has_momentum = momentum > 0;
+  TORCH_CHECK(
+      !has_momentum || momentum_buffers.size() == params.size(),
+      "params and momentum_buffers must have the same length with momentum");
+
+  if (!foreach_step_lists_match(
+          params, grads, {square_avgs, grad_avgs, momentum_buffers})) {
+    for (size_t i = 0; i < params.size(); i++) {
+      auto grad = grads[i];
+      if (weight_decay != 0) {
+        grad = grad.add(params[i], weight_decay);
+      }
+      square_avgs[i].mul_(alpha).addcmul_(grad, grad, 1 - alpha);
+      Tensor avg;
+      if (centered) {
+        auto& grad_avg = grad_avgs[i];
+        grad_avg.mul_(alpha).add_(grad, 1 - alpha);
+        avg = square_avgs[i]
+                  .addcmul(grad_avg, grad_avg, -1)
+                  .sqrt_()
+                  .add_(eps);
+      } else {
+        avg = square_avgs[i].sqrt().add_(eps);
+      }
+      if (has_momentum) {
+        auto& buf = momentum_buffers[i];
+        buf.mul_(momentum).addcdiv_(grad, avg);
+        params[i].add_(buf, -lr);
+      } else {
+        params[i].addcdiv_(grad, avg, -lr);
+      }
+    }
+    return;
+  }
+
+  std::vector<std::vector<at::Tensor>> tensor_lists;
+  tensor_lists.emplace_back(params.vec());
+  tensor_lists.emplace_back(grads.vec());
+  tensor_lists.emplace_back(square_avgs.vec());
+  if (centered) {
+    tensor_lists.emplace_back(grad_avgs.vec());
+  }
+  if (has_momentum) {
+    tensor_lists.emplace_back(momentum_buffers.vec());
+  }
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      at::ScalarType::Half, params[0].scalar_type(), "foreach_rmsprop_step_cuda", [&]() {
+        const auto lr_ = static_cast<scalar_t>(lr);
+        const auto alpha_ = static_cast<scalar_t>(alpha);
+        const auto eps_ = static_cast<scalar_t>(eps);
+        const auto weight_decay_ = static_cast<scalar_t>(weight_decay);
+        const auto momentum_ = static_cast<scalar_t>(momentum);
+        if (centered && has_momentum) {
+          multi_tensor_apply<5>(
+              tensor_lists, RMSpropStepFunctor<scalar_t, true, true>(),
+              lr_, alpha_, eps_, weight_decay_, momentum_);
+        } else if (centered) {
+          multi_tensor_apply<4>(
+              tensor_lists, RMSpropStepFunctor<scalar_t, true, false>(),
+              lr_, alpha_, eps_, weight_decay_, momentum_);
+        } else if (has_momentum) {
+          multi_tensor_apply<4>(
+              tensor_lists, RMSpropStepFunctor<scalar_t, false, true>(),
+              lr_, alpha_, eps_, weight_decay_, momentum_);
+        } else {
+          multi_tensor_apply<3>(
+              tensor_lists, RMSpropStepFunctor<scalar_t, false, false>(),
+              lr_, alpha_, eps_, weight_decay_, momentum_);
+        }
+      });
+}
+
+Tensor foreach_global_norm_cuda(TensorList tensors, double ord) {
+  check_foreach_api_restrictions(tensors);
+  // The fused reduction accumulates in the list's own dtype and needs a
+  // finite ord; everything else combines per-tensor norms instead.
+  const bool fast = !std::isinf(ord) &&
+      (tensors[0].scalar_type() == kFloat ||
+       tensors[0].scalar_type() == kDouble) &&
+      can_use_fast_route(tensors);
+  if (!fast) {
+    std::vector<Tensor> norms;
+    norms.reserve(tensors.size());
+    for (const auto& t : tensors) {
+      norms.push_back(t.norm(ord));
+    }
+    return at::norm(at::stack(norms), ord);
+  }
+
+  auto output = at::zeros({}, tensors[0].options());
+  std::vector<std::vector<at::Tensor>> tensor_lists;
+  tensor_lists.emplace_back(tensors.vec());
+  AT_DISPATCH_FLOATING_TYPES(
+      tensors[0].scalar_type(), "foreach_global_norm_cuda", [&]() {
+        multi_tensor_apply<1>(
+            tensor_lists,
+            GlobalNormFunctor<scalar_t>(),
+            output.data_ptr<scalar_t>(),
+            static_cast<scalar_t>(ord));
+      });
+  if (ord == 2) {
+    return output.sqrt_();
+  }
+  if (ord == 1) {
+    return output;
+  }
+  return output.pow_(1.0 / ord);
+}
+
+}} // namespace at::native
@@ -335,7 +335,10 @@ __global__ void indexAddSmallIndex(cuda::detail::TensorInfo<T, IndexType> dst,
           cuda::detail::IndexToOffset<T, IndexType, SrcDim>::get(linearIndex, src);
       srcOffset += srcIndex * src.strides[srcAddDim];
 
-      gpuAtomicAdd(&dst.data[dstOffset], src.data[srcOffset]);
+      // Duplicate indices make neighboring threads collide on the same
+      // destination; combine those within the warp first, see
+      // Note [Warp-aggregated atomic add]
+      gpuAtomicAddAggregated(&dst.data[dstOffset], src.data[srcOffset]);
     }
   }
 }
@@ -384,7 +387,8 @@ __global__ void indexAddLargeIndex(cuda::detail::TensorInfo<T, IndexType> dst,
       cuda::detail::IndexToOffset<T, IndexType, SrcDim>::get(elementInSlice, src);
     srcOffset += srcIndex * src.strides[srcAddDim];
 
-    gpuAtomicAdd(&dst.data[dstOffset], src.data[srcOffset]);
+    // See Note [Warp-aggregated atomic add]
+    gpuAtomicAddAggregated(&dst.data[dstOffset], src.data[srcOffset]);
   }
 }
 
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAException.h>
+
+#include <vector>
+
+namespace at { namespace native {
+
+// A batched launcher for elementwise work over lists of tensors. Per-tensor
+// kernel launches are replaced by kernels over chunked work descriptors:
+// tensor addresses and sizes are packed into a kernel argument struct, each
+// CUDA block is assigned one chunk of one tensor, and a new kernel is
+// launched only when the descriptor struct fills up. An optimizer applying
+// hundreds of small per-parameter ops thus issues a handful of launches
+// instead of hundreds.
+
+static constexpr int kMTABlockSize = 512;
+static constexpr int kMTAChunkSize = 65536;
+// The descriptor struct is passed by value as a kernel argument, which caps
+// its size at 4KB; deeper ops carry more addresses, so fewer tensors fit.
+static constexpr int depth_to_max_tensors[5] = {110, 64, 48, 36, 30};
+static constexpr int depth_to_max_blocks[5] = {320, 320, 320, 320, 320};
+
+template <int depth>
+struct TensorListMetadata {
+  void* addresses[depth][depth_to_max_tensors[depth - 1]];
+  int sizes[depth_to_max_tensors[depth - 1]];
+  unsigned char block_to_tensor[depth_to_max_blocks[depth - 1]];
+  int block_to_chunk[depth_to_max_blocks[depth - 1]];
+};
+
+template <typename T, typename U, typename... ArgTypes>
+C10_LAUNCH_BOUNDS_1(kMTABlockSize)
+__global__ void multi_tensor_apply_kernel(
+    T tensorListMeta,
+    U callable,
+    ArgTypes... args) {
+  callable(kMTAChunkSize, tensorListMeta, args...);
+}
+
+// tensor_lists is a [depth][n_tensors] array; position i of every list must
+// refer to tensors of equal numel. The callable runs once per block with the
+// chunk size, the metadata, and the extra args.
+template <int depth, typename T, typename... ArgTypes>
+void multi_tensor_apply(
+    const std::vector<std::vector<at::Tensor>>& tensor_lists,
+    T callable,
+    ArgTypes... args) {
+  TORCH_INTERNAL_ASSERT(
+      tensor_lists.size() == depth, "tensor list count must match depth");
+  const size_t n_tensors = tensor_lists[0].size();
+  TensorListMetadata<depth> meta;
+  auto stream = at::cuda::getCurrentCUDAStream();
+
+  int loc_block_info = 0;
+  int loc_tensor_info = 0;
+  for (size_t t = 0; t < n_tensors; t++) {
+    meta.sizes[loc_tensor_info] = tensor_lists[0][t].numel();
+    for (int d = 0; d < depth; d++) {
+      meta.addresses[d][loc_tensor_info] = tensor_lists[d][t].data_ptr();
+    }
+    loc_tensor_info++;
+
+    const int chunks =
+        (tensor_lists[0][t].numel() + kMTAChunkSize - 1) / kMTAChunkSize;
+    for (int chunk = 0; chunk < chunks; chunk++) {
+      meta.block_to_tensor[loc_block_info] = loc_tensor_info - 1;
+      meta.block_to_chunk[loc_block_info] = chunk;
+      loc_block_info++;
+
+      const bool tensors_full =
+          (loc_tensor_info == depth_to_max_tensors[depth - 1] &&
+           chunk == chunks - 1);
+      const bool blocks_full =
+          (loc_block_info == depth_to_max_blocks[depth - 1]);
+      const bool last_chunk = (t == n_tensors - 1 && chunk == chunks - 1);
+      if (tensors_full || blocks_full || last_chunk) {
+        multi_tensor_apply_kernel<<<loc_block_info, kMTABlockSize, 0, stream>>>(
+            meta, callable, args...);
+        C10_CUDA_CHECK(cudaGetLastError());
+
+        loc_block_info = 0;
+        if (chunk == chunks - 1) {
+          loc_tensor_info = 0;
+        } else {
+          // The current tensor still has chunks left; carry it over as the
+          // first entry of the next descriptor.
+          meta.sizes[0] = meta.sizes[loc_tensor_info - 1];
+          for (int d = 0; d < depth; d++) {
+            meta.addresses[d][0] = meta.addresses[d][loc_tensor_info - 1];
+          }
+          loc_tensor_info = 1;
+        }
+      }
+    }
+  }
+}
+
+}} // namespace at::native
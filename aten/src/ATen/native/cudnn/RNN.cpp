@@ -10,6 +10,8 @@
 #include <ATen/cuda/Exceptions.h>
 #include <c10/util/Exception.h>
 
+#include <cstdlib>
+
 #if !AT_CUDNN_ENABLED()
 
 namespace at { namespace native {
@@ -577,12 +579,45 @@ namespace {
     }
   }
 
+  // Note [Small-batch persistent RNN]
+  // The default persistent-algorithm heuristic below targets large
+  // half-precision batches on Volta, where it beats the standard algorithm
+  // on throughput. For small-batch streaming inference (batch-1 ASR being
+  // the canonical case) the bottleneck is different: the standard algorithm
+  // launches several kernels per timestep and the launches dominate the
+  // runtime. CUDNN_RNN_ALGO_PERSIST_STATIC runs a grid-resident kernel that
+  // keeps the recurrent weights cached on-chip across all timesteps, which
+  // is exactly the right trade when the batch is small enough that
+  // occupancy does not matter. The throughput heuristic can't tell these
+  // workloads apart, so the small-batch path is opt-in via
+  // PYTORCH_CUDNN_PERSISTENT_RNN=1 and is gated to configurations where
+  // the weights actually fit on-chip (unidirectional, float or half, small
+  // hidden size); everything else keeps the standard algorithm.
+  bool small_batch_persistent_enabled() {
+    static bool enabled = []() {
+      const char* env = getenv("PYTORCH_CUDNN_PERSISTENT_RNN");
+      return env && env[0] == '1' && env[1] == '\0';
+    }();
+    return enabled;
+  }
+
   cudnnRNNAlgo_t get_algo(const RNNDescriptorParams& rnn, const TensorDescriptorListParams& tensors, const Tensor input){
 #if CUDNN_VERSION < 7200 || CUDA_VERSION < 9010
       return CUDNN_RNN_ALGO_STANDARD;
 #else
       cudaDeviceProp* prop = at::cuda::getCurrentDeviceProperties();
       const int64_t bsize = tensors.mini_batch;
+      // See Note [Small-batch persistent RNN]
+      if (small_batch_persistent_enabled() && prop->major >= 6 &&
+              !tensors.is_input_packed() && rnn.num_directions() == 1 &&
+              bsize <= 32) {
+          cudnnDataType_t datatype = getCudnnDataType(input);
+          const int64_t max_hidden =
+              datatype == CUDNN_DATA_HALF ? 1024 : datatype == CUDNN_DATA_FLOAT ? 512 : 0;
+          if (rnn.hidden_size <= max_hidden) {
+              return CUDNN_RNN_ALGO_PERSIST_STATIC;
+          }
+      }
       //excluding Turing from using persistent rnn.
       if (prop->major == 7 && prop->minor != 5 && getCudnnDataType(input) == CUDNN_DATA_HALF && !tensors.is_input_packed()) {
           if (rnn.num_layers == 1 && rnn.hidden_size <= 1024 && rnn.num_directions() == 1 &&
@@ -60,6 +60,133 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_backward_cpu(
   return std::make_tuple(std::move(dX), std::move(dgamma), std::move(dbeta));
 }
 
+std::tuple<Tensor, Tensor, Tensor, Tensor> add_layer_norm_cpu(
+    const Tensor& input,
+    const Tensor& residual,
+    const Tensor& gamma /* optional */,
+    const Tensor& beta /* optional */,
+    int64_t M,
+    int64_t N,
+    double eps) {
+  TORCH_CHECK(
+      input.sizes() == residual.sizes(),
+      "Expected input and residual to have matching sizes, but got ",
+      input.sizes(), " and ", residual.sizes());
+  const auto& A = input.is_contiguous() ? input : input.contiguous();
+  const auto& B = residual.is_contiguous() ? residual : residual.contiguous();
+  Tensor Y = at::native::empty_like(A, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor X = at::native::empty_like(A, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor mean = at::empty({M}, A.options());
+  Tensor rstd = at::empty({M}, A.options());
+  if (M > 0) {
+    AddLayerNormKernel(kCPU, A, B, gamma, beta, M, N, eps, &Y, &X, &mean, &rstd);
+  }
+  return std::make_tuple(
+      std::move(Y), std::move(X), std::move(mean), std::move(rstd));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> add_layer_norm_backward_cpu(
+    const Tensor& dY /* optional */,
+    const Tensor& dsum /* optional */,
+    const Tensor& X,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const Tensor& gamma /* optional */,
+    int64_t M,
+    int64_t N,
+    std::array<bool, 4> grad_input_mask) {
+  Tensor dinput;
+  Tensor dresidual;
+  Tensor dgamma;
+  Tensor dbeta;
+  if (grad_input_mask[0]) {
+    dinput = at::native::empty_like(X, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  }
+  if (grad_input_mask[1]) {
+    dresidual = at::native::empty_like(X, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  }
+  if (grad_input_mask[2]) {
+    dgamma = M > 0 ? at::native::empty_like(gamma, LEGACY_CONTIGUOUS_MEMORY_FORMAT) : at::native::zeros_like(gamma, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  }
+  if (grad_input_mask[3]) {
+    dbeta = M > 0 ? at::native::empty_like(gamma, LEGACY_CONTIGUOUS_MEMORY_FORMAT) : at::native::zeros_like(gamma, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  }
+  if (M > 0) {
+    AddLayerNormBackwardKernel(
+        kCPU, dY, dsum, X, mean, rstd, gamma, M, N,
+        &dinput, &dresidual, &dgamma, &dbeta);
+  }
+  return std::make_tuple(
+      std::move(dinput),
+      std::move(dresidual),
+      std::move(dgamma),
+      std::move(dbeta));
+}
+
+// On CUDA the fusion is not implemented yet; compose the existing kernels so
+// the op dispatches everywhere with identical semantics.
+std::tuple<Tensor, Tensor, Tensor, Tensor> add_layer_norm_cuda(
+    const Tensor& input,
+    const Tensor& residual,
+    const Tensor& gamma /* optional */,
+    const Tensor& beta /* optional */,
+    int64_t M,
+    int64_t N,
+    double eps) {
+  Tensor X = (input + residual).contiguous();
+  Tensor Y;
+  Tensor mean;
+  Tensor rstd;
+  std::tie(Y, mean, rstd) = at::native_layer_norm(X, gamma, beta, M, N, eps);
+  return std::make_tuple(
+      std::move(Y), std::move(X), std::move(mean), std::move(rstd));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> add_layer_norm_backward_cuda(
+    const Tensor& dY /* optional */,
+    const Tensor& dsum /* optional */,
+    const Tensor& X,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const Tensor& gamma /* optional */,
+    int64_t M,
+    int64_t N,
+    std::array<bool, 4> grad_input_mask) {
+  Tensor dX;
+  Tensor dgamma;
+  Tensor dbeta;
+  const bool any_dX = grad_input_mask[0] || grad_input_mask[1];
+  if (dY.defined()) {
+    std::tie(dX, dgamma, dbeta) = at::native_layer_norm_backward(
+        dY.is_contiguous() ? dY : dY.contiguous(),
+        X,
+        mean,
+        rstd,
+        gamma,
+        M,
+        N,
+        {any_dX, grad_input_mask[2], grad_input_mask[3]});
+    if (any_dX && dsum.defined()) {
+      dX = dX.add_(dsum);
+    }
+  } else {
+    if (any_dX) {
+      dX = dsum.defined() ? dsum.clone() : at::zeros_like(X);
+    }
+    if (grad_input_mask[2]) {
+      dgamma = at::zeros_like(gamma);
+    }
+    if (grad_input_mask[3]) {
+      dbeta = at::zeros_like(gamma);
+    }
+  }
+  return std::make_tuple(
+      grad_input_mask[0] ? dX : Tensor(),
+      grad_input_mask[1] ? dX : Tensor(),
+      std::move(dgamma),
+      std::move(dbeta));
+}
+
 Tensor layer_norm(
     const Tensor& input,
     IntArrayRef normalized_shape,
@@ -124,6 +251,8 @@ Tensor layer_norm(
 
 DEFINE_DISPATCH(LayerNormKernel);
 DEFINE_DISPATCH(LayerNormBackwardKernel);
+DEFINE_DISPATCH(AddLayerNormKernel);
+DEFINE_DISPATCH(AddLayerNormBackwardKernel);
 
 } // namespace native
 } // namespace at
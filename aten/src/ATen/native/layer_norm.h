@@ -29,8 +29,43 @@ using backward_fn = void (*)(
     Tensor* /* dgamma */,
     Tensor* /* dbeta */);
 
+// Fused residual-add + layer norm: Y = LN(input + residual). The summed
+// input X is produced in the same pass as the moments and returned so the
+// backward (and the next block's residual stream) can reuse it.
+using add_forward_fn = void (*)(
+    const Tensor& /* input */,
+    const Tensor& /* residual */,
+    const Tensor& /* gamma */,
+    const Tensor& /* beta */,
+    int64_t /* M */,
+    int64_t /* N */,
+    double /* eps */,
+    Tensor* /* Y */,
+    Tensor* /* X */,
+    Tensor* /* mean */,
+    Tensor* /* rstd */);
+
+// dY may be undefined when only the summed output is used downstream; dsum
+// is the incoming gradient of that summed output and is folded into the
+// input/residual gradients in the same pass.
+using add_backward_fn = void (*)(
+    const Tensor& /* dY */,
+    const Tensor& /* dsum */,
+    const Tensor& /* X */,
+    const Tensor& /* mean */,
+    const Tensor& /* rstd */,
+    const Tensor& /* gamma */,
+    int64_t /* M */,
+    int64_t /* N */,
+    Tensor* /* dinput */,
+    Tensor* /* dresidual */,
+    Tensor* /* dgamma */,
+    Tensor* /* dbeta */);
+
 DECLARE_DISPATCH(forward_fn, LayerNormKernel);
 DECLARE_DISPATCH(backward_fn, LayerNormBackwardKernel);
+DECLARE_DISPATCH(add_forward_fn, AddLayerNormKernel);
+DECLARE_DISPATCH(add_backward_fn, AddLayerNormBackwardKernel);
 
 } // namespace native
 } // namespace at
@@ -12,6 +12,12 @@ at::Tensor mkldnn_convolution(
   AT_ERROR("mkldnn_convolution_forward: ATen not compiled with MKLDNN support");
 }
 
+at::Tensor mkldnn_convolution_relu(
+    const at::Tensor& input, const at::Tensor& weight, const at::Tensor& bias,
+    IntArrayRef padding, IntArrayRef stride, IntArrayRef dilation, int64_t groups) {
+  AT_ERROR("mkldnn_convolution_relu: ATen not compiled with MKLDNN support");
+}
+
 at::Tensor mkldnn_convolution_backward_input(
     IntArrayRef input_size, const at::Tensor& grad_output, const at::Tensor& weight,
     IntArrayRef padding, IntArrayRef stride, IntArrayRef dilation, int64_t groups, bool bias_defined) {
@@ -62,7 +68,8 @@ ideep::tensor _mkldnn_conv2d(
     at::IntArrayRef padding,
     at::IntArrayRef stride,
     at::IntArrayRef dilation,
-    int64_t groups) {
+    int64_t groups,
+    const ideep::attr_t& attr = ideep::attr_t()) {
 
   auto kernel_size = w.get_dims();
 
@@ -82,7 +89,11 @@ ideep::tensor _mkldnn_conv2d(
         {dilation.begin(), dilation.end()},
         {padding.begin(), padding.end()},
         {padding.begin(), padding.end()},
-        groups);
+        groups,
+        ideep::scale_t(),
+        ideep::scale_t(),
+        ideep::scale_t(),
+        attr);
   } else {
     ideep::convolution_forward::compute(
         x,
@@ -93,7 +104,11 @@ ideep::tensor _mkldnn_conv2d(
         {dilation.begin(), dilation.end()},
         {padding.begin(), padding.end()},
         {padding.begin(), padding.end()},
-        groups);
+        groups,
+        ideep::scale_t(),
+        ideep::scale_t(),
+        ideep::scale_t(),
+        attr);
   }
   return y;
 }
@@ -130,6 +145,42 @@ at::Tensor mkldnn_convolution(
   }
 }
 
+// Inference-only convolution with the ReLU fused as a post-op, so the
+// activation is applied while the output is still in registers instead of
+// requiring a second pass over memory.
+at::Tensor mkldnn_convolution_relu(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups) {
+  const ideep::tensor mkldnn_input = get_mkldnn_tensor(input);
+  const ideep::tensor mkldnn_weight = get_mkldnn_tensor(weight);
+  c10::optional<ideep::tensor> mkldnn_bias{c10::nullopt};
+  if (bias.defined()) {
+    mkldnn_bias = get_mkldnn_tensor(bias);
+  }
+
+  ideep::tensor mkldnn_output = _mkldnn_conv2d(
+      mkldnn_input,
+      mkldnn_weight,
+      mkldnn_bias,
+      padding,
+      stride,
+      dilation,
+      groups,
+      ideep::attr_t::fuse_relu());
+
+  if (input.is_mkldnn()) {
+    return new_with_itensor_mkldnn(std::move(mkldnn_output), input.options());
+  } else {
+    return mkldnn_to_dense(
+        new_with_itensor_mkldnn(std::move(mkldnn_output), input.options()));
+  }
+}
+
 Tensor mkldnn_convolution_backward_input(
     IntArrayRef input_size, const at::Tensor& grad_output, const at::Tensor& weight,
     IntArrayRef padding, IntArrayRef stride, IntArrayRef dilation, int64_t groups, bool bias_defined)
@@ -0,0 +1,81 @@
+#include <ATen/ATen.h>
+#include <ATen/NativeFunctions.h>
+#include <ATen/Config.h>
+
+#if !AT_MKLDNN_ENABLED()
+
+namespace at { namespace native {
+
+int64_t _mkldnn_get_primitive_cache_capacity() {
+  AT_ERROR("_mkldnn_get_primitive_cache_capacity: ATen not compiled with MKLDNN support");
+}
+
+void _mkldnn_set_primitive_cache_capacity(int64_t capacity) {
+  AT_ERROR("_mkldnn_set_primitive_cache_capacity: ATen not compiled with MKLDNN support");
+}
+
+void _mkldnn_conv2d_prewarm(
+    const Tensor& weight, const Tensor& bias, IntArrayRef input_size,
+    IntArrayRef padding, IntArrayRef stride, IntArrayRef dilation,
+    int64_t groups, bool with_relu) {
+  AT_ERROR("_mkldnn_conv2d_prewarm: ATen not compiled with MKLDNN support");
+}
+
+}}
+
+#else // AT_MKLDNN_EBABLED
+
+#include <ATen/native/mkldnn/MKLDNNCommon.h>
+
+namespace at { namespace native {
+
+// oneDNN keeps a per-process LRU cache of compiled primitives, keyed by the
+// full op signature (shapes, strides, data types and post-op attributes), so
+// repeated calls with the same signature skip descriptor creation and JIT
+// code generation. These functions expose the cache bound the same way
+// _cufft_get/set_plan_cache_max_size does for cuFFT plans. Note the key is
+// the exact signature: serving stacks that bucket request shapes should pad
+// inputs up to the bucket shape and pre-warm one signature per bucket.
+
+int64_t _mkldnn_get_primitive_cache_capacity() {
+  return dnnl::get_primitive_cache_capacity();
+}
+
+void _mkldnn_set_primitive_cache_capacity(int64_t capacity) {
+  TORCH_CHECK(capacity >= 0,
+      "_mkldnn_set_primitive_cache_capacity: capacity must be non-negative, got ",
+      capacity);
+  dnnl::set_primitive_cache_capacity(static_cast<int>(capacity));
+}
+
+// Runs a convolution over a zero-filled input of the given size so that the
+// first latency-critical request with that signature finds the primitive
+// already compiled and cached. `with_relu` pre-warms the fused
+// mkldnn_convolution_relu signature instead, since the post-op attribute is
+// part of the cache key.
+void _mkldnn_conv2d_prewarm(
+    const Tensor& weight,
+    const Tensor& bias,
+    IntArrayRef input_size,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups,
+    bool with_relu) {
+  TORCH_CHECK(input_size.size() == 4,
+      "_mkldnn_conv2d_prewarm: expected a 4-D input size, got ",
+      input_size.size(), " dims");
+
+  auto input = at::zeros(input_size, weight.options().layout(kStrided));
+  if (with_relu) {
+    mkldnn_convolution_relu(
+        input, weight, bias, padding, stride, dilation, groups);
+  } else {
+    mkldnn_convolution(
+        input, weight, bias, padding, stride, dilation, groups);
+  }
+}
+
+}}
+
+#endif // AT_MKLDNN_EBABLED
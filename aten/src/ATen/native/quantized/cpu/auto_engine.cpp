@@ -0,0 +1,111 @@
+#include <ATen/native/quantized/cpu/auto_engine.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace at {
+namespace native {
+namespace auto_engine {
+namespace {
+
+// Note [Auto quantized engine]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// at::globalContext().qEngine() normally picks one backend globally, but
+// the fastest backend depends on the problem: FBGEMM tends to win on large
+// batched problems while QNNPACK wins on small or mobile-shaped ones, on
+// the same machine. QEngine::Auto resolves the choice per (op, shape)
+// instead: the first few calls with a given signature alternate between
+// the two backends while their wall times are recorded, and once both have
+// been sampled the faster one is cached and used from then on.
+//
+// The cache keeps the *minimum* observed time per engine, which is robust
+// to one-off stalls (page faults, frequency ramps) that would skew a mean.
+// Each engine is sampled kSamplesPerEngine times before the choice is
+// frozen so the first, typically allocation-heavy, call does not decide
+// alone. Timings include only the selected call itself; the cache mutex is
+// not held while the op runs.
+//
+// Only ops whose FBGEMM/QNNPACK implementations both consume plain
+// quantized tensors can switch per call. Ops working on prepacked weights
+// (linear, conv) bake their backend into the packed object at prepack
+// time, so under Auto they follow the static engine priority instead.
+constexpr int kSamplesPerEngine = 3;
+
+struct Timings {
+  uint64_t best_ns[2] = {0, 0};
+  int samples[2] = {0, 0};
+};
+
+// 0 = FBGEMM, 1 = QNNPACK
+inline int slot_of(QEngine engine) {
+  return engine == QEngine::QNNPACK ? 1 : 0;
+}
+
+struct Cache {
+  std::mutex mutex;
+  std::unordered_map<std::string, Timings> timings;
+};
+
+Cache& cache() {
+  static Cache instance;
+  return instance;
+}
+
+std::string key_of(const char* op, uint64_t signature) {
+  return std::string(op) + ":" + std::to_string(signature);
+}
+
+QEngine choose(const char* op, uint64_t signature) {
+  Cache& c = cache();
+  std::lock_guard<std::mutex> guard(c.mutex);
+  const Timings& t = c.timings[key_of(op, signature)];
+  if (t.samples[0] < kSamplesPerEngine) {
+    return QEngine::FBGEMM;
+  }
+  if (t.samples[1] < kSamplesPerEngine) {
+    return QEngine::QNNPACK;
+  }
+  return t.best_ns[0] <= t.best_ns[1] ? QEngine::FBGEMM : QEngine::QNNPACK;
+}
+
+void report(const char* op, uint64_t signature, QEngine engine, uint64_t nanos) {
+  Cache& c = cache();
+  std::lock_guard<std::mutex> guard(c.mutex);
+  Timings& t = c.timings[key_of(op, signature)];
+  const int slot = slot_of(engine);
+  if (t.samples[slot] == 0 || nanos < t.best_ns[slot]) {
+    t.best_ns[slot] = nanos;
+  }
+  if (t.samples[slot] < kSamplesPerEngine) {
+    ++t.samples[slot];
+  }
+}
+
+} // namespace
+
+uint64_t signature_of(IntArrayRef sizes) {
+  // FNV-1a over the dimensions; collisions only cost a slightly less
+  // appropriate engine choice for the colliding shape.
+  uint64_t h = 14695981039346656037ULL;
+  for (int64_t size : sizes) {
+    h = (h ^ static_cast<uint64_t>(size)) * 1099511628211ULL;
+  }
+  return h;
+}
+
+EngineSelection::EngineSelection(const char* op, uint64_t signature)
+    : op_(op),
+      signature_(signature),
+      engine_(choose(op, signature)),
+      start_(std::chrono::steady_clock::now()) {}
+
+EngineSelection::~EngineSelection() {
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start_);
+  report(op_, signature_, engine_, static_cast<uint64_t>(elapsed.count()));
+}
+
+} // namespace auto_engine
+} // namespace native
+} // namespace at
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <c10/core/QEngine.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace at {
+namespace native {
+namespace auto_engine {
+
+// Support for QEngine::Auto: per-(op, shape) selection between FBGEMM and
+// QNNPACK backed by a timing cache. See Note [Auto quantized engine] in
+// auto_engine.cpp. Ops with implementations for both backends integrate by
+// constructing an EngineSelection around the call and dispatching on
+// selection.engine().
+
+// Hashes a shape into the problem signature for the cache.
+uint64_t signature_of(IntArrayRef sizes);
+
+// Picks the engine for one call of `op` (a string literal naming the
+// operator) on the problem `signature`, then times the scoped call and
+// feeds the measurement back into the cache on destruction.
+class EngineSelection final {
+ public:
+  EngineSelection(const char* op, uint64_t signature);
+  ~EngineSelection();
+
+  EngineSelection(const EngineSelection&) = delete;
+  EngineSelection& operator=(const EngineSelection&) = delete;
+
+  QEngine engine() const {
+    return engine_;
+  }
+
+ private:
+  const char* op_;
+  uint64_t signature_;
+  QEngine engine_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace auto_engine
+} // namespace native
+} // namespace at
@@ -6,8 +6,13 @@
 #include "fbgemm/QuantUtils.h"
 
 #include <ATen/Tensor.h>
+#include <ATen/native/quantized/cpu/packed_weight_cache.h>
 #include <c10/core/QScheme.h>
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 // The struct for the packed weight matrix (PackBMatrix) and the corresponding
 // column offsets used for the fully connect layer, which are both prepared in
 // the prepacking step to save the computations in the inference. Note the
@@ -18,7 +23,9 @@
 // (affine quantization) of input matrix.
 // Note that in JIT mode we can think of a way to fuse col_offsets with bias.
 struct CAFFE2_API PackedLinearWeight {
-  std::unique_ptr<fbgemm::PackBMatrix<int8_t>> w;
+  // Shared so that modules packing identical weights reuse one PackBMatrix.
+  // See Note [Prepacked weight cache].
+  std::shared_ptr<fbgemm::PackBMatrix<int8_t>> w;
   c10::optional<at::Tensor> bias;
   std::vector<int32_t> col_offsets;
   std::vector<float> w_scale;
@@ -33,13 +40,20 @@ struct CAFFE2_API PackedLinearWeightFp16 {
 
 template <int kSpatialDim = 2>
 struct CAFFE2_API PackedConvWeight {
-  std::unique_ptr<fbgemm::PackWeightsForConv<kSpatialDim>> w;
+  // Shared across instances packing identical weights, like
+  // PackedLinearWeight::w. See Note [Prepacked weight cache].
+  std::shared_ptr<fbgemm::PackWeightsForConv<kSpatialDim>> w;
   c10::optional<at::Tensor> bias;
   std::vector<int32_t> col_offsets;
   std::vector<int64_t> kernel;
   std::vector<float> w_scale;
   std::vector<int32_t> w_zp;
   c10::QScheme q_scheme;
+  // Channels-last copy of the original quantized weight, kept for 2D conv
+  // only so that small feature maps can take the direct convolution path
+  // instead of FBGEMM's im2col-based one. See
+  // Note [Direct conv for small spatial sizes] in qconv.cpp.
+  at::Tensor weight_nhwc;
 };
 
 // PackWeight: Convert the weight from uint8 to int8.
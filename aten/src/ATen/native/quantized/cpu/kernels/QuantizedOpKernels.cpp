@@ -1,5 +1,6 @@
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/UpSample.h>
 #include <ATen/native/cpu/Loops.h>
@@ -676,6 +677,68 @@ void qadd_kernel(Tensor& out, const Tensor& self, const Tensor& other) {
   });
 }
 
+// Fused addition followed by a clamp in the output quantized domain, so the
+// chain runs in one pass with a single requantization. ReLU6 is the
+// clamp(0, 6) special case. The clamp bounds are quantized with the output
+// qparams, which matches applying qclamp_kernel on the requantized sum.
+// Note: out is assumed to be the same size as self and other.
+void qadd_clamp_kernel(
+    Tensor& out,
+    const Tensor& self,
+    const Tensor& other,
+    Scalar min_scalar,
+    Scalar max_scalar) {
+  int64_t zero_point = out.q_zero_point();
+  float scale = out.q_scale();
+  float inv_scale = 1.0f / scale;
+  int64_t self_zero_point = self.q_zero_point();
+  float self_scale = self.q_scale();
+  int64_t other_zero_point = other.q_zero_point();
+  float other_scale = other.q_scale();
+
+  auto self_zero_point_vec = Vec256<float>((float)self_zero_point);
+  auto self_scale_vec = Vec256<float>(self_scale);
+  auto other_zero_point_vec = Vec256<float>((float)other_zero_point);
+  auto other_scale_vec = Vec256<float>(other_scale);
+
+  auto self_scale_neg_zp_premul_vec = self_scale_vec * self_zero_point_vec.neg();
+  auto other_scale_zp_premul_vec = other_scale_vec * other_zero_point_vec.neg();
+
+  auto iter = TensorIterator::binary_op(out, self, other);
+
+  AT_DISPATCH_QINT_TYPES(out.scalar_type(), "qadd_clamp", [&]() {
+    using Vec = Vec256<scalar_t>;
+    scalar_t min_q = at::quantize_val<scalar_t>(
+        scale, zero_point, min_scalar.to<float>());
+    scalar_t max_q = at::quantize_val<scalar_t>(
+        scale, zero_point, max_scalar.to<float>());
+    auto min_vec = Vec(min_q);
+    auto max_vec = Vec(max_q);
+    cpu_kernel_vec(
+        iter,
+        [&](scalar_t a, scalar_t b) -> scalar_t {
+          const auto da = at::dequantize_val(self_scale, self_zero_point, a);
+          const auto db = at::dequantize_val(other_scale, other_zero_point, b);
+          scalar_t c = at::quantize_val<scalar_t>(scale, zero_point, da + db);
+          underlying_t min_clamped =
+              std::max<underlying_t>(c.val_, min_q.val_);
+          return scalar_t(std::min<underlying_t>(min_clamped, max_q.val_));
+        },
+        [&](Vec a, Vec b) -> Vec {
+          const auto da = a.dequantize(
+              self_scale_vec, self_zero_point_vec, self_scale_neg_zp_premul_vec);
+          const auto db = b.dequantize(
+              other_scale_vec, other_zero_point_vec, other_scale_zp_premul_vec);
+          Vec::float_vec_return_type retvals;
+          for (int i = 0; i < Vec::float_num_vecs(); ++i) {
+            retvals[i] = da[i] + db[i];
+          }
+          auto rv = Vec::quantize(retvals, scale, zero_point, inv_scale);
+          return rv.maximum(min_vec).minimum(max_vec);
+        });
+  });
+}
+
 // Note: out is assumed to be the same size as self and other.
 // Note: Multiplication is only supported when self, other, out are of the same
 // dtype.
@@ -728,6 +791,65 @@ void qmul_kernel(Tensor& out, const Tensor& self, const Tensor& other) {
   });
 }
 
+// Fused multiplication followed by a clamp in the output quantized domain,
+// mirroring qadd_clamp_kernel. The product stays in the integer domain like
+// qmul_kernel, so the only extra cost over a plain mul is the final min/max.
+// Note: out is assumed to be the same size as self and other.
+void qmul_clamp_kernel(
+    Tensor& out,
+    const Tensor& self,
+    const Tensor& other,
+    Scalar min_scalar,
+    Scalar max_scalar) {
+  int64_t zero_point = out.q_zero_point();
+  float scale = out.q_scale();
+  float inv_scale = 1.0f / scale;
+  int64_t self_zero_point = self.q_zero_point();
+  float self_scale = self.q_scale();
+  int64_t other_zero_point = other.q_zero_point();
+  float other_scale = other.q_scale();
+
+  float multiplier = self_scale * other_scale * inv_scale;
+
+  auto iter = TensorIterator::binary_op(out, self, other);
+
+  AT_DISPATCH_QINT_TYPES(out.scalar_type(), "qmul_clamp", [&]() {
+    using Vec = Vec256<scalar_t>;
+    scalar_t min_q = at::quantize_val<scalar_t>(
+        scale, zero_point, min_scalar.to<float>());
+    scalar_t max_q = at::quantize_val<scalar_t>(
+        scale, zero_point, max_scalar.to<float>());
+    auto min_vec = Vec(min_q);
+    auto max_vec = Vec(max_q);
+    cpu_kernel_vec(
+        iter,
+        [&](scalar_t a, scalar_t b) -> scalar_t {
+          int32_t a_sub_z = static_cast<int32_t>(a.val_) -
+              static_cast<int32_t>(self_zero_point);
+          int32_t b_sub_z = static_cast<int32_t>(b.val_) -
+              static_cast<int32_t>(other_zero_point);
+          int32_t c = a_sub_z * b_sub_z;
+          scalar_t res =
+              at::requantize_from_int<scalar_t>(multiplier, zero_point, c);
+          underlying_t min_clamped =
+              std::max<underlying_t>(res.val_, min_q.val_);
+          return scalar_t(std::min<underlying_t>(min_clamped, max_q.val_));
+        },
+        [&](Vec a, Vec b) -> Vec {
+          Vec::int_vec_return_type a_sub_zp =
+              a.widening_subtract(Vec(static_cast<scalar_t>(self_zero_point)));
+          Vec::int_vec_return_type b_sub_zp =
+              b.widening_subtract(Vec(static_cast<scalar_t>(other_zero_point)));
+          Vec::int_vec_return_type c;
+          for (int i = 0; i < Vec::int_num_vecs(); ++i) {
+            c[i] = a_sub_zp[i] * b_sub_zp[i];
+          }
+          Vec rv = Vec::requantize_from_int(c, multiplier, zero_point);
+          return rv.maximum(min_vec).minimum(max_vec);
+        });
+  });
+}
+
 void qmaxpool_2d_nhwc_kernel(
     const Tensor& qx,
     int64_t iC, // input/output channels
@@ -1476,6 +1598,171 @@ void q_batch_norm_kernel(
 
 }
 
+// Note [Quantized layer norm and softmax]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// These kernels take quantized input and produce quantized output without
+// materializing a dequantized copy of the tensor, so transformer blocks can
+// stay in the quantized domain between linear layers.
+//
+// Layer norm: the row statistics are computed from the raw integer values.
+// With x = s * (q - z) over a row of N elements,
+//   mean(x) = s * (sum(q) / N - z)
+//   var(x)  = s^2 * (sum(q^2) / N - (sum(q) / N)^2)
+// so a single pass accumulating sum(q) and sum(q^2) in int64 suffices; the
+// input scale cancels out of (x - mean) / sigma up to the gamma/beta affine
+// term, which is applied in float per element before requantization.
+//
+// Softmax: subtracting the row max in the integer domain means exp() is only
+// ever evaluated at s * d for integer d in [-(q_max - q_min), 0], so for
+// 8-bit types all 256 possible values are precomputed into a lookup table
+// once per call and each element costs a table load, an accumulate and a
+// divide.
+void qlayer_norm_kernel(
+    const Tensor& qx,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor& qy) {
+  AT_DISPATCH_QINT_TYPES(qx.scalar_type(), "qlayer_norm", [&]() {
+    const underlying_t* X =
+        reinterpret_cast<underlying_t*>(qx.data_ptr<scalar_t>());
+    underlying_t* Y = reinterpret_cast<underlying_t*>(qy.data_ptr<scalar_t>());
+    const float* gamma_data =
+        gamma.defined() ? gamma.data_ptr<float>() : nullptr;
+    const float* beta_data = beta.defined() ? beta.data_ptr<float>() : nullptr;
+
+    const float x_scale = qx.q_scale();
+    const int64_t x_zp = qx.q_zero_point();
+    const float y_scale = qy.q_scale();
+    const float y_inv_scale = 1.0f / y_scale;
+    const int64_t y_zp = qy.q_zero_point();
+    constexpr int64_t q_min = std::numeric_limits<underlying_t>::min();
+    constexpr int64_t q_max = std::numeric_limits<underlying_t>::max();
+
+    at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+      for (int64_t i = start; i < end; ++i) {
+        const underlying_t* X_row = X + i * N;
+        underlying_t* Y_row = Y + i * N;
+
+        // Integer accumulation; see Note [Quantized layer norm and softmax].
+        int64_t sum = 0;
+        int64_t sum_sq = 0;
+        for (int64_t j = 0; j < N; ++j) {
+          const int64_t v = X_row[j];
+          sum += v;
+          sum_sq += v * v;
+        }
+        // E[q^2] - E[q]^2 suffers from cancellation when the values sit far
+        // from zero (e.g. quint8 near 255), so the division is done in
+        // double; the integer sums themselves are exact.
+        const double mean_q = static_cast<double>(sum) / N;
+        const double var_q =
+            static_cast<double>(sum_sq) / N - mean_q * mean_q;
+        const double var =
+            var_q * static_cast<double>(x_scale) * x_scale;
+        const float inv_sigma =
+            static_cast<float>(1.0 / std::sqrt(var + eps));
+        // (x - mean) / sigma = (q - mean_q) * x_scale * inv_sigma; the input
+        // zero point cancels in the subtraction.
+        const float alpha = x_scale * inv_sigma;
+
+        for (int64_t j = 0; j < N; ++j) {
+          float y = alpha * (X_row[j] - mean_q);
+          if (gamma_data) {
+            y *= gamma_data[j];
+          }
+          if (beta_data) {
+            y += beta_data[j];
+          }
+          const int64_t quantized_down =
+              y_zp + lrintf(y * y_inv_scale);
+          Y_row[j] = std::min<int64_t>(
+              std::max<int64_t>(quantized_down, q_min), q_max);
+        }
+      }
+    });
+  });
+}
+
+// The exp lookup table is only viable for 8-bit types; qint32 input is
+// rejected at the op level in qsoftmax.cpp.
+template <typename scalar_t>
+void qsoftmax_kernel_impl(
+    const Tensor& qx,
+    int64_t M,
+    int64_t N,
+    Tensor& qy) {
+  using underlying_t = typename scalar_t::underlying;
+  static_assert(
+      sizeof(underlying_t) == 1,
+      "quantized softmax only supports 8 bit quantized types");
+  const underlying_t* X =
+      reinterpret_cast<underlying_t*>(qx.data_ptr<scalar_t>());
+  underlying_t* Y = reinterpret_cast<underlying_t*>(qy.data_ptr<scalar_t>());
+
+  const float x_scale = qx.q_scale();
+  const float y_inv_scale = 1.0f / static_cast<float>(qy.q_scale());
+  const int64_t y_zp = qy.q_zero_point();
+  constexpr int64_t q_min = std::numeric_limits<underlying_t>::min();
+  constexpr int64_t q_max = std::numeric_limits<underlying_t>::max();
+
+  // exp((q - q_row_max) * x_scale) only depends on the integer difference
+  // d = q_row_max - q, which fits in [0, 255] for 8-bit types. See
+  // Note [Quantized layer norm and softmax].
+  constexpr int kLutSize = static_cast<int>(q_max - q_min) + 1;
+  float exp_lut[kLutSize];
+  for (int d = 0; d < kLutSize; ++d) {
+    exp_lut[d] = std::exp(-x_scale * d);
+  }
+
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i) {
+      const underlying_t* X_row = X + i * N;
+      underlying_t* Y_row = Y + i * N;
+
+      underlying_t row_max = X_row[0];
+      for (int64_t j = 1; j < N; ++j) {
+        row_max = std::max(row_max, X_row[j]);
+      }
+      float sum = 0.0f;
+      for (int64_t j = 0; j < N; ++j) {
+        sum += exp_lut[row_max - X_row[j]];
+      }
+      const float inv_sum = 1.0f / sum;
+      for (int64_t j = 0; j < N; ++j) {
+        const float y = exp_lut[row_max - X_row[j]] * inv_sum;
+        const int64_t quantized_down = y_zp + lrintf(y * y_inv_scale);
+        Y_row[j] = std::min<int64_t>(
+            std::max<int64_t>(quantized_down, q_min), q_max);
+      }
+    }
+  });
+}
+
+void qsoftmax_kernel(
+    const Tensor& qx,
+    int64_t M,
+    int64_t N,
+    Tensor& qy) {
+  if (qx.scalar_type() == at::kQUInt8) {
+    qsoftmax_kernel_impl<c10::quint8>(qx, M, N, qy);
+  } else if (qx.scalar_type() == at::kQInt8) {
+    qsoftmax_kernel_impl<c10::qint8>(qx, M, N, qy);
+  } else {
+    TORCH_CHECK(
+        false,
+        "quantized softmax only supports quint8 and qint8, got ",
+        qx.scalar_type());
+  }
+}
+
+// The fake quant kernels fuse quantize + clamp + dequantize into one pass
+// and provide a Vec256 path; cpu_kernel_vec parallelizes over the iterator
+// with at::parallel_for internally, which matters for QAT throughput where
+// fake quant runs on every activation and weight each step. The vector
+// round() matches the scalar std::nearbyint (round half to even).
 void fake_quantize_tensor_kernel(
     Tensor& output,
     const Tensor& input,
@@ -1484,17 +1771,31 @@ void fake_quantize_tensor_kernel(
     int64_t quant_min,
     int64_t quant_max) {
   float inv_scale = 1.0f / sc;
+  float z_point_f = static_cast<float>(z_point);
+  using fVec = Vec256<float>;
+  fVec inv_scale_v(inv_scale);
+  fVec z_point_v(z_point_f);
+  fVec scale_v(sc);
+  fVec quant_min_v(static_cast<float>(quant_min));
+  fVec quant_max_v(static_cast<float>(quant_max));
   auto iter = TensorIterator::unary_op(output, input);
-  cpu_kernel(iter, [&](float self) -> float {
-    return (std::fmin(
-                std::fmax(
-                    static_cast<int64_t>(
-                        std::nearbyint(self * inv_scale + z_point)),
-                    quant_min),
-                quant_max) -
-            z_point) *
-        sc;
-  });
+  cpu_kernel_vec(
+      iter,
+      [&](float self) -> float {
+        return (std::fmin(
+                    std::fmax(
+                        static_cast<int64_t>(
+                            std::nearbyint(self * inv_scale + z_point)),
+                        quant_min),
+                    quant_max) -
+                z_point) *
+            sc;
+      },
+      [&](fVec self) -> fVec {
+        auto xq = vec256::clamp(
+            (self * inv_scale_v + z_point_v).round(), quant_min_v, quant_max_v);
+        return (xq - z_point_v) * scale_v;
+      });
 }
 
 void fake_quantize_grad_tensor_kernel(
@@ -1506,35 +1807,74 @@ void fake_quantize_grad_tensor_kernel(
     int64_t quant_min,
     int64_t quant_max) {
   float inv_scale = 1.0f / sc;
+  float z_point_f = static_cast<float>(z_point);
+  using fVec = Vec256<float>;
+  fVec inv_scale_v(inv_scale);
+  fVec z_point_v(z_point_f);
+  fVec quant_min_v(static_cast<float>(quant_min));
+  fVec quant_max_v(static_cast<float>(quant_max));
   auto iter = TensorIterator::binary_op(input_grad, input, output_grad);
-  cpu_kernel(iter, [&](float x, float dy) -> float {
-    int64_t xq = static_cast<int64_t>(std::nearbyint(x * inv_scale + z_point));
-    return dy * (xq >= quant_min && xq <= quant_max);
-  });
+  cpu_kernel_vec(
+      iter,
+      [&](float x, float dy) -> float {
+        int64_t xq =
+            static_cast<int64_t>(std::nearbyint(x * inv_scale + z_point));
+        return dy * (xq >= quant_min && xq <= quant_max);
+      },
+      [&](fVec x, fVec dy) -> fVec {
+        auto xq = (x * inv_scale_v + z_point_v).round();
+        // The comparisons produce all-ones/all-zeros lane masks.
+        return dy & (xq >= quant_min_v) & (xq <= quant_max_v);
+      });
 }
 
+// NB: zero_point arrives as a float tensor here (converted by the op layer
+// in fake_quant_per_channel_affine.cpp) so that all iterator inputs share
+// one lane width and the kernel can be vectorized.
 void fake_quant_per_channel_cpu(TensorIterator &iter, int64_t quant_min, int64_t quant_max) {
-  cpu_kernel(iter,
-    [=](float self, float scale, int64_t zero_point) -> float {
-      float inv_scale = 1.0f / scale;
-      return (std::fmin(
-                std::fmax(
-                    static_cast<int64_t>(
-                        std::nearbyint(self * inv_scale + zero_point)),
-                    quant_min),
-                quant_max) -
-            zero_point) *
-        scale;
-    });
+  using fVec = Vec256<float>;
+  fVec quant_min_v(static_cast<float>(quant_min));
+  fVec quant_max_v(static_cast<float>(quant_max));
+  fVec one_v(1.0f);
+  cpu_kernel_vec(
+      iter,
+      [=](float self, float scale, float zero_point) -> float {
+        float inv_scale = 1.0f / scale;
+        return (std::fmin(
+                    std::fmax(
+                        static_cast<int64_t>(
+                            std::nearbyint(self * inv_scale + zero_point)),
+                        quant_min),
+                    quant_max) -
+                zero_point) *
+            scale;
+      },
+      [&](fVec self, fVec scale, fVec zero_point) -> fVec {
+        auto inv_scale = one_v / scale;
+        auto xq = vec256::clamp(
+            (self * inv_scale + zero_point).round(), quant_min_v, quant_max_v);
+        return (xq - zero_point) * scale;
+      });
 }
 
 void fake_quant_grad_per_channel_cpu(TensorIterator &iter, int64_t quant_min, int64_t quant_max) {
-  cpu_kernel(iter,
-    [=](float x, float dy, float scale, int64_t zero_point) -> float {
-      float inv_scale = 1.0f / scale;
-      int64_t xq = static_cast<int64_t>(std::nearbyint(x * inv_scale + zero_point));
-      return dy * (xq >= quant_min && xq <= quant_max);
-    });
+  using fVec = Vec256<float>;
+  fVec quant_min_v(static_cast<float>(quant_min));
+  fVec quant_max_v(static_cast<float>(quant_max));
+  fVec one_v(1.0f);
+  cpu_kernel_vec(
+      iter,
+      [=](float x, float dy, float scale, float zero_point) -> float {
+        float inv_scale = 1.0f / scale;
+        int64_t xq = static_cast<int64_t>(
+            std::nearbyint(x * inv_scale + zero_point));
+        return dy * (xq >= quant_min && xq <= quant_max);
+      },
+      [&](fVec x, fVec dy, fVec scale, fVec zero_point) -> fVec {
+        auto inv_scale = one_v / scale;
+        auto xq = (x * inv_scale + zero_point).round();
+        return dy & (xq >= quant_min_v) & (xq <= quant_max_v);
+      });
 }
 
 } // namespace
@@ -1550,10 +1890,12 @@ REGISTER_DISPATCH(qhardswish_stub, &qhardswish_kernel);
 REGISTER_DISPATCH(qelu_stub, &qelu_kernel);
 REGISTER_DISPATCH(qadd_relu_stub, &qadd_kernel<true>);
 REGISTER_DISPATCH(qadd_stub, &qadd_kernel<false>);
+REGISTER_DISPATCH(qadd_clamp_stub, &qadd_clamp_kernel);
 REGISTER_DISPATCH(qadd_scalar_relu_stub, &qadd_scalar_kernel<true>);
 REGISTER_DISPATCH(qadd_scalar_stub, &qadd_scalar_kernel<false>);
 REGISTER_DISPATCH(qmul_relu_stub, &qmul_kernel<true>);
 REGISTER_DISPATCH(qmul_stub, &qmul_kernel<false>);
+REGISTER_DISPATCH(qmul_clamp_stub, &qmul_clamp_kernel);
 REGISTER_DISPATCH(qmaxpool_2d_nhwc_stub, &qmaxpool_2d_nhwc_kernel);
 REGISTER_DISPATCH(
     qadaptive_avg_pool2d_nhwc_stub,
@@ -1568,6 +1910,8 @@ REGISTER_DISPATCH(qcat_relu_nhwc_stub, &qcat_nhwc_kernel<true>);
 REGISTER_DISPATCH(qtopk_stub, &qtopk_kernel);
 REGISTER_DISPATCH(qbatch_norm_stub, &q_batch_norm_kernel<false>);
 REGISTER_DISPATCH(qbatch_norm_relu_stub, &q_batch_norm_kernel<true>);
+REGISTER_DISPATCH(qlayer_norm_stub, &qlayer_norm_kernel);
+REGISTER_DISPATCH(qsoftmax_stub, &qsoftmax_kernel);
 REGISTER_DISPATCH(fake_quant_tensor_stub, &fake_quantize_tensor_kernel);
 REGISTER_DISPATCH(fake_quant_grad_tensor_stub, &fake_quantize_grad_tensor_kernel);
 REGISTER_DISPATCH(fake_quant_per_channel_stub, &fake_quant_per_channel_cpu);
@@ -0,0 +1,54 @@
+#include <ATen/native/quantized/cpu/packed_weight_cache.h>
+
+namespace at {
+namespace native {
+
+namespace {
+
+// One 64-bit FNV-1a pass over the weight bytes and packing parameters.
+// Called with two different offset basis / prime pairs to build the 128-bit
+// fingerprint. See Note [Prepacked weight cache] in packed_weight_cache.h.
+uint64_t Fnv1aHash(
+    const uint8_t* data,
+    size_t size_bytes,
+    const std::vector<int64_t>& packing_params,
+    uint64_t offset_basis,
+    uint64_t prime) {
+  uint64_t hash = offset_basis;
+  for (size_t i = 0; i < size_bytes; ++i) {
+    hash = (hash ^ data[i]) * prime;
+  }
+  for (const int64_t param : packing_params) {
+    for (int shift = 0; shift < 64; shift += 8) {
+      hash = (hash ^ static_cast<uint8_t>(param >> shift)) * prime;
+    }
+  }
+  return hash;
+}
+
+} // namespace
+
+WeightFingerprint FingerprintWeight(
+    const void* data,
+    size_t size_bytes,
+    const std::vector<int64_t>& packing_params) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  return WeightFingerprint{
+      Fnv1aHash(
+          bytes,
+          size_bytes,
+          packing_params,
+          /*offset_basis=*/0xcbf29ce484222325ULL,
+          /*prime=*/0x100000001b3ULL),
+      // Second pass with a different basis and a large random odd prime, so
+      // that the two halves do not collide together.
+      Fnv1aHash(
+          bytes,
+          size_bytes,
+          packing_params,
+          /*offset_basis=*/0x9e3779b97f4a7c15ULL,
+          /*prime=*/0xc6a4a7935bd1e995ULL)};
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace at {
+namespace native {
+
+// Note [Prepacked weight cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// quantized::linear_prepack and quantized::conv2d_prepack pack weights per
+// module instance. Processes that load many models sharing backbone weights
+// (e.g., multi-tenant inference servers, or an app instantiating the same
+// mobile model several times) end up with one packed buffer per instance
+// even when the weight contents are identical.
+//
+// To deduplicate them, packed weight matrices are kept in a
+// content-addressed cache keyed by a 128-bit fingerprint of the raw weight
+// bytes and the packing parameters (shapes, conv geometry, and — for
+// QNNPACK, which bakes the input-scale-requantized bias into the packed
+// buffer — the input scale and bias contents). Packing an already-seen
+// weight returns a shared_ptr to the existing packed matrix, which is safe
+// because both FBGEMM and QNNPACK only read packed buffers during GEMM
+// execution and unpacking. The cache holds weak references, so packed
+// weights are freed as usual when the last module using them goes away.
+//
+// FBGEMM packs eagerly at prepack time; QNNPACK defers packing to the
+// first run, when the input scale is known, and replaces its packed buffer
+// if the input scale later changes — each of those (re)packs goes through
+// the cache, so only the holder's shared_ptr is swapped and other modules
+// keep their buffers.
+//
+// Keying by fingerprint only (without comparing the full weight bytes on a
+// hit) means a 128-bit hash collision would silently alias two different
+// weights. With two independent 64-bit hashes the probability is negligible
+// for any realistic number of distinct weight tensors.
+struct WeightFingerprint {
+  uint64_t lo;
+  uint64_t hi;
+
+  bool operator==(const WeightFingerprint& other) const {
+    return lo == other.lo && hi == other.hi;
+  }
+};
+
+struct WeightFingerprintHash {
+  size_t operator()(const WeightFingerprint& fp) const {
+    return fp.lo ^ fp.hi;
+  }
+};
+
+// Computes the 128-bit content fingerprint of a weight buffer combined with
+// the given packing parameters. See Note [Prepacked weight cache].
+CAFFE2_API WeightFingerprint FingerprintWeight(
+    const void* data,
+    size_t size_bytes,
+    const std::vector<int64_t>& packing_params);
+
+// Encodes a floating-point packing parameter bit-exactly for use in the
+// packing_params of FingerprintWeight (plain casting would collapse e.g.
+// nearby input scales onto one key).
+inline int64_t FingerprintScalarBits(double value) {
+  int64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// Returns the cached packed weight for the given fingerprint, or invokes
+// `factory` to create (and cache) it. See Note [Prepacked weight cache].
+template <typename T, typename Factory>
+std::shared_ptr<T> LookupOrCreatePackedWeight(
+    const WeightFingerprint& key,
+    const Factory& factory) {
+  static std::mutex mutex;
+  static std::unordered_map<WeightFingerprint, std::weak_ptr<T>, WeightFingerprintHash>
+      cache;
+  std::lock_guard<std::mutex> guard(mutex);
+  const auto it = cache.find(key);
+  if (it != cache.end()) {
+    if (auto cached = it->second.lock()) {
+      return cached;
+    }
+  }
+  // Drop entries whose packed weights have been freed in the meantime.
+  for (auto entry = cache.begin(); entry != cache.end();) {
+    entry = entry->second.expired() ? cache.erase(entry) : std::next(entry);
+  }
+  std::shared_ptr<T> packed = factory();
+  cache[key] = packed;
+  return packed;
+}
+
+} // namespace native
+} // namespace at
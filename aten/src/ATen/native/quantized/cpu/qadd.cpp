@@ -5,6 +5,7 @@
 #include <ATen/native/cpu/Loops.h>
 #include <ATen/quantized/Quantizer.h>
 #include <ATen/native/quantized/cpu/quantized_ops.h>
+#include <ATen/native/quantized/cpu/auto_engine.h>
 #include <ATen/native/quantized/cpu/init_qnnpack.h>
 #include <ATen/native/quantized/cpu/qnnpack_utils.h>
 #include <caffe2/utils/threadpool/ThreadPoolMobile.h>
@@ -15,6 +16,7 @@ namespace at {
 namespace native {
 
 DEFINE_DISPATCH(qadd_relu_stub);
+DEFINE_DISPATCH(qadd_clamp_stub);
 DEFINE_DISPATCH(qadd_stub);
 DEFINE_DISPATCH(qadd_scalar_relu_stub);
 DEFINE_DISPATCH(qadd_scalar_stub);
@@ -201,11 +203,33 @@ Tensor qnnpack_add(Tensor qa, Tensor qb, double scale, int64_t zero_point) {
   Tensor operator()(Tensor qa, Tensor qb, double scale, int64_t zero_point) {
     check_inputs(qa, qb);
 #ifdef USE_PYTORCH_QNNPACK
-    if (at::globalContext().qEngine() == at::QEngine::QNNPACK &&
-        qa.scalar_type() == kQUInt8 && qb.scalar_type() == kQUInt8) {
-      return qnnpack_add(qa, qb, scale, zero_point);
+    if (qa.scalar_type() == kQUInt8 && qb.scalar_type() == kQUInt8) {
+      const auto engine = at::globalContext().qEngine();
+      if (engine == at::QEngine::QNNPACK) {
+        return qnnpack_add(qa, qb, scale, zero_point);
+      }
+      if (engine == at::QEngine::Auto) {
+        // Per-shape engine selection with timing feedback; see
+        // Note [Auto quantized engine] in auto_engine.cpp.
+        auto_engine::EngineSelection selection(
+            ReLUFused ? "quantized::add_relu" : "quantized::add",
+            auto_engine::signature_of(qa.sizes()));
+        if (selection.engine() == at::QEngine::QNNPACK) {
+          return qnnpack_add(qa, qb, scale, zero_point);
+        }
+        return native_add(qa, qb, scale, zero_point);
+      }
     }
 #endif
+    return native_add(qa, qb, scale, zero_point);
+  }
+
+ private:
+  Tensor native_add(
+      const Tensor& qa,
+      const Tensor& qb,
+      double scale,
+      int64_t zero_point) {
     auto qc = at::_empty_affine_quantized(
         qa.sizes(),
         at::device(kCPU)
@@ -228,6 +252,35 @@ class QAddOut final : public c10::OperatorKernel {
   }
 };
 
+// Addition fused with a clamp of the result, so e.g. add + relu6 chains run
+// in one pass with a single requantization (relu6 is clamp(0, 6)). Like
+// quantized::clamp, both bounds must be given.
+class QAddClamp final : public c10::OperatorKernel {
+ public:
+  Tensor operator()(
+      Tensor qa,
+      Tensor qb,
+      double scale,
+      int64_t zero_point,
+      optional<Scalar> min,
+      optional<Scalar> max) {
+    check_inputs(qa, qb);
+    TORCH_CHECK(
+        min && max,
+        "Both min and max should be specified for quantized add_clamp!");
+    auto qc = at::_empty_affine_quantized(
+        qa.sizes(),
+        at::device(kCPU)
+           .dtype(qa.scalar_type())
+           .memory_format(qa.suggest_memory_format()),
+        scale,
+        zero_point,
+        c10::nullopt);
+    qadd_clamp_stub(qa.device().type(), qc, qa, qb, *min, *max);
+    return qc;
+  }
+};
+
 
 template <bool ReLUFused = false>
 class QAddScalar final : public c10::OperatorKernel {
@@ -276,6 +329,11 @@ static auto registry = c10::RegisterOperators()
     c10::RegisterOperators::options()
       .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
       .kernel<QAddOut</*ReLUFused=*/true>>(DispatchKey::QuantizedCPUTensorId))
+.op("quantized::add_clamp(Tensor qa, Tensor qb, float scale, int zero_point,"
+     " Scalar? min, Scalar? max) -> Tensor qc",
+    c10::RegisterOperators::options()
+      .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
+      .kernel<QAddClamp>(DispatchKey::QuantizedCPUTensorId))
 .op("quantized::add_scalar(Tensor qa, Scalar b) -> Tensor qc",
     c10::RegisterOperators::options()
       .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
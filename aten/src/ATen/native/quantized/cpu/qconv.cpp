@@ -8,6 +8,7 @@
 #include <ATen/core/op_registration/op_registration.h>
 #include <ATen/cpp_custom_type_hack.h>
 #include <ATen/native/quantized/cpu/fbgemm_utils.h>
+#include <ATen/native/quantized/cpu/packed_weight_cache.h>
 #include <ATen/native/quantized/cpu/qnnpack_utils.h>
 #include <caffe2/utils/threadpool/ThreadPoolMobile.h>
 
@@ -54,6 +55,21 @@ bool ConvDimChecks(
 
 #ifdef USE_FBGEMM
 
+// Note [Direct conv for small spatial sizes]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FBGEMM's convolution materializes an im2col buffer and runs a GEMM over
+// it. For the 7x7-and-smaller feature maps in the tail of typical detection
+// and classification models, the GEMM is too small to amortize the im2col
+// materialization, which ends up dominating the runtime. For those shapes
+// we instead compute the convolution directly from the channels-last
+// activation: the inner loop walks the contiguous channel dimension of both
+// the activation and the channels-last weight copy retained by prepacking
+// (PackedConvWeight::weight_nhwc), so it vectorizes well and touches no
+// scratch memory. Accumulation is int32 like the FBGEMM path, and
+// requantization uses the same scales/zero points, so results agree with
+// the im2col path up to rounding.
+constexpr int kDirectConvMaxSpatialDim = 7;
+
 template <int kSpatialDim = 2>
 SmallVector<int64_t, kSpatialDim + 2> MakeConvOutputShape(
     int N,
@@ -256,6 +272,132 @@ class QConvInt8 final : public c10::OperatorKernel {
     }
   }
 
+  // Direct NHWC convolution for small spatial sizes.
+  // See Note [Direct conv for small spatial sizes].
+  at::Tensor DirectConv(
+      const Tensor& act_nhwc,
+      const PackedConvWeight<kSpatialDim>& pack_data,
+      torch::List<int64_t> stride,
+      torch::List<int64_t> padding,
+      torch::List<int64_t> dilation,
+      int64_t groups,
+      double output_scale,
+      int64_t output_zero_point) {
+    const int N = act_nhwc.size(0);
+    const int C = act_nhwc.size(1);
+    const int H = act_nhwc.size(2);
+    const int W = act_nhwc.size(3);
+
+    const int kernel_h = pack_data.kernel[0];
+    const int kernel_w = pack_data.kernel[1];
+    const int stride_h = stride[0];
+    const int stride_w = stride[1];
+    const int pad_h = padding[0];
+    const int pad_w = padding[1];
+    const int dilation_h = dilation[0];
+    const int dilation_w = dilation[1];
+
+    const int M = pack_data.weight_nhwc.size(0);
+    const int C_per_group = C / groups;
+    const int M_per_group = M / groups;
+
+    const int OH =
+        (H + 2 * pad_h - dilation_h * (kernel_h - 1) - 1) / stride_h + 1;
+    const int OW =
+        (W + 2 * pad_w - dilation_w * (kernel_w - 1) - 1) / stride_w + 1;
+    TORCH_CHECK(
+        OH > 0 && OW > 0,
+        "[QConv2D] each dimension of output tensor should be greater than 0");
+
+    const float act_scale = act_nhwc.q_scale();
+    const int32_t act_zero_point = act_nhwc.q_zero_point();
+
+    Tensor bias;
+    const float* bias_data = GetBiasData(pack_data, &bias);
+
+    std::vector<float> output_multiplier_float;
+    std::vector<float> act_times_w_scale;
+    GetQuantizationParams(
+        pack_data,
+        act_scale,
+        output_scale,
+        &output_multiplier_float,
+        &act_times_w_scale);
+
+    Tensor output = _empty_affine_quantized(
+        {N, M, OH, OW},
+        device(kCPU).dtype(kQUInt8).memory_format(MemoryFormat::ChannelsLast),
+        output_scale,
+        output_zero_point,
+        c10::nullopt);
+
+    const uint8_t* act_data =
+        reinterpret_cast<uint8_t*>(act_nhwc.data_ptr<c10::quint8>());
+    const int8_t* w_data = reinterpret_cast<int8_t*>(
+        pack_data.weight_nhwc.data_ptr<c10::qint8>());
+    uint8_t* out_data =
+        reinterpret_cast<uint8_t*>(output.data_ptr<c10::quint8>());
+
+    const bool per_channel = pack_data.q_scheme == kPerChannelAffine;
+    const float inv_output_scale = 1.0f / static_cast<float>(output_scale);
+
+    at::parallel_for(0, N * M, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t nm = begin; nm < end; ++nm) {
+        const int n = nm / M;
+        const int m = nm % M;
+        const int g = m / M_per_group;
+        const int32_t w_zp = pack_data.w_zp[per_channel ? m : 0];
+        const float multiplier =
+            output_multiplier_float[per_channel ? m : 0];
+        for (int oh = 0; oh < OH; ++oh) {
+          for (int ow = 0; ow < OW; ++ow) {
+            int32_t acc = 0;
+            for (int r = 0; r < kernel_h; ++r) {
+              const int ih = oh * stride_h - pad_h + r * dilation_h;
+              if (ih < 0 || ih >= H) {
+                // Zero padding in the quantized domain is act_zero_point,
+                // which contributes nothing after the zero point shift.
+                continue;
+              }
+              for (int s = 0; s < kernel_w; ++s) {
+                const int iw = ow * stride_w - pad_w + s * dilation_w;
+                if (iw < 0 || iw >= W) {
+                  continue;
+                }
+                const uint8_t* a_ptr = act_data +
+                    (static_cast<int64_t>(n) * H + ih) * W * C + iw * C +
+                    g * C_per_group;
+                const int8_t* w_ptr = w_data +
+                    ((static_cast<int64_t>(m) * kernel_h + r) * kernel_w + s) *
+                        C_per_group;
+                for (int c = 0; c < C_per_group; ++c) {
+                  acc += (static_cast<int32_t>(a_ptr[c]) - act_zero_point) *
+                      (static_cast<int32_t>(w_ptr[c]) - w_zp);
+                }
+              }
+            }
+            float val = acc * multiplier;
+            if (bias_data != nullptr) {
+              val += bias_data[m] * inv_output_scale;
+            }
+            int32_t q = output_zero_point +
+                static_cast<int32_t>(std::nearbyint(val));
+            if (kReluFused) {
+              q = std::max<int32_t>(q, output_zero_point);
+            }
+            q = std::min<int32_t>(
+                std::max<int32_t>(q, std::numeric_limits<uint8_t>::min()),
+                std::numeric_limits<uint8_t>::max());
+            out_data[(static_cast<int64_t>(n) * OH + oh) * OW * M + ow * M +
+                     m] = static_cast<uint8_t>(q);
+          }
+        }
+      }
+    });
+
+    return output;
+  }
+
   at::Tensor FbgemmConv(
       Tensor act,
       Tensor packed_weight,
@@ -369,6 +511,24 @@ class QConvInt8 final : public c10::OperatorKernel {
           " channels instead");
     }
 
+    // Shape heuristic for the direct path: once the feature map fits in
+    // kDirectConvMaxSpatialDim x kDirectConvMaxSpatialDim, im2col overhead
+    // dominates the tiny GEMM and the direct kernel wins. Weights packed
+    // before this field existed fall through to the im2col path.
+    // See Note [Direct conv for small spatial sizes].
+    if (kSpatialDim == 2 && H <= kDirectConvMaxSpatialDim &&
+        W <= kDirectConvMaxSpatialDim && pack_data.weight_nhwc.defined()) {
+      return DirectConv(
+          act_nhwc,
+          pack_data,
+          stride,
+          padding,
+          dilation,
+          groups,
+          output_scale,
+          output_zero_point);
+    }
+
     fbgemm::conv_param_t<kSpatialDim> conv_p =
         fbgemm_utils::MakeFbgemmConvParam<kSpatialDim>(
             N, // Batch size
@@ -568,35 +728,68 @@ class QConvInt8 final : public c10::OperatorKernel {
     // Re-quantizing the bias based on input scale and weight scale.
     if (!pack_data.input_scale.has_value() ||
         pack_data.input_scale.value() != input_scale) {
-      // Get the original weight and adjust it to uint8 from int8
       auto weight_contig =
           pack_data.orig_weight.contiguous(MemoryFormat::ChannelsLast);
-      auto bias_fp32 = pack_data.bias;
-      int8_t* w_data =
-          reinterpret_cast<int8_t*>(weight_contig.data_ptr<c10::qint8>());
-      Tensor qnnp_weight = at::_empty_affine_quantized(
-          weight_contig.sizes(),
-          at::device(kCPU)
-             .dtype(kQUInt8)
-             .memory_format(MemoryFormat::ChannelsLast),
-          kernel_scale,
+      auto bias_fp32 = pack_data.bias.contiguous();
+      // QNNPACK bakes the input-scale-requantized bias into the packed
+      // buffer, so in addition to the weight bytes and conv geometry the
+      // fingerprint has to cover the bias contents and every scale that
+      // enters the packing. On a hit the weight/bias requantization below
+      // is skipped along with the packing itself. See
+      // Note [Prepacked weight cache] in packed_weight_cache.h.
+      std::vector<int64_t> packing_params{
+          kernel_h,
+          kernel_w,
+          stride_h,
+          stride_w,
+          dilation_h,
+          dilation_w,
+          pad_h,
+          pad_w,
+          groups,
+          C,
+          M,
           kernel_zp,
-          c10::nullopt);
-      auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
-      auto wt_numel = weight_contig.numel();
-      for (int i = 0; i < wt_numel; ++i) {
-        qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
-      }
-      // Original bias was float, so we requantize it here.
-      auto bias = at::quantize_per_tensor(
-          bias_fp32, kernel_scale * input_scale, 0, kQInt32);
+          output_min,
+          output_max,
+          FingerprintScalarBits(kernel_scale),
+          FingerprintScalarBits(input_scale)};
+      const auto bias_fingerprint = FingerprintWeight(
+          bias_fp32.data_ptr<float>(), bias_fp32.numel() * sizeof(float), {});
+      packing_params.push_back(static_cast<int64_t>(bias_fingerprint.lo));
+      packing_params.push_back(static_cast<int64_t>(bias_fingerprint.hi));
+      pack_data.w = LookupOrCreatePackedWeight<qnnpack::PrePackConvWeights>(
+          FingerprintWeight(
+              weight_contig.data_ptr<c10::qint8>(),
+              weight_contig.numel(),
+              packing_params),
+          [&]() {
+            // Get the original weight and adjust it to uint8 from int8
+            int8_t* w_data =
+                reinterpret_cast<int8_t*>(weight_contig.data_ptr<c10::qint8>());
+            Tensor qnnp_weight = at::_empty_affine_quantized(
+                weight_contig.sizes(),
+                at::device(kCPU)
+                   .dtype(kQUInt8)
+                   .memory_format(MemoryFormat::ChannelsLast),
+                kernel_scale,
+                kernel_zp,
+                c10::nullopt);
+            auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
+            auto wt_numel = weight_contig.numel();
+            for (int i = 0; i < wt_numel; ++i) {
+              qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
+            }
+            // Original bias was float, so we requantize it here.
+            auto bias = at::quantize_per_tensor(
+                bias_fp32, kernel_scale * input_scale, 0, kQInt32);
+            return std::make_shared<qnnpack::PrePackConvWeights>(
+                conv_p,
+                reinterpret_cast<uint8_t*>(qnnp_w_data),
+                reinterpret_cast<int32_t*>(bias.data_ptr<c10::qint32>()));
+          });
       // Update the input scale to not pack again.
       pack_data.input_scale = input_scale;
-      pack_data.w.reset();
-      pack_data.w = std::make_unique<qnnpack::PrePackConvWeights>(
-          conv_p,
-          reinterpret_cast<uint8_t*>(qnnp_w_data),
-          reinterpret_cast<int32_t*>(bias.data_ptr<c10::qint32>()));
       pack_w = pack_data.w.get();
     }
     TORCH_INTERNAL_ASSERT(pack_w != nullptr, "Packed Weights are NULL");
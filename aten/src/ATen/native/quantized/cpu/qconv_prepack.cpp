@@ -187,10 +187,34 @@ class QConvPackWeightInt8 final : public c10::OperatorKernel {
       bias_contig = bias->contiguous();
     }
 
+    // The fingerprint covers everything that influences the packed layout:
+    // the weight bytes plus the conv geometry baked into conv_p. Identical
+    // weights packed with identical geometry share one packed matrix. See
+    // Note [Prepacked weight cache] in packed_weight_cache.h.
+    std::vector<int64_t> packing_params{
+        kSpatialDim,
+        output_channels,
+        input_channels_per_group,
+        groups,
+        kernel_d,
+        kernel_h,
+        kernel_w};
+    packing_params.insert(packing_params.end(), stride.begin(), stride.end());
+    packing_params.insert(packing_params.end(), padding.begin(), padding.end());
+    packing_params.insert(
+        packing_params.end(), dilation.begin(), dilation.end());
+    auto packed_w = LookupOrCreatePackedWeight<
+        fbgemm::PackWeightsForConv<kSpatialDim>>(
+        FingerprintWeight(
+            weight_data_int8, weight_nhwc.numel(), packing_params),
+        [&]() {
+          return std::make_shared<fbgemm::PackWeightsForConv<kSpatialDim>>(
+              conv_p, weight_data_int8);
+        });
+
     auto ret_ptr = std::make_unique<PackedConvWeight<kSpatialDim>>(
         PackedConvWeight<kSpatialDim>{
-            std::make_unique<fbgemm::PackWeightsForConv<kSpatialDim>>(
-                conv_p, weight_data_int8),
+            std::move(packed_w),
             bias_contig,
             col_offsets,
             kSpatialDim == 2
@@ -198,7 +222,10 @@ class QConvPackWeightInt8 final : public c10::OperatorKernel {
                 : std::vector<int64_t>{kernel_d, kernel_h, kernel_w},
             scales,
             zero_points,
-            qtype});
+            qtype,
+            // Kept for the small-spatial-size direct conv path (2D only).
+            // See Note [Direct conv for small spatial sizes] in qconv.cpp.
+            kSpatialDim == 2 ? weight_nhwc : Tensor()});
 
     // TODO: we will need to replace this with torchscript classes at a later
     // point.
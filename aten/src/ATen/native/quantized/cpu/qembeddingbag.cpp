@@ -0,0 +1,184 @@
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/op_registration/op_registration.h>
+
+#include <caffe2/perfkernels/fused_8bit_rowwise_conversion.h>
+#include <caffe2/perfkernels/fused_8bit_rowwise_embedding_lookup_idx.h>
+
+#include <cstring>
+#include <vector>
+
+namespace at {
+namespace native {
+namespace {
+
+// Quantizes a float embedding table row-wise to the fused 8-bit format the
+// caffe2 perfkernels consume: each row stores the quantized values followed
+// by the row's scale and bias as two floats (8 extra bytes per row).
+class QEmbeddingBagBytePrepack final : public torch::OperatorKernel {
+ public:
+  at::Tensor operator()(const at::Tensor& weight) {
+    TORCH_CHECK(
+        weight.scalar_type() == at::kFloat,
+        "embedding_bag_byte_prepack expects a float weight");
+    TORCH_CHECK(
+        weight.dim() == 2, "embedding_bag_byte_prepack expects a 2d weight");
+    const auto weight_contig = weight.contiguous();
+    const int64_t rows = weight.size(0);
+    const int64_t cols = weight.size(1);
+
+    auto output =
+        at::empty({rows, cols + 8}, weight.options().dtype(at::kByte));
+    caffe2::FloatToFused8BitRowwiseQuantized(
+        weight_contig.data_ptr<float>(),
+        rows,
+        cols,
+        output.data_ptr<uint8_t>());
+    return output;
+  }
+};
+
+class QEmbeddingBagByteUnpack final : public torch::OperatorKernel {
+ public:
+  at::Tensor operator()(const at::Tensor& packed_weight) {
+    TORCH_CHECK(
+        packed_weight.scalar_type() == at::kByte,
+        "embedding_bag_byte_unpack expects a byte weight");
+    TORCH_CHECK(
+        packed_weight.dim() == 2 && packed_weight.size(1) > 8,
+        "embedding_bag_byte_unpack expects a 2d fused rowwise weight");
+    const auto packed_contig = packed_weight.contiguous();
+    const int64_t rows = packed_weight.size(0);
+    const int64_t cols = packed_weight.size(1) - 8;
+
+    auto output =
+        at::empty({rows, cols}, packed_weight.options().dtype(at::kFloat));
+    caffe2::Fused8BitRowwiseQuantizedToFloat(
+        packed_contig.data_ptr<uint8_t>(),
+        rows,
+        cols,
+        output.data_ptr<float>());
+    return output;
+  }
+};
+
+// Sum-mode embedding bag over a fused 8-bit rowwise quantized table, backed
+// by the prefetching AVX2 perfkernels. Bags are split across threads on bag
+// boundaries, mirroring the float fast path in native/EmbeddingBag.cpp.
+// Templated over the index type; the perfkernels ship specializations for
+// both int32 and int64 indices (offsets are always int64 there).
+template <typename IndexType>
+at::Tensor embedding_bag_byte_rowwise_offsets_impl(
+    const at::Tensor& weight,
+    const at::Tensor& indices,
+    const at::Tensor& offsets,
+    const c10::optional<at::Tensor>& per_sample_weights,
+    bool include_last_offset) {
+  const auto weight_contig = weight.contiguous();
+  const auto indices_contig = indices.contiguous();
+  // The perfkernels take int64 offsets regardless of the index type.
+  const auto offsets_contig = offsets.toType(at::kLong).contiguous();
+  const int64_t N = weight.size(0);
+  const int64_t D = weight.size(1) - 8;
+  const int64_t M = offsets.size(0);
+
+  int64_t output_size = M - 1;
+  const int64_t* offsets_data = offsets_contig.data_ptr<int64_t>();
+  std::vector<int64_t> offsets_include_last;
+  if (!include_last_offset) {
+    output_size = M;
+    offsets_include_last.resize(M + 1);
+    std::memcpy(
+        offsets_include_last.data(), offsets_data, sizeof(int64_t) * M);
+    offsets_include_last[M] = indices.numel();
+    offsets_data = offsets_include_last.data();
+  }
+
+  const float* per_sample_weights_data = nullptr;
+  at::Tensor per_sample_weights_contig;
+  if (per_sample_weights.has_value() && per_sample_weights->defined()) {
+    TORCH_CHECK(per_sample_weights->scalar_type() == at::kFloat);
+    per_sample_weights_contig = per_sample_weights->contiguous();
+    per_sample_weights_data = per_sample_weights_contig.data_ptr<float>();
+  }
+
+  auto output =
+      at::empty({output_size, D}, weight.options().dtype(at::kFloat));
+  auto* output_data = output.data_ptr<float>();
+  const auto* weight_data = weight_contig.data_ptr<uint8_t>();
+  const auto* indices_data = indices_contig.data_ptr<IndexType>();
+
+  at::parallel_for(0, output_size, 1, [&](int64_t start_idx, int64_t end_idx) {
+    caffe2::Fused8BitRowwiseEmbeddingLookupIdx<IndexType, uint8_t, float>(
+        /*block_size=*/D,
+        /*output_size=*/end_idx - start_idx,
+        /*index_size=*/offsets_data[end_idx] - offsets_data[start_idx],
+        /*data_size=*/N,
+        /*input=*/weight_data,
+        /*indices=*/indices_data + offsets_data[start_idx],
+        /*offsets=*/offsets_data + start_idx,
+        /*weights=*/
+        per_sample_weights_data
+            ? per_sample_weights_data + offsets_data[start_idx]
+            : nullptr,
+        /*normalize_by_lengths=*/false,
+        /*out=*/output_data + start_idx * D);
+  });
+  return output;
+}
+
+class QEmbeddingBagByteRowwiseOffsets final : public torch::OperatorKernel {
+ public:
+  at::Tensor operator()(
+      const at::Tensor& weight,
+      const at::Tensor& indices,
+      const at::Tensor& offsets,
+      bool /* scale_grad_by_freq */,
+      int64_t mode,
+      bool /* sparse */,
+      const c10::optional<at::Tensor>& per_sample_weights,
+      bool include_last_offset) {
+    TORCH_CHECK(
+        mode == 0, "embedding_bag_byte_rowwise_offsets only supports mode=sum");
+    TORCH_CHECK(
+        weight.scalar_type() == at::kByte && weight.dim() == 2 &&
+            weight.size(1) > 8,
+        "expected a 2d fused rowwise quantized weight");
+    TORCH_CHECK(
+        indices.scalar_type() == at::kInt || indices.scalar_type() == at::kLong,
+        "embedding_bag_byte_rowwise_offsets expects int or long indices");
+    TORCH_CHECK(
+        offsets.scalar_type() == at::kInt || offsets.scalar_type() == at::kLong,
+        "embedding_bag_byte_rowwise_offsets expects int or long offsets");
+
+    if (indices.scalar_type() == at::kInt) {
+      return embedding_bag_byte_rowwise_offsets_impl<int32_t>(
+          weight, indices, offsets, per_sample_weights, include_last_offset);
+    }
+    return embedding_bag_byte_rowwise_offsets_impl<int64_t>(
+        weight, indices, offsets, per_sample_weights, include_last_offset);
+  }
+};
+
+static auto registry =
+    torch::RegisterOperators()
+        .op("quantized::embedding_bag_byte_prepack(Tensor weight) -> Tensor",
+            torch::RegisterOperators::options()
+                .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
+                .kernel<QEmbeddingBagBytePrepack>(DispatchKey::CPUTensorId))
+        .op("quantized::embedding_bag_byte_unpack(Tensor weight) -> Tensor",
+            torch::RegisterOperators::options()
+                .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
+                .kernel<QEmbeddingBagByteUnpack>(DispatchKey::CPUTensorId))
+        .op("quantized::embedding_bag_byte_rowwise_offsets(Tensor weight, "
+            "Tensor indices, Tensor offsets, bool scale_grad_by_freq=False, "
+            "int mode=0, bool sparse=False, Tensor? per_sample_weights=None, "
+            "bool include_last_offset=False) -> Tensor",
+            torch::RegisterOperators::options()
+                .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
+                .kernel<QEmbeddingBagByteRowwiseOffsets>(
+                    DispatchKey::CPUTensorId));
+
+} // namespace
+} // namespace native
+} // namespace at
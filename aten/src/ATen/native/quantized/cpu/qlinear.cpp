@@ -3,6 +3,7 @@
 #include <ATen/core/op_registration/op_registration.h>
 #include <ATen/cpp_custom_type_hack.h>
 #include <ATen/native/quantized/cpu/fbgemm_utils.h>
+#include <ATen/native/quantized/cpu/packed_weight_cache.h>
 #include <ATen/native/quantized/cpu/qnnpack_utils.h>
 #include <caffe2/utils/threadpool/ThreadPoolMobile.h>
 
@@ -240,33 +241,53 @@ class QLinearInt8 final : public torch::OperatorKernel {
 
     if (!pack_ptr.input_scale.has_value() ||
         pack_ptr.input_scale.value() != input_scale) {
-      // Get the original weight and adjust it to uint8 from int8
       auto weight_contig = pack_ptr.orig_weight;
-      auto bias_fp32 = pack_ptr.bias;
-      int8_t* w_data = (int8_t*)weight_contig.data_ptr<c10::qint8>();
-      Tensor qnnp_weight = at::_empty_affine_quantized(
-          weight_contig.sizes(),
-          at::device(kCPU).dtype(kQUInt8),
-          kernel_scale,
-          kernel_zp);
-      auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
-      auto wt_numel = weight_contig.numel();
-      for (int i = 0; i < wt_numel; ++i) {
-        qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
-      }
-      // Original bias was float, so we requantize it here.
-      auto bias = at::quantize_per_tensor(
-          bias_fp32, kernel_scale * input_scale, 0, kQInt32);
+      auto bias_fp32 = pack_ptr.bias.contiguous();
+      // The packed buffer bakes in the input-scale-requantized bias, so the
+      // fingerprint covers the bias contents and the scales along with the
+      // weight bytes and shape. See
+      // Note [Prepacked weight cache] in packed_weight_cache.h.
+      std::vector<int64_t> packing_params{
+          static_cast<int64_t>(cols_w),
+          static_cast<int64_t>(rows_w),
+          kernel_zp,
+          FingerprintScalarBits(kernel_scale),
+          FingerprintScalarBits(input_scale)};
+      const auto bias_fingerprint = FingerprintWeight(
+          bias_fp32.data_ptr<float>(), bias_fp32.numel() * sizeof(float), {});
+      packing_params.push_back(static_cast<int64_t>(bias_fingerprint.lo));
+      packing_params.push_back(static_cast<int64_t>(bias_fingerprint.hi));
+      pack_ptr.w = LookupOrCreatePackedWeight<qnnpack::PackBMatrix>(
+          FingerprintWeight(
+              weight_contig.data_ptr<c10::qint8>(),
+              weight_contig.numel(),
+              packing_params),
+          [&]() {
+            // Get the original weight and adjust it to uint8 from int8
+            int8_t* w_data = (int8_t*)weight_contig.data_ptr<c10::qint8>();
+            Tensor qnnp_weight = at::_empty_affine_quantized(
+                weight_contig.sizes(),
+                at::device(kCPU).dtype(kQUInt8),
+                kernel_scale,
+                kernel_zp);
+            auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
+            auto wt_numel = weight_contig.numel();
+            for (int i = 0; i < wt_numel; ++i) {
+              qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
+            }
+            // Original bias was float, so we requantize it here.
+            auto bias = at::quantize_per_tensor(
+                bias_fp32, kernel_scale * input_scale, 0, kQInt32);
+            return std::make_shared<qnnpack::PackBMatrix>(
+                cols_w /* input_channels */,
+                rows_w /* output_channels */,
+                kernel_zp,
+                kernel_scale,
+                (uint8_t*)qnnp_w_data,
+                (int32_t*)bias.data_ptr<c10::qint32>());
+          });
       // Update the input scale to not pack again.
       pack_ptr.input_scale = input_scale;
-      pack_ptr.w.reset();
-      pack_ptr.w = std::make_unique<qnnpack::PackBMatrix>(
-          cols_w /* input_channels */,
-          rows_w /* output_channels */,
-          kernel_zp,
-          kernel_scale,
-          (uint8_t*)qnnp_w_data,
-          (int32_t*)bias.data_ptr<c10::qint32>());
       packB = pack_ptr.w.get();
     }
 
@@ -3,6 +3,7 @@
 #include <ATen/core/op_registration/op_registration.h>
 #include <ATen/cpp_custom_type_hack.h>
 #include <ATen/native/quantized/cpu/fbgemm_utils.h>
+#include <ATen/native/quantized/cpu/packed_weight_cache.h>
 #include <ATen/native/quantized/cpu/qnnpack_utils.h>
 #include <ATen/native/quantized/cpu/quant_utils.h>
 #include <caffe2/utils/threadpool/ThreadPoolMobile.h>
@@ -248,31 +249,46 @@ class QLinearDynamicInt8 final : public torch::OperatorKernel {
         /*qmin=*/0,
         /*qmax=*/255);
     if (!pack_ptr.input_scale.has_value()) {
-      // Get the original weight and adjust it to uint8 from int8
       auto weight_contig = pack_ptr.orig_weight;
-      int8_t* w_data = (int8_t*)weight_contig.data_ptr<c10::qint8>();
-      Tensor qnnp_weight = at::_empty_affine_quantized(
-          weight_contig.sizes(),
-          at::device(kCPU).dtype(kQUInt8),
-          kernel_scale,
-          kernel_zp);
-      auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
-      auto wt_numel = weight_contig.numel();
-      for (int i = 0; i < wt_numel; ++i) {
-        qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
-      }
-
+      // The dynamic variant packs without a baked-in bias (FP32 bias goes to
+      // the run function), so only the weight bytes and shape key the cache.
+      // The parameter count also keeps these entries distinct from the
+      // static-linear ones, which bake in the bias. See
+      // Note [Prepacked weight cache] in packed_weight_cache.h.
+      const std::vector<int64_t> packing_params{
+          static_cast<int64_t>(cols_w),
+          static_cast<int64_t>(rows_w),
+          kernel_zp,
+          FingerprintScalarBits(kernel_scale)};
+      pack_ptr.w = LookupOrCreatePackedWeight<qnnpack::PackBMatrix>(
+          FingerprintWeight(
+              weight_contig.data_ptr<c10::qint8>(),
+              weight_contig.numel(),
+              packing_params),
+          [&]() {
+            // Get the original weight and adjust it to uint8 from int8
+            int8_t* w_data = (int8_t*)weight_contig.data_ptr<c10::qint8>();
+            Tensor qnnp_weight = at::_empty_affine_quantized(
+                weight_contig.sizes(),
+                at::device(kCPU).dtype(kQUInt8),
+                kernel_scale,
+                kernel_zp);
+            auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
+            auto wt_numel = weight_contig.numel();
+            for (int i = 0; i < wt_numel; ++i) {
+              qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
+            }
+            // Pass in nullptr for bias, as we pass FP32 bias to run function.
+            return std::make_shared<qnnpack::PackBMatrix>(
+                cols_w /* input_channels */,
+                rows_w /* output_channels */,
+                kernel_zp,
+                kernel_scale,
+                (uint8_t*)qnnp_w_data,
+                nullptr);
+          });
       // Update the input scale to not pack again.
-      // Pass in nullptr for bias, as we pass FP32 bias to run function.
       pack_ptr.input_scale = q_params.scale;
-      pack_ptr.w.reset();
-      pack_ptr.w = std::make_unique<qnnpack::PackBMatrix>(
-          cols_w /* input_channels */,
-          rows_w /* output_channels */,
-          kernel_zp,
-          kernel_scale,
-          (uint8_t*)qnnp_w_data,
-          nullptr);
       packB = pack_ptr.w.get();
     }
 
@@ -105,15 +105,25 @@ class QLinearPackWeightInt8 final : public c10::OperatorKernel {
           "bias should have N elements: " + std::to_string(N));
       bias_contig = bias->contiguous();
     }
+    // Identical weight contents map to one shared PackBMatrix. See
+    // Note [Prepacked weight cache] in packed_weight_cache.h.
+    auto packed_b =
+        LookupOrCreatePackedWeight<fbgemm::PackBMatrix<int8_t>>(
+            FingerprintWeight(
+                weight_ptr_int8, K * N, {K, N}),
+            [&]() {
+              return std::make_shared<fbgemm::PackBMatrix<int8_t>>(
+                  /*trans=*/fbgemm::matrix_op_t::Transpose,
+                  /*nRow=*/K,
+                  /*nCol=*/N,
+                  /*smat=*/weight_ptr_int8,
+                  /*ld=*/K,
+                  /*pmat=*/nullptr, // PackBMatrix manages ownership of pmat
+                  /*groups=*/1);
+            });
+
     auto ret_ptr = std::make_unique<PackedLinearWeight>(PackedLinearWeight{
-        std::make_unique<fbgemm::PackBMatrix<int8_t>>(
-            /*trans=*/fbgemm::matrix_op_t::Transpose,
-            /*nRow=*/K,
-            /*nCol=*/N,
-            /*smat=*/weight_ptr_int8,
-            /*ld=*/K,
-            /*pmat=*/nullptr, // PackBMatrix manages ownership of pmat
-            /*groups=*/1),
+        std::move(packed_b),
         bias_contig,
         col_offsets,
         weight_scales_float,
@@ -11,6 +11,7 @@ namespace at {
 namespace native {
 
 DEFINE_DISPATCH(qmul_relu_stub);
+DEFINE_DISPATCH(qmul_clamp_stub);
 DEFINE_DISPATCH(qmul_stub);
 
 namespace {
@@ -124,6 +125,32 @@ class QMulOut final : public c10::OperatorKernel {
 };
 
 
+// Multiplication fused with a clamp of the result, matching
+// quantized::add_clamp; see QAddClamp in qadd.cpp.
+class QMulClamp final : public c10::OperatorKernel {
+ public:
+  Tensor operator()(
+      Tensor qa,
+      Tensor qb,
+      double scale,
+      int64_t zero_point,
+      optional<Scalar> min,
+      optional<Scalar> max) {
+    check_inputs(qa, qb);
+    TORCH_CHECK(
+        min && max,
+        "Both min and max should be specified for quantized mul_clamp!");
+    auto qc = at::_empty_affine_quantized(
+        qa.sizes(),
+        at::device(kCPU).dtype(qa.scalar_type()),
+        scale,
+        zero_point,
+        qa.suggest_memory_format());
+    qmul_clamp_stub(qa.device().type(), qc, qa, qb, *min, *max);
+    return qc;
+  }
+};
+
 template <bool ReLUFused = false>
 class QMulScalar final : public c10::OperatorKernel {
  public:
@@ -171,6 +198,11 @@ static auto registry =
                 .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
                 .kernel<QMulOut</*ReLUFused=*/true>>(
                     DispatchKey::QuantizedCPUTensorId))
+        .op("quantized::mul_clamp(Tensor qa, Tensor qb, float scale, int zero_point,"
+            " Scalar? min, Scalar? max) -> Tensor qc",
+            c10::RegisterOperators::options()
+                .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
+                .kernel<QMulClamp>(DispatchKey::QuantizedCPUTensorId))
 
         .op("quantized::mul_scalar(Tensor qa, Scalar b)"
             "-> Tensor qc",
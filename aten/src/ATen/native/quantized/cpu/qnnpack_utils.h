@@ -20,7 +20,11 @@ struct QnnpackOperatorDeleter {
 // For inference we expect the graph to be static so the input scale should
 // not change across consecutive inference calls.
 struct PackedLinearWeightsQnnp {
-  std::unique_ptr<qnnpack::PackBMatrix> w;
+  // Shared across instances that packed identical weights with the same
+  // input scale; QNNPACK reads packed buffers only during execution, and an
+  // input-scale change swaps this holder's pointer without touching other
+  // holders. See Note [Prepacked weight cache] in packed_weight_cache.h.
+  std::shared_ptr<qnnpack::PackBMatrix> w;
   at::Tensor orig_weight;
   at::Tensor bias;
   c10::optional<double> input_scale;
@@ -29,7 +33,8 @@ struct PackedLinearWeightsQnnp {
 };
 
 struct PackedConvWeightsQnnp {
-  std::unique_ptr<qnnpack::PrePackConvWeights> w;
+  // Shared like PackedLinearWeightsQnnp::w.
+  std::shared_ptr<qnnpack::PrePackConvWeights> w;
   at::Tensor orig_weight;
   at::Tensor bias;
   c10::optional<double> input_scale;
@@ -0,0 +1,118 @@
+#include <ATen/ATen.h>
+#include <ATen/core/op_registration/op_registration.h>
+#include <ATen/native/quantized/cpu/quantized_ops.h>
+
+#include <functional>
+#include <numeric>
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(qlayer_norm_stub);
+
+namespace {
+
+// Layer norm on a quantized tensor, producing quantized output with the
+// given qparams. The row statistics are computed from the integer values
+// directly so the input is never dequantized wholesale; see
+// Note [Quantized layer norm and softmax] in
+// kernels/QuantizedOpKernels.cpp.
+class QLayerNorm final : public torch::OperatorKernel {
+ public:
+  Tensor operator()(
+      Tensor qx,
+      torch::List<int64_t> normalized_shape_list,
+      c10::optional<Tensor> weight,
+      c10::optional<Tensor> bias,
+      double eps,
+      double output_scale,
+      int64_t output_zero_point) {
+    TORCH_CHECK(
+        qx.qscheme() == kPerTensorAffine,
+        "Only per tensor quantization is supported in quantized layer_norm.");
+    const std::vector<int64_t> normalized_shape =
+        normalized_shape_list.vec();
+    const int64_t normalized_ndim = normalized_shape.size();
+    TORCH_CHECK(
+        normalized_ndim >= 1,
+        "Expected normalized_shape to be at least 1-dimensional, i.e., ",
+        "containing at least one element, but got normalized_shape = ",
+        normalized_shape);
+
+    Tensor gamma = weight.has_value() ? *weight : Tensor();
+    Tensor beta = bias.has_value() ? *bias : Tensor();
+    TORCH_CHECK(
+        !gamma.defined() ||
+            gamma.sizes().equals(IntArrayRef(normalized_shape)),
+        "Expected weight to be of same shape as normalized_shape, but got ",
+        "weight of shape ",
+        gamma.sizes(),
+        " and normalized_shape = ",
+        normalized_shape);
+    TORCH_CHECK(
+        !beta.defined() || beta.sizes().equals(IntArrayRef(normalized_shape)),
+        "Expected bias to be of same shape as normalized_shape, but got ",
+        "bias of shape ",
+        beta.sizes(),
+        " and normalized_shape = ",
+        normalized_shape);
+
+    const auto input_shape = qx.sizes();
+    const int64_t input_ndim = qx.dim();
+    TORCH_CHECK(
+        input_ndim >= normalized_ndim &&
+            input_shape.slice(input_ndim - normalized_ndim)
+                .equals(IntArrayRef(normalized_shape)),
+        "Given normalized_shape=",
+        normalized_shape,
+        ", expected input with trailing shape matching it, but got input of "
+        "size ",
+        input_shape);
+
+    const int64_t axis = input_ndim - normalized_ndim;
+    const int64_t M = std::accumulate(
+        input_shape.cbegin(),
+        input_shape.cbegin() + axis,
+        1LL,
+        std::multiplies<int64_t>());
+    const int64_t N = std::accumulate(
+        input_shape.cbegin() + axis,
+        input_shape.cend(),
+        1LL,
+        std::multiplies<int64_t>());
+
+    auto qx_contig = qx.contiguous();
+    if (gamma.defined()) {
+      gamma = gamma.contiguous();
+    }
+    if (beta.defined()) {
+      beta = beta.contiguous();
+    }
+    Tensor qy = at::_empty_affine_quantized(
+        input_shape,
+        at::device(kCPU).dtype(qx.scalar_type()),
+        output_scale,
+        output_zero_point);
+    if (M > 0) {
+      qlayer_norm_stub(
+          qx.device().type(), qx_contig, gamma, beta, M, N, eps, qy);
+    }
+    return qy;
+  }
+};
+
+static auto registry = torch::RegisterOperators().op(
+    "quantized::layer_norm(Tensor input, "
+    "int[] normalized_shape, "
+    "Tensor? weight, "
+    "Tensor? bias, "
+    "float eps, "
+    "float output_scale, "
+    "int output_zero_point) -> Tensor",
+    torch::RegisterOperators::options()
+        .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
+        .kernel<QLayerNorm>(DispatchKey::QuantizedCPUTensorId));
+
+} // namespace
+} // namespace native
+} // namespace at
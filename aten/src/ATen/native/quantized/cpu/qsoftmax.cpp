@@ -0,0 +1,67 @@
+#include <ATen/ATen.h>
+#include <ATen/core/op_registration/op_registration.h>
+#include <ATen/native/quantized/cpu/quantized_ops.h>
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(qsoftmax_stub);
+
+namespace {
+
+// Softmax on a quantized tensor along `dim`, producing quantized output
+// with the given qparams. The kernel keeps the computation in the integer
+// domain via a per-call exp lookup table; see
+// Note [Quantized layer norm and softmax] in
+// kernels/QuantizedOpKernels.cpp. Only the 8-bit quantized types are
+// supported (the lookup table would be infeasible for qint32).
+class QSoftmax final : public torch::OperatorKernel {
+ public:
+  Tensor operator()(
+      Tensor qx,
+      int64_t dim,
+      double output_scale,
+      int64_t output_zero_point) {
+    TORCH_CHECK(
+        qx.qscheme() == kPerTensorAffine,
+        "Only per tensor quantization is supported in quantized softmax.");
+    TORCH_CHECK(
+        qx.scalar_type() == kQUInt8 || qx.scalar_type() == kQInt8,
+        "quantized softmax only supports quint8 and qint8 input, got ",
+        qx.scalar_type());
+    const int64_t ndim = qx.dim();
+    dim = maybe_wrap_dim(dim, ndim);
+
+    // The kernel reduces over the innermost dimension; move `dim` there if
+    // needed and undo the transpose on the output.
+    const bool needs_transpose = dim != ndim - 1;
+    auto qx_contig = needs_transpose
+        ? qx.transpose(dim, ndim - 1).contiguous()
+        : qx.contiguous();
+    const int64_t N = qx_contig.size(ndim - 1);
+    const int64_t M = N > 0 ? qx_contig.numel() / N : 0;
+
+    Tensor qy = at::_empty_affine_quantized(
+        qx_contig.sizes(),
+        at::device(kCPU).dtype(qx.scalar_type()),
+        output_scale,
+        output_zero_point);
+    if (M > 0 && N > 0) {
+      qsoftmax_stub(qx.device().type(), qx_contig, M, N, qy);
+    }
+    return needs_transpose ? qy.transpose(dim, ndim - 1) : qy;
+  }
+};
+
+static auto registry = torch::RegisterOperators().op(
+    "quantized::softmax(Tensor qx, "
+    "int dim, "
+    "float output_scale, "
+    "int output_zero_point) -> Tensor",
+    torch::RegisterOperators::options()
+        .aliasAnalysis(at::AliasAnalysisKind::FROM_SCHEMA)
+        .kernel<QSoftmax>(DispatchKey::QuantizedCPUTensorId));
+
+} // namespace
+} // namespace native
+} // namespace at
@@ -22,6 +22,12 @@ using qelu_fn = void(*)(
     at::Tensor& /*qy*/);
 using qbinary_fn =
     void (*)(Tensor& /*out*/, const Tensor& /*self*/, const Tensor& /*other*/);
+using qbinary_clamp_fn = void (*)(
+    Tensor& /*out*/,
+    const Tensor& /*self*/,
+    const Tensor& /*other*/,
+    Scalar /*min*/,
+    Scalar /*max*/);
 using qadd_scalar_fn =
     void (*)(Tensor& /*out*/, const Tensor& /*self*/, Scalar other /*other*/);
 using qhardswish_fn = void (*)(const at::Tensor& /*qx*/, at::Tensor& /*qy*/);
@@ -118,6 +124,25 @@ using qtopk_fn = void(*)(Tensor&, Tensor&, const Tensor&, int64_t, int64_t, bool
 
 using qbatch_norm_fn = void(*)(int64_t, int64_t, int64_t, int64_t, int64_t, const Tensor&, const Tensor&, const Tensor&, Tensor&);
 
+// Layer norm over the trailing N elements of each of the M rows of qx;
+// gamma/beta are optional (undefined tensors) fp32 affine parameters of
+// size N.
+using qlayer_norm_fn = void (*)(
+    const Tensor& /*qx*/,
+    const Tensor& /*gamma*/,
+    const Tensor& /*beta*/,
+    int64_t /*M*/,
+    int64_t /*N*/,
+    double /*eps*/,
+    Tensor& /*qy*/);
+
+// Softmax over the trailing dimension of size N for each of the M rows.
+using qsoftmax_fn = void (*)(
+    const Tensor& /*qx*/,
+    int64_t /*M*/,
+    int64_t /*N*/,
+    Tensor& /*qy*/);
+
 // using qavg_pool2d_fn
 DECLARE_DISPATCH(qrelu_fn, qrelu_stub);
 DECLARE_DISPATCH(qrelu_fn, qrelu6_stub);
@@ -128,8 +153,10 @@ DECLARE_DISPATCH(qclamp_fn, qclamp_stub);
 DECLARE_DISPATCH(qtanh_fn, qtanh_stub);
 DECLARE_DISPATCH(qbinary_fn, qadd_stub);
 DECLARE_DISPATCH(qbinary_fn, qadd_relu_stub);
+DECLARE_DISPATCH(qbinary_clamp_fn, qadd_clamp_stub);
 DECLARE_DISPATCH(qbinary_fn, qmul_stub);
 DECLARE_DISPATCH(qbinary_fn, qmul_relu_stub);
+DECLARE_DISPATCH(qbinary_clamp_fn, qmul_clamp_stub);
 DECLARE_DISPATCH(qadd_scalar_fn, qadd_scalar_stub);
 DECLARE_DISPATCH(qadd_scalar_fn, qadd_scalar_relu_stub);
 DECLARE_DISPATCH(qhardswish_fn, qhardswish_stub);
@@ -144,6 +171,8 @@ DECLARE_DISPATCH(qcat_nhwc_fn, qcat_relu_nhwc_stub);
 DECLARE_DISPATCH(qtopk_fn, qtopk_stub);
 DECLARE_DISPATCH(qbatch_norm_fn, qbatch_norm_stub);
 DECLARE_DISPATCH(qbatch_norm_fn, qbatch_norm_relu_stub);
+DECLARE_DISPATCH(qlayer_norm_fn, qlayer_norm_stub);
+DECLARE_DISPATCH(qsoftmax_fn, qsoftmax_stub);
 
 } // namespace native
 } // namespace at
@@ -74,9 +74,11 @@ REGISTER_DISPATCH(fake_quant_grad_tensor_stub, &fake_quantize_grad_tensor_kernel
 
 // Fake quantize per channel
 
+// NB: zero_point arrives as a float tensor; see the op layer in
+// fake_quant_per_channel_affine.cpp.
 void fake_quant_per_channel_cuda(TensorIterator &iter, int64_t quant_min, int64_t quant_max) {
   gpu_kernel(iter,
-    [=] GPU_LAMBDA (float input_val, float scale, int64_t zero_point) -> float {
+    [=] GPU_LAMBDA (float input_val, float scale, float zero_point) -> float {
       float inv_scale = 1.0f / scale;
       return (fminf(
                 quant_max,
@@ -91,7 +93,7 @@ void fake_quant_per_channel_cuda(TensorIterator &iter, int64_t quant_min, int64_
 
 void fake_quant_grad_per_channel_cuda(TensorIterator &iter, int64_t quant_min, int64_t quant_max) {
   gpu_kernel(iter,
-    [=] GPU_LAMBDA (float x, float dy, float scale, int64_t zero_point) -> float {
+    [=] GPU_LAMBDA (float x, float dy, float scale, float zero_point) -> float {
       float inv_scale = 1.0f / scale;
       int64_t Xq = std::nearbyint(x * inv_scale + zero_point);
       return (Xq >= quant_min && Xq <= quant_max) * dy;
@@ -68,7 +68,10 @@ Tensor fake_quantize_per_channel_affine(
   iter.add_output(Y);
   iter.add_input(self);
   iter.add_input(native::_unsafe_view(scale, expected_shape));
-  iter.add_input(native::_unsafe_view(zero_point, expected_shape));
+  // The zero point is fed to the kernels as float so all iterator inputs
+  // share one lane width, which lets the CPU kernel vectorize.
+  iter.add_input(
+      native::_unsafe_view(zero_point.to(ScalarType::Float), expected_shape));
   iter.build();
 
   fake_quant_per_channel_stub(iter.device_type(), iter, quant_min, quant_max);
@@ -145,7 +148,9 @@ Tensor fake_quantize_per_channel_affine_backward(
   iter.add_input(X);
   iter.add_input(dY);
   iter.add_input(native::_unsafe_view(scale, expected_shape));
-  iter.add_input(native::_unsafe_view(zero_point, expected_shape));
+  // See the note on the float zero point in the forward op above.
+  iter.add_input(
+      native::_unsafe_view(zero_point.to(ScalarType::Float), expected_shape));
   iter.build();
 
   fake_quant_grad_per_channel_stub(iter.device_type(), iter, quant_min, quant_max);
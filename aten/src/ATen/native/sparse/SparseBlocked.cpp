@@ -0,0 +1,184 @@
+// Block compressed sparse row (BSR) support for frozen, block-pruned weights.
+//
+// A BSR matrix is described by three plain dense tensors, mirroring the usual
+// CSR triple but at block granularity:
+//
+//   crow_indices: Long[num_block_rows + 1], block row pointers
+//   col_indices:  Long[num_blocks], block column of each stored block
+//   values:       scalar[num_blocks, block_size, block_size]
+//
+// There is deliberately no new TensorImpl or layout here: the triple is
+// produced once by a freezing pass via _sparse_bsr_from_dense and then fed to
+// _sparse_bsr_mm, which multiplies the BSR matrix with a dense right-hand
+// side, parallel over block rows. For a linear layer y = x @ W^t + b, freeze
+// W as BSR and compute _sparse_bsr_mm(crow, col, values, x.t()).t() + b.
+
+#include <ATen/ATen.h>
+#include <ATen/NativeFunctions.h>
+#include <ATen/Parallel.h>
+
+#include <vector>
+
+namespace at { namespace native {
+
+std::tuple<Tensor, Tensor, Tensor> sparse_bsr_from_dense_cpu(
+    const Tensor& self,
+    int64_t block_size) {
+  TORCH_CHECK(!self.is_cuda(), "_sparse_bsr_from_dense: expected a CPU tensor");
+  TORCH_CHECK(self.dim() == 2,
+      "_sparse_bsr_from_dense: expected a 2-D tensor, got ", self.dim(), "-D");
+  TORCH_CHECK(block_size > 0,
+      "_sparse_bsr_from_dense: block_size must be positive, got ", block_size);
+  TORCH_CHECK(self.size(0) % block_size == 0 && self.size(1) % block_size == 0,
+      "_sparse_bsr_from_dense: tensor of size ", self.sizes(),
+      " is not divisible into ", block_size, "x", block_size, " blocks");
+
+  auto dense = self.contiguous();
+  int64_t num_block_rows = dense.size(0) / block_size;
+  int64_t num_block_cols = dense.size(1) / block_size;
+  int64_t row_stride = dense.size(1);
+
+  Tensor crow_indices = at::zeros({num_block_rows + 1}, self.options().dtype(kLong));
+  auto* crow_data = crow_indices.data_ptr<int64_t>();
+
+  // First pass: mark nonzero blocks and count them per block row.
+  std::vector<unsigned char> block_nonzero(num_block_rows * num_block_cols, 0);
+  AT_DISPATCH_FLOATING_TYPES(dense.scalar_type(), "sparse_bsr_from_dense", [&] {
+    const scalar_t* dense_data = dense.data_ptr<scalar_t>();
+    at::parallel_for(0, num_block_rows, 0, [&](int64_t start, int64_t end) {
+      for (int64_t brow = start; brow < end; brow++) {
+        int64_t count = 0;
+        for (int64_t bcol = 0; bcol < num_block_cols; bcol++) {
+          const scalar_t* block = dense_data +
+              brow * block_size * row_stride + bcol * block_size;
+          bool nonzero = false;
+          for (int64_t i = 0; i < block_size && !nonzero; i++) {
+            for (int64_t j = 0; j < block_size; j++) {
+              if (block[i * row_stride + j] != static_cast<scalar_t>(0)) {
+                nonzero = true;
+                break;
+              }
+            }
+          }
+          if (nonzero) {
+            block_nonzero[brow * num_block_cols + bcol] = 1;
+            count++;
+          }
+        }
+        crow_data[brow + 1] = count;
+      }
+    });
+  });
+
+  // Serial prefix sum turns the per-row counts into row pointers.
+  for (int64_t brow = 0; brow < num_block_rows; brow++) {
+    crow_data[brow + 1] += crow_data[brow];
+  }
+  int64_t num_blocks = crow_data[num_block_rows];
+
+  Tensor col_indices = at::empty({num_blocks}, self.options().dtype(kLong));
+  Tensor values = at::empty({num_blocks, block_size, block_size}, self.options());
+  auto* col_data = col_indices.data_ptr<int64_t>();
+
+  // Second pass: copy the surviving blocks; every block row writes its own
+  // [crow[brow], crow[brow + 1]) slice, so the rows stay independent.
+  AT_DISPATCH_FLOATING_TYPES(dense.scalar_type(), "sparse_bsr_from_dense", [&] {
+    const scalar_t* dense_data = dense.data_ptr<scalar_t>();
+    scalar_t* values_data = values.data_ptr<scalar_t>();
+    at::parallel_for(0, num_block_rows, 0, [&](int64_t start, int64_t end) {
+      for (int64_t brow = start; brow < end; brow++) {
+        int64_t out = crow_data[brow];
+        for (int64_t bcol = 0; bcol < num_block_cols; bcol++) {
+          if (!block_nonzero[brow * num_block_cols + bcol]) {
+            continue;
+          }
+          col_data[out] = bcol;
+          const scalar_t* block = dense_data +
+              brow * block_size * row_stride + bcol * block_size;
+          scalar_t* value_block = values_data + out * block_size * block_size;
+          for (int64_t i = 0; i < block_size; i++) {
+            for (int64_t j = 0; j < block_size; j++) {
+              value_block[i * block_size + j] = block[i * row_stride + j];
+            }
+          }
+          out++;
+        }
+      }
+    });
+  });
+
+  return std::make_tuple(crow_indices, col_indices, values);
+}
+
+Tensor sparse_bsr_mm_cpu(
+    const Tensor& crow_indices,
+    const Tensor& col_indices,
+    const Tensor& values,
+    const Tensor& dense) {
+  TORCH_CHECK(!dense.is_cuda(), "_sparse_bsr_mm: expected a CPU tensor");
+  TORCH_CHECK(crow_indices.dim() == 1 && col_indices.dim() == 1,
+      "_sparse_bsr_mm: expected 1-D crow_indices and col_indices");
+  TORCH_CHECK(crow_indices.scalar_type() == kLong && col_indices.scalar_type() == kLong,
+      "_sparse_bsr_mm: expected int64 crow_indices and col_indices");
+  TORCH_CHECK(values.dim() == 3 && values.size(1) == values.size(2),
+      "_sparse_bsr_mm: expected values of shape [num_blocks, block_size, block_size], got ",
+      values.sizes());
+  TORCH_CHECK(values.size(0) == col_indices.size(0),
+      "_sparse_bsr_mm: values and col_indices disagree on the number of blocks");
+  TORCH_CHECK(dense.dim() == 2, "_sparse_bsr_mm: expected a 2-D dense tensor");
+
+  int64_t block_size = values.size(1);
+  int64_t num_block_rows = crow_indices.size(0) - 1;
+  int64_t dim_i = num_block_rows * block_size;
+  int64_t dim_k = dense.size(1);
+  TORCH_CHECK(dense.size(0) % block_size == 0,
+      "_sparse_bsr_mm: dense dim 0 size ", dense.size(0),
+      " is not divisible by the block size ", block_size);
+
+  auto values_ = values.contiguous();
+  auto dense_ = dense.contiguous();
+  Tensor r = at::zeros({dim_i, dim_k}, dense.options());
+
+  if (col_indices.numel() == 0) {
+    return r;
+  }
+
+  auto* crow_data = crow_indices.data_ptr<int64_t>();
+  auto* col_data = col_indices.data_ptr<int64_t>();
+  int64_t num_block_cols = dense.size(0) / block_size;
+
+  AT_DISPATCH_FLOATING_TYPES(dense.scalar_type(), "sparse_bsr_mm", [&] {
+    const scalar_t* values_data = values_.data_ptr<scalar_t>();
+    const scalar_t* dense_data = dense_.data_ptr<scalar_t>();
+    scalar_t* r_data = r.data_ptr<scalar_t>();
+    // Block rows own disjoint stripes of the output, so they parallelize
+    // without synchronization. Within a block the loops run innermost over
+    // the contiguous dense/output rows, which the compiler vectorizes.
+    at::parallel_for(0, num_block_rows, 0, [&](int64_t start, int64_t end) {
+      for (int64_t brow = start; brow < end; brow++) {
+        for (int64_t blk = crow_data[brow]; blk < crow_data[brow + 1]; blk++) {
+          int64_t bcol = col_data[blk];
+          TORCH_CHECK(bcol >= 0 && bcol < num_block_cols,
+              "_sparse_bsr_mm: block column index out of bounds: ", bcol);
+          const scalar_t* value_block =
+              values_data + blk * block_size * block_size;
+          for (int64_t i = 0; i < block_size; i++) {
+            scalar_t* r_row = r_data + (brow * block_size + i) * dim_k;
+            for (int64_t j = 0; j < block_size; j++) {
+              scalar_t val = value_block[i * block_size + j];
+              const scalar_t* dense_row =
+                  dense_data + (bcol * block_size + j) * dim_k;
+              for (int64_t k = 0; k < dim_k; k++) {
+                r_row[k] += val * dense_row[k];
+              }
+            }
+          }
+        }
+      }
+    });
+  });
+
+  return r;
+}
+
+}} // namespace at::native
@@ -524,6 +524,21 @@ SparseTensor& add_out_sparse_cpu(SparseTensor& r, const SparseTensor& t, const S
 
   r.resize_as_(src);
 
+  // Incremental coalescing for repeated accumulation: when one operand is
+  // already coalesced (typically a large gradient accumulator) and the other
+  // is not (typically a small fresh update), sorting just the uncoalesced
+  // side lets the sorted merge below produce an already-coalesced result.
+  // That costs O(new log new + total) per accumulation, instead of handing
+  // out an uncoalesced result whose eventual coalesce() re-sorts all of the
+  // accumulated indices from scratch.
+  if (t.is_coalesced() != src.is_coalesced()) {
+    return add_out_sparse_cpu(
+        r,
+        t.is_coalesced() ? t : t.coalesce(),
+        src.is_coalesced() ? src : src.coalesce(),
+        value);
+  }
+
   if (src._values().is_contiguous() && t._values().is_contiguous()) {
     return add_out_sparse_contiguous(r, t, src, value, commonDtype);
   } else {
@@ -783,6 +798,62 @@ void s_addmm_out_sparse_dense_worker(int64_t nnz, int64_t dim_i, int64_t dim_j,
   }
 };
 
+// Same contract as s_addmm_out_sparse_dense_worker, but for a matrix whose
+// indices are known to be sorted by row (i.e. a coalesced matrix). The
+// row-sorted indices convert to CSR row pointers in one O(nnz) pass, after
+// which rows are independent: each output row is only written by the thread
+// that owns it, so the rows can be processed in parallel and each row's
+// accumulation runs over contiguous dense/output rows (which vectorizes).
+// SpMV is just the dim_k == 1 instance of this loop.
+template <typename scalar_t>
+void s_addmm_out_csr_sparse_dense_worker(int64_t nnz, int64_t dim_i, int64_t dim_j, int64_t dim_k, Tensor& r, Scalar beta, const Tensor& t, Scalar alpha, const LongTensor& csr, const Tensor& indices, const Tensor& values, const Tensor& dense) {
+  // r_ = alpha * sparse * dense
+  scalar_t cast_alpha = alpha.to<scalar_t>();
+  scalar_t cast_beta = beta.to<scalar_t>();
+  if (cast_beta == 0) {
+    r.zero_();
+  } else if (cast_beta == 1) {
+    if (!is_same_tensor(r, t)) {
+      r.copy_(t);
+    }
+  } else {
+    at::mul_out(r, t, scalar_to_tensor(beta));
+  }
+
+  auto csr_accessor = csr.accessor<int64_t, 1>();
+  auto indices_accessor = indices.accessor<int64_t, 2>();
+
+  auto values_accessor = values.accessor<scalar_t, 1>();
+  scalar_t* dense_ptr = dense.data_ptr<scalar_t>();
+  scalar_t* r_ptr = r.data_ptr<scalar_t>();
+
+  int64_t dense_stride0 = dense.stride(0);
+  int64_t dense_stride1 = dense.stride(1);
+  int64_t r_stride0 = r.stride(0);
+  int64_t r_stride1 = r.stride(1);
+
+  // Cost per row is roughly (nnz / dim_i) * dim_k flops.
+  int64_t avg_row_cost = std::max<int64_t>((nnz / std::max<int64_t>(dim_i, 1)) * dim_k, 1);
+  at::parallel_for(0, dim_i, internal::GRAIN_SIZE / avg_row_cost, [&](int64_t start, int64_t end) {
+    for (int64_t row = start; row < end; row++) {
+      int64_t i_start = csr_accessor[row];
+      int64_t i_end = csr_accessor[row + 1];
+      for (int64_t i = i_start; i < i_end; i++) {
+        scalar_t val = values_accessor[i];
+        int64_t col = indices_accessor[1][i];
+        if (col >= 0 && col < dim_j) {
+          THBlas_axpy<scalar_t>(dim_k,
+              cast_alpha * val,
+              dense_ptr + col * dense_stride0, dense_stride1,
+              r_ptr + row * r_stride0, r_stride1);
+        } else {
+          AT_ERROR("addmm: index out of column bound: ", col, " not between 1 and ", dim_j);
+        }
+      }
+    }
+  });
+};
+
 Tensor& s_addmm_out_sparse_dense_cpu(
     Tensor& r,
     const Tensor& t,
@@ -825,6 +896,18 @@ Tensor& s_addmm_out_sparse_dense_cpu(
   LongTensor indices = sparse_._indices();
   Tensor values      = sparse_._values();
 
+  if (sparse_.is_coalesced()) {
+    // Coalesced indices are sorted by row, so the matrix converts to CSR in
+    // one pass and the rows can be multiplied in parallel.
+    LongTensor csr = _to_csr(indices.data_ptr<int64_t>(), dim_i, nnz);
+    AT_DISPATCH_ALL_TYPES(
+        values.scalar_type(), "addmm_sparse_dense", [&] {
+          s_addmm_out_csr_sparse_dense_worker<scalar_t>(nnz, dim_i, dim_j, dim_k, r, beta, t, alpha, csr, indices, values, dense);
+        }
+    );
+    return r;
+  }
+
   AT_DISPATCH_ALL_TYPES(
       values.scalar_type(), "addmm_sparse_dense", [&] {
         s_addmm_out_sparse_dense_worker<scalar_t>(nnz, dim_i, dim_j, dim_k, r, beta, t, alpha, indices, values, dense);
@@ -15,6 +15,12 @@
 #include <ATen/TensorUtils.h>
 #include <ATen/Context.h>
 
+#ifdef ATEN_HOT_OP_FAST_PATH
+#include <ATen/TypeDefault.h>
+#include <ATen/CPUType.h>
+#include <ATen/core/DispatchFastPath.h>
+#endif
+
 namespace at {
 
 using native::tensor;
@@ -17,6 +17,12 @@
 #include <ATen/QuantizedCPUType.h>
 #endif
 
+#ifdef ATEN_HOT_OP_FAST_PATH
+#include <ATen/TypeDefault.h>
+#include <ATen/CPUType.h>
+#include <ATen/core/DispatchFastPath.h>
+#endif
+
 namespace at {
 
 struct Quantizer;
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/core/InferenceMode.h>
+#include <ATen/core/LegacyTypeDispatch.h>
+
+using namespace at;
+
+TEST(InferenceModeTest, GuardFlipsAndRestoresThreadLocalState) {
+  ASSERT_FALSE(InferenceMode::is_enabled());
+  {
+    InferenceMode guard;
+    ASSERT_TRUE(InferenceMode::is_enabled());
+    ASSERT_FALSE(GradMode::is_enabled());
+    ASSERT_TRUE(c10::impl::tls_is_dispatch_key_excluded(
+        DispatchKey::VariableTensorId));
+    {
+      InferenceMode nested_guard;
+      ASSERT_TRUE(InferenceMode::is_enabled());
+    }
+    ASSERT_TRUE(InferenceMode::is_enabled());
+  }
+  ASSERT_FALSE(InferenceMode::is_enabled());
+  ASSERT_TRUE(GradMode::is_enabled());
+  ASSERT_FALSE(c10::impl::tls_is_dispatch_key_excluded(
+      DispatchKey::VariableTensorId));
+}
+
+TEST(InferenceModeTest, TensorsCreatedInsideHaveNoVersionCounter) {
+  Tensor outside = ones({2, 2});
+  ASSERT_TRUE(outside.unsafeGetTensorImpl()->version_counter().enabled());
+
+  Tensor inside;
+  {
+    InferenceMode guard;
+    inside = ones({2, 2});
+  }
+  ASSERT_FALSE(inside.unsafeGetTensorImpl()->version_counter().enabled());
+
+  // bumps on a counter-free tensor are no-ops rather than crashes
+  inside.unsafeGetTensorImpl()->bump_version();
+  ASSERT_EQ(inside.unsafeGetTensorImpl()->version_counter().current_version(), 0);
+
+  outside.unsafeGetTensorImpl()->bump_version();
+  ASSERT_EQ(outside.unsafeGetTensorImpl()->version_counter().current_version(), 1);
+}
+
+TEST(InferenceModeTest, OpsComputeCorrectResultsInsideGuard) {
+  InferenceMode guard;
+  Tensor a = ones({3, 3});
+  Tensor b = a + a;
+  ASSERT_TRUE(b.equal(ones({3, 3}) * 2));
+  b.add_(1);
+  ASSERT_TRUE(b.equal(ones({3, 3}) * 3));
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <c10/core/StorageImpl.h>
+
+using namespace at;
+
+// Small CPU tensors created through at::empty keep their data inside the
+// StorageImpl allocation (see InlineStorageImpl). These tests check that the
+// buffer really is inline and that the ordinary storage machinery -- resize
+// beyond the inline capacity, storage sharing, in-place writes -- behaves
+// exactly as with heap-backed storages.
+
+namespace {
+bool data_is_inline(const Tensor& tensor) {
+  auto* storage = tensor.storage().unsafeGetStorageImpl();
+  auto* begin = reinterpret_cast<const char*>(storage);
+  auto* data = static_cast<const char*>(storage->data());
+  return data >= begin && data < begin + sizeof(c10::InlineStorageImpl);
+}
+} // namespace
+
+TEST(InlineStorageTest, SmallTensorsAreInlineAndUsable) {
+  Tensor scalar = at::tensor(42);
+  ASSERT_TRUE(data_is_inline(scalar));
+  ASSERT_EQ(scalar.item<int64_t>(), 42);
+
+  Tensor small = at::arange(8, at::kDouble);
+  ASSERT_TRUE(data_is_inline(small));
+  small += 1;
+  ASSERT_TRUE(small.allclose(at::arange(1, 9, at::kDouble)));
+
+  // Past the inline capacity the heap path is used.
+  Tensor large = at::zeros({100});
+  ASSERT_FALSE(data_is_inline(large));
+}
+
+TEST(InlineStorageTest, ResizeCopiesOutOfInlineBuffer) {
+  Tensor tensor = at::arange(4, at::kLong);
+  ASSERT_TRUE(data_is_inline(tensor));
+  tensor.resize_({100});
+  ASSERT_FALSE(data_is_inline(tensor));
+  // resize_ preserves the leading elements through the copy-out.
+  ASSERT_TRUE(tensor.narrow(0, 0, 4).equal(at::arange(4, at::kLong)));
+}
+
+TEST(InlineStorageTest, InlineStorageIsShareable) {
+  Tensor a = at::zeros({2});
+  Tensor b = at::empty({2});
+  b.set_(a.storage(), 0, {2}, {1});
+  b.fill_(7);
+  ASSERT_TRUE(a.equal(at::full({2}, 7)));
+  ASSERT_EQ(a.storage().use_count(), 2);
+}
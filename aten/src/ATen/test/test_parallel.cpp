@@ -4,9 +4,11 @@
 #include <ATen/DLConvertor.h>
 #include <ATen/Parallel.h>
 
+#include <atomic>
 #include <iostream>
 #include <string.h>
 #include <sstream>
+#include <thread>
 
 using namespace at;
 
@@ -36,6 +38,30 @@ TEST(TestParallel, NestedParallel) {
   });
 }
 
+TEST(TestParallel, ParallelForNUMACoversRange) {
+  // Without NUMA (or when residency is unknown) parallel_for_numa must
+  // behave exactly like parallel_for.
+  std::vector<int64_t> data(1000, 0);
+  at::parallel_for_numa(
+      0, 1000, 100, data.data(), sizeof(int64_t),
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          data[i] = i;
+        }
+      });
+  for (int64_t i = 0; i < 1000; ++i) {
+    ASSERT_EQ(data[i], i);
+  }
+}
+
+TEST(TestParallel, PreferredNUMANodeRoundTrips) {
+  ASSERT_EQ(c10::GetPreferredNUMANode(), -1);
+  c10::SetPreferredNUMANode(0);
+  ASSERT_EQ(c10::GetPreferredNUMANode(), 0);
+  c10::SetPreferredNUMANode(-1);
+  ASSERT_EQ(c10::GetPreferredNUMANode(), -1);
+}
+
 TEST(TestParallel, Exceptions) {
   // parallel case
   ASSERT_THROW(
@@ -69,3 +95,29 @@ TEST(TestParallel, IntraOpLaunchFuture) {
 
   ASSERT_TRUE(v1 == 1 && v2 == 2);
 }
+
+TEST(TestParallel, ThreadPoolBudget) {
+  ASSERT_THROW(at::set_thread_pool_budget(-1), c10::Error);
+
+  at::set_thread_pool_budget(4);
+  ASSERT_EQ(at::get_thread_pool_budget(), 4);
+
+  // 0 disables the governor again
+  at::set_thread_pool_budget(0);
+  ASSERT_EQ(at::get_thread_pool_budget(), 0);
+}
+
+TEST(TestParallel, LaunchQoSClasses) {
+  // Background tasks yield to latency-critical ones but must still run.
+  std::atomic<int> count{0};
+
+  at::launch([&count]() { count++; }, at::TaskQoS::Background);
+  at::launch([&count]() { count++; }, at::TaskQoS::Latency);
+  at::launch([&count]() { count++; });
+
+  // the queue depth drains back to zero once all three tasks have run
+  while (count.load() < 3 || at::get_interop_queue_depth() > 0) {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(count.load(), 3);
+}
@@ -5,6 +5,7 @@
 #include <windows.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #if ATOMIC_INT_LOCK_FREE == 2
 #define TH_ATOMIC_IPC_REFCOUNT 1
@@ -317,10 +318,38 @@ THMapAllocator::THMapAllocator(WithFd, const char *filename, int fd, int flags,
     if (base_ptr_ == MAP_FAILED) {
       AT_ERROR("$ Torch: unable to mmap memory: you tried to mmap ", size_/1073741824, " GB.");
     }
+
+#if defined(MADV_HUGEPAGE)
+    // Best-effort transparent-hugepage advice: large mappings (embedding
+    // tables in the hundreds of GB) thrash the TLB on 4K pages. Whether
+    // the kernel honors this for file-backed mappings depends on its THP
+    // configuration, so failure is deliberately ignored. MAP_HUGETLB is
+    // not an option here: it requires hugetlbfs-backed files, which these
+    // are not.
+    if (flags_ & TH_ALLOCATOR_MAPPED_HUGEPAGES) {
+      madvise(base_ptr_, size_, MADV_HUGEPAGE);
+    }
+#endif
   }
 #endif
 }
 
+void THMapAllocator::prefetch(size_t offset, size_t nbytes) {
+#if defined(HAVE_MMAP) && defined(MADV_WILLNEED)
+  if (base_ptr_ == nullptr || closed_ || offset >= static_cast<size_t>(size_)) {
+    return;
+  }
+  nbytes = std::min(nbytes, static_cast<size_t>(size_) - offset);
+  // madvise operates on whole pages; round the start down.
+  const size_t page_size = sysconf(_SC_PAGESIZE);
+  size_t aligned_offset = offset - (offset % page_size);
+  nbytes += offset - aligned_offset;
+  // WILLNEED only kicks off readahead, so this returns without waiting
+  // for the pages; errors (e.g. on special mappings) are best-effort.
+  madvise(static_cast<char*>(base_ptr_) + aligned_offset, nbytes, MADV_WILLNEED);
+#endif
+}
+
 THMapAllocator::THMapAllocator(const char *filename, int flags, size_t size)
   : THMapAllocator(WITH_FD, filename, -1, flags, size)
 {}
@@ -397,6 +426,8 @@ THMapAllocator::THMapAllocator(WithFd, const char *filename, int fd, int flags,
 
 void THMapAllocator::close() { }
 
+void THMapAllocator::prefetch(size_t offset, size_t nbytes) { }
+
 #endif
 
 #if (defined(_WIN32) || defined(HAVE_MMAP)) && defined(TH_ATOMIC_IPC_REFCOUNT)
@@ -11,6 +11,10 @@
 #define TH_ALLOCATOR_MAPPED_KEEPFD 16
 #define TH_ALLOCATOR_MAPPED_FROMFD 32
 #define TH_ALLOCATOR_MAPPED_UNLINK 64
+// Advise the kernel to back the mapping with transparent huge pages
+// (best effort; see THMapAllocator ctor). Helps TLB-bound workloads such
+// as large memory-mapped embedding tables.
+#define TH_ALLOCATOR_MAPPED_HUGEPAGES 128
 
 /* default malloc/free allocator. malloc and realloc raise an error (using
  * THError) on allocation failure.
@@ -31,6 +35,7 @@ class CAFFE2_API THMapAllocator {
   THMapAllocator& operator=(THMapAllocator&&) = delete;
 
   const char* filename() const { return filename_.c_str(); }
+  int flags() const { return flags_; }
   int fd() const {
 #ifdef _WIN32
     AT_ERROR("THMapAllocator::fd() is unsupported on Windows");
@@ -48,6 +53,13 @@ class CAFFE2_API THMapAllocator {
   static at::DataPtr makeDataPtr(const char *filename, int flags, size_t size, size_t* actual_size_out);
   static at::DataPtr makeDataPtr(WithFd, const char *filename, int fd, int flags, size_t size, size_t* actual_size_out);
 
+  // Asks the kernel to start reading the given byte range of the mapping
+  // into the page cache (madvise WILLNEED). The call only initiates
+  // readahead and returns immediately, so callers can stream shards of a
+  // large mapped table ahead of their access pattern. Best effort: a
+  // no-op on platforms without madvise or on a closed mapping.
+  void prefetch(size_t offset, size_t nbytes);
+
   // Closes the data.  Helps us avoid destructor shenanigans
   virtual void close();
 
@@ -6,6 +6,8 @@
 #include "fbgemm/FbgemmI64.h"
 #endif // USE_FBGEMM
 
+#include <ATen/native/CPUBlas.h>
+
 #ifdef BLAS_F2C
 # define ffloat double
 #else
@@ -421,6 +423,21 @@ void THBlas_(gemm)(
   }
 #endif
 
+#if defined(TH_REAL_IS_DOUBLE) || defined(TH_REAL_IS_FLOAT)
+  // No vendor BLAS took the call (non-BLAS build, or dimensions past
+  // INT_MAX). The tiled, parallel vec256 kernel stays within a few x of
+  // vendor BLAS where the reference loops below are orders of magnitude
+  // off.
+  {
+    using at::native::cpublas::TransposeType;
+    at::native::cpublas::gemm(
+        transa_ ? TransposeType::Transpose : TransposeType::NoTranspose,
+        transb_ ? TransposeType::Transpose : TransposeType::NoTranspose,
+        m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    return;
+  }
+#endif
+
   {
     if(!transa_ && !transb_)
     {
@@ -5,6 +5,10 @@
 #include <TH/THHalf.h>
 #include <THC/THCNumerics.cuh>
 #include <ATen/ATen.h>
+#include <c10/macros/Macros.h>
+
+#include <cstdint>
+#include <type_traits>
 
 template <typename T, size_t n>
 struct AtomicAddIntegerImpl;
@@ -201,6 +205,55 @@ static inline __device__ void gpuAtomicAdd(float *address, float val) {
   atomicAdd(address, val);
 }
 
+/* Note [Warp-aggregated atomic add]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Scatter-style kernels issue one global atomic per element, which collapses
+ * under heavy index collisions (power-law graphs in GNN workloads routinely
+ * send most updates to a few hub rows). gpuAtomicAddAggregated() first
+ * combines same-address updates within the warp: __match_any_sync groups
+ * lanes by destination address, the values of each group are summed with
+ * shuffles, and only the group leader issues the atomic. Disjoint addresses
+ * cost a few extra warp instructions; colliding addresses turn up to 32
+ * serialized atomics into one.
+ *
+ * __match_any_sync needs sm_70+, and shuffling the value needs a natively
+ * shufflable type, so other configurations (including half/bool payloads and
+ * ROCm) fall back to the plain atomic.
+ */
+template <typename T>
+struct WarpAggregatable {
+  static constexpr bool value = std::is_arithmetic<T>::value && sizeof(T) >= 4;
+};
+
+template <typename T, typename std::enable_if<WarpAggregatable<T>::value, int>::type = 0>
+static inline __device__ void gpuAtomicAddAggregated(T *address, T val) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700 && !defined(__HIP_PLATFORM_HCC__)
+  const unsigned int active = __activemask();
+  const unsigned int peers =
+      __match_any_sync(active, (unsigned long long)(uintptr_t)address);
+  const int lane = threadIdx.x % C10_WARP_SIZE;
+  const int leader = __ffs(peers) - 1;
+  T sum = val;
+  for (int i = 0; i < C10_WARP_SIZE; ++i) {
+    // Collective shuffle; only the leader consumes the result.
+    T other = __shfl_sync(active, val, i);
+    if (lane == leader && i != lane && ((peers >> i) & 1)) {
+      sum += other;
+    }
+  }
+  if (lane == leader) {
+    gpuAtomicAdd(address, sum);
+  }
+#else
+  gpuAtomicAdd(address, val);
+#endif
+}
+
+template <typename T, typename std::enable_if<!WarpAggregatable<T>::value, int>::type = 0>
+static inline __device__ void gpuAtomicAddAggregated(T *address, T val) {
+  gpuAtomicAdd(address, val);
+}
+
 /* Note [gpuAtomicAdd vs atomicAdd]
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * We are trying to standardize inside the PyTorch backend on using gpuAtomicAdd()
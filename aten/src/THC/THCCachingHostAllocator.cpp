@@ -4,6 +4,8 @@
 
 
 #include <cuda_runtime_api.h>
+#include <algorithm>
+#include <cstdlib>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -15,6 +17,71 @@
 
 namespace {
 
+// Note [Pinned host size classes]
+// The pool only reuses a cached slab when a request fits into it, and the
+// smallest-fit search never splits, so workloads with variable-size batches
+// (a DataLoader whose last batch is short, or text batches padded to the
+// longest sequence) miss the cache on every size change and pay a
+// multi-millisecond cudaHostAlloc. To make slabs shareable across nearby
+// sizes, requests are rounded up to a size class before allocation: 4KB for
+// anything smaller, then powers of two, then 32MB multiples beyond 256MB
+// (where power-of-two rounding would waste too much pinned memory, and
+// 32MB granularity still keeps the class count small). The worst-case
+// overallocation is 2x for mid-size slabs and ~12% for huge ones.
+//
+// PYTORCH_PINNED_PREALLOC=<n> additionally reserves n spare slabs of a size
+// class whenever that class misses, so subsequent concurrent requests (e.g.
+// several DataLoader workers pinning same-shaped batches) hit the pool
+// instead of serializing on cudaHostAlloc; the pool stops growing once
+// misses stop. Reservation happens inline on the miss path rather than on a
+// background thread: the allocator is process global and spawning threads
+// from it would be fork-unsafe.
+
+constexpr size_t kHostClassSmallest = 4096; // 4KB
+constexpr size_t kHostClassHuge = 268435456; // 256MB
+constexpr size_t kHostClassHugeRound = 33554432; // 32MB
+
+size_t host_round_size(size_t size)
+{
+  if (size <= kHostClassSmallest) {
+    return kHostClassSmallest;
+  }
+  if (size > kHostClassHuge) {
+    return kHostClassHugeRound * ((size + kHostClassHugeRound - 1) / kHostClassHugeRound);
+  }
+  size_t rounded = kHostClassSmallest;
+  while (rounded < size) {
+    rounded *= 2;
+  }
+  return rounded;
+}
+
+size_t host_prealloc_count()
+{
+  static size_t count = []() -> size_t {
+    const char* env = getenv("PYTORCH_PINNED_PREALLOC");
+    if (!env) {
+      return 0;
+    }
+    int val = atoi(env);
+    return val > 0 ? val : 0;
+  }();
+  return count;
+}
+
+void stat_add(c10::cuda::CUDACachingAllocator::Stat& stat, int64_t amount)
+{
+  stat.current += amount;
+  stat.allocated += amount;
+  stat.peak = std::max(stat.current, stat.peak);
+}
+
+void stat_sub(c10::cuda::CUDACachingAllocator::Stat& stat, int64_t amount)
+{
+  stat.current -= amount;
+  stat.freed += amount;
+}
+
 struct BlockSize
 {
   size_t  size; // allocation size
@@ -58,6 +125,9 @@ struct HostAllocator
   // outstanding cuda events
   std::deque<std::pair<cudaEvent_t, void*>> cuda_events;
 
+  // pool statistics, see Note [Pinned host size classes]
+  THCCachingHostAllocatorStats stats;
+
   HostAllocator() : available(BlockComparator) {}
 
   cudaError_t malloc(void** ptr, size_t size)
@@ -70,6 +140,10 @@ struct HostAllocator
       return err;
     }
 
+    // round to a size class so slabs are shared across nearby request sizes,
+    // see Note [Pinned host size classes]
+    size = host_round_size(size);
+
     // search for the smallest block which can hold this allocation
     BlockSize search_key(size);
     auto it = available.lower_bound(search_key);
@@ -79,6 +153,9 @@ struct HostAllocator
       block.allocated = true;
       *ptr = block.ptr;
       available.erase(it);
+      stats.num_reuses++;
+      stat_add(stats.allocation, 1);
+      stat_add(stats.allocated_bytes, block.size);
       return cudaSuccess;
     }
 
@@ -103,6 +180,25 @@ struct HostAllocator
     }
 
     blocks.insert({*ptr, Block(size, *ptr, true)});
+    stats.num_host_allocs++;
+    stat_add(stats.reserved_bytes, size);
+    stat_add(stats.allocation, 1);
+    stat_add(stats.allocated_bytes, size);
+
+    // a miss optionally reserves spare slabs of the same class so follow-up
+    // requests hit the pool, see Note [Pinned host size classes]
+    for (size_t i = 0; i < host_prealloc_count(); i++) {
+      void* spare = nullptr;
+      if (cudaHostAlloc(&spare, size, cudaHostAllocDefault) != cudaSuccess) {
+        // best effort; clear the error and serve the original request
+        cudaGetLastError();
+        break;
+      }
+      auto inserted = blocks.insert({spare, Block(size, spare, false)});
+      available.insert(inserted.first->second);
+      stats.num_host_allocs++;
+      stat_add(stats.reserved_bytes, size);
+    }
     return cudaSuccess;
   }
 
@@ -129,6 +225,8 @@ struct HostAllocator
     // free (on valid memory) shouldn't fail, so mark unallocated before
     // we process the streams.
     block.allocated = false;
+    stat_sub(stats.allocation, 1);
+    stat_sub(stats.allocated_bytes, block.size);
 
     // insert CUDA events for each stream on which this block was used. This
     err = insertEvents(block);
@@ -217,6 +315,7 @@ struct HostAllocator
       Block& block = it->second;
       if (!block.allocated) {
         THCudaCheckWarn(cudaFreeHost(block.ptr));
+        stat_sub(stats.reserved_bytes, block.size);
         it = blocks.erase(it);
       } else {
         ++it;
@@ -224,6 +323,12 @@ struct HostAllocator
     }
   }
 
+  THCCachingHostAllocatorStats getStats()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+  }
+
   cudaError_t insertEvents(Block& block)
   {
     cudaError_t err;
@@ -267,6 +372,11 @@ void THCCachingHostAllocator_emptyCache()
   allocator.emptyCache();
 }
 
+THCCachingHostAllocatorStats THCCachingHostAllocator_getStats()
+{
+  return allocator.getStats();
+}
+
 static void THCCachingHostDeleter(void* ptr) {
   allocator.free(ptr);
 }
@@ -4,6 +4,7 @@
 #include <THC/THCGeneral.h>
 
 
+#include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAStream.h>
 
 //
@@ -30,4 +31,22 @@ THC_API cudaError_t THCCachingHostAllocator_recordEvent(void *ptr, at::cuda::CUD
 // Releases cached pinned memory allocations via cudaHostFree
 THC_API void THCCachingHostAllocator_emptyCache(void);
 
+// Summary statistics for the pinned host memory pool, using the same Stat
+// shape as the device caching allocator. See Note [Pinned host size classes]
+// in THCCachingHostAllocator.cpp.
+struct THCCachingHostAllocatorStats {
+  // COUNT: allocations handed out to client code
+  c10::cuda::CUDACachingAllocator::Stat allocation;
+  // SUM: bytes handed out to client code (rounded to size classes)
+  c10::cuda::CUDACachingAllocator::Stat allocated_bytes;
+  // SUM: bytes held by the pool, both free and used
+  c10::cuda::CUDACachingAllocator::Stat reserved_bytes;
+  // COUNT: calls into cudaHostAlloc (i.e. pool misses)
+  int64_t num_host_allocs = 0;
+  // COUNT: requests served from a cached slab
+  int64_t num_reuses = 0;
+};
+
+THC_API THCCachingHostAllocatorStats THCCachingHostAllocator_getStats(void);
+
 #endif
@@ -162,7 +162,9 @@ __global__ void THCudaTensor_scatterAddKernel(
     CUDA_KERNEL_ASSERT(indexValue >= 0 && indexValue < tensor.sizes[dim]);
     tensorOffset += indexValue * tensor.strides[dim];
 
-    gpuAtomicAdd(&tensor.data[tensorOffset], src.data[srcOffset]);
+    // Pre-combine same-destination updates within the warp before hitting
+    // global memory, see Note [Warp-aggregated atomic add]
+    gpuAtomicAddAggregated(&tensor.data[tensorOffset], src.data[srcOffset]);
   }
 }
 
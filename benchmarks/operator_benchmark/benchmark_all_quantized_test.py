@@ -10,6 +10,7 @@ from pt import ( # noqa
     qcat_test,
     qcomparators_test,
     qconv_test,
+    qgemm_test,
     qinterpolate_test,
     qlinear_test,
     qobserver_test,
@@ -223,6 +223,9 @@ class BenchmarkRunner(object):
                       test_case.test_config.input_config))
 
             mode = "Backward" if test_case.test_config.run_backward else "Forward"
+            # Benchmarks can report the op count of one forward pass via
+            # set_ops_per_run, in which case we also print throughput.
+            ops_per_run = getattr(getattr(test_case, 'op_bench', None), 'ops_per_run', None)
             if self.num_runs > 1:
                 for run in range(self.num_runs):
                     print("Run: {}, {} Execution Time (us) : {:.3f}".format(
@@ -230,8 +233,12 @@ class BenchmarkRunner(object):
                         mode, reported_run_time_us[run]))
                 print()
             else:
-                print("{} Execution Time (us) : {:.3f}\n".format(
+                print("{} Execution Time (us) : {:.3f}".format(
                     mode, reported_run_time_us[0]))
+                if ops_per_run and not test_case.test_config.run_backward:
+                    print("{} Throughput (GOPS) : {:.3f}".format(
+                        mode, ops_per_run / (reported_run_time_us[0] * 1e3)))
+                print()
 
     def _predict_num_iter_needed(self, i):
         return (i * self.multiplier)
@@ -27,6 +27,7 @@ class TorchBenchmarkBase(object):
         self._jit_forward = None
         self._pass_count = 0
         self._num_inputs_require_grads = 0
+        self.ops_per_run = None
 
     def _set_backward_test(self, is_backward):
         self._is_backward = is_backward
@@ -91,6 +92,13 @@ class TorchBenchmarkBase(object):
     def set_module_name(self, name):
         self.user_given_name = name
 
+    def set_ops_per_run(self, ops_per_run):
+        """ number of arithmetic operations a single forward() performs
+            (e.g. 2 * M * N * K for a GEMM). When set, the framework reports
+            throughput in GOPS next to the measured latency.
+        """
+        self.ops_per_run = ops_per_run
+
     def test_name(self, **kargs):
         """ this is a globally unique name which can be used to
             label a specific test
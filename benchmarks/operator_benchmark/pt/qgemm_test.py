@@ -0,0 +1,209 @@
+from __future__ import absolute_import, division, print_function, unicode_literals
+
+import operator_benchmark as op_bench
+import torch
+import torch.nn.quantized as nnq
+
+
+"""
+Int8 GEMM microbenchmarks swept across the quantized engines.
+
+These cover the linear and convolution shapes that dominate production
+quantized models (BERT-style GEMMs and MobileNetV2 convolutions, to
+complement the ResNeXt shapes in qconv_test.py) and run every shape under
+each available engine so FBGEMM and QNNPACK can be compared side by side.
+Each benchmark reports throughput in GOPS next to latency via
+set_ops_per_run.
+"""
+
+ENGINES = [engine for engine in ('fbgemm', 'qnnpack')
+           if engine in torch.backends.quantized.supported_engines]
+
+
+class _QEngineBenchmarkBase(op_bench.TorchBenchmarkBase):
+    """Pins a quantized engine for the lifetime of one benchmark.
+
+    The engine must be active both when the weights are prepacked (init)
+    and when the op runs (forward), and inits of all generated tests run
+    before any forward, so we set the global engine in both places. The
+    set in forward is a plain enum assignment, uniform across engines and
+    negligible against the GEMMs measured here.
+    """
+    def _set_engine(self, engine):
+        self.engine = engine
+        torch.backends.quantized.engine = engine
+
+    def forward(self):
+        torch.backends.quantized.engine = self.engine
+        return self._run()
+
+
+# BERT-base GEMMs (single token and seq_len 128) plus a small ranking layer
+qgemm_linear_configs = op_bench.config_list(
+    attrs=[
+        [1, 768, 768],
+        [1, 3072, 768],
+        [1, 768, 3072],
+        [128, 768, 768],
+        [128, 3072, 768],
+        [128, 768, 3072],
+        [64, 256, 1024],
+    ],
+    attr_names=["M", "OUT", "IN"],
+    cross_product_configs={
+        'engine': ENGINES,
+    },
+    tags=["qgemm"],
+)
+
+
+class QLinearInt8Benchmark(_QEngineBenchmarkBase):
+    def init(self, M, IN, OUT, engine):
+        self._set_engine(engine)
+        scale = torch.tensor(1.0 / 255)
+        zero_point = torch.tensor(0)
+        X = torch.randn(M, IN, dtype=torch.float32)
+        self.qX = torch.quantize_per_tensor(
+            X, scale=scale, zero_point=zero_point, dtype=torch.quint8)
+        W = torch.randn(OUT, IN, dtype=torch.float32)
+        qW = torch.quantize_per_tensor(W, scale=scale, zero_point=0, dtype=torch.qint8)
+
+        self.qlinear = nnq.Linear(IN, OUT)
+        self.qlinear.weight = qW
+        self.qlinear.scale = scale
+        self.qlinear.zero_point = zero_point
+        self.set_module_name("QLinearInt8")
+        self.set_ops_per_run(2 * M * OUT * IN)
+
+    def _run(self):
+        return self.qlinear(self.qX)
+
+
+# MobileNetV2 convolutions: depthwise and the surrounding pointwise layers
+qgemm_conv_configs = op_bench.config_list(
+    attrs=[
+        [1, 32, 32, 112, 112, 32, 3, 1, 1],
+        [1, 32, 16, 112, 112, 1, 1, 1, 0],
+        [1, 96, 96, 112, 112, 96, 3, 2, 1],
+        [1, 144, 144, 56, 56, 144, 3, 1, 1],
+        [1, 144, 24, 56, 56, 1, 1, 1, 0],
+        [1, 192, 192, 28, 28, 192, 3, 1, 1],
+        [1, 384, 384, 14, 14, 384, 3, 1, 1],
+        [1, 960, 160, 7, 7, 1, 1, 1, 0],
+    ],
+    attr_names=["N", "IC", "OC", "H", "W", "G", "kernel", "stride", "pad"],
+    cross_product_configs={
+        'engine': ENGINES,
+    },
+    tags=["qgemm"],
+)
+
+
+class QConv2dInt8Benchmark(_QEngineBenchmarkBase):
+    def init(self, N, IC, OC, H, W, G, kernel, stride, pad, engine):
+        self._set_engine(engine)
+        scale = 1.0 / 255
+        zero_point = 0
+        X = torch.randn(N, IC, H, W, dtype=torch.float32)
+        qX = torch.quantize_per_tensor(
+            X, scale=scale, zero_point=zero_point, dtype=torch.quint8
+        )
+        # Convert the tensor to NHWC format
+        self.input = qX.contiguous(memory_format=torch.channels_last)
+        W = torch.randn(OC, IC // G, kernel, kernel, dtype=torch.float32)
+        qW = torch.quantize_per_tensor(W, scale=scale, zero_point=0, dtype=torch.qint8)
+
+        self.qconv2d = nnq.Conv2d(IC, OC, kernel, stride=stride, padding=pad, groups=G)
+        self.qconv2d.set_weight_bias(qW, None)
+        self.qconv2d.scale = torch.tensor([scale], dtype=torch.double)
+        self.qconv2d.zero_point = torch.tensor([zero_point], dtype=torch.int)
+        self.set_module_name("QConv2dInt8")
+
+        out_h = (H + 2 * pad - kernel) // stride + 1
+        out_w = (W + 2 * pad - kernel) // stride + 1
+        self.set_ops_per_run(2 * N * OC * out_h * out_w * (IC // G) * kernel * kernel)
+
+    def _run(self):
+        return self.qconv2d(self.input)
+
+
+# Residual-add activation shapes (N, C, H, W)
+qgemm_add_configs = op_bench.config_list(
+    attrs=[
+        [1, 256, 56, 56],
+        [1, 512, 28, 28],
+        [1, 1024, 14, 14],
+    ],
+    attr_names=["N", "C", "H", "W"],
+    cross_product_configs={
+        'engine': ENGINES,
+    },
+    tags=["qgemm"],
+)
+
+
+class QAddInt8Benchmark(_QEngineBenchmarkBase):
+    def init(self, N, C, H, W, engine):
+        self._set_engine(engine)
+        self.scale = 1.0 / 255
+        self.zero_point = 0
+        self.qa = torch.quantize_per_tensor(
+            torch.randn(N, C, H, W), scale=self.scale,
+            zero_point=self.zero_point, dtype=torch.quint8)
+        self.qb = torch.quantize_per_tensor(
+            torch.randn(N, C, H, W), scale=self.scale,
+            zero_point=self.zero_point, dtype=torch.quint8)
+        self.set_module_name("QAddInt8")
+        self.set_ops_per_run(N * C * H * W)
+
+    def _run(self):
+        return torch.ops.quantized.add(
+            self.qa, self.qb, self.scale, self.zero_point)
+
+
+# Quantize/dequantize are engine independent, so no engine sweep here;
+# they are included so the suite covers the full quantized critical path.
+qgemm_requant_configs = op_bench.config_list(
+    attrs=[
+        [1, 256, 56, 56],
+        [1, 1024, 14, 14],
+        [128, 768, 1, 1],
+    ],
+    attr_names=["N", "C", "H", "W"],
+    tags=["qgemm"],
+)
+
+
+class QuantizeInt8Benchmark(op_bench.TorchBenchmarkBase):
+    def init(self, N, C, H, W):
+        self.input = torch.randn(N, C, H, W)
+        self.set_module_name("QuantizeInt8")
+        self.set_ops_per_run(N * C * H * W)
+
+    def forward(self):
+        return torch.quantize_per_tensor(
+            self.input, scale=1.0 / 255, zero_point=0, dtype=torch.quint8)
+
+
+class DequantizeInt8Benchmark(op_bench.TorchBenchmarkBase):
+    def init(self, N, C, H, W):
+        self.input = torch.quantize_per_tensor(
+            torch.randn(N, C, H, W), scale=1.0 / 255, zero_point=0,
+            dtype=torch.quint8)
+        self.set_module_name("DequantizeInt8")
+        self.set_ops_per_run(N * C * H * W)
+
+    def forward(self):
+        return self.input.dequantize()
+
+
+if ENGINES:
+    op_bench.generate_pt_test(qgemm_linear_configs, QLinearInt8Benchmark)
+    op_bench.generate_pt_test(qgemm_conv_configs, QConv2dInt8Benchmark)
+    op_bench.generate_pt_test(qgemm_add_configs, QAddInt8Benchmark)
+op_bench.generate_pt_test(qgemm_requant_configs, QuantizeInt8Benchmark)
+op_bench.generate_pt_test(qgemm_requant_configs, DequantizeInt8Benchmark)
+
+
+if __name__ == "__main__":
+    op_bench.benchmark_runner.main()
@@ -0,0 +1,192 @@
+/**
+ * End-to-end input pipeline benchmark for the torch::data stack.
+ *
+ * Synthesizes a dataset of configurable sample shape and measures each
+ * stage of the data path separately, so an input-pipeline regression shows
+ * up here instead of as unexplained GPU idle time:
+ *
+ *   collate   — transforms::Stack cost for one batch, isolated
+ *   loader    — full DataLoader epochs across worker counts
+ *   pin       — pin_memory() on collated batches (CUDA builds)
+ *   h2d       — host-to-device copy, pageable+blocking vs pinned+async
+ *
+ * Throughput is reported per stage in examples/s and MB/s.
+ *
+ * Example:
+ *   data_pipeline_benchmark --sample_dims 3,224,224 --batch_size 64 \
+ *       --num_batches 100 --max_workers 8
+ */
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "torch/torch.h"
+
+C10_DEFINE_string(sample_dims, "3,224,224", "Comma separated sample shape.");
+C10_DEFINE_int(batch_size, 64, "Batch size.");
+C10_DEFINE_int(num_batches, 100, "Batches per epoch.");
+C10_DEFINE_int(max_workers, 4, "Measure worker counts 0,1,2,..up to this.");
+C10_DEFINE_int(epochs, 3, "Timed epochs per configuration.");
+
+namespace {
+
+using Clock = std::chrono::high_resolution_clock;
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+struct SyntheticDataset : torch::data::datasets::Dataset<SyntheticDataset> {
+  SyntheticDataset(std::vector<int64_t> dims, size_t size)
+      : dims_(std::move(dims)), size_(size) {}
+
+  torch::data::Example<> get(size_t /* index */) override {
+    // Generated per get() like a real decode step, so workers have actual
+    // per-sample work to parallelize.
+    return {torch::rand(dims_), torch::zeros({1})};
+  }
+
+  torch::optional<size_t> size() const override {
+    return size_;
+  }
+
+  std::vector<int64_t> dims_;
+  size_t size_;
+};
+
+void report(
+    const std::string& stage,
+    double seconds,
+    size_t examples,
+    size_t bytes_per_example) {
+  const double mb =
+      static_cast<double>(examples) * bytes_per_example / (1024.0 * 1024.0);
+  std::cout << stage << ": " << (examples / seconds) << " examples/s, "
+            << (mb / seconds) << " MB/s\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (!c10::ParseCommandLineFlags(&argc, &argv)) {
+    std::cerr << "Failed to parse command line flags" << std::endl;
+    return 1;
+  }
+
+  std::vector<int64_t> dims;
+  std::stringstream dims_stream(FLAGS_sample_dims);
+  std::string dim;
+  while (std::getline(dims_stream, dim, ',')) {
+    dims.push_back(std::stoll(dim));
+  }
+
+  const size_t batch_size = FLAGS_batch_size;
+  const size_t epoch_examples = batch_size * FLAGS_num_batches;
+  const size_t bytes_per_example =
+      torch::rand(dims).numel() * sizeof(float);
+  torch::NoGradGuard no_grad;
+
+  // Stage 1: collate (Stack) in isolation.
+  {
+    std::vector<torch::data::Example<>> batch;
+    for (size_t i = 0; i < batch_size; i++) {
+      batch.push_back({torch::rand(dims), torch::zeros({1})});
+    }
+    torch::data::transforms::Stack<torch::data::Example<>> stack;
+    // One warmup application, then time.
+    {
+      auto copy = batch;
+      stack.apply_batch(std::move(copy));
+    }
+    auto start = Clock::now();
+    for (int i = 0; i < FLAGS_num_batches; i++) {
+      auto copy = batch;
+      auto collated = stack.apply_batch(std::move(copy));
+    }
+    report("collate", secondsSince(start), epoch_examples, bytes_per_example);
+  }
+
+  // Stage 2: DataLoader worker scaling, full path (get + collate).
+  for (size_t workers = 0; workers <= static_cast<size_t>(FLAGS_max_workers);
+       workers = workers == 0 ? 1 : workers * 2) {
+    auto dataset = SyntheticDataset(dims, epoch_examples)
+                       .map(torch::data::transforms::Stack<>());
+    auto options =
+        torch::data::DataLoaderOptions().batch_size(batch_size).workers(
+            workers);
+    auto loader =
+        torch::data::make_data_loader(std::move(dataset), options);
+    // Warmup epoch covers worker startup.
+    for (auto& batch : *loader) {
+      (void)batch;
+    }
+    auto start = Clock::now();
+    for (int epoch = 0; epoch < FLAGS_epochs; epoch++) {
+      for (auto& batch : *loader) {
+        (void)batch;
+      }
+    }
+    report(
+        "loader (workers=" + c10::to_string(workers) + ")",
+        secondsSince(start),
+        epoch_examples * FLAGS_epochs,
+        bytes_per_example);
+  }
+
+  if (!torch::cuda::is_available()) {
+    std::cout << "CUDA not available; skipping pin and h2d stages\n";
+    return 0;
+  }
+
+  // Stage 3: pinning collated batches.
+  std::vector<int64_t> batch_dims;
+  batch_dims.push_back(batch_size);
+  batch_dims.insert(batch_dims.end(), dims.begin(), dims.end());
+  auto batch = torch::rand(batch_dims);
+  {
+    auto warm = batch.pin_memory();
+    auto start = Clock::now();
+    for (int i = 0; i < FLAGS_num_batches; i++) {
+      auto pinned = batch.pin_memory();
+    }
+    report("pin", secondsSince(start), epoch_examples, bytes_per_example);
+  }
+
+  // Stage 4: H2D, pageable+blocking vs pinned+async. The async path is
+  // synchronized once at the end, so it also shows how much copy latency a
+  // prefetching loader could hide.
+  {
+    auto warm = batch.to(torch::kCUDA);
+    auto start = Clock::now();
+    torch::Tensor device_batch;
+    for (int i = 0; i < FLAGS_num_batches; i++) {
+      device_batch = batch.to(torch::kCUDA);
+    }
+    // D2H readback on the same stream drains outstanding copies.
+    device_batch.cpu();
+    report(
+        "h2d (pageable, blocking)",
+        secondsSince(start),
+        epoch_examples,
+        bytes_per_example);
+  }
+  {
+    auto pinned = batch.pin_memory();
+    auto start = Clock::now();
+    torch::Tensor device_batch;
+    for (int i = 0; i < FLAGS_num_batches; i++) {
+      device_batch = pinned.to(torch::kCUDA, /* non_blocking */ true);
+    }
+    device_batch.cpu();
+    report(
+        "h2d (pinned, async)",
+        secondsSince(start),
+        epoch_examples,
+        bytes_per_example);
+  }
+
+  return 0;
+}
@@ -0,0 +1,255 @@
+/**
+ * Replays an op log recorded by torch._C._enable_op_recording() (see
+ * torch/csrc/autograd/op_replay_log.cpp for the line format). For each
+ * logged op it rebuilds the input stack — tensors as empty_strided with the
+ * recorded shape/stride/dtype, scalars and lists with their literal values
+ * — resolves the operator by schema against the JIT operator registry, and
+ * re-executes the sequence. Running the same log against two builds gives
+ * an A/B comparison of op-level performance without shipping the workload.
+ *
+ * Ops whose inputs the log could not express, or whose schema cannot be
+ * matched in the target build, are skipped and counted.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ATen/ATen.h"
+#include "torch/csrc/autograd/grad_mode.h"
+#include "torch/csrc/autograd/profiler.h"
+#include "torch/csrc/jit/runtime/operator.h"
+
+C10_DEFINE_string(log, "", "Op log file recorded with _enable_op_recording.");
+C10_DEFINE_int(warmup, 1, "Replays of the whole log before timing.");
+C10_DEFINE_int(iter, 10, "Timed replays of the whole log.");
+C10_DEFINE_bool(per_op, false, "Print per-op-name aggregate timings.");
+
+namespace {
+
+struct LoggedOp {
+  std::string name;
+  int64_t recorded_duration_ns = 0;
+  // Inputs reconstructed once; tensors are re-materialized fresh for every
+  // replay so in-place ops do not feed on their own output.
+  std::vector<c10::IValue> input_templates;
+  bool replayable = true;
+  std::shared_ptr<torch::jit::Operator> op;
+};
+
+at::Tensor parseTensor(std::istringstream& line) {
+  int dtype = 0;
+  int64_t ndim = 0;
+  line >> dtype >> ndim;
+  std::vector<int64_t> sizes(ndim);
+  std::vector<int64_t> strides(ndim);
+  for (auto& size : sizes) {
+    line >> size;
+  }
+  for (auto& stride : strides) {
+    line >> stride;
+  }
+  return at::empty_strided(
+      sizes,
+      strides,
+      at::TensorOptions().dtype(static_cast<at::ScalarType>(dtype)));
+}
+
+bool parseInput(std::istringstream& line, std::vector<c10::IValue>& inputs) {
+  std::string tag;
+  if (!(line >> tag)) {
+    return false;
+  }
+  if (tag == "t") {
+    inputs.emplace_back(parseTensor(line));
+  } else if (tag == "ut") {
+    inputs.emplace_back(at::Tensor());
+  } else if (tag == "i") {
+    int64_t v = 0;
+    line >> v;
+    inputs.emplace_back(v);
+  } else if (tag == "f") {
+    double v = 0;
+    line >> v;
+    inputs.emplace_back(v);
+  } else if (tag == "b") {
+    int v = 0;
+    line >> v;
+    inputs.emplace_back(v != 0);
+  } else if (tag == "n") {
+    inputs.emplace_back();
+  } else if (tag == "il") {
+    size_t n = 0;
+    line >> n;
+    std::vector<int64_t> vals(n);
+    for (auto& v : vals) {
+      line >> v;
+    }
+    inputs.emplace_back(vals);
+  } else if (tag == "fl") {
+    size_t n = 0;
+    line >> n;
+    std::vector<double> vals(n);
+    for (auto& v : vals) {
+      line >> v;
+    }
+    inputs.emplace_back(vals);
+  } else if (tag == "bl") {
+    size_t n = 0;
+    line >> n;
+    c10::List<bool> vals;
+    for (size_t i = 0; i < n; i++) {
+      int v = 0;
+      line >> v;
+      vals.push_back(v != 0);
+    }
+    inputs.emplace_back(vals);
+  } else if (tag == "tl") {
+    size_t n = 0;
+    line >> n;
+    std::vector<at::Tensor> tensors;
+    tensors.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+      std::string inner_tag;
+      line >> inner_tag;
+      tensors.push_back(inner_tag == "t" ? parseTensor(line) : at::Tensor());
+    }
+    inputs.emplace_back(tensors);
+  } else {
+    // "u" or anything a newer recorder emits: not reconstructible.
+    return false;
+  }
+  return true;
+}
+
+// Resolves an op by trying every overload registered under aten::<name>
+// (and prim::<name>) whose schema accepts the recorded argument count.
+std::shared_ptr<torch::jit::Operator> resolveOp(
+    const std::string& name,
+    size_t num_args) {
+  for (const char* ns : {"aten::", "prim::"}) {
+    auto symbol = c10::Symbol::fromQualString(ns + name);
+    for (const auto& candidate : torch::jit::getAllOperatorsFor(symbol)) {
+      // Node-dependent ops (OperationCreator) cannot run without IR.
+      if (candidate->hasOperation() &&
+          candidate->schema().arguments().size() == num_args) {
+        return candidate;
+      }
+    }
+  }
+  return nullptr;
+}
+
+// Fresh tensors for one replay; non-tensor IValues are immutable and can be
+// shared with the template.
+std::vector<c10::IValue> materializeInputs(const LoggedOp& logged) {
+  std::vector<c10::IValue> stack;
+  stack.reserve(logged.input_templates.size());
+  for (const auto& input : logged.input_templates) {
+    if (input.isTensor() && input.toTensor().defined()) {
+      const auto& t = input.toTensor();
+      stack.emplace_back(
+          at::empty_strided(t.sizes(), t.strides(), t.options()));
+    } else {
+      stack.push_back(input);
+    }
+  }
+  return stack;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (!c10::ParseCommandLineFlags(&argc, &argv)) {
+    std::cerr << "Failed to parse command line flags" << std::endl;
+    return 1;
+  }
+  if (FLAGS_log.empty()) {
+    std::cerr << "usage: op_replayer --log <file> [--iter N] [--warmup N]"
+              << std::endl;
+    return 1;
+  }
+
+  std::ifstream log_file(FLAGS_log);
+  if (!log_file) {
+    std::cerr << "could not open " << FLAGS_log << std::endl;
+    return 1;
+  }
+
+  std::vector<LoggedOp> ops;
+  size_t unparseable = 0;
+  size_t unresolved = 0;
+  std::string raw_line;
+  while (std::getline(log_file, raw_line)) {
+    if (raw_line.empty()) {
+      continue;
+    }
+    std::istringstream line(raw_line);
+    LoggedOp logged;
+    size_t num_args = 0;
+    line >> logged.name >> logged.recorded_duration_ns >> num_args;
+    for (size_t i = 0; i < num_args && logged.replayable; i++) {
+      logged.replayable = parseInput(line, logged.input_templates);
+    }
+    if (!logged.replayable) {
+      unparseable++;
+    } else {
+      logged.op = resolveOp(logged.name, num_args);
+      if (!logged.op) {
+        logged.replayable = false;
+        unresolved++;
+      }
+    }
+    ops.push_back(std::move(logged));
+  }
+
+  torch::autograd::GradMode::set_enabled(false);
+
+  size_t failed = 0;
+  std::unordered_map<std::string, int64_t> per_op_ns;
+  int64_t total_ns = 0;
+  for (int round = 0; round < FLAGS_warmup + FLAGS_iter; round++) {
+    const bool timed = round >= FLAGS_warmup;
+    for (auto& logged : ops) {
+      if (!logged.replayable) {
+        continue;
+      }
+      auto stack = materializeInputs(logged);
+      const int64_t start = torch::autograd::profiler::getTime();
+      try {
+        logged.op->getOperation()(stack);
+      } catch (const std::exception&) {
+        // Some ops need meaningful input values (e.g. indices); drop them
+        // from the replay instead of aborting the run.
+        logged.replayable = false;
+        failed++;
+        continue;
+      }
+      if (timed) {
+        const int64_t elapsed =
+            torch::autograd::profiler::getTime() - start;
+        total_ns += elapsed;
+        per_op_ns[logged.name] += elapsed;
+      }
+    }
+  }
+
+  const size_t replayed =
+      ops.size() - unparseable - unresolved - failed;
+  std::cout << "ops in log:        " << ops.size() << "\n"
+            << "replayed:          " << replayed << "\n"
+            << "unsupported input: " << unparseable << "\n"
+            << "unresolved schema: " << unresolved << "\n"
+            << "failed at runtime: " << failed << "\n"
+            << "total replay time: " << (total_ns / 1000000.0) << " ms over "
+            << FLAGS_iter << " iterations\n";
+  if (FLAGS_per_op) {
+    for (const auto& entry : per_op_ns) {
+      std::cout << entry.first << " " << (entry.second / 1000.0) << " us\n";
+    }
+  }
+  return 0;
+}
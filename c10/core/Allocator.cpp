@@ -1,5 +1,8 @@
 #include <c10/core/Allocator.h>
 
+#include <atomic>
+#include <mutex>
+
 namespace c10 {
 
 static void deleteInefficientStdFunctionContext(void* ptr) {
@@ -28,4 +31,38 @@ at::Allocator* GetAllocator(const at::DeviceType& t) {
   return alloc;
 }
 
+namespace {
+std::mutex memory_reporting_mutex;
+std::shared_ptr<MemoryReportingInfoBase> memory_reporting_info;
+std::atomic<bool> memory_profiling_enabled{false};
+} // namespace
+
+std::shared_ptr<MemoryReportingInfoBase> setMemoryReportingInfo(
+    std::shared_ptr<MemoryReportingInfoBase> info) {
+  std::lock_guard<std::mutex> guard(memory_reporting_mutex);
+  auto prev = std::move(memory_reporting_info);
+  memory_reporting_info = std::move(info);
+  memory_profiling_enabled.store(
+      memory_reporting_info != nullptr, std::memory_order_relaxed);
+  return prev;
+}
+
+bool memoryProfilingEnabled() {
+  return memory_profiling_enabled.load(std::memory_order_relaxed);
+}
+
+void reportMemoryUsageToProfiler(
+    void* ptr,
+    int64_t alloc_size,
+    Device device) {
+  std::shared_ptr<MemoryReportingInfoBase> reporter;
+  {
+    std::lock_guard<std::mutex> guard(memory_reporting_mutex);
+    reporter = memory_reporting_info;
+  }
+  if (reporter) {
+    reporter->reportMemoryUsage(ptr, alloc_size, device);
+  }
+}
+
 } // namespace c10
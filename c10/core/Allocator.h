@@ -214,4 +214,33 @@ struct AllocatorRegisterer {
   static AllocatorRegisterer<t> g_allocator_d(f); \
   }
 
+// An interface for reporting thread local memory usage
+// per device
+struct C10_API MemoryReportingInfoBase {
+  MemoryReportingInfoBase() = default;
+  virtual ~MemoryReportingInfoBase() = default;
+
+  // alloc_size is the requested size on allocation and the negated
+  // allocation size on free, so live memory is the running sum.
+  virtual void reportMemoryUsage(
+      void* ptr,
+      int64_t alloc_size,
+      Device device) = 0;
+};
+
+// Installs the process-wide memory reporter (pass nullptr to uninstall)
+// and returns the previously installed one. Allocators check
+// memoryProfilingEnabled() before doing any reporting work, so an
+// uninstalled reporter costs one relaxed atomic load per allocation.
+C10_API std::shared_ptr<MemoryReportingInfoBase> setMemoryReportingInfo(
+    std::shared_ptr<MemoryReportingInfoBase> info);
+
+C10_API bool memoryProfilingEnabled();
+
+// Forwards to the installed reporter, if any.
+C10_API void reportMemoryUsageToProfiler(
+    void* ptr,
+    int64_t alloc_size,
+    Device device);
+
 } // namespace c10
@@ -1,5 +1,9 @@
 #include <c10/core/CPUAllocator.h>
+#include <c10/core/CPUCachingAllocator.h>
 #include <c10/core/DeviceType.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <atomic>
 
 // TODO: rename flags to C10
 C10_DEFINE_bool(
@@ -71,8 +75,11 @@ void* alloc_cpu(size_t nbytes) {
       nbytes,
       " bytes. Buy new RAM!");
 
-  // move data to a thread's NUMA node
-  NUMAMove(data, nbytes, GetCurrentNUMANode());
+  // move data to the preferred NUMA node if one is set, else this thread's
+  // node
+  int numa_node_id = GetPreferredNUMANode();
+  NUMAMove(
+      data, nbytes, numa_node_id >= 0 ? numa_node_id : GetCurrentNUMANode());
   CHECK(
       !FLAGS_caffe2_cpu_allocator_do_zero_fill ||
       !FLAGS_caffe2_cpu_allocator_do_junk_fill)
@@ -94,6 +101,87 @@ void free_cpu(void* data) {
 #endif
 }
 
+namespace {
+
+struct AllocatorStatsState {
+  std::mutex mutex;
+  CPUAllocatorStats stats;
+
+  AllocatorStatsState() {
+    stats.size_histogram.resize(kCPUAllocatorStatsNumBuckets, 0);
+  }
+};
+
+AllocatorStatsState& allocatorStatsState() {
+  static AllocatorStatsState state;
+  return state;
+}
+
+std::atomic<bool> cpu_allocator_stats_enabled{false};
+
+size_t sizeBucket(size_t nbytes) {
+  if (nbytes <= 1) {
+    return 0;
+  }
+  return std::min<size_t>(
+      llvm::Log2_64(nbytes), kCPUAllocatorStatsNumBuckets - 1);
+}
+
+void recordAllocation(size_t nbytes) {
+  auto& state = allocatorStatsState();
+  std::lock_guard<std::mutex> guard(state.mutex);
+  state.stats.allocation_count++;
+  state.stats.allocated_bytes += nbytes;
+  state.stats.live_bytes += nbytes;
+  state.stats.peak_bytes =
+      std::max(state.stats.peak_bytes, state.stats.live_bytes);
+  state.stats.size_histogram[sizeBucket(nbytes)]++;
+}
+
+void recordFree(size_t nbytes) {
+  auto& state = allocatorStatsState();
+  std::lock_guard<std::mutex> guard(state.mutex);
+  state.stats.free_count++;
+  state.stats.freed_bytes += nbytes;
+  state.stats.live_bytes -= nbytes;
+}
+
+} // namespace
+
+void enableCPUAllocatorStats(bool enable) {
+  cpu_allocator_stats_enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool cpuAllocatorStatsEnabled() {
+  return cpu_allocator_stats_enabled.load(std::memory_order_relaxed);
+}
+
+CPUAllocatorStats getCPUAllocatorStats() {
+  auto& state = allocatorStatsState();
+  CPUAllocatorStats result;
+  {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    result = state.stats;
+  }
+  if (auto* caching_allocator = GetThreadLocalCachingAllocator()) {
+    const auto caching_stats = caching_allocator->stats();
+    const double denom = static_cast<double>(caching_stats.cached_bytes) +
+        static_cast<double>(result.live_bytes);
+    if (denom > 0) {
+      result.fragmentation_ratio =
+          static_cast<double>(caching_stats.cached_bytes) / denom;
+    }
+  }
+  return result;
+}
+
+void resetCPUAllocatorStats() {
+  auto& state = allocatorStatsState();
+  std::lock_guard<std::mutex> guard(state.mutex);
+  state.stats = CPUAllocatorStats();
+  state.stats.size_histogram.resize(kCPUAllocatorStatsNumBuckets, 0);
+}
+
 // A virtual struct that is used to report C10's memory allocation and
 // deallocation status
 class C10_API MemoryAllocationReporter {
@@ -112,14 +200,35 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
   DefaultCPUAllocator() {}
   ~DefaultCPUAllocator() override {}
   at::DataPtr allocate(size_t nbytes) const override {
+    if (auto* caching_allocator = GetThreadLocalCachingAllocator()) {
+      void* data = caching_allocator->allocate(nbytes);
+      return {data, data, &CachedDelete, at::Device(at::DeviceType::CPU)};
+    }
     void* data = alloc_cpu(nbytes);
-    if (FLAGS_caffe2_report_cpu_memory_usage && nbytes > 0) {
+    if ((FLAGS_caffe2_report_cpu_memory_usage || memoryProfilingEnabled() ||
+         cpuAllocatorStatsEnabled()) &&
+        nbytes > 0) {
       getMemoryAllocationReporter().New(data, nbytes);
       return {data, data, &ReportAndDelete, at::Device(at::DeviceType::CPU)};
     }
     return {data, data, &free_cpu, at::Device(at::DeviceType::CPU)};
   }
 
+  // Deleter for allocations that were made through a thread's
+  // CPUCachingAllocator; returns the block to the cache when one is still
+  // installed, otherwise releases it to the system.
+  static void CachedDelete(void* ptr) {
+    if (!ptr) {
+      return;
+    }
+    if (auto* caching_allocator = GetThreadLocalCachingAllocator()) {
+      caching_allocator->free(ptr);
+    } else {
+      CPUCachingAllocator::record_free(ptr);
+      free_cpu(ptr);
+    }
+  }
+
   static void ReportAndDelete(void* ptr) {
     if (!ptr) {
       return;
@@ -129,7 +238,8 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
   }
 
   at::DeleterFnPtr raw_deleter() const override {
-    if (FLAGS_caffe2_report_cpu_memory_usage) {
+    if (FLAGS_caffe2_report_cpu_memory_usage || memoryProfilingEnabled() ||
+        cpuAllocatorStatsEnabled()) {
       return &ReportAndDelete;
     }
     return &free_cpu;
@@ -163,21 +273,40 @@ at::Allocator* GetDefaultCPUAllocator() {
 REGISTER_ALLOCATOR(DeviceType::CPU, &g_cpu_alloc);
 
 void MemoryAllocationReporter::New(void* ptr, size_t nbytes) {
-  std::lock_guard<std::mutex> guard(mutex_);
-  size_table_[ptr] = nbytes;
-  allocated_ += nbytes;
-  LOG(INFO) << "C10 alloc " << nbytes << " bytes, total alloc " << allocated_
-            << " bytes.";
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    size_table_[ptr] = nbytes;
+    allocated_ += nbytes;
+    if (FLAGS_caffe2_report_cpu_memory_usage) {
+      LOG(INFO) << "C10 alloc " << nbytes << " bytes, total alloc "
+                << allocated_ << " bytes.";
+    }
+  }
+  if (cpuAllocatorStatsEnabled()) {
+    recordAllocation(nbytes);
+  }
+  reportMemoryUsageToProfiler(
+      ptr, nbytes, at::Device(at::DeviceType::CPU));
 }
 
 void MemoryAllocationReporter::Delete(void* ptr) {
-  std::lock_guard<std::mutex> guard(mutex_);
-  auto it = size_table_.find(ptr);
-  CHECK(it != size_table_.end());
-  allocated_ -= it->second;
-  LOG(INFO) << "C10 deleted " << it->second << " bytes, total alloc "
-            << allocated_ << " bytes.";
-  size_table_.erase(it);
+  size_t nbytes = 0;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = size_table_.find(ptr);
+    CHECK(it != size_table_.end());
+    nbytes = it->second;
+    allocated_ -= nbytes;
+    if (FLAGS_caffe2_report_cpu_memory_usage) {
+      LOG(INFO) << "C10 deleted " << nbytes << " bytes, total alloc "
+                << allocated_ << " bytes.";
+    }
+  }
+  if (cpuAllocatorStatsEnabled()) {
+    recordFree(nbytes);
+  }
+  reportMemoryUsageToProfiler(
+      ptr, -static_cast<int64_t>(nbytes), at::Device(at::DeviceType::CPU));
 }
 
 } // namespace c10
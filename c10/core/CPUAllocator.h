@@ -2,6 +2,7 @@
 
 #include <cstring>
 #include <unordered_map>
+#include <vector>
 
 #include <c10/core/Allocator.h>
 #include <c10/util/Logging.h>
@@ -39,4 +40,34 @@ C10_API void SetCPUAllocator(at::Allocator* alloc);
 // Get the Default CPU Allocator
 C10_API at::Allocator* GetDefaultCPUAllocator();
 
+// log2 size buckets for the allocation size histogram; bucket i counts
+// allocations in [2^i, 2^(i+1)) bytes, with the last bucket absorbing
+// everything larger.
+constexpr size_t kCPUAllocatorStatsNumBuckets = 48;
+
+// Counters for the default CPU allocator, the CPU-side analogue of
+// CUDACachingAllocator's stats(). Collection is off by default; enable it
+// with enableCPUAllocatorStats() (one branch per allocation when off).
+// Allocation rate can be derived by polling allocation_count over time.
+// Allocations served by a thread's CPUCachingAllocator bypass these
+// counters and are covered by CPUCachingAllocator::stats() instead;
+// fragmentation_ratio is filled in from the calling thread's caching
+// allocator (cached bytes over cached plus live) when one is installed,
+// and is 0 otherwise.
+struct C10_API CPUAllocatorStats {
+  int64_t allocation_count = 0;
+  int64_t free_count = 0;
+  int64_t allocated_bytes = 0;
+  int64_t freed_bytes = 0;
+  int64_t live_bytes = 0;
+  int64_t peak_bytes = 0;
+  double fragmentation_ratio = 0;
+  std::vector<int64_t> size_histogram;
+};
+
+C10_API void enableCPUAllocatorStats(bool enable);
+C10_API bool cpuAllocatorStatsEnabled();
+C10_API CPUAllocatorStats getCPUAllocatorStats();
+C10_API void resetCPUAllocatorStats();
+
 } // namespace c10
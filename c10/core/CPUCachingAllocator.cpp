@@ -0,0 +1,146 @@
+#include <c10/core/CPUCachingAllocator.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/util/Exception.h>
+
+#include <atomic>
+
+namespace c10 {
+
+std::mutex CPUCachingAllocator::mutex_;
+ska::flat_hash_map<void*, size_t> CPUCachingAllocator::allocation_map_;
+
+namespace {
+thread_local CPUCachingAllocator* caching_allocator_ptr = nullptr;
+std::atomic<bool> process_wide_enabled{false};
+} // namespace
+
+size_t CPUCachingAllocator::round_to_size_class(size_t bytes) {
+  // Small blocks: multiples of the allocation alignment.
+  constexpr size_t kMinClass = 64; // gAlignment
+  if (bytes <= kMinClass) {
+    return kMinClass;
+  }
+  // Larger blocks: multiples of an eighth of the enclosing power of two,
+  // capping rounding slack at ~12.5% while folding nearby sizes into one
+  // bin.
+  size_t step = kMinClass;
+  while (step * 16 < bytes) {
+    step <<= 1;
+  }
+  return (bytes + step - 1) / step * step;
+}
+
+void* CPUCachingAllocator::allocate_and_cache(size_t bytes) {
+  void* ptr;
+  try {
+    ptr = alloc_cpu(bytes);
+  } catch (c10::Error&) {
+    // The cache may be holding exactly the memory we need; release it and
+    // retry before giving up.
+    free_cached();
+    ptr = alloc_cpu(bytes);
+  }
+  allocation_map_[ptr] = bytes;
+  return ptr;
+}
+
+void* CPUCachingAllocator::allocate(size_t bytes) {
+  if (bytes == 0) {
+    return nullptr;
+  }
+  const size_t rounded = round_to_size_class(bytes);
+  std::lock_guard<std::mutex> guard(mutex_);
+  const auto it = available_map_.find(rounded);
+  if (it == available_map_.end() || it->second.empty()) {
+    ++stats_.misses;
+    return allocate_and_cache(rounded);
+  }
+  ++stats_.hits;
+  stats_.cached_bytes -= rounded;
+  return it->second.pop_back_val();
+}
+
+void CPUCachingAllocator::free(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  const auto it = allocation_map_.find(ptr);
+  if (it == allocation_map_.end()) {
+    // not one of ours (e.g. allocated before the guard was installed)
+    free_cpu(ptr);
+    return;
+  }
+  available_map_[it->second].push_back(ptr);
+  stats_.cached_bytes += it->second;
+  if (stats_.cached_bytes > stats_.max_cached_bytes) {
+    stats_.max_cached_bytes = stats_.cached_bytes;
+  }
+}
+
+void CPUCachingAllocator::record_free(void* ptr) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  allocation_map_.erase(ptr);
+}
+
+void CPUCachingAllocator::free_cached() {
+  for (const auto& entry : available_map_) {
+    for (void* ptr : entry.second) {
+      free_cpu(ptr);
+      allocation_map_.erase(ptr);
+    }
+  }
+  available_map_.clear();
+  stats_.cached_bytes = 0;
+}
+
+void CPUCachingAllocator::trim() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  free_cached();
+}
+
+CPUCachingAllocatorStats CPUCachingAllocator::stats() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return stats_;
+}
+
+CPUCachingAllocator::~CPUCachingAllocator() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  free_cached();
+}
+
+void SetCPUCachingAllocatorEnabled(bool enabled) {
+  process_wide_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool CPUCachingAllocatorEnabled() {
+  return process_wide_enabled.load(std::memory_order_relaxed);
+}
+
+CPUCachingAllocator* GetThreadLocalCachingAllocator() {
+  if (caching_allocator_ptr != nullptr) {
+    return caching_allocator_ptr;
+  }
+  if (CPUCachingAllocatorEnabled()) {
+    // One implicit allocator per thread: each thread recycles through its
+    // own bins (a thread-local magazine), while the shared allocation map
+    // keeps frees from other threads correct. Its cache is released when
+    // the thread exits.
+    thread_local CPUCachingAllocator per_thread_allocator;
+    return &per_thread_allocator;
+  }
+  return nullptr;
+}
+
+WithCPUCachingAllocatorGuard::WithCPUCachingAllocatorGuard(
+    CPUCachingAllocator* allocator)
+    : prev_allocator_(caching_allocator_ptr) {
+  caching_allocator_ptr = allocator;
+}
+
+WithCPUCachingAllocatorGuard::~WithCPUCachingAllocatorGuard() {
+  caching_allocator_ptr = prev_allocator_;
+}
+
+} // namespace c10
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <c10/macros/Macros.h>
+#include <c10/util/SmallVector.h>
+#include <c10/util/flat_hash_map.h>
+
+namespace c10 {
+
+/*
+ * CPUCachingAllocator:
+ * Caches CPU allocations instead of returning them to the system, so that a
+ * steady-state inference loop performs zero heap allocations for
+ * activations: the first iteration sizes the cache, later iterations are
+ * served entirely from it.
+ *
+ * The cache is engaged per thread via WithCPUCachingAllocatorGuard; while a
+ * guard is alive, every CPU tensor allocation on that thread goes through
+ * the given allocator, and frees of such allocations return the block to
+ * the allocator's free lists instead of the system.
+ *
+ * Requests are rounded up to a size class before allocation (multiples of
+ * the allocation alignment for small blocks, eighths of powers of two
+ * beyond that, capping internal waste at ~12.5%), and free blocks are
+ * binned by class. Slightly varying request sizes therefore still reuse
+ * the same blocks, at the cost of the rounding slack; it makes no attempt
+ * at offset-level packing, so memory held tracks the high-water mark of
+ * live allocations rather than an optimal arena layout.
+ *
+ * What to keep in mind:
+ * - Memory given to the allocator is only returned to the system by
+ *   `trim()`, on destruction, or under allocation failure. Do not route
+ *   one-time allocations such as weights through it.
+ * - An allocation made under the guard but freed on a thread without an
+ *   active guard is released to the system directly.
+ */
+
+/// Counters for one `CPUCachingAllocator`, in the spirit of the CUDA
+/// caching allocator's stats. Hits are allocations served from the cache.
+struct C10_API CPUCachingAllocatorStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  size_t cached_bytes = 0;
+  size_t max_cached_bytes = 0;
+};
+
+class C10_API CPUCachingAllocator {
+ public:
+  // Checks the free list for a block of the request's size class before
+  // falling back to the system allocator.
+  void* allocate(size_t bytes);
+  // Returns ptr to the free list if it was allocated here, otherwise
+  // frees it to the system.
+  void free(void* ptr);
+  // Forgets ptr without freeing it; called when a cached allocation is
+  // released through a non-caching path.
+  static void record_free(void* ptr);
+  // Releases all cached free blocks to the system (live blocks are
+  // unaffected), like the CUDA caching allocator's emptyCache.
+  void trim();
+  // A snapshot of this allocator's counters.
+  CPUCachingAllocatorStats stats() const;
+  // The number of bytes actually allocated for a request of `bytes`.
+  static size_t round_to_size_class(size_t bytes);
+  virtual ~CPUCachingAllocator();
+
+ protected:
+  void* allocate_and_cache(size_t bytes);
+  void free_cached();
+
+ private:
+  // allocation_map_ is shared across allocator instances (and threads), so
+  // a pointer can be freed through a different instance than allocated it.
+  // mutex_ guards both maps and stats_.
+  static std::mutex mutex_;
+  static ska::flat_hash_map<void*, size_t> allocation_map_;
+  ska::flat_hash_map<size_t, c10::SmallVector<void*, 16>> available_map_;
+  CPUCachingAllocatorStats stats_;
+};
+
+/// Process-wide switch for the caching allocator. While enabled, every CPU
+/// tensor allocation on a thread without an explicit guard goes through a
+/// lazily-created per-thread allocator, so each thread recycles through its
+/// own bins. An explicit `WithCPUCachingAllocatorGuard` still takes
+/// precedence.
+C10_API void SetCPUCachingAllocatorEnabled(bool enabled);
+C10_API bool CPUCachingAllocatorEnabled();
+
+/// The caching allocator in effect on this thread: the one installed by the
+/// innermost guard, the thread's implicit allocator if the process-wide
+/// switch is on, or nullptr.
+C10_API CPUCachingAllocator* GetThreadLocalCachingAllocator();
+
+class C10_API WithCPUCachingAllocatorGuard {
+ public:
+  WithCPUCachingAllocatorGuard(CPUCachingAllocator* allocator);
+  ~WithCPUCachingAllocatorGuard();
+
+ private:
+  CPUCachingAllocator* prev_allocator_;
+};
+
+} // namespace c10
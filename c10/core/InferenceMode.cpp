@@ -0,0 +1,32 @@
+#include <c10/core/InferenceMode.h>
+
+namespace c10 {
+namespace impl {
+
+namespace {
+
+/// thread_local is not supported in the CAFFE2_FB_LIMITED_MOBILE_CAPABILITY
+/// build setting (see c10/core/impl/LocalDispatchKeySet.cpp); inference
+/// mode degrades to a process-wide flag there.
+#ifndef CAFFE2_FB_LIMITED_MOBILE_CAPABILITY
+
+thread_local bool inference_mode_enabled = false;
+
+#else // defined(CAFFE2_FB_LIMITED_MOBILE_CAPABILITY)
+
+static bool inference_mode_enabled = false;
+
+#endif
+
+} // anonymous namespace
+
+bool tls_is_inference_mode_enabled() {
+  return inference_mode_enabled;
+}
+
+void tls_set_inference_mode_enabled(bool enabled) {
+  inference_mode_enabled = enabled;
+}
+
+} // namespace impl
+} // namespace c10
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+namespace c10 {
+namespace impl {
+
+// Whether the current thread is in inference mode. This is the low-level
+// thread-local flag backing at::InferenceMode (ATen/core/InferenceMode.h),
+// which is the only thing that should flip it; it lives in c10 so that
+// TensorImpl can consult it at tensor creation time. When set, newly
+// created tensors skip allocating a version counter (see VariableVersion
+// in c10/core/TensorImpl.h).
+C10_API bool tls_is_inference_mode_enabled();
+C10_API void tls_set_inference_mode_enabled(bool enabled);
+
+} // namespace impl
+} // namespace c10
@@ -15,11 +15,17 @@ enum class QEngine : uint8_t {
   NoQEngine = 0,
   FBGEMM = 1,
   QNNPACK = 2,
+  // Picks between FBGEMM and QNNPACK per (op, shape) based on measured
+  // timings; only available when both engines are. See
+  // Note [Auto quantized engine] in
+  // aten/src/ATen/native/quantized/cpu/auto_engine.cpp.
+  Auto = 3,
 };
 
 constexpr auto kNoQEngine = QEngine::NoQEngine;
 constexpr auto kFBGEMM = QEngine::FBGEMM;
 constexpr auto kQNNPACK = QEngine::QNNPACK;
+constexpr auto kAutoQEngine = QEngine::Auto;
 
 inline std::string toString(QEngine qengine) {
   switch (qengine) {
@@ -29,6 +35,8 @@ inline std::string toString(QEngine qengine) {
       return "FBGEMM";
     case kQNNPACK:
       return "QNNPACK";
+    case kAutoQEngine:
+      return "Auto";
     default:
       TORCH_CHECK(
           false,
@@ -284,13 +284,13 @@ static inline size_t elementSize(ScalarType t) {
 }
 
 C10_DEPRECATED_MESSAGE("isIntegralType is deprecated. Please use the overload with 'includeBool' parameter instead.")
-static inline bool isIntegralType(ScalarType t) {
+static inline constexpr bool isIntegralType(ScalarType t) {
   return (
       t == ScalarType::Byte || t == ScalarType::Char || t == ScalarType::Int ||
       t == ScalarType::Long || t == ScalarType::Short);
 }
 
-static inline bool isIntegralType(ScalarType t, bool includeBool) {
+static inline constexpr bool isIntegralType(ScalarType t, bool includeBool) {
   bool isIntegral = (
       t == ScalarType::Byte || t == ScalarType::Char || t == ScalarType::Int ||
       t == ScalarType::Long || t == ScalarType::Short);
@@ -298,19 +298,19 @@ static inline bool isIntegralType(ScalarType t, bool includeBool) {
   return includeBool ? isIntegral || (t == ScalarType::Bool) : isIntegral;
 }
 
-static inline bool isFloatingType(ScalarType t) {
+static inline constexpr bool isFloatingType(ScalarType t) {
   return (
       t == ScalarType::Double || t == ScalarType::Float ||
       t == ScalarType::Half || t == ScalarType::BFloat16);
 }
 
-static inline bool isComplexType(ScalarType t) {
+static inline constexpr bool isComplexType(ScalarType t) {
   return (
       t == ScalarType::ComplexHalf || t == ScalarType::ComplexFloat ||
       t == ScalarType::ComplexDouble);
 }
 
-static inline bool isQIntType(ScalarType t) {
+static inline constexpr bool isQIntType(ScalarType t) {
   // Don't forget to extend this when adding new QInt types
   return t == ScalarType:: QInt8 || t == ScalarType::QUInt8 || t == ScalarType::QInt32;
 }
@@ -373,27 +373,56 @@ static inline ScalarType toValueType(ScalarType t) {
   }
 }
 
-// see tensor_attributes.rst for detailed explanation and examples
-// of casting rules.
-static inline bool canCast(const ScalarType from, const ScalarType to) {
-  // We disallow float -> integral, e.g., int_tensor *= float is disallowed.
-  if (isFloatingType(from) && isIntegralType(to, false)) {
-    return false;
+namespace detail {
+
+// The casting rules only depend on the category (floating, integral, bool,
+// ...) of the two dtypes involved, so rather than re-deriving the categories
+// on every call we bake the full from/to answer matrix at compile time and
+// let canCast() below answer with a single indexed load. The rules themselves
+// live in canCastImpl(), which is only ever evaluated at compile time.
+struct CanCastMatrix {
+  constexpr CanCastMatrix() : matrix_() {
+    for (int from = 0; from < static_cast<int>(ScalarType::NumOptions); from++) {
+      for (int to = 0; to < static_cast<int>(ScalarType::NumOptions); to++) {
+        matrix_[from][to] = canCastImpl(
+            static_cast<ScalarType>(from), static_cast<ScalarType>(to));
+      }
+    }
   }
 
-  // Treat bool as a distinct "category," to be consistent with type promotion
-  // rules (e.g. `bool_tensor + 5 -> int64_tensor`). If `5` was in the same category
-  // as `bool_tensor`, we would not promote.
-  // Differing categories implies `bool_tensor += 5` is disallowed.
-  //
-  // NB: numpy distinguishes "unsigned" as a category to get the desired
-  // `bool_tensor + 5 -> int64_tensor` behavior. We don't, because:
-  // * We don't want the performance hit of checking the runtime sign of Scalars.
-  // * `uint8_tensor + 5 -> int64_tensor` would be undesirable.
-  if (from != ScalarType::Bool && to == ScalarType::Bool) {
-    return false;
+  bool matrix_[static_cast<int>(ScalarType::NumOptions)]
+              [static_cast<int>(ScalarType::NumOptions)];
+
+ private:
+  static constexpr bool canCastImpl(ScalarType from, ScalarType to) {
+    // We disallow float -> integral, e.g., int_tensor *= float is disallowed.
+    if (isFloatingType(from) && isIntegralType(to, false)) {
+      return false;
+    }
+
+    // Treat bool as a distinct "category," to be consistent with type promotion
+    // rules (e.g. `bool_tensor + 5 -> int64_tensor`). If `5` was in the same category
+    // as `bool_tensor`, we would not promote.
+    // Differing categories implies `bool_tensor += 5` is disallowed.
+    //
+    // NB: numpy distinguishes "unsigned" as a category to get the desired
+    // `bool_tensor + 5 -> int64_tensor` behavior. We don't, because:
+    // * We don't want the performance hit of checking the runtime sign of Scalars.
+    // * `uint8_tensor + 5 -> int64_tensor` would be undesirable.
+    if (from != ScalarType::Bool && to == ScalarType::Bool) {
+      return false;
+    }
+    return true;
   }
-  return true;
+};
+
+} // namespace detail
+
+// see tensor_attributes.rst for detailed explanation and examples
+// of casting rules.
+static inline bool canCast(const ScalarType from, const ScalarType to) {
+  static constexpr detail::CanCastMatrix can_cast_matrix{};
+  return can_cast_matrix.matrix_[static_cast<int>(from)][static_cast<int>(to)];
 }
 
 static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
@@ -412,9 +441,6 @@ static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
   constexpr auto b1 = ScalarType::Bool;
   constexpr auto bf = ScalarType::BFloat16;
   constexpr auto ud = ScalarType::Undefined;
-  if (a == ud || b == ud) {
-    return ScalarType::Undefined;
-  }
 
   // For QInt types, we only allow exact match
   if (isQIntType(a) && a == b) {
@@ -422,6 +448,11 @@ static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
   }
 
   if (isQIntType(a) || isQIntType(b)) {
+    // Undefined wins over the quantized-type error to keep the historical
+    // behavior of the early Undefined check this table lookup replaced.
+    if (a == ud || b == ud) {
+      return ScalarType::Undefined;
+    }
     AT_ERROR(
         "promoteTypes with quantized numbers is not handled yet; figure out what the correct rules should be, offending types: ",
         toString(a),
@@ -431,26 +462,29 @@ static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
 
   // this matrix has to be consistent with AT_FORALL_SCALAR_TYPES_WITH_COMPLEX
   // so that's why we have to add undefined as we are not sure what is the
-  // corrent values for the type promotions in complex type cases.
+  // corrent values for the type promotions in complex type cases. The matrix
+  // covers Undefined explicitly (anything promoted with Undefined is
+  // Undefined) so there is no separate branch for it on the lookup path.
   static constexpr ScalarType _promoteTypesLookup[static_cast<int>(
       ScalarType::NumOptions)][static_cast<int>(ScalarType::NumOptions)] = {
-        /*        u1  i1  i2  i4  i8  f2  f4  f8  c2  c4  c8  b1  q1  q2  q3  bf*/
-        /* u1 */ {u1, i2, i2, i4, i8, f2, f4, f8, ud, c4, c8, u1, ud, ud, ud, ud},
-        /* i1 */ {i2, i1, i2, i4, i8, f2, f4, f8, ud, c4, c8, i1, ud, ud, ud, ud},
-        /* i2 */ {i2, i2, i2, i4, i8, f2, f4, f8, ud, c4, c8, i2, ud, ud, ud, ud},
-        /* i4 */ {i4, i4, i4, i4, i8, f2, f4, f8, ud, c4, c8, i4, ud, ud, ud, ud},
-        /* i8 */ {i8, i8, i8, i8, i8, f2, f4, f8, ud, c4, c8, i8, ud, ud, ud, ud},
-        /* f2 */ {f2, f2, f2, f2, f2, f2, f4, f8, ud, c4, c8, f2, ud, ud, ud, ud},
-        /* f4 */ {f4, f4, f4, f4, f4, f4, f4, f8, ud, c4, c8, f4, ud, ud, ud, ud},
-        /* f8 */ {f8, f8, f8, f8, f8, f8, f8, f8, ud, c8, c8, f8, ud, ud, ud, ud},
-        /* c2 */ {ud, ud, ud, ud, ud, ud, ud, ud, c2, c4, c8, ud, ud, ud, ud, ud},
-        /* c4 */ {c4, c4, c4, c4, c4, c4, c4, c8, c4, c4, c8, ud, ud, ud, ud, ud},
-        /* c8 */ {c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, ud, ud, ud, ud, ud},
-        /* b1 */ {u1, i1, i2, i4, i8, f2, f4, f8, ud, ud, ud, b1, ud, ud, ud, ud},
-        /* q1 */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud},
-        /* q2 */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud},
-        /* q3 */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud},
-        /* bf */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, bf},
+        /*        u1  i1  i2  i4  i8  f2  f4  f8  c2  c4  c8  b1  q1  q2  q3  bf  ud*/
+        /* u1 */ {u1, i2, i2, i4, i8, f2, f4, f8, ud, c4, c8, u1, ud, ud, ud, ud, ud},
+        /* i1 */ {i2, i1, i2, i4, i8, f2, f4, f8, ud, c4, c8, i1, ud, ud, ud, ud, ud},
+        /* i2 */ {i2, i2, i2, i4, i8, f2, f4, f8, ud, c4, c8, i2, ud, ud, ud, ud, ud},
+        /* i4 */ {i4, i4, i4, i4, i8, f2, f4, f8, ud, c4, c8, i4, ud, ud, ud, ud, ud},
+        /* i8 */ {i8, i8, i8, i8, i8, f2, f4, f8, ud, c4, c8, i8, ud, ud, ud, ud, ud},
+        /* f2 */ {f2, f2, f2, f2, f2, f2, f4, f8, ud, c4, c8, f2, ud, ud, ud, ud, ud},
+        /* f4 */ {f4, f4, f4, f4, f4, f4, f4, f8, ud, c4, c8, f4, ud, ud, ud, ud, ud},
+        /* f8 */ {f8, f8, f8, f8, f8, f8, f8, f8, ud, c8, c8, f8, ud, ud, ud, ud, ud},
+        /* c2 */ {ud, ud, ud, ud, ud, ud, ud, ud, c2, c4, c8, ud, ud, ud, ud, ud, ud},
+        /* c4 */ {c4, c4, c4, c4, c4, c4, c4, c8, c4, c4, c8, ud, ud, ud, ud, ud, ud},
+        /* c8 */ {c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, c8, ud, ud, ud, ud, ud, ud},
+        /* b1 */ {u1, i1, i2, i4, i8, f2, f4, f8, ud, ud, ud, b1, ud, ud, ud, ud, ud},
+        /* q1 */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud},
+        /* q2 */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud},
+        /* q3 */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud},
+        /* bf */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, bf, ud},
+        /* ud */ {ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud, ud},
   };
   return _promoteTypesLookup[static_cast<int>(a)][static_cast<int>(b)];
 }
@@ -2,12 +2,15 @@
 
 #include <c10/core/Allocator.h>
 #include <c10/core/ScalarType.h>
+#include <c10/core/impl/ControlBlockPool.h>
 
 #include <c10/util/intrusive_ptr.h>
 
+#include <cstddef>
+
 namespace c10 {
 
-struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
+struct C10_API StorageImpl : public c10::intrusive_ptr_target {
  public:
   StorageImpl(
       caffe2::TypeMeta data_type,
@@ -33,6 +36,24 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
     }
   }
 
+  // Like TensorImpl, StorageImpls are churned through fast enough that the
+  // fixed-size control block is recycled via a per-thread freelist. The
+  // sized operator delete keeps differently-sized subclasses (e.g.
+  // InlineStorageImpl, which overrides these) on their own path.
+  static void* operator new(std::size_t size) {
+    if (size == sizeof(StorageImpl)) {
+      return impl::ControlBlockPool<sizeof(StorageImpl)>::allocate();
+    }
+    return ::operator new(size);
+  }
+  static void operator delete(void* ptr, std::size_t size) {
+    if (size == sizeof(StorageImpl)) {
+      impl::ControlBlockPool<sizeof(StorageImpl)>::deallocate(ptr);
+      return;
+    }
+    ::operator delete(ptr);
+  }
+
   StorageImpl(
       caffe2::TypeMeta data_type,
       int64_t numel,
@@ -231,4 +252,61 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
   bool received_cuda_;
   Allocator* allocator_;
 };
+
+// A StorageImpl whose data buffer lives inside the StorageImpl allocation
+// itself, for small CPU tensors. A scalar or few-element tensor normally pays
+// two dependent loads (TensorImpl -> StorageImpl -> heap data) plus a second
+// malloc; here the data sits right behind the refcount and storage metadata,
+// so the second hop stays within the same allocation (typically the same
+// cache line) and the data malloc disappears.
+//
+// The inline buffer is handed out through a non-owning DataPtr, so every
+// existing mechanism that swaps the data pointer -- THStorage_resize's
+// allocate-copy-swap, UniqueStorageShareExternalPointer, sharing to another
+// process -- naturally "copies out" to a heap buffer and leaves the inline
+// one unused. Storage sharing between tensors needs no special handling at
+// all, since this is an ordinary refcounted StorageImpl.
+struct C10_API InlineStorageImpl : public StorageImpl {
+  // Chosen to cover scalars and small vectors (up to 8 doubles / 16 floats)
+  // without bloating the allocation past two cache lines.
+  static constexpr size_t kMaxInlineBytes = 64;
+
+  InlineStorageImpl(
+      caffe2::TypeMeta data_type,
+      int64_t numel,
+      at::Allocator* allocator,
+      bool resizable)
+      : StorageImpl(
+            data_type,
+            numel,
+            at::DataPtr(buffer_, at::Device(at::DeviceType::CPU)),
+            allocator,
+            resizable) {
+    AT_ASSERTM(
+        data_type.itemsize() * numel <= kMaxInlineBytes,
+        "Tensor data too large for inline storage");
+  }
+
+  // Small tensors churn the hardest, so the inline control block (metadata
+  // plus data buffer) is freelisted at its own size.
+  static void* operator new(std::size_t size) {
+    if (size == sizeof(InlineStorageImpl)) {
+      return impl::ControlBlockPool<sizeof(InlineStorageImpl)>::allocate();
+    }
+    return ::operator new(size);
+  }
+  static void operator delete(void* ptr, std::size_t size) {
+    if (size == sizeof(InlineStorageImpl)) {
+      impl::ControlBlockPool<sizeof(InlineStorageImpl)>::deallocate(ptr);
+      return;
+    }
+    ::operator delete(ptr);
+  }
+
+ private:
+  // The CPU allocator over-aligns to 64 bytes, but kernels only require
+  // fundamental alignment for data reached through a storage offset, which
+  // is all this buffer needs to provide.
+  alignas(alignof(std::max_align_t)) char buffer_[kMaxInlineBytes];
+};
 } // namespace c10
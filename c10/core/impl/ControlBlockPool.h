@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace c10 {
+namespace impl {
+
+/**
+ * A per-thread freelist of fixed-size blocks, used to allocate tensor
+ * control blocks (TensorImpl, StorageImpl).
+ *
+ * Tensor-heavy workloads construct and destroy millions of control blocks
+ * per second across threads, and each one is a trip to the global allocator.
+ * These objects have a fixed size, so they can instead be carved out of
+ * slabs and recycled through a thread-local freelist: allocation and
+ * deallocation are then a couple of pointer moves with no locking in the
+ * steady state.
+ *
+ * Blocks may be freed on a different thread than they were allocated on;
+ * they simply join the freeing thread's freelist. To keep that safe, slabs
+ * are never returned to the global allocator -- once carved, their blocks
+ * circulate through the pools for the lifetime of the process, which is
+ * bounded by the peak number of live blocks (plus slab rounding). When a
+ * thread exits, its remaining free blocks are donated to a global orphan
+ * list that other threads refill from before carving new slabs.
+ *
+ * Each distinct `kBlockSize` instantiates an independent pool.
+ */
+template <size_t kBlockSize>
+class ControlBlockPool {
+ public:
+  /// Returns a block of `kBlockSize` bytes with fundamental alignment.
+  static void* allocate() {
+    ControlBlockPool& pool = local_pool();
+    if (pool.free_list_ == nullptr) {
+      pool.refill();
+    }
+    FreeNode* node = pool.free_list_;
+    pool.free_list_ = node->next;
+    return node;
+  }
+
+  /// Returns a block obtained from `allocate()` (on any thread) to the
+  /// calling thread's freelist.
+  static void deallocate(void* ptr) {
+    FreeNode* node = static_cast<FreeNode*>(ptr);
+    ControlBlockPool& pool = local_pool();
+    node->next = pool.free_list_;
+    pool.free_list_ = node;
+  }
+
+ private:
+  struct FreeNode {
+    FreeNode* next;
+  };
+
+  // How many blocks a thread carves per trip to the global allocator.
+  static constexpr size_t kBlocksPerSlab = 64;
+
+  // Blocks must hold a FreeNode while on the freelist and keep successive
+  // blocks within a slab aligned for any fundamentally-aligned type.
+  static constexpr size_t kAlignedBlockSize =
+      ((kBlockSize < sizeof(FreeNode) ? sizeof(FreeNode) : kBlockSize) +
+       alignof(std::max_align_t) - 1) /
+      alignof(std::max_align_t) * alignof(std::max_align_t);
+
+  ControlBlockPool() = default;
+
+  ~ControlBlockPool() {
+    // Thread exit: donate the freelist so other threads can reuse the
+    // blocks. The backing slabs stay alive (see class comment).
+    if (free_list_ == nullptr) {
+      return;
+    }
+    FreeNode* tail = free_list_;
+    while (tail->next != nullptr) {
+      tail = tail->next;
+    }
+    GlobalState& state = global();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    tail->next = state.orphans;
+    state.orphans = free_list_;
+  }
+
+  void refill() {
+    {
+      GlobalState& state = global();
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (state.orphans != nullptr) {
+        free_list_ = state.orphans;
+        state.orphans = nullptr;
+        return;
+      }
+    }
+    // Deliberately never freed; blocks from this slab circulate through the
+    // per-thread freelists for the lifetime of the process.
+    char* slab =
+        static_cast<char*>(::operator new(kAlignedBlockSize * kBlocksPerSlab));
+    for (size_t i = 0; i < kBlocksPerSlab; ++i) {
+      FreeNode* node = reinterpret_cast<FreeNode*>(slab + i * kAlignedBlockSize);
+      node->next = free_list_;
+      free_list_ = node;
+    }
+  }
+
+  struct GlobalState {
+    std::mutex mutex;
+    FreeNode* orphans = nullptr;
+  };
+
+  // Leaked so that thread-local pool destructors may donate during program
+  // shutdown regardless of static destruction order.
+  static GlobalState& global() {
+    static GlobalState* state = new GlobalState();
+    return *state;
+  }
+
+  static ControlBlockPool& local_pool() {
+    thread_local ControlBlockPool pool;
+    return pool;
+  }
+
+  FreeNode* free_list_ = nullptr;
+};
+
+} // namespace impl
+} // namespace c10
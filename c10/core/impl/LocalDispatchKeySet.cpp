@@ -7,23 +7,22 @@ namespace impl {
 
 C10_DEFINE_bool(disable_variable_dispatch, false, "This flag forcibly disables the Variable code paths from executing, which currently breaks profiling in the process.");
 
-namespace {
-
 /// In the CAFFE2_FB_LIMITED_MOBILE_CAPABILITY build setting,
-/// thread_local is not supported.
-#ifndef CAFFE2_FB_LIMITED_MOBILE_CAPABILITY
+/// thread_local is not supported.  On those builds (and on Windows, where
+/// thread_local variables cannot be exported) the TLS variable stays
+/// hidden here behind the out-of-line accessor; everywhere else it is
+/// exported so that tls_local_dispatch_key_set() can be inlined into the
+/// per-call dispatch key computation.
+#if defined(_MSC_VER) || defined(C10_ANDROID) || \
+    defined(CAFFE2_FB_LIMITED_MOBILE_CAPABILITY)
 
+#ifndef CAFFE2_FB_LIMITED_MOBILE_CAPABILITY
 // NB: POD, zero initialized!
-thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
-
+static thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
 #else // defined(CAFFE2_FB_LIMITED_MOBILE_CAPABILITY)
-
 static PODLocalDispatchKeySet raw_local_dispatch_key_set;
-
 #endif
 
-} // anonymous namespace
-
 LocalDispatchKeySet tls_local_dispatch_key_set() {
   // Hack until variable performance is fixed
   //
@@ -39,6 +38,13 @@ LocalDispatchKeySet tls_local_dispatch_key_set() {
   return raw_local_dispatch_key_set;
 }
 
+#else // defined(_MSC_VER) || defined(C10_ANDROID)
+
+// NB: POD, zero initialized!
+thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
+
+#endif // defined(_MSC_VER) || defined(C10_ANDROID)
+
 // An RAII guard could snapshot and restore the entire state (entire DispatchKeySet) as
 // opposed to only snapshotting and restoring the state of its assigned DispatchKey.
 // I'm not sure which is better.  If only the RAII API is used, the two choices are
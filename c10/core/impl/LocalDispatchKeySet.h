@@ -54,7 +54,31 @@ struct C10_API LocalDispatchKeySet {
   DispatchKeySet excluded_;
 };
 
+// thread_local variables cannot be C10_API on Windows.
+#if defined(_MSC_VER) || defined(C10_ANDROID) || \
+    defined(CAFFE2_FB_LIMITED_MOBILE_CAPABILITY)
 C10_API LocalDispatchKeySet tls_local_dispatch_key_set();
+#else // defined(_MSC_VER) || defined(C10_ANDROID)
+extern C10_API thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
+
+// The TLS words are flat aggregates that guard push/pop keeps up to date, so
+// reading the effective state is just a load of the two words; keeping this
+// inline avoids an out-of-line call on every single dispatch.
+inline C10_API LocalDispatchKeySet tls_local_dispatch_key_set() {
+  // Hack until variable performance is fixed
+  //
+  // ezyang: I'm pretty unhappy about this implementation, it looks wrong
+  // to me, as it seems to be performing a mutation on
+  // raw_local_dispatch_key_set.  I can't conveniently test the correct
+  // version though...
+  if (C10_UNLIKELY(FLAGS_disable_variable_dispatch)) {
+    raw_local_dispatch_key_set.set_excluded(
+      raw_local_dispatch_key_set.excluded().add(
+        DispatchKey::VariableTensorId));
+  }
+  return raw_local_dispatch_key_set;
+}
+#endif // defined(_MSC_VER) || defined(C10_ANDROID)
 
 // RAII API for manipulating the thread-local dispatch state.
 
@@ -0,0 +1,72 @@
+#include <c10/core/impl/SizesAndStrides.h>
+
+namespace c10 {
+namespace impl {
+
+void SizesAndStrides::resizeSlowPath(
+    const size_t newSize,
+    const size_t oldSize) {
+  if (newSize <= kMaxInlineDims) {
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        !isInline(),
+        "resizeSlowPath called when the fast path should have been hit!");
+    // Out-of-line to inline: copy both halves over before touching size_,
+    // since strides_data() depends on it. Copying kMaxInlineDims elements
+    // is safe because oldSize > kMaxInlineDims >= newSize here.
+    int64_t* tempStorage = outOfLineStorage_;
+    memcpy(
+        &inlineStorage_[0],
+        &tempStorage[0],
+        kMaxInlineDims * sizeof(inlineStorage_[0]));
+    memcpy(
+        &inlineStorage_[kMaxInlineDims],
+        &tempStorage[oldSize],
+        kMaxInlineDims * sizeof(inlineStorage_[0]));
+    size_ = newSize;
+    free(tempStorage);
+  } else {
+    if (isInline()) {
+      // Inline to out-of-line: build the new block before flipping state.
+      int64_t* tempStorage =
+          static_cast<int64_t*>(malloc(storageBytes(newSize)));
+      TORCH_CHECK(
+          tempStorage,
+          "Could not allocate memory for Tensor sizes and strides!");
+      const size_t bytesToCopy = oldSize * sizeof(inlineStorage_[0]);
+      const size_t bytesToZero =
+          (newSize - oldSize) * sizeof(tempStorage[0]);
+      memcpy(&tempStorage[0], &inlineStorage_[0], bytesToCopy);
+      memset(&tempStorage[oldSize], 0, bytesToZero);
+      memcpy(
+          &tempStorage[newSize],
+          &inlineStorage_[kMaxInlineDims],
+          bytesToCopy);
+      memset(&tempStorage[newSize + oldSize], 0, bytesToZero);
+      outOfLineStorage_ = tempStorage;
+    } else {
+      const bool isGrowing = oldSize < newSize;
+      if (isGrowing) {
+        // Realloc before shifting the strides so that they fit.
+        resizeOutOfLineStorage(newSize);
+      }
+      // Move the strides to their new starting point. The sizes do not
+      // move since they live at the front of the block.
+      memmove(
+          outOfLineStorage_ + newSize,
+          outOfLineStorage_ + oldSize,
+          std::min(oldSize, newSize) * sizeof(outOfLineStorage_[0]));
+      if (isGrowing) {
+        const size_t bytesToZero =
+            (newSize - oldSize) * sizeof(outOfLineStorage_[0]);
+        memset(&outOfLineStorage_[oldSize], 0, bytesToZero);
+        memset(&outOfLineStorage_[newSize + oldSize], 0, bytesToZero);
+      } else {
+        resizeOutOfLineStorage(newSize);
+      }
+    }
+    size_ = newSize;
+  }
+}
+
+} // namespace impl
+} // namespace c10
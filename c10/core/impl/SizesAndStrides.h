@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <c10/macros/Macros.h>
+#include <c10/util/ArrayRef.h>
+#include <c10/util/Exception.h>
+
+namespace c10 {
+namespace impl {
+
+/**
+ * Packed container for TensorImpl sizes and strides.
+ *
+ * Sizes and strides always have the same length, so storing them in two
+ * separate SmallVectors wastes a length/capacity header each and, worse,
+ * goes out of line as two separate heap allocations once the inline
+ * capacity is exceeded. This class keeps both arrays in one block: for
+ * tensors of up to kMaxInlineDims dimensions (which covers 5-D video
+ * tensors) everything is inline in the TensorImpl, and beyond that there
+ * is a single heap allocation holding the sizes followed by the strides.
+ *
+ * Invariant: the sizes and strides arrays always have size() elements
+ * each; like the SmallVectors it replaces, newly exposed elements after a
+ * growing resize() are zero-initialized.
+ */
+class C10_API SizesAndStrides {
+ public:
+  static constexpr size_t kMaxInlineDims = 5;
+
+  // A default-constructed state represents a zero-size one-dimensional
+  // tensor, matching what TensorImpl's constructor used to set up.
+  SizesAndStrides() : size_(1) {
+    size_at_unchecked(0) = 0;
+    stride_at_unchecked(0) = 1;
+  }
+
+  ~SizesAndStrides() {
+    if (C10_UNLIKELY(!isInline())) {
+      free(outOfLineStorage_);
+    }
+  }
+
+  SizesAndStrides(const SizesAndStrides& rhs) : size_(rhs.size_) {
+    if (C10_LIKELY(rhs.isInline())) {
+      copyDataInline(rhs);
+    } else {
+      allocateOutOfLineStorage(size_);
+      copyDataOutOfLine(rhs);
+    }
+  }
+
+  SizesAndStrides& operator=(const SizesAndStrides& rhs) {
+    if (this == &rhs) {
+      return *this;
+    }
+    if (C10_LIKELY(rhs.isInline())) {
+      if (C10_UNLIKELY(!isInline())) {
+        free(outOfLineStorage_);
+      }
+      copyDataInline(rhs);
+    } else {
+      if (isInline()) {
+        allocateOutOfLineStorage(rhs.size_);
+      } else {
+        resizeOutOfLineStorage(rhs.size_);
+      }
+      copyDataOutOfLine(rhs);
+    }
+    size_ = rhs.size_;
+    return *this;
+  }
+
+  // Moves take over the heap block (if any); the moved-from object is
+  // left with size() == 0.
+  SizesAndStrides(SizesAndStrides&& rhs) noexcept : size_(rhs.size_) {
+    if (C10_LIKELY(isInline())) {
+      memcpy(inlineStorage_, rhs.inlineStorage_, sizeof(inlineStorage_));
+    } else {
+      outOfLineStorage_ = rhs.outOfLineStorage_;
+      rhs.outOfLineStorage_ = nullptr;
+    }
+    rhs.size_ = 0;
+  }
+
+  SizesAndStrides& operator=(SizesAndStrides&& rhs) noexcept {
+    if (this == &rhs) {
+      return *this;
+    }
+    if (C10_LIKELY(rhs.isInline())) {
+      if (C10_UNLIKELY(!isInline())) {
+        free(outOfLineStorage_);
+      }
+      copyDataInline(rhs);
+    } else {
+      if (C10_UNLIKELY(!isInline())) {
+        free(outOfLineStorage_);
+      }
+      outOfLineStorage_ = rhs.outOfLineStorage_;
+      rhs.outOfLineStorage_ = nullptr;
+    }
+    size_ = rhs.size_;
+    rhs.size_ = 0;
+    return *this;
+  }
+
+  size_t size() const noexcept {
+    return size_;
+  }
+
+  const int64_t* sizes_data() const noexcept {
+    return isInline() ? &inlineStorage_[0] : &outOfLineStorage_[0];
+  }
+
+  int64_t* sizes_data() noexcept {
+    return isInline() ? &inlineStorage_[0] : &outOfLineStorage_[0];
+  }
+
+  const int64_t* strides_data() const noexcept {
+    return isInline() ? &inlineStorage_[kMaxInlineDims]
+                      : &outOfLineStorage_[size()];
+  }
+
+  int64_t* strides_data() noexcept {
+    return isInline() ? &inlineStorage_[kMaxInlineDims]
+                      : &outOfLineStorage_[size()];
+  }
+
+  IntArrayRef sizes_arrayref() const noexcept {
+    return IntArrayRef{sizes_data(), size()};
+  }
+
+  IntArrayRef strides_arrayref() const noexcept {
+    return IntArrayRef{strides_data(), size()};
+  }
+
+  int64_t size_at(size_t idx) const {
+    checkIndex(idx);
+    return sizes_data()[idx];
+  }
+
+  int64_t& size_at(size_t idx) {
+    checkIndex(idx);
+    return sizes_data()[idx];
+  }
+
+  int64_t size_at_unchecked(size_t idx) const noexcept {
+    return sizes_data()[idx];
+  }
+
+  int64_t& size_at_unchecked(size_t idx) noexcept {
+    return sizes_data()[idx];
+  }
+
+  int64_t stride_at(size_t idx) const {
+    checkIndex(idx);
+    return strides_data()[idx];
+  }
+
+  int64_t& stride_at(size_t idx) {
+    checkIndex(idx);
+    return strides_data()[idx];
+  }
+
+  int64_t stride_at_unchecked(size_t idx) const noexcept {
+    return strides_data()[idx];
+  }
+
+  int64_t& stride_at_unchecked(size_t idx) noexcept {
+    return strides_data()[idx];
+  }
+
+  // Resizes to newSizes.size() dimensions and copies the sizes over; the
+  // strides are left as-is where they existed before and zero elsewhere.
+  void set_sizes(IntArrayRef newSizes) {
+    resize(newSizes.size());
+    std::copy(newSizes.begin(), newSizes.end(), sizes_data());
+  }
+
+  void resize(const size_t newSize) {
+    const size_t oldSize = size();
+    if (newSize == oldSize) {
+      return;
+    }
+    if (C10_LIKELY(newSize <= kMaxInlineDims && isInline())) {
+      if (oldSize < newSize) {
+        const size_t bytesToZero =
+            (newSize - oldSize) * sizeof(inlineStorage_[0]);
+        memset(&inlineStorage_[oldSize], 0, bytesToZero);
+        memset(&inlineStorage_[kMaxInlineDims + oldSize], 0, bytesToZero);
+      }
+      size_ = newSize;
+    } else {
+      resizeSlowPath(newSize, oldSize);
+    }
+  }
+
+ private:
+  bool isInline() const noexcept {
+    return size_ <= kMaxInlineDims;
+  }
+
+  void checkIndex(size_t idx) const {
+    TORCH_CHECK(
+        idx < size(),
+        "dimension ",
+        idx,
+        " is out of range for a ",
+        size(),
+        "-dimensional tensor");
+  }
+
+  static size_t storageBytes(size_t size) noexcept {
+    return size * 2 * sizeof(int64_t);
+  }
+
+  void copyDataInline(const SizesAndStrides& rhs) noexcept {
+    memcpy(inlineStorage_, rhs.inlineStorage_, sizeof(inlineStorage_));
+  }
+
+  void allocateOutOfLineStorage(size_t size) {
+    outOfLineStorage_ = static_cast<int64_t*>(malloc(storageBytes(size)));
+    TORCH_CHECK(
+        outOfLineStorage_,
+        "Could not allocate memory for Tensor sizes and strides!");
+  }
+
+  void resizeOutOfLineStorage(size_t newSize) {
+    outOfLineStorage_ =
+        static_cast<int64_t*>(realloc(outOfLineStorage_, storageBytes(newSize)));
+    TORCH_CHECK(
+        outOfLineStorage_,
+        "Could not allocate memory for Tensor sizes and strides!");
+  }
+
+  void copyDataOutOfLine(const SizesAndStrides& rhs) noexcept {
+    memcpy(outOfLineStorage_, rhs.outOfLineStorage_, storageBytes(rhs.size_));
+  }
+
+  void resizeSlowPath(size_t newSize, size_t oldSize);
+
+  size_t size_;
+  union {
+    int64_t* outOfLineStorage_;
+    int64_t inlineStorage_[kMaxInlineDims * 2];
+  };
+};
+
+} // namespace impl
+} // namespace c10
@@ -8,8 +8,11 @@
 #include <cuda_runtime_api.h>
 #include <algorithm>
 #include <bitset>
+#include <cstdlib>
+#include <cstring>
 #include <deque>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -64,6 +67,59 @@ constexpr size_t kLargeBuffer = 20971520;   // "large" allocations may be packed
 constexpr size_t kMinLargeAlloc = 10485760; // allocations between 1 and 10 MiB may use kLargeBuffer
 constexpr size_t kRoundLarge = 2097152;     // round up large allocs to 2 MiB
 
+// Note [Large-block split threshold]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Under variable-size workloads, large cached segments tend to get nibbled
+// into small allocations whose neighbors stay pinned by live tensors; the
+// free space in such segments can neither be merged nor returned to the
+// driver, and over time a sizable fraction of memory becomes unusable.
+// Allocated blocks cannot be migrated to compact this space - their raw
+// device pointers are held by tensors (and this CUDA generation has no way
+// to remap them) - so the mitigation is preventive: when
+// PYTORCH_CUDA_MAX_SPLIT_MB is set, free blocks at least that large are
+// never split and are reserved for requests of at least that size (with up
+// to kLargeBuffer of slack), so the largest segments survive intact and
+// remain releasable by compactCache()/emptyCache() between batches.
+size_t max_split_size() {
+  static size_t size = []() {
+    const char* env = getenv("PYTORCH_CUDA_MAX_SPLIT_MB");
+    if (env == nullptr) {
+      return std::numeric_limits<size_t>::max();
+    }
+    long mb = strtol(env, nullptr, 10);
+    if (mb <= 0) {
+      return std::numeric_limits<size_t>::max();
+    }
+    return static_cast<size_t>(mb) * 1048576;
+  }();
+  return size;
+}
+
+// Note [Cross-stream block recycling]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Cached blocks are tagged with the stream they were allocated on, and
+// find_free_block only matches that stream; reuse within a stream then
+// needs no synchronization because frees and reallocations are ordered by
+// the stream itself. With many streams this segregation effectively
+// multiplies the cache footprint by the stream count. When
+// PYTORCH_CUDA_CROSS_STREAM_CACHE=1, a stream that misses in the cache may
+// instead adopt an idle segment owned by another stream, provided
+//  - the segment is unsplit: retagging half of a split segment would later
+//    let try_merge combine blocks whose memory is still ordered with
+//    respect to different streams, and
+//  - the owning stream has drained (cudaStreamQuery succeeds), which
+//    guarantees every kernel that touched the segment has completed.
+// Adoption retags the whole segment, so subsequent splits and merges stay
+// within the new stream. This trades a stream query on the miss path for
+// not calling cudaMalloc, which also serializes the device.
+bool cross_stream_cache_enabled() {
+  static bool enabled = []() {
+    const char* env = getenv("PYTORCH_CUDA_CROSS_STREAM_CACHE");
+    return env != nullptr && strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
 typedef std::bitset<static_cast<size_t>(StatType::NUM_TYPES)> StatTypes;
 
 void update_stat(Stat& stat, int64_t amount) {
@@ -112,15 +168,19 @@ struct Block {
   Block*        prev;        // prev block if split from a larger allocation
   Block*        next;        // next block if split from a larger allocation
   int           event_count; // number of outstanding CUDA events
+  uint64_t      capture_id;  // owning graph capture, 0 if none. See Note
+                             // [Capture-stable allocations]
 
   Block(int device, cudaStream_t stream, size_t size, BlockPool* pool, void* ptr) :
     device(device), stream(stream), stream_uses(), size(size), pool(pool),
-    ptr(ptr), allocated(0), prev(nullptr), next(nullptr), event_count(0) { }
+    ptr(ptr), allocated(0), prev(nullptr), next(nullptr), event_count(0),
+    capture_id(0) { }
 
   // constructor for search key
   Block(int device, cudaStream_t stream, size_t size) :
     device(device), stream(stream), stream_uses(), size(size), pool(nullptr),
-    ptr(nullptr), allocated(0), prev(nullptr), next(nullptr), event_count(0) { }
+    ptr(nullptr), allocated(0), prev(nullptr), next(nullptr), event_count(0),
+    capture_id(0) { }
 
   bool is_split() const {
     return (prev != nullptr) || (next != nullptr);
@@ -187,6 +247,22 @@ class THCCachingAllocator {
   // outstanding cuda events
   std::deque<std::pair<cudaEvent_t, Block*>> cuda_events;
 
+  // Note [Capture-stable allocations]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // A captured CUDA graph bakes raw device pointers into its kernel
+  // nodes, and replaying it re-executes against those addresses without
+  // going through the allocator. Every block allocated while a capture is
+  // active (intermediates as well as outputs) must therefore keep its
+  // address for the lifetime of the graph: between beginCapturePinning()
+  // and endCapturePinning() new blocks are tagged with the capture id,
+  // and a tagged block that is freed is parked on the capture's pinned
+  // list instead of re-entering the cache (it also refuses to merge with
+  // free neighbors). releaseCapturePinned() returns the parked blocks to
+  // the cache once the instantiated graph has been destroyed.
+  uint64_t next_capture_id = 1;
+  uint64_t active_capture = 0;
+  std::unordered_map<uint64_t, std::vector<Block*>> capture_pinned;
+
  public:
 
   THCCachingAllocator() :
@@ -226,9 +302,47 @@ class THCCachingAllocator {
       if (it != pool.end() && (*it)->device == device &&
           (*it)->stream == stream) {
         Block* block = *it;
+        // Blocks at or above the split threshold are reserved for requests
+        // of comparable size; see Note [Large-block split threshold].
+        if (block->size >= max_split_size() && size < max_split_size() &&
+            block->size - size >= kLargeBuffer) {
+          return nullptr;
+        }
         pool.erase(it);
         return block;
       }
+      // See Note [Cross-stream block recycling].
+      if (cross_stream_cache_enabled()) {
+        Block device_begin(device, nullptr, 0);
+        Block device_end(device + 1, nullptr, 0);
+        auto best = pool.end();
+        for (auto it2 = pool.lower_bound(&device_begin);
+             it2 != pool.lower_bound(&device_end);
+             ++it2) {
+          Block* candidate = *it2;
+          if (candidate->size < size || candidate->prev || candidate->next) {
+            continue;
+          }
+          if (candidate->size >= max_split_size() &&
+              size < max_split_size() &&
+              candidate->size - size >= kLargeBuffer) {
+            continue;
+          }
+          if (best == pool.end() || candidate->size < (*best)->size) {
+            best = it2;
+          }
+        }
+        if (best != pool.end()) {
+          Block* block = *best;
+          cudaError_t err = cudaStreamQuery(block->stream);
+          if (err == cudaSuccess) {
+            pool.erase(best);
+            block->stream = stream;
+            return block;
+          }
+          cudaGetLastError(); // the owning stream is still busy
+        }
+      }
       return nullptr;
     };
 
@@ -327,6 +441,7 @@ class THCCachingAllocator {
     }
 
     block->allocated = true;
+    block->capture_id = active_capture;
     allocated_blocks[block->ptr] = block;
 
     *devPtr = block->ptr;
@@ -424,6 +539,51 @@ class THCCachingAllocator {
     free_blocks(small_blocks, small_blocks.begin(), small_blocks.end());
   }
 
+  /** releases cached large-pool segments, keeping the small-block cache.
+   *  Meant as a cheap compaction point between batches: outstanding
+   *  stream-ordered frees are drained first so fully idle segments have
+   *  coalesced, then the driver gets the large segments back and can hand
+   *  out contiguous memory again. See Note [Large-block split threshold]. **/
+  void compactCache() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    synchronize_and_free_events(nullopt);
+    free_blocks(large_blocks, large_blocks.begin(), large_blocks.end());
+  }
+
+  /** tags subsequent allocations with a capture id so their addresses
+   *  survive until the captured graph is destroyed.
+   *  See Note [Capture-stable allocations] **/
+  uint64_t beginCapturePinning() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    TORCH_CHECK(
+        active_capture == 0,
+        "a CUDA graph capture is already collecting allocations");
+    active_capture = next_capture_id++;
+    capture_pinned.emplace(active_capture, std::vector<Block*>());
+    return active_capture;
+  }
+
+  /** stops tagging new allocations; already-tagged blocks stay pinned **/
+  void endCapturePinning() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    active_capture = 0;
+  }
+
+  /** returns the blocks parked for a destroyed graph to the cache **/
+  void releaseCapturePinned(uint64_t id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = capture_pinned.find(id);
+    if (it == capture_pinned.end()) {
+      return;
+    }
+    std::vector<Block*> blocks = std::move(it->second);
+    capture_pinned.erase(it);
+    for (Block* block : blocks) {
+      block->capture_id = 0;
+      free_block(block);
+    }
+  }
+
   /** Retrieves info (total size + largest block) of the memory cache **/
   void cacheInfo(int dev_id, size_t* total, size_t* largest) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -549,6 +709,17 @@ class THCCachingAllocator {
   {
     AT_ASSERT(!block->allocated && block->event_count == 0);
 
+    if (block->capture_id != 0) {
+      auto it = capture_pinned.find(block->capture_id);
+      if (it != capture_pinned.end()) {
+        // The block's address is baked into a captured graph; park it until
+        // the graph is destroyed. See Note [Capture-stable allocations].
+        it->second.push_back(block);
+        return;
+      }
+      block->capture_id = 0;
+    }
+
     size_t original_block_size = block->size;
 
     auto& pool = *block->pool;
@@ -584,7 +755,8 @@ class THCCachingAllocator {
   /** combine previously split blocks. returns the size of the subsumed block, or 0 on failure. */
   size_t try_merge_blocks(Block* dst, Block* src, BlockPool& pool)
   {
-    if (!src || src->allocated || src->event_count > 0) {
+    if (!src || src->allocated || src->event_count > 0 ||
+        src->capture_id != 0) {
       return 0;
     }
 
@@ -634,7 +806,8 @@ class THCCachingAllocator {
     if (block->pool == &small_blocks) {
       return remaining >= kMinBlockSize;
     } else if (block->pool == &large_blocks) {
-      return remaining > kSmallSize;
+      // See Note [Large-block split threshold].
+      return remaining > kSmallSize && block->size < max_split_size();
     } else {
       AT_ERROR("should_split: invalid pool");
     }
@@ -855,6 +1028,22 @@ void emptyCache(void) {
   caching_allocator.emptyCache();
 }
 
+void compactCache(void) {
+  caching_allocator.compactCache();
+}
+
+uint64_t beginCapturePinning(void) {
+  return caching_allocator.beginCapturePinning();
+}
+
+void endCapturePinning(void) {
+  caching_allocator.endCapturePinning();
+}
+
+void releaseCapturePinned(uint64_t id) {
+  caching_allocator.releaseCapturePinned(id);
+}
+
 void cacheInfo(int dev_id, size_t* cachedAndFree, size_t* largestBlock) {
   caching_allocator.cacheInfo(dev_id, cachedAndFree, largestBlock);
 }
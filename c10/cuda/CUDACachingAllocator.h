@@ -7,6 +7,7 @@
 #include <c10/util/Registry.h>
 
 #include <array>
+#include <cstdint>
 #include <mutex>
 
 namespace c10 {
@@ -111,6 +112,13 @@ C10_CUDA_API void raw_delete(void* ptr);
 
 C10_CUDA_API Allocator* get();
 C10_CUDA_API void emptyCache();
+C10_CUDA_API void compactCache();
+// Pins allocations made during a CUDA graph capture so the addresses baked
+// into the graph stay valid across replays; see Note [Capture-stable
+// allocations] in CUDACachingAllocator.cpp.
+C10_CUDA_API uint64_t beginCapturePinning();
+C10_CUDA_API void endCapturePinning();
+C10_CUDA_API void releaseCapturePinned(uint64_t id);
 C10_CUDA_API void cacheInfo(int dev_id, size_t* cachedAndFree, size_t* largestBlock);
 C10_CUDA_API void* getBaseAllocation(void *ptr, size_t *size);
 C10_CUDA_API void recordStream(const DataPtr&, CUDAStream stream);
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/CPUCachingAllocator.h>
+
+TEST(CPUCachingAllocatorTest, ReusesFreedBlocks) {
+  c10::CPUCachingAllocator caching_allocator;
+  void* first = nullptr;
+  {
+    c10::WithCPUCachingAllocatorGuard guard(&caching_allocator);
+    auto ptr = c10::GetDefaultCPUAllocator()->allocate(2048);
+    first = ptr.get();
+    // ptr is destroyed with the guard still active, so the block is cached
+  }
+  {
+    c10::WithCPUCachingAllocatorGuard guard(&caching_allocator);
+    auto ptr = c10::GetDefaultCPUAllocator()->allocate(2048);
+    EXPECT_EQ(first, ptr.get());
+  }
+}
+
+TEST(CPUCachingAllocatorTest, DifferentSizesDoNotAlias) {
+  c10::CPUCachingAllocator caching_allocator;
+  c10::WithCPUCachingAllocatorGuard guard(&caching_allocator);
+  auto small = c10::GetDefaultCPUAllocator()->allocate(512);
+  auto large = c10::GetDefaultCPUAllocator()->allocate(4096);
+  EXPECT_NE(small.get(), large.get());
+}
+
+TEST(CPUCachingAllocatorTest, FreeOutsideGuardReleasesToSystem) {
+  c10::CPUCachingAllocator caching_allocator;
+  c10::DataPtr ptr;
+  {
+    c10::WithCPUCachingAllocatorGuard guard(&caching_allocator);
+    ptr = c10::GetDefaultCPUAllocator()->allocate(1024);
+  }
+  // With no guard installed the block goes back to the system; this must
+  // not double free when the allocator itself is later destroyed.
+  ptr.clear();
+}
+
+TEST(CPUCachingAllocatorTest, NearbySizesShareASizeClass) {
+  c10::CPUCachingAllocator caching_allocator;
+  c10::WithCPUCachingAllocatorGuard guard(&caching_allocator);
+  void* first = nullptr;
+  {
+    auto ptr = c10::GetDefaultCPUAllocator()->allocate(10000);
+    first = ptr.get();
+  }
+  // 10000 and 10100 both round up to the same size class, so the cached
+  // block is reused even though the request sizes differ.
+  ASSERT_EQ(
+      c10::CPUCachingAllocator::round_to_size_class(10000),
+      c10::CPUCachingAllocator::round_to_size_class(10100));
+  auto ptr = c10::GetDefaultCPUAllocator()->allocate(10100);
+  EXPECT_EQ(first, ptr.get());
+}
+
+TEST(CPUCachingAllocatorTest, RoundingSlackIsBounded) {
+  for (size_t bytes : {1, 63, 64, 65, 1000, 4097, 123456, 10000000}) {
+    const size_t rounded = c10::CPUCachingAllocator::round_to_size_class(bytes);
+    EXPECT_GE(rounded, bytes);
+    EXPECT_EQ(rounded % 64, 0);
+    // Rounding slack is at most an eighth of the request (plus the minimum
+    // 64-byte granule for small sizes).
+    EXPECT_LE(rounded, bytes + bytes / 8 + 64);
+  }
+}
+
+TEST(CPUCachingAllocatorTest, TrimReleasesCacheAndStatsTrack) {
+  c10::CPUCachingAllocator caching_allocator;
+  c10::WithCPUCachingAllocatorGuard guard(&caching_allocator);
+  { auto ptr = c10::GetDefaultCPUAllocator()->allocate(2048); }
+  auto stats = caching_allocator.stats();
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_EQ(stats.cached_bytes, 2048);
+
+  { auto ptr = c10::GetDefaultCPUAllocator()->allocate(2048); }
+  stats = caching_allocator.stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.cached_bytes, 2048);
+  EXPECT_EQ(stats.max_cached_bytes, 2048);
+
+  caching_allocator.trim();
+  stats = caching_allocator.stats();
+  EXPECT_EQ(stats.cached_bytes, 0);
+  EXPECT_EQ(stats.max_cached_bytes, 2048);
+  // After a trim the next allocation misses again.
+  { auto ptr = c10::GetDefaultCPUAllocator()->allocate(2048); }
+  EXPECT_EQ(caching_allocator.stats().misses, 2);
+}
+
+TEST(CPUCachingAllocatorTest, ProcessWideSwitchEnablesImplicitAllocator) {
+  EXPECT_EQ(c10::GetThreadLocalCachingAllocator(), nullptr);
+  c10::SetCPUCachingAllocatorEnabled(true);
+  auto* implicit_allocator = c10::GetThreadLocalCachingAllocator();
+  ASSERT_NE(implicit_allocator, nullptr);
+  void* first = nullptr;
+  {
+    auto ptr = c10::GetDefaultCPUAllocator()->allocate(4096);
+    first = ptr.get();
+  }
+  {
+    auto ptr = c10::GetDefaultCPUAllocator()->allocate(4096);
+    EXPECT_EQ(first, ptr.get());
+  }
+  // An explicit guard still takes precedence over the implicit allocator.
+  c10::CPUCachingAllocator scoped_allocator;
+  {
+    c10::WithCPUCachingAllocatorGuard guard(&scoped_allocator);
+    EXPECT_EQ(c10::GetThreadLocalCachingAllocator(), &scoped_allocator);
+  }
+  c10::SetCPUCachingAllocatorEnabled(false);
+  EXPECT_EQ(c10::GetThreadLocalCachingAllocator(), nullptr);
+  implicit_allocator->trim();
+}
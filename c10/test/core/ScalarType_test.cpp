@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/ScalarType.h>
+
+using c10::ScalarType;
+
+// Reference implementations of the casting/promotion category rules; the
+// shipped versions answer out of compile-time tables, so check the tables
+// against the rules for every dtype pair.
+
+static bool refCanCast(ScalarType from, ScalarType to) {
+  if (c10::isFloatingType(from) && c10::isIntegralType(to, false)) {
+    return false;
+  }
+  if (from != ScalarType::Bool && to == ScalarType::Bool) {
+    return false;
+  }
+  return true;
+}
+
+TEST(ScalarTypeTest, CanCastMatchesCategoryRules) {
+  for (int from = 0; from < static_cast<int>(ScalarType::NumOptions); from++) {
+    for (int to = 0; to < static_cast<int>(ScalarType::NumOptions); to++) {
+      const auto from_t = static_cast<ScalarType>(from);
+      const auto to_t = static_cast<ScalarType>(to);
+      EXPECT_EQ(c10::canCast(from_t, to_t), refCanCast(from_t, to_t))
+          << "from: " << from_t << " to: " << to_t;
+    }
+  }
+}
+
+TEST(ScalarTypeTest, PromoteTypesWithUndefined) {
+  for (int other = 0; other < static_cast<int>(ScalarType::NumOptions);
+       other++) {
+    const auto other_t = static_cast<ScalarType>(other);
+    if (c10::isQIntType(other_t)) {
+      continue;
+    }
+    EXPECT_EQ(
+        c10::promoteTypes(ScalarType::Undefined, other_t),
+        ScalarType::Undefined);
+    EXPECT_EQ(
+        c10::promoteTypes(other_t, ScalarType::Undefined),
+        ScalarType::Undefined);
+  }
+}
+
+TEST(ScalarTypeTest, PromoteTypesIsCommutative) {
+  for (int a = 0; a < static_cast<int>(ScalarType::NumOptions); a++) {
+    for (int b = 0; b < static_cast<int>(ScalarType::NumOptions); b++) {
+      const auto a_t = static_cast<ScalarType>(a);
+      const auto b_t = static_cast<ScalarType>(b);
+      if (c10::isQIntType(a_t) || c10::isQIntType(b_t)) {
+        continue;
+      }
+      EXPECT_EQ(c10::promoteTypes(a_t, b_t), c10::promoteTypes(b_t, a_t))
+          << "a: " << a_t << " b: " << b_t;
+    }
+  }
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/impl/ControlBlockPool.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+using c10::impl::ControlBlockPool;
+
+TEST(ControlBlockPoolTest, RecyclesFreedBlocks) {
+  using Pool = ControlBlockPool<48>;
+  void* first = Pool::allocate();
+  Pool::deallocate(first);
+  // The freelist is LIFO, so the block comes straight back.
+  void* second = Pool::allocate();
+  EXPECT_EQ(first, second);
+  Pool::deallocate(second);
+}
+
+TEST(ControlBlockPoolTest, LiveBlocksAreDistinct) {
+  using Pool = ControlBlockPool<40>;
+  std::set<void*> blocks;
+  for (size_t i = 0; i < 1000; ++i) {
+    blocks.insert(Pool::allocate());
+  }
+  EXPECT_EQ(blocks.size(), 1000);
+  for (void* block : blocks) {
+    Pool::deallocate(block);
+  }
+}
+
+TEST(ControlBlockPoolTest, BlocksMayBeFreedOnAnotherThread) {
+  using Pool = ControlBlockPool<56>;
+  void* block = nullptr;
+  std::thread producer([&block] { block = Pool::allocate(); });
+  producer.join();
+  ASSERT_NE(block, nullptr);
+  // Freeing on this thread adds the block to this thread's freelist.
+  Pool::deallocate(block);
+  EXPECT_EQ(Pool::allocate(), block);
+  Pool::deallocate(block);
+}
+
+TEST(ControlBlockPoolTest, ExitingThreadDonatesItsFreelist) {
+  using Pool = ControlBlockPool<64>;
+  void* seen = nullptr;
+  std::thread worker([&seen] {
+    void* block = Pool::allocate();
+    seen = block;
+    Pool::deallocate(block);
+  });
+  worker.join();
+  // The worker's freelist was donated on exit; repeated allocation from this
+  // thread must eventually reuse the worker's block rather than leak it.
+  std::vector<void*> blocks;
+  bool reused = false;
+  for (size_t i = 0; i < 10000 && !reused; ++i) {
+    blocks.push_back(Pool::allocate());
+    reused = blocks.back() == seen;
+  }
+  EXPECT_TRUE(reused);
+  for (void* block : blocks) {
+    Pool::deallocate(block);
+  }
+}
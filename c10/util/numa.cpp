@@ -129,4 +129,17 @@ int GetCurrentNUMANode() {
 
 #endif // C10_NUMA_ENABLED
 
+namespace {
+// Thread-local allocation placement override; -1 follows the current node.
+thread_local int preferred_numa_node = -1;
+} // namespace
+
+int GetPreferredNUMANode() {
+  return preferred_numa_node;
+}
+
+void SetPreferredNUMANode(int numa_node_id) {
+  preferred_numa_node = numa_node_id;
+}
+
 } // namespace c10
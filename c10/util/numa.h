@@ -37,4 +37,16 @@ C10_API void NUMAMove(void* ptr, size_t size, int numa_node_id);
  */
 C10_API int GetCurrentNUMANode();
 
+/**
+ * Get the preferred NUMA node for CPU allocations made by this thread;
+ * -1 (the default) means allocations follow the thread's current node.
+ */
+C10_API int GetPreferredNUMANode();
+
+/**
+ * Set the preferred NUMA node for CPU allocations made by this thread.
+ * Pass -1 to fall back to the thread's current node.
+ */
+C10_API void SetPreferredNUMANode(int numa_node_id);
+
 } // namespace c10
@@ -2,9 +2,19 @@
 #include <c10/util/Exception.h>
 #include "caffe2/core/common.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
 namespace caffe2 {
 namespace serialize {
 
+#ifdef _WIN32
+
 FileAdapter::FileAdapter(const std::string& file_name) {
   file_stream_.open(file_name, std::ifstream::in | std::ifstream::binary);
   if (!file_stream_) {
@@ -24,5 +34,56 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
 
 FileAdapter::~FileAdapter() {}
 
+#else // _WIN32
+
+FileAdapter::FileAdapter(const std::string& file_name) {
+  fd_ = open(file_name.c_str(), O_RDONLY);
+  if (fd_ == -1) {
+    AT_ERROR("open file failed, file path: ", file_name);
+  }
+  struct stat file_stat;
+  if (fstat(fd_, &file_stat) == -1) {
+    close(fd_);
+    fd_ = -1;
+    AT_ERROR("stat file failed, file path: ", file_name);
+  }
+  size_ = file_stat.st_size;
+}
+
+size_t FileAdapter::size() const {
+  return size_;
+}
+
+size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
+    const {
+  size_t total_read = 0;
+  while (total_read < n) {
+    ssize_t ret = pread(
+        fd_,
+        static_cast<char*>(buf) + total_read,
+        n - total_read,
+        pos + total_read);
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      AT_ERROR(
+          "file reader failed: ",
+          what,
+          ret == 0 ? ": unexpected end of file." : ": read error.");
+    }
+    total_read += ret;
+  }
+  return total_read;
+}
+
+FileAdapter::~FileAdapter() {
+  if (fd_ != -1) {
+    close(fd_);
+  }
+}
+
+#endif // _WIN32
+
 } // namespace serialize
 } // namespace caffe2
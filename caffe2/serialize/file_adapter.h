@@ -15,13 +15,21 @@ class CAFFE2_API FileAdapter final : public ReadAdapterInterface {
   C10_DISABLE_COPY_AND_ASSIGN(FileAdapter);
   explicit FileAdapter(const std::string& file_name);
   size_t size() const override;
+  // On POSIX this uses positional reads (pread), so concurrent callers do
+  // not share any file-position state and read() is thread-safe without
+  // locking. On Windows we fall back to a lock-protected istream.
   size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const override;
   ~FileAdapter();
 
  private:
+#ifdef _WIN32
   std::ifstream file_stream_;
   std::unique_ptr<IStreamAdapter> istream_adapter_;
+#else
+  int fd_ = -1;
+  size_t size_ = 0;
+#endif
 };
 
 } // namespace serialize
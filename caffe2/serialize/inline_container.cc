@@ -17,6 +17,12 @@
 
 #include "miniz.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace caffe2 {
 namespace serialize {
 
@@ -50,9 +56,13 @@ size_t PyTorchStreamReader::read(uint64_t pos, char* buf, size_t n) {
   return in_->read(pos, buf, n, "reading file");
 }
 
-PyTorchStreamReader::PyTorchStreamReader(const std::string& file_name)
+PyTorchStreamReader::PyTorchStreamReader(
+    const std::string& file_name,
+    bool use_mmap)
     : ar_(std::make_unique<mz_zip_archive>()),
-      in_(std::make_unique<FileAdapter>(file_name)) {
+      in_(std::make_unique<FileAdapter>(file_name)),
+      file_name_(file_name),
+      use_mmap_(use_mmap) {
   init();
 }
 
@@ -179,7 +189,55 @@ static size_t getPadding(
   return padding_size_plus_fbxx;
 }
 
-bool PyTorchStreamReader::hasRecord(const std::string& name) {
+// Note [Incremental checkpoint records]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Iterative checkpoints of the same model are largely identical, yet each
+// archive used to carry a full copy of every tensor. A writer given a
+// base archive via setIncrementalBase() compares every record it is asked
+// to write against the base: when the name, size and crc32 all match (the
+// crc comes from the zip central directory, so the base payload is never
+// re-read), it emits a small "<name>.ref" record in place of the payload.
+// The ref stores the path of the archive that physically holds the bytes
+// together with the expected size and crc; when the base record is itself
+// a ref, its origin path is copied forward so chains of deltas stay one
+// hop deep no matter how many checkpoints are stacked.
+//
+// The reader resolves "<name>.ref" transparently in getRecord/hasRecord,
+// opening origin archives on demand and caching them. A delta archive is
+// therefore only usable together with its origin files, and only
+// file-backed archives can serve as a base. Records smaller than
+// kMinRecordSizeToDedup are always written in full.
+
+constexpr const char* kIncrementalRefSuffix = ".ref";
+
+static std::string formatIncrementalRef(
+    const std::string& source_file,
+    uint64_t size,
+    uint32_t crc32) {
+  return source_file + "\n" + c10::to_string(size) + "\n" +
+      c10::to_string(crc32) + "\n";
+}
+
+static bool parseIncrementalRef(
+    const std::string& payload,
+    std::string* source_file,
+    uint64_t* size,
+    uint32_t* crc32) {
+  auto first = payload.find('\n');
+  if (first == std::string::npos) {
+    return false;
+  }
+  auto second = payload.find('\n', first + 1);
+  if (second == std::string::npos) {
+    return false;
+  }
+  *source_file = payload.substr(0, first);
+  *size = caffe2::stoull(payload.substr(first + 1, second - first - 1));
+  *crc32 = static_cast<uint32_t>(caffe2::stoull(payload.substr(second + 1)));
+  return true;
+}
+
+bool PyTorchStreamReader::hasRecordUnlocked(const std::string& name) {
   std::string ss = archive_name_plus_slash_ + name;
   mz_zip_reader_locate_file(ar_.get(), ss.c_str(), nullptr, 0);
   bool result = ar_->m_last_error != MZ_ZIP_FILE_NOT_FOUND;
@@ -190,7 +248,72 @@ bool PyTorchStreamReader::hasRecord(const std::string& name) {
   return result;
 }
 
+bool PyTorchStreamReader::hasRecord(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  if (hasRecordUnlocked(name)) {
+    return true;
+  }
+  // See Note [Incremental checkpoint records]
+  return hasRecordUnlocked(name + kIncrementalRefSuffix);
+}
+
+bool PyTorchStreamReader::readIncrementalRefUnlocked(
+    const std::string& name,
+    std::string* payload) {
+  std::string ref_name = name + kIncrementalRefSuffix;
+  if (!hasRecordUnlocked(ref_name)) {
+    return false;
+  }
+  size_t key = getRecordID(ref_name);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), key, &stat);
+  valid("retrieving file meta-data for ", ref_name.c_str());
+  payload->resize(stat.m_uncomp_size);
+  mz_zip_reader_extract_to_mem(
+      ar_.get(), key, &(*payload)[0], stat.m_uncomp_size, 0);
+  valid("reading file ", ref_name.c_str());
+  return true;
+}
+
+std::shared_ptr<PyTorchStreamReader> PyTorchStreamReader::baseReader(
+    const std::string& path) {
+  std::lock_guard<std::mutex> guard(base_readers_lock_);
+  auto it = base_readers_.find(path);
+  if (it == base_readers_.end()) {
+    it = base_readers_
+             .emplace(path, std::make_shared<PyTorchStreamReader>(path, use_mmap_))
+             .first;
+  }
+  return it->second;
+}
+
+bool PyTorchStreamReader::getRecordSourceInfo(
+    const std::string& name,
+    std::string* source_file,
+    uint64_t* size,
+    uint32_t* crc32) {
+  std::string ref_payload;
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    if (hasRecordUnlocked(name)) {
+      size_t key = getRecordID(name);
+      mz_zip_archive_file_stat stat;
+      mz_zip_reader_file_stat(ar_.get(), key, &stat);
+      valid("retrieving file meta-data for ", name.c_str());
+      *source_file = file_name_;
+      *size = stat.m_uncomp_size;
+      *crc32 = stat.m_crc32;
+      return true;
+    }
+    if (!readIncrementalRefUnlocked(name, &ref_payload)) {
+      return false;
+    }
+  }
+  return parseIncrementalRef(ref_payload, source_file, size, crc32);
+}
+
 std::vector<std::string> PyTorchStreamReader::getAllRecords() {
+  std::lock_guard<std::mutex> guard(reader_lock_);
   mz_uint num_files = mz_zip_reader_get_num_files(ar_.get());
   std::vector<std::string> out;
   char buf[MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE];
@@ -211,18 +334,173 @@ size_t PyTorchStreamReader::getRecordID(const std::string& name) {
   return result;
 }
 
+// Note [Memory-mapped record loading]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// PyTorchStreamWriter stores all records uncompressed and aligned to
+// kFieldAlignment (64) bytes precisely so that the archive can be mmapped
+// and record data used in place (see the format comment in
+// inline_container.h). When a reader is constructed from a file name with
+// use_mmap=true we take advantage of that: the whole file is mapped once,
+// MAP_PRIVATE with PROT_READ|PROT_WRITE, and getRecord hands out DataPtrs
+// that alias the mapping instead of copying the bytes. This makes load
+// time proportional to the metadata, not the tensor payload; pages are
+// faulted in on first access, clean pages are shared with other processes
+// mapping the same file, and writes into a loaded tensor dirty only the
+// touched pages (copy-on-write), preserving normal mutable-tensor
+// semantics. Each returned DataPtr owns a shared_ptr to the mapping, so
+// the mapping stays alive until the last aliasing storage is gone.
+//
+// Records that are compressed (written by foreign zip tools) or not
+// aligned, and platforms without mmap, fall back to the copying path
+// below.
+
+#ifndef _WIN32
+static void deleteMmapRegionReference(void* ctx) {
+  delete static_cast<std::shared_ptr<void>*>(ctx);
+}
+#endif
+
+void* PyTorchStreamReader::mmapBase() {
+#ifndef _WIN32
+  if (!mmap_region_) {
+    int fd = open(file_name_.c_str(), O_RDONLY);
+    if (fd == -1) {
+      LOG(WARNING) << "could not reopen " << file_name_
+                   << " for mmap, falling back to copying reads";
+      use_mmap_ = false;
+      return nullptr;
+    }
+    size_t size = in_->size();
+    void* base =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+      LOG(WARNING) << "could not mmap " << file_name_
+                   << ", falling back to copying reads";
+      use_mmap_ = false;
+      return nullptr;
+    }
+    mmap_region_ =
+        std::shared_ptr<void>(base, [size](void* p) { munmap(p, size); });
+  }
+  return mmap_region_.get();
+#else
+  use_mmap_ = false;
+  return nullptr;
+#endif
+}
+
 // return dataptr, size
 std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string& name) {
-  size_t key = getRecordID(name);
-  mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), key, &stat);
-  valid("retrieving file meta-data for ", name.c_str());
-  void * ptr = malloc(stat.m_uncomp_size);
-  mz_zip_reader_extract_to_mem(ar_.get(), key, ptr, stat.m_uncomp_size, 0);
-  valid("reading file ", name.c_str());
-
+  // See Note [Incremental checkpoint records]
+  {
+    bool is_ref = false;
+    std::string ref_payload;
+    {
+      std::lock_guard<std::mutex> guard(reader_lock_);
+      if (!hasRecordUnlocked(name)) {
+        is_ref = readIncrementalRefUnlocked(name, &ref_payload);
+      }
+    }
+    if (is_ref) {
+      std::string source_file;
+      uint64_t ref_size = 0;
+      uint32_t ref_crc = 0;
+      if (!parseIncrementalRef(ref_payload, &source_file, &ref_size, &ref_crc)) {
+        CAFFE_THROW("malformed incremental ref for record: ", name);
+      }
+      auto result = baseReader(source_file)->getRecord(name);
+      if (std::get<1>(result) != ref_size) {
+        CAFFE_THROW(
+            "incremental ref for record ",
+            name,
+            " does not match origin archive ",
+            source_file,
+            "; was the origin overwritten?");
+      }
+      return result;
+    }
+  }
+  size_t uncomp_size;
+  size_t comp_size = 0;
+  uint32_t expected_crc = 0;
+  size_t offset = 0;
+  bool stored = false;
+  bool deflated = false;
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    size_t key = getRecordID(name);
+    mz_zip_archive_file_stat stat;
+    mz_zip_reader_file_stat(ar_.get(), key, &stat);
+    valid("retrieving file meta-data for ", name.c_str());
+    uncomp_size = stat.m_uncomp_size;
+    stored = stat.m_method == 0;
+    if (stored) {
+      offset = getRecordOffsetUnlocked(name);
+    }
+#ifndef _WIN32
+    // See Note [Memory-mapped record loading]
+    if (use_mmap_ && stored && offset % kFieldAlignment == 0) {
+      void* base = mmapBase();
+      if (base != nullptr) {
+        at::DataPtr retval(
+            static_cast<char*>(base) + offset,
+            new std::shared_ptr<void>(mmap_region_),
+            deleteMmapRegionReference,
+            at::kCPU);
+        return std::make_tuple(std::move(retval), uncomp_size);
+      }
+    }
+#endif
+    deflated = stat.m_method == MZ_DEFLATED;
+    if (deflated) {
+      comp_size = stat.m_comp_size;
+      expected_crc = stat.m_crc32;
+      offset = getRecordOffsetUnlocked(name);
+    } else if (!stored) {
+      // Exotic compression methods have to go through miniz, which is
+      // stateful, so the inflation stays under the lock.
+      void* ptr = malloc(uncomp_size);
+      mz_zip_reader_extract_to_mem(ar_.get(), key, ptr, uncomp_size, 0);
+      valid("reading file ", name.c_str());
+      at::DataPtr retval(ptr, ptr, free, at::kCPU);
+      return std::make_tuple(std::move(retval), uncomp_size);
+    }
+  }
+  if (deflated) {
+    // See Note [Compressed records]: the raw deflate stream is read
+    // through the adapter's thread-safe positional read and inflated with
+    // a stateless tinfl call, all outside of the lock, so several records
+    // can decompress in parallel.
+    std::vector<char> comp(comp_size);
+    in_->read(offset, comp.data(), comp_size, "reading compressed record");
+    void* ptr = malloc(uncomp_size);
+    at::DataPtr retval(ptr, ptr, free, at::kCPU);
+    size_t actual = tinfl_decompress_mem_to_mem(
+        ptr,
+        uncomp_size,
+        comp.data(),
+        comp_size,
+        TINFL_FLAG_USE_NON_WRAPPING_OUTPUT_BUF);
+    if (actual != uncomp_size) {
+      CAFFE_THROW("failed to decompress record: ", name);
+    }
+    if (static_cast<uint32_t>(mz_crc32(
+            MZ_CRC32_INIT, static_cast<const mz_uint8*>(ptr), uncomp_size)) !=
+        expected_crc) {
+      CAFFE_THROW("crc mismatch decompressing record: ", name);
+    }
+    return std::make_tuple(std::move(retval), uncomp_size);
+  }
+  // Stored (uncompressed) records are read outside of the lock through
+  // the adapter's thread-safe positional read, so several threads can
+  // fetch records at the same time. Like the mmap path above this trusts
+  // the record payload and skips miniz's CRC pass over the data, which
+  // used to make loads CPU-bound instead of I/O-bound.
+  void* ptr = malloc(uncomp_size);
+  in_->read(offset, ptr, uncomp_size, "reading record");
   at::DataPtr retval(ptr, ptr, free, at::kCPU);
-  return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+  return std::make_tuple(std::move(retval), uncomp_size);
 }
 
 static int64_t read_le_16(uint8_t* buf) {
@@ -230,6 +508,11 @@ static int64_t read_le_16(uint8_t* buf) {
 }
 
 size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  return getRecordOffsetUnlocked(name);
+}
+
+size_t PyTorchStreamReader::getRecordOffsetUnlocked(const std::string& name) {
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
   valid("retrieving file meta-data for ", name.c_str());
@@ -309,6 +592,30 @@ void PyTorchStreamWriter::setup(const string& file_name) {
   writeRecord("version", version.c_str(), version.size());
 }
 
+void PyTorchStreamWriter::setIncrementalBase(const std::string& base_file_name) {
+  AT_ASSERT(!finalized_);
+  base_reader_ = std::make_unique<PyTorchStreamReader>(base_file_name);
+}
+
+// Note [Compressed records]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// By default PyTorchStreamWriter stores every record raw so that archives
+// can be mmapped (see Note [Memory-mapped record loading]). When artifact
+// size matters more than in-place loading — e.g. models pulled over the
+// network on cold start — setCompressionEnabled(true) makes writeRecord
+// deflate records of at least kMinRecordSizeToCompress bytes through
+// miniz. Tiny records (the version file, incremental refs, json metadata)
+// stay raw, and alignment padding is still applied, so raw records in a
+// mixed archive keep their 64-byte alignment and their mmap fast path.
+//
+// On load, a deflated record's compressed bytes are fetched with the
+// adapter's positional read and inflated by a stateless
+// tinfl_decompress_mem_to_mem call outside of reader_lock_, with the
+// central directory's crc32 verified on the inflated bytes. Records
+// therefore decompress in parallel when the import path prefetches them
+// concurrently; we do not additionally chunk a single record, because a
+// deflate stream is not seekable mid-stream and the per-record
+// parallelism already saturates the codec on real checkpoints.
 void PyTorchStreamWriter::writeRecord(
     const std::string& name,
     const void* data,
@@ -316,6 +623,26 @@ void PyTorchStreamWriter::writeRecord(
     bool compress) {
   AT_ASSERT(!finalized_);
   AT_ASSERT(!archive_name_plus_slash_.empty());
+  // See Note [Incremental checkpoint records]
+  if (base_reader_ != nullptr && !compress && size >= kMinRecordSizeToDedup) {
+    std::string source_file;
+    uint64_t base_size = 0;
+    uint32_t base_crc = 0;
+    if (base_reader_->getRecordSourceInfo(
+            name, &source_file, &base_size, &base_crc) &&
+        !source_file.empty() && base_size == size &&
+        base_crc ==
+            static_cast<uint32_t>(mz_crc32(
+                MZ_CRC32_INIT, static_cast<const mz_uint8*>(data), size))) {
+      std::string ref = formatIncrementalRef(source_file, base_size, base_crc);
+      writeRecord(name + kIncrementalRefSuffix, ref.data(), ref.size());
+      return;
+    }
+  }
+  // See Note [Compressed records]
+  if (compress_records_ && size >= kMinRecordSizeToCompress) {
+    compress = true;
+  }
   std::string full_name = archive_name_plus_slash_ + name;
   size_t padding_size =
       getPadding(ar_->m_archive_size, full_name.size(), size, padding_);
@@ -5,7 +5,10 @@
 #include <cstring>
 #include <fstream>
 #include <istream>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <unordered_map>
 
 #include <c10/core/Allocator.h>
 #include <c10/core/Backend.h>
@@ -39,7 +42,9 @@ typedef struct mz_zip_archive mz_zip_archive;
 //
 // The PyTorchStreamWriter also ensures additional useful properties for these
 // files
-// 1. All files are stored uncompressed.
+// 1. All files are stored uncompressed by default; setCompressionEnabled
+//    opts large records into deflate when artifact size matters more than
+//    mmap loading (see Note [Compressed records] in inline_container.cc).
 // 2. All files in the archive are aligned to 64 byte boundaries such that
 //    it is possible to mmap the entire file and get an aligned pointer to
 //    tensor data.
@@ -97,18 +102,54 @@ constexpr uint64_t kProducedFileFormatVersion = 0x2L;
 // Writer-specific constants
 constexpr uint64_t kFieldAlignment = 64;
 
+// Records smaller than this are always written in full by an incremental
+// writer; deduplicating them is not worth the indirection. See
+// Note [Incremental checkpoint records] in inline_container.cc.
+constexpr uint64_t kMinRecordSizeToDedup = 1024;
+
+// Records smaller than this are never compressed by a writer with
+// compression enabled; the deflate header overhead and the loss of the
+// mmap fast path are not worth it. See Note [Compressed records] in
+// inline_container.cc.
+constexpr uint64_t kMinRecordSizeToCompress = 1024;
+
 class CAFFE2_API PyTorchStreamReader final {
  public:
-  explicit PyTorchStreamReader(const std::string& file_name);
+  // When use_mmap is true, records that are stored uncompressed and
+  // kFieldAlignment-aligned (everything PyTorchStreamWriter produces) are
+  // returned as views of a single copy-on-write private mapping of the
+  // file instead of being copied into freshly allocated memory. See
+  // Note [Memory-mapped record loading] in inline_container.cc.
+  // mmap is not available on Windows; there (and for records written by
+  // foreign zip tools) we silently fall back to copying reads.
+  explicit PyTorchStreamReader(
+      const std::string& file_name,
+      bool use_mmap = false);
   explicit PyTorchStreamReader(std::istream* in);
   explicit PyTorchStreamReader(std::unique_ptr<ReadAdapterInterface> in);
 
+  // All record accessors below are safe to call from several threads
+  // concurrently; the archive metadata is guarded by an internal lock and
+  // bulk data reads go through the adapter's thread-safe read(). This is
+  // what allows the import path to fetch tensor records in parallel.
+
   // return dataptr, size
   std::tuple<at::DataPtr, size_t> getRecord(const std::string& name);
   size_t getRecordOffset(const std::string& name);
   bool hasRecord(const std::string& name);
   std::vector<std::string> getAllRecords();
 
+  // Resolves where a record's payload physically lives. Returns false if
+  // the record does not exist; otherwise fills the payload size, crc32
+  // and the file holding the bytes (this archive, or the origin archive
+  // when the record is an incremental ref). See
+  // Note [Incremental checkpoint records] in inline_container.cc.
+  bool getRecordSourceInfo(
+      const std::string& name,
+      std::string* source_file,
+      uint64_t* size,
+      uint32_t* crc32);
+
   ~PyTorchStreamReader();
   uint64_t version() const {
     return version_;
@@ -119,6 +160,14 @@ class CAFFE2_API PyTorchStreamReader final {
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordOffsetUnlocked(const std::string& name);
+  bool hasRecordUnlocked(const std::string& name);
+  bool readIncrementalRefUnlocked(const std::string& name, std::string* payload);
+  std::shared_ptr<PyTorchStreamReader> baseReader(const std::string& path);
+  // Lazily maps the whole archive; returns nullptr if mapping is
+  // unavailable (e.g. on Windows), in which case getRecord falls back to
+  // copying reads.
+  void* mmapBase();
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -127,6 +176,18 @@ class CAFFE2_API PyTorchStreamReader final {
   std::string archive_name_plus_slash_;
   std::unique_ptr<ReadAdapterInterface> in_;
   int64_t version_;
+  // Guards the miniz archive state (central directory lookups, error
+  // flags); bulk record reads happen outside of it.
+  mutable std::mutex reader_lock_;
+  std::string file_name_;
+  bool use_mmap_ = false;
+  // Shared so that DataPtrs returned by getRecord can keep the mapping
+  // alive after the reader is destroyed.
+  std::shared_ptr<void> mmap_region_;
+  // Lazily opened origin archives for incremental refs, keyed by path.
+  std::mutex base_readers_lock_;
+  std::unordered_map<std::string, std::shared_ptr<PyTorchStreamReader>>
+      base_readers_;
 };
 
 class CAFFE2_API PyTorchStreamWriter final {
@@ -135,6 +196,21 @@ class CAFFE2_API PyTorchStreamWriter final {
   explicit PyTorchStreamWriter(
       const std::function<size_t(const void*, size_t)>& writer_func);
 
+  // Makes subsequent writeRecord calls deduplicate against the given
+  // archive: records whose bytes are identical to the base's are written
+  // as small refs instead of full payloads. See
+  // Note [Incremental checkpoint records] in inline_container.cc.
+  void setIncrementalBase(const std::string& base_file_name);
+
+  // Makes subsequent writeRecord calls deflate records of at least
+  // kMinRecordSizeToCompress bytes. Compressed records cannot be mmapped
+  // at load time but are inflated outside of the reader's lock, so they
+  // still decompress in parallel. See Note [Compressed records] in
+  // inline_container.cc.
+  void setCompressionEnabled(bool enabled) {
+    compress_records_ = enabled;
+  }
+
   void writeRecord(
       const std::string& name,
       const void* data,
@@ -162,6 +238,8 @@ class CAFFE2_API PyTorchStreamWriter final {
   std::string padding_;
   std::ofstream file_stream_;
   std::function<size_t(const void*, size_t)> writer_func_;
+  std::unique_ptr<PyTorchStreamReader> base_reader_;
+  bool compress_records_ = false;
   bool finalized_ = false;
   bool err_seen_ = false;
   friend size_t ostream_write_func(
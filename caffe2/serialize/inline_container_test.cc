@@ -63,6 +63,149 @@ TEST(PyTorchStreamWriterAndReader, SaveAndLoad) {
   ASSERT_EQ(memcmp(the_file.c_str() + off2, data2.data(), data2.size()), 0);
 }
 
+// See Note [Incremental checkpoint records] in inline_container.cc
+TEST(PyTorchStreamWriterAndReader, IncrementalSaveAndLoad) {
+  std::string base_name = "output_base.zip";
+  std::string delta_name = "output_delta.zip";
+  std::string delta2_name = "output_delta2.zip";
+
+  std::vector<char> unchanged(4096);
+  std::vector<char> changed(4096);
+  for (size_t i = 0; i < unchanged.size(); ++i) {
+    unchanged[i] = i % 251;
+    changed[i] = i % 241;
+  }
+
+  {
+    PyTorchStreamWriter writer(base_name);
+    writer.writeRecord("weights", unchanged.data(), unchanged.size());
+    writer.writeRecord("biases", changed.data(), changed.size());
+    writer.writeEndOfFile();
+  }
+
+  // Second checkpoint: "weights" is identical, "biases" changed.
+  changed[0] = 'x';
+  {
+    PyTorchStreamWriter writer(delta_name);
+    writer.setIncrementalBase(base_name);
+    writer.writeRecord("weights", unchanged.data(), unchanged.size());
+    writer.writeRecord("biases", changed.data(), changed.size());
+    writer.writeEndOfFile();
+  }
+
+  // Third checkpoint based on the second: the ref must point straight at
+  // the base archive, not at the delta.
+  {
+    PyTorchStreamWriter writer(delta2_name);
+    writer.setIncrementalBase(delta_name);
+    writer.writeRecord("weights", unchanged.data(), unchanged.size());
+    writer.writeEndOfFile();
+  }
+
+  at::DataPtr data_ptr;
+  int64_t size;
+  {
+    PyTorchStreamReader reader(delta_name);
+    ASSERT_TRUE(reader.hasRecord("weights"));
+    ASSERT_TRUE(reader.hasRecord("biases"));
+    std::tie(data_ptr, size) = reader.getRecord("weights");
+    ASSERT_EQ(size, unchanged.size());
+    ASSERT_EQ(memcmp(data_ptr.get(), unchanged.data(), unchanged.size()), 0);
+    std::tie(data_ptr, size) = reader.getRecord("biases");
+    ASSERT_EQ(size, changed.size());
+    ASSERT_EQ(memcmp(data_ptr.get(), changed.data(), changed.size()), 0);
+  }
+  {
+    PyTorchStreamReader reader(delta2_name);
+    std::string source_file;
+    uint64_t source_size;
+    uint32_t source_crc;
+    ASSERT_TRUE(reader.getRecordSourceInfo(
+        "weights", &source_file, &source_size, &source_crc));
+    ASSERT_EQ(source_file, base_name);
+    std::tie(data_ptr, size) = reader.getRecord("weights");
+    ASSERT_EQ(size, unchanged.size());
+    ASSERT_EQ(memcmp(data_ptr.get(), unchanged.data(), unchanged.size()), 0);
+  }
+
+  std::remove(base_name.c_str());
+  std::remove(delta_name.c_str());
+  std::remove(delta2_name.c_str());
+}
+
+// See Note [Compressed records] in inline_container.cc
+TEST(PyTorchStreamWriterAndReader, CompressedSaveAndLoad) {
+  std::string file_name = "output_compressed.zip";
+  // Compressible payload well above kMinRecordSizeToCompress, plus a
+  // small record that must stay raw.
+  std::vector<char> big(64 * 1024);
+  for (size_t i = 0; i < big.size(); ++i) {
+    big[i] = i % 17;
+  }
+  std::array<char, 64> small;
+  for (int i = 0; i < small.size(); ++i) {
+    small[i] = small.size() - i;
+  }
+  {
+    PyTorchStreamWriter writer(file_name);
+    writer.setCompressionEnabled(true);
+    writer.writeRecord("big", big.data(), big.size());
+    writer.writeRecord("small", small.data(), small.size());
+    writer.writeEndOfFile();
+  }
+
+  std::ifstream in(file_name, std::ifstream::binary | std::ifstream::ate);
+  // The archive must actually be smaller than the raw payload.
+  ASSERT_LT(static_cast<size_t>(in.tellg()), big.size());
+  in.close();
+
+  PyTorchStreamReader reader(file_name);
+  at::DataPtr data_ptr;
+  int64_t size;
+  std::tie(data_ptr, size) = reader.getRecord("big");
+  ASSERT_EQ(size, big.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), big.data(), big.size()), 0);
+  std::tie(data_ptr, size) = reader.getRecord("small");
+  ASSERT_EQ(size, small.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), small.data(), small.size()), 0);
+  std::remove(file_name.c_str());
+}
+
+#ifndef _WIN32
+TEST(PyTorchStreamWriterAndReader, SaveAndLoadMmap) {
+  std::string file_name = "output_mmap.zip";
+  PyTorchStreamWriter writer(file_name);
+  std::array<char, 127> data1;
+  for (int i = 0; i < data1.size(); ++i) {
+    data1[i] = data1.size() - i;
+  }
+  writer.writeRecord("key1", data1.data(), data1.size());
+  writer.writeEndOfFile();
+
+  // See Note [Memory-mapped record loading] in inline_container.cc
+  PyTorchStreamReader reader(file_name, /*use_mmap=*/true);
+  at::DataPtr data_ptr;
+  int64_t size;
+  std::tie(data_ptr, size) = reader.getRecord("key1");
+  ASSERT_EQ(size, data1.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), data1.data(), data1.size()), 0);
+
+  // The mapping is copy-on-write: writing through the record must not
+  // change the underlying file, and the record must stay valid after the
+  // reader that produced it is gone.
+  static_cast<char*>(data_ptr.get())[0] = 'x';
+  {
+    at::DataPtr outlives_reader;
+    {
+      PyTorchStreamReader fresh(file_name, /*use_mmap=*/true);
+      std::tie(outlives_reader, size) = fresh.getRecord("key1");
+    }
+    ASSERT_EQ(memcmp(outlives_reader.get(), data1.data(), data1.size()), 0);
+  }
+  std::remove(file_name.c_str());
+}
+#endif
+
 } // namespace
 } // namespace serialize
 } // namespace caffe2
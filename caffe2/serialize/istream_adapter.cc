@@ -7,6 +7,7 @@ namespace serialize {
 IStreamAdapter::IStreamAdapter(std::istream* istream) : istream_(istream) {}
 
 size_t IStreamAdapter::size() const {
+  std::lock_guard<std::mutex> guard(mutex_);
   auto prev_pos = istream_->tellg();
   validate("getting the current position");
   istream_->seekg(0, istream_->end);
@@ -20,6 +21,7 @@ size_t IStreamAdapter::size() const {
 
 size_t IStreamAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
     const {
+  std::lock_guard<std::mutex> guard(mutex_);
   istream_->seekg(pos);
   validate(what);
   istream_->read(static_cast<char*>(buf), n);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <istream>
+#include <mutex>
 
 #include "c10/macros/Macros.h"
 #include "caffe2/serialize/read_adapter_interface.h"
@@ -20,6 +21,10 @@ class CAFFE2_API IStreamAdapter final : public ReadAdapterInterface {
 
  private:
   std::istream* istream_;
+  // An istream has a single read position, so concurrent reads have to be
+  // serialized. See the thread-safety contract on
+  // ReadAdapterInterface::read.
+  mutable std::mutex mutex_;
   void validate(const char* what) const;
 };
 
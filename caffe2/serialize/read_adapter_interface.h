@@ -14,6 +14,10 @@ namespace serialize {
 class CAFFE2_API ReadAdapterInterface {
  public:
   virtual size_t size() const = 0;
+  // read() must be safe to call from several threads concurrently;
+  // PyTorchStreamReader relies on this to fetch records in parallel.
+  // Implementations over inherently serial sources (e.g. istreams) may
+  // satisfy this with an internal lock.
   virtual size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const = 0;
   virtual ~ReadAdapterInterface();
@@ -4,6 +4,10 @@
 
 #include <cpuinfo.h>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 C10_DEFINE_bool(
     caffe2_threadpool_force_inline,
     false,
@@ -113,6 +117,93 @@ void ThreadPool::setMinWorkSize(size_t size) {
   minWorkSize_ = size;
 }
 
+void ThreadPool::warmup() {
+  const auto numThreads = numThreads_.load(std::memory_order_relaxed);
+  if (numThreads <= 1) {
+    return;
+  }
+  // One task of every run() executes on the calling thread, so the pool
+  // only ever holds numThreads - 1 workers.
+  withPool(
+      [&](WorkersPool* pool) { pool->EnsureWorkers(numThreads - 1); });
+}
+
+#if defined(__linux__)
+namespace {
+
+// The linux cpu ids the given mode allows workers to run on. kDefault
+// returns the full processor set, which undoes a previous pin.
+std::vector<int> cpusForPerformanceMode(ThreadPool::PerformanceMode mode) {
+  std::vector<int> cpus;
+  if (mode == ThreadPool::PerformanceMode::kDefault) {
+    for (uint32_t i = 0; i < cpuinfo_get_processors_count(); ++i) {
+      cpus.push_back(cpuinfo_get_processor(i)->linux_id);
+    }
+    return cpus;
+  }
+  const struct cpuinfo_cluster* selected = nullptr;
+  for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); ++i) {
+    const auto* cluster = cpuinfo_get_cluster(i);
+    if (selected == nullptr ||
+        (mode == ThreadPool::PerformanceMode::kLatency
+             ? cluster->frequency > selected->frequency
+             : cluster->frequency < selected->frequency)) {
+      selected = cluster;
+    }
+  }
+  if (selected != nullptr) {
+    for (uint32_t i = 0; i < selected->processor_count; ++i) {
+      cpus.push_back(
+          cpuinfo_get_processor(selected->processor_start + i)->linux_id);
+    }
+  }
+  return cpus;
+}
+
+// Run() executes on a pool worker and pins that worker; the task handed to
+// the calling thread carries no mask so the caller's affinity is untouched.
+struct AffinityTask : public Task {
+  explicit AffinityTask(const cpu_set_t* set) : set_(set) {}
+  void Run() override {
+    if (set_ != nullptr) {
+      sched_setaffinity(0, sizeof(cpu_set_t), set_);
+    }
+  }
+  const cpu_set_t* set_;
+};
+
+} // namespace
+#endif // __linux__
+
+void ThreadPool::setPerformanceMode(PerformanceMode mode) {
+#if defined(__linux__)
+  const auto numThreads = numThreads_.load(std::memory_order_relaxed);
+  if (numThreads <= 1) {
+    return;
+  }
+  CAFFE_ENFORCE(cpuinfo_initialize(), "cpuinfo initialization failed");
+  const auto cpus = cpusForPerformanceMode(mode);
+  if (cpus.empty()) {
+    return;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const int cpu : cpus) {
+    CPU_SET(cpu, &set);
+  }
+  // Execute() hands tasks 1..N-1 to distinct workers, so every worker pins
+  // itself exactly once.
+  std::vector<std::shared_ptr<Task>> tasks;
+  tasks.push_back(std::make_shared<AffinityTask>(nullptr));
+  for (size_t i = 1; i < numThreads; ++i) {
+    tasks.push_back(std::make_shared<AffinityTask>(&set));
+  }
+  withPool([&](WorkersPool* pool) { pool->Execute(tasks); });
+#else
+  (void)mode;
+#endif
+}
+
 void ThreadPool::run(const std::function<void(int, size_t)>& fn, size_t range) {
   const auto numThreads = numThreads_.load(std::memory_order_relaxed);
 
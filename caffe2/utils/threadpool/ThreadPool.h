@@ -34,9 +34,13 @@ class CAFFE2_API /*alignas(kCacheLineSize)*/ ThreadPool {
  public:
   static std::unique_ptr<ThreadPool> defaultThreadPool();
   ThreadPool(int numThreads);
-  ~ThreadPool();
+  virtual ~ThreadPool();
   // Returns the number of threads currently in use
-  int getNumThreads() const;
+  //
+  // getNumThreads() and run() are virtual so that the pthreadpool shim in
+  // pthreadpool_impl.cc can be pointed at a pool that delegates elsewhere;
+  // see the intra-op bridge in ThreadPoolMobile.cc.
+  virtual int getNumThreads() const;
   void setNumThreads(size_t numThreads);
 
   // Sets the minimum work size (range) for which to invoke the
@@ -46,7 +50,23 @@ class CAFFE2_API /*alignas(kCacheLineSize)*/ ThreadPool {
   size_t getMinWorkSize() const {
     return minWorkSize_;
   }
-  void run(const std::function<void(int, size_t)>& fn, size_t range);
+  virtual void run(const std::function<void(int, size_t)>& fn, size_t range);
+
+  // Core placement for the pool's worker threads on big.LITTLE SoCs.
+  // Only effective on Linux/Android; a no-op elsewhere.
+  enum class PerformanceMode : uint8_t {
+    kDefault, // full-mask affinity; the OS scheduler decides placement
+    kLatency, // pin workers to the highest-frequency (big) cluster
+    kPower, // pin workers to the lowest-frequency (LITTLE) cluster
+  };
+
+  // Spawns all worker threads up front, so the first run() does not pay
+  // the thread-creation latency.
+  virtual void warmup();
+
+  // Applies the given core placement to every worker thread (spawning them
+  // if necessary). The calling thread's affinity is left untouched.
+  virtual void setPerformanceMode(PerformanceMode mode);
 
   // Run an arbitrary function in a thread-safe manner accessing the Workers
   // Pool
@@ -2,15 +2,56 @@
 #include <caffe2/utils/threadpool/ThreadPool.h>
 #include <caffe2/utils/threadpool/pthreadpool.h>
 
+#ifndef C10_MOBILE
+#include <ATen/Parallel.h>
+#endif
+
 namespace caffe2 {
 
+#ifndef C10_MOBILE
+namespace {
+
+// Bridge that exposes the ATen intra-op pool through the caffe2::ThreadPool
+// interface. The pthreadpool shim in pthreadpool_impl.cc only needs run()
+// and getNumThreads(), so QNNPACK/NNPACK kernels handed this pool execute
+// on the same threads as every other ATen op instead of sequentially (the
+// old nullptr behavior) or on a second pool contending for the same cores.
+class IntraOpThreadPoolBridge final : public ThreadPool {
+ public:
+  IntraOpThreadPoolBridge() : ThreadPool(/*numThreads=*/0) {}
+
+  int getNumThreads() const override {
+    return at::get_num_threads();
+  }
+
+  void run(const std::function<void(int, size_t)>& fn, size_t range)
+      override {
+    at::parallel_for(
+        0,
+        static_cast<int64_t>(range),
+        /*grain_size=*/1,
+        [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            fn(at::get_thread_num(), static_cast<size_t>(i));
+          }
+        });
+  }
+};
+
+} // namespace
+#endif // C10_MOBILE
+
 caffe2::ThreadPool* mobile_threadpool() {
 #ifdef C10_MOBILE
   static std::unique_ptr<caffe2::ThreadPool> thread_pool =
       caffe2::ThreadPool::defaultThreadPool();
   return thread_pool.get();
 #else
-  return nullptr;
+  // On server builds the caffe2 pool does not exist; hand out the intra-op
+  // bridge so pthreadpool consumers share the ATen pool.
+  static std::unique_ptr<caffe2::ThreadPool> thread_pool =
+      std::make_unique<IntraOpThreadPoolBridge>();
+  return thread_pool.get();
 #endif
 }
 
@@ -332,6 +332,13 @@ class WorkersPool {
  public:
   WorkersPool() {}
 
+  // Pre-spawns workers so a later Execute() does not pay thread creation.
+  // Like Execute(), must be called under the owning ThreadPool's execution
+  // mutex (see ThreadPool::withPool).
+  void EnsureWorkers(std::size_t workers_count) {
+    CreateWorkers(workers_count);
+  }
+
   void Execute(const std::vector<std::shared_ptr<Task>>& tasks) {
     CAFFE_ENFORCE_GE(tasks.size(), 1);
     // One of the tasks will be run on the current thread.
@@ -109,6 +109,18 @@ if(INTERN_BUILD_ATEN_OPS)
     endif(MSVC)
   endif(CXX_AVX2_FOUND)
 
+  if(CXX_AVX512_FOUND)
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_AVX512_CPU_DEFINITION")
+    list(APPEND CPU_CAPABILITY_NAMES "AVX512")
+    if(MSVC)
+      list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG}/arch:AVX512")
+    else(MSVC)
+      # bw/vl/dq cover the byte/word and 256-bit-on-512 forms the kernels use;
+      # this matches the feature set of Skylake-SP and newer server parts.
+      list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG} -mavx512f -mavx512bw -mavx512vl -mavx512dq -mfma")
+    endif(MSVC)
+  endif(CXX_AVX512_FOUND)
+
   list(LENGTH CPU_CAPABILITY_NAMES NUM_CPU_CAPABILITY_NAMES)
   math(EXPR NUM_CPU_CAPABILITY_NAMES "${NUM_CPU_CAPABILITY_NAMES}-1")
 
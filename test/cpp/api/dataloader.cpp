@@ -227,6 +227,68 @@ TEST(DataTest, OrderedSequencerReOrdersValues) {
   }
 }
 
+TEST(DataTest, WindowedSequencerIsSetUpWell) {
+  using namespace torch::data::detail::sequencers; // NOLINT
+  struct S {
+    size_t sequence_number;
+  };
+  const size_t kWindow = 3;
+  const size_t kMaxJobs = 5;
+  WindowedSequencer<S> sequencer(kWindow, kMaxJobs);
+  ASSERT_EQ(sequencer.next_sequence_number_, 0);
+  ASSERT_EQ(sequencer.window_, kWindow);
+  ASSERT_EQ(sequencer.buffer_.size(), kMaxJobs);
+}
+
+TEST(DataTest, WindowedSequencerBoundsReordering) {
+  using namespace torch::data::detail::sequencers; // NOLINT
+  struct S {
+    size_t sequence_number;
+  };
+  const size_t kWindow = 2;
+  const size_t kMaxJobs = 5;
+  WindowedSequencer<S> sequencer(kWindow, kMaxJobs);
+
+  // Sequence number 0 is "slow" and arrives last; 1 is within the window
+  // of 0 and passes straight through, but 2 and 3 are too far ahead and
+  // must wait for 0.
+  std::vector<size_t> v = {1, 2, 3, 0};
+  size_t index = 0;
+  auto getter = [&v, &index]() { return S{v.at(index++)}; };
+
+  // 1 < 0 + kWindow, so it is returned immediately.
+  ASSERT_EQ(1, sequencer.next(getter).value().sequence_number);
+  ASSERT_EQ(index, 1);
+
+  // 2 and 3 get buffered until 0 arrives; 0 is in the window and returned.
+  ASSERT_EQ(0, sequencer.next(getter).value().sequence_number);
+  ASSERT_EQ(index, 4);
+
+  // Returning 0 and 1 slid the window; the buffered results drain in order
+  // without touching the getter.
+  ASSERT_EQ(2, sequencer.next(getter).value().sequence_number);
+  ASSERT_EQ(3, sequencer.next(getter).value().sequence_number);
+  ASSERT_EQ(index, 4);
+}
+
+TEST(DataTest, WindowedSequencerWindowOfOneIsStrictOrdering) {
+  using namespace torch::data::detail::sequencers; // NOLINT
+  struct S {
+    size_t sequence_number;
+  };
+  const size_t kMaxJobs = 5;
+  WindowedSequencer<S> sequencer(/*window=*/1, kMaxJobs);
+
+  std::vector<size_t> v = {0, 2, 4, 3, 1};
+  size_t index = 0;
+  auto getter = [&v, &index]() { return S{v.at(index++)}; };
+
+  for (size_t i = 0; i <= 4; ++i) {
+    ASSERT_EQ(i, sequencer.next(getter).value().sequence_number);
+  }
+  ASSERT_EQ(index, 5);
+}
+
 TEST(DataTest, BatchLambdaAppliesFunctionToBatch) {
   using InputBatch = std::vector<int>;
   using OutputBatch = std::string;
@@ -377,6 +439,67 @@ TEST(DataTest, RandomSamplerResetsWithNewSizeWell) {
   ASSERT_FALSE(sampler.next(2).has_value());
 }
 
+TEST(DataTest, StreamingRandomSamplerIsAPermutation) {
+  const size_t size = 1000;
+  samplers::StreamingRandomSampler sampler(size);
+  std::vector<size_t> seen;
+  while (auto batch = sampler.next(64)) {
+    seen.insert(seen.end(), batch->begin(), batch->end());
+  }
+  ASSERT_EQ(seen.size(), size);
+  std::sort(seen.begin(), seen.end());
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(seen[i], i);
+  }
+}
+
+TEST(DataTest, StreamingRandomSamplerReturnsLessValuesForLastBatch) {
+  samplers::StreamingRandomSampler sampler(5);
+  ASSERT_EQ(sampler.next(3).value().size(), 3);
+  ASSERT_EQ(sampler.next(100).value().size(), 2);
+  ASSERT_FALSE(sampler.next(2).has_value());
+}
+
+TEST(DataTest, StreamingRandomSamplerResetsWithNewSizeWell) {
+  samplers::StreamingRandomSampler sampler(5);
+  ASSERT_EQ(sampler.next(5).value().size(), 5);
+  ASSERT_FALSE(sampler.next(2).has_value());
+  sampler.reset(7);
+  ASSERT_EQ(sampler.next(7).value().size(), 7);
+  ASSERT_FALSE(sampler.next(2).has_value());
+  sampler.reset(3);
+  ASSERT_EQ(sampler.next(3).value().size(), 3);
+  ASSERT_FALSE(sampler.next(2).has_value());
+}
+
+TEST(DataTest, StreamingRandomSamplerIsDeterministicForSeed) {
+  samplers::StreamingRandomSampler a(100, /*seed=*/42);
+  samplers::StreamingRandomSampler b(100, /*seed=*/42);
+  ASSERT_EQ(a.next(100).value(), b.next(100).value());
+  // A new epoch draws fresh keys from the engine, but the streams stay in
+  // lockstep for equal seeds.
+  a.reset();
+  b.reset();
+  ASSERT_EQ(a.next(100).value(), b.next(100).value());
+}
+
+TEST(DataTest, SavingAndLoadingStreamingRandomSamplerYieldsSameSequence) {
+  samplers::StreamingRandomSampler a(10);
+  a.next(3);
+  ASSERT_EQ(a.index(), 3);
+
+  std::stringstream stream;
+  torch::save(a, stream);
+
+  samplers::StreamingRandomSampler b(10);
+  torch::load(b, stream);
+  ASSERT_EQ(b.index(), 3);
+
+  auto b_sequence = b.next(10).value();
+  ASSERT_EQ(b_sequence.size(), 7);
+  ASSERT_EQ(a.next(10).value(), b_sequence);
+}
+
 TEST(DataTest, SavingAndLoadingRandomSamplerYieldsSameSequence) {
   {
     samplers::RandomSampler a(10);
@@ -485,6 +608,83 @@ TEST(DataTest, StackTransformWorksForTensorExample) {
   ASSERT_TRUE(second.data.allclose(torch::eye(4).slice(/*dim=*/0, 2, 4)));
 }
 
+TEST(DataTest, PooledStackCollatesLikeStackAndRecyclesBatches) {
+  auto d = datasets::TensorDataset(torch::eye(4))
+               .map(transforms::PooledStack<TensorExample>());
+
+  TensorExample batch = d.get_batch({0, 1});
+  ASSERT_TRUE(batch.data.allclose(torch::eye(4).slice(/*dim=*/0, 0, 2)));
+  const void* first_storage = batch.data.data_ptr();
+
+  // While the first batch is alive, the second must not reuse its storage.
+  TensorExample second = d.get_batch({2, 3});
+  ASSERT_TRUE(second.data.allclose(torch::eye(4).slice(/*dim=*/0, 2, 4)));
+  ASSERT_NE(second.data.data_ptr(), first_storage);
+
+  // Once released, the first batch's tensor is handed out again.
+  batch.data.reset();
+  TensorExample third = d.get_batch({1, 2});
+  ASSERT_TRUE(third.data.allclose(torch::eye(4).slice(/*dim=*/0, 1, 3)));
+  ASSERT_EQ(third.data.data_ptr(), first_storage);
+}
+
+TEST(DataTest, PooledStackWorksForExample) {
+  struct D : public datasets::Dataset<D> {
+    Example<> get(size_t index) override {
+      return {tensor[index], 1 + tensor[index]};
+    }
+
+    torch::optional<size_t> size() const override {
+      return tensor.size(0);
+    }
+
+    torch::Tensor tensor{torch::eye(4)};
+  };
+
+  auto d = D().map(transforms::PooledStack<Example<>>());
+
+  Example<> batch = d.get_batch({0, 1});
+  ASSERT_TRUE(batch.data.allclose(torch::eye(4).slice(/*dim=*/0, 0, 2)));
+  ASSERT_TRUE(batch.target.allclose(1 + torch::eye(4).slice(/*dim=*/0, 0, 2)));
+
+  Example<> second = d.get_batch({2, 3});
+  ASSERT_TRUE(second.data.allclose(torch::eye(4).slice(/*dim=*/0, 2, 4)));
+  ASSERT_TRUE(second.target.allclose(1 + torch::eye(4).slice(/*dim=*/0, 2, 4)));
+}
+
+TEST(DataTest, FusedStackRunsStagesAndCollatesForExample) {
+  struct D : public datasets::Dataset<D> {
+    Example<> get(size_t index) override {
+      return {tensor[index], 1 + tensor[index]};
+    }
+
+    torch::optional<size_t> size() const override {
+      return tensor.size(0);
+    }
+
+    torch::Tensor tensor{torch::eye(4)};
+  };
+
+  auto d = D().map(transforms::FusedStack<Example<>>(
+      {[](torch::Tensor t) { return t * 2; },
+       [](torch::Tensor t) { return t + 1; }}));
+
+  Example<> batch = d.get_batch({0, 1});
+  ASSERT_TRUE(batch.data.allclose(
+      2 * torch::eye(4).slice(/*dim=*/0, 0, 2) + 1));
+  // Targets are stacked untouched.
+  ASSERT_TRUE(batch.target.allclose(1 + torch::eye(4).slice(/*dim=*/0, 0, 2)));
+}
+
+TEST(DataTest, FusedStackWorksForTensorExample) {
+  auto d = datasets::TensorDataset(torch::eye(4))
+               .map(transforms::FusedStack<TensorExample>(
+                   {[](torch::Tensor t) { return t * 2; }}));
+
+  TensorExample batch = d.get_batch({0, 1});
+  ASSERT_TRUE(batch.data.allclose(2 * torch::eye(4).slice(/*dim=*/0, 0, 2)));
+}
+
 // Template classes cannot be nested in functions.
 template <typename Target>
 struct T : transforms::TensorTransform<Target> {
@@ -899,6 +1099,47 @@ TEST(DataTest, DistributedRandomSamplerMultiReplicaProduceCorrectSamples) {
   }
 }
 
+TEST(DataTest, DistributedRandomSamplerPrefetchedEpochsMatchFreshShuffles) {
+  const size_t sample_count = 100;
+
+  auto collect = [](samplers::DistributedRandomSampler& sampler) {
+    std::vector<size_t> res;
+    torch::optional<std::vector<size_t>> idx;
+    while ((idx = sampler.next(7)).has_value()) {
+      res.insert(std::end(res), std::begin(*idx), std::end(*idx));
+    }
+    return res;
+  };
+
+  samplers::DistributedRandomSampler a(sample_count, 2, 1);
+  for (size_t epoch = 0; epoch < 4; ++epoch) {
+    // Epochs 1-3 swap in the background-prepared buffer; the sequence must
+    // match a sampler that shuffled the same epoch synchronously.
+    a.set_epoch(epoch);
+    a.reset();
+    samplers::DistributedRandomSampler fresh(sample_count, 2, 1);
+    fresh.set_epoch(epoch);
+    fresh.reset();
+    ASSERT_EQ(collect(a), collect(fresh));
+  }
+
+  // A non-sequential epoch invalidates the prepared buffer and falls back to
+  // the synchronous shuffle.
+  a.set_epoch(42);
+  a.reset();
+  samplers::DistributedRandomSampler jumped(sample_count, 2, 1);
+  jumped.set_epoch(42);
+  jumped.reset();
+  ASSERT_EQ(collect(a), collect(jumped));
+
+  // So does a size change.
+  a.reset(sample_count / 2);
+  samplers::DistributedRandomSampler resized(sample_count / 2, 2, 1);
+  resized.set_epoch(42);
+  resized.reset();
+  ASSERT_EQ(collect(a), collect(resized));
+}
+
 TEST(DataTest, CanSaveAndLoadDistributedRandomSampler) {
   {
     samplers::DistributedRandomSampler a(10);
@@ -1619,6 +1860,82 @@ TEST(DataLoaderTest, StatefulDatasetWithCollate) {
   ASSERT_TRUE(batch->target[0].allclose(torch::zeros(kBatchSize - 1)));
 }
 
+TEST(DataTest, StreamingDatasetBatchesPushedExamplesInOrder) {
+  datasets::StreamingDataset<int> dataset(/*buffer_capacity=*/16);
+  for (int i = 0; i < 10; ++i) {
+    dataset.push(i);
+  }
+  dataset.end_epoch();
+
+  ASSERT_EQ(dataset.get_batch(4).value(), std::vector<int>({0, 1, 2, 3}));
+  ASSERT_EQ(dataset.get_batch(4).value(), std::vector<int>({4, 5, 6, 7}));
+  // The last batch at the epoch boundary may be partial.
+  ASSERT_EQ(dataset.get_batch(4).value(), std::vector<int>({8, 9}));
+  ASSERT_FALSE(dataset.get_batch(4).has_value());
+  // The end-of-epoch signal latches until the next reset().
+  ASSERT_FALSE(dataset.get_batch(4).has_value());
+
+  // Examples pushed after end_epoch() belong to the next epoch.
+  dataset.push(100);
+  dataset.end_epoch();
+  ASSERT_FALSE(dataset.get_batch(4).has_value());
+  dataset.reset();
+  ASSERT_EQ(dataset.get_batch(4).value(), std::vector<int>({100}));
+  ASSERT_FALSE(dataset.get_batch(4).has_value());
+}
+
+TEST(DataTest, StreamingDatasetPushTimesOutWhenBufferIsFull) {
+  datasets::StreamingDataset<int> dataset(/*buffer_capacity=*/2);
+  dataset.push(1);
+  dataset.push(2);
+  ASSERT_EQ(dataset.buffered_example_count(), 2);
+  ASSERT_THROWS_WITH(
+      dataset.push(3, std::chrono::milliseconds(20)),
+      "Timeout while waiting for space in the StreamingDataset buffer");
+  // Draining an example relieves the backpressure.
+  dataset.get_batch(1);
+  dataset.push(3, std::chrono::milliseconds(20));
+  ASSERT_EQ(dataset.buffered_example_count(), 2);
+}
+
+TEST(DataLoaderTest, StreamingDatasetWorksWithDataLoaderWorkers) {
+  const int kNumberOfExamples = 50;
+  const int kNumberOfEpochs = 3;
+
+  auto dataset =
+      datasets::make_shared_dataset<datasets::StreamingDataset<int>>(
+          /*buffer_capacity=*/8);
+
+  // The producer runs ahead of consumption, throttled by the buffer bound.
+  std::thread producer([dataset] {
+    for (int epoch = 0; epoch < kNumberOfEpochs; ++epoch) {
+      for (int i = 0; i < kNumberOfExamples; ++i) {
+        (*dataset).push(i);
+      }
+      (*dataset).end_epoch();
+    }
+  });
+
+  auto data_loader = torch::data::make_data_loader(
+      dataset, DataLoaderOptions(/*batch_size=*/7).workers(2));
+
+  for (int epoch = 0; epoch < kNumberOfEpochs; ++epoch) {
+    std::vector<int> values;
+    for (std::vector<int>& batch : *data_loader) {
+      values.insert(values.end(), batch.begin(), batch.end());
+    }
+    // Workers drain the stream concurrently, so only the multiset of values
+    // is deterministic.
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(values.size(), kNumberOfExamples);
+    for (int i = 0; i < kNumberOfExamples; ++i) {
+      ASSERT_EQ(values[i], i);
+    }
+  }
+
+  producer.join();
+}
+
 // This test tests the core function for iterate through a chunk dataset. It
 // contains test cases with different parameter combination. (For example,
 // different prefetch count, batch size and data loader worker count). It
@@ -2223,6 +2540,80 @@ TEST(DataLoaderTest, ChunkDatasetCrossChunkShuffle) {
   }
 }
 
+TEST(DataLoaderTest, ChunkDatasetStealsChunksFromCrossChunkGroups) {
+  // A reader with very uneven chunk sizes and a chunk_size() scheduling hint.
+  // With multiple preloaders and cross-chunk shuffling, member chunks of one
+  // shuffle group are read by different workers, largest first. The test only
+  // verifies that every example is still delivered exactly once; within-group
+  // order is a scheduling detail.
+  struct D : public datasets::ChunkDataReader<int> {
+   public:
+    using BatchType = datasets::ChunkDataReader<int>::ChunkType;
+
+    BatchType read_chunk(size_t chunk_index) override {
+      BatchType batch_data(chunk_sizes[chunk_index]);
+      int start_index = std::accumulate(
+          chunk_sizes, chunk_sizes + chunk_index, 0);
+      std::iota(batch_data.begin(), batch_data.end(), start_index);
+      return batch_data;
+    }
+
+    size_t chunk_count() override {
+      return chunk_count_;
+    };
+
+    size_t chunk_size(size_t chunk_index) override {
+      return chunk_sizes[chunk_index];
+    }
+
+    void reset() override{};
+
+    const static size_t chunk_count_ = 4;
+    int chunk_sizes[chunk_count_] = {10, 5, 20, 1};
+  };
+
+  const size_t batch_size = 4;
+  const size_t total_example_count = 36;
+  const int epoch_count = 2;
+
+  D data_reader;
+  samplers::SequentialSampler sampler(0);
+
+  datasets::SharedBatchDataset<datasets::ChunkDataset<
+      D,
+      samplers::SequentialSampler,
+      samplers::SequentialSampler>>
+      dataset = datasets::make_shared_dataset<datasets::ChunkDataset<
+          D,
+          samplers::SequentialSampler,
+          samplers::SequentialSampler>>(
+          data_reader,
+          sampler,
+          sampler,
+          datasets::ChunkDatasetOptions(
+              /*preloader_count=*/3,
+              batch_size,
+              /*cache_size=*/40,
+              /*cross_chunk_shuffle_count=*/2));
+
+  auto data_loader = torch::data::make_data_loader(
+      dataset, DataLoaderOptions(batch_size).workers(0));
+
+  for (int epoch_index = 0; epoch_index < epoch_count; ++epoch_index) {
+    std::vector<bool> result(total_example_count, false);
+    for (auto iterator = data_loader->begin(); iterator != data_loader->end();
+         ++iterator) {
+      for (int example : *iterator) {
+        ASSERT_FALSE(result[example]);
+        result[example] = true;
+      }
+    }
+    for (auto data : result) {
+      ASSERT_EQ(data, true);
+    }
+  }
+}
+
 TEST(DataLoaderTest, CustomPreprocessPolicy) {
   const size_t chunk_size = 5;
   const size_t batch_size = 10;
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <torch/torch.h>
+
+#include <torch/data/cuda_prefetcher.h>
+
+#include <cstddef>
+
+using namespace torch::data; // NOLINT
+
+namespace {
+struct RangeDataset : datasets::Dataset<RangeDataset> {
+  explicit RangeDataset(size_t size) : size_(size) {}
+
+  Example<> get(size_t index) override {
+    return {torch::full({2}, static_cast<int64_t>(index), torch::kInt64),
+            torch::full({1}, static_cast<int64_t>(index), torch::kInt64)};
+  }
+  torch::optional<size_t> size() const override {
+    return size_;
+  }
+
+  size_t size_;
+};
+} // namespace
+
+TEST(DataLoaderTest, CudaPrefetcherYieldsDeviceBatchesInOrder_CUDA) {
+  const size_t kSize = 10;
+  const int64_t kBatchSize = 2;
+  auto loader = make_data_loader<samplers::SequentialSampler>(
+      RangeDataset(kSize).map(transforms::Stack<>()),
+      DataLoaderOptions().batch_size(kBatchSize).workers(2));
+  auto prefetcher = make_cuda_prefetcher(*loader, torch::kCUDA);
+
+  int64_t batch_index = 0;
+  while (auto batch = prefetcher.next()) {
+    ASSERT_TRUE(batch->data.is_cuda());
+    ASSERT_TRUE(batch->target.is_cuda());
+    const int64_t first = batch_index * kBatchSize;
+    auto expected_data = torch::stack(
+        {torch::full({2}, first, torch::kInt64),
+         torch::full({2}, first + 1, torch::kInt64)});
+    auto expected_target = torch::stack(
+        {torch::full({1}, first, torch::kInt64),
+         torch::full({1}, first + 1, torch::kInt64)});
+    ASSERT_TRUE(batch->data.to(torch::kCPU).equal(expected_data));
+    ASSERT_TRUE(batch->target.to(torch::kCPU).equal(expected_target));
+    ++batch_index;
+  }
+  ASSERT_EQ(batch_index, static_cast<int64_t>(kSize) / kBatchSize);
+}
+
+TEST(DataLoaderTest, CudaPrefetcherSupportsMultipleEpochs_CUDA) {
+  auto loader = make_data_loader<samplers::SequentialSampler>(
+      RangeDataset(6).map(transforms::Stack<>()),
+      DataLoaderOptions().batch_size(3));
+  auto prefetcher = make_cuda_prefetcher(*loader, torch::kCUDA);
+  for (size_t epoch = 0; epoch < 2; ++epoch) {
+    size_t batches = 0;
+    while (auto batch = prefetcher.next()) {
+      ASSERT_TRUE(batch->data.is_cuda());
+      ++batches;
+    }
+    ASSERT_EQ(batches, 2);
+    prefetcher.reset();
+  }
+}
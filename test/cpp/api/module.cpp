@@ -419,6 +419,35 @@ TEST_F(ModuleTest, CloneCreatesDistinctParameters) {
   testDistinctParameters(module, module2);
 }
 
+TEST_F(ModuleTest, CloneSharedAliasesParameterStorage) {
+  auto module = std::make_shared<TestDistinctParametersModule>();
+  auto module2 = module->clone_shared();
+
+  auto params1 = module->named_parameters();
+  auto params2 = module2->named_parameters();
+  ASSERT_EQ(params1.size(), params2.size());
+  for (auto& param : params1) {
+    // Distinct variables sharing the same storage.
+    ASSERT_FALSE(pointer_equal(param.value(), params2[param.key()]));
+    ASSERT_EQ(
+        param->data_ptr<float>(), params2[param.key()].data_ptr<float>());
+  }
+  auto buffers1 = module->named_buffers();
+  auto buffers2 = module2->named_buffers();
+  ASSERT_EQ(buffers1.size(), buffers2.size());
+  for (auto& buffer : buffers1) {
+    ASSERT_EQ(
+        buffer->data_ptr<float>(), buffers2[buffer.key()].data_ptr<float>());
+  }
+
+  // A regular clone of the shared replica promotes it to a private copy.
+  auto module3 = module2->clone();
+  auto params3 = module3->named_parameters();
+  for (auto& param : params2) {
+    ASSERT_NE(param->data_ptr<float>(), params3[param.key()].data_ptr<float>());
+  }
+}
+
 TEST_F(ModuleTest, CloneCreatesDistinctParametersExplicitDevice_CUDA) {
   auto module = std::make_shared<TestDistinctParametersModule>();
   torch::NoGradGuard no_grad;
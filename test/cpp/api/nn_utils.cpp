@@ -141,6 +141,26 @@ TEST_F(NNUtilsTest, ClipGradValue) {
   ASSERT_TRUE(torch::allclose(p1.grad(), p2.grad()));
 }
 
+TEST_F(NNUtilsTest, FunctionalCall) {
+  auto l = Linear(3, 2);
+  auto input = torch::ones({1, 3});
+  auto baseline = l->forward(input);
+
+  std::vector<torch::Tensor> replacement{
+      torch::zeros_like(l->weight), torch::zeros_like(l->bias)};
+  auto output = utils::functional_call(*l, replacement, input);
+  ASSERT_TRUE(output.allclose(torch::zeros({1, 2})));
+
+  // The module's own parameters are untouched after the call.
+  ASSERT_TRUE(l->forward(input).allclose(baseline));
+
+  // Mismatched parameter counts are rejected.
+  std::vector<torch::Tensor> too_few{torch::zeros_like(l->weight)};
+  ASSERT_THROWS_WITH(
+      utils::functional_call(*l, too_few, input),
+      "Expected 2 replacement parameters");
+}
+
 TEST_F(NNUtilsTest, ConvertParameters) {
   std::vector<torch::Tensor> parameters{
     torch::arange(9, torch::kFloat32),
@@ -270,6 +270,38 @@ TEST(OptimTest, XORConvergence_AdamWithAmsgrad) {
       AdamOptions(0.1).weight_decay(1e-6).amsgrad(true)));
 }
 
+TEST(OptimTest, Adam_SparseGradientsMatchDense) {
+  torch::manual_seed(0);
+  auto dense_param = torch::randn({10, 4});
+  auto sparse_param = dense_param.clone();
+  Adam dense_optimizer({dense_param}, AdamOptions(0.01));
+  Adam sparse_optimizer({sparse_param}, AdamOptions(0.01));
+
+  // Duplicate indices exercise the coalesce step of the sparse path.
+  auto indices =
+      torch::tensor({0, 3, 3, 7}, torch::kLong).unsqueeze(0);
+  auto values = torch::randn({4, 4});
+  auto sparse_grad =
+      torch::sparse_coo_tensor(indices, values, {10, 4});
+
+  dense_param.grad() = sparse_grad.to_dense();
+  sparse_param.grad() = sparse_grad;
+
+  dense_optimizer.step();
+  sparse_optimizer.step();
+
+  ASSERT_TRUE(dense_param.allclose(sparse_param));
+}
+
+TEST(OptimTest, Adam_SparseGradientsRejectWeightDecay) {
+  auto param = torch::randn({4, 2});
+  Adam optimizer({param}, AdamOptions(0.01).weight_decay(1e-2));
+  param.grad() = torch::sparse_coo_tensor(
+      torch::zeros({1, 1}, torch::kLong), torch::randn({1, 2}), {4, 2});
+  ASSERT_THROWS_WITH(
+      optimizer.step(), "Adam does not support weight_decay with sparse gradients");
+}
+
 TEST(OptimTest, ProducesPyTorchValues_Adam) {
   check_exact_values<Adam>(AdamOptions(1.0), expected_parameters::Adam());
 }
@@ -390,6 +422,44 @@ TEST(OptimTest, ZeroGrad) {
   }
 }
 
+TEST(OptimTest, FusedStepMatchesStep_SGD) {
+  torch::manual_seed(0);
+
+  Linear model(2, 8);
+  Linear reference_model(2, 8);
+  for (size_t i = 0; i < model->parameters().size(); ++i) {
+    reference_model->parameters()[i].data().copy_(
+        model->parameters()[i].data());
+  }
+
+  auto options = SGDOptions(0.1).momentum(0.9).weight_decay(1e-2);
+  SGD optimizer(model->parameters(), options);
+  SGD reference_optimizer(reference_model->parameters(), options);
+
+  optimizer.enable_fused_step();
+  ASSERT_TRUE(optimizer.fused_step_enabled());
+  ASSERT_THROWS_WITH(optimizer.step(), "fused step mode");
+
+  auto input = torch::ones({5, 2});
+  for (int iteration = 0; iteration < 3; ++iteration) {
+    // Updates are applied by the accumulator hooks during backward
+    model->forward(input).sum().backward();
+    optimizer.zero_grad();
+
+    reference_model->forward(input).sum().backward();
+    reference_optimizer.step();
+    reference_optimizer.zero_grad();
+  }
+
+  for (size_t i = 0; i < model->parameters().size(); ++i) {
+    ASSERT_TRUE(model->parameters()[i].allclose(
+        reference_model->parameters()[i]));
+  }
+
+  optimizer.disable_fused_step();
+  ASSERT_FALSE(optimizer.fused_step_enabled());
+}
+
 TEST(OptimTest, ExternalVectorOfParameters) {
   torch::manual_seed(0);
 
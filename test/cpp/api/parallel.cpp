@@ -4,6 +4,7 @@
 #include <torch/nn/module.h>
 #include <torch/nn/modules/conv.h>
 #include <torch/nn/modules/linear.h>
+#include <torch/nn/parallel/async.h>
 #include <torch/nn/parallel/data_parallel.h>
 #include <torch/nn/pimpl.h>
 #include <torch/optim/sgd.h>
@@ -12,6 +13,7 @@
 
 #include <test/cpp/api/support.h>
 
+#include <future>
 #include <iostream>
 #include <memory>
 #include <utility>
@@ -291,3 +293,40 @@ TEST_F(ParallelTest, DataParallelNumericalEquivalence_MultiCUDA) {
       }
     }
 }
+
+TEST_F(ParallelTest, ForwardAsync) {
+  Linear linear(3, 4);
+  auto input = torch::ones({2, 3});
+
+  auto future = parallel::forward_async(*linear, input);
+  future->wait();
+  auto output = future->value().toTensor();
+
+  ASSERT_TRUE(output.allclose(linear(input)));
+}
+
+TEST_F(ParallelTest, ForwardAsyncContinuation) {
+  Linear linear(3, 3);
+  auto input = torch::ones({2, 3});
+
+  std::promise<torch::Tensor> chained;
+  auto future = parallel::forward_async(*linear, input);
+  future->addCallback(
+      [&] { chained.set_value(future->value().toTensor() + 1); });
+
+  ASSERT_TRUE(
+      chained.get_future().get().allclose(linear(input) + 1));
+}
+
+TEST_F(ParallelTest, ForwardAsyncPropagatesExceptions) {
+  struct ThrowingModule : torch::nn::Module {
+    torch::Tensor forward(torch::Tensor input) {
+      throw std::runtime_error("Badness!");
+    }
+  };
+
+  ThrowingModule m;
+  auto future = parallel::forward_async(m, torch::ones({1}));
+  future->wait();
+  ASSERT_THROWS_WITH(future->value(), "Badness!");
+}
@@ -0,0 +1,67 @@
+#include <ATen/ATen.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/horizontal_fusion.h>
+#include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+#include <torch/csrc/jit/testing/file_check.h>
+#include "test/cpp/jit/test_base.h"
+
+namespace torch {
+namespace jit {
+
+void testHorizontalFusion() {
+  // Two structurally identical branches applying the same weight to
+  // different inputs, each already packaged as a fusion group.
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %b : Tensor, %w : Tensor):
+  %x1 : Tensor = aten::mul(%a, %w)
+  %y1 : Tensor = aten::tanh(%x1)
+  %x2 : Tensor = aten::mul(%b, %w)
+  %y2 : Tensor = aten::tanh(%x2)
+  return (%y1, %y2)
+  )IR",
+      &*graph);
+
+  // Stacking requires complete input types.
+  for (Value* input : graph->inputs()) {
+    input->setType(TensorType::create(at::rand({4, 5})));
+  }
+
+  std::vector<Node*> muls;
+  std::vector<Node*> tanhs;
+  for (Node* n : graph->nodes()) {
+    if (n->kind() == aten::mul) {
+      muls.push_back(n);
+    } else if (n->kind() == aten::tanh) {
+      tanhs.push_back(n);
+    }
+  }
+  ASSERT_EQ(muls.size(), 2);
+  ASSERT_EQ(tanhs.size(), 2);
+  for (size_t i = 0; i < 2; i++) {
+    Node* group =
+        SubgraphUtils::createSingletonSubgraph(tanhs[i], prim::FusionGroup);
+    SubgraphUtils::mergeNodeIntoSubgraph(muls[i], group);
+  }
+
+  HorizontalFusion(graph);
+  graph->lint();
+
+  // The two groups collapse into one batched group; the differing inputs
+  // are stacked, the shared weight is passed through, and each original
+  // output is a select on the batched result.
+  testing::FileCheck()
+      .check_count("prim::FusionGroup", 1, /*exactly*/ true)
+      ->run(*graph);
+  testing::FileCheck()
+      .check_count("aten::stack", 1, /*exactly*/ true)
+      ->run(*graph);
+  testing::FileCheck()
+      .check_count("aten::select", 2, /*exactly*/ true)
+      ->run(*graph);
+}
+
+} // namespace jit
+} // namespace torch
@@ -1,9 +1,33 @@
 #include "test/cpp/jit/test_base.h"
 #include "test/cpp/jit/test_utils.h"
 
+#include <torch/csrc/jit/ir/irparser.h>
+
 namespace torch {
 namespace jit {
 
+void testInterpreterTupleUnpack() {
+  // TupleConstruct/TupleUnpack execute via dedicated instructions rather
+  // than boxed operator calls; check the round trip through both.
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : int, %b : int):
+  %t : (int, int) = prim::TupleConstruct(%a, %b)
+  %x : int, %y : int = prim::TupleUnpack(%t)
+  %r : int = aten::add(%x, %y)
+  return (%r, %y))IR",
+      &*graph);
+
+  Code code(graph, "");
+  InterpreterState interp(code);
+  Stack stack({IValue(3), IValue(4)});
+  interp.run(stack);
+  ASSERT_EQ(stack.size(), 2);
+  ASSERT_EQ(stack[0].toInt(), 7);
+  ASSERT_EQ(stack[1].toInt(), 4);
+}
+
 void testInterp() {
   constexpr int batch_size = 4;
   constexpr int input_size = 256;
@@ -0,0 +1,81 @@
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/memory_planning.h>
+#include "test/cpp/jit/test_base.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace torch {
+namespace jit {
+
+void testMemoryPlanning() {
+  {
+    // A chain of out-of-place ops: %a dies once %c is produced, so %c can
+    // recycle %a's slot; the graph output %d is never planned.
+    auto graph = std::make_shared<Graph>();
+    std::unordered_map<std::string, Value*> vmap;
+    parseIR(
+        R"IR(
+graph(%x : Tensor):
+  %a : Tensor = aten::relu(%x)
+  %b : Tensor = aten::relu(%a)
+  %c : Tensor = aten::relu(%b)
+  %d : Tensor = aten::relu(%c)
+  return (%d)
+  )IR",
+        &*graph,
+        vmap);
+    auto assignment = PlanMemory(graph);
+    AT_ASSERT(assignment.size() == 3);
+    AT_ASSERT(assignment.count(vmap["d"]) == 0);
+    AT_ASSERT(assignment.at(vmap["a"]) != assignment.at(vmap["b"]));
+    AT_ASSERT(assignment.at(vmap["a"]) == assignment.at(vmap["c"]));
+    AT_ASSERT(vmap["a"]->node()->hasAttribute(Symbol::attr("memory_slots")));
+    AT_ASSERT(!vmap["d"]->node()->hasAttribute(Symbol::attr("memory_slots")));
+  }
+  {
+    // Views and in-place writes must not share buffers: %b aliases %a, so
+    // neither may be planned, and %c is still live when %e is produced.
+    auto graph = std::make_shared<Graph>();
+    std::unordered_map<std::string, Value*> vmap;
+    parseIR(
+        R"IR(
+graph(%x : Tensor, %shape : int[]):
+  %a : Tensor = aten::relu(%x)
+  %b : Tensor = aten::view(%a, %shape)
+  %c : Tensor = aten::relu(%b)
+  %d : Tensor = aten::relu(%c)
+  %e : Tensor = aten::mul(%d, %c)
+  return (%e)
+  )IR",
+        &*graph,
+        vmap);
+    auto assignment = PlanMemory(graph);
+    AT_ASSERT(assignment.count(vmap["a"]) == 0);
+    AT_ASSERT(assignment.count(vmap["b"]) == 0);
+    AT_ASSERT(assignment.at(vmap["c"]) != assignment.at(vmap["d"]));
+  }
+  {
+    // Control flow disables planning entirely, as in memonger.
+    auto graph = std::make_shared<Graph>();
+    parseIR(
+        R"IR(
+graph(%x : Tensor, %cond : bool):
+  %a : Tensor = aten::relu(%x)
+  %b : Tensor = prim::If(%cond)
+    block0():
+      %t : Tensor = aten::relu(%a)
+      -> (%t)
+    block1():
+      -> (%a)
+  %c : Tensor = aten::relu(%b)
+  return (%c)
+  )IR",
+        &*graph);
+    AT_ASSERT(PlanMemory(graph).empty());
+  }
+}
+
+} // namespace jit
+} // namespace torch
@@ -78,6 +78,34 @@ void testModuleConstant() {
   ASSERT_EQ(m.attr(const_name).toInt(), 3);
 }
 
+void testModuleShareReadOnlyTensors() {
+  auto cu = std::make_shared<CompilationUnit>();
+  auto cls = ClassType::create("foo.bar", cu, true);
+  Module m1(cu, cls);
+  Module m2(cu, cls);
+  // two modules with byte-identical weights in separate storages
+  auto w1 = at::ones({4, 4}, at::kFloat);
+  auto w2 = at::ones({4, 4}, at::kFloat);
+  auto distinct = at::zeros({4, 4}, at::kFloat);
+  ASSERT_NE(w1.data_ptr(), w2.data_ptr());
+  m1.register_parameter("weight", w1, /* is_buffer */ false);
+  m1.register_parameter("other", distinct, /* is_buffer */ false);
+  m2.register_parameter("weight", w2, /* is_buffer */ false);
+  m2.register_parameter("other", distinct.clone(), /* is_buffer */ false);
+
+  shareReadOnlyTensors(m1);
+  shareReadOnlyTensors(m2);
+
+  // identical content collapses onto one storage...
+  ASSERT_EQ(
+      m1.attr("weight").toTensor().data_ptr(),
+      m2.attr("weight").toTensor().data_ptr());
+  // ...while different content stays separate
+  ASSERT_NE(
+      m1.attr("weight").toTensor().data_ptr(),
+      m1.attr("other").toTensor().data_ptr());
+}
+
 void testModuleParameter() {
   auto cu = std::make_shared<CompilationUnit>();
   auto cls = ClassType::create("foo.bar", cu, true);
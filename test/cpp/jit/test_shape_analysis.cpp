@@ -0,0 +1,66 @@
+#include "test/cpp/jit/test_base.h"
+
+#include "torch/csrc/jit/ir/irparser.h"
+#include "torch/csrc/jit/passes/shape_analysis.h"
+
+#include <cstdlib>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+std::shared_ptr<Graph> propagateForBatchSize(
+    const std::shared_ptr<Graph>& graph,
+    int64_t batch_size) {
+  auto copy = graph->copy();
+  for (Value* input : copy->inputs()) {
+    input->setType(
+        TensorType::createContiguous(at::kFloat, at::kCPU, {batch_size, 5}));
+  }
+  PropagateInputShapes(copy);
+  return copy;
+}
+
+} // namespace
+
+void testShapePropagationCache() {
+#ifndef _WIN32
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %b : Tensor):
+  %c : Tensor = aten::mul(%a, %b)
+  %d : Tensor = aten::tanh(%c)
+  return (%d))IR",
+      &*graph);
+
+  // Propagate the control copy with the cache disabled.
+  auto reference = propagateForBatchSize(graph, 8);
+
+  setenv("TORCH_JIT_SHAPE_CACHE", "1", /*overwrite=*/1);
+  ClearShapePropagationCache();
+
+  // The first two specs are propagated for real and recorded; the third one
+  // differs only in the batch dimension and is answered from the cache.
+  propagateForBatchSize(graph, 4);
+  propagateForBatchSize(graph, 2);
+  ASSERT_EQ(GetShapePropagationCacheHits(), 0);
+  auto cached = propagateForBatchSize(graph, 8);
+  ASSERT_EQ(GetShapePropagationCacheHits(), 1);
+
+  auto cached_type = cached->outputs().at(0)->type()->expect<TensorType>();
+  auto reference_type =
+      reference->outputs().at(0)->type()->expect<TensorType>();
+  ASSERT_TRUE(*cached_type == *reference_type);
+  ASSERT_EQ(
+      cached_type->sizes().concrete_sizes().value(),
+      std::vector<int64_t>({8, 5}));
+
+  ClearShapePropagationCache();
+  unsetenv("TORCH_JIT_SHAPE_CACHE");
+#endif
+}
+
+} // namespace jit
+} // namespace torch
@@ -33,6 +33,8 @@ namespace jit {
   _(TopologicalIndex)                  \
   _(TopologicalMove)                   \
   _(SubgraphUtils)                     \
+  _(HorizontalFusion)                  \
+  _(ShapePropagationCache)             \
   _(AliasAnalysis)                     \
   _(ContainerAliasing)                 \
   _(AliasRegistration)                 \
@@ -41,6 +43,7 @@ namespace jit {
   _(MemoryDAG)                         \
   _(IRParser)                          \
   _(ConstantPooling)                   \
+  _(MemoryPlanning)                    \
   _(THNNConv)                          \
   _(ATenNativeBatchNorm)               \
   _(NoneSchemaMatch)                   \
@@ -58,6 +61,8 @@ namespace jit {
   _(ModuleCloneInstance)               \
   _(ModuleConstant)                    \
   _(ModuleParameter)                   \
+  _(ModuleShareReadOnlyTensors)        \
+  _(InterpreterTupleUnpack)            \
   _(ModuleDefine)                      \
   _(QualifiedName)                     \
   _(ClassImport)                       \
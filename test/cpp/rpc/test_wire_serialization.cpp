@@ -37,6 +37,66 @@ TEST(WireSerialize, Base) {
   run("more", {torch::randn({5, 5}), torch::rand({10, 10})});
 }
 
+TEST(WireSerialize, Chunked) {
+  auto run = [](const std::string& payload,
+                const std::vector<at::Tensor>& tensors) {
+    std::vector<char> mpayload(payload.begin(), payload.end());
+    auto serialized =
+        torch::distributed::rpc::wireSerializeChunks(mpayload, tensors);
+    const auto& header = serialized.first;
+    const auto& chunks = serialized.second;
+
+    // The chunk sizes announced in the header must match the chunks.
+    auto sizes =
+        torch::distributed::rpc::wireChunkSizes(header.data(), header.size());
+    EXPECT_EQ(sizes.size(), chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      EXPECT_EQ(sizes[i], (size_t)chunks[i].numel());
+      // The chunk must alias existing data, not copy it.
+      EXPECT_EQ(chunks[i].scalar_type(), torch::kChar);
+    }
+
+    // Simulate the receive side: fresh buffers holding the chunk bytes.
+    std::vector<at::Tensor> received;
+    for (const auto& chunk : chunks) {
+      received.push_back(chunk.clone());
+    }
+    auto deser = torch::distributed::rpc::wireDeserializeChunks(
+        header.data(), header.size(), received);
+    EXPECT_EQ(payload.size(), deser.first.size());
+    EXPECT_EQ(tensors.size(), deser.second.size());
+    if (payload.size() > 0) {
+      EXPECT_TRUE(
+          memcmp(deser.first.data(), payload.data(), payload.size()) == 0);
+    }
+    for (size_t i = 0; i < tensors.size(); ++i) {
+      EXPECT_TRUE(torch::equal(tensors[i], deser.second[i]));
+    }
+  };
+  run("", {});
+  run("hi", {});
+  run("", {torch::randn({5, 5})});
+  run("hi", {torch::randn({5, 5})});
+  run("more", {torch::randn({5, 5}), torch::rand({10, 10})});
+  run("empty", {torch::randn({0})});
+}
+
+TEST(WireSerialize, ChunkedAdoptsBuffers) {
+  at::Tensor t = torch::randn({64});
+  auto serialized = torch::distributed::rpc::wireSerializeChunks({}, {t});
+  std::vector<at::Tensor> received;
+  for (const auto& chunk : serialized.second) {
+    received.push_back(chunk.clone());
+  }
+  auto deser = torch::distributed::rpc::wireDeserializeChunks(
+      serialized.first.data(), serialized.first.size(), received);
+  // The deserialized tensor must share storage with the receive buffer
+  // instead of copying out of it.
+  EXPECT_EQ(
+      deser.second[0].storage().data(), received[0].storage().data());
+  EXPECT_TRUE(torch::equal(t, deser.second[0]));
+}
+
 TEST(WireSerialize, RecopySparseTensors) {
   // Take a 1K row of a 1M tensors, and make sure we don't send across 1M rows.
   constexpr size_t k1K = 1024;
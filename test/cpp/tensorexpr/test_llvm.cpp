@@ -1177,6 +1177,26 @@ void testLLVMDynamicShape2D() {
   testWithSize(37, 11);
 }
 
+void testLLVMParallelAdd() {
+  KernelScope kernel_scope;
+  const int N = 1024;
+  Buffer a(VarHandle("A", kHandle), kFloat, {N});
+  Buffer b(VarHandle("B", kHandle), kFloat, {N});
+  Tensor* c = Compute(
+      "c", {{N, "i"}}, [&](const VarHandle& i) { return a(i) + b(i); });
+  LoopNest l({c});
+  std::vector<For*> loops = l.getLoopStmtsFor(c);
+  l.setParallel(loops[0]);
+  l.prepareForCodegen();
+  Stmt* s = l.root_stmt();
+  LLVMCodeGen cg(s, {a, b, c});
+  std::vector<float> aData(N, 1.0f);
+  std::vector<float> bData(N, 2.0f);
+  std::vector<float> cData(N, 0.0f);
+  cg.call({aData, bData, cData});
+  ExpectAllNear(cData, std::vector<float>(N, 3.0f), 1e-7);
+}
+
 } // namespace jit
 } // namespace torch
 
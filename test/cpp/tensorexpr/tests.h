@@ -47,6 +47,8 @@ namespace jit {
   _(ScheduleFuserStyle)               \
   _(ScheduleFuserThreeArg)            \
   _(ScheduleDynamicShape2D)           \
+  _(ScheduleReduceSum2D)              \
+  _(ScheduleReduceFusedProducer)      \
   _(TypeTest01)                       \
   _(TypePropagation)                  \
   _(Cond01)                           \
@@ -240,7 +242,8 @@ namespace jit {
   _(LLVMTensorDynamicShapeAdd)             \
   _(LLVMDynamicShape2D)                    \
   _(LLVMIfThenElseTest)                    \
-  _(LLVMVectorizerLoadStoreTest)
+  _(LLVMVectorizerLoadStoreTest)           \
+  _(LLVMParallelAdd)
 
 #define TH_FORALL_TENSOREXPR_TESTS_CUDA(_) \
   _(CudaTestVectorAdd01)                   \
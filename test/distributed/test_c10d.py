@@ -2466,6 +2466,45 @@ class DistributedDataParallelTest(MultiProcessTestCase):
         except Exception as ex:
             self.fail("Unexpected exception: %s" % ex)
 
+    @requires_gloo()
+    def test_cache_unused_parameters(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        process_group = c10d.ProcessGroupGloo(store, self.rank, self.world_size)
+
+        class UnusedParameterModule(nn.Module):
+            def __init__(self):
+                super(UnusedParameterModule, self).__init__()
+                self.fc1 = nn.Linear(2, 10, bias=False)
+                self.fc2 = nn.Linear(10, 4, bias=False)
+                # Never participates in the forward pass.
+                self.unused = nn.Parameter(torch.ones(2, 2))
+
+            def forward(self, x):
+                return F.softmax(self.fc2(F.relu(self.fc1(x))), dim=1)
+
+        model = DistributedDataParallel(
+            UnusedParameterModule().float(),
+            process_group=process_group,
+            find_unused_parameters=True,
+        )
+        # Memoize the unused parameter set so that iterations after the first
+        # one skip the autograd graph traversal. The usage pattern of this
+        # module is static, so every iteration must keep working and keep
+        # treating `unused` as unused.
+        model.cache_unused_parameters()
+
+        batch_size = 4
+        criterion = nn.CrossEntropyLoss()
+        input = torch.rand([batch_size, 2], dtype=torch.float)
+        target = torch.LongTensor([random.randrange(4) for _ in range(batch_size)])
+
+        for _ in range(3):
+            output = model(input)
+            loss = criterion(output, target)
+            loss.backward()
+            self.assertIsNotNone(model.module.fc1.weight.grad)
+            self.assertIsNotNone(model.module.fc2.weight.grad)
+
     @requires_gloo()
     @skip_if_lt_x_gpu(2)
     def test_global_local_unused_params_grad(self):
@@ -3067,6 +3106,88 @@ class ReducerTest(TestCase):
             output.backward()
             optimizer.step()
 
+    def test_forward_backward_sparse(self):
+        # With a single process the allgather pipeline degenerates to the
+        # identity, so the reduced sparse gradient must match a plain
+        # backward pass.
+        batch_size = 10
+        embedding = nn.EmbeddingBag(10, 10, sparse=True)
+        reference = copy.deepcopy(embedding)
+        parameters = [list(embedding.parameters())]
+        reducer = dist.Reducer(
+            parameters,
+            [[0]],
+            self.process_group,
+            expect_sparse_gradients=[[True]])
+        input = torch.randint(0, 10, [batch_size, 2])
+        output = F.softmax(embedding(input), dim=1).sum()
+        reducer.prepare_for_backward(output)
+        output.backward()
+        F.softmax(reference(input), dim=1).sum().backward()
+        param = next(embedding.parameters())
+        ref = next(reference.parameters())
+        self.assertTrue(param.grad.is_sparse)
+        self.assertEqual(param.grad.to_dense(), ref.grad.to_dense())
+
+    def test_grad_compression_roundtrip(self):
+        # With a single process the allreduce is an identity, so compressed
+        # gradients must round-trip back to the uncompressed ones (exactly
+        # for a full-rank powersgd factorization, up to fp16 resolution for
+        # the fp16 wire format).
+        batch_size = 10
+        for compression, rank, prec in [
+                (dist.GradCompression.FP16, 4, 1e-3),
+                (dist.GradCompression.POWER_SGD, 1000, 1e-5)]:
+            torch.manual_seed(1337)
+            model = ReducerModule()
+            reference = copy.deepcopy(model)
+            parameters = [list(model.parameters())]
+            buckets = [list(range(len(parameters[0])))]
+            reducer = dist.Reducer(parameters, buckets, self.process_group)
+            reducer.set_grad_compression(compression, rank)
+            loss = nn.CrossEntropyLoss()
+            input = torch.rand([batch_size, 2])
+            target = torch.LongTensor(
+                [random.randrange(4) for _ in range(batch_size)])
+            output = loss(model(input), target)
+            reducer.prepare_for_backward(output)
+            output.backward()
+            loss(reference(input), target).backward()
+            for param, ref in zip(model.parameters(), reference.parameters()):
+                self.assertEqual(param.grad, ref.grad, prec)
+
+    def test_rebuild_buckets_by_backward_order(self):
+        batch_size = 10
+        model = ReducerModule()
+        parameters = [list(model.parameters())]
+        buckets = [[i] for i in range(len(parameters[0]))]
+        reducer = dist.Reducer(parameters, buckets, self.process_group)
+        loss = nn.CrossEntropyLoss()
+
+        # Rebuilding without any recorded timing must fail.
+        with self.assertRaises(RuntimeError):
+            reducer.rebuild_buckets_by_backward_order(1024 * 1024)
+
+        input = torch.rand([batch_size, 2])
+        target = torch.LongTensor(
+            [random.randrange(4) for _ in range(batch_size)])
+        output = loss(model(input), target)
+        reducer.prepare_for_backward(output)
+        output.backward()
+
+        # Re-partition from the recorded timing and verify reduction still
+        # produces the same gradients afterwards.
+        reducer.rebuild_buckets_by_backward_order(1024 * 1024)
+        reference = copy.deepcopy(model)
+        for p in model.parameters():
+            p.grad = None
+        output = loss(model(input), target)
+        reducer.prepare_for_backward(output)
+        output.backward()
+        loss(reference(input), target).backward()
+        for param, ref in zip(model.parameters(), reference.parameters()):
+            self.assertEqual(param.grad, ref.grad)
+
 
 class ComputeBucketAssignmentTest(TestCase):
     def test_single_limit_single_dtype(self):
@@ -3362,6 +3483,36 @@ class CommTest(MultiProcessTestCase):
         device = torch.device('cpu')
         self._test_broadcast_coalesced(process_group, device)
 
+    def _test_broadcast_coalesced_pipelined(self, process_group, device, root_rank):
+        target = torch.arange(60, dtype=torch.float32, device=device).chunk(5)
+        target += torch.arange(60, dtype=torch.float64, device=device).chunk(5)
+        target += torch.arange(60, dtype=torch.float32, device=device).chunk(5)
+
+        # The tensors to pass to broadcast are idential to the target
+        # only on the process that is the root of the broadcast.
+        if self.rank == root_rank:
+            tensors = list(tensor.clone() for tensor in target)
+        else:
+            tensors = list(torch.empty_like(tensor) for tensor in target)
+
+        c10d._broadcast_coalesced_pipelined(
+            process_group,
+            tensors,
+            buffer_size=128,
+            root_rank=root_rank)
+
+        self.assertEqual(tensors, target)
+
+    @requires_gloo()
+    def test_broadcast_coalesced_pipelined_gloo_cpu(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        options = c10d.ProcessGroupGloo.Options()
+        options.devices = [c10d.ProcessGroupGloo.create_device(interface=LOOPBACK)]
+        process_group = c10d.ProcessGroupGloo(store, self.rank, self.world_size, options)
+        device = torch.device('cpu')
+        for root_rank in range(self.world_size):
+            self._test_broadcast_coalesced_pipelined(process_group, device, root_rank)
+
 
 if __name__ == '__main__':
     assert not torch.cuda._initialized, "test_distributed must not have initialized CUDA context on main process"
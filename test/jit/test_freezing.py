@@ -5,6 +5,7 @@ from torch.testing._internal.jit_utils import JitTestCase
 from torch.testing import FileCheck
 
 import io
+import unittest
 
 if __name__ == '__main__':
     raise RuntimeError("This test file is not meant to be run directly, use:\n\n"
@@ -600,3 +601,82 @@ class TestFreezing(JitTestCase):
         out3 = smod(inp)
         self.assertNotEqual(out1, out2)
         self.assertEqual(out2, out3)
+
+    @unittest.skipIf(not torch.backends.mkldnn.is_available(), "MKL-DNN build is disabled")
+    def test_freeze_module_mkldnn_prepack_linear(self):
+        class M(nn.Module):
+            def __init__(self):
+                super(M, self).__init__()
+                self.linear = nn.Linear(10, 10)
+
+            def forward(self, x):
+                return self.linear(x)
+
+        m = torch.jit.script(M())
+        m.eval()
+        inp = torch.rand(2, 10)
+        expected = m(inp)
+        mf = torch._C._freeze_module(m._c)
+        torch._C._jit_pass_mkldnn_prepack(mf)
+        graph = mf._get_method('forward').graph
+        FileCheck().check("aten::to_mkldnn") \
+                   .check("aten::mkldnn_linear") \
+                   .check("aten::to_dense") \
+                   .run(graph)
+        # The weight and bias conversions fold away; only the activation
+        # conversion runs per call.
+        self.assertEqual(str(graph).count("aten::to_mkldnn"), 1)
+        self.assertEqual(mf.forward(inp), expected)
+
+    @unittest.skipIf(not torch.backends.mkldnn.is_available(), "MKL-DNN build is disabled")
+    def test_freeze_module_mkldnn_prepack_conv(self):
+        class M(nn.Module):
+            def __init__(self):
+                super(M, self).__init__()
+                self.conv = nn.Conv2d(3, 8, kernel_size=3)
+
+            def forward(self, x):
+                return self.conv(x)
+
+        m = torch.jit.script(M())
+        m.eval()
+        inp = torch.rand(1, 3, 16, 16)
+        expected = m(inp)
+        mf = torch._C._freeze_module(m._c)
+        torch._C._jit_pass_mkldnn_prepack(mf)
+        graph = mf._get_method('forward').graph
+        FileCheck().check("aten::to_mkldnn") \
+                   .check("aten::conv2d") \
+                   .check("aten::to_dense") \
+                   .run(graph)
+        # The weight reorder folds into a pre-packed constant.
+        self.assertTrue("mkldnn_reorder" not in str(graph))
+        self.assertEqual(mf.forward(inp), expected)
+
+    @unittest.skipIf(not torch.backends.mkldnn.is_available(), "MKL-DNN build is disabled")
+    def test_freeze_module_mkldnn_conv_bn_relu_fusion(self):
+        class M(nn.Module):
+            def __init__(self):
+                super(M, self).__init__()
+                self.conv = nn.Conv2d(3, 8, kernel_size=3)
+                self.bn = nn.BatchNorm2d(8)
+
+            def forward(self, x):
+                return nn.functional.relu(self.bn(self.conv(x)))
+
+        m = torch.jit.script(M())
+        m.eval()
+        inp = torch.rand(1, 3, 16, 16)
+        expected = m(inp)
+        mf = torch._C._freeze_module(m._c)
+        torch._C._jit_pass_mkldnn_prepack(mf)
+        graph = mf._get_method('forward').graph
+        # The batch_norm folds into the conv weights and the relu fuses
+        # into the MKL-DNN conv post-op.
+        FileCheck().check("aten::to_mkldnn") \
+                   .check("aten::mkldnn_convolution_relu") \
+                   .check("aten::to_dense") \
+                   .run(graph)
+        self.assertTrue("aten::batch_norm" not in str(graph))
+        self.assertTrue("aten::relu" not in str(graph))
+        self.assertEqual(mf.forward(inp), expected)
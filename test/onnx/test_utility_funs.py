@@ -336,6 +336,28 @@ class TestUtilityFuns(TestCase):
             assert node.kind() != "onnx::Sqrt"
         assert len(list(graph.nodes())) == 1
 
+    def test_deduplicate_initializers(self):
+        class SharedWeightModule(torch.nn.Module):
+            def __init__(self):
+                super(SharedWeightModule, self).__init__()
+                self.fc1 = torch.nn.Linear(3, 3, bias=False)
+                self.fc2 = torch.nn.Linear(3, 3, bias=False)
+                with torch.no_grad():
+                    self.fc2.weight.copy_(self.fc1.weight)
+
+            def forward(self, x):
+                return self.fc1(x) + self.fc2(x)
+
+        x = torch.ones(2, 3)
+        _set_opset_version(self.opset_version)
+        _set_operator_export_type(OperatorExportTypes.ONNX)
+        graph, params_dict, __ = utils._model_to_graph(SharedWeightModule(), (x, ),
+                                                       do_constant_folding=True,
+                                                       operator_export_type=OperatorExportTypes.ONNX)
+        # The two weights have identical contents, so only one initializer
+        # should survive deduplication.
+        assert len(params_dict) == 1
+
     def test_strip_doc_string(self):
         class MyModule(torch.nn.Module):
             def forward(self, input):
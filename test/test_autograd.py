@@ -3286,6 +3286,22 @@ class TestAutograd(TestCase):
         # check one of them is using the computed buffer
         self.assertTrue(p_a == p_g or p_b == p_g)
 
+    def test_grad_layout_contract(self):
+        # accumulated grads should match the layout of the leaf
+        # (see Note [Gradient Layout Contract] in accumulate_grad.h)
+        x = torch.randn(2, 3, 8, 8)
+        w = torch.randn(4, 3, 3, 3).to(memory_format=torch.channels_last)
+        w.requires_grad_()
+        torch.nn.functional.conv2d(x, w, padding=1).sum().backward()
+        self.assertEqual(w.grad.stride(), w.stride())
+        # rowmajor leaf keeps a rowmajor grad
+        w2 = torch.randn(4, 3, 3, 3, requires_grad=True)
+        torch.nn.functional.conv2d(x, w2, padding=1).sum().backward()
+        self.assertEqual(w2.grad.stride(), w2.stride())
+        # accumulating a second backward must not change the layout
+        torch.nn.functional.conv2d(x, w, padding=1).sum().backward()
+        self.assertEqual(w.grad.stride(), w.stride())
+
     def test_no_grad_copy_sparse(self):
         # create autograd function that saves grad pointer as class static
         class MyFunc(Function):
@@ -303,6 +303,138 @@ class TestCuda(TestCase):
                 torch.cuda.caching_allocator_delete(mem)
                 self.assertEqual(torch.cuda.memory_allocated(), prev)
 
+    def test_compact_cache(self):
+        gc.collect()
+        torch.cuda.empty_cache()
+        # Cache one large-pool and one small-pool segment.
+        large = torch.empty(8 * 1024 * 1024, dtype=torch.uint8, device='cuda')
+        small = torch.empty(1024, dtype=torch.uint8, device='cuda')
+        del large, small
+        before = torch.cuda.memory_stats()
+        self.assertGreater(before['reserved_bytes.large_pool.current'], 0)
+        torch.cuda.compact_cache()
+        after = torch.cuda.memory_stats()
+        # Idle large-pool segments are released, the small-block cache stays.
+        self.assertLess(
+            after['reserved_bytes.large_pool.current'],
+            before['reserved_bytes.large_pool.current'])
+        self.assertEqual(
+            after['reserved_bytes.small_pool.current'],
+            before['reserved_bytes.small_pool.current'])
+
+    def test_host_memory_stats(self):
+        before = torch.cuda.host_memory_stats()
+        # Size-class rounding means a slab pinned for one size serves
+        # nearby sizes too.
+        t = torch.empty(3000000).pin_memory()
+        del t
+        t = torch.empty(3500000).pin_memory()
+        after = torch.cuda.host_memory_stats()
+        self.assertGreater(
+            after['num_host_allocs'], before.get('num_host_allocs', -1))
+        self.assertGreater(after['num_reuses'], before.get('num_reuses', -1))
+        self.assertGreater(after['reserved_bytes.current'], 0)
+        self.assertGreaterEqual(
+            after['reserved_bytes.current'], after['allocated_bytes.current'])
+        del t
+
+    def test_cuda_graph_capture_replay(self):
+        version = torch.version.cuda
+        if version is None or [int(v) for v in version.split('.')[:2]] < [10, 2]:
+            raise unittest.SkipTest('CUDA graphs require CUDA >= 10.2')
+        static_in = torch.ones(64, device='cuda')
+        s = torch.cuda.Stream()
+        s.wait_stream(torch.cuda.current_stream())
+        with torch.cuda.stream(s):
+            static_out = static_in * 2  # warmup
+            g = torch.cuda.CUDAGraph()
+            g.capture_begin()
+            static_out = static_in * 2
+            g.capture_end()
+        torch.cuda.current_stream().wait_stream(s)
+
+        # Replays re-execute against the captured buffers.
+        static_in.fill_(3.0)
+        g.replay()
+        torch.cuda.synchronize()
+        self.assertEqual(static_out, torch.full((64,), 6.0, device='cuda'))
+        g.reset()
+
+    def test_foreach_ops(self):
+        for device in ['cpu', 'cuda']:
+            tensors = [torch.randn(n, device=device) for n in (3, 1025, 70000)]
+            refs = [t.clone() for t in tensors]
+            torch._foreach_add_(tensors, 2.5)
+            for t, r in zip(tensors, refs):
+                self.assertEqual(t, r.add(2.5))
+
+            refs = [t.clone() for t in tensors]
+            torch._foreach_mul_(tensors, 0.5)
+            for t, r in zip(tensors, refs):
+                self.assertEqual(t, r.mul(0.5))
+
+            t1 = [torch.randn_like(t) for t in tensors]
+            t2 = [torch.rand_like(t) + 0.5 for t in tensors]
+            refs = [t.clone() for t in tensors]
+            torch._foreach_addcdiv_(tensors, t1, t2, 0.25)
+            for t, r, a, b in zip(tensors, refs, t1, t2):
+                self.assertEqual(t, r.addcdiv(a, b, value=0.25))
+
+            # Non-contiguous inputs take the per-tensor fallback.
+            nc = [torch.randn(4, 6, device=device).t() for _ in range(3)]
+            refs = [t.clone() for t in nc]
+            torch._foreach_add_(nc, 1.0)
+            for t, r in zip(nc, refs):
+                self.assertEqual(t, r.add(1.0))
+
+    def test_matmul_precision_scope(self):
+        self.assertEqual(torch._C._cuda_getBlasMathMode(), 'default')
+        a = torch.randn(64, 64, device='cuda')
+        b = torch.randn(64, 64, device='cuda')
+        expected = a.cpu().mm(b.cpu())
+        with torch.cuda.matmul_precision('fast'):
+            self.assertEqual(torch._C._cuda_getBlasMathMode(), 'fast')
+            self.assertEqual(a.mm(b).cpu(), expected, 1e-1)
+        self.assertEqual(torch._C._cuda_getBlasMathMode(), 'default')
+        with torch.cuda.matmul_precision('precise'):
+            self.assertEqual(
+                a.half().mm(b.half()).float().cpu(), expected, 1e-1)
+        self.assertRaises(
+            RuntimeError, lambda: torch._C._cuda_setBlasMathMode('tf32'))
+
+    def test_scatter_add_index_collisions(self):
+        # Exercises the warp-aggregated atomic path: power-law-style index
+        # distributions send most updates to a few destination rows.
+        for dtype in [torch.float, torch.double, torch.long]:
+            src = torch.arange(1, 10001, device='cuda').to(dtype)
+            idx = torch.zeros(10000, dtype=torch.long, device='cuda')
+            idx[5000:] = torch.randint(10, (5000,), device='cuda')
+            out = torch.zeros(10, device='cuda', dtype=dtype)
+            out.scatter_add_(0, idx, src)
+            expected = torch.zeros(10, dtype=dtype).scatter_add_(
+                0, idx.cpu(), src.cpu())
+            self.assertEqual(out.cpu(), expected)
+
+            out = torch.zeros(10, 4, device='cuda', dtype=dtype)
+            out.index_add_(0, idx[:100], src[:400].view(100, 4))
+            expected = torch.zeros(10, 4, dtype=dtype).index_add_(
+                0, idx[:100].cpu(), src[:400].view(100, 4).cpu())
+            self.assertEqual(out.cpu(), expected)
+
+    def test_async_item(self):
+        x = torch.full((4, 4), 2.5, device='cuda')
+        fut = torch.cuda.async_item(x.sum())
+        self.assertEqual(fut.value(), 40.0)
+        self.assertTrue(fut.query())
+
+        # Deferred logging pattern: resolve a batch of futures later.
+        futs = [torch.cuda.async_item(torch.tensor([float(i)], device='cuda'))
+                for i in range(5)]
+        self.assertEqual([f.value() for f in futs], [0.0, 1.0, 2.0, 3.0, 4.0])
+
+        self.assertRaises(ValueError, lambda: torch.cuda.async_item(torch.ones(2, device='cuda')))
+        self.assertRaises(ValueError, lambda: torch.cuda.async_item(torch.ones(())))
+
     def test_cuda_get_device_name(self):
         # Testing the behaviour with None as an argument
         current_device = torch.cuda.current_device()
@@ -901,6 +901,8 @@ class TestDataLoader(TestCase):
             DataLoader(self.dataset, num_workers=-1)
         with self.assertRaisesRegex(ValueError, "timeout option should be non-negative"):
             DataLoader(self.dataset, timeout=-1)
+        with self.assertRaisesRegex(ValueError, "persistent_workers option needs num_workers > 0"):
+            DataLoader(self.dataset, persistent_workers=True)
 
 
         # disable auto-batching
@@ -1154,6 +1156,37 @@ class TestDataLoader(TestCase):
                 self.assertEqual(
                     reference, list(DataLoader(ds_cls(counting_ds_n), multiprocessing_context=ctx, **dl_common_args)))
 
+    def test_persistent_workers(self):
+        loader = DataLoader(
+            self.dataset, batch_size=2, num_workers=2, persistent_workers=True)
+        it = iter(loader)
+        worker_pids = [w.pid for w in it._workers]
+        for epoch in range(3):
+            # The same iterator (and thus the same worker processes) is reused
+            # across epochs; only its per-epoch state is reset.
+            epoch_it = iter(loader)
+            self.assertIs(epoch_it, it)
+            self.assertEqual([w.pid for w in epoch_it._workers], worker_pids)
+            fetched = 0
+            for sample, target in epoch_it:
+                fetched += sample.size(0)
+            self.assertEqual(fetched, len(self.dataset))
+            self.assertTrue(all(w.is_alive() for w in it._workers))
+
+    def test_persistent_workers_iterable_dataset(self):
+        # Workers exhaust their IterableDataset shards at different times; with
+        # persistent workers they must come back for the next epoch.
+        dataset = CountingIterableDataset(11)
+        loader = DataLoader(
+            dataset, batch_size=3, num_workers=2, persistent_workers=True)
+        # Each worker replica naively yields the full range (see NOTE
+        # [ Custom Samplers and IterableDataset ]), so every value shows up
+        # once per worker, every epoch.
+        expected = sorted(list(range(11)) * 2)
+        for epoch in range(2):
+            fetched = sorted(int(x) for batch in loader for x in batch)
+            self.assertEqual(fetched, expected)
+
     def test_worker_seed(self):
         num_workers = 6
         batch_size = 1
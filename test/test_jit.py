@@ -405,6 +405,33 @@ class TestJit(JitTestCase):
         files = zipfile.ZipFile(buf).filelist
         self.assertTrue(any(['archive/constants.pkl' == f.filename for f in files]))
 
+    def test_guard_free_streak(self):
+        old_exec = torch._C._jit_set_profiling_executor(True)
+        old_mode = torch._C._jit_set_profiling_mode(True)
+        old_streak = torch._C._jit_set_guard_free_streak(2)
+        try:
+            @torch.jit.script
+            def foo(x, y):
+                return torch.tanh(x) + y
+
+            x = torch.randn(4, 4)
+            y = torch.randn(4, 4)
+            expected = torch.tanh(x) + y
+            with torch.no_grad():
+                # profiling runs, then the guarded plan, then the guard-free
+                # tier once the input spec has been stable for two runs
+                for _ in range(6):
+                    self.assertEqual(foo(x, y), expected)
+                # a different spec falls back to the guarded plan
+                x2 = torch.randn(2, 8)
+                y2 = torch.randn(2, 8)
+                self.assertEqual(foo(x2, y2), torch.tanh(x2) + y2)
+                self.assertEqual(foo(x, y), expected)
+        finally:
+            torch._C._jit_set_guard_free_streak(old_streak)
+            torch._C._jit_set_profiling_executor(old_exec)
+            torch._C._jit_set_profiling_mode(old_mode)
+
     def test_trace_nested_fn(self):
         class TracedInlineDecision(torch.nn.Module):
             def forward(self, x, flag):
@@ -7488,6 +7515,28 @@ a")
             # this triggers 2 bailouts
             self.assertEqual(def_in_one_branch(a, True), 3.0)
 
+    @unittest.skipIf(GRAPH_EXECUTOR != ProfilingMode.PROFILING, "skip if profiling isn't enabled")
+    def test_profiled_loop_unrolling(self):
+        @torch.jit.script
+        def repeat(x, n):
+            # type: (Tensor, int) -> Tensor
+            y = x
+            for _ in range(n):
+                y = y + x
+            return y
+
+        a = torch.rand(3)
+
+        with enable_profiling_mode():
+            # the profiling run observes n == 4, so the optimized graph gets
+            # a fully unrolled copy guarded by a check on the trip count
+            repeat(a, 4)
+            opt_graph_str = str(repeat.graph_for(a, 4))
+            FileCheck().check("aten::eq").check("prim::If").run(opt_graph_str)
+            self.assertEqual(repeat(a, 4), a * 5)
+            # other trip counts take the fallback loop
+            self.assertEqual(repeat(a, 2), a * 3)
+            self.assertEqual(repeat(a, 0), a)
 
     @unittest.skipIf(GRAPH_EXECUTOR != ProfilingMode.PROFILING, "skip if profiling isn't enabled")
     def test_maxpool_guard_elimination(self):
@@ -13527,6 +13576,62 @@ a")
             self.assertEqual(torch.autograd.grad(sout.sum(), inputs),
                              torch.autograd.grad(out.sum(), inputs))
 
+    def test_mm_group_batching(self):
+        def grouped(a, b, c, d, e, f, g, h):
+            return a.mm(b), c.mm(d), e.mm(f), g.mm(h)
+
+        sgrouped = torch.jit.script(grouped)
+
+        inputs = []
+        for i in range(4):
+            inputs += [torch.randn(2, 3), torch.randn(3, 4)]
+
+        sout = sgrouped(*inputs)
+        if GRAPH_EXECUTOR == ProfilingMode.LEGACY:
+            self.assertTrue('prim::MMBatchGroup' in str(sgrouped.graph_for(*inputs)))
+        self.assertEqual(sout, grouped(*inputs))
+
+    def test_fork_independent_branches(self):
+        def two_tower(a, b):
+            x = a.mm(a)
+            x = x.mm(x)
+            y = b.mm(b)
+            y = y.mm(y)
+            return x + y
+
+        scripted = torch.jit.script(two_tower)
+        graph = scripted.graph.copy()
+        self.run_pass('fork_independent_branches', graph)
+        FileCheck().check("prim::fork").check("aten::wait").run(str(graph))
+        forked = torch._C._create_function_from_graph("two_tower_forked", graph)
+        a, b = torch.randn(4, 4), torch.randn(4, 4)
+        self.assertEqual(forked(a, b), two_tower(a, b))
+
+    def test_fork_independent_branches_mutation(self):
+        def mutating(a, b):
+            x = a.mm(a)
+            b.add_(1)
+            y = b.mm(b)
+            return x + y
+
+        graph = torch.jit.script(mutating).graph.copy()
+        self.run_pass('fork_independent_branches', graph)
+        # a graph with mutation must be left untouched
+        self.assertNotIn('prim::fork', str(graph))
+
+    def test_plan_cache_stable_across_shapes(self):
+        # ArgumentSpec keys execution plans by shape class (dimensionality),
+        # not concrete sizes, so varying sequence lengths must all reuse one
+        # plan. See Note [ArgumentSpec shape classes] in argument_spec.h.
+        @torch.jit.script
+        def seq(x):
+            return torch.mm(x, x.t()) + 1
+
+        for length in [3, 5, 8, 13, 21, 34]:
+            seq(torch.randn(length, 4))
+        if GRAPH_EXECUTOR == ProfilingMode.LEGACY:
+            self.assertEqual(len(seq.get_debug_state().execution_plans), 1)
+
     def test_loop_unrolling(self):
         def fn(x):
             y = 0
@@ -33,7 +33,7 @@ from torch.testing._internal.common_quantization import QuantizationTestCase, \
     ModelWithFunctionals, \
     test_only_eval_fn, test_only_train_fn, \
     prepare_dynamic, convert_dynamic, SingleLayerLinearDynamicModel, \
-    TwoLayerLinearModel, NestedModel, ResNetBase, LSTMDynamicModel, \
+    TwoLayerLinearModel, NestedModel, ResNetBase, LSTMDynamicModel, GRUDynamicModel, \
     ModelWithNoQconfigPropagation
 
 from torch.testing._internal.common_quantization import AnnotatedTwoLayerLinearModel, AnnotatedNestedModel, \
@@ -778,6 +778,106 @@ class PostTrainingDynamicQuantTest(QuantizationTestCase):
 
             y, (h, c) = cell_dq(x, (h, c))
 
+    @given(qengine=st.sampled_from(("fbgemm",)))
+    def test_quantized_gru(self, qengine):
+        d_in, d_hid = 2, 2
+
+        # TODO: qlinear_prepack_fp16 currently doesn't support QNNPACK
+        # re-add "qnnpack" to the engine set when this is supported
+
+        with override_quantized_engine(qengine):
+            model = GRUDynamicModel().eval()
+            cell = model.gru
+
+            ref = copy.deepcopy(cell)
+
+            model_int8 = quantize_dynamic(model=model, dtype=torch.qint8)
+            model_fp16 = quantize_dynamic(model=model, dtype=torch.float16)
+
+            # Smoke test extra reprs
+            self.assertTrue('DynamicQuantizedGRU' in str(model_int8))
+            self.assertTrue('DynamicQuantizedGRU' in str(model_fp16))
+            cell_int8 = model_int8.gru
+            cell_fp16 = model_fp16.gru
+
+            assert type(cell_int8) == torch.nn.quantized.dynamic.GRU, \
+                'torch.nn.GRU should be converted to torch.nn.quantized.dynamic.GRU after quantize_dynamic'
+            assert type(cell_fp16) == torch.nn.quantized.dynamic.GRU, \
+                'torch.nn.GRU should be converted to torch.nn.quantized.dynamic.GRU after quantize_dynamic'
+
+            niter = 10
+            x = torch.tensor([[100, -155],
+                              [-155, 100],
+                              [100, -155]], dtype=torch.float).unsqueeze(0).repeat(niter, 1, 1)
+
+            h0_vals = [[-155, 100],
+                       [-155, 155],
+                       [100, -155]]
+
+            hx = torch.tensor(h0_vals, dtype=torch.float).unsqueeze(0)
+
+            ref_out, ref_hid = ref(x, hx)
+
+            # Unlike the LSTM test above we cannot engineer exactly
+            # representable weights here, because the recurrent hidden state
+            # takes arbitrary values after the first timestep; compare with a
+            # tolerance commensurate with int8 dynamic activation
+            # quantization instead.
+            output_int8, final_hidden_int8 = cell_int8(x, hx)
+            torch.testing.assert_allclose(output_int8, ref_out, rtol=0.1, atol=0.1)
+            torch.testing.assert_allclose(final_hidden_int8, ref_hid, rtol=0.1, atol=0.1)
+
+            output_fp16, final_hidden_fp16 = cell_fp16(x, hx)
+            torch.testing.assert_allclose(output_fp16, ref_out, rtol=0.1, atol=0.1)
+            torch.testing.assert_allclose(final_hidden_fp16, ref_hid, rtol=0.1, atol=0.1)
+
+            class ScriptWrapper(torch.nn.Module):
+                def __init__(self, cell):
+                    super(ScriptWrapper, self).__init__()
+                    self.cell = cell
+
+                def forward(self, x, hx):
+                    # type: (torch.Tensor, torch.Tensor) -> Tuple[torch.Tensor, torch.Tensor]
+                    return self.cell(x, hx)
+
+            # TODO: TorchScript overloads don't work without this wrapper
+            cell_script = torch.jit.script(ScriptWrapper(cell_int8))
+            out_script, hid_script = cell_script(x, hx)
+            torch.testing.assert_allclose(out_script, output_int8)
+            torch.testing.assert_allclose(hid_script, final_hidden_int8)
+
+            # Test save/load
+            b = io.BytesIO()
+            torch.jit.save(cell_script, b)
+            b.seek(0)
+            loaded = torch.jit.load(b)
+            out_loaded, hid_loaded = loaded(x, hx)
+            torch.testing.assert_allclose(out_loaded, output_int8)
+            torch.testing.assert_allclose(hid_loaded, final_hidden_int8)
+
+            # Test default instantiation
+            seq_len = 128
+            batch = 16
+            input_size = 3
+            hidden_size = 7
+            num_layers = 2
+            bias = True
+            bidirectional = False
+
+            x = torch.rand(seq_len, batch, input_size)
+            h = torch.rand(num_layers * (bidirectional + 1), batch, hidden_size)
+
+            cell_dq = torch.nn.quantized.dynamic.GRU(input_size=input_size,
+                                                     hidden_size=hidden_size,
+                                                     num_layers=num_layers,
+                                                     bias=bias,
+                                                     batch_first=False,
+                                                     dropout=0.0,
+                                                     bidirectional=bidirectional,
+                                                     dtype=torch.qint8)
+
+            y, h = cell_dq(x, h)
+
 
 @unittest.skipUnless('fbgemm' in torch.backends.quantized.supported_engines,
                      " Quantized operations require FBGEMM. FBGEMM is only optimized for CPUs"
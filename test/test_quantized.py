@@ -91,6 +91,42 @@ def pool_output_shape(input_size, kernel_size, padding, stride,
 
 class TestQuantizedOps(TestCase):
 
+    """Tests the correctness of the quantized::embedding_bag_byte_* ops."""
+    def test_embedding_bag_byte_rowwise_offsets(self):
+        weight = torch.randn(10, 16, dtype=torch.float32)
+        packed = torch.ops.quantized.embedding_bag_byte_prepack(weight)
+        # each row gains 4 bytes of scale and 4 bytes of bias
+        self.assertEqual(packed.shape, torch.Size([10, 24]))
+        unpacked = torch.ops.quantized.embedding_bag_byte_unpack(packed)
+        # row-wise 8-bit quantization error is bounded by the row range / 255
+        err_bound = (weight.max(dim=1)[0] - weight.min(dim=1)[0]) / 255.0
+        self.assertTrue(
+            ((unpacked - weight).abs() <= err_bound.unsqueeze(1) + 1e-6).all())
+
+        # int32 indices/offsets take the 32-bit perfkernels specialization
+        for index_dtype in (torch.int64, torch.int32):
+            indices = torch.tensor([0, 1, 2, 5, 9, 3], dtype=index_dtype)
+            offsets = torch.tensor([0, 2, 5], dtype=index_dtype)
+            result = torch.ops.quantized.embedding_bag_byte_rowwise_offsets(
+                packed, indices, offsets)
+            reference = F.embedding_bag(
+                indices.long(), unpacked, offsets.long(), mode='sum')
+            self.assertEqual(result, reference)
+
+        indices = torch.tensor([0, 1, 2, 5, 9, 3], dtype=torch.int64)
+
+        # weighted sum with an explicit final offset
+        psw = torch.rand(indices.numel(), dtype=torch.float32)
+        offsets_with_last = torch.tensor([0, 2, indices.numel()],
+                                         dtype=torch.int64)
+        result = torch.ops.quantized.embedding_bag_byte_rowwise_offsets(
+            packed, indices, offsets_with_last,
+            per_sample_weights=psw, include_last_offset=True)
+        reference = F.embedding_bag(
+            indices, unpacked, torch.tensor([0, 2], dtype=torch.int64),
+            mode='sum', per_sample_weights=psw)
+        self.assertEqual(result, reference)
+
     """Tests the correctness of the quantized::relu op."""
     @given(X=hu.tensor(shapes=hu.array_shapes(1, 5, 1, 5),
                        qparams=hu.qparams()))
@@ -528,6 +564,60 @@ class TestQuantizedOps(TestCase):
             self.assertEqual(qCrelu_hat, qCrelu_out_hat,
                              message="AddReLU.out failed")
 
+    """Tests the correctness of the fused add_clamp op (add + relu6/clamp)."""
+    def test_qadd_clamp(self):
+        for dtype in [torch.quint8, torch.qint8, torch.qint32]:
+            add_clamp = torch.ops.quantized.add_clamp
+
+            A = torch.arange(-128, 130, dtype=torch.float) * 0.05
+            B = torch.arange(-128, 130, dtype=torch.float) * 0.05
+            scale = 0.125
+            zero_point = 2
+            qA = torch.quantize_per_tensor(A, scale=scale, zero_point=zero_point,
+                                           dtype=dtype)
+            qB = torch.quantize_per_tensor(B, scale=scale, zero_point=zero_point,
+                                           dtype=dtype)
+
+            C = (qA.dequantize() + qB.dequantize()).numpy()
+            # NB: the clamp bounds are exactly representable in the output
+            # scale, so clamping in the quantized domain (what the kernel
+            # does) agrees with clamping before quantization.
+            for (min_val, max_val) in [(0.0, 6.0), (-2.0, 2.0)]:
+                Cclamp = np.clip(C, min_val, max_val)
+                qCclamp = _quantize(Cclamp, scale, zero_point,
+                                    dtype=np_dtype[dtype])
+                qCclamp_hat = add_clamp(qA, qB, scale=scale,
+                                        zero_point=zero_point,
+                                        min=min_val, max=max_val)
+                np.testing.assert_equal(qCclamp, qCclamp_hat.int_repr(),
+                                        "Quantized addition with clamp failed.")
+
+    """Tests that the auto engine gives correct results on every call while
+    it alternates backends to collect timings."""
+    def test_qadd_auto_engine(self):
+        if 'auto' not in torch.backends.quantized.supported_engines:
+            return
+        with override_quantized_engine('auto'):
+            A = torch.rand(4, 16, dtype=torch.float)
+            B = torch.rand(4, 16, dtype=torch.float)
+            scale = 0.05
+            zero_point = 2
+            qA = torch.quantize_per_tensor(A, scale=scale,
+                                           zero_point=zero_point,
+                                           dtype=torch.quint8)
+            qB = torch.quantize_per_tensor(B, scale=scale,
+                                           zero_point=zero_point,
+                                           dtype=torch.quint8)
+            C_ref = _quantize((qA.dequantize() + qB.dequantize()).numpy(),
+                              scale, zero_point)
+            # Enough iterations to cover both sampling phases and the cached
+            # choice; all of them must agree with the reference.
+            for _ in range(10):
+                qC = torch.ops.quantized.add(qA, qB, scale=scale,
+                                             zero_point=zero_point)
+                np.testing.assert_equal(C_ref, qC.int_repr().numpy(),
+                                        "Quantized add under auto engine failed.")
+
     """Tests the correctness of the mul and mul_relu op."""
     def test_qmul_relu_same_qparams(self):
         for dtype in [torch.quint8, torch.qint8, torch.qint32]:
@@ -639,6 +729,34 @@ class TestQuantizedOps(TestCase):
             self.assertEqual(qCrelu_hat, qCrelu_out_hat,
                              message="mulReLU.out failed")
 
+    """Tests the correctness of the fused mul_clamp op (mul + relu6/clamp)."""
+    def test_qmul_clamp(self):
+        for dtype in [torch.quint8, torch.qint8, torch.qint32]:
+            mul_clamp = torch.ops.quantized.mul_clamp
+
+            A = torch.arange(-128, 130, dtype=torch.float) * 0.05
+            B = torch.arange(-128, 130, dtype=torch.float) * 0.05
+            scale = 0.125
+            zero_point = 2
+            qA = torch.quantize_per_tensor(A, scale=scale, zero_point=zero_point,
+                                           dtype=dtype)
+            qB = torch.quantize_per_tensor(B, scale=scale, zero_point=zero_point,
+                                           dtype=dtype)
+
+            C = (qA.dequantize() * qB.dequantize()).numpy()
+            # NB: the clamp bounds are exactly representable in the output
+            # scale, so clamping in the quantized domain (what the kernel
+            # does) agrees with clamping before quantization.
+            for (min_val, max_val) in [(0.0, 6.0), (-2.0, 2.0)]:
+                Cclamp = np.clip(C, min_val, max_val)
+                qCclamp = _quantize(Cclamp, scale, zero_point,
+                                    dtype=np_dtype[dtype])
+                qCclamp_hat = mul_clamp(qA, qB, scale=scale,
+                                        zero_point=zero_point,
+                                        min=min_val, max=max_val)
+                np.testing.assert_equal(qCclamp, qCclamp_hat.int_repr(),
+                                        "Quantized multiplication with clamp failed.")
+
     """Tests the correctness of the mul and mul_relu op."""
     def test_qmul_broadcast(self):
         mul_relu = torch.ops.quantized.mul_relu
@@ -1455,6 +1573,56 @@ class TestQuantizedOps(TestCase):
             quantize_ref = torch.quantize_per_tensor(float_ref, Y_scale, Y_zero_point, dtype_x)
             self.assertEqual(qy.int_repr().numpy(), quantize_ref.int_repr().numpy())
 
+    """Tests quantized::layer_norm against a dequantize/fp32/requantize ref."""
+    @given(X=hu.tensor(shapes=hu.array_shapes(min_dims=2, max_dims=4,
+                                              min_side=1, max_side=16),
+                       qparams=hu.qparams()),
+           Y_scale=st.floats(0.2, 2.6),
+           Y_zero_point=st.integers(0, 5))
+    def test_qlayer_norm(self, X, Y_scale, Y_zero_point):
+        X, (scale_x, zero_point_x, dtype_x) = X
+
+        X = torch.from_numpy(X)
+        normalized_shape = list(X.shape[1:])
+        weight = torch.rand(*normalized_shape).float()
+        bias = torch.rand(*normalized_shape).float()
+        eps = 0.001
+        qx = torch.quantize_per_tensor(X, scale_x, zero_point_x, dtype_x)
+        qy = torch.ops.quantized.layer_norm(
+            qx, normalized_shape, weight, bias, eps, Y_scale, Y_zero_point)
+
+        float_ref = F.layer_norm(qx.dequantize(), normalized_shape,
+                                 weight=weight, bias=bias, eps=eps)
+        quantize_ref = torch.quantize_per_tensor(
+            float_ref, Y_scale, Y_zero_point, dtype_x)
+        # The statistics are accumulated in a different order than the fp32
+        # reference, so allow off-by-one rounding in the quantized output.
+        np.testing.assert_array_almost_equal(
+            qy.int_repr().numpy(), quantize_ref.int_repr().numpy(), decimal=0)
+
+    """Tests quantized::softmax against a dequantize/fp32/requantize ref."""
+    @given(X=hu.tensor(shapes=hu.array_shapes(min_dims=2, max_dims=4,
+                                              min_side=1, max_side=16),
+                       qparams=hu.qparams(dtypes=[torch.quint8, torch.qint8])),
+           dim=st.integers(-1, 1))
+    def test_qsoftmax(self, X, dim):
+        X, (scale_x, zero_point_x, dtype_x) = X
+
+        X = torch.from_numpy(X)
+        # Softmax output is in [0, 1]; use the standard affine mapping for it.
+        Y_scale = 1.0 / 256
+        Y_zero_point = -128 if dtype_x == torch.qint8 else 0
+        qx = torch.quantize_per_tensor(X, scale_x, zero_point_x, dtype_x)
+        qy = torch.ops.quantized.softmax(qx, dim, Y_scale, Y_zero_point)
+
+        float_ref = torch.softmax(qx.dequantize(), dim)
+        quantize_ref = torch.quantize_per_tensor(
+            float_ref, Y_scale, Y_zero_point, dtype_x)
+        # exp() and the row sums are evaluated in a different order than the
+        # fp32 reference, so allow off-by-one rounding.
+        np.testing.assert_array_almost_equal(
+            qy.int_repr().numpy(), quantize_ref.int_repr().numpy(), decimal=0)
+
     @unittest.skip("Takes 20+ min to finish in many configurations")
     @given(X=hu.tensor(shapes=hu.array_shapes(min_dims=4, max_dims=5,
                                               min_side=1, max_side=32),
@@ -2160,6 +2328,91 @@ class TestQuantizedConv(unittest.TestCase):
                 dilations, X_scale, X_zero_point, W_scale, W_zero_point,
                 Y_scale, Y_zero_point, use_bias, use_relu, use_channelwise)
 
+    """Tests quantized convolution on small feature maps, which takes the
+    direct (non-im2col) path on the fbgemm engine."""
+    @given(batch_size=st.integers(1, 3),
+           input_channels_per_group=st.sampled_from([2, 4, 5, 8, 16]),
+           height=st.integers(1, 7),
+           width=st.integers(1, 7),
+           output_channels_per_group=st.sampled_from([2, 4, 5, 8, 16]),
+           groups=st.integers(1, 3),
+           kernel_h=st.integers(1, 3),
+           kernel_w=st.integers(1, 3),
+           stride_h=st.integers(1, 2),
+           stride_w=st.integers(1, 2),
+           pad_h=st.integers(0, 2),
+           pad_w=st.integers(0, 2),
+           dilation=st.integers(1, 2),
+           X_scale=st.floats(1.2, 1.6),
+           X_zero_point=st.integers(0, 4),
+           W_scale=st.lists(st.floats(0.2, 1.6), min_size=1, max_size=2),
+           W_zero_point=st.lists(st.integers(-5, 5), min_size=1, max_size=2),
+           Y_scale=st.floats(4.2, 5.6),
+           Y_zero_point=st.integers(0, 4),
+           use_bias=st.booleans(),
+           use_relu=st.booleans(),
+           use_channelwise=st.booleans(),
+           qengine=st.sampled_from(("fbgemm",)))
+    def test_qconv_small_spatial(
+            self,
+            batch_size,
+            input_channels_per_group,
+            height,
+            width,
+            output_channels_per_group,
+            groups,
+            kernel_h,
+            kernel_w,
+            stride_h,
+            stride_w,
+            pad_h,
+            pad_w,
+            dilation,
+            X_scale,
+            X_zero_point,
+            W_scale,
+            W_zero_point,
+            Y_scale,
+            Y_zero_point,
+            use_bias,
+            use_relu,
+            use_channelwise,
+            qengine
+    ):
+        if qengine not in torch.backends.quantized.supported_engines:
+            return
+        # The output map must be non-empty.
+        assume(height + 2 * pad_h >= dilation * (kernel_h - 1) + 1)
+        assume(width + 2 * pad_w >= dilation * (kernel_w - 1) + 1)
+
+        input_channels = input_channels_per_group * groups
+        output_channels = output_channels_per_group * groups
+        kernels = (kernel_h, kernel_w)
+        strides = (stride_h, stride_w)
+        pads = (pad_h, pad_w)
+        dilations = (dilation, dilation)
+
+        with override_quantized_engine(qengine):
+            qconv = torch.ops.quantized.conv2d
+            if use_relu:
+                qconv = torch.ops.quantized.conv2d_relu
+            qconv_prepack = torch.ops.quantized.conv2d_prepack
+            conv_op = torch.nn.Conv2d(
+                input_channels,
+                output_channels,
+                kernels,
+                strides,
+                pads,
+                dilations,
+                groups,
+            )
+            self._test_qconv_impl(
+                qconv, qconv_prepack, conv_op, batch_size,
+                input_channels_per_group, (height, width),
+                output_channels_per_group, groups, kernels, strides, pads,
+                dilations, X_scale, X_zero_point, W_scale, W_zero_point,
+                Y_scale, Y_zero_point, use_bias, use_relu, use_channelwise)
+
     """Tests the correctness of the quantized::qconv_unpack op."""
     @given(
         inputs=hu.tensor_conv(
@@ -68,6 +68,38 @@ class TestTensorExprFuser(BaseTestClass):
         )
 
 
+    def test_channels_last(self):
+        llvm_executed = LLVMCodeGenExecuted()
+        simple_ir_eval_executed = SimpleIREvalExecuted()
+
+        def easy(x, y, z):
+            aaa = torch.mul(x, y)
+            bbb = torch.add(aaa, z)
+            return bbb
+
+        shape = (2, 8, 4, 4)
+        inputs = [
+            torch.rand(shape).to(memory_format=torch.channels_last)
+            for _ in range(3)
+        ]
+        traced = torch.jit.trace(easy, tuple(inputs))
+
+        a, b, c = [
+            torch.rand(shape).to(memory_format=torch.channels_last)
+            for _ in range(3)
+        ]
+        x = traced(a, b, c)
+        npr = a.numpy() * b.numpy() + c.numpy()
+        np.testing.assert_allclose(npr, x.numpy())
+        # The fused kernel should produce the output directly in
+        # channels-last rather than forcing a layout conversion.
+        assert x.is_contiguous(memory_format=torch.channels_last)
+        assert (
+            llvm_executed.elapsed_value() >= 1
+            or simple_ir_eval_executed.elapsed_value() >= 1
+        )
+
+
     def test_four_arg(self):
         def run_addcmul(x, y, z, w):
             c = torch.addcmul(torch.add(x, y), z, w)
@@ -604,6 +604,26 @@ class _TestTorchMixin(object):
     def test_min(self):
         self._testSelection(torch.min, min)
 
+    def test_min_max_fused(self):
+        for dtype in (torch.float, torch.double, torch.int64, torch.int32):
+            x = torch.arange(-100, 101).to(dtype)[torch.randperm(201)]
+            min_res, max_res = torch._min_max(x)
+            self.assertEqual(min_res, x.min())
+            self.assertEqual(max_res, x.max())
+        x = torch.tensor([True, False, True])
+        min_res, max_res = torch._min_max(x)
+        self.assertEqual(min_res.item(), False)
+        self.assertEqual(max_res.item(), True)
+
+    def test_reduction_stats_fused(self):
+        for dtype in (torch.float, torch.double):
+            x = torch.randn(1001, dtype=dtype)
+            sum_res, sum_sq_res, min_res, max_res = torch._reduction_stats(x)
+            self.assertEqual(sum_res, x.sum())
+            self.assertEqual(sum_sq_res, (x * x).sum())
+            self.assertEqual(min_res, x.min())
+            self.assertEqual(max_res, x.max())
+
     def test_dim_reduction_uint8_overflow(self):
         example = [[-1, 2, 1], [5, 3, 6]]
         x = torch.tensor(example, dtype=torch.uint8)
@@ -1900,6 +1920,33 @@ class _TestTorchMixin(object):
         self.assertIsOrdered('descending', x, res2val, res2ind,
                              'random with NaNs')
 
+    def test_sort_large_1d(self):
+        # large contiguous 1-d sorts take the parallel radix sort path
+        for dtype in (torch.float, torch.double, torch.int64, torch.int32, torch.uint8):
+            if dtype.is_floating_point:
+                x = torch.randn(10000).to(dtype)
+            else:
+                x = torch.randint(0, 250, (10000,)).to(dtype)
+            for descending in (False, True):
+                resval, resind = torch.sort(x, descending=descending)
+                expected, _ = torch.sort(x.view(1, -1), descending=descending)
+                self.assertEqual(resval, expected.view(-1))
+                self.assertEqual(x[resind], resval)
+
+    def test_topk_large_1d(self):
+        # large 1-d inputs take the parallel block-select topk path
+        x = torch.randn(100000)
+        for largest in (True, False):
+            for sorted_ in (True, False):
+                values, indices = x.topk(100, largest=largest, sorted=sorted_)
+                expected, _ = x.sort(descending=largest)
+                expected = expected[:100]
+                if not sorted_:
+                    values, order = values.sort(descending=largest)
+                    indices = indices[order]
+                self.assertEqual(values, expected)
+                self.assertEqual(x[indices], values)
+
     def test_topk(self):
         def topKViaSort(t, k, dim, dir):
             sorted, indices = t.sort(dim, dir)
@@ -46,6 +46,11 @@ libtorch_sources = [
     "torch/csrc/autograd/functions/tensor.cpp",
     "torch/csrc/autograd/functions/utils.cpp",
     "torch/csrc/autograd/input_buffer.cpp",
+    "torch/csrc/autograd/kernel_attribution.cpp",
+    "torch/csrc/autograd/latency_histogram.cpp",
+    "torch/csrc/autograd/memory_profiler.cpp",
+    "torch/csrc/autograd/op_replay_log.cpp",
+    "torch/csrc/autograd/perf_counters.cpp",
     "torch/csrc/autograd/profiler.cpp",
     "torch/csrc/autograd/record_function.cpp",
     "torch/csrc/autograd/record_function_ops.cpp",
@@ -121,8 +126,10 @@ libtorch_sources = [
     "torch/csrc/jit/passes/dead_code_elimination.cpp",
     "torch/csrc/jit/passes/erase_number_types.cpp",
     "torch/csrc/jit/passes/fixup_trace_scope_blocks.cpp",
+    "torch/csrc/jit/passes/fork_independent_branches.cpp",
     "torch/csrc/jit/passes/graph_fuser.cpp",
     "torch/csrc/jit/passes/graph_rewrite_helper.cpp",
+    "torch/csrc/jit/passes/horizontal_fusion.cpp",
     "torch/csrc/jit/passes/cuda_graph_fuser.cpp",
     "torch/csrc/jit/passes/guard_elimination.cpp",
     "torch/csrc/jit/passes/inline_autodiff_subgraphs.cpp",
@@ -136,10 +143,13 @@ libtorch_sources = [
     "torch/csrc/jit/passes/lower_grad_of.cpp",
     "torch/csrc/jit/passes/lower_graph.cpp",
     "torch/csrc/jit/passes/lower_tuples.cpp",
+    "torch/csrc/jit/passes/memory_planning.cpp",
     "torch/csrc/jit/passes/peephole.cpp",
     "torch/csrc/jit/serialization/python_print.cpp",
     "torch/csrc/jit/passes/quantization.cpp",
     "torch/csrc/jit/passes/prepack_folding.cpp",
+    "torch/csrc/jit/passes/mkldnn_layout_propagation.cpp",
+    "torch/csrc/jit/passes/mkldnn_prepack.cpp",
     "torch/csrc/jit/passes/xnnpack_rewrite.cpp",
     "torch/csrc/jit/passes/fuse_linear.cpp",
     "torch/csrc/jit/passes/freeze_module.cpp",
@@ -179,6 +189,7 @@ libtorch_sources = [
     "torch/csrc/jit/api/module.cpp",
     "torch/csrc/jit/api/module_save.cpp",
     "torch/csrc/jit/api/object.cpp",
+    "torch/csrc/jit/api/predictor.cpp",
     "torch/csrc/jit/frontend/string_to_type.cpp",
     "torch/csrc/jit/frontend/tracer.cpp",
     "torch/csrc/jit/codegen/fuser/kernel_cache.cpp",
@@ -196,6 +207,7 @@ libtorch_sources = [
     "torch/csrc/jit/mobile/register_mobile_ops.cpp",
     "torch/csrc/jit/mobile/register_mobile_autograd.cpp",
     "torch/csrc/jit/mobile/interpreter.cpp",
+    "torch/csrc/jit/mobile/profiler.cpp",
     "torch/csrc/jit/mobile/type_parser.cpp",
     "torch/csrc/utils/byte_order.cpp",
     "torch/csrc/utils/tensor_flatten.cpp",
@@ -236,6 +248,7 @@ torch_cpp_srcs = [
     "torch/csrc/api/src/data/samplers/random.cpp",
     "torch/csrc/api/src/data/samplers/sequential.cpp",
     "torch/csrc/api/src/data/samplers/stream.cpp",
+    "torch/csrc/api/src/data/samplers/streaming_random.cpp",
     "torch/csrc/api/src/enum.cpp",
     "torch/csrc/api/src/jit.cpp",
     "torch/csrc/api/src/serialize.cpp",
@@ -352,6 +365,7 @@ def add_torch_libs():
         "torch/csrc/distributed/rpc/python_functions.cpp",
         "torch/csrc/distributed/rpc/python_rpc_handler.cpp",
         "torch/csrc/distributed/rpc/request_callback_impl.cpp",
+        "torch/csrc/distributed/rpc/socket_agent.cpp",
         "torch/csrc/distributed/rpc/testing/faulty_process_group_agent.cpp",
         "torch/csrc/distributed/rpc/testing/init.cpp",
         "torch/csrc/distributed/rpc/unpickled_python_call.cpp",
@@ -361,6 +375,7 @@ def add_torch_libs():
         "torch/csrc/jit/passes/onnx.cpp",
         "torch/csrc/jit/passes/onnx/cast_all_constant_to_floating.cpp",
         "torch/csrc/jit/passes/onnx/constant_fold.cpp",
+        "torch/csrc/jit/passes/onnx/deduplicate_initializers.cpp",
         "torch/csrc/jit/passes/onnx/fixup_onnx_conditionals.cpp",
         "torch/csrc/jit/passes/onnx/fixup_onnx_loop.cpp",
         "torch/csrc/jit/passes/onnx/helper.cpp",
@@ -230,6 +230,13 @@ class profile(object):
             self cpu time might be artificially increased because of the shape
             collection.
 
+        sampling_probability (float, optional): If set below 1.0, only this
+            fraction of functions is recorded, chosen at random. Skipped
+            functions cost a single random draw, which keeps the overhead low
+            enough for continuous profiling of long-running jobs. Start and
+            stop events of a function are always recorded together.
+            Default: ``1.0`` (record everything).
+
     .. warning:
         This context managers should not be called recursively, i.e. at most one
         instance should be enabled at any given time.
@@ -259,7 +266,8 @@ class profile(object):
         -----------------------------------  ---------------  ---------------  ---------------
 
     """
-    def __init__(self, enabled=True, use_cuda=False, record_shapes=False):
+    def __init__(self, enabled=True, use_cuda=False, record_shapes=False,
+                 sampling_probability=1.0):
         self.enabled = enabled
         self.use_cuda = use_cuda
         self.function_events = None
@@ -267,6 +275,7 @@ class profile(object):
             return
         self.entered = False
         self.record_shapes = record_shapes
+        self.sampling_probability = sampling_probability
 
     def __enter__(self):
         if not self.enabled:
@@ -277,7 +286,8 @@ class profile(object):
         profiler_kind = torch.autograd.ProfilerState.CUDA if self.use_cuda \
             else torch.autograd.ProfilerState.CPU
         torch.autograd._enable_profiler(
-            torch.autograd.ProfilerConfig(profiler_kind, self.record_shapes))
+            torch.autograd.ProfilerConfig(
+                profiler_kind, self.record_shapes, self.sampling_probability))
         return self
 
     def __exit__(self, exc_type, exc_val, exc_tb):
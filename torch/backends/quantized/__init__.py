@@ -12,6 +12,8 @@ def _get_qengine_id(qengine):
         ret = 1
     elif qengine == 'qnnpack':
         ret = 2
+    elif qengine == 'auto':
+        ret = 3
     else:
         ret = -1
         raise RuntimeError("{} is not a valid value for quantized engine".format(qengine))
@@ -20,7 +22,7 @@ def _get_qengine_id(qengine):
 # This function should correspond to the enums present in c10/core/QEngine.h
 def _get_qengine_str(qengine):
     # type: (int) -> str
-    all_engines = {0 : 'none', 1 : 'fbgemm', 2 : 'qnnpack'}
+    all_engines = {0 : 'none', 1 : 'fbgemm', 2 : 'qnnpack', 3 : 'auto'}
     return all_engines.get(qengine)
 
 class _QEngineProp(object):
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/data/iterator.h>
+#include <torch/types.h>
+
+#include <ATen/cuda/CUDAEvent.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+
+/// Wraps a `DataLoader` and keeps one batch resident on a CUDA device ahead
+/// of the consumer, overlapping the host-to-device copy with compute.
+///
+/// Each host batch is staged into pinned memory and copied asynchronously on
+/// a dedicated copy stream, so the transfer of batch `i + 1` runs while the
+/// consumer's kernels still operate on batch `i`. `next()` makes the
+/// consumer's current stream wait on an event recorded after the copy, so no
+/// host synchronization sits on the critical path.
+///
+/// Because this header requires the CUDA toolkit, it is not included in
+/// `torch/data.h` and must be included explicitly, from a translation unit
+/// that is only compiled when CUDA is available.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto loader = torch::data::make_data_loader(std::move(dataset), options);
+///   auto prefetcher = torch::data::make_cuda_prefetcher(*loader, torch::kCUDA);
+///   while (auto batch = prefetcher.next()) {
+///     auto output = model.forward(batch->data); // already on the device
+///     ...
+///   }
+/// \endrst
+///
+/// The prefetcher transfers `Example`s whose data and target are `Tensor`s
+/// (including `TensorExample`), plain `Tensor` batches, and `std::vector`s
+/// thereof. It must be used from a single consumer thread, and the wrapped
+/// `DataLoader` must outlive it.
+template <typename DataLoader>
+class CudaPrefetcher {
+ public:
+  using BatchType = typename DataLoader::BatchType;
+
+  /// Constructs a `CudaPrefetcher` around `loader`, targeting `device`, and
+  /// immediately begins staging the first batch.
+  CudaPrefetcher(DataLoader& loader, Device device)
+      : loader_(loader),
+        device_(device),
+        copy_stream_(at::cuda::getStreamFromPool(
+            /*isHighPriority=*/false,
+            device.index())) {
+    TORCH_CHECK(
+        device_.is_cuda(), "CudaPrefetcher expected a CUDA device, got ", device_);
+    reset();
+  }
+
+  CudaPrefetcher(CudaPrefetcher&&) = default;
+
+  ~CudaPrefetcher() {
+    // The copy for the staged batch may still be in flight; its pinned
+    // source buffers must not be released before it completes.
+    if (!pinned_tensors_.empty()) {
+      copy_done_.synchronize();
+    }
+  }
+
+  /// Returns the next batch, resident on the device, or an empty `optional`
+  /// when the underlying `DataLoader` is exhausted. The copy for the
+  /// following batch is issued before this call returns.
+  optional<BatchType> next() {
+    if (!staged_) {
+      return nullopt;
+    }
+    // The consumer's stream must not touch the staged tensors until the
+    // copies issued on `copy_stream_` have completed. This is a device-side
+    // wait; the host does not block here.
+    at::cuda::CUDAStream consumer_stream =
+        at::cuda::getCurrentCUDAStream(device_.index());
+    copy_done_.block(consumer_stream);
+    // The device tensors were allocated on `copy_stream_` but are handed to
+    // (and eventually freed from) the consumer's stream. Record that stream
+    // with the caching allocator so the memory is not reused while the
+    // consumer's kernels may still be reading it.
+    for (const Tensor& tensor : staged_device_tensors_) {
+      c10::cuda::CUDACachingAllocator::recordStream(
+          tensor.storage().data_ptr(), consumer_stream);
+    }
+    staged_device_tensors_.clear();
+    optional<BatchType> batch = std::move(staged_);
+    staged_ = nullopt;
+    preload();
+    return batch;
+  }
+
+  /// Starts a new epoch: acquires a fresh iterator from the underlying
+  /// `DataLoader` and stages its first batch.
+  void reset() {
+    // Drop anything staged for the previous epoch.
+    staged_ = nullopt;
+    staged_device_tensors_.clear();
+    iterator_ = loader_.begin();
+    preload();
+  }
+
+ private:
+  /// Pulls the next host batch from the `DataLoader` and issues its
+  /// host-to-device copy on the dedicated copy stream.
+  void preload() {
+    if (*iterator_ == loader_.end()) {
+      return;
+    }
+    // The pinned buffers still referenced from the previous `preload()` may
+    // back an in-flight copy; they can only be released once the copy's
+    // event has completed. That copy was issued one batch ago and overlapped
+    // with the consumer's compute, so this wait is almost always a no-op.
+    if (!pinned_tensors_.empty()) {
+      copy_done_.synchronize();
+      pinned_tensors_.clear();
+    }
+    BatchType host_batch = std::move(**iterator_);
+    ++*iterator_;
+    c10::cuda::CUDAStreamGuard guard(copy_stream_);
+    staged_ = transfer(std::move(host_batch));
+    copy_done_.record(copy_stream_);
+  }
+
+  /// Stages a single tensor: pins it (if necessary) and enqueues an
+  /// asynchronous copy to the device on the current (copy) stream. The pinned
+  /// source is retained until the copy is known to have completed.
+  Tensor transfer(Tensor tensor) {
+    if (!tensor.defined() || tensor.is_cuda()) {
+      return tensor;
+    }
+    Tensor pinned =
+        tensor.is_pinned() ? std::move(tensor) : tensor.pin_memory();
+    Tensor device_tensor = pinned.to(device_, /*non_blocking=*/true);
+    pinned_tensors_.push_back(std::move(pinned));
+    staged_device_tensors_.push_back(device_tensor);
+    return device_tensor;
+  }
+
+  template <typename Data, typename Target>
+  Example<Data, Target> transfer(Example<Data, Target> example) {
+    return {transfer(std::move(example.data)),
+            transfer(std::move(example.target))};
+  }
+
+  template <typename Data>
+  Example<Data, example::NoTarget> transfer(
+      Example<Data, example::NoTarget> example) {
+    return {transfer(std::move(example.data))};
+  }
+
+  template <typename T>
+  std::vector<T> transfer(std::vector<T> batch) {
+    for (auto& example : batch) {
+      example = transfer(std::move(example));
+    }
+    return batch;
+  }
+
+  DataLoader& loader_;
+
+  /// The target device.
+  Device device_;
+
+  /// The stream all host-to-device copies are issued on, distinct from the
+  /// consumer's compute stream so the two can overlap.
+  at::cuda::CUDAStream copy_stream_;
+
+  /// Recorded on `copy_stream_` after each batch's copies are enqueued.
+  at::cuda::CUDAEvent copy_done_;
+
+  /// The batch staged on the device, one ahead of the consumer.
+  optional<BatchType> staged_;
+
+  /// Device tensors of the staged batch, so `next()` can record the
+  /// consumer's stream with the caching allocator.
+  std::vector<Tensor> staged_device_tensors_;
+
+  /// Pinned host sources of the in-flight copies, kept alive until
+  /// `copy_done_` has fired.
+  std::vector<Tensor> pinned_tensors_;
+
+  /// The current epoch's iterator into the wrapped `DataLoader`.
+  optional<Iterator<BatchType>> iterator_;
+};
+
+/// Creates a `CudaPrefetcher` around `loader`, targeting `device`, deducing
+/// the `DataLoader` type from the argument.
+template <typename DataLoader>
+CudaPrefetcher<DataLoader> make_cuda_prefetcher(
+    DataLoader& loader,
+    Device device) {
+  return CudaPrefetcher<DataLoader>(loader, device);
+}
+} // namespace data
+} // namespace torch
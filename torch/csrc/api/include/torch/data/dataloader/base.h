@@ -210,6 +210,10 @@ class DataLoaderBase {
   /// Convenience method that creates a new sequencer based on the
   /// `enforce_ordering` option.
   std::unique_ptr<detail::sequencers::Sequencer<Result>> new_sequencer() {
+    if (options_.reorder_window) {
+      return torch::make_unique<detail::sequencers::WindowedSequencer<Result>>(
+          *options_.reorder_window, options_.max_jobs);
+    }
     if (options_.enforce_ordering) {
       return torch::make_unique<detail::sequencers::OrderedSequencer<Result>>(
           options_.max_jobs);
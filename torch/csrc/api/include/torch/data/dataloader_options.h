@@ -34,6 +34,16 @@ struct DataLoaderOptions {
   /// you do not care about determinism.
   TORCH_ARG(bool, enforce_ordering) = true;
 
+  /// If set, batches may complete out of order within a window of this many
+  /// sequence numbers: a batch is handed out as soon as it is ready unless it
+  /// is `reorder_window` or more ahead of the oldest batch still owed. This
+  /// keeps one slow sample from stalling the pipeline while bounding how far
+  /// batches drift from their original order; combine it with a larger
+  /// `max_jobs` to prefetch deeper. A window of 1 is strict ordering and a
+  /// window of `max_jobs` or more is fully unordered. Takes precedence over
+  /// `enforce_ordering`; only meaningful with worker threads.
+  TORCH_ARG(optional<size_t>, reorder_window);
+
   /// Whether to omit the last batch if it contains less than `batch_size`
   /// examples.
   TORCH_ARG(bool, drop_last) = false;
@@ -52,6 +62,7 @@ struct FullDataLoaderOptions {
         max_jobs(options.max_jobs().value_or(2 * workers)),
         timeout(options.timeout()),
         enforce_ordering(options.enforce_ordering()),
+        reorder_window(options.reorder_window()),
         drop_last(options.drop_last()) {}
 
   size_t batch_size;
@@ -59,6 +70,7 @@ struct FullDataLoaderOptions {
   size_t max_jobs;
   optional<std::chrono::milliseconds> timeout;
   bool enforce_ordering;
+  optional<size_t> reorder_window;
   bool drop_last;
 };
 } // namespace data
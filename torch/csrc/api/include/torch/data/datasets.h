@@ -6,4 +6,5 @@
 #include <torch/data/datasets/mnist.h>
 #include <torch/data/datasets/shared.h>
 #include <torch/data/datasets/stateful.h>
+#include <torch/data/datasets/streaming.h>
 #include <torch/data/datasets/tensor.h>
@@ -4,6 +4,7 @@
 #include <torch/csrc/utils/memory.h>
 #include <torch/data/datasets/stateful.h>
 #include <torch/data/samplers.h>
+#include <algorithm>
 #include <queue>
 #include <thread>
 
@@ -33,6 +34,17 @@ class ChunkDataReader {
   /// Returns the number of chunks available in this reader.
   virtual size_t chunk_count() = 0;
 
+  /// Optional scheduling hint with the number of examples in the given chunk
+  /// (or any other monotone proxy for its read cost). When a cross-chunk
+  /// shuffle group is scheduled, its largest chunks are read first so the
+  /// group's critical path is as short as possible. Return 0 (the default)
+  /// when the size is unknown; scheduling then follows the sampled order.
+  /// This must be cheap metadata access, as it is called under the chunk
+  /// scheduling lock.
+  virtual size_t chunk_size(size_t /*chunk_index*/) {
+    return 0;
+  }
+
   /// This will clear any internal state associate with this reader.
   virtual void reset() = 0;
 };
@@ -374,6 +386,8 @@ class ChunkDataset final
     // free workers from previous reset if there is any.
     free_workers();
     preload_threads_.clear();
+    // Throw away any chunk group a previous epoch left partially claimed.
+    current_group_.reset();
 
     if (!load_checkpoint_){
       chunk_reader_.reset();
@@ -422,34 +436,79 @@ class ChunkDataset final
   }
 
  private:
+  /// A group of chunks sampled together for cross-chunk shuffling. Instead of
+  /// one preloader reading the whole group serially, workers claim member
+  /// chunks one at a time, so an idle preloader steals pending chunks from a
+  /// group another worker started rather than sitting out the epoch tail. The
+  /// worker that finishes the last member merges the group in sampled order
+  /// and publishes it to the batch buffer.
+  struct ChunkGroup {
+    explicit ChunkGroup(std::vector<size_t> indices)
+        : chunk_indices(std::move(indices)), chunk_data(chunk_indices.size()) {}
+
+    std::vector<size_t> chunk_indices;
+    std::vector<UnwrappedBatchType> chunk_data;
+
+    /// Next unclaimed position in `chunk_indices`. Guarded by
+    /// `chunk_index_guard_`.
+    size_t next_chunk = 0;
+
+    /// Number of members whose read has finished (or failed).
+    std::atomic<size_t> completed{0};
+
+    /// Set when any member read threw; the group's data is then discarded,
+    /// as the exception has already been pushed to the batch buffer.
+    std::atomic<bool> failed{false};
+  };
+
   /// running on worker thread to preload chunk data.
   void preloader(size_t id) {
     while (!quit_worker_.load()) {
-      try {
-        std::vector<size_t> chunk_idx;
-        {
-          std::lock_guard<std::mutex> lock(chunk_index_guard_);
-          if (auto chunk_sampler_result = chunk_sampler_.next(this->options_.cross_chunk_shuffle_count())) {
-            chunk_idx = chunk_sampler_result.value();
-          } else {
-            break;
+      std::shared_ptr<ChunkGroup> group;
+      size_t position = 0;
+      {
+        std::lock_guard<std::mutex> lock(chunk_index_guard_);
+        if (current_group_ &&
+            current_group_->next_chunk < current_group_->chunk_indices.size()) {
+          // Steal the next pending chunk of the group in flight.
+          group = current_group_;
+          position = group->next_chunk++;
+        } else if (
+            auto chunk_sampler_result = chunk_sampler_.next(
+                this->options_.cross_chunk_shuffle_count())) {
+          group =
+              std::make_shared<ChunkGroup>(std::move(chunk_sampler_result.value()));
+          if (group->chunk_indices.size() > 1) {
+            // Read the largest chunks first (when the reader provides a size
+            // hint), so the last read to finish is a small one and the other
+            // preloaders spend as little time as possible waiting on it.
+            std::stable_sort(
+                group->chunk_indices.begin(),
+                group->chunk_indices.end(),
+                [this](size_t lhs, size_t rhs) {
+                  return chunk_reader_.chunk_size(lhs) >
+                      chunk_reader_.chunk_size(rhs);
+                });
           }
+          position = group->next_chunk++;
+          current_group_ = group;
+        } else {
+          // The sampler is exhausted and the group in flight (if any) is
+          // fully claimed; its remaining reads finish on the workers that
+          // claimed them.
+          break;
         }
-        UnwrappedBatchType data = chunk_reader_.read_chunk(chunk_idx[0]);
-        for (size_t i = 1; i < chunk_idx.size(); ++i) {
-          auto chunk_data = chunk_reader_.read_chunk(chunk_idx[i]);
-          std::move(
-              chunk_data.begin(), chunk_data.end(), std::back_inserter(data));
-        }
-        if (preprocessing_policy_) {
-          preprocessing_policy_(data);
-        }
-        if (!data.empty()) { // skip empty chunks.
-          batch_buffer_->add_chunk_data(std::move(data));
-        }
+      }
+      try {
+        group->chunk_data[position] =
+            chunk_reader_.read_chunk(group->chunk_indices[position]);
       } catch (...) {
+        group->failed = true;
         batch_buffer_->add_chunk_data(std::current_exception());
       }
+      if (group->completed.fetch_add(1) + 1 == group->chunk_indices.size()) {
+        publish_group(*group);
+      }
     }
     AT_ASSERT(running_preloaders_.load() > 0);
     --running_preloaders_;
@@ -459,6 +518,32 @@ class ChunkDataset final
     }
   }
 
+  /// Merges a fully read chunk group and pushes it to the batch buffer.
+  /// Called by exactly one worker per group: the one that completed its last
+  /// member.
+  void publish_group(ChunkGroup& group) {
+    if (group.failed.load()) {
+      return;
+    }
+    try {
+      UnwrappedBatchType data = std::move(group.chunk_data[0]);
+      for (size_t i = 1; i < group.chunk_data.size(); ++i) {
+        std::move(
+            group.chunk_data[i].begin(),
+            group.chunk_data[i].end(),
+            std::back_inserter(data));
+      }
+      if (preprocessing_policy_) {
+        preprocessing_policy_(data);
+      }
+      if (!data.empty()) { // skip empty chunks.
+        batch_buffer_->add_chunk_data(std::move(data));
+      }
+    } catch (...) {
+      batch_buffer_->add_chunk_data(std::current_exception());
+    }
+  }
+
   /// Block the current thread until the workers finish execution and exit.
   void free_workers() {
     if (!quit_worker_.load()) {
@@ -510,7 +595,12 @@ class ChunkDataset final
   // indicates that the chunk loading is completed.
   std::atomic<size_t> running_preloaders_;
 
-  // mutex to synchronize chunk sampler next() call.
+  // The chunk group currently being read, from which idle preloaders claim
+  // pending member chunks. Guarded by chunk_index_guard_.
+  std::shared_ptr<ChunkGroup> current_group_;
+
+  // mutex to synchronize chunk sampler next() calls and chunk claiming from
+  // the current group.
   mutable std::mutex chunk_index_guard_;
 
   // boolean value to indicate whether we need to load the checkpoint for chunk_sampler_.
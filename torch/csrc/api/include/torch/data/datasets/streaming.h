@@ -0,0 +1,177 @@
+#pragma once
+
+#include <torch/data/datasets/stateful.h>
+#include <torch/data/example.h>
+
+#include <c10/util/Exception.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace datasets {
+
+/// A push-based dataset for data that arrives from an external source (a
+/// message queue, a socket, a simulator) rather than from random access into
+/// a stored collection.
+///
+/// Producer threads feed single examples into the dataset with `push()`,
+/// which blocks once a bounded internal buffer is full -- the block is the
+/// backpressure signal to the producer (an optional timeout turns a
+/// prolonged stall into an error). The `DataLoader` worker pool drains the
+/// buffer through the regular stateful `get_batch()` interface, so batching,
+/// worker threads and transforms all work as usual. A producer marks the end
+/// of an epoch with `end_epoch()`; examples pushed afterwards are buffered
+/// (and count towards the capacity) for the epoch that begins at the next
+/// `reset()`.
+///
+/// Like `ChunkDataset`, the dataset maintains internal synchronization state
+/// and must be shared between worker threads via a `SharedBatchDataset`:
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto dataset = datasets::make_shared_dataset<
+///       datasets::StreamingDataset<Example<>>>(/*buffer_capacity=*/512);
+///   auto data_loader = torch::data::make_data_loader(
+///       dataset, DataLoaderOptions(batch_size).workers(2));
+///   // elsewhere: dataset->push(example); ... dataset->end_epoch();
+/// \endrst
+///
+/// All producer threads must have returned from `push()` before the dataset
+/// is destructed.
+template <typename ExampleType_ = Example<>>
+class StreamingDataset : public StatefulDataset<
+                             StreamingDataset<ExampleType_>,
+                             std::vector<ExampleType_>,
+                             size_t> {
+ public:
+  using ExampleType = ExampleType_;
+
+  /// Constructs the dataset with an internal buffer holding at most
+  /// `buffer_capacity` examples. The capacity bounds how far the producer
+  /// may run ahead of training and thus the dataset's memory footprint.
+  explicit StreamingDataset(size_t buffer_capacity)
+      : capacity_(buffer_capacity) {
+    TORCH_CHECK(buffer_capacity > 0, "buffer_capacity must be positive");
+  }
+
+  /// Appends one example to the internal buffer, blocking while the buffer
+  /// is full. If a `timeout` is given and no space opens up in time, an
+  /// exception is raised instead of blocking further.
+  void push(
+      ExampleType example,
+      optional<std::chrono::milliseconds> timeout = nullopt) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto has_space = [this] { return example_count_ < capacity_; };
+    if (timeout) {
+      if (!not_full_.wait_for(lock, *timeout, has_space)) {
+        // clang-format off
+        AT_ERROR(
+            "Timeout while waiting for space in the StreamingDataset buffer"
+            " (timeout was ", timeout->count(), " ms)");
+        // clang-format on
+      }
+    } else {
+      not_full_.wait(lock, has_space);
+    }
+    buffer_.emplace_back(std::move(example));
+    ++example_count_;
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  /// Marks the end of the current epoch. Once the buffered examples ahead of
+  /// this mark are drained, `get_batch()` returns an empty `optional` (the
+  /// stateful end-of-epoch signal) until `reset()` begins the next epoch.
+  void end_epoch() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffer_.emplace_back(nullopt);
+    }
+    not_empty_.notify_all();
+  }
+
+  /// Assembles a batch of up to `batch_size` examples, blocking until enough
+  /// examples have been pushed or the epoch has ended. At the epoch boundary
+  /// a final partial batch may be returned; after that, an empty `optional`.
+  optional<std::vector<ExampleType>> get_batch(size_t batch_size) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::vector<ExampleType> batch;
+    batch.reserve(batch_size);
+    while (batch.size() < batch_size) {
+      not_empty_.wait(
+          lock, [this] { return !buffer_.empty() || epoch_ended_; });
+      if (epoch_ended_) {
+        // Anything still buffered belongs to the next epoch.
+        break;
+      }
+      optional<ExampleType>& front = buffer_.front();
+      if (!front.has_value()) {
+        // End-of-epoch mark; latch it so concurrent workers stop too.
+        buffer_.pop_front();
+        epoch_ended_ = true;
+        not_empty_.notify_all();
+        break;
+      }
+      batch.push_back(std::move(*front));
+      buffer_.pop_front();
+      --example_count_;
+      not_full_.notify_one();
+    }
+    if (batch.empty()) {
+      return nullopt;
+    }
+    return batch;
+  }
+
+  /// Begins a new epoch. Called by the `DataLoader` at the start of an
+  /// epoch; examples pushed since `end_epoch()` become available again.
+  void reset() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      epoch_ended_ = false;
+    }
+    not_empty_.notify_all();
+  }
+
+  /// The number of examples currently buffered.
+  size_t buffered_example_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return example_count_;
+  }
+
+  /// The size of a live stream is not known.
+  optional<size_t> size() const override {
+    return nullopt;
+  }
+
+  /// A live stream has no serializable state.
+  void save(serialize::OutputArchive& /*archive*/) const override {}
+
+  /// A live stream has no serializable state.
+  void load(serialize::InputArchive& /*archive*/) override {}
+
+ private:
+  size_t capacity_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+
+  /// Pushed examples in arrival order; an empty `optional` marks an epoch
+  /// boundary and does not count towards `example_count_`.
+  std::deque<optional<ExampleType>> buffer_;
+  size_t example_count_ = 0;
+  bool epoch_ended_ = false;
+};
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
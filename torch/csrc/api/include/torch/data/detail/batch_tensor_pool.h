@@ -0,0 +1,80 @@
+#pragma once
+
+#include <torch/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// A recycling pool of batch-sized output tensors, keyed by shape, dtype and
+/// device.
+///
+/// Collating a batch normally allocates a fresh output tensor which the
+/// consumer frees one step later, churning batch-size times steps-per-second
+/// bytes through the allocator. Since training batches overwhelmingly share
+/// one geometry, the pool keeps a few tensors per (shape, dtype, device) key
+/// and hands them out again once the consumer has dropped its reference.
+///
+/// Returning tensors to the pool is implicit: `acquire()` hands out a second
+/// handle to a pooled tensor, and the tensor becomes reusable when the
+/// pool's handle is the only one left (both the tensor and its storage are
+/// uniquely owned again). A consumer that retains batches simply causes
+/// fresh, untracked allocations once the bucket is exhausted — correctness
+/// never depends on timely release.
+///
+/// All methods are thread-safe, so one pool can serve every DataLoader
+/// worker thread. The pool is typically owned (via `shared_ptr`) by a
+/// collation transform, and thus shares the lifetime of the dataset inside
+/// the DataLoader.
+class BatchTensorPool {
+ public:
+  /// `max_per_key` bounds how many tensors are retained per (shape, dtype,
+  /// device) key; it should be at least the number of batches alive at once
+  /// (e.g. DataLoader `max_jobs`) to avoid fallback allocations.
+  explicit BatchTensorPool(size_t max_per_key = 4)
+      : max_per_key_(max_per_key) {}
+
+  /// Returns a tensor of the given geometry, recycled from the pool when a
+  /// previously handed-out tensor has been released, freshly allocated (and
+  /// pooled) otherwise. The contents are unspecified, like `torch::empty`.
+  Tensor acquire(IntArrayRef sizes, const TensorOptions& options) {
+    Key key(
+        sizes.vec(),
+        at::typeMetaToScalarType(options.dtype()),
+        options.device().type(),
+        options.device().index());
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& bucket = pool_[key];
+    for (auto& tensor : bucket) {
+      if (tensor.use_count() == 1 && tensor.storage().use_count() == 1) {
+        return tensor;
+      }
+    }
+    if (bucket.size() < max_per_key_) {
+      bucket.push_back(torch::empty(sizes, options));
+      return bucket.back();
+    }
+    // Every pooled tensor for this key is still referenced by a consumer and
+    // the bucket is full; fall back to an allocation the pool does not track.
+    return torch::empty(sizes, options);
+  }
+
+ private:
+  using Key =
+      std::tuple<std::vector<int64_t>, at::ScalarType, at::DeviceType, at::DeviceIndex>;
+
+  size_t max_per_key_;
+  std::map<Key, std::vector<Tensor>> pool_;
+  std::mutex mutex_;
+};
+} // namespace detail
+} // namespace data
+} // namespace torch
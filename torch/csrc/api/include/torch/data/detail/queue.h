@@ -55,7 +55,12 @@ class Queue {
       cv_.wait(lock, [this] { return !this->queue_.empty(); });
     }
     AT_ASSERT(!queue_.empty());
-    T value = queue_.front();
+    // Move, don't copy: batches flow through this queue by value, and a
+    // copying pop deep-copies any payload the example type holds inline
+    // (raw byte buffers, strings) on every single batch. Tensors share
+    // their storages within the process, so with the move the
+    // worker-to-main handoff is zero-copy.
+    T value = std::move(queue_.front());
     queue_.pop();
     lock.unlock();
     return value;
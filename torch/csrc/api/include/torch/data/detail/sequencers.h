@@ -107,6 +107,96 @@ struct OrderedSequencer : public Sequencer<Result> {
   /// A fixed-size buffer (after construction).
   std::vector<optional<Result>> buffer_;
 };
+/// A `Sequencer` that allows bounded out-of-order completion. Results are
+/// returned as soon as they arrive, as long as their sequence number is less
+/// than `window` ahead of the oldest result not yet returned; anything
+/// further ahead is buffered until the window catches up. This keeps one
+/// slow sample (e.g. an expensive video decode) from stalling the whole
+/// pipeline the way strict ordering does, while still bounding how far
+/// results can drift from their original order. A window of 1 is strict
+/// ordering; a window of at least `max_jobs` never holds anything back.
+///
+/// Implementation note: sequence numbers with a returned result pending
+/// acknowledgement all lie in `[next_sequence_number_, next_sequence_number_
+/// + window)`, so the `returned_` flags need only `window` slots. Buffered
+/// results are at least `window` ahead of `next_sequence_number_`, and since
+/// the `DataLoader` schedules a new job only after a result is handed out,
+/// their sequence numbers span fewer than `max_jobs` values — the same
+/// argument that makes the `OrderedSequencer`'s fixed-size buffer safe.
+template <typename Result>
+struct WindowedSequencer final : public Sequencer<Result> {
+  using typename Sequencer<Result>::ResultProducer;
+
+  /// Constructs the `WindowedSequencer` with the reorder window size and the
+  /// maximum number of results it will ever hold at one point in time.
+  WindowedSequencer(size_t window, size_t max_jobs)
+      : window_(std::max<size_t>(window, 1)),
+        buffer_(max_jobs),
+        returned_(window_, false) {}
+
+  /// Returns the first available result within the reorder window.
+  optional<Result> next(ResultProducer next_result) override {
+    // A buffered result may have entered the window when
+    // `next_sequence_number_` advanced on the previous call.
+    if (auto ready = take_ready()) {
+      return ready;
+    }
+    while (true) {
+      auto result = next_result();
+      if (!result) {
+        AT_ASSERT(!detail::buffer_contains_result(buffer_));
+        return nullopt;
+      }
+      if (in_window(result->sequence_number)) {
+        mark_returned(result->sequence_number);
+        return result;
+      }
+      // Too far ahead of the oldest result still owed; stash it.
+      auto& slot = buffer_.at(result->sequence_number % buffer_.size());
+      AT_ASSERT(!slot.has_value());
+      slot = std::move(result);
+    }
+  }
+
+  bool in_window(size_t sequence_number) const {
+    return sequence_number < next_sequence_number_ + window_;
+  }
+
+  /// Records that `sequence_number` was handed out and slides the window
+  /// over the contiguous prefix of returned results.
+  void mark_returned(size_t sequence_number) {
+    returned_.at(sequence_number % window_) = true;
+    while (returned_.at(next_sequence_number_ % window_)) {
+      returned_.at(next_sequence_number_ % window_) = false;
+      ++next_sequence_number_;
+    }
+  }
+
+  /// Returns a buffered result that has come into the window, if any.
+  optional<Result> take_ready() {
+    for (auto& slot : buffer_) {
+      if (slot.has_value() && in_window(slot->sequence_number)) {
+        auto result = std::move(*slot);
+        slot.reset();
+        mark_returned(result.sequence_number);
+        return result;
+      }
+    }
+    return nullopt;
+  }
+
+  /// The lowest sequence number not yet returned.
+  size_t next_sequence_number_ = 0;
+
+  /// How far ahead of `next_sequence_number_` a result may be returned.
+  size_t window_;
+
+  /// Results that arrived too far ahead of the window.
+  std::vector<optional<Result>> buffer_;
+
+  /// Which sequence numbers in the window were already returned.
+  std::vector<bool> returned_;
+};
 } // namespace sequencers
 } // namespace detail
 } // namespace data
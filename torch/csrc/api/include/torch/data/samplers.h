@@ -7,3 +7,4 @@
 #include <torch/data/samplers/sequential.h>
 #include <torch/data/samplers/serialize.h>
 #include <torch/data/samplers/stream.h>
+#include <torch/data/samplers/streaming_random.h>
@@ -4,6 +4,7 @@
 #include <torch/data/samplers/base.h>
 
 #include <cstddef>
+#include <future>
 #include <vector>
 
 namespace torch {
@@ -64,6 +65,14 @@ class DistributedSampler : public Sampler<BatchRequest> {
 
 /// Select samples randomly. The sampling order is shuffled at each `reset()`
 /// call.
+///
+/// The shuffle for an epoch depends only on the epoch number and the size, so
+/// after each `reset()` the sampler shuffles the *next* epoch's indices on a
+/// helper thread while the current epoch is being consumed. When `set_epoch`
+/// advances the epoch by one and the size is unchanged (the common training
+/// loop), the following `reset()` just swaps in the prepared buffer; any
+/// other transition falls back to shuffling synchronously. The produced
+/// sequences are identical either way.
 class TORCH_API DistributedRandomSampler : public DistributedSampler<> {
  public:
   DistributedRandomSampler(
@@ -72,6 +81,13 @@ class TORCH_API DistributedRandomSampler : public DistributedSampler<> {
       size_t rank = 0,
       bool allow_duplicates = true);
 
+  /// Copies the sampling state; the background-prepared buffer is not copied
+  /// and is rebuilt by the copy's next `reset()`.
+  DistributedRandomSampler(const DistributedRandomSampler& other);
+  DistributedRandomSampler& operator=(const DistributedRandomSampler& other);
+  DistributedRandomSampler(DistributedRandomSampler&&) = default;
+  DistributedRandomSampler& operator=(DistributedRandomSampler&&) = default;
+
   /// Resets the `DistributedRandomSampler` to a new set of indices.
   void reset(optional<size_t> new_size = nullopt) override;
 
@@ -88,12 +104,28 @@ class TORCH_API DistributedRandomSampler : public DistributedSampler<> {
   size_t index() const noexcept;
 
  private:
-  void populate_indices();
+  /// Builds one epoch's full shuffled index sequence. It is identical on
+  /// every rank; a rank's shard is just a `[begin, end)` window into it.
+  static std::vector<size_t> build_shuffled_indices(
+      size_t size,
+      size_t num_replicas,
+      bool allow_duplicates,
+      size_t epoch);
+
+  /// Starts shuffling the predicted next epoch on a helper thread.
+  void prefetch_next_epoch();
 
   size_t begin_index_;
   size_t end_index_;
   size_t sample_index_;
   std::vector<size_t> all_indices_;
+
+  /// The next epoch's indices, being shuffled in the background, and the
+  /// (epoch, size) they were prepared for. Destroying or reassigning the
+  /// future joins the helper thread.
+  std::future<std::vector<size_t>> next_indices_;
+  size_t prepared_epoch_ = 0;
+  size_t prepared_size_ = 0;
 };
 
 /// Select samples sequentially.
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/data/samplers/base.h>
+#include <torch/types.h>
+
+#include <ATen/core/MT19937RNGEngine.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace torch {
+namespace serialize {
+class OutputArchive;
+class InputArchive;
+} // namespace serialize
+} // namespace torch
+
+namespace torch {
+namespace data {
+namespace samplers {
+
+/// A `Sampler` that returns the indices `0 ... size - 1` in pseudo-random
+/// order without ever materializing the permutation.
+///
+/// `RandomSampler` allocates and shuffles the full index tensor on every
+/// `reset()`, which is O(size) in both time and memory — a multi-second,
+/// multi-gigabyte stall per epoch for datasets with hundreds of millions of
+/// samples. `StreamingRandomSampler` instead evaluates a keyed bijection over
+/// `[0, size)` on the fly: a four-round Feistel network over the smallest
+/// even-bit-width power-of-two domain covering `size`, restricted to the
+/// dataset range by cycle walking. Every index in `[0, size)` is produced
+/// exactly once per epoch, each `next()` call costs O(batch_size), and the
+/// sampler's state is a few words regardless of dataset size.
+///
+/// The per-epoch round keys are drawn from an `at::mt19937` engine seeded
+/// either explicitly or, by default, from the global random number generator
+/// (so `torch::manual_seed` makes epochs reproducible). Note that a Feistel
+/// permutation is pseudo-random, not a uniform draw from all `size!`
+/// permutations; for shuffling training data this is not a meaningful
+/// distinction, but it is not a drop-in source of statistically rigorous
+/// random permutations.
+class TORCH_API StreamingRandomSampler : public Sampler<> {
+ public:
+  /// Constructs a `StreamingRandomSampler` over `size` indices. When no
+  /// `seed` is given, one is drawn from the global random number generator.
+  explicit StreamingRandomSampler(
+      int64_t size,
+      optional<uint64_t> seed = nullopt);
+
+  /// Resets the sampler to the beginning of a new epoch, drawing fresh
+  /// permutation keys (and optionally a new size).
+  void reset(optional<size_t> new_size = nullopt) override;
+
+  /// Returns the next batch of indices.
+  optional<std::vector<size_t>> next(size_t batch_size) override;
+
+  /// Serializes the `StreamingRandomSampler` to the `archive`. The current
+  /// epoch's keys are stored, so the remaining sequence is reproducible
+  /// after loading, like `RandomSampler`'s saved index tensor.
+  void save(serialize::OutputArchive& archive) const override;
+
+  /// Deserializes the `StreamingRandomSampler` from the `archive`.
+  void load(serialize::InputArchive& archive) override;
+
+  /// Returns the current index of the `StreamingRandomSampler`.
+  size_t index() const noexcept;
+
+ private:
+  static constexpr size_t kRounds = 4;
+
+  /// Recomputes the Feistel domain for the current size.
+  void recompute_domain();
+
+  /// Applies the keyed Feistel permutation to a value in the domain.
+  uint64_t permute(uint64_t value) const;
+
+  int64_t size_;
+  int64_t index_ = 0;
+
+  /// Number of bits in each Feistel half; the domain is
+  /// `1 << (2 * half_bits_)`.
+  uint64_t half_bits_ = 1;
+  uint64_t half_mask_ = 1;
+
+  /// The current epoch's round keys.
+  std::array<uint64_t, kRounds> keys_;
+
+  /// Source of per-epoch round keys.
+  at::mt19937 engine_;
+};
+} // namespace samplers
+} // namespace data
+} // namespace torch
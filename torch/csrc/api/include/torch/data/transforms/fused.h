@@ -0,0 +1,118 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/data/transforms/collate.h>
+#include <torch/types.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace transforms {
+
+template <typename T = Example<>>
+struct FusedStack;
+
+/// A `Collation` that runs each example through a chain of tensor stages
+/// (e.g. decode, resize, normalize) and writes the result straight into its
+/// slot of a pre-sized batch tensor.
+///
+/// Composing the same pipeline as `.map(A).map(B).map(C).map(Stack<>())`
+/// materializes a full intermediate batch per stage and, in `Stack`, keeps
+/// every transformed example alive until `torch::stack` copies them into yet
+/// another allocation. The fused version makes one pass per example — all
+/// stages run back to back while the example is hot in cache — and the only
+/// batch-sized buffer is the output itself. Only one transformed example is
+/// live at a time.
+///
+/// The first example determines the batch geometry, so stages must produce
+/// tensors of equal shape and dtype for every example in a batch. Stages
+/// receive their input by value and may transform it in place.
+///
+/// \rst
+/// .. code-block:: cpp
+///   using namespace torch::data;
+///
+///   auto dataset = datasets::MNIST("path/to/mnist")
+///     .map(transforms::FusedStack<Example<>>(
+///         {[](torch::Tensor t) { return decode(std::move(t)); },
+///          [](torch::Tensor t) { return resize(std::move(t)); },
+///          [](torch::Tensor t) { return normalize(std::move(t)); }}));
+/// \endrst
+template <>
+struct FusedStack<Example<>> : public Collation<Example<>> {
+  using StageType = std::function<Tensor(Tensor)>;
+
+  explicit FusedStack(std::vector<StageType> stages)
+      : stages_(std::move(stages)) {}
+
+  Example<> apply_batch(std::vector<Example<>> examples) override {
+    TORCH_CHECK(!examples.empty(), "FusedStack cannot collate an empty batch");
+    // The first example, run through all stages, fixes the batch geometry.
+    Tensor first = apply_stages(std::move(examples.front().data));
+    std::vector<int64_t> sizes = {static_cast<int64_t>(examples.size())};
+    sizes.insert(sizes.end(), first.sizes().begin(), first.sizes().end());
+    Tensor data = torch::empty(sizes, first.options());
+    data[0].copy_(first);
+    first.reset();
+    for (size_t i = 1; i < examples.size(); ++i) {
+      data[i].copy_(apply_stages(std::move(examples[i].data)));
+    }
+    std::vector<Tensor> targets;
+    targets.reserve(examples.size());
+    for (auto& example : examples) {
+      targets.push_back(std::move(example.target));
+    }
+    return {std::move(data), torch::stack(targets)};
+  }
+
+ private:
+  Tensor apply_stages(Tensor tensor) {
+    for (auto& stage : stages_) {
+      tensor = stage(std::move(tensor));
+    }
+    return tensor;
+  }
+
+  std::vector<StageType> stages_;
+};
+
+/// A `FusedStack` for `Example<Tensor, NoTarget>` types that writes each
+/// staged data tensor into its slot of one pre-sized batch tensor.
+template <>
+struct FusedStack<TensorExample>
+    : public Collation<Example<Tensor, example::NoTarget>> {
+  using StageType = std::function<Tensor(Tensor)>;
+
+  explicit FusedStack(std::vector<StageType> stages)
+      : stages_(std::move(stages)) {}
+
+  TensorExample apply_batch(std::vector<TensorExample> examples) override {
+    TORCH_CHECK(!examples.empty(), "FusedStack cannot collate an empty batch");
+    Tensor first = apply_stages(std::move(examples.front().data));
+    std::vector<int64_t> sizes = {static_cast<int64_t>(examples.size())};
+    sizes.insert(sizes.end(), first.sizes().begin(), first.sizes().end());
+    Tensor data = torch::empty(sizes, first.options());
+    data[0].copy_(first);
+    first.reset();
+    for (size_t i = 1; i < examples.size(); ++i) {
+      data[i].copy_(apply_stages(std::move(examples[i].data)));
+    }
+    return std::move(data);
+  }
+
+ private:
+  Tensor apply_stages(Tensor tensor) {
+    for (auto& stage : stages_) {
+      tensor = stage(std::move(tensor));
+    }
+    return tensor;
+  }
+
+  std::vector<StageType> stages_;
+};
+} // namespace transforms
+} // namespace data
+} // namespace torch
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <torch/data/detail/batch_tensor_pool.h>
 #include <torch/data/example.h>
 #include <torch/data/transforms/collate.h>
 #include <torch/types.h>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -44,6 +46,73 @@ struct Stack<TensorExample>
     return torch::stack(data);
   }
 };
+
+template <typename T = Example<>>
+struct PooledStack;
+
+/// A `Stack` that writes its output into tensors recycled from a
+/// `detail::BatchTensorPool` instead of allocating fresh ones per batch.
+///
+/// Copies of the transform (e.g. inside a `MapDataset` handed to a
+/// DataLoader) share one pool, so recycled batches flow between worker
+/// threads and the pool lives exactly as long as the dataset. A pool can
+/// also be passed in explicitly to share it across datasets. See
+/// `detail::BatchTensorPool` for the recycling contract; semantically the
+/// result is identical to `Stack`.
+template <>
+struct PooledStack<Example<>> : public Collation<Example<>> {
+  PooledStack() : pool_(std::make_shared<detail::BatchTensorPool>()) {}
+  explicit PooledStack(std::shared_ptr<detail::BatchTensorPool> pool)
+      : pool_(std::move(pool)) {}
+
+  Example<> apply_batch(std::vector<Example<>> examples) override {
+    std::vector<torch::Tensor> data, targets;
+    data.reserve(examples.size());
+    targets.reserve(examples.size());
+    for (auto& example : examples) {
+      data.push_back(std::move(example.data));
+      targets.push_back(std::move(example.target));
+    }
+    return {stack_pooled(data), stack_pooled(targets)};
+  }
+
+ private:
+  Tensor stack_pooled(const std::vector<Tensor>& tensors) {
+    std::vector<int64_t> sizes = {static_cast<int64_t>(tensors.size())};
+    sizes.insert(
+        sizes.end(), tensors.front().sizes().begin(), tensors.front().sizes().end());
+    Tensor out = pool_->acquire(sizes, tensors.front().options());
+    return torch::stack_out(out, tensors, /*dim=*/0);
+  }
+
+  std::shared_ptr<detail::BatchTensorPool> pool_;
+};
+
+/// A `PooledStack` for `Example<Tensor, NoTarget>` types that stacks all data
+/// tensors into one pooled tensor.
+template <>
+struct PooledStack<TensorExample>
+    : public Collation<Example<Tensor, example::NoTarget>> {
+  PooledStack() : pool_(std::make_shared<detail::BatchTensorPool>()) {}
+  explicit PooledStack(std::shared_ptr<detail::BatchTensorPool> pool)
+      : pool_(std::move(pool)) {}
+
+  TensorExample apply_batch(std::vector<TensorExample> examples) override {
+    std::vector<torch::Tensor> data;
+    data.reserve(examples.size());
+    for (auto& example : examples) {
+      data.push_back(std::move(example.data));
+    }
+    std::vector<int64_t> sizes = {static_cast<int64_t>(data.size())};
+    sizes.insert(
+        sizes.end(), data.front().sizes().begin(), data.front().sizes().end());
+    Tensor out = pool_->acquire(sizes, data.front().options());
+    return torch::stack_out(out, data, /*dim=*/0);
+  }
+
+ private:
+  std::shared_ptr<detail::BatchTensorPool> pool_;
+};
 } // namespace transforms
 } // namespace data
 } // namespace torch
@@ -47,10 +47,17 @@ class Cloneable : public virtual Module {
         "parameters as the original module after calling reset(). "
         "Are you sure you called register_parameter() inside reset() "
         "and not the constructor?");
+    // In shared-clone mode (see `Module::clone_shared()`) the replica
+    // aliases the original data instead of copying it; detach() shares the
+    // storage and the version counter, so in-place writes on either side are
+    // caught by the autograd versioning machinery.
+    const bool share_storage = detail::clone_shares_storage();
     for (const auto& parameter : named_parameters(/*recurse=*/false)) {
       auto& tensor = *parameter;
-      auto data = device && tensor.device() != *device ?
-          tensor.to(*device) : autograd::Variable(tensor).clone();
+      auto data = device && tensor.device() != *device
+          ? tensor.to(*device)
+          : share_storage ? tensor.detach()
+                          : autograd::Variable(tensor).clone();
       copy->parameters_[parameter.key()].set_data(data);
     }
     TORCH_CHECK(
@@ -61,8 +68,10 @@ class Cloneable : public virtual Module {
         "and not the constructor?");
     for (const auto& buffer : named_buffers(/*recurse=*/false)) {
       auto& tensor = *buffer;
-      auto data = device && tensor.device() != *device ?
-          tensor.to(*device) : autograd::Variable(tensor).clone();
+      auto data = device && tensor.device() != *device
+          ? tensor.to(*device)
+          : share_storage ? tensor.detach()
+                          : autograd::Variable(tensor).clone();
       copy->buffers_[buffer.key()].set_data(data);
     }
     TORCH_CHECK(
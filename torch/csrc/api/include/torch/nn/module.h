@@ -19,6 +19,14 @@
 namespace torch {
 namespace nn {
 
+namespace detail {
+/// Thread-local flag consulted by `Cloneable::clone()` to decide whether
+/// parameter and buffer data should be aliased rather than deep-copied. Set
+/// for the duration of `Module::clone_shared()`; `clone()`'s virtual
+/// signature cannot carry the mode itself.
+TORCH_API bool& clone_shares_storage();
+} // namespace detail
+
 /// The base class for all modules in PyTorch.
 ///
 /// \rst
@@ -95,6 +103,19 @@ class TORCH_API Module : public std::enable_shared_from_this<Module> {
   /// constructor.
   const std::string& name() const noexcept;
 
+  /// Like `clone()`, but the returned replica's parameters and buffers alias
+  /// this module's tensors instead of deep-copying them, making the clone
+  /// O(metadata) regardless of model size. Storage stays shared until one
+  /// side is written to; because the aliases share version counters, the
+  /// autograd versioning machinery flags in-place writes that would
+  /// invalidate the other side's captured state. Intended for
+  /// evaluation-only replicas (e.g. population-based training workers); to
+  /// promote a shared replica to a private copy, call `clone()` on it.
+  /// Passing a `device` different from the source falls back to a real copy
+  /// for the tensors that have to move.
+  std::shared_ptr<Module> clone_shared(
+      const optional<Device>& device = nullopt) const;
+
   /// Performs a recursive deep copy of the module and all its registered
   /// parameters, buffers and submodules.
   ///
@@ -304,6 +325,25 @@ class TORCH_API Module : public std::enable_shared_from_this<Module> {
   /// Recursively zeros out the `grad` value of each registered parameter.
   virtual void zero_grad();
 
+  /// Coalesces the storage of all dense parameters of this `Module` and its
+  /// submodules into one contiguous buffer per (device, dtype) and turns each
+  /// parameter into a view of its slice of that buffer. Parameter values,
+  /// identities and `requires_grad` flags are preserved (the data is swapped
+  /// via `set_data()`, like `to()`), so existing references to the parameters
+  /// remain valid. Whole-model operations such as weight decay or gradient
+  /// clipping can then run over the handful of buffers returned by
+  /// `flat_parameters()` instead of thousands of small tensors.
+  ///
+  /// Operations that replace a parameter's storage (e.g. `to()`) undo the
+  /// coalescing for that parameter; call `flatten_parameters()` again
+  /// afterwards to re-coalesce.
+  void flatten_parameters();
+
+  /// Returns the contiguous buffers created by the last call to
+  /// `flatten_parameters()` (one per (device, dtype) combination), or an
+  /// empty vector if parameters have not been flattened.
+  const std::vector<Tensor>& flat_parameters() const noexcept;
+
   /// Attempts to cast this `Module` to the given `ModuleType`.
   ///
   /// This method is useful when calling `apply()`.
@@ -592,6 +632,10 @@ class TORCH_API Module : public std::enable_shared_from_this<Module> {
   /// The registered (direct) submodules of this `Module`.
   OrderedDict<std::string, std::shared_ptr<Module>> children_;
 
+  /// The contiguous per-(device, dtype) buffers backing the parameters after
+  /// `flatten_parameters()`; empty when parameters are not flattened.
+  std::vector<Tensor> flat_parameter_buffers_;
+
   /// The module's name (e.g. "LSTM").
   mutable optional<std::string> name_;
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <torch/nn/module.h>
+#include <torch/types.h>
+
+#include <torch/csrc/ThreadLocalState.h>
+
+#include <ATen/Parallel.h>
+#include <ATen/core/ivalue.h>
+#include <c10/core/impl/DeviceGuardImplInterface.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace nn {
+namespace parallel {
+
+namespace detail {
+
+/// Captures the caller's ambient CUDA streams so that work launched on another
+/// thread is ordered on the same streams as the surrounding pipeline, and
+/// restores the worker thread's previous streams afterwards. A no-op when no
+/// CUDA backend is present.
+class AmbientStreamGuard {
+ public:
+  static std::vector<c10::Stream> current_streams() {
+    std::vector<c10::Stream> streams;
+    if (c10::impl::hasDeviceGuardImpl(c10::DeviceType::CUDA)) {
+      c10::impl::VirtualGuardImpl impl(c10::DeviceType::CUDA);
+      const auto device_count = impl.deviceCount();
+      streams.reserve(device_count);
+      for (c10::DeviceIndex index = 0; index < device_count; index++) {
+        streams.push_back(impl.getStream({c10::DeviceType::CUDA, index}));
+      }
+    }
+    return streams;
+  }
+
+  explicit AmbientStreamGuard(const std::vector<c10::Stream>& streams) {
+    original_streams_.reserve(streams.size());
+    for (const auto& stream : streams) {
+      c10::impl::VirtualGuardImpl impl(stream.device_type());
+      original_streams_.push_back(impl.exchangeStream(stream));
+    }
+  }
+
+  AmbientStreamGuard(const AmbientStreamGuard&) = delete;
+  AmbientStreamGuard& operator=(const AmbientStreamGuard&) = delete;
+
+  ~AmbientStreamGuard() {
+    for (const auto& stream : original_streams_) {
+      c10::impl::VirtualGuardImpl impl(stream.device_type());
+      impl.exchangeStream(stream);
+    }
+  }
+
+ private:
+  std::vector<c10::Stream> original_streams_;
+};
+
+} // namespace detail
+
+/// Runs `module.forward(args...)` on the JIT inter-op thread pool (the same
+/// `at::launch` pool the interpreter uses for `fork`) and returns a
+/// `c10::ivalue::Future` holding the eventual result:
+///
+///   auto future = torch::nn::parallel::forward_async(*model, input);
+///   future->addCallback([future] { postprocess(future->value().toTensor()); });
+///   ...
+///   auto output = future->value().toTensor();
+///
+/// Continuations attached via `addCallback` run inline on the worker thread
+/// when the forward completes, so pre/post-processing stages chain without an
+/// extra thread hop. The caller's thread-local state (e.g. `NoGradGuard`) and
+/// current CUDA streams are propagated to the worker, mirroring the
+/// interpreter's continuation handling; as with any cross-stream handoff, the
+/// caller is responsible for synchronizing the producing stream before
+/// consuming the result on a different one.
+///
+/// `forward()` is not virtual on `Module`, so this is a free function template
+/// over the concrete module type rather than a `Module` member; the result
+/// type of `forward` must be convertible to an `IValue` (e.g. `Tensor`). The
+/// module is captured by reference and must stay alive until the future
+/// completes; the arguments are copied into the task.
+///
+/// Exceptions thrown by `forward` are captured in the future and rethrown
+/// from `value()`.
+template <typename ModuleType, typename... Args>
+c10::intrusive_ptr<c10::ivalue::Future> forward_async(
+    ModuleType& module,
+    Args... args) {
+  using ReturnType = decltype(module.forward(std::move(args)...));
+  auto future =
+      c10::make_intrusive<c10::ivalue::Future>(c10::getTypePtr<ReturnType>());
+  auto thread_local_state = ThreadLocalState::getThreadLocalState();
+  auto streams = detail::AmbientStreamGuard::current_streams();
+  // N.B. std::bind copies the arguments into the task, keeping them (and the
+  // tensors they reference) alive until the forward has run.
+  at::launch(std::bind(
+      [&module, future, thread_local_state, streams](Args&... args) {
+        ThreadLocalStateGuard state_guard(thread_local_state);
+        detail::AmbientStreamGuard stream_guard(streams);
+        try {
+          future->markCompleted(c10::IValue(module.forward(std::move(args)...)));
+        } catch (const std::exception& error) {
+          future->markCompleted(
+              c10::ivalue::Future::FutureError(error.what()));
+        }
+      },
+      std::move(args)...));
+  return future;
+}
+
+} // namespace parallel
+} // namespace nn
+} // namespace torch
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/types.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace nn {
@@ -14,34 +19,46 @@ inline double clip_grad_norm_(
     std::vector<Tensor> parameters,
     double max_norm,
     double norm_type = 2.0) {
-  std::vector<Tensor> params_with_grad;
-
+  // Gradients are grouped per (device, dtype) and each group is reduced by a
+  // single fused pass (_foreach_global_norm) instead of one norm kernel per
+  // gradient; rescaling likewise takes one _foreach_mul_ call per group.
+  std::vector<std::pair<std::pair<Device, Dtype>, std::vector<Tensor>>> groups;
   for (const auto& param : parameters) {
     auto& grad = param.grad();
-    if (grad.defined()) {
-      params_with_grad.push_back(param);
+    if (!grad.defined()) {
+      continue;
+    }
+    auto key = std::make_pair(grad.device(), grad.scalar_type());
+    auto group = std::find_if(
+        groups.begin(), groups.end(), [&](const auto& g) {
+          return g.first == key;
+        });
+    if (group == groups.end()) {
+      groups.emplace_back(key, std::vector<Tensor>());
+      group = std::prev(groups.end());
     }
+    group->second.push_back(grad.data());
   }
+
+  const bool is_inf = norm_type == std::numeric_limits<double>::infinity();
   double total_norm = 0.0;
-  if (norm_type == std::numeric_limits<double>::infinity()) {
-    for (const auto& param : params_with_grad) {
-      auto param_max = param.grad().data().abs().max().item().toDouble();
-      if (param_max > total_norm) {
-        total_norm = param_max;
-      }
-    }
-  } else {
-    for (const auto& param : params_with_grad) {
-      auto param_norm = param.grad().data().norm(norm_type);
-      total_norm += std::pow(param_norm.item().toDouble(), norm_type);
+  for (const auto& group : groups) {
+    auto group_norm =
+        at::_foreach_global_norm(group.second, norm_type).item().toDouble();
+    if (is_inf) {
+      total_norm = std::max(total_norm, group_norm);
+    } else {
+      total_norm += std::pow(group_norm, norm_type);
     }
+  }
+  if (!is_inf) {
     total_norm = std::pow(total_norm, 1.0 / norm_type);
   }
 
   auto clip_coef = max_norm / (total_norm + 1e-6);
   if (clip_coef < 1) {
-    for (auto& param : params_with_grad) {
-      param.grad().data().mul_(clip_coef);
+    for (const auto& group : groups) {
+      at::_foreach_mul_(group.second, clip_coef);
     }
   }
   return total_norm;
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <torch/nn/module.h>
+#include <torch/types.h>
+
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace nn {
+namespace utils {
+
+// Temporarily replaces the data of a module's parameters with externally
+// supplied tensors (in `parameters()` order), restoring the originals on
+// destruction. The swap goes through `set_data()`, so only each variable's
+// data pointer changes — parameter identity is preserved and no OrderedDict
+// is rebuilt, which keeps per-call bookkeeping O(#parameters) pointer swaps.
+// Gradients do not flow back into the supplied tensors (the data swap is
+// invisible to autograd); this is intended for inference-style use such as
+// evaluating per-sample generated weights.
+class ParameterSwapGuard {
+ public:
+  ParameterSwapGuard(Module& module, const std::vector<Tensor>& parameters)
+      : module_parameters_(module.parameters(/*recurse=*/true)) {
+    TORCH_CHECK(
+        module_parameters_.size() == parameters.size(),
+        "Expected ",
+        module_parameters_.size(),
+        " replacement parameters, but got ",
+        parameters.size());
+    original_data_.reserve(module_parameters_.size());
+    for (size_t i = 0; i < module_parameters_.size(); i++) {
+      original_data_.push_back(module_parameters_[i].data());
+      module_parameters_[i].set_data(parameters[i]);
+    }
+  }
+
+  ParameterSwapGuard(const ParameterSwapGuard&) = delete;
+  ParameterSwapGuard& operator=(const ParameterSwapGuard&) = delete;
+
+  ~ParameterSwapGuard() {
+    for (size_t i = 0; i < module_parameters_.size(); i++) {
+      module_parameters_[i].set_data(original_data_[i]);
+    }
+  }
+
+ private:
+  std::vector<Tensor> module_parameters_;
+  std::vector<Tensor> original_data_;
+};
+
+// Calls `module.forward(args...)` with the module's parameters replaced by
+// `parameters` for the duration of the call, without mutating module state:
+//
+//   auto output = functional_call(*linear, generated_weights, input);
+template <typename ModuleType, typename... Args>
+auto functional_call(
+    ModuleType& module,
+    const std::vector<Tensor>& parameters,
+    Args&&... args)
+    -> decltype(module.forward(std::forward<Args>(args)...)) {
+  ParameterSwapGuard guard(module, parameters);
+  return module.forward(std::forward<Args>(args)...);
+}
+
+} // namespace utils
+} // namespace nn
+} // namespace torch
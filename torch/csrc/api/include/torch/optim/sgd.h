@@ -8,6 +8,9 @@
 #include <torch/types.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -16,6 +19,9 @@ namespace serialize {
 class OutputArchive;
 class InputArchive;
 } // namespace serialize
+namespace autograd {
+struct Node;
+} // namespace autograd
 } // namespace torch
 
 namespace torch {
@@ -60,6 +66,21 @@ class TORCH_API SGD : public Optimizer {
 
   torch::Tensor step(LossClosure closure = nullptr) override;
 
+  /// Registers a post hook on each parameter's gradient accumulator that
+  /// applies this parameter's update as soon as its gradient has been
+  /// accumulated, while the gradient is still hot in cache, instead of
+  /// revisiting every gradient in a second full pass when `step()` runs.
+  /// While fused step mode is enabled, `step()` must not be called (the
+  /// updates are applied during `backward()`); calling `zero_grad()` between
+  /// iterations remains the caller's responsibility. Parameters added via
+  /// `add_param_group()` after enabling are not covered until the mode is
+  /// disabled and re-enabled.
+  void enable_fused_step();
+  void disable_fused_step();
+  bool fused_step_enabled() const noexcept {
+    return !fused_step_hooks_.empty();
+  }
+
   void save(serialize::OutputArchive& archive) const override;
   void load(serialize::InputArchive& archive) override;
 
@@ -68,6 +89,18 @@ class TORCH_API SGD : public Optimizer {
   static void serialize(Self& self, Archive& archive) {
     _TORCH_OPTIM_SERIALIZE_WITH_TEMPLATE_ARG(SGD);
   }
+
+  void update_parameter(Tensor& p, const SGDOptions& options);
+
+  // One entry per hooked parameter: the hook key and the gradient
+  // accumulator it was installed on. The accumulator is only held as a
+  // weak_ptr in the autograd metadata of the variable, so it is kept alive
+  // here for as long as the hook is installed.
+  std::vector<std::pair<uintptr_t, std::shared_ptr<torch::autograd::Node>>>
+      fused_step_hooks_;
+  // Fused-step hooks for different parameters may fire concurrently from
+  // multiple autograd worker threads; serializes access to state_.
+  std::mutex state_mutex_;
 };
 } // namespace optim
 } // namespace torch
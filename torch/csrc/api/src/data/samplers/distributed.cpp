@@ -24,6 +24,40 @@ DistributedRandomSampler::DistributedRandomSampler(
   reset(size_);
 }
 
+DistributedRandomSampler::DistributedRandomSampler(
+    const DistributedRandomSampler& other)
+    : DistributedSampler(
+          other.size_,
+          other.num_replicas_,
+          other.rank_,
+          other.allow_duplicates_),
+      begin_index_(other.begin_index_),
+      end_index_(other.end_index_),
+      sample_index_(other.sample_index_),
+      all_indices_(other.all_indices_) {
+  epoch_ = other.epoch_;
+  // The background buffer is deliberately not copied; the copy shuffles (and
+  // restarts prefetching) on its next reset().
+}
+
+DistributedRandomSampler& DistributedRandomSampler::operator=(
+    const DistributedRandomSampler& other) {
+  if (this != &other) {
+    // Joins any in-flight helper thread before dropping its result.
+    next_indices_ = std::future<std::vector<size_t>>();
+    size_ = other.size_;
+    num_replicas_ = other.num_replicas_;
+    rank_ = other.rank_;
+    epoch_ = other.epoch_;
+    allow_duplicates_ = other.allow_duplicates_;
+    begin_index_ = other.begin_index_;
+    end_index_ = other.end_index_;
+    sample_index_ = other.sample_index_;
+    all_indices_ = other.all_indices_;
+  }
+  return *this;
+}
+
 optional<std::vector<size_t>> DistributedRandomSampler::next(
     size_t batch_size) {
   if (sample_index_ == end_index_) {
@@ -42,28 +76,62 @@ optional<std::vector<size_t>> DistributedRandomSampler::next(
 }
 
 void DistributedRandomSampler::reset(optional<size_t> new_size) {
-  size_ = new_size.value_or(size_);  
-  populate_indices();
-  
-  std::mt19937 rand(epoch_);
-  std::shuffle(all_indices_.begin(), all_indices_.end(), rand);
+  size_ = new_size.value_or(size_);
+  if (next_indices_.valid() && prepared_epoch_ == epoch_ &&
+      prepared_size_ == size_) {
+    // The helper thread already shuffled this epoch during the previous one;
+    // the transition is just a buffer swap.
+    all_indices_ = next_indices_.get();
+  } else {
+    if (next_indices_.valid()) {
+      // The preparation is stale (set_epoch() jumped or the size changed);
+      // join the helper and discard its result.
+      next_indices_.get();
+    }
+    all_indices_ =
+        build_shuffled_indices(size_, num_replicas_, allow_duplicates_, epoch_);
+  }
+  size_t num_local_samples = local_sample_count();
+  begin_index_ = rank_ * num_local_samples;
+  end_index_ = begin_index_ + num_local_samples;
   sample_index_ = begin_index_;
+
+  prefetch_next_epoch();
 }
 
-void DistributedRandomSampler::populate_indices() {
-  size_t num_local_samples = local_sample_count();
+std::vector<size_t> DistributedRandomSampler::build_shuffled_indices(
+    size_t size,
+    size_t num_replicas,
+    bool allow_duplicates,
+    size_t epoch) {
+  size_t num_local_samples = allow_duplicates
+      ? (size + num_replicas - 1) / num_replicas
+      : size / num_replicas;
   size_t sample_count =
-      num_replicas_ == 1 ? size_ : num_local_samples * num_replicas_;
-  all_indices_.resize(sample_count);
-  std::iota(std::begin(all_indices_), std::end(all_indices_), 0);
-  for (size_t i = size_; i < sample_count; ++i) {
+      num_replicas == 1 ? size : num_local_samples * num_replicas;
+  std::vector<size_t> indices(sample_count);
+  std::iota(std::begin(indices), std::end(indices), 0);
+  for (size_t i = size; i < sample_count; ++i) {
     // we may have added duplicate samples to make all
     // replicas to have the same number of samples.
-    all_indices_[i] = i - size_;
+    indices[i] = i - size;
   }
-  begin_index_ = rank_ * num_local_samples;
-  end_index_ = begin_index_ + num_local_samples;
-  sample_index_ = begin_index_;
+  std::mt19937 rand(epoch);
+  std::shuffle(indices.begin(), indices.end(), rand);
+  return indices;
+}
+
+void DistributedRandomSampler::prefetch_next_epoch() {
+  prepared_epoch_ = epoch_ + 1;
+  prepared_size_ = size_;
+  const size_t size = size_;
+  const size_t num_replicas = num_replicas_;
+  const bool allow_duplicates = allow_duplicates_;
+  const size_t epoch = prepared_epoch_;
+  next_indices_ =
+      std::async(std::launch::async, [size, num_replicas, allow_duplicates, epoch] {
+        return build_shuffled_indices(size, num_replicas, allow_duplicates, epoch);
+      });
 }
 
 void DistributedRandomSampler::save(serialize::OutputArchive& archive) const {
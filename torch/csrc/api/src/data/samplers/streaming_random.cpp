@@ -0,0 +1,131 @@
+#include <torch/data/samplers/streaming_random.h>
+#include <torch/serialize/archive.h>
+#include <torch/types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace samplers {
+namespace {
+/// SplitMix64-style finalizer: a cheap keyed hash with full 64-bit avalanche,
+/// used as the Feistel round function.
+uint64_t mix(uint64_t value, uint64_t key) {
+  uint64_t x = value + key + 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+} // namespace
+
+StreamingRandomSampler::StreamingRandomSampler(
+    int64_t size,
+    optional<uint64_t> seed)
+    : size_(size),
+      engine_(seed.value_or(static_cast<uint64_t>(
+          torch::randint(std::numeric_limits<int64_t>::max(), {1}, torch::kInt64)
+              .item<int64_t>()))) {
+  reset(size_);
+}
+
+void StreamingRandomSampler::reset(optional<size_t> new_size) {
+  size_ = new_size.value_or(static_cast<size_t>(size_));
+  recompute_domain();
+  for (auto& key : keys_) {
+    key = (static_cast<uint64_t>(engine_()) << 32) | engine_();
+  }
+  index_ = 0;
+}
+
+optional<std::vector<size_t>> StreamingRandomSampler::next(size_t batch_size) {
+  AT_ASSERT(index_ <= size_);
+  const size_t remaining_indices = size_ - index_;
+  if (remaining_indices == 0) {
+    return nullopt;
+  }
+  std::vector<size_t> index_batch(std::min(batch_size, remaining_indices));
+  for (auto& index : index_batch) {
+    // Cycle walking: the Feistel domain is less than 4x the dataset size, so
+    // re-permuting until the value lands in [0, size) terminates after a few
+    // expected iterations and keeps the restricted map a bijection.
+    uint64_t value = permute(static_cast<uint64_t>(index_++));
+    while (value >= static_cast<uint64_t>(size_)) {
+      value = permute(value);
+    }
+    index = static_cast<size_t>(value);
+  }
+  return index_batch;
+}
+
+void StreamingRandomSampler::save(serialize::OutputArchive& archive) const {
+  archive.write(
+      "index",
+      torch::tensor(index_, torch::kInt64),
+      /*is_buffer=*/true);
+  archive.write(
+      "size",
+      torch::tensor(size_, torch::kInt64),
+      /*is_buffer=*/true);
+  auto keys = torch::empty({static_cast<int64_t>(kRounds)}, torch::kInt64);
+  for (size_t i = 0; i < kRounds; ++i) {
+    keys[i] = static_cast<int64_t>(keys_[i]);
+  }
+  archive.write(
+      "keys",
+      keys,
+      /*is_buffer=*/true);
+}
+
+void StreamingRandomSampler::load(serialize::InputArchive& archive) {
+  auto tensor = torch::empty(1, torch::kInt64);
+  archive.read(
+      "index",
+      tensor,
+      /*is_buffer=*/true);
+  index_ = tensor.item<int64_t>();
+  archive.read(
+      "size",
+      tensor,
+      /*is_buffer=*/true);
+  size_ = tensor.item<int64_t>();
+  auto keys = torch::empty({static_cast<int64_t>(kRounds)}, torch::kInt64);
+  archive.read(
+      "keys",
+      keys,
+      /*is_buffer=*/true);
+  for (size_t i = 0; i < kRounds; ++i) {
+    keys_[i] = static_cast<uint64_t>(keys[i].item<int64_t>());
+  }
+  recompute_domain();
+}
+
+size_t StreamingRandomSampler::index() const noexcept {
+  return index_;
+}
+
+void StreamingRandomSampler::recompute_domain() {
+  half_bits_ = 1;
+  while ((static_cast<uint64_t>(1) << (2 * half_bits_)) <
+         static_cast<uint64_t>(size_)) {
+    ++half_bits_;
+  }
+  half_mask_ = (static_cast<uint64_t>(1) << half_bits_) - 1;
+}
+
+uint64_t StreamingRandomSampler::permute(uint64_t value) const {
+  uint64_t left = value >> half_bits_;
+  uint64_t right = value & half_mask_;
+  for (size_t round = 0; round < kRounds; ++round) {
+    const uint64_t next_right = left ^ (mix(right, keys_[round]) & half_mask_);
+    left = right;
+    right = next_right;
+  }
+  return (left << half_bits_) | right;
+}
+
+} // namespace samplers
+} // namespace data
+} // namespace torch
@@ -1,6 +1,7 @@
 #include <torch/nn/module.h>
 
 #include <torch/ordered_dict.h>
+#include <torch/utils.h>
 
 #include <torch/csrc/autograd/generated/VariableType.h>
 
@@ -12,6 +13,8 @@
 #include <ostream>
 #include <string>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace nn {
@@ -66,6 +69,13 @@ const std::string& Module::name() const noexcept {
   return *name_;
 }
 
+namespace detail {
+bool& clone_shares_storage() {
+  static thread_local bool value = false;
+  return value;
+}
+} // namespace detail
+
 std::shared_ptr<Module> Module::clone(const optional<Device>& device) const {
   AT_ERROR(
       "clone() has not been implemented for ",
@@ -75,6 +85,21 @@ std::shared_ptr<Module> Module::clone(const optional<Device>& device) const {
       "> instead of torch::nn::Module to inherit the ability to clone.");
 }
 
+std::shared_ptr<Module> Module::clone_shared(
+    const optional<Device>& device) const {
+  // The flag stays set across the recursive submodule clones, which re-enter
+  // clone() on the same thread.
+  struct SharedCloneGuard {
+    SharedCloneGuard() {
+      detail::clone_shares_storage() = true;
+    }
+    ~SharedCloneGuard() {
+      detail::clone_shares_storage() = false;
+    }
+  } guard;
+  return clone(device);
+}
+
 void Module::apply(const ModuleApplyFunction& function) {
   function(*this);
   apply_to_submodules(
@@ -250,6 +275,55 @@ bool Module::is_training() const noexcept {
   return is_training_;
 }
 
+void Module::flatten_parameters() {
+  NoGradGuard no_grad;
+  flat_parameter_buffers_.clear();
+
+  // Group the (recursively collected) parameters per (device, dtype); each
+  // group is packed into one contiguous buffer. Undefined and non-strided
+  // parameters cannot be expressed as views and are left untouched.
+  std::vector<std::pair<std::pair<Device, Dtype>, std::vector<Tensor>>> groups;
+  for (const auto& parameter : named_parameters(/*recurse=*/true)) {
+    const auto& p = parameter.value();
+    if (!p.defined() || p.layout() != kStrided) {
+      continue;
+    }
+    auto key = std::make_pair(p.device(), p.scalar_type());
+    auto group = std::find_if(
+        groups.begin(), groups.end(), [&](const auto& g) {
+          return g.first == key;
+        });
+    if (group == groups.end()) {
+      groups.emplace_back(key, std::vector<Tensor>());
+      group = std::prev(groups.end());
+    }
+    group->second.push_back(p);
+  }
+
+  for (auto& group : groups) {
+    int64_t total_numel = 0;
+    for (const auto& p : group.second) {
+      total_numel += p.numel();
+    }
+    auto flat = torch::empty({total_numel}, group.second[0].options());
+    int64_t offset = 0;
+    for (auto& p : group.second) {
+      auto slice = flat.narrow(0, offset, p.numel());
+      slice.copy_(p.reshape(-1));
+      // Swapping the data (rather than the parameter entry) keeps the
+      // variable's identity, so member fields holding the parameter and any
+      // optimizer state keyed on it stay valid.
+      p.set_data(slice.view(p.sizes()));
+      offset += p.numel();
+    }
+    flat_parameter_buffers_.push_back(std::move(flat));
+  }
+}
+
+const std::vector<Tensor>& Module::flat_parameters() const noexcept {
+  return flat_parameter_buffers_;
+}
+
 void Module::zero_grad() {
   for (auto& child : children_) {
     child.value()->zero_grad();
@@ -6,13 +6,100 @@
 #include <torch/utils.h>
 
 #include <ATen/ATen.h>
+#include <ATen/Parallel.h>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace optim {
 
+namespace {
+
+// Fused CPU kernel for the sparse-gradient Adam step: for every nonzero row
+// of the (coalesced) gradient it gathers the moment rows, updates them and
+// scatters the parameter update back in one parallel pass, instead of
+// issuing a separate kernel for each of the gather/mul/add/sqrt/div steps.
+// Rows of a coalesced gradient are unique, so the rows partition the work
+// and no synchronization is needed.
+template <typename scalar_t>
+void fused_sparse_adam_step_cpu(
+    Tensor& p,
+    const Tensor& grad_indices,
+    const Tensor& grad_values,
+    Tensor& exp_avg,
+    Tensor& exp_avg_sq,
+    double lr,
+    double beta1,
+    double beta2,
+    double eps,
+    double bias_correction1,
+    double bias_correction2) {
+  int64_t nnz = grad_values.size(0);
+  int64_t row_size = grad_values.numel() / std::max<int64_t>(nnz, 1);
+
+  auto* indices_data = grad_indices.data_ptr<int64_t>();
+  auto* values_data = grad_values.data_ptr<scalar_t>();
+  auto* p_data = p.data_ptr<scalar_t>();
+  auto* exp_avg_data = exp_avg.data_ptr<scalar_t>();
+  auto* exp_avg_sq_data = exp_avg_sq.data_ptr<scalar_t>();
+
+  scalar_t step_size = static_cast<scalar_t>(lr / bias_correction1);
+  scalar_t sqrt_bias_correction2 =
+      static_cast<scalar_t>(std::sqrt(bias_correction2));
+
+  at::parallel_for(
+      0,
+      nnz,
+      at::internal::GRAIN_SIZE / std::max<int64_t>(row_size, 1),
+      [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; i++) {
+          int64_t row = indices_data[i];
+          const scalar_t* grad_row = values_data + i * row_size;
+          scalar_t* p_row = p_data + row * row_size;
+          scalar_t* exp_avg_row = exp_avg_data + row * row_size;
+          scalar_t* exp_avg_sq_row = exp_avg_sq_data + row * row_size;
+          for (int64_t k = 0; k < row_size; k++) {
+            scalar_t g = grad_row[k];
+            scalar_t m = exp_avg_row[k] =
+                beta1 * exp_avg_row[k] + (1 - beta1) * g;
+            scalar_t v = exp_avg_sq_row[k] =
+                beta2 * exp_avg_sq_row[k] + (1 - beta2) * g * g;
+            p_row[k] -= step_size * m /
+                (std::sqrt(v) / sqrt_bias_correction2 + static_cast<scalar_t>(eps));
+          }
+        }
+      });
+}
+
+bool can_use_fused_sparse_adam_step(
+    const Tensor& p,
+    const Tensor& grad,
+    const Tensor& exp_avg,
+    const Tensor& exp_avg_sq) {
+  return p.device().is_cpu() && grad.sparse_dim() == 1 &&
+      (p.scalar_type() == kFloat || p.scalar_type() == kDouble) &&
+      p.is_contiguous() && exp_avg.is_contiguous() &&
+      exp_avg_sq.is_contiguous();
+}
+
+// One _foreach_adam_step_ call's worth of tensors. Bias corrections depend on
+// the per-parameter step count, so batches are keyed by (device, dtype, step);
+// after the first step all parameters created together share one batch.
+struct FusedAdamBatch {
+  std::vector<Tensor> params;
+  std::vector<Tensor> grads;
+  std::vector<Tensor> exp_avgs;
+  std::vector<Tensor> exp_avg_sqs;
+  std::vector<Tensor> max_exp_avg_sqs;
+};
+
+} // namespace
+
 AdamOptions::AdamOptions(double lr) : lr_(lr) {}
 
 bool operator==(const AdamOptions& lhs, const AdamOptions& rhs) {
@@ -69,12 +156,15 @@ Tensor Adam::step(LossClosure closure)  {
     loss = closure();
   }
   for (auto& group : param_groups_) {
+    // Dense updates for a group are batched per (device, dtype, step) into a
+    // single _foreach_adam_step_ call; sparse gradients keep their own path.
+    std::vector<std::pair<std::tuple<Device, ScalarType, int64_t>, FusedAdamBatch>>
+        batches;
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
       }
       auto grad = p.grad();
-      TORCH_CHECK(!grad.is_sparse(), "Adam does not support sparse gradients"/*, please consider SparseAdam instead*/);
       auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
       auto& options = static_cast<AdamOptions&>(group.options());
 
@@ -105,26 +195,105 @@ Tensor Adam::step(LossClosure closure)  {
       auto bias_correction1 = 1 - std::pow(beta1, state.step());
       auto bias_correction2 = 1 - std::pow(beta2, state.step());
 
-      if(options.weight_decay() != 0) {
-        grad = grad.add(p, options.weight_decay());
+      if (grad.is_sparse()) {
+        TORCH_CHECK(options.weight_decay() == 0,
+            "Adam does not support weight_decay with sparse gradients");
+        TORCH_CHECK(!options.amsgrad(),
+            "Adam does not support amsgrad with sparse gradients");
+
+        grad = grad.coalesce();
+        auto grad_indices = grad._indices();
+        auto grad_values = grad._values();
+
+        if (can_use_fused_sparse_adam_step(p, grad, exp_avg, exp_avg_sq)) {
+          AT_DISPATCH_FLOATING_TYPES(p.scalar_type(), "fused_sparse_adam", [&] {
+            fused_sparse_adam_step_cpu<scalar_t>(
+                p, grad_indices.contiguous(), grad_values.contiguous(),
+                exp_avg, exp_avg_sq, options.lr(), beta1, beta2, options.eps(),
+                bias_correction1, bias_correction2);
+          });
+          continue;
+        }
+
+        // Generic fallback: same lazy per-row update expressed with tensor
+        // ops, for non-CPU tensors and exotic layouts.
+        auto make_sparse = [&](const Tensor& values) -> Tensor {
+          return at::sparse_coo_tensor(grad_indices, values, grad.sizes(), grad.options());
+        };
+        auto old_exp_avg_values = exp_avg.sparse_mask(grad)._values();
+        auto exp_avg_update_values = grad_values.sub(old_exp_avg_values).mul_(1 - beta1);
+        exp_avg.add_(make_sparse(exp_avg_update_values));
+        auto old_exp_avg_sq_values = exp_avg_sq.sparse_mask(grad)._values();
+        auto exp_avg_sq_update_values =
+            grad_values.mul(grad_values).sub_(old_exp_avg_sq_values).mul_(1 - beta2);
+        exp_avg_sq.add_(make_sparse(exp_avg_sq_update_values));
+
+        auto numer = exp_avg_update_values.add_(old_exp_avg_values);
+        auto denom = exp_avg_sq_update_values.add_(old_exp_avg_sq_values)
+                         .sqrt_()
+                         .div_(std::sqrt(bias_correction2))
+                         .add_(options.eps());
+        auto step_size = options.lr() / bias_correction1;
+        p.add_(make_sparse(numer.div_(denom)), -step_size);
+        continue;
       }
 
-      // Decay the first and second moment running average coefficient
-      exp_avg.mul_(beta1).add_(grad, 1 - beta1);
-      exp_avg_sq.mul_(beta2).addcmul_(grad, grad, 1 - beta2);
-
-      Tensor denom;
-      if(options.amsgrad()) {
-        // Maintains the maximum of all 2nd moment running avg. till now
-        torch::max_out(max_exp_avg_sq, exp_avg_sq, max_exp_avg_sq);
-        // Use the max. for normalizing running avg. of gradient
-        denom = (max_exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
-      } else {
-        denom = (exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
+      if (!p.is_floating_point() || grad.scalar_type() != p.scalar_type() ||
+          grad.device() != p.device()) {
+        if(options.weight_decay() != 0) {
+          grad = grad.add(p, options.weight_decay());
+        }
+
+        // Decay the first and second moment running average coefficient
+        exp_avg.mul_(beta1).add_(grad, 1 - beta1);
+        exp_avg_sq.mul_(beta2).addcmul_(grad, grad, 1 - beta2);
+
+        Tensor denom;
+        if(options.amsgrad()) {
+          // Maintains the maximum of all 2nd moment running avg. till now
+          torch::max_out(max_exp_avg_sq, exp_avg_sq, max_exp_avg_sq);
+          // Use the max. for normalizing running avg. of gradient
+          denom = (max_exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
+        } else {
+          denom = (exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
+        }
+
+        auto step_size = options.lr() / bias_correction1;
+        p.addcdiv_(exp_avg, denom, -step_size);
+        continue;
       }
 
-      auto step_size = options.lr() / bias_correction1;
-      p.addcdiv_(exp_avg, denom, -step_size);
+      auto key = std::make_tuple(p.device(), p.scalar_type(), state.step());
+      auto batch = std::find_if(
+          batches.begin(), batches.end(),
+          [&](const auto& b) { return b.first == key; });
+      if (batch == batches.end()) {
+        batches.emplace_back(key, FusedAdamBatch());
+        batch = std::prev(batches.end());
+      }
+      batch->second.params.push_back(p);
+      batch->second.grads.push_back(grad);
+      batch->second.exp_avgs.push_back(exp_avg);
+      batch->second.exp_avg_sqs.push_back(exp_avg_sq);
+      if (options.amsgrad()) {
+        batch->second.max_exp_avg_sqs.push_back(max_exp_avg_sq);
+      }
+    }
+    auto& options = static_cast<AdamOptions&>(group.options());
+    for (auto& batch : batches) {
+      at::_foreach_adam_step_(
+          batch.second.params,
+          batch.second.grads,
+          batch.second.exp_avgs,
+          batch.second.exp_avg_sqs,
+          batch.second.max_exp_avg_sqs,
+          options.lr(),
+          std::get<0>(options.betas()),
+          std::get<1>(options.betas()),
+          options.weight_decay(),
+          options.eps(),
+          options.amsgrad(),
+          std::get<2>(batch.first));
     }
   }
   return loss;
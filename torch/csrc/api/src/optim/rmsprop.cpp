@@ -6,11 +6,29 @@
 
 #include <ATen/ATen.h>
 
+#include <algorithm>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace optim {
 
+namespace {
+
+// One _foreach_rmsprop_step_ call's worth of tensors; all entries share a
+// device and dtype. grad_avgs is used only when centered, momentum_buffers
+// only when momentum > 0.
+struct FusedRMSpropBatch {
+  std::vector<Tensor> params;
+  std::vector<Tensor> grads;
+  std::vector<Tensor> square_avgs;
+  std::vector<Tensor> grad_avgs;
+  std::vector<Tensor> momentum_buffers;
+};
+
+} // namespace
+
 RMSpropOptions::RMSpropOptions(double lr) : lr_(lr) {}
 
 bool operator==(const RMSpropOptions& lhs, const RMSpropOptions& rhs) {
@@ -71,6 +89,11 @@ Tensor RMSprop::step(LossClosure closure)  {
     loss = closure();
   }
   for (auto& group : param_groups_) {
+    // Dense updates are batched per (device, dtype) into one
+    // _foreach_rmsprop_step_ call; state buffers are zero-initialized, so a
+    // parameter's first step can be batched like any other.
+    std::vector<std::pair<std::pair<Device, ScalarType>, FusedRMSpropBatch>>
+        batches;
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
@@ -100,31 +123,68 @@ Tensor RMSprop::step(LossClosure closure)  {
 
       state.step(state.step() + 1);
 
-      if (options.weight_decay() != 0) {
-        grad = grad.add(p, options.weight_decay());
-      }
+      if (!p.is_floating_point() || grad.scalar_type() != p.scalar_type() ||
+          grad.device() != p.device()) {
+        if (options.weight_decay() != 0) {
+          grad = grad.add(p, options.weight_decay());
+        }
 
-      square_avg.mul_(alpha).addcmul_(grad, grad, 1 - alpha);
+        square_avg.mul_(alpha).addcmul_(grad, grad, 1 - alpha);
 
-      Tensor avg;
-      if (options.centered()) {
-        auto& grad_avg = state.grad_avg();
-        grad_avg.mul_(alpha).add_(grad, 1-alpha);
-        avg = square_avg.addcmul(grad_avg, grad_avg, -1).sqrt_().add_(options.eps());
-      } else {
-        avg = square_avg.sqrt().add_(options.eps());
+        Tensor avg;
+        if (options.centered()) {
+          auto& grad_avg = state.grad_avg();
+          grad_avg.mul_(alpha).add_(grad, 1-alpha);
+          avg = square_avg.addcmul(grad_avg, grad_avg, -1).sqrt_().add_(options.eps());
+        } else {
+          avg = square_avg.sqrt().add_(options.eps());
+        }
+
+        if (options.momentum() > 0) {
+          auto& buf = state.momentum_buffer();
+          buf.mul_(options.momentum()).addcdiv_(grad, avg);
+          // Need to avoid version tracking for parameter.
+          p.add_(buf, -options.lr());
+        } else {
+          // Need to avoid version tracking for parameter.
+          p.addcdiv_(grad, avg, -options.lr());
+        }
+        continue;
       }
 
+      auto key = std::make_pair(p.device(), p.scalar_type());
+      auto batch = std::find_if(
+          batches.begin(), batches.end(),
+          [&](const auto& b) { return b.first == key; });
+      if (batch == batches.end()) {
+        batches.emplace_back(key, FusedRMSpropBatch());
+        batch = std::prev(batches.end());
+      }
+      batch->second.params.push_back(p);
+      batch->second.grads.push_back(grad);
+      batch->second.square_avgs.push_back(square_avg);
+      if (options.centered()) {
+        batch->second.grad_avgs.push_back(state.grad_avg());
+      }
       if (options.momentum() > 0) {
-        auto& buf = state.momentum_buffer();
-        buf.mul_(options.momentum()).addcdiv_(grad, avg);
-        // Need to avoid version tracking for parameter.
-        p.add_(buf, -options.lr());
-      } else {
-        // Need to avoid version tracking for parameter.
-        p.addcdiv_(grad, avg, -options.lr());
+        batch->second.momentum_buffers.push_back(state.momentum_buffer());
       }
     }
+    auto& options = static_cast<RMSpropOptions&>(group.options());
+    for (auto& batch : batches) {
+      at::_foreach_rmsprop_step_(
+          batch.second.params,
+          batch.second.grads,
+          batch.second.square_avgs,
+          batch.second.grad_avgs,
+          batch.second.momentum_buffers,
+          options.lr(),
+          options.alpha(),
+          options.eps(),
+          options.weight_decay(),
+          options.momentum(),
+          options.centered());
+    }
   }
   return loss;
 }
@@ -1,6 +1,9 @@
 #include <torch/optim/sgd.h>
 
+#include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/function_hook.h>
 #include <torch/csrc/autograd/variable.h>
+#include <torch/csrc/utils/memory.h>
 #include <torch/nn/pimpl.h>
 #include <torch/optim/optimizer.h>
 #include <torch/optim/serialize.h>
@@ -9,11 +12,46 @@
 
 #include <ATen/ATen.h>
 
+#include <algorithm>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace torch {
 namespace optim {
 
+namespace {
+
+// Turns a lambda without input/output into a torch::autograd::FunctionPostHook
+// suitable for a gradient accumulator.
+class FusedStepPostHook : public torch::autograd::FunctionPostHook {
+  using variable_list = std::vector<torch::autograd::Variable>;
+
+ public:
+  /* implicit */ FusedStepPostHook(std::function<void(void)> fn)
+      : fn_(std::move(fn)) {}
+
+  variable_list operator()(
+      const variable_list& outputs,
+      const variable_list& /* unused */) override {
+    fn_();
+    return outputs;
+  }
+
+ private:
+  std::function<void(void)> fn_;
+};
+
+// One _foreach_sgd_step_ call's worth of tensors; all entries share a device
+// and dtype. momentum_buffers stays empty when momentum is disabled.
+struct FusedSgdBatch {
+  std::vector<Tensor> params;
+  std::vector<Tensor> grads;
+  std::vector<Tensor> momentum_buffers;
+};
+
+} // namespace
+
 SGDOptions::SGDOptions(double lr) : lr_(lr) {}
 
 bool operator==(const SGDOptions& lhs, const SGDOptions& rhs) {
@@ -52,7 +90,53 @@ void SGDParamState::serialize(torch::serialize::InputArchive& archive) {
   _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(Tensor, momentum_buffer);
 }
 
+void SGD::update_parameter(Tensor& p, const SGDOptions& options) {
+  NoGradGuard no_grad;
+  auto weight_decay = options.weight_decay();
+  auto momentum = options.momentum();
+  auto dampening = options.dampening();
+  auto nesterov = options.nesterov();
+
+  auto d_p = p.grad().data();
+  if (weight_decay != 0) {
+    d_p = d_p.add(p.data(), weight_decay);
+  }
+  if (momentum != 0) {
+    Tensor buf;
+    bool first_update = false;
+    {
+      // Hooks for different parameters may run concurrently from multiple
+      // autograd worker threads; only the state_ map itself needs a lock,
+      // each parameter's buffers are touched by exactly one hook.
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
+      if(param_state == state_.end()) {
+        first_update = true;
+        buf = torch::clone(d_p).detach();
+        auto state = std::make_unique<SGDParamState>();
+        state->momentum_buffer(buf);
+        state_[c10::guts::to_string(p.unsafeGetTensorImpl())] = std::move(state);
+      } else {
+        buf = static_cast<SGDParamState&>(*param_state->second).momentum_buffer();
+      }
+    }
+    if (!first_update) {
+      buf.mul_(momentum).add_(d_p, 1 - dampening);
+    }
+    if (nesterov) {
+      d_p = d_p.add(buf, momentum);
+    } else {
+      d_p = buf;
+    }
+  }
+  p.data().add_(d_p, -1 * options.lr());
+}
+
 Tensor SGD::step(LossClosure closure)  {
+  TORCH_CHECK(
+      !fused_step_enabled(),
+      "SGD::step() should not be called while fused step mode is enabled; "
+      "parameter updates are applied during backward()");
   NoGradGuard no_grad;
   Tensor loss = {};
   if (closure != nullptr) {
@@ -61,43 +145,96 @@ Tensor SGD::step(LossClosure closure)  {
   }
   for (auto& group : param_groups_) {
     auto& options = static_cast<SGDOptions&>(group.options());
-    auto weight_decay = options.weight_decay();
-    auto momentum = options.momentum();
-    auto dampening = options.dampening();
-    auto nesterov = options.nesterov();
-
+    // Dense floating-point parameters are batched per (device, dtype) into a
+    // single _foreach_sgd_step_ call instead of a per-parameter op sequence.
+    // With momentum, a parameter's very first update initializes the buffer
+    // to a copy of the gradient, so parameters without state stay on the
+    // scalar path for that step.
+    std::vector<std::pair<std::pair<Device, ScalarType>, FusedSgdBatch>> batches;
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
       }
-      auto d_p = p.grad().data();
-      if (weight_decay != 0) {
-        d_p = d_p.add(p.data(), weight_decay);
+      auto grad = p.grad();
+      if (grad.is_sparse() || !p.is_floating_point() ||
+          grad.scalar_type() != p.scalar_type() || grad.device() != p.device()) {
+        update_parameter(p, options);
+        continue;
       }
-      if (momentum != 0) {
-        Tensor buf;
+      Tensor buf;
+      if (options.momentum() != 0) {
+        std::lock_guard<std::mutex> lock(state_mutex_);
         auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
-        if(param_state == state_.end()) {
-          buf = torch::clone(d_p).detach();
-          auto state = std::make_unique<SGDParamState>();
-          state->momentum_buffer(buf);
-          state_[c10::guts::to_string(p.unsafeGetTensorImpl())] = std::move(state);
+        if (param_state == state_.end()) {
+          buf = Tensor();
         } else {
           buf = static_cast<SGDParamState&>(*param_state->second).momentum_buffer();
-          buf.mul_(momentum).add_(d_p, 1 - dampening);
-        }
-        if (nesterov) {
-          d_p = d_p.add(buf, momentum);
-        } else {
-          d_p = buf;
         }
       }
-      p.data().add_(d_p, -1 * options.lr());
+      if (options.momentum() != 0 && !buf.defined()) {
+        update_parameter(p, options);
+        continue;
+      }
+      auto key = std::make_pair(p.device(), p.scalar_type());
+      auto batch = std::find_if(
+          batches.begin(), batches.end(),
+          [&](const auto& b) { return b.first == key; });
+      if (batch == batches.end()) {
+        batches.emplace_back(key, FusedSgdBatch());
+        batch = std::prev(batches.end());
+      }
+      batch->second.params.push_back(p);
+      batch->second.grads.push_back(grad);
+      if (options.momentum() != 0) {
+        batch->second.momentum_buffers.push_back(buf);
+      }
+    }
+    for (auto& batch : batches) {
+      at::_foreach_sgd_step_(
+          batch.second.params,
+          batch.second.grads,
+          batch.second.momentum_buffers,
+          options.lr(),
+          options.momentum(),
+          options.dampening(),
+          options.weight_decay(),
+          options.nesterov());
     }
   }
   return loss;
 }
 
+void SGD::enable_fused_step() {
+  if (fused_step_enabled()) {
+    return;
+  }
+  for (size_t group_index = 0; group_index < param_groups_.size(); ++group_index) {
+    for (auto& p : param_groups_[group_index].params()) {
+      auto grad_accumulator = torch::autograd::impl::grad_accumulator(p);
+      // The options are looked up per invocation (by group index rather than
+      // reference, since add_param_group() may reallocate param_groups_) so
+      // learning rate changes take effect like they would with step().
+      auto key = grad_accumulator->add_post_hook(
+          torch::make_unique<FusedStepPostHook>([this, group_index, p]() mutable {
+            if (p.grad().defined()) {
+              update_parameter(
+                  p, static_cast<SGDOptions&>(param_groups_[group_index].options()));
+            }
+          }));
+      fused_step_hooks_.emplace_back(key, std::move(grad_accumulator));
+    }
+  }
+}
+
+void SGD::disable_fused_step() {
+  for (auto& hook : fused_step_hooks_) {
+    TORCH_INTERNAL_ASSERT(
+        hook.second->del_post_hook(hook.first),
+        "fused step hook was removed behind our back");
+  }
+  fused_step_hooks_.clear();
+}
+
 void SGD::save(serialize::OutputArchive& archive) const {
   serialize(*this, archive);
 }
@@ -20,6 +20,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -155,6 +156,69 @@ static thread_local std::shared_ptr<ReadyQueue> local_ready_queue = nullptr;
 // the leaf streams with the default streams is sufficient to implement
 // the historic behavior.
 
+// Note [CPU work stealing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// All CPU work for a backward call normally funnels through the single
+// cpu_ready_queue_ of its GraphTask and is processed by the calling thread
+// (plus any reentrant pool threads sharing that queue). For graphs with wide
+// CPU fan-out that queue serializes nodes that could run concurrently.
+//
+// Setting TORCH_AUTOGRAD_CPU_WORKERS=N spawns N additional CPU worker
+// threads, each pinned to its own ReadyQueue. Ready CPU tasks are spread
+// round-robin across the owner's queue and the helper queues, and a helper
+// whose local queue runs dry steals from its siblings before going to sleep
+// on its own queue. Shutdown tasks are never stolen because they must
+// terminate the worker owning the queue they were pushed to.
+//
+// Helper i runs with worker_device == CPU_HELPER_DEVICE - i. Giving each
+// helper a distinct id keeps the existing completion hand-off working: a
+// worker finishing the last task of a graph it doesn't own still sends the
+// dummy wake-up NodeTask to the owner's queue, and a helper that owns a
+// reentrant graph task is woken through its own queue like any other owner.
+//
+// The mode is off by default. It is not supported together with the
+// distributed engine's async continuations, which assume all CPU work stays
+// on the GraphTask's own queue.
+
+// Number of extra CPU worker threads; see Note [CPU work stealing]
+static int num_cpu_helper_threads() {
+  static int num_threads = []() {
+    const char* value = std::getenv("TORCH_AUTOGRAD_CPU_WORKERS");
+    return value ? std::max(0, std::atoi(value)) : 0;
+  }();
+  return num_threads;
+}
+
+// Note [Parallel reentrant backwards]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A reentrant backward below max_recursion_depth_ runs inline: the calling
+// worker drives thread_main for the nested graph task on its own ready queue.
+// For activation checkpointing this serializes the checkpointed segment's
+// backward with every other branch of the outer graph, since one thread
+// alternates between the two.
+//
+// With TORCH_AUTOGRAD_PARALLEL_REENTRANT set, the nested graph task is
+// additionally handed to the reentrant thread pool with pool_helper_mode_
+// set. The pool thread attaches to the same ready queue as the owner and
+// drains it concurrently (reentrant_helper_main), so the recompute segment's
+// backward overlaps with unrelated graph branches instead of interleaving
+// with them.
+//
+// The helper never blocks on the queue: the completion hand-off in
+// thread_main only guarantees a wake-up for the queue's owner, so a helper
+// sleeping in pop() could be stranded. Instead it uses try_pop and returns
+// to the pool when no work is immediately available, leaving the tail of the
+// graph to the owner. For the same reason it puts back (rather than
+// consumes) dummy wake-up tasks and never takes shutdown tasks.
+
+static bool parallel_reentrant_enabled() {
+  static bool enabled = []() {
+    const char* value = std::getenv("TORCH_AUTOGRAD_PARALLEL_REENTRANT");
+    return value && std::atoi(value) != 0;
+  }();
+  return enabled;
+}
+
 int NodeTask::getReentrantDepth() const {
   std::shared_ptr<GraphTask> graph_task = base_.lock();
   if (graph_task) {
@@ -209,6 +273,17 @@ auto ReadyQueue::pop() -> NodeTask {
   return task;
 }
 
+auto ReadyQueue::try_pop(bool steal) -> c10::optional<NodeTask> {
+  // Lock mutex for accesses to heap_
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (heap_.empty() || (steal && heap_.top().isShutdownTask_)) {
+    return c10::nullopt;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto task = std::move(const_cast<NodeTask&>(heap_.top())); heap_.pop();
+  return c10::optional<NodeTask>(std::move(task));
+}
+
 bool ReadyQueue::empty() const {
   // Lock mutex for accesses to heap_
   std::unique_lock<std::mutex> lock(mutex_);
@@ -225,10 +300,16 @@ Engine::~Engine() {
   for (auto& queue: device_ready_queues_) {
     noBackward =  noBackward && queue->empty();
   }
+  for (auto& queue: cpu_helper_queues_) {
+    noBackward =  noBackward && queue->empty();
+  }
   if (noBackward) {
     for (auto& queue : device_ready_queues_) {
      queue->pushShutdownTask();
     }
+    for (auto& queue : cpu_helper_queues_) {
+     queue->pushShutdownTask();
+    }
     // Do not wait for termination of global threads on Windows
     // Because CRT terminates DLL threads before calling
     // global object destructors
@@ -249,15 +330,15 @@ void Engine::release_workers() {
 }
 
 void Engine::set_device(int device) {
-  // NB: We MUST NOT construct the guard for device CPU,
-  // as in some settings we compile with cuda, but
+  // NB: We MUST NOT construct the guard for the virtual devices (CPU_DEVICE,
+  // CPU helper ids), as in some settings we compile with cuda, but
   // have lazy stubs for CUDA functionality (so actually
   // attempting to setup a guard(CPU_DEVICE) will cause an
   // error, because it will still query cudaGetDevice).
   //
   // Don't use DeviceGuard here because its destructor may be called before the
   // device is reset. This is fine because the device is thread local.
-  if (device != CPU_DEVICE) {
+  if (device >= 0) {
     for (size_t i = 0; i < static_cast<size_t>(c10::DeviceType::COMPILE_TIME_MAX_DEVICE_TYPES); i++) {
       auto* impl = c10::impl::device_guard_impl_registry[i].load();
       if (impl && device < impl->deviceCount()) {
@@ -372,7 +453,11 @@ auto Engine::thread_main(
       // Scope this block of execution since NodeTask is not needed after this
       // block and can be deallocated (release any references to grad tensors
       // as part of inputs_).
-      NodeTask task = local_ready_queue->pop();
+      // CPU helper threads try their own queue first and then steal from
+      // their siblings; see Note [CPU work stealing]
+      NodeTask task = worker_device <= CPU_HELPER_DEVICE
+          ? pop_cpu_helper_task()
+          : local_ready_queue->pop();
       // This will only work if the worker is running a non backward task
       // TODO Needs to be fixed this to work in all cases
       if (task.isShutdownTask_) {
@@ -461,7 +546,59 @@ void Engine::reentrant_thread_init() {
     // set the local_ready_queue to the ready queue on the graph_task->owner_ device
     local_ready_queue = ready_queue_by_index(graph_task, graph_task->owner_);
     total_depth = graph_task->reentrant_depth_;
-    thread_main(graph_task, /* reentrant thread*/ true);
+    if (graph_task->pool_helper_mode_) {
+      // assist the owning thread instead of replacing it;
+      // see Note [Parallel reentrant backwards]
+      reentrant_helper_main(graph_task);
+    } else {
+      thread_main(graph_task, /* reentrant thread*/ true);
+    }
+  }
+}
+
+// See Note [Parallel reentrant backwards]
+void Engine::reentrant_helper_main(const std::shared_ptr<GraphTask>& graph_task) {
+  auto queue = ready_queue_by_index(graph_task, graph_task->owner_);
+  while (graph_task->outstanding_tasks_ > 0) {
+    // steal == true also refuses shutdown tasks, which must terminate the
+    // thread owning this queue, not a helper
+    auto task = queue->try_pop(/* steal */ true);
+    if (!task) {
+      // Nothing ready right now. Return to the pool instead of blocking: the
+      // completion wake-up is only guaranteed to reach the queue's owner, so
+      // a helper sleeping in pop() could be stranded.
+      break;
+    }
+    std::shared_ptr<GraphTask> local_graph_task;
+    if (!(local_graph_task = task->base_.lock())) {
+      continue;
+    }
+    if (!task->fn_) {
+      // A dummy wake-up meant for the queue's owner; put it back (it was
+      // already counted in outstanding_tasks_ when first pushed) and bow out.
+      queue->push(std::move(*task), /* incrementOutstandingTasks */ false);
+      break;
+    }
+    if (!local_graph_task->has_error_.load()) {
+      AutoGradMode grad_mode(local_graph_task->grad_mode_);
+      try {
+        GraphTaskGuard guard(local_graph_task);
+        evaluate_function(local_graph_task, task->fn_.get(), task->inputs_);
+      } catch (std::exception& e) {
+        thread_on_exception(local_graph_task, task->fn_, e);
+      }
+    }
+    --local_graph_task->outstanding_tasks_;
+    if (graph_task_completed(local_graph_task)) {
+      mark_graph_task_completed(local_graph_task);
+      // The owner may be sleeping on this queue waiting for the completion
+      // hand-off. The dummy push in thread_main is skipped when
+      // worker_device matches the owner (as it does for this helper), so
+      // send the wake-up explicitly on its behalf.
+      std::atomic_thread_fence(std::memory_order_release);
+      ready_queue_by_index(local_graph_task, local_graph_task->owner_)
+          ->push(NodeTask(local_graph_task, nullptr, InputBuffer(0)));
+    }
   }
 }
 
@@ -744,6 +881,108 @@ void Engine::evaluate_function(
   }
 }
 
+// Note [Captured backward replay]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Setting TORCH_AUTOGRAD_CAPTURE_GRAPH=1 caches the dependency counts
+// computed for a retained graph (keep_graph=true), keyed by the node behind
+// the first root edge. A later backward over the same root re-walks the
+// graph only to compute a structural fingerprint (node count plus a hash of
+// the node pointers in traversal order); on a match the dependency map is
+// rebuilt by bulk insertion from the capture instead of per-edge counting.
+//
+// Node objects are recreated on every forward, so a capture can only ever
+// match for a static graph the user keeps alive across backward calls;
+// anything else fingerprints differently and falls back to normal counting.
+// The fingerprint walks only the currently live graph and pointers from the
+// capture are used only after a match, so a stale capture is inert rather
+// than dangerous. The mode is off by default.
+
+static bool graph_capture_enabled() {
+  static bool enabled = []() {
+    const char* value = std::getenv("TORCH_AUTOGRAD_CAPTURE_GRAPH");
+    return value && std::atoi(value) != 0;
+  }();
+  return enabled;
+}
+
+// FNV-1a over the node pointers reachable from root, in traversal order;
+// also reports the number of distinct nodes. The root itself is excluded
+// since the GraphRoot wrapper is recreated for every backward call.
+static uint64_t graph_fingerprint(Node* root, size_t& num_nodes) {
+  uint64_t hash = 14695981039346656037ull;
+  std::unordered_set<Node*> seen;
+  std::vector<Node*> queue{root};
+  while (!queue.empty()) {
+    auto fn = queue.back();
+    queue.pop_back();
+    for (const auto& edge : fn->next_edges()) {
+      if (auto next_ptr = edge.function.get()) {
+        hash = (hash ^ reinterpret_cast<uintptr_t>(next_ptr)) *
+            1099511628211ull;
+        const bool was_inserted = seen.insert(next_ptr).second;
+        if (was_inserted) queue.push_back(next_ptr);
+      }
+    }
+  }
+  num_nodes = seen.size();
+  return hash;
+}
+
+bool Engine::try_replay_captured_graph(Node* root, GraphTask& task) {
+  if (!graph_capture_enabled() || root->next_edges().empty()) {
+    return false;
+  }
+  Node* key = root->next_edges()[0].function.get();
+  if (!key) {
+    return false;
+  }
+  CapturedGraph capture;
+  {
+    std::lock_guard<std::mutex> lock(graph_capture_lock_);
+    auto it = captured_graphs_.find(key);
+    if (it == captured_graphs_.end()) {
+      return false;
+    }
+    // copy the capture out so the graph walk below runs unlocked
+    capture = it->second;
+  }
+  size_t num_nodes = 0;
+  if (graph_fingerprint(root, num_nodes) != capture.fingerprint ||
+      num_nodes != capture.num_nodes) {
+    return false;
+  }
+  auto& dependencies = task.dependencies_;
+  dependencies.reserve(capture.dependencies.size());
+  for (const auto& entry : capture.dependencies) {
+    dependencies.emplace(entry.first, entry.second);
+  }
+  return true;
+}
+
+void Engine::maybe_capture_graph(Node* root, GraphTask& task) {
+  // without keep_graph the nodes can die after this pass and their
+  // addresses be reused, so a capture could never usefully match
+  if (!graph_capture_enabled() || !task.keep_graph_ ||
+      root->next_edges().empty()) {
+    return;
+  }
+  Node* key = root->next_edges()[0].function.get();
+  if (!key) {
+    return;
+  }
+  CapturedGraph capture;
+  capture.fingerprint = graph_fingerprint(root, capture.num_nodes);
+  capture.dependencies.assign(
+      task.dependencies_.begin(), task.dependencies_.end());
+  std::lock_guard<std::mutex> lock(graph_capture_lock_);
+  // keep the cache bounded; retained static graphs are few in practice
+  constexpr size_t kMaxCapturedGraphs = 64;
+  if (captured_graphs_.size() >= kMaxCapturedGraphs) {
+    captured_graphs_.clear();
+  }
+  captured_graphs_[key] = std::move(capture);
+}
+
 /* Computes the number of dependencies for each function which requires grad */
 auto Engine::compute_dependencies(Node* root, GraphTask& task) -> void {
   // Just to make sure that they will never be added to the queue again
@@ -790,7 +1029,11 @@ auto Engine::execute(const edge_list& roots,
 
   // Now compute the dependencies for all executable functions and queue the root
   auto graph_root = std::make_shared<GraphRoot>(roots, inputs);
-  compute_dependencies(graph_root.get(), *graph_task);
+  // See Note [Captured backward replay]
+  if (!try_replay_captured_graph(graph_root.get(), *graph_task)) {
+    compute_dependencies(graph_root.get(), *graph_task);
+    maybe_capture_graph(graph_root.get(), *graph_task);
+  }
 
   if (!outputs.empty()) {
     graph_task->init_to_execute(*graph_root, outputs);
@@ -916,6 +1159,16 @@ std::shared_ptr<FutureVariableList> Engine::execute_with_graph_task(
       // complete!
       ++current_depth;
       lock.unlock();
+
+      if (parallel_reentrant_enabled()) {
+        // Also hand this graph task to a pool thread that drains the same
+        // ready queue, so a reentrant (e.g. checkpoint recompute) backward
+        // overlaps with unrelated branches of the outer graph.
+        // See Note [Parallel reentrant backwards]
+        graph_task->pool_helper_mode_ = true;
+        add_thread_pool_task(graph_task);
+      }
+
       thread_main(graph_task, /* reentrant_thread */ true);
       --current_depth;
       --total_depth;
@@ -1038,11 +1291,39 @@ size_t Engine::ready_queue_size(const std::shared_ptr<GraphTask>& graph_task, at
   return ready_queue(graph_task, device)->size();
 }
 
+NodeTask Engine::pop_cpu_helper_task() {
+  // fast path: work on the local queue
+  auto task = local_ready_queue->try_pop();
+  if (task) {
+    return std::move(*task);
+  }
+  // steal from sibling helper queues before sleeping on the local queue;
+  // see Note [CPU work stealing]
+  for (auto& queue : cpu_helper_queues_) {
+    if (queue == local_ready_queue) {
+      continue;
+    }
+    task = queue->try_pop(/* steal */ true);
+    if (task) {
+      return std::move(*task);
+    }
+  }
+  return local_ready_queue->pop();
+}
+
 // CPU ready queue is per GraphTask, but CUDA device ready queues are shared across all graph tasks
 auto Engine::ready_queue(const std::shared_ptr<GraphTask>& graph_task, at::Device device) -> std::shared_ptr<ReadyQueue>{
   if (device.type() == at::kCPU) {
-    // return the cpu ready queue memorized in GraphTask
     TORCH_INTERNAL_ASSERT(graph_task);
+    // Spread ready CPU tasks round-robin across the owner's queue and the
+    // helper queues; see Note [CPU work stealing]
+    if (!cpu_helper_queues_.empty()) {
+      auto idx = next_cpu_queue_.fetch_add(1) % (cpu_helper_queues_.size() + 1);
+      if (idx > 0) {
+        return cpu_helper_queues_[idx - 1];
+      }
+    }
+    // return the cpu ready queue memorized in GraphTask
     return graph_task->cpu_ready_queue_;
   } else {
     // See Note [Allocating GPUs to autograd threads]
@@ -1051,8 +1332,9 @@ auto Engine::ready_queue(const std::shared_ptr<GraphTask>& graph_task, at::Devic
 }
 
 auto Engine::ready_queue_by_index(const std::shared_ptr<GraphTask>& graph_task, int device_index) -> std::shared_ptr<ReadyQueue> {
-  if (device_index == CPU_DEVICE) {
-    // return the cpu ready queue memorized in GraphTask
+  if (device_index == CPU_DEVICE || device_index <= CPU_HELPER_DEVICE) {
+    // return the cpu ready queue memorized in GraphTask; for a helper-owned
+    // (reentrant) graph task this is the helper's own local queue
     TORCH_INTERNAL_ASSERT(graph_task);
     return graph_task->cpu_ready_queue_;
   } else {
@@ -1082,11 +1364,24 @@ auto Engine::start_device_threads() -> void {
 
   thread_pool_shared_ = std::make_shared<ThreadPoolShared>();
 
-  non_reentrant_device_thread_count_.store(num_devices);
+  // optional extra CPU workers, each with its own queue that siblings can
+  // steal from; see Note [CPU work stealing]
+  const int num_cpu_helpers = num_cpu_helper_threads();
+  cpu_helper_queues_ = std::vector<std::shared_ptr<ReadyQueue>>(num_cpu_helpers);
+  for (auto& queue : cpu_helper_queues_) {
+    queue.reset(new ReadyQueue());
+  }
+
+  non_reentrant_device_thread_count_.store(num_devices + num_cpu_helpers);
   for (int i = 0; i < num_devices; ++i) {
     std::thread t(&Engine::thread_init, this, i, device_ready_queues_[i]);
     t.detach();
   }
+  for (int i = 0; i < num_cpu_helpers; ++i) {
+    std::thread t(
+        &Engine::thread_init, this, CPU_HELPER_DEVICE - i, cpu_helper_queues_[i]);
+    t.detach();
+  }
 }
 
 void Engine::add_thread_pool_task(const std::weak_ptr<GraphTask>& graph_task) {
@@ -8,8 +8,10 @@
 #include <torch/csrc/autograd/anomaly_mode.h>
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
+#include <torch/csrc/autograd/graph_task_arena.h>
 #include <torch/csrc/autograd/input_buffer.h>
 #include <torch/csrc/utils/future.h>
+#include <c10/util/Optional.h>
 
 #include <deque>
 #include <exception>
@@ -36,6 +38,10 @@ void validate_outputs(
 
 static constexpr int NO_DEVICE = -2;
 static constexpr int CPU_DEVICE = -1;
+// CPU helper worker i runs with worker_device == CPU_HELPER_DEVICE - i, so
+// any worker_device at or below this value identifies a helper thread.
+// See Note [CPU work stealing] in engine.cpp
+static constexpr int CPU_HELPER_DEVICE = -3;
 
 // GraphTask holds metadata needed for a single execution of backward()
 struct GraphTask {
@@ -47,11 +53,29 @@ struct GraphTask {
   bool keep_graph_;
   bool grad_mode_;
 
+  // Arena backing the per-backward bookkeeping maps below: their nodes are
+  // carved from reusable slabs instead of individual mallocs and reclaimed
+  // in bulk when the GraphTask dies. Must be declared before the maps.
+  std::shared_ptr<GraphTaskArena> arena_ = std::make_shared<GraphTaskArena>();
+
+  using NotReadyMap = std::unordered_map<
+      Node*,
+      InputBuffer,
+      std::hash<Node*>,
+      std::equal_to<Node*>,
+      GraphTaskAllocator<std::pair<Node* const, InputBuffer>>>;
+  using DependenciesMap = std::unordered_map<
+      Node*,
+      int,
+      std::hash<Node*>,
+      std::equal_to<Node*>,
+      GraphTaskAllocator<std::pair<Node* const, int>>>;
+
   // To protect reads/writes to not_ready_, dependencies_, captured_vars_,
   // has_error_, future_result_, cpu_ready_queue_, and leaf_streams.
   std::mutex mutex_;
-  std::unordered_map<Node*, InputBuffer> not_ready_;
-  std::unordered_map<Node*, int> dependencies_;
+  NotReadyMap not_ready_;
+  DependenciesMap dependencies_;
 
   struct ExecInfo {
     struct Capture {
@@ -92,6 +116,12 @@ struct GraphTask {
   // The number of parent graph tasks for this graph task
   const int reentrant_depth_;
 
+  // When true, this reentrant task was handed to the thread pool as an extra
+  // helper that drains the owner's ready queue alongside the owning thread,
+  // rather than as a replacement for it.
+  // See Note [Parallel reentrant backwards]
+  bool pool_helper_mode_ = false;
+
   bool can_checkpoint() {
     return exec_info_.empty();
   }
@@ -138,6 +168,8 @@ struct GraphTask {
         outstanding_tasks_(0),
         keep_graph_(keep_graph),
         grad_mode_(grad_mode),
+        not_ready_(NotReadyMap::allocator_type(arena_)),
+        dependencies_(DependenciesMap::allocator_type(arena_)),
         owner_(NO_DEVICE),
         reentrant_depth_(reentrant_depth),
         exit_on_error_(exit_on_error),
@@ -207,6 +239,10 @@ struct ReadyQueue {
   void push(NodeTask item, bool incrementOutstandingTasks = true);
   void pushShutdownTask();
   NodeTask pop();
+  // Non-blocking pop; returns nullopt when the queue is empty. When steal is
+  // true, shutdown tasks are also refused, since those must terminate the
+  // worker thread owning this queue rather than whoever steals them.
+  c10::optional<NodeTask> try_pop(bool steal = false);
   bool empty() const;
   size_t size() const;
 };
@@ -279,6 +315,23 @@ struct TORCH_API Engine {
  protected:
   Engine();
   void compute_dependencies(Node* root, GraphTask& task);
+
+  // Captured dependency counts for a retained graph, so repeated backwards
+  // over a static graph skip per-edge dependency counting.
+  // See Note [Captured backward replay]
+  struct CapturedGraph {
+    size_t num_nodes = 0;
+    uint64_t fingerprint = 0;
+    std::vector<std::pair<Node*, int>> dependencies;
+  };
+
+  // Fills task.dependencies_ from a matching capture; returns false when the
+  // mode is off, nothing was captured for this root, or the fingerprint
+  // doesn't match the current graph.
+  bool try_replay_captured_graph(Node* root, GraphTask& task);
+  // Captures task.dependencies_ for replay; no-op unless the mode is on and
+  // the graph is being retained.
+  void maybe_capture_graph(Node* root, GraphTask& task);
   void evaluate_function(
       std::shared_ptr<GraphTask>& graph_task,
       Node* func,
@@ -307,15 +360,36 @@ struct TORCH_API Engine {
       const std::shared_ptr<GraphTask>& task,
       bool reentrant_thread);
   void reentrant_thread_init();
+  // Drains the owner's ready queue alongside the owning thread without ever
+  // blocking on it. See Note [Parallel reentrant backwards]
+  void reentrant_helper_main(const std::shared_ptr<GraphTask>& graph_task);
   void add_thread_pool_task(const std::weak_ptr<GraphTask>& graph_task);
   void set_device(int device);
   void initialize_device_threads_pool();
 
+  // Pops a task for a CPU helper thread: its own queue first, then a steal
+  // attempt from sibling helper queues before blocking.
+  // See Note [CPU work stealing]
+  NodeTask pop_cpu_helper_task();
+
   // Ensures device_ready_queues_ are initialized only once
   std::once_flag start_device_threads_flag_;
   // Safe to read device_ready_queues_ without synchronization after intialization
   std::vector<std::shared_ptr<ReadyQueue>> device_ready_queues_;
 
+  // Captures keyed by the first root edge's node; protected by
+  // graph_capture_lock_. See Note [Captured backward replay]
+  std::mutex graph_capture_lock_;
+  std::unordered_map<Node*, CapturedGraph> captured_graphs_;
+
+  // Per-helper CPU ready queues; empty unless the work-stealing mode is
+  // enabled. Safe to read without synchronization after initialization.
+  // See Note [CPU work stealing]
+  std::vector<std::shared_ptr<ReadyQueue>> cpu_helper_queues_;
+  // Round-robin cursor for spreading ready CPU tasks across the owner's
+  // queue and cpu_helper_queues_
+  std::atomic<size_t> next_cpu_queue_{0};
+
   std::vector<std::function<void()>> final_callbacks_;
   // To protect reads and writes to final_callbacks_
   std::mutex post_callbacks_lock_;
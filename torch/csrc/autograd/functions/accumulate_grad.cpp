@@ -7,6 +7,7 @@
 #include <torch/csrc/autograd/functions/utils.h>
 
 #include <cstdint>
+#include <cstdlib>
 #include <stdexcept>
 #include <utility>
 
@@ -14,12 +15,37 @@ using at::Tensor;
 
 namespace torch { namespace autograd {
 
+namespace {
+
+// With TORCH_PREALLOCATE_GRADS set, AccumulateGrad materializes a zero-filled
+// .grad buffer when the accumulator is constructed. The accumulator is created
+// early in the first forward pass, well before activations drive memory to its
+// peak, so the first backward accumulates in place instead of cloning (or
+// stealing and retaining) the incoming gradient at peak usage. The cost is one
+// extra add per parameter on the first backward.
+bool preallocate_grads() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_PREALLOCATE_GRADS");
+    return env && std::atoi(env) != 0;
+  }();
+  return enabled;
+}
+
+} // namespace
+
 // AccumulateGrad sets sequence_nr to the max value so it's always called
 // ASAP during backwards.
 AccumulateGrad::AccumulateGrad(Variable variable_)
     : Node(/*sequence_nr=*/UINT64_MAX)
     , variable(std::move(variable_)) {
   add_input_metadata(variable);
+  if (preallocate_grads() && !variable.is_sparse() &&
+      !variable.grad().defined()) {
+    // Preallocate in the variable's own layout so the buffer already obeys
+    // Note [Gradient Layout Contract].
+    variable.grad() =
+        at::zeros_like(variable, variable.suggest_memory_format());
+  }
 }
 
 auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/utils/grad_layout_contract.h>
 #include <torch/csrc/autograd/variable.h>
 #include <torch/csrc/WindowsTorchApiMacro.h>
 
@@ -22,6 +23,20 @@ struct TORCH_API AccumulateGrad : public Node {
     return new_grad;
   }
 
+  // Note [Gradient Layout Contract]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // AccumulateGrad tries to stash a strided (non-sparse) param's grad with
+  // the same strides as the param itself. If the param's memory is
+  // non-overlapping and dense, the stashed grad's strides match the param's;
+  // otherwise the grad is stashed rowmajor contiguous. In particular, a
+  // channels-last param accumulates a channels-last grad, so consumers
+  // (optimizer steps, allreduce) read the grad with the same access pattern
+  // they use for the param and don't pay a per-step NCHW<->NHWC conversion.
+  // Backward kernels usually produce grads in the input's suggested format
+  // already (see InputMetadata::zeros_like); when one doesn't, we pay a
+  // single strided copy here rather than a layout shuffle on every
+  // downstream use.
+
   // Given a variable with its current grad as variable_grad, accumulates
   // new_grad into variable_grad if in place accumulation is possible.
   // Otherwise, uses 'update_grad' to update the grad for the variable.
@@ -44,13 +59,19 @@ struct TORCH_API AccumulateGrad : public Node {
       size_t num_expected_refs,
       const T& update_grad) {
     if (!variable_grad.defined()) {
+      // Stealing below is also safe when grad mode is enabled, as long as
+      // new_grad itself does not require grad: detaching a tensor with no
+      // graph attached is semantically a no-op, so the stolen buffer is
+      // indistinguishable from the clone we would otherwise make.
+      bool can_steal = !GradMode::is_enabled() || !new_grad.requires_grad();
       // under following condition, we can avoid clone()
-      if (!GradMode::is_enabled() && !new_grad.is_sparse() &&
-          new_grad.is_contiguous() &&
+      if (can_steal && !new_grad.is_sparse() &&
+          utils::obeys_layout_contract(new_grad, variable) &&
           new_grad.use_count() <= num_expected_refs) {
         // first check it is in first-order grad only mode
-        // then check not sparse before is_contiguous
-        // then check contiguous, otherwise later in place accumulation may fail
+        // then check not sparse before the layout check
+        // then check the layout contract, so the accumulated grad keeps the
+        // variable's memory format (see Note [Gradient Layout Contract])
         // and lastly, check if the use_count is less than or equal to the
         // number of references we expect before grabbing it. The number of
         // references we expect is basically internal structures that are
@@ -58,7 +79,7 @@ struct TORCH_API AccumulateGrad : public Node {
         // exposed to the user.
         update_grad(new_grad.detach());
       } else if (
-          !GradMode::is_enabled() && new_grad.is_sparse() &&
+          can_steal && new_grad.is_sparse() &&
           new_grad._indices().is_contiguous() &&
           new_grad._values().is_contiguous() &&
           // Use count for indices and values should always be <=1 since the
@@ -84,7 +105,7 @@ struct TORCH_API AccumulateGrad : public Node {
         if (new_grad.is_sparse()) {
           update_grad(new_grad.clone());
         } else {
-          update_grad(new_grad.clone(at::MemoryFormat::Contiguous));
+          update_grad(utils::clone_obey_contract(new_grad, variable));
         }
       }
     } else if (!GradMode::is_enabled()) {
@@ -0,0 +1,116 @@
+#pragma once
+
+// A bump allocator backing the transient per-backward bookkeeping of a
+// GraphTask. A backward pass allocates one map node per graph Node for
+// dependency counting and input buffering and frees them all when the pass
+// completes; carving those nodes out of slabs avoids hammering malloc on
+// workloads that run many small backwards per second. Freed slabs are
+// recycled through a thread-local freelist, so consecutive iterations reuse
+// the same memory instead of going back to the system allocator.
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace torch { namespace autograd {
+
+struct GraphTaskArena {
+  static constexpr size_t kSlabSize = 64 * 1024;
+  // Slabs kept for reuse per thread; beyond this they are simply freed.
+  static constexpr size_t kMaxFreeSlabs = 64;
+
+  GraphTaskArena() = default;
+  GraphTaskArena(const GraphTaskArena&) = delete;
+  GraphTaskArena& operator=(const GraphTaskArena&) = delete;
+
+  ~GraphTaskArena() {
+    auto& freelist = slab_freelist();
+    for (auto& slab : slabs_) {
+      if (freelist.size() >= kMaxFreeSlabs) {
+        break;
+      }
+      freelist.emplace_back(std::move(slab));
+    }
+  }
+
+  // NB: individual deallocation is a no-op; all memory is reclaimed when
+  // the arena is destroyed. Callers are expected to hold bounded amounts of
+  // memory (one allocation per graph node) for the duration of a backward.
+  void* allocate(size_t bytes, size_t alignment) {
+    offset_ = (offset_ + alignment - 1) & ~(alignment - 1);
+    if (!current_ || offset_ + bytes > kSlabSize) {
+      if (bytes > kSlabSize) {
+        // oversized requests get their own exactly-sized block, which is
+        // not recycled
+        oversized_.emplace_back(new char[bytes]);
+        return oversized_.back().get();
+      }
+      auto& freelist = slab_freelist();
+      if (!freelist.empty()) {
+        slabs_.emplace_back(std::move(freelist.back()));
+        freelist.pop_back();
+      } else {
+        slabs_.emplace_back(new char[kSlabSize]);
+      }
+      current_ = slabs_.back().get();
+      offset_ = 0;
+    }
+    void* result = current_ + offset_;
+    offset_ += bytes;
+    return result;
+  }
+
+ private:
+  static std::vector<std::unique_ptr<char[]>>& slab_freelist() {
+    static thread_local std::vector<std::unique_ptr<char[]>> freelist;
+    return freelist;
+  }
+
+  char* current_ = nullptr;
+  size_t offset_ = 0;
+  std::vector<std::unique_ptr<char[]>> slabs_;
+  std::vector<std::unique_ptr<char[]>> oversized_;
+};
+
+// Minimal std allocator over a shared GraphTaskArena, for containers whose
+// lifetime matches the owning GraphTask.
+template <typename T>
+class GraphTaskAllocator {
+ public:
+  using value_type = T;
+
+  explicit GraphTaskAllocator(std::shared_ptr<GraphTaskArena> arena)
+      : arena_(std::move(arena)) {}
+
+  template <typename U>
+  /* implicit */ GraphTaskAllocator(const GraphTaskAllocator<U>& other)
+      : arena_(other.arena()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* /* p */, size_t /* n */) {
+    // memory is reclaimed in bulk when the arena is destroyed
+  }
+
+  const std::shared_ptr<GraphTaskArena>& arena() const {
+    return arena_;
+  }
+
+ private:
+  std::shared_ptr<GraphTaskArena> arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const GraphTaskAllocator<T>& a, const GraphTaskAllocator<U>& b) {
+  return a.arena() == b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const GraphTaskAllocator<T>& a, const GraphTaskAllocator<U>& b) {
+  return !(a == b);
+}
+
+}} // namespace torch::autograd
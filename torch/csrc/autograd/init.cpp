@@ -4,6 +4,11 @@
 #include <torch/csrc/utils/pybind.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <ATen/autocast_mode.h>
+#include <torch/csrc/autograd/kernel_attribution.h>
+#include <torch/csrc/autograd/latency_histogram.h>
+#include <torch/csrc/autograd/memory_profiler.h>
+#include <torch/csrc/autograd/op_replay_log.h>
+#include <torch/csrc/autograd/perf_counters.h>
 #include <torch/csrc/autograd/profiler.h>
 #include <torch/csrc/autograd/python_function.h>
 #include <torch/csrc/autograd/function.h>
@@ -37,7 +42,8 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
       .value("NVTX", ProfilerState::NVTX);
 
   py::class_<ProfilerConfig>(m, "ProfilerConfig")
-      .def(py::init<ProfilerState, bool>());
+      .def(py::init<ProfilerState, bool>())
+      .def(py::init<ProfilerState, bool, double>());
 
   py::class_<Event>(m, "ProfilerEvent")
       .def("kind", &Event::kind)
@@ -55,6 +61,50 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
 
   m.def("_run_before_callbacks", runBeforeCallbacks);
 
+  m.def("_enable_op_latency_histograms", enableOpLatencyHistograms);
+  m.def("_disable_op_latency_histograms", disableOpLatencyHistograms);
+  m.def("_op_latency_histograms_enabled", opLatencyHistogramsEnabled);
+  m.def("_get_op_latency_histograms", getOpLatencyHistograms);
+  m.def("_clear_op_latency_histograms", clearOpLatencyHistograms);
+
+  py::class_<OpMemoryStats>(m, "_OpMemoryStats")
+    .def_readonly("alloc_count", &OpMemoryStats::alloc_count)
+    .def_readonly("alloc_bytes", &OpMemoryStats::alloc_bytes)
+    .def_readonly("free_count", &OpMemoryStats::free_count)
+    .def_readonly("free_bytes", &OpMemoryStats::free_bytes)
+    .def_readonly("live_bytes", &OpMemoryStats::live_bytes)
+    .def_readonly("peak_bytes", &OpMemoryStats::peak_bytes);
+  m.def("_enable_op_memory_profiling", enableOpMemoryProfiling);
+  m.def("_disable_op_memory_profiling", disableOpMemoryProfiling);
+  m.def("_op_memory_profiling_enabled", opMemoryProfilingEnabled);
+  m.def("_get_op_memory_profile", getOpMemoryProfile);
+  m.def("_clear_op_memory_profile", clearOpMemoryProfile);
+
+  py::class_<OpPerfCounts>(m, "_OpPerfCounts")
+    .def_readonly("count", &OpPerfCounts::count)
+    .def_readonly("cycles", &OpPerfCounts::cycles)
+    .def_readonly("instructions", &OpPerfCounts::instructions)
+    .def_readonly("llc_misses", &OpPerfCounts::llc_misses)
+    .def_readonly("stalled_backend", &OpPerfCounts::stalled_backend);
+  m.def("_enable_op_perf_counters", enableOpPerfCounters);
+  m.def("_disable_op_perf_counters", disableOpPerfCounters);
+  m.def("_op_perf_counters_enabled", opPerfCountersEnabled);
+  m.def("_get_op_perf_counters", getOpPerfCounters);
+  m.def("_clear_op_perf_counters", clearOpPerfCounters);
+
+  py::class_<KernelAttributionStats>(m, "_KernelAttributionStats")
+    .def_readonly("kernel_count", &KernelAttributionStats::kernel_count)
+    .def_readonly("total_duration_us", &KernelAttributionStats::total_duration_us)
+    .def_readonly("last_grid", &KernelAttributionStats::last_grid)
+    .def_readonly("last_block", &KernelAttributionStats::last_block);
+  m.def("_kernel_attribution_available", kernelAttributionAvailable);
+  m.def("_enable_kernel_attribution", enableKernelAttribution);
+  m.def("_disable_kernel_attribution", disableKernelAttribution);
+
+  m.def("_enable_op_recording", enableOpRecording);
+  m.def("_disable_op_recording", disableOpRecording);
+  m.def("_op_recording_enabled", opRecordingEnabled);
+
   py::class_<RecordFunction, std::shared_ptr<RecordFunction>>(m, "_RecordFunction")
     .def(py::init<>());
 
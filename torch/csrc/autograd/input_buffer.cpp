@@ -1,5 +1,8 @@
 #include <torch/csrc/autograd/input_buffer.h>
 
+#include <torch/csrc/autograd/grad_mode.h>
+
+#include <ATen/Parallel.h>
 #include <c10/core/DeviceGuard.h>
 #include <c10/core/StreamGuard.h>
 #include <c10/core/Event.h>
@@ -11,29 +14,36 @@
 
 namespace torch { namespace autograd {
 
-  static void accumulate(std::vector<Variable>& buffer,
-                         const size_t pos,
-                         Variable&& var) {
-    TORCH_INTERNAL_ASSERT(pos < buffer.size());
-    auto& old_var = buffer[pos];
+  // Upper bound on deferred gradients per position, so buffering for the
+  // tree reduction doesn't hold arbitrarily many grads alive.
+  static constexpr size_t kMaxPendingGradients = 16;
+
+  static Variable accumulate_vars(Variable&& old_var, Variable&& var) {
     // ATen doesn't route sparse additions correctly...
     // do dense + sparse in-place if possible
     if (old_var.is_sparse()) {
       //storage use_count is a big hammer, but for anything lighter there's an adversarial example with unexpected inplace modification
       if (!var.is_sparse() && var.is_contiguous() && var.storage().use_count() == 1) {
-          buffer[pos] = var.add_(old_var);
+          return var.add_(old_var);
       } else {
-          buffer[pos] = var + old_var;
+          return var + old_var;
       }
     } else {
       if (var.is_sparse() && !old_var.is_sparse() && old_var.is_contiguous() && old_var.storage().use_count() == 1) {
-          buffer[pos] = old_var.add_(var);
+          return old_var.add_(var);
       } else {
-          buffer[pos] = old_var + var;
+          return old_var + var;
       }
     }
   }
 
+  static void accumulate(std::vector<Variable>& buffer,
+                         const size_t pos,
+                         Variable&& var) {
+    TORCH_INTERNAL_ASSERT(pos < buffer.size());
+    buffer[pos] = accumulate_vars(std::move(buffer[pos]), std::move(var));
+  }
+
   void InputBuffer::add(size_t pos,
                         Variable&& var,
                         const c10::optional<c10::Stream>& opt_producer_stream,
@@ -111,11 +121,65 @@ namespace torch { namespace autograd {
       accumulate(buffer, pos, std::move(var));
     } else {
       // (1) non-CUDA variable
-      //     Accumulation happens on variable's device
-      c10::OptionalDeviceGuard device_guard{device_of(var)};
-      accumulate(buffer, pos, std::move(var));
+      //     Accumulation happens on variable's device. The addition is
+      //     deferred so positions receiving many gradients (e.g. a single
+      //     AccumulateGrad fed by hundreds of sparse embedding grads) are
+      //     combined by a pairwise tree reduction instead of one long
+      //     sequential chain; see flush_pending().
+      for (auto& item : pending_) {
+        if (item.first == pos) {
+          item.second.emplace_back(std::move(var));
+          if (item.second.size() >= kMaxPendingGradients) {
+            reduce_pending(pos, item.second);
+          }
+          return;
+        }
+      }
+      pending_.emplace_back(pos, std::vector<Variable>());
+      pending_.back().second.emplace_back(std::move(var));
+    }
+  }
+}
+
+void InputBuffer::reduce_pending(size_t pos, std::vector<Variable>& grads) {
+  grads.emplace_back(std::move(buffer[pos]));
+  c10::OptionalDeviceGuard device_guard{device_of(grads.back())};
+  // Pairwise tree reduction: each level combines disjoint pairs, halving the
+  // list. Levels run their pairs in parallel only when no graph is being
+  // built, since recording autograd nodes is not thread-safe.
+  size_t n = grads.size();
+  while (n > 1) {
+    size_t stride = (n + 1) / 2;
+    size_t num_pairs = n - stride;
+    if (num_pairs > 1 && !GradMode::is_enabled()) {
+      at::parallel_for(0, num_pairs, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+          grads[i] =
+              accumulate_vars(std::move(grads[i]), std::move(grads[i + stride]));
+        }
+      });
+    } else {
+      for (size_t i = 0; i < num_pairs; i++) {
+        grads[i] =
+            accumulate_vars(std::move(grads[i]), std::move(grads[i + stride]));
+      }
+    }
+    n = stride;
+  }
+  buffer[pos] = std::move(grads[0]);
+  grads.clear();
+}
+
+void InputBuffer::flush_pending() {
+  if (pending_.empty()) {
+    return;
+  }
+  for (auto& item : pending_) {
+    if (!item.second.empty()) {
+      reduce_pending(item.first, item.second);
     }
   }
+  pending_.clear();
 }
 
 auto InputBuffer::device() const -> at::Device {
@@ -137,6 +201,7 @@ auto InputBuffer::device() const -> at::Device {
 }
 
 auto InputBuffer::variables(InputBuffer&& g) -> std::vector<Variable> {
+  g.flush_pending();
   std::vector<Variable> result = std::move(g.buffer);
   return result;
 }
@@ -33,13 +33,26 @@ struct InputBuffer {
 
   at::Device device() const;
 
-  Variable operator[](size_t pos) { return buffer[pos]; }
+  Variable operator[](size_t pos) {
+    flush_pending();
+    return buffer[pos];
+  }
 
   // Returns the inputs as a list of variables. Destroys given InputBuffer.
   static std::vector<Variable> variables(InputBuffer&& g);
 
 private:
+  // Combines the gradients deferred by add() into their buffer slots with a
+  // pairwise tree reduction; no-op when nothing is pending.
+  void flush_pending();
+  void reduce_pending(size_t pos, std::vector<Variable>& grads);
+
   std::vector<Variable> buffer;
+  // Non-CUDA gradients beyond the first for a position are deferred here so
+  // they can be combined pairwise instead of one long sequential chain; see
+  // flush_pending(). The list per position is kept short by reducing eagerly
+  // once it grows past a fixed cap.
+  std::vector<std::pair<size_t, std::vector<Variable>>> pending_;
 };
 
 }}  // namespace torch::autograd
@@ -11,8 +11,8 @@
 namespace torch { namespace autograd {
 
 /**
- * Records type, shape, and device of tensor and, where applicable,
- * the stream the correspondingoperation took place on.
+ * Records type, shape, memory format, and device of tensor and, where
+ * applicable, the stream the corresponding operation took place on.
  *
  * If is_valid() is false, then the corresponding input is not used and may be
  * an undefined tensor.
@@ -20,13 +20,18 @@ namespace torch { namespace autograd {
 struct InputMetadata {
   InputMetadata() = default;
 
-  InputMetadata(const at::TensorOptions options, at::IntArrayRef shape, at::Device device)
-  : options_{options}, shape_{shape}, device_{device} {
+  InputMetadata(
+      const at::TensorOptions options,
+      at::IntArrayRef shape,
+      at::Device device,
+      at::MemoryFormat memory_format = at::MemoryFormat::Contiguous)
+  : options_{options}, shape_{shape}, device_{device},
+    memory_format_{memory_format} {
     stream_ = c10::impl::getDeviceGuardImpl(device_.type())->getStream(device_);
   }
 
   InputMetadata(const at::Tensor& t)
-  : InputMetadata(t.options(), t.sizes(), t.device()) { }
+  : InputMetadata(t.options(), t.sizes(), t.device(), t.suggest_memory_format()) { }
 
   const at::TensorOptions options() const {
     return options_;
@@ -44,13 +49,25 @@ struct InputMetadata {
     return stream_;
   }
 
+  at::MemoryFormat memory_format() const {
+    return memory_format_;
+  }
+
   at::Tensor zeros_like() const {
-    return at::zeros(shape_, options_);
+    if (memory_format_ == at::MemoryFormat::Contiguous) {
+      return at::zeros(shape_, options_);
+    }
+    // Materialize the zeros in the same memory format as the forward input
+    // (e.g. channels last), so downstream accumulation doesn't have to
+    // convert layouts. at::zeros takes no memory format argument, so
+    // allocate in the recorded format and zero-fill.
+    return at::empty(shape_, options_, memory_format_).zero_();
   }
 
 private:
   const at::TensorOptions options_;
   at::DimVector shape_;
+  at::MemoryFormat memory_format_ = at::MemoryFormat::Contiguous;
   at::Device device_ = at::kCPU;
   c10::Stream stream_ = c10::Stream(c10::Stream::Default::DEFAULT, device_);
 };
@@ -0,0 +1,37 @@
+#include <torch/csrc/autograd/kernel_attribution.h>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+namespace {
+
+CuptiStubs default_cupti_stubs;
+constexpr CuptiStubs* default_cupti_stubs_addr = &default_cupti_stubs;
+// constant initialization, so it is guaranteed to be initialized before
+// static initialization calls which may invoke registerCuptiMethods
+static CuptiStubs* cupti_stubs = default_cupti_stubs_addr;
+
+} // namespace
+
+void registerCuptiMethods(CuptiStubs* stubs) {
+  cupti_stubs = stubs;
+}
+
+CuptiStubs::~CuptiStubs() = default;
+
+bool kernelAttributionAvailable() {
+  return cupti_stubs->available();
+}
+
+void enableKernelAttribution() {
+  cupti_stubs->enable();
+}
+
+KernelAttributionResults disableKernelAttribution() {
+  return cupti_stubs->disable();
+}
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
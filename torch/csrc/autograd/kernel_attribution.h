@@ -0,0 +1,65 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <c10/util/Exception.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Per-op attribution of the device kernels an op actually launched,
+// collected through the CUPTI activity API. The cudaEvent ranges the CUDA
+// profiler records only bound an op's span on a stream; this reports which
+// kernels ran under each RecordFunction scope, how long they took on the
+// device, and their launch configuration, which is what fusion work needs.
+struct TORCH_API KernelAttributionStats {
+  // Number of device kernels launched under this op scope.
+  int64_t kernel_count = 0;
+  // Total device-side duration of those kernels.
+  double total_duration_us = 0;
+  // Launch configuration of the most recently completed kernel:
+  // {grid_x, grid_y, grid_z} and {block_x, block_y, block_z}.
+  std::vector<int64_t> last_grid;
+  std::vector<int64_t> last_block;
+};
+
+using KernelAttributionResults =
+    std::unordered_map<std::string, KernelAttributionStats>;
+
+// Backed by CUPTI when PyTorch is built with CUDA and the CUPTI library is
+// available; the default stubs fail on use, mirroring CUDAStubs.
+struct TORCH_API CuptiStubs {
+  virtual void enable() {
+    fail();
+  }
+  virtual KernelAttributionResults disable() {
+    fail();
+    return {};
+  }
+  virtual bool available() {
+    return false;
+  }
+  virtual ~CuptiStubs();
+
+ private:
+  void fail() {
+    AT_ERROR("CUPTI kernel attribution requires a CUDA build with CUPTI.");
+  }
+};
+
+TORCH_API void registerCuptiMethods(CuptiStubs* stubs);
+
+TORCH_API bool kernelAttributionAvailable();
+TORCH_API void enableKernelAttribution();
+// Flushes outstanding activity buffers and returns the per-op stats.
+TORCH_API KernelAttributionResults disableKernelAttribution();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
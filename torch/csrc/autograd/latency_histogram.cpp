@@ -0,0 +1,137 @@
+#include <torch/csrc/autograd/latency_histogram.h>
+
+#include <torch/csrc/autograd/profiler.h>
+#include <torch/csrc/autograd/record_function.h>
+
+#include <c10/util/Exception.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+namespace {
+
+struct ThreadHistograms {
+  // Guards the map and the bucket counts. Only ever contended during
+  // aggregation, so the owning thread's lock is a couple of uncontended
+  // atomic ops per record.
+  std::mutex mutex;
+  std::unordered_map<std::string, std::array<uint64_t, kOpLatencyNumBuckets>>
+      histograms;
+  // Start time stack for nested record functions; only the owning thread
+  // touches it.
+  std::vector<int64_t> start_times;
+};
+
+struct Registry {
+  std::mutex mutex;
+  // shared_ptrs keep the histograms of exited threads alive so their
+  // samples still show up when the fleet scrapes.
+  std::vector<std::shared_ptr<ThreadHistograms>> threads;
+};
+
+Registry& registry() {
+  static Registry r;
+  return r;
+}
+
+ThreadHistograms& localHistograms() {
+  static thread_local std::shared_ptr<ThreadHistograms> local = [] {
+    auto h = std::make_shared<ThreadHistograms>();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().threads.push_back(h);
+    return h;
+  }();
+  return *local;
+}
+
+size_t latencyBucket(int64_t ns) {
+  if (ns <= 1) {
+    return 0;
+  }
+  return std::min<size_t>(
+      c10::llvm::Log2_64(static_cast<uint64_t>(ns)),
+      kOpLatencyNumBuckets - 1);
+}
+
+void recordSample(const RecordFunction& rf, int64_t elapsed_ns) {
+  if (rf.name().str() == nullptr) {
+    return;
+  }
+  auto& local = localHistograms();
+  std::lock_guard<std::mutex> lock(local.mutex);
+  auto& buckets = local.histograms[rf.name().str()];
+  buckets[latencyBucket(elapsed_ns)]++;
+}
+
+bool histograms_enabled = false;
+
+} // namespace
+
+void enableOpLatencyHistograms() {
+  TORCH_CHECK(
+      !histograms_enabled, "op latency histograms are already enabled");
+  pushCallback(
+      [](const RecordFunction&) {
+        localHistograms().start_times.push_back(getTime());
+      },
+      [](const RecordFunction& rf) {
+        auto& starts = localHistograms().start_times;
+        // Async ops can run their end callback on another thread; those
+        // samples are dropped rather than mispaired.
+        if (starts.empty()) {
+          return;
+        }
+        const int64_t start = starts.back();
+        starts.pop_back();
+        recordSample(rf, getTime() - start);
+      },
+      /* needs_inputs */ false,
+      /* sampled */ false);
+  histograms_enabled = true;
+}
+
+void disableOpLatencyHistograms() {
+  TORCH_CHECK(histograms_enabled, "op latency histograms are not enabled");
+  popCallback();
+  histograms_enabled = false;
+}
+
+bool opLatencyHistogramsEnabled() {
+  return histograms_enabled;
+}
+
+std::unordered_map<std::string, std::vector<uint64_t>>
+getOpLatencyHistograms() {
+  std::unordered_map<std::string, std::vector<uint64_t>> result;
+  std::lock_guard<std::mutex> registry_lock(registry().mutex);
+  for (const auto& thread : registry().threads) {
+    std::lock_guard<std::mutex> lock(thread->mutex);
+    for (const auto& entry : thread->histograms) {
+      auto& buckets = result[entry.first];
+      buckets.resize(kOpLatencyNumBuckets, 0);
+      for (size_t i = 0; i < kOpLatencyNumBuckets; i++) {
+        buckets[i] += entry.second[i];
+      }
+    }
+  }
+  return result;
+}
+
+void clearOpLatencyHistograms() {
+  std::lock_guard<std::mutex> registry_lock(registry().mutex);
+  for (const auto& thread : registry().threads) {
+    std::lock_guard<std::mutex> lock(thread->mutex);
+    thread->histograms.clear();
+  }
+}
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
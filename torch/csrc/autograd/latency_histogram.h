@@ -0,0 +1,38 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Always-on per-op latency histograms, for production visibility without
+// the full profiler. When enabled, a RecordFunction callback records every
+// op's wall time into a per-thread histogram keyed by op name; histograms
+// use power-of-two buckets (bucket i counts durations in
+// [2^i, 2^(i+1)) nanoseconds), so percentiles are recoverable to within a
+// factor of two over the full ns-to-minutes range. Each thread only ever
+// touches its own histograms under an uncontended mutex, so the steady
+// state cost per op is one clock read, one hash lookup and one increment.
+
+constexpr size_t kOpLatencyNumBuckets = 48;
+
+TORCH_API void enableOpLatencyHistograms();
+TORCH_API void disableOpLatencyHistograms();
+TORCH_API bool opLatencyHistogramsEnabled();
+
+// Sums the per-thread histograms (including those of exited threads) into
+// one bucket vector per op name.
+TORCH_API std::unordered_map<std::string, std::vector<uint64_t>>
+getOpLatencyHistograms();
+
+TORCH_API void clearOpLatencyHistograms();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,112 @@
+#include <torch/csrc/autograd/memory_profiler.h>
+
+#include <torch/csrc/autograd/record_function.h>
+
+#include <c10/core/Allocator.h>
+#include <c10/util/Exception.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+namespace {
+
+class OpMemoryProfiler : public c10::MemoryReportingInfoBase {
+ public:
+  void reportMemoryUsage(void* ptr, int64_t alloc_size, c10::Device /* device */)
+      override {
+    const RecordFunction* rf = RecordFunction::current();
+    const char* scope = rf && rf->name().str() != nullptr
+        ? rf->name().str()
+        : "<unattributed>";
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (alloc_size > 0) {
+      auto& stats = stats_[scope];
+      stats.alloc_count++;
+      stats.alloc_bytes += alloc_size;
+      stats.live_bytes += alloc_size;
+      stats.peak_bytes = std::max(stats.peak_bytes, stats.live_bytes);
+      owners_[ptr] = scope;
+    } else {
+      // Charge the free to the op that allocated, so live_bytes tracks
+      // ownership rather than wherever the last reference died.
+      auto it = owners_.find(ptr);
+      const std::string owner =
+          it != owners_.end() ? it->second : "<untracked>";
+      auto& stats = stats_[owner];
+      stats.free_count++;
+      stats.free_bytes -= alloc_size;
+      stats.live_bytes += alloc_size;
+      if (it != owners_.end()) {
+        owners_.erase(it);
+      }
+    }
+  }
+
+  std::unordered_map<std::string, OpMemoryStats> snapshot() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return stats_;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stats_.clear();
+    owners_.clear();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, OpMemoryStats> stats_;
+  std::unordered_map<void*, std::string> owners_;
+};
+
+std::shared_ptr<OpMemoryProfiler>& instance() {
+  static std::shared_ptr<OpMemoryProfiler> profiler =
+      std::make_shared<OpMemoryProfiler>();
+  return profiler;
+}
+
+bool memory_profiling_on = false;
+
+} // namespace
+
+void enableOpMemoryProfiling() {
+  TORCH_CHECK(!memory_profiling_on, "op memory profiling is already enabled");
+  // RecordFunction only maintains current() while some callback is
+  // installed, so push a no-op pair to keep the op scope stack alive for
+  // attribution.
+  pushCallback(
+      [](const RecordFunction&) {}, [](const RecordFunction&) {},
+      /* needs_inputs */ false,
+      /* sampled */ false);
+  c10::setMemoryReportingInfo(instance());
+  memory_profiling_on = true;
+}
+
+void disableOpMemoryProfiling() {
+  TORCH_CHECK(memory_profiling_on, "op memory profiling is not enabled");
+  c10::setMemoryReportingInfo(nullptr);
+  popCallback();
+  memory_profiling_on = false;
+}
+
+bool opMemoryProfilingEnabled() {
+  return memory_profiling_on;
+}
+
+std::unordered_map<std::string, OpMemoryStats> getOpMemoryProfile() {
+  return instance()->snapshot();
+}
+
+void clearOpMemoryProfile() {
+  instance()->clear();
+}
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Per-op memory attribution, built on the c10 allocator reporting channel.
+// When enabled, every CPU allocation is tagged with the name of the
+// RecordFunction scope active on the allocating thread; frees are charged
+// back to the op that allocated, so live_bytes and peak_bytes show which
+// ops own memory, not just which ops touch the allocator. Allocations made
+// outside any op scope land under "<unattributed>", frees of memory
+// allocated before profiling started under "<untracked>".
+struct TORCH_API OpMemoryStats {
+  int64_t alloc_count = 0;
+  int64_t alloc_bytes = 0;
+  int64_t free_count = 0;
+  int64_t free_bytes = 0;
+  // Bytes allocated by this op and not yet freed / the maximum that value
+  // reached.
+  int64_t live_bytes = 0;
+  int64_t peak_bytes = 0;
+};
+
+TORCH_API void enableOpMemoryProfiling();
+TORCH_API void disableOpMemoryProfiling();
+TORCH_API bool opMemoryProfilingEnabled();
+
+// Snapshot of the per-op stats; remains available after disabling.
+TORCH_API std::unordered_map<std::string, OpMemoryStats> getOpMemoryProfile();
+
+TORCH_API void clearOpMemoryProfile();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,174 @@
+#include <torch/csrc/autograd/op_replay_log.h>
+
+#include <torch/csrc/autograd/profiler.h>
+#include <torch/csrc/autograd/record_function.h>
+
+#include <c10/util/Exception.h>
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+namespace {
+
+// Log line format, space separated:
+//   <name> <dur_ns> <nargs> <arg>...
+// where each arg is one of
+//   t <dtype> <ndim> <sizes...> <strides...>   defined tensor
+//   ut                                         undefined tensor
+//   i <v> | f <v> | b <0|1> | n                int / double / bool / None
+//   il <n> <v...> | fl <n> <v...> | bl <n> <v...>   lists
+//   tl <n> <tensor args...>                    tensor list
+//   u                                          unsupported (not replayable)
+// This is deliberately trivial to parse with an istream in the replayer.
+
+struct RecorderState {
+  std::mutex mutex;
+  std::unique_ptr<std::ofstream> out;
+};
+
+RecorderState& recorderState() {
+  static RecorderState state;
+  return state;
+}
+
+bool recording_enabled = false;
+
+void appendTensor(std::ostream& os, const at::Tensor& tensor) {
+  if (!tensor.defined()) {
+    os << " ut";
+    return;
+  }
+  os << " t " << static_cast<int>(tensor.scalar_type()) << " "
+     << tensor.dim();
+  for (auto size : tensor.sizes()) {
+    os << " " << size;
+  }
+  for (auto stride : tensor.strides()) {
+    os << " " << stride;
+  }
+}
+
+void appendInput(std::ostream& os, const c10::IValue& input) {
+  if (input.isTensor()) {
+    appendTensor(os, input.toTensor());
+  } else if (input.isInt()) {
+    os << " i " << input.toInt();
+  } else if (input.isDouble()) {
+    os << " f " << input.toDouble();
+  } else if (input.isBool()) {
+    os << " b " << (input.toBool() ? 1 : 0);
+  } else if (input.isNone()) {
+    os << " n";
+  } else if (input.isIntList()) {
+    auto vals = input.toIntVector();
+    os << " il " << vals.size();
+    for (auto v : vals) {
+      os << " " << v;
+    }
+  } else if (input.isDoubleList()) {
+    auto vals = input.toDoubleVector();
+    os << " fl " << vals.size();
+    for (auto v : vals) {
+      os << " " << v;
+    }
+  } else if (input.isBoolList()) {
+    auto vals = input.toBoolList();
+    os << " bl " << vals.size();
+    for (bool v : vals) {
+      os << " " << (v ? 1 : 0);
+    }
+  } else if (input.isTensorList()) {
+    auto tensors = input.toTensorVector();
+    os << " tl " << tensors.size();
+    for (const auto& tensor : tensors) {
+      appendTensor(os, tensor);
+    }
+  } else {
+    os << " u";
+  }
+}
+
+// Only top-level op scopes are recorded; nested scopes would replay the
+// same work twice. The depth is per thread, as is the pending line.
+struct ThreadRecording {
+  int depth = 0;
+  int64_t start_time = 0;
+  std::string args;
+};
+
+ThreadRecording& threadRecording() {
+  static thread_local ThreadRecording recording;
+  return recording;
+}
+
+} // namespace
+
+void enableOpRecording(const std::string& filename) {
+  TORCH_CHECK(!recording_enabled, "op recording is already enabled");
+  {
+    auto& state = recorderState();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.out.reset(new std::ofstream(filename));
+    TORCH_CHECK(*state.out, "could not open op log file: ", filename);
+  }
+  pushCallback(
+      [](const RecordFunction& fn) {
+        auto& recording = threadRecording();
+        if (recording.depth++ != 0) {
+          return;
+        }
+        std::ostringstream args;
+        args << " " << fn.inputs().size();
+        for (const c10::IValue& input : fn.inputs()) {
+          appendInput(args, input);
+        }
+        recording.args = args.str();
+        recording.start_time = getTime();
+      },
+      [](const RecordFunction& fn) {
+        auto& recording = threadRecording();
+        // Async end callbacks may run on a thread that never saw the start.
+        if (recording.depth == 0) {
+          return;
+        }
+        if (--recording.depth != 0) {
+          return;
+        }
+        if (fn.name().str() == nullptr) {
+          return;
+        }
+        const int64_t duration = getTime() - recording.start_time;
+        auto& state = recorderState();
+        std::lock_guard<std::mutex> guard(state.mutex);
+        if (state.out) {
+          *state.out << fn.name().str() << " " << duration << recording.args
+                     << "\n";
+        }
+      },
+      /* needs_inputs */ true,
+      /* sampled */ false);
+  recording_enabled = true;
+}
+
+void disableOpRecording() {
+  TORCH_CHECK(recording_enabled, "op recording is not enabled");
+  popCallback();
+  recording_enabled = false;
+  auto& state = recorderState();
+  std::lock_guard<std::mutex> guard(state.mutex);
+  state.out.reset();
+}
+
+bool opRecordingEnabled() {
+  return recording_enabled;
+}
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
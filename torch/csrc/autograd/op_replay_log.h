@@ -0,0 +1,29 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <string>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Records the sequence of top-level ops a workload executes into a
+// replayable text log: one line per op with its name, wall duration, and
+// the concrete shape/stride/dtype of every tensor input plus the literal
+// value of scalar and list inputs. Unlike the tracer this builds no graph
+// and imposes no tracing restrictions; nested ops (ops called from inside
+// another op's kernel) are not recorded, so replaying the log repeats the
+// work exactly once.
+//
+// The log is consumed by the op_replayer binary (binaries/op_replayer.cc),
+// which re-executes it against any build for offline A/B benchmarking.
+// Inputs the format cannot express (e.g. strings, objects) are marked
+// unsupported; the replayer reports those ops as skipped.
+TORCH_API void enableOpRecording(const std::string& filename);
+TORCH_API void disableOpRecording();
+TORCH_API bool opRecordingEnabled();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
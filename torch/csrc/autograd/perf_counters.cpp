@@ -0,0 +1,279 @@
+#include <torch/csrc/autograd/perf_counters.h>
+
+#include <torch/csrc/autograd/record_function.h>
+
+#include <c10/util/Exception.h>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+#ifdef __linux__
+
+namespace {
+
+constexpr size_t kNumCounters = 4;
+
+constexpr std::array<uint64_t, kNumCounters> kCounterConfigs = {{
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_STALLED_CYCLES_BACKEND,
+}};
+
+// One counter reading: raw value plus the enabled/running times the kernel
+// reports for multiplex scaling.
+struct CounterReading {
+  uint64_t value = 0;
+  uint64_t time_enabled = 0;
+  uint64_t time_running = 0;
+};
+
+using CounterSnapshot = std::array<CounterReading, kNumCounters>;
+
+int openCounter(uint64_t config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Separate events rather than a group, so the kernel multiplexes each
+  // counter independently when the PMU runs out of slots.
+  return syscall(
+      __NR_perf_event_open, &attr, /* pid */ 0, /* cpu */ -1,
+      /* group_fd */ -1, /* flags */ 0);
+}
+
+struct ThreadCounters {
+  // Guards the stats map and the fds; only contended during aggregation and
+  // disable, so the owning thread's lock is uncontended per record.
+  std::mutex mutex;
+  std::unordered_map<std::string, OpPerfCounts> stats;
+  // Snapshot stack for nested record functions; only the owning thread
+  // touches it.
+  std::vector<CounterSnapshot> snapshots;
+  std::array<int, kNumCounters> fds;
+  bool opened = false;
+
+  ThreadCounters() {
+    fds.fill(-1);
+  }
+
+  ~ThreadCounters() {
+    closeCounters();
+  }
+
+  void openCounters() {
+    for (size_t i = 0; i < kNumCounters; i++) {
+      if (fds[i] < 0) {
+        fds[i] = openCounter(kCounterConfigs[i]);
+      }
+    }
+    opened = true;
+  }
+
+  void closeCounters() {
+    for (size_t i = 0; i < kNumCounters; i++) {
+      if (fds[i] >= 0) {
+        close(fds[i]);
+        fds[i] = -1;
+      }
+    }
+    opened = false;
+  }
+
+  CounterSnapshot read() {
+    CounterSnapshot snapshot;
+    for (size_t i = 0; i < kNumCounters; i++) {
+      if (fds[i] < 0) {
+        continue;
+      }
+      uint64_t buf[3] = {0, 0, 0};
+      if (::read(fds[i], buf, sizeof(buf)) == sizeof(buf)) {
+        snapshot[i].value = buf[0];
+        snapshot[i].time_enabled = buf[1];
+        snapshot[i].time_running = buf[2];
+      }
+    }
+    return snapshot;
+  }
+};
+
+struct Registry {
+  std::mutex mutex;
+  // shared_ptrs keep the stats of exited threads alive so their samples
+  // still show up when the fleet scrapes.
+  std::vector<std::shared_ptr<ThreadCounters>> threads;
+};
+
+Registry& registry() {
+  static Registry r;
+  return r;
+}
+
+ThreadCounters& localCounters() {
+  static thread_local std::shared_ptr<ThreadCounters> local = [] {
+    auto c = std::make_shared<ThreadCounters>();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().threads.push_back(c);
+    return c;
+  }();
+  return *local;
+}
+
+// Counter delta over [start, end], scaled by the fraction of the interval
+// the counter was actually scheduled on the PMU.
+double scaledDelta(const CounterReading& start, const CounterReading& end) {
+  const uint64_t value = end.value - start.value;
+  const uint64_t enabled = end.time_enabled - start.time_enabled;
+  const uint64_t running = end.time_running - start.time_running;
+  if (running == 0) {
+    return 0;
+  }
+  return static_cast<double>(value) * static_cast<double>(enabled) /
+      static_cast<double>(running);
+}
+
+void recordSample(
+    const RecordFunction& rf,
+    const CounterSnapshot& start,
+    const CounterSnapshot& end) {
+  if (rf.name().str() == nullptr) {
+    return;
+  }
+  auto& local = localCounters();
+  std::lock_guard<std::mutex> lock(local.mutex);
+  auto& stats = local.stats[rf.name().str()];
+  stats.count++;
+  stats.cycles += scaledDelta(start[0], end[0]);
+  stats.instructions += scaledDelta(start[1], end[1]);
+  stats.llc_misses += scaledDelta(start[2], end[2]);
+  stats.stalled_backend += scaledDelta(start[3], end[3]);
+}
+
+bool counters_enabled = false;
+
+} // namespace
+
+void enableOpPerfCounters() {
+  TORCH_CHECK(!counters_enabled, "op perf counters are already enabled");
+  // Open on the calling thread first so a missing perf_event facility fails
+  // loudly here instead of silently recording zeros everywhere.
+  auto& local = localCounters();
+  local.openCounters();
+  TORCH_CHECK(
+      local.fds[0] >= 0,
+      "could not open perf_event hardware counters; this requires Linux "
+      "perf_event support and sufficient permissions (see "
+      "/proc/sys/kernel/perf_event_paranoid)");
+  pushCallback(
+      [](const RecordFunction&) {
+        auto& counters = localCounters();
+        if (!counters.opened) {
+          counters.openCounters();
+        }
+        counters.snapshots.push_back(counters.read());
+      },
+      [](const RecordFunction& rf) {
+        auto& counters = localCounters();
+        auto& snapshots = counters.snapshots;
+        // Async ops can run their end callback on another thread; those
+        // samples are dropped rather than mispaired (the deltas would mix
+        // two threads' PMUs anyway).
+        if (snapshots.empty()) {
+          return;
+        }
+        const CounterSnapshot start = snapshots.back();
+        snapshots.pop_back();
+        recordSample(rf, start, counters.read());
+      },
+      /* needs_inputs */ false,
+      /* sampled */ false);
+  counters_enabled = true;
+}
+
+void disableOpPerfCounters() {
+  TORCH_CHECK(counters_enabled, "op perf counters are not enabled");
+  popCallback();
+  counters_enabled = false;
+  // Release the per-thread fds; stats stay around for scraping and the
+  // counters reopen lazily if profiling is enabled again.
+  std::lock_guard<std::mutex> registry_lock(registry().mutex);
+  for (const auto& thread : registry().threads) {
+    std::lock_guard<std::mutex> lock(thread->mutex);
+    thread->closeCounters();
+    thread->snapshots.clear();
+  }
+}
+
+bool opPerfCountersEnabled() {
+  return counters_enabled;
+}
+
+std::unordered_map<std::string, OpPerfCounts> getOpPerfCounters() {
+  std::unordered_map<std::string, OpPerfCounts> result;
+  std::lock_guard<std::mutex> registry_lock(registry().mutex);
+  for (const auto& thread : registry().threads) {
+    std::lock_guard<std::mutex> lock(thread->mutex);
+    for (const auto& entry : thread->stats) {
+      auto& stats = result[entry.first];
+      stats.count += entry.second.count;
+      stats.cycles += entry.second.cycles;
+      stats.instructions += entry.second.instructions;
+      stats.llc_misses += entry.second.llc_misses;
+      stats.stalled_backend += entry.second.stalled_backend;
+    }
+  }
+  return result;
+}
+
+void clearOpPerfCounters() {
+  std::lock_guard<std::mutex> registry_lock(registry().mutex);
+  for (const auto& thread : registry().threads) {
+    std::lock_guard<std::mutex> lock(thread->mutex);
+    thread->stats.clear();
+  }
+}
+
+#else // __linux__
+
+void enableOpPerfCounters() {
+  TORCH_CHECK(
+      false, "op perf counters require Linux perf_event support");
+}
+
+void disableOpPerfCounters() {
+  TORCH_CHECK(false, "op perf counters are not enabled");
+}
+
+bool opPerfCountersEnabled() {
+  return false;
+}
+
+std::unordered_map<std::string, OpPerfCounts> getOpPerfCounters() {
+  return {};
+}
+
+void clearOpPerfCounters() {}
+
+#endif // __linux__
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
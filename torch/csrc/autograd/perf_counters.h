@@ -0,0 +1,45 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Per-op hardware performance counters, collected with Linux perf_event.
+// When enabled, each RecordFunction scope reads a small set of PMU counters
+// on entry and exit on the executing thread, and the deltas are aggregated
+// by op name. The counters are opened per thread and the kernel multiplexes
+// them when the PMU is oversubscribed; deltas are scaled by
+// time_enabled/time_running over the interval, so the reported values are
+// estimates under multiplexing. Counters the hardware or kernel does not
+// support (commonly stalled_backend) read as zero.
+//
+// Pairing cycles with llc_misses and stalled_backend separates memory-bound
+// regressions from compute-bound ones without external tooling. Only
+// available on Linux; enabling elsewhere, or without perf_event access
+// (see /proc/sys/kernel/perf_event_paranoid), throws.
+struct TORCH_API OpPerfCounts {
+  int64_t count = 0;
+  double cycles = 0;
+  double instructions = 0;
+  double llc_misses = 0;
+  double stalled_backend = 0;
+};
+
+TORCH_API void enableOpPerfCounters();
+TORCH_API void disableOpPerfCounters();
+TORCH_API bool opPerfCountersEnabled();
+
+// Aggregated counter deltas by op name; remains available after disabling.
+TORCH_API std::unordered_map<std::string, OpPerfCounts> getOpPerfCounters();
+
+TORCH_API void clearOpPerfCounters();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
@@ -1,6 +1,7 @@
 #include <torch/csrc/autograd/profiler.h>
 #include <torch/csrc/jit/frontend/code_template.h>
 
+#include <chrono>
 #include <fstream>
 #include <list>
 #include <mutex>
@@ -19,6 +20,10 @@ constexpr CUDAStubs* default_stubs_addr = &default_stubs;
 static CUDAStubs* cuda_stubs = default_stubs_addr;
 
 ProfilerState state = ProfilerState::Disabled;
+// Whether the current profiler session registered sampled callbacks (i.e.
+// enabled with sampling_probability < 1.0); used to reset the global
+// sampling probability on disableProfiler.
+bool sampled_profiling = false;
 // Protects access all_event_lists_map.
 std::mutex all_event_lists_map_mutex;
 std::unordered_map<uint16_t, std::shared_ptr<RangeEventList>>
@@ -133,6 +138,15 @@ void enableProfiler(ProfilerConfig config) {
     throw std::runtime_error("can't change kind of profiling (e.g. NVTX to CPU) while profiler is running");
   }
 
+  // With sampling_probability < 1.0, register the observers as sampled
+  // callbacks so RecordFunction skips them for all but that fraction of ops.
+  // The skip decision is made once per RecordFunction, so start and end
+  // callbacks stay paired even when the end runs on a different thread.
+  sampled_profiling = config.sampling_probability < 1.0;
+  if (sampled_profiling) {
+    setSamplingProbability(config.sampling_probability);
+  }
+
   pushCallback(
       [config](const RecordFunction& fn) {
         auto* msg = (fn.seqNr() >= 0) ? ", seq = " : "";
@@ -186,7 +200,8 @@ void enableProfiler(ProfilerConfig config) {
           popRange();
         }
       },
-      config.report_input_shapes);
+      config.report_input_shapes,
+      /* sampled */ sampled_profiling);
   state = new_state;
 
   if(state == ProfilerState::CUDA) {
@@ -218,6 +233,11 @@ thread_event_lists disableProfiler() {
 
   popCallback();
   state = ProfilerState::Disabled;
+  if (sampled_profiling) {
+    // restore the default (run all sampled callbacks)
+    setSamplingProbability(1.0);
+    sampled_profiling = false;
+  }
 
   if (old_state == ProfilerState::NVTX) {
     return thread_event_lists();
@@ -301,6 +321,127 @@ RecordProfile::~RecordProfile() {
   }
 }
 
+// Snapshots the currently registered per-thread event lists without
+// removing them from the map, so a streaming writer can drain them while
+// recording continues.
+static std::vector<std::shared_ptr<RangeEventList>> snapshotEventLists() {
+  std::lock_guard<std::mutex> guard(all_event_lists_map_mutex);
+  std::vector<std::shared_ptr<RangeEventList>> lists;
+  lists.reserve(all_event_lists_map.size());
+  for (const auto& it : all_event_lists_map) {
+    lists.push_back(it.second);
+  }
+  return lists;
+}
+
+RecordStreamingProfile::RecordStreamingProfile(
+    std::ostream& out,
+    StreamingTraceConfig config)
+    : out_(out), config_(std::move(config)) {
+  init();
+}
+
+RecordStreamingProfile::RecordStreamingProfile(
+    const std::string& filename,
+    StreamingTraceConfig config)
+    : file_(new std::ofstream(filename)), out_(*file_), config_(std::move(config)) {
+  init();
+}
+
+void RecordStreamingProfile::init() {
+  TORCH_CHECK(out_, "could not open file");
+  out_ << "[\n";
+  enableProfiler(ProfilerConfig(ProfilerState::CPU, false /* report shapes */));
+  // All timestamps in the trace are relative to this event.
+  base_event_.reset(
+      new Event(EventKind::Mark, StringView("__streaming_start"), 0, false));
+  flusher_ = std::thread([this]() { flusherLoop(); });
+}
+
+void RecordStreamingProfile::flusherLoop() {
+  std::unique_lock<std::mutex> lock(flusher_mutex_);
+  while (!stop_requested_) {
+    flusher_cv_.wait_for(
+        lock,
+        std::chrono::milliseconds(config_.flush_period_ms),
+        [this]() { return stop_requested_; });
+    if (stop_requested_) {
+      break;
+    }
+    lock.unlock();
+    flushAvailableEvents();
+    lock.lock();
+  }
+}
+
+void RecordStreamingProfile::flushAvailableEvents() {
+  for (const auto& list : snapshotEventLists()) {
+    processBatch(list->consolidate());
+  }
+  out_.flush();
+}
+
+void RecordStreamingProfile::processBatch(std::vector<Event>&& events) {
+  for (auto& event : events) {
+    if (event.kind() == "push") {
+      auto& stack = pending_pushes_[event.thread_id()];
+      if (stack.size() >= config_.max_pending_pushes) {
+        // Evict the oldest push; its pop (if it ever arrives) finds a
+        // shallower stack and the innermost ranges win.
+        stack.erase(stack.begin());
+        dropped_events_++;
+      }
+      stack.push_back(std::move(event));
+    } else if (event.kind() == "pop") {
+      auto& stack = pending_pushes_[event.thread_id()];
+      if (stack.empty()) {
+        // The matching push predates this writer or was evicted.
+        continue;
+      }
+      writeRange(stack.back(), event);
+      stack.pop_back();
+    }
+    // Marks carry no duration; skip them.
+  }
+}
+
+void RecordStreamingProfile::writeRange(Event& start_event, Event& end_event) {
+  const double ts = base_event_->cpu_elapsed_us(start_event);
+  if (ts < config_.window_start_us ||
+      (config_.window_end_us >= 0 && ts >= config_.window_end_us)) {
+    return;
+  }
+  if (!first_range_) {
+    out_ << ",\n";
+  }
+  first_range_ = false;
+  jit::TemplateEnv env;
+  env.s("name", start_event.name());
+  env.d("ts", ts);
+  env.d("dur", start_event.cpu_elapsed_us(end_event));
+  env.d("tid", start_event.thread_id());
+  out_ << event_template.format(env);
+}
+
+RecordStreamingProfile::~RecordStreamingProfile() {
+  {
+    std::lock_guard<std::mutex> guard(flusher_mutex_);
+    stop_requested_ = true;
+  }
+  flusher_cv_.notify_all();
+  flusher_.join();
+  // Drain whatever the flusher had not picked up yet.
+  thread_event_lists event_lists = disableProfiler();
+  for (auto& list : event_lists) {
+    processBatch(std::move(list));
+  }
+  out_ << "]\n";
+  out_.flush();
+  if (file_) {
+    file_->close();
+  }
+}
+
 void RecordProfile::processEvents(const std::vector<Event*>& events) {
   TORCH_CHECK(out_, "could not open file");
   Event* start = nullptr;
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <iostream>
+#include <condition_variable>
 #include <mutex>
 #include <memory>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
 #include <string>
@@ -106,10 +109,22 @@ enum class TORCH_API ProfilerState {
 
 struct TORCH_API ProfilerConfig {
   ProfilerConfig(ProfilerState state, bool report_input_shapes)
-      : state(state), report_input_shapes(report_input_shapes) {}
+      : ProfilerConfig(state, report_input_shapes, /* sampling_probability */ 1.0) {}
+  // When sampling_probability < 1.0 the profiler registers its callbacks as
+  // sampled, so only that fraction of ops is recorded; skipped ops cost one
+  // random draw instead of two Event constructions. The decision is made
+  // once per RecordFunction, which keeps push/pop pairs matched.
+  ProfilerConfig(
+      ProfilerState state,
+      bool report_input_shapes,
+      double sampling_probability)
+      : state(state),
+        report_input_shapes(report_input_shapes),
+        sampling_probability(sampling_probability) {}
   ~ProfilerConfig();
   ProfilerState state;
   bool report_input_shapes;
+  double sampling_probability;
 };
 
 enum class TORCH_API EventKind : uint16_t {
@@ -259,6 +274,73 @@ private:
   void processEvents(const std::vector<Event*>& events);
 };
 
+struct TORCH_API StreamingTraceConfig {
+  // How often the background writer drains the per-thread event lists.
+  int64_t flush_period_ms = 100;
+  // Only ranges whose start falls in [window_start_us, window_end_us),
+  // measured from the start of profiling, are written; window_end_us < 0
+  // means no upper bound.
+  int64_t window_start_us = 0;
+  int64_t window_end_us = -1;
+  // Upper bound on push events held per thread while waiting for their
+  // matching pop. When exceeded, the oldest pending push is dropped and its
+  // pop is skipped, so a thread that never pops (or a lost pop) cannot grow
+  // the writer's memory without bound.
+  size_t max_pending_pushes = 8192;
+};
+
+// Streaming variant of RecordProfile for long runs: instead of holding every
+// event in RAM until the guard is destroyed, a background thread periodically
+// consolidates the per-thread RangeEventLists and appends completed ranges to
+// the output as chrome://tracing JSON. Memory use is bounded by the event
+// rate times the flush period (plus max_pending_pushes per thread), not by
+// the length of the run.
+//
+// Usage:
+//   {
+//     StreamingTraceConfig config;
+//     RecordStreamingProfile guard("filename.trace", config);
+//     // long-running code you want to profile
+//   }
+// Then open filename.trace in chrome://tracing
+struct TORCH_API RecordStreamingProfile {
+  RecordStreamingProfile(
+      std::ostream& out,
+      StreamingTraceConfig config = StreamingTraceConfig());
+  RecordStreamingProfile(
+      const std::string& filename,
+      StreamingTraceConfig config = StreamingTraceConfig());
+
+  ~RecordStreamingProfile();
+
+  // Number of pending pushes evicted due to max_pending_pushes; non-zero
+  // means some ranges are missing from the trace.
+  size_t droppedEvents() const {
+    return dropped_events_;
+  }
+
+ private:
+  void init();
+  void flusherLoop();
+  void flushAvailableEvents();
+  void processBatch(std::vector<Event>&& events);
+  void writeRange(Event& start_event, Event& end_event);
+
+  std::unique_ptr<std::ofstream> file_;
+  std::ostream& out_;
+  StreamingTraceConfig config_;
+  // Matches pops against their pushes across flushes; keyed by the thread id
+  // recorded on the event (cross-thread pops are recorded under the pushing
+  // thread's id already).
+  std::unordered_map<uint16_t, std::vector<Event>> pending_pushes_;
+  std::unique_ptr<Event> base_event_;
+  std::thread flusher_;
+  std::mutex flusher_mutex_;
+  std::condition_variable flusher_cv_;
+  bool stop_requested_ = false;
+  bool first_range_ = true;
+  size_t dropped_events_ = 0;
+};
 
 } // namespace profiler
 }} // namespace torch::autograd
@@ -0,0 +1,198 @@
+#include <torch/csrc/autograd/kernel_attribution.h>
+#include <torch/csrc/autograd/record_function.h>
+
+#include <cupti.h>
+
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+namespace {
+
+static inline void cuptiCheck(
+    CUptiResult result,
+    const char* file,
+    int line) {
+  if (result != CUPTI_SUCCESS) {
+    const char* str = nullptr;
+    cuptiGetResultString(result, &str);
+    std::stringstream ss;
+    ss << file << ":" << line << ": CUPTI error: "
+       << (str ? str : "unknown");
+    throw std::runtime_error(ss.str());
+  }
+}
+#define TORCH_CUPTI_CHECK(result) cuptiCheck(result, __FILE__, __LINE__);
+
+constexpr size_t kActivityBufferSize = 1 * 1024 * 1024;
+
+struct CuptiState {
+  std::mutex mutex;
+  bool enabled = false;
+  // Op names by external correlation id; ids are indices into this vector.
+  std::vector<std::string> op_names;
+  std::unordered_map<std::string, uint64_t> op_ids;
+  // Runtime correlation id -> external (op) correlation id, filled from
+  // EXTERNAL_CORRELATION records. Kernel records in the same or a later
+  // buffer look their op up here.
+  std::unordered_map<uint32_t, uint64_t> correlations;
+  KernelAttributionResults stats;
+};
+
+CuptiState& state() {
+  static CuptiState s;
+  return s;
+}
+
+uint64_t opId(const char* name) {
+  auto& s = state();
+  std::lock_guard<std::mutex> guard(s.mutex);
+  auto it = s.op_ids.find(name);
+  if (it != s.op_ids.end()) {
+    return it->second;
+  }
+  const uint64_t id = s.op_names.size();
+  s.op_names.emplace_back(name);
+  s.op_ids.emplace(name, id);
+  return id;
+}
+
+void CUPTIAPI bufferRequested(
+    uint8_t** buffer,
+    size_t* size,
+    size_t* max_num_records) {
+  *size = kActivityBufferSize;
+  *buffer = static_cast<uint8_t*>(malloc(kActivityBufferSize));
+  *max_num_records = 0;
+}
+
+void CUPTIAPI bufferCompleted(
+    CUcontext /* context */,
+    uint32_t /* stream_id */,
+    uint8_t* buffer,
+    size_t /* size */,
+    size_t valid_size) {
+  auto& s = state();
+  std::lock_guard<std::mutex> guard(s.mutex);
+  CUpti_Activity* record = nullptr;
+  while (true) {
+    const auto status =
+        cuptiActivityGetNextRecord(buffer, valid_size, &record);
+    if (status == CUPTI_ERROR_MAX_LIMIT_REACHED) {
+      break;
+    }
+    if (status != CUPTI_SUCCESS) {
+      break;
+    }
+    if (record->kind == CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION) {
+      const auto* correlation =
+          reinterpret_cast<const CUpti_ActivityExternalCorrelation*>(record);
+      s.correlations[correlation->correlationId] = correlation->externalId;
+    } else if (record->kind == CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL ||
+               record->kind == CUPTI_ACTIVITY_KIND_KERNEL) {
+      const auto* kernel =
+          reinterpret_cast<const CUpti_ActivityKernel4*>(record);
+      const auto correlation_it = s.correlations.find(kernel->correlationId);
+      if (correlation_it == s.correlations.end() ||
+          correlation_it->second >= s.op_names.size()) {
+        // Launched outside any op scope (e.g. by a background stream).
+        continue;
+      }
+      auto& stats = s.stats[s.op_names[correlation_it->second]];
+      stats.kernel_count++;
+      stats.total_duration_us +=
+          static_cast<double>(kernel->end - kernel->start) / 1000.0;
+      stats.last_grid = {kernel->gridX, kernel->gridY, kernel->gridZ};
+      stats.last_block = {kernel->blockX, kernel->blockY, kernel->blockZ};
+    }
+  }
+  free(buffer);
+}
+
+struct CuptiMethods : public CuptiStubs {
+  bool available() override {
+    return true;
+  }
+
+  void enable() override {
+    {
+      auto& s = state();
+      std::lock_guard<std::mutex> guard(s.mutex);
+      TORCH_CHECK(!s.enabled, "kernel attribution is already enabled");
+      s.enabled = true;
+    }
+    TORCH_CUPTI_CHECK(
+        cuptiActivityRegisterCallbacks(bufferRequested, bufferCompleted));
+    TORCH_CUPTI_CHECK(
+        cuptiActivityEnable(CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION));
+    TORCH_CUPTI_CHECK(
+        cuptiActivityEnable(CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL));
+    // Bracket every op scope with an external correlation id on the
+    // launching thread, so runtime API calls made inside the scope (and
+    // through them the kernels they launch) carry the op's id.
+    pushCallback(
+        [](const RecordFunction& fn) {
+          if (fn.name().str() == nullptr) {
+            return;
+          }
+          cuptiActivityPushExternalCorrelationId(
+              CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, opId(fn.name().str()));
+        },
+        [](const RecordFunction& fn) {
+          if (fn.name().str() == nullptr) {
+            return;
+          }
+          uint64_t id = 0;
+          // If the end callback runs on a different thread (async ops),
+          // this pops that thread's stack instead; CUPTI returns an error
+          // on an empty stack, which we ignore rather than mispair.
+          cuptiActivityPopExternalCorrelationId(
+              CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, &id);
+        },
+        /* needs_inputs */ false,
+        /* sampled */ false);
+  }
+
+  KernelAttributionResults disable() override {
+    {
+      auto& s = state();
+      std::lock_guard<std::mutex> guard(s.mutex);
+      TORCH_CHECK(s.enabled, "kernel attribution is not enabled");
+    }
+    popCallback();
+    TORCH_CUPTI_CHECK(
+        cuptiActivityDisable(CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL));
+    TORCH_CUPTI_CHECK(
+        cuptiActivityDisable(CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION));
+    // Drain outstanding buffers so late kernel records make it into stats.
+    TORCH_CUPTI_CHECK(cuptiActivityFlushAll(0));
+
+    auto& s = state();
+    std::lock_guard<std::mutex> guard(s.mutex);
+    KernelAttributionResults result;
+    result.swap(s.stats);
+    s.correlations.clear();
+    s.op_names.clear();
+    s.op_ids.clear();
+    s.enabled = false;
+    return result;
+  }
+};
+
+struct RegisterCuptiMethods {
+  RegisterCuptiMethods() {
+    static CuptiMethods methods;
+    registerCuptiMethods(&methods);
+  }
+};
+RegisterCuptiMethods reg;
+
+} // namespace
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
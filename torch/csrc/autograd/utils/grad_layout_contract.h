@@ -0,0 +1,42 @@
+#pragma once
+
+#include <ATen/ATen.h>
+
+namespace torch {
+namespace autograd {
+namespace utils {
+
+// Helpers for AccumulateGrad::accumulateGrad.
+// See Note [Gradient Layout Contract] in accumulate_grad.h.
+
+// Checks if grad obeys the contract with variable: if variable's memory is
+// non-overlapping and dense, grad's strides must match variable's strides,
+// otherwise grad must be rowmajor contiguous.
+inline bool obeys_layout_contract(
+    const at::Tensor& grad,
+    const at::Tensor& variable) {
+  TORCH_INTERNAL_ASSERT(!grad.is_sparse());
+  if (variable.is_sparse() || !variable.is_non_overlapping_and_dense()) {
+    return grad.is_contiguous(at::MemoryFormat::Contiguous);
+  }
+  return grad.strides().equals(variable.strides());
+}
+
+// Creates a clone of new_grad that obeys the contract with variable.
+inline at::Tensor clone_obey_contract(
+    const at::Tensor& new_grad,
+    const at::Tensor& variable) {
+  if (!variable.is_sparse() && variable.is_non_overlapping_and_dense()) {
+    // A dense, non-overlapping tensor's layout is fully described by its
+    // sizes and strides, so a strided copy preserves variable's layout
+    // exactly (e.g. channels last).
+    return at::empty_strided(
+               variable.sizes(), variable.strides(), new_grad.options())
+        .copy_(new_grad);
+  }
+  return new_grad.clone(at::MemoryFormat::Contiguous);
+}
+
+} // namespace utils
+} // namespace autograd
+} // namespace torch
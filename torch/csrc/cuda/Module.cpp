@@ -6,6 +6,7 @@
 #include <TH/TH.h>
 #include <ATen/ATen.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDABlas.h>
 #include <ATen/CUDAGenerator.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <c10/cuda/CUDACachingAllocator.h>
@@ -283,6 +284,136 @@ PyObject * THCPModule_emptyCache(PyObject *_unused, PyObject *noargs)
   Py_RETURN_NONE;
 }
 
+PyObject * THCPModule_compactCache(PyObject *_unused, PyObject *noargs)
+{
+  HANDLE_TH_ERRORS
+  c10::cuda::CUDACachingAllocator::compactCache();
+  END_HANDLE_TH_ERRORS
+  Py_RETURN_NONE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CUDA graph capture
+////////////////////////////////////////////////////////////////////////////////
+
+// Captured work is recorded into a cudaGraph and replayed without going
+// through kernel launch, eliminating per-launch overhead for stable-shape
+// workloads. Allocations made during capture are pinned in the caching
+// allocator until the graph is freed so the addresses baked into the graph
+// stay valid; see Note [Capture-stable allocations] in
+// c10/cuda/CUDACachingAllocator.cpp.
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10020
+namespace {
+
+struct CapturedGraph {
+  cudaGraphExec_t exec = nullptr;
+  uint64_t pin_id = 0;
+};
+
+std::vector<CapturedGraph> captured_graphs;
+uint64_t pending_pin_id = 0;
+
+} // namespace
+#endif
+
+PyObject * THCPModule_graphCaptureBegin(PyObject *_unused, PyObject *noargs)
+{
+  HANDLE_TH_ERRORS
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10020
+  auto stream = at::cuda::getCurrentCUDAStream();
+  TORCH_CHECK(
+      stream.id() != 0,
+      "CUDA graph capture must run under a non-default stream "
+      "(use a torch.cuda.stream() context)");
+  TORCH_CHECK(pending_pin_id == 0, "a CUDA graph capture is already active");
+  uint64_t pin_id = c10::cuda::CUDACachingAllocator::beginCapturePinning();
+  cudaError_t err =
+      cudaStreamBeginCapture(stream.stream(), cudaStreamCaptureModeRelaxed);
+  if (err != cudaSuccess) {
+    c10::cuda::CUDACachingAllocator::endCapturePinning();
+    c10::cuda::CUDACachingAllocator::releaseCapturePinned(pin_id);
+    C10_CUDA_CHECK(err);
+  }
+  pending_pin_id = pin_id;
+  Py_RETURN_NONE;
+#else
+  TORCH_CHECK(false, "CUDA graph capture requires CUDA >= 10.2");
+#endif
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject * THCPModule_graphCaptureEnd(PyObject *_unused, PyObject *noargs)
+{
+  HANDLE_TH_ERRORS
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10020
+  TORCH_CHECK(pending_pin_id != 0, "no CUDA graph capture is active");
+  uint64_t pin_id = pending_pin_id;
+  pending_pin_id = 0;
+  c10::cuda::CUDACachingAllocator::endCapturePinning();
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  cudaGraph_t graph = nullptr;
+  cudaError_t err = cudaStreamEndCapture(stream.stream(), &graph);
+  if (err != cudaSuccess || graph == nullptr) {
+    c10::cuda::CUDACachingAllocator::releaseCapturePinned(pin_id);
+    C10_CUDA_CHECK(err);
+    TORCH_CHECK(false, "CUDA graph capture produced no graph");
+  }
+
+  cudaGraphExec_t exec = nullptr;
+  err = cudaGraphInstantiate(&exec, graph, nullptr, nullptr, 0);
+  C10_CUDA_CHECK_WARN(cudaGraphDestroy(graph));
+  if (err != cudaSuccess) {
+    c10::cuda::CUDACachingAllocator::releaseCapturePinned(pin_id);
+    C10_CUDA_CHECK(err);
+  }
+
+  captured_graphs.push_back({exec, pin_id});
+  return THPUtils_packUInt64(captured_graphs.size() - 1);
+#else
+  TORCH_CHECK(false, "CUDA graph capture requires CUDA >= 10.2");
+#endif
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject * THCPModule_graphReplay(PyObject *_unused, PyObject *arg)
+{
+  HANDLE_TH_ERRORS
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10020
+  THPUtils_assert(THPUtils_checkLong(arg), "invalid CUDA graph handle");
+  size_t handle = (size_t) THPUtils_unpackLong(arg);
+  TORCH_CHECK(
+      handle < captured_graphs.size() && captured_graphs[handle].exec,
+      "invalid or freed CUDA graph handle");
+  auto stream = at::cuda::getCurrentCUDAStream();
+  C10_CUDA_CHECK(cudaGraphLaunch(captured_graphs[handle].exec, stream.stream()));
+  Py_RETURN_NONE;
+#else
+  TORCH_CHECK(false, "CUDA graph capture requires CUDA >= 10.2");
+#endif
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject * THCPModule_graphFree(PyObject *_unused, PyObject *arg)
+{
+  HANDLE_TH_ERRORS
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10020
+  THPUtils_assert(THPUtils_checkLong(arg), "invalid CUDA graph handle");
+  size_t handle = (size_t) THPUtils_unpackLong(arg);
+  TORCH_CHECK(
+      handle < captured_graphs.size() && captured_graphs[handle].exec,
+      "invalid or freed CUDA graph handle");
+  C10_CUDA_CHECK_WARN(cudaGraphExecDestroy(captured_graphs[handle].exec));
+  captured_graphs[handle].exec = nullptr;
+  c10::cuda::CUDACachingAllocator::releaseCapturePinned(
+      captured_graphs[handle].pin_id);
+  Py_RETURN_NONE;
+#else
+  TORCH_CHECK(false, "CUDA graph capture requires CUDA >= 10.2");
+#endif
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject * THCPModule_memoryStats(PyObject *_unused, PyObject *arg)
 {
   HANDLE_TH_ERRORS
@@ -333,6 +464,67 @@ PyObject * THCPModule_memoryStats(PyObject *_unused, PyObject *arg)
   END_HANDLE_TH_ERRORS
 }
 
+PyObject * THCPModule_setBlasMathMode(PyObject *_unused, PyObject *arg)
+{
+  HANDLE_TH_ERRORS
+  THPUtils_assert(THPUtils_checkString(arg), "invalid argument to _cuda_setBlasMathMode");
+  const std::string mode = THPUtils_unpackString(arg);
+  using at::cuda::blas::MathMode;
+  if (mode == "precise") {
+    at::cuda::blas::setMathMode(MathMode::Precise);
+  } else if (mode == "default") {
+    at::cuda::blas::setMathMode(MathMode::Default);
+  } else if (mode == "fast") {
+    at::cuda::blas::setMathMode(MathMode::Fast);
+  } else {
+    TORCH_CHECK(false, "expected one of 'precise', 'default', 'fast', but got ", mode);
+  }
+  END_HANDLE_TH_ERRORS
+  Py_RETURN_NONE;
+}
+
+PyObject * THCPModule_getBlasMathMode(PyObject *_unused, PyObject *noargs)
+{
+  HANDLE_TH_ERRORS
+  using at::cuda::blas::MathMode;
+  switch (at::cuda::blas::getMathMode()) {
+    case MathMode::Precise:
+      return THPUtils_packString("precise");
+    case MathMode::Fast:
+      return THPUtils_packString("fast");
+    default:
+      return THPUtils_packString("default");
+  }
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject * THCPModule_hostMemoryStats(PyObject *_unused, PyObject *noargs)
+{
+  HANDLE_TH_ERRORS
+
+  const auto statToDict = [](const c10::cuda::CUDACachingAllocator::Stat& stat) {
+    py::dict dict;
+
+    dict["current"] = stat.current;
+    dict["peak"] = stat.peak;
+    dict["allocated"] = stat.allocated;
+    dict["freed"] = stat.freed;
+    return dict;
+  };
+
+  const THCCachingHostAllocatorStats stats = THCCachingHostAllocator_getStats();
+
+  py::dict result;
+  result["num_host_allocs"] = stats.num_host_allocs;
+  result["num_reuses"] = stats.num_reuses;
+  result["allocation"] = statToDict(stats.allocation);
+  result["allocated_bytes"] = statToDict(stats.allocated_bytes);
+  result["reserved_bytes"] = statToDict(stats.reserved_bytes);
+
+  return result.release().ptr();
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject * THCPModule_resetAccumulatedMemoryStats(PyObject *_unused, PyObject *arg)
 {
   HANDLE_TH_ERRORS
@@ -510,7 +702,15 @@ static struct PyMethodDef _THCPModule_methods[] = {
   {"_cuda_getCompiledVersion", (PyCFunction)THCPModule_getCompiledVersion, METH_NOARGS, nullptr},
   {"_cuda_hasPrimaryContext", (PyCFunction) THCPModule_hasPrimaryContext,  METH_O,  nullptr},
   {"_cuda_emptyCache", (PyCFunction) THCPModule_emptyCache, METH_NOARGS, nullptr},
+  {"_cuda_compactCache", (PyCFunction) THCPModule_compactCache, METH_NOARGS, nullptr},
+  {"_cuda_graphCaptureBegin", (PyCFunction) THCPModule_graphCaptureBegin, METH_NOARGS, nullptr},
+  {"_cuda_graphCaptureEnd", (PyCFunction) THCPModule_graphCaptureEnd, METH_NOARGS, nullptr},
+  {"_cuda_graphReplay", (PyCFunction) THCPModule_graphReplay, METH_O, nullptr},
+  {"_cuda_graphFree", (PyCFunction) THCPModule_graphFree, METH_O, nullptr},
   {"_cuda_memoryStats", (PyCFunction) THCPModule_memoryStats, METH_O, nullptr},
+  {"_cuda_hostMemoryStats", (PyCFunction) THCPModule_hostMemoryStats, METH_NOARGS, nullptr},
+  {"_cuda_setBlasMathMode", (PyCFunction) THCPModule_setBlasMathMode, METH_O, nullptr},
+  {"_cuda_getBlasMathMode", (PyCFunction) THCPModule_getBlasMathMode, METH_NOARGS, nullptr},
   {"_cuda_resetAccumulatedMemoryStats", (PyCFunction) THCPModule_resetAccumulatedMemoryStats, METH_O, nullptr},
   {"_cuda_resetPeakMemoryStats", (PyCFunction) THCPModule_resetPeakMemoryStats, METH_O,  nullptr},
   {"_cuda_memorySnapshot", (PyCFunction) THCPModule_memorySnapshot, METH_NOARGS, nullptr},
@@ -9,6 +9,7 @@
 
 #include <ATen/ATen.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAEvent.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <c10/util/Optional.h>
 #include <torch/csrc/autograd/variable.h>
@@ -34,6 +35,22 @@ struct unique_type_checker {
   bool unique = true;
 };
 
+// Note [Stream-parallel broadcast]
+//
+// Without NCCL, broadcast copies the tensor to each destination device with a
+// peer-to-peer copy, and copy_ runs every such copy on the *source* device's
+// current stream (see copy_device_to_device in Copy.cu). With the default
+// stream that serializes the whole fan-out: device N's copy cannot start
+// until device N-1's has finished, so an 8-GPU weight broadcast takes 7x one
+// copy instead of ~1x.
+//
+// To overlap them, each destination gets its own source-side stream from the
+// pool. Event chaining keeps the ordering sound: every pooled stream first
+// waits on an event recorded on the source's current stream (so copies see
+// pending writes to the tensor), copy_ internally makes the destination's
+// current stream wait for the copy, and afterwards the source's current
+// stream waits on each copy so the producer cannot reuse the source buffer
+// while a copy is still reading it.
 std::vector<Tensor> broadcast(const Tensor& tensor, IntArrayRef devices) {
   if (tensor.is_cuda() && tensor.get_device() != devices[0])
     throw std::runtime_error("device of broadcasted tensor must appear as the "
@@ -57,12 +74,38 @@ std::vector<Tensor> broadcast(const Tensor& tensor, IntArrayRef devices) {
       tensors.push_back(tensor);
     }
     IntArrayRef loop_devices = tensor.is_cuda() ? devices.slice(1) : devices;
-    for (auto device : loop_devices) {
-      tensors.push_back(tensor.to(
-          at::Device(kCUDA, device),
-          tensor.scalar_type(),
-          /*non_blocking=*/true,
-          /*copy=*/true));
+    if (tensor.is_cuda() && loop_devices.size() > 1) {
+      // See Note [Stream-parallel broadcast]
+      const auto src_device = tensor.get_device();
+      auto src_stream = at::cuda::getCurrentCUDAStream(src_device);
+      at::cuda::CUDAEvent src_ready;
+      src_ready.record(src_stream);
+      std::vector<at::cuda::CUDAStream> copy_streams;
+      copy_streams.reserve(loop_devices.size());
+      for (auto device : loop_devices) {
+        copy_streams.push_back(
+            at::cuda::getStreamFromPool(/*isHighPriority=*/false, src_device));
+        src_ready.block(copy_streams.back());
+        at::cuda::CUDAStreamGuard stream_guard(copy_streams.back());
+        tensors.push_back(tensor.to(
+            at::Device(kCUDA, device),
+            tensor.scalar_type(),
+            /*non_blocking=*/true,
+            /*copy=*/true));
+      }
+      for (auto& copy_stream : copy_streams) {
+        at::cuda::CUDAEvent copy_done;
+        copy_done.record(copy_stream);
+        copy_done.block(src_stream);
+      }
+    } else {
+      for (auto device : loop_devices) {
+        tensors.push_back(tensor.to(
+            at::Device(kCUDA, device),
+            tensor.scalar_type(),
+            /*non_blocking=*/true,
+            /*copy=*/true));
+      }
     }
   }
   return tensors;
@@ -79,4 +79,135 @@ void broadcast_coalesced(
   }
 }
 
+// Note [Pipelined tree broadcast]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// broadcast_coalesced() above issues one collective broadcast per bucket
+// and keeps at most two in flight. Every broadcast involves all ranks, so
+// with many ranks and many buckets the latency of the underlying
+// algorithm is paid once per bucket and the flatten/unflatten copies do
+// not overlap with much of the transfer.
+//
+// broadcast_coalesced_pipelined() instead arranges the ranks in a binomial
+// tree rooted at `root_rank` and streams the buckets down the tree over
+// point-to-point send/recv (supported by ProcessGroupGloo):
+//
+// - Every non-root rank posts receives for all buckets up front, so each
+//   bucket is accepted the moment its parent forwards it.
+// - A rank forwards bucket `i` to its children before unflattening it
+//   locally, so the copy back into the parameters overlaps both with the
+//   downstream transfer of bucket `i` and with the receive of bucket
+//   `i + 1`. The root flattens bucket `i` while the sends of bucket
+//   `i - 1` are still in flight.
+//
+// The bucket index doubles as the point-to-point tag so the streams to a
+// child cannot be reordered against each other.
+void broadcast_coalesced_pipelined(
+    std::shared_ptr<c10d::ProcessGroup> process_group,
+    at::TensorList tensors,
+    size_t buffer_size,
+    int root_rank) {
+  const auto size = process_group->getSize();
+  const auto rank = process_group->getRank();
+  TORCH_CHECK(
+      root_rank >= 0 && root_rank < size,
+      "Invalid root rank ",
+      root_rank,
+      " for process group of size ",
+      size);
+  if (size == 1 || tensors.empty()) {
+    return;
+  }
+
+  const auto buckets =
+      compute_bucket_assignment_by_size(tensors.vec(), {buffer_size});
+  const auto lookup = [&tensors](size_t index) { return tensors[index]; };
+
+  // Compute this rank's parent and children in the binomial tree. Virtual
+  // ranks place the root at 0 so the tree can be derived with plain bit
+  // arithmetic; toRank() maps back to actual ranks.
+  const int vrank = (rank - root_rank + size) % size;
+  const auto toRank = [&](int v) { return (v + root_rank) % size; };
+  int parent = -1;
+  int mask = 1;
+  while (mask < size) {
+    if (vrank & mask) {
+      parent = vrank - mask;
+      break;
+    }
+    mask <<= 1;
+  }
+  std::vector<int> children;
+  for (int m = mask >> 1; m > 0; m >>= 1) {
+    if (vrank + m < size) {
+      // Larger offsets root deeper subtrees; serving them first keeps the
+      // pipeline busy further down the tree.
+      children.push_back(vrank + m);
+    }
+  }
+
+  struct Chunk {
+    std::vector<at::Tensor> bucket_tensors;
+    // The flattened bucket contents. Stored in a vector because the
+    // ProcessGroup point-to-point API takes a vector argument.
+    std::vector<at::Tensor> flat;
+  };
+
+  std::vector<Chunk> chunks;
+  chunks.reserve(buckets.size());
+  for (const auto& bucket : buckets) {
+    Chunk chunk;
+    chunk.bucket_tensors = c10::fmap(bucket, lookup);
+    if (parent != -1) {
+      // Receive buffer; the contents arrive from the parent.
+      int64_t numel = 0;
+      for (const auto& tensor : chunk.bucket_tensors) {
+        numel += tensor.numel();
+      }
+      chunk.flat = {
+          at::empty({numel}, chunk.bucket_tensors.front().options())};
+    }
+    chunks.push_back(std::move(chunk));
+  }
+
+  // Post all receives up front so every bucket can be accepted as soon as
+  // the parent forwards it.
+  std::vector<std::shared_ptr<ProcessGroup::Work>> recv_works(chunks.size());
+  if (parent != -1) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      recv_works[i] = process_group->recv(chunks[i].flat, toRank(parent), i);
+    }
+  }
+
+  std::vector<std::shared_ptr<ProcessGroup::Work>> send_works;
+  send_works.reserve(children.size() * chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    auto& chunk = chunks[i];
+    if (parent == -1) {
+      // Flattening bucket i overlaps with the in-flight sends of bucket
+      // i - 1.
+      chunk.flat = {torch::utils::flatten_dense_tensors(chunk.bucket_tensors)};
+    } else {
+      recv_works[i]->wait();
+    }
+    // Forward to the children before touching the data locally, so the
+    // copies below overlap with the downstream transfers.
+    for (const auto child : children) {
+      send_works.push_back(process_group->send(chunk.flat, toRank(child), i));
+    }
+    if (parent != -1) {
+      auto output_tensors = torch::utils::unflatten_dense_tensors(
+          chunk.flat.front(), chunk.bucket_tensors);
+      TORCH_INTERNAL_ASSERT(
+          output_tensors.size() == chunk.bucket_tensors.size());
+      for (size_t j = 0; j < output_tensors.size(); ++j) {
+        chunk.bucket_tensors[j].copy_(output_tensors[j], /*non_blocking=*/true);
+      }
+    }
+  }
+
+  for (auto& work : send_works) {
+    work->wait();
+  }
+}
+
 } // namespace c10d
@@ -13,4 +13,15 @@ void broadcast_coalesced(
     at::TensorList tensors,
     size_t buffer_size);
 
+// Broadcast many tensors from `root_rank` by streaming the coalesced
+// buckets down a binomial tree over point-to-point send/recv, overlapping
+// the flatten/unflatten copies with the transfers. Requires a process
+// group that implements send/recv (e.g. ProcessGroupGloo).
+// See Note [Pipelined tree broadcast] in comm.cpp.
+void broadcast_coalesced_pipelined(
+    std::shared_ptr<c10d::ProcessGroup> process_group,
+    at::TensorList tensors,
+    size_t buffer_size,
+    int root_rank = 0);
+
 } // namespace c10d
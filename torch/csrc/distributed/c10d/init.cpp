@@ -18,6 +18,7 @@
 
 #include <c10d/PrefixStore.hpp>
 #include <c10d/ProcessGroupRoundRobin.hpp>
+#include <c10d/ProcessGroupScheduler.hpp>
 #include <c10d/TCPStore.hpp>
 #include <pybind11/chrono.h>
 
@@ -140,7 +141,26 @@ PyObject* c10d_init(PyObject* _unused) {
           [](::c10d::Reducer& reducer, const torch::autograd::Variable& output)
               -> void { reducer.prepare_for_backward({output}); },
           py::call_guard<py::gil_scoped_release>())
-      .def("get_backward_stats", &::c10d::Reducer::get_backward_stats);
+      .def("get_backward_stats", &::c10d::Reducer::get_backward_stats)
+      .def(
+          "set_grad_compression",
+          &::c10d::Reducer::set_grad_compression,
+          py::arg("type"),
+          py::arg("powersgd_rank") = 4)
+      .def(
+          "set_cache_unused_parameters",
+          &::c10d::Reducer::set_cache_unused_parameters,
+          py::arg("enable"))
+      .def(
+          "rebuild_buckets_by_backward_order",
+          &::c10d::Reducer::rebuild_buckets_by_backward_order,
+          py::arg("bucket_bytes_cap"),
+          py::call_guard<py::gil_scoped_release>());
+
+  py::enum_<::c10d::Reducer::GradCompression>(module, "GradCompression")
+      .value("NONE", ::c10d::Reducer::GradCompression::NONE)
+      .value("FP16", ::c10d::Reducer::GradCompression::FP16)
+      .value("POWER_SGD", ::c10d::Reducer::GradCompression::POWER_SGD);
 
   py::enum_<::c10d::ReduceOp>(module, "ReduceOp", R"(
 An enum-like class for available reduction operations: ``SUM``, ``PRODUCT``,
@@ -504,6 +524,30 @@ They are used in specifying strategies for reduction collectives, e.g.,
       py::arg("process_groups"),
       py::call_guard<py::gil_scoped_release>());
 
+  module.def(
+      "_scheduler_process_group",
+      // Wraps a process group in a scheduling layer that batches queued
+      // collectives and fuses compatible allreduce/broadcast calls.
+      // See Note [Collective fusion and scheduling] in
+      // ProcessGroupScheduler.cpp.
+      [](std::shared_ptr<::c10d::ProcessGroup> processGroup,
+         std::chrono::milliseconds fusionWindow,
+         size_t fusionBytesCap,
+         size_t priorityBytesThreshold)
+          -> std::shared_ptr<::c10d::ProcessGroup> {
+        ::c10d::ProcessGroupScheduler::Options options;
+        options.fusionWindow = fusionWindow;
+        options.fusionBytesCap = fusionBytesCap;
+        options.priorityBytesThreshold = priorityBytesThreshold;
+        return std::make_shared<::c10d::ProcessGroupScheduler>(
+            std::move(processGroup), options);
+      },
+      py::arg("process_group"),
+      py::arg("fusion_window") = std::chrono::milliseconds(5),
+      py::arg("fusion_bytes_cap") = (size_t)25 * 1024 * 1024,
+      py::arg("priority_bytes_threshold") = (size_t)8 * 1024,
+      py::call_guard<py::gil_scoped_release>());
+
 #ifdef USE_C10D_GLOO
   auto processGroupGloo = shared_ptr_class_<::c10d::ProcessGroupGloo>(
       module, "ProcessGroupGloo", processGroup);
@@ -585,7 +629,11 @@ They are used in specifying strategies for reduction collectives, e.g.,
           py::arg("rank"),
           py::arg("size"),
           py::arg("timeout") = std::chrono::milliseconds(
-              ::c10d::ProcessGroupNCCL::kProcessGroupNCCLOpTimeoutMillis));
+              ::c10d::ProcessGroupNCCL::kProcessGroupNCCLOpTimeoutMillis))
+      .def(
+          "set_hierarchical_allreduce",
+          &::c10d::ProcessGroupNCCL::setHierarchicalAllreduce,
+          py::arg("enable"));
 #endif
 
 #ifdef USE_C10D_MPI
@@ -685,6 +733,21 @@ They are used in specifying strategies for reduction collectives, e.g.,
       py::arg("buffer_size"),
       py::call_guard<py::gil_scoped_release>());
 
+  module.def(
+      "_broadcast_coalesced_pipelined",
+      [](std::shared_ptr<::c10d::ProcessGroup> process_group,
+         std::vector<at::Tensor> tensors,
+         size_t buffer_size,
+         int root_rank) {
+        broadcast_coalesced_pipelined(
+            process_group, tensors, buffer_size, root_rank);
+      },
+      py::arg("process_group"),
+      py::arg("tensors"),
+      py::arg("buffer_size"),
+      py::arg("root_rank") = 0,
+      py::call_guard<py::gil_scoped_release>());
+
   module.def(
       "_test_python_store",
       // Define a function that takes a c10d store and runs a few tests.
@@ -1,6 +1,9 @@
 #include <torch/csrc/distributed/c10d/reducer.h>
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <numeric>
 
 #include <c10/core/DeviceGuard.h>
 #include <c10/util/Exception.h>
@@ -37,6 +40,51 @@ inline int64_t current_time_in_nanos() {
   return torch::autograd::profiler::getTime();
 }
 
+// Note [Cached unused parameter detection]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With `find_unused_parameters=True`, `prepare_for_backward` traverses the
+// entire autograd graph every iteration to find the parameters that will not
+// receive a gradient. For large models whose parameter usage pattern does not
+// change across iterations, that traversal is pure overhead: it keeps
+// producing the same unused set.
+//
+// When enabled via `set_cache_unused_parameters(true)`, the unused set is
+// memoized together with a fingerprint of the model outputs' grad functions
+// (per output: the function name and its out-degree, plus the names of its
+// immediate inputs). As long as the fingerprint is unchanged, the traversal
+// is skipped and the memoized set is reused; when it changes, a regular
+// traversal runs and re-populates the cache.
+//
+// The fingerprint only inspects the output nodes and their direct neighbors;
+// graph node pointers change every iteration, so a deeper structural check
+// would amount to the very traversal this mode avoids. Control flow changes
+// deeper inside the model are therefore not detected, which is why this mode
+// is opt-in and documented as only valid for static usage patterns. A stale
+// cached set does not corrupt gradients: a parameter wrongly deemed unused
+// fails the duplicate-ready check in `mark_variable_ready`, and a parameter
+// wrongly deemed used makes the missing-finalize check in the next
+// `prepare_for_backward` fire.
+uint64_t compute_graph_fingerprint(
+    const std::vector<torch::autograd::Variable>& outputs) {
+  size_t seed = torch::get_hash(outputs.size());
+  for (const auto& output : outputs) {
+    const auto& grad_fn = output.grad_fn();
+    if (grad_fn == nullptr) {
+      seed = torch::hash_combine(seed, 0);
+      continue;
+    }
+    seed = torch::hash_combine(seed, torch::get_hash(grad_fn->name()));
+    const auto& edges = grad_fn->next_edges();
+    seed = torch::hash_combine(seed, torch::get_hash(edges.size()));
+    for (const auto& edge : edges) {
+      if (const auto next_ptr = edge.function.get()) {
+        seed = torch::hash_combine(seed, torch::get_hash(next_ptr->name()));
+      }
+    }
+  }
+  return seed;
+}
+
 } // namespace
 
 Reducer::Reducer(
@@ -260,8 +308,10 @@ void Reducer::mark_variable_ready_sparse(VariableIndex index) {
   // in a single reduction operation like we can for dense tensors.
   // Therefore, the `offsets` and `lengths` vectors in the bucket replica
   // struct are empty, and there is no pre-existing accumulation tensor.
-  // Directly assign the sparse tensor to the `contents` field.
-  replica.contents = grad;
+  // Directly assign the sparse tensor to the `contents` field. Coalesce
+  // first so the local segments are already summed and the announced nnz
+  // (see Note [Sparse gradient pipeline]) is minimal.
+  replica.contents = grad.coalesce();
 }
 
 // The function `autograd_hook` is called after the gradient for a
@@ -382,6 +432,50 @@ void Reducer::mark_variable_ready(VariableIndex index) {
   }
 }
 
+// Note [Gradient compression in the bucket pipeline]
+//
+// Allreducing raw fp32 buckets makes gradient bytes the scaling ceiling once
+// the network, not the GPUs, is the bottleneck. Two opt-in compression
+// schemes shrink the wire format while keeping the bucket pipeline intact:
+//
+// - FP16: the bucket contents are converted to half precision and the half
+//   buffer is allreduced in their place; finalize_backward converts back.
+//   The conversion residual is kept per bucket replica as error feedback and
+//   re-added to the next iteration's gradient, so quantization error
+//   accumulates into later updates instead of being lost. The allreduce
+//   stays asynchronous, so overlap with the rest of backward is unchanged.
+//
+// - POWER_SGD: the bucket is viewed as a 2-d matrix M and exchanged as
+//   rank-r factors from one power iteration (P = M Q, orthonormalize P,
+//   Q' = M^T P), with Q warm-started across iterations and the local
+//   projection residual kept as error feedback. The second factor depends on
+//   the allreduced first factor, so this exchange is inherently two-phase
+//   and runs synchronously in finalize_backward rather than from
+//   mark_bucket_ready; it trades backward overlap for a wire format that is
+//   r*(rows+cols) instead of rows*cols elements.
+//
+// Buckets holding sparse gradients or non-fp32 contents are left
+// uncompressed. Because bucket contents are pre-divided by the world size,
+// the fp16 wire values are gradient-sized and do not overflow half range.
+//
+// Note [Sparse gradient pipeline]
+//
+// Sparse gradients cannot be flattened into a bucket, and not every process
+// group implements a sparse allreduce, so they are exchanged with a
+// two-phase allgather pipeline instead:
+//
+//   1. Size negotiation: as soon as a sparse bucket is ready, every
+//      participant allgathers its number of non-zeros. This is a tiny
+//      asynchronous collective kicked off from mark_bucket_ready, so it
+//      overlaps with the dense buckets and the rest of backward.
+//   2. Data exchange: finalize_backward pads each participant's indices
+//      and values to the negotiated maximum, allgathers both, trims every
+//      shard back to its announced size, and segment-sums the shards with
+//      a single coalesce().
+//
+// Because bucket contents are pre-divided by the world size (like the
+// dense path), the sum of the gathered shards is already the average.
+//
 // Called when the bucket at the specified index is ready to be reduced.
 void Reducer::mark_bucket_ready(size_t bucket_index) {
   TORCH_INTERNAL_ASSERT(bucket_index >= next_bucket_);
@@ -398,8 +492,35 @@ void Reducer::mark_bucket_ready(size_t bucket_index) {
   for (; next_bucket_ < buckets_.size() && buckets_[next_bucket_].pending == 0;
        next_bucket_++) {
     auto& bucket = buckets_[next_bucket_];
+    if (bucket.expect_sparse_gradient) {
+      // Phase 1 of the sparse exchange; the data moves in
+      // finalize_bucket_sparse. See Note [Sparse gradient pipeline].
+      allgather_sparse_sizes(bucket);
+      continue;
+    }
+    const bool compress = grad_compression_ != GradCompression::NONE &&
+        !bucket.expect_sparse_gradient &&
+        bucket.replicas[0].contents.scalar_type() == at::kFloat;
+    if (compress && grad_compression_ == GradCompression::POWER_SGD) {
+      // The two-phase factor exchange runs in finalize_backward, see
+      // Note [Gradient compression in the bucket pipeline].
+      bucket.work.reset();
+      continue;
+    }
     std::vector<at::Tensor> tensors;
     tensors.reserve(bucket.replicas.size());
+    if (compress) {
+      for (auto& replica : bucket.replicas) {
+        if (replica.error.defined()) {
+          replica.contents.add_(replica.error);
+        }
+        replica.compressed = replica.contents.to(at::kHalf);
+        replica.error = replica.contents - replica.compressed.to(at::kFloat);
+        tensors.push_back(replica.compressed);
+      }
+      bucket.work = process_group_->allreduce(tensors);
+      continue;
+    }
     for (const auto& replica : bucket.replicas) {
       // TODO(@pietern): Ensure proper synchronization with the CUDA events
       // that recorded copies into this contents tensor. If these copies are
@@ -416,6 +537,51 @@ void Reducer::mark_bucket_ready(size_t bucket_index) {
   }
 }
 
+// Phase 1 of Note [Sparse gradient pipeline]: every participant announces
+// the number of non-zeros in its (coalesced) sparse gradient, so that
+// phase 2 knows how far to pad before gathering the actual data.
+void Reducer::allgather_sparse_sizes(Bucket& bucket) {
+  const auto num_participants =
+      bucket.replicas.size() * process_group_->getSize();
+
+  std::vector<at::Tensor> inputs;
+  std::vector<std::vector<at::Tensor>> outputs(bucket.replicas.size());
+  inputs.reserve(bucket.replicas.size());
+  for (size_t i = 0; i < bucket.replicas.size(); i++) {
+    auto& replica = bucket.replicas[i];
+    const auto& grad = replica.contents;
+    replica.sparse_nnz =
+        at::full({1}, grad._nnz(), grad._indices().options());
+    inputs.push_back(replica.sparse_nnz);
+    replica.sparse_nnz_out.clear();
+    replica.sparse_nnz_out.reserve(num_participants);
+    for (size_t j = 0; j < num_participants; j++) {
+      replica.sparse_nnz_out.push_back(at::empty_like(replica.sparse_nnz));
+    }
+    outputs[i] = replica.sparse_nnz_out;
+  }
+
+  bucket.work = process_group_->allgather(outputs, inputs);
+}
+
+void Reducer::set_cache_unused_parameters(bool enable) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  cache_unused_parameters_ = enable;
+  // Always drop the memoized set so that re-enabling starts from a clean
+  // slate instead of reusing a set computed for an older graph.
+  unused_cache_valid_ = false;
+  cached_unused_parameters_.clear();
+}
+
+void Reducer::set_grad_compression(
+    GradCompression type,
+    int64_t powersgd_rank) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(powersgd_rank >= 1, "powersgd_rank must be positive");
+  grad_compression_ = type;
+  powersgd_rank_ = powersgd_rank;
+}
+
 void Reducer::initialize_buckets(
     std::vector<std::vector<size_t>> bucket_indices) {
   std::lock_guard<std::mutex> lock(mutex_);
@@ -585,6 +751,17 @@ void Reducer::prepare_for_backward(
     return;
   }
 
+  // If the memoized unused set matches this graph, skip the traversal.
+  // See Note [Cached unused parameter detection].
+  uint64_t fingerprint = 0;
+  if (cache_unused_parameters_) {
+    fingerprint = compute_graph_fingerprint(outputs);
+    if (unused_cache_valid_ && fingerprint == unused_cache_fingerprint_) {
+      unused_parameters_ = cached_unused_parameters_;
+      return;
+    }
+  }
+
   // Seed queue with the grad functions of all outputs.
   for (const auto& output : outputs) {
     const auto& grad_fn = output.grad_fn();
@@ -617,9 +794,54 @@ void Reducer::prepare_for_backward(
 
     unused_parameters_.push_back(it.second);
   }
+
+  if (cache_unused_parameters_) {
+    unused_cache_fingerprint_ = fingerprint;
+    cached_unused_parameters_ = unused_parameters_;
+    unused_cache_valid_ = true;
+  }
 }
 
 // A bucket with one or more dense tensors needs to be unflattened.
+// Exchanges a bucket as rank-r factors from one warm-started power
+// iteration. Runs synchronously because the second factor needs the
+// allreduced first one; see Note [Gradient compression in the bucket
+// pipeline]. Bucket contents are already divided by the world size, so the
+// summed factors reconstruct an approximation of the average gradient.
+void Reducer::allreduce_powersgd(Bucket& bucket) {
+  for (auto& replica : bucket.replicas) {
+    const int64_t numel = replica.contents.numel();
+    const auto cols = std::max<int64_t>(
+        1, static_cast<int64_t>(std::ceil(std::sqrt(static_cast<double>(numel)))));
+    const auto rows = (numel + cols - 1) / cols;
+    const auto rank = std::min(powersgd_rank_, std::min(rows, cols));
+    if (!replica.matrix.defined()) {
+      replica.matrix = at::zeros({rows * cols}, replica.contents.options());
+      replica.low_rank_q =
+          at::randn({cols, rank}, replica.contents.options());
+    }
+    replica.matrix.narrow(0, 0, numel).copy_(replica.contents);
+    auto m = replica.matrix.view({rows, cols});
+    if (replica.error.defined()) {
+      m.add_(replica.error.view({rows, cols}));
+    }
+    auto p = m.mm(replica.low_rank_q);
+    std::vector<at::Tensor> p_vec{p};
+    process_group_->allreduce(p_vec)->wait();
+    // Only the column space of the summed P matters; orthonormalize so the
+    // scale moves into Q.
+    p = std::get<0>(at::qr(p));
+    auto q = m.t().mm(p);
+    // Error feedback tracks the part of the *local* gradient outside the
+    // subspace that was sent.
+    replica.error = (m - p.mm(q.t())).reshape({rows * cols});
+    std::vector<at::Tensor> q_vec{q};
+    process_group_->allreduce(q_vec)->wait();
+    replica.contents.copy_(p.mm(q.t()).view({rows * cols}).narrow(0, 0, numel));
+    replica.low_rank_q = q;
+  }
+}
+
 void Reducer::finalize_bucket_dense(Bucket& bucket) {
   for (size_t replica_index = 0; replica_index < bucket.replicas.size();
        replica_index++) {
@@ -680,16 +902,91 @@ void Reducer::finalize_bucket_dense(Bucket& bucket) {
   }
 }
 
-// A bucket with a single sparse tensor doesn't need to be unflattened,
-// but merely assigned to the corresponding variable its grad.
+// Phase 2 of Note [Sparse gradient pipeline]: exchange the sparse data
+// itself, now that every participant's number of non-zeros is known, and
+// assign the summed result to the corresponding variable's grad.
 void Reducer::finalize_bucket_sparse(Bucket& bucket) {
-  const auto result = bucket.work->result();
-  TORCH_INTERNAL_ASSERT(bucket.replicas.size() == result.size());
-  for (size_t i = 0; i < bucket.replicas.size(); i++) {
+  const auto num_replicas = bucket.replicas.size();
+  const auto num_participants = num_replicas * process_group_->getSize();
+
+  // The gathered announcements are identical on every replica.
+  std::vector<int64_t> nnzs;
+  int64_t max_nnz = 0;
+  nnzs.reserve(num_participants);
+  for (const auto& announced : bucket.replicas[0].sparse_nnz_out) {
+    nnzs.push_back(announced.item<int64_t>());
+    max_nnz = std::max(max_nnz, nnzs.back());
+  }
+
+  // Pad every replica's indices and values to the negotiated maximum so
+  // all participants gather equally shaped buffers.
+  std::vector<at::Tensor> indices_in;
+  std::vector<at::Tensor> values_in;
+  for (auto& replica : bucket.replicas) {
+    const auto& grad = replica.contents;
+    auto indices = grad._indices();
+    auto values = grad._values();
+    auto indices_buf =
+        at::zeros({indices.size(0), max_nnz}, indices.options());
+    auto values_sizes = values.sizes().vec();
+    values_sizes[0] = max_nnz;
+    auto values_buf = at::zeros(values_sizes, values.options());
+    const auto nnz = grad._nnz();
+    if (nnz > 0) {
+      indices_buf.narrow(1, 0, nnz).copy_(indices);
+      values_buf.narrow(0, 0, nnz).copy_(values);
+    }
+    indices_in.push_back(std::move(indices_buf));
+    values_in.push_back(std::move(values_buf));
+  }
+
+  std::vector<std::vector<at::Tensor>> indices_out(num_replicas);
+  std::vector<std::vector<at::Tensor>> values_out(num_replicas);
+  for (size_t i = 0; i < num_replicas; i++) {
+    indices_out[i].reserve(num_participants);
+    values_out[i].reserve(num_participants);
+    for (size_t j = 0; j < num_participants; j++) {
+      indices_out[i].push_back(at::empty_like(indices_in[i]));
+      values_out[i].push_back(at::empty_like(values_in[i]));
+    }
+  }
+
+  auto indices_work = process_group_->allgather(indices_out, indices_in);
+  auto values_work = process_group_->allgather(values_out, values_in);
+  indices_work->wait();
+  values_work->wait();
+
+  // Trim every shard back to its announced size and segment-sum the
+  // shards by index with a single coalesce. The contents were pre-divided
+  // by the world size, so the sum is already the average.
+  for (size_t i = 0; i < num_replicas; i++) {
     auto& replica = bucket.replicas[i];
     TORCH_INTERNAL_ASSERT(replica.variables.size() == 1);
     auto& variable = replica.variables.front();
-    variable.grad() = result[i];
+    const auto& grad = replica.contents;
+
+    std::vector<at::Tensor> all_indices;
+    std::vector<at::Tensor> all_values;
+    for (size_t j = 0; j < num_participants; j++) {
+      if (nnzs[j] == 0) {
+        continue;
+      }
+      all_indices.push_back(indices_out[i][j].narrow(1, 0, nnzs[j]));
+      all_values.push_back(values_out[i][j].narrow(0, 0, nnzs[j]));
+    }
+
+    if (all_indices.empty()) {
+      variable.grad() = at::zeros_like(grad);
+    } else {
+      variable.grad() =
+          at::sparse_coo_tensor(
+              at::cat(all_indices, 1), at::cat(all_values, 0), grad.sizes())
+              .coalesce();
+    }
+
+    // Release negotiation state.
+    replica.sparse_nnz = at::Tensor();
+    replica.sparse_nnz_out.clear();
   }
 }
 
@@ -707,11 +1004,24 @@ void Reducer::finalize_backward() {
 
   // Wait for asynchronous reduction to complete and unflatten contents.
   for (auto& bucket : buckets_) {
-    TORCH_INTERNAL_ASSERT(bucket.work);
-    bucket.work->wait();
+    if (bucket.work) {
+      bucket.work->wait();
+    } else {
+      // POWER_SGD buckets skip the async allreduce and run their two-phase
+      // exchange here, see Note [Gradient compression in the bucket
+      // pipeline].
+      allreduce_powersgd(bucket);
+    }
     if (bucket.expect_sparse_gradient) {
       finalize_bucket_sparse(bucket);
     } else {
+      for (auto& replica : bucket.replicas) {
+        if (replica.compressed.defined()) {
+          // Decompress the fp16 wire buffer back into the fp32 contents.
+          replica.contents.copy_(replica.compressed);
+          replica.compressed = at::Tensor();
+        }
+      }
       finalize_bucket_dense(bucket);
     }
   }
@@ -850,4 +1160,119 @@ std::vector<std::vector<size_t>> compute_bucket_assignment_by_size(
   return result;
 }
 
+// Note [Rebuilding buckets from backward timing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The initial bucket assignment is computed from parameter sizes alone
+// (see compute_bucket_assignment_by_size) under the assumption that
+// gradients become ready in reverse parameter order. For models where
+// that assumption does not hold (e.g. shared parameters, conditional
+// branches, or unbalanced layer costs), early buckets wait on stragglers
+// and the allreduce pipeline sits idle during the first part of backward.
+//
+// Since we already record when every gradient became ready relative to
+// `prepare_for_backward` (see `backward_stats_`), we can do better after
+// the fact: order variables by their measured ready time, greedily pack
+// them into byte-capped buckets in that order, and order the resulting
+// buckets by the ready time of their *last* gradient. Buckets are reduced
+// strictly in order (see `next_bucket_`), so a bucket effectively launches
+// when its slowest member arrives; sorting by last-ready time is what
+// maximizes overlap between communication and the remaining backward work.
+//
+// The new assignment must be identical across processes, which holds as
+// long as every process rebuilds from the same iteration's timing. Callers
+// are expected to ensure this (the DistributedDataParallel wrapper calls
+// this from every process at the same point in training).
+void Reducer::rebuild_buckets_by_backward_order(size_t bucket_bytes_cap) {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  // This shouldn't be called if we're expecting autograd hooks to fire.
+  TORCH_CHECK(
+      !expect_autograd_hooks_,
+      "`rebuild_buckets_by_backward_order` must NOT be called ",
+      "during autograd execution.");
+  TORCH_CHECK(bucket_bytes_cap > 0, "bucket_bytes_cap must be positive");
+
+  // Timing from the most recent backward pass. Buckets must be identical
+  // across replicas, so the first replica's timeline decides for all.
+  const auto& stats = backward_stats_[0];
+  TORCH_CHECK(
+      std::any_of(
+          stats.begin(), stats.end(), [](int64_t t) { return t != 0; }),
+      "No backward timing has been recorded yet; ",
+      "run at least one backward pass before rebuilding buckets.");
+
+  // Order variables by the time their gradient became ready.
+  std::vector<size_t> order(replicas_[0].size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return stats[a] < stats[b];
+  });
+
+  // Greedily pack variables into buckets in ready order. As in
+  // compute_bucket_assignment_by_size, a bucket must be homogeneous in
+  // type and device, and a sparse gradient gets a bucket of its own.
+  struct BucketAccumulator {
+    std::vector<size_t> indices;
+    size_t size = 0;
+    int64_t last_ready_time = 0;
+  };
+
+  struct Partition {
+    std::vector<size_t> indices;
+    int64_t last_ready_time;
+  };
+
+  std::unordered_map<BucketKey, BucketAccumulator, torch::hash<BucketKey>>
+      accumulators;
+  std::vector<Partition> partitions;
+
+  for (const auto variable_index : order) {
+    if (expect_sparse_gradients_[0][variable_index]) {
+      partitions.push_back({{variable_index}, stats[variable_index]});
+      continue;
+    }
+
+    const auto& variable = replicas_[0][variable_index];
+    auto key = BucketKey(variable.scalar_type(), variable.device());
+    auto& accumulator = accumulators[key];
+    accumulator.indices.push_back(variable_index);
+    accumulator.size += variable.numel() * variable.element_size();
+    accumulator.last_ready_time = stats[variable_index];
+    if (accumulator.size >= bucket_bytes_cap) {
+      partitions.push_back(
+          {std::move(accumulator.indices), accumulator.last_ready_time});
+      accumulator = BucketAccumulator();
+    }
+  }
+
+  // Add remaining partial buckets.
+  for (auto& it : accumulators) {
+    auto& accumulator = it.second;
+    if (!accumulator.indices.empty()) {
+      partitions.push_back(
+          {std::move(accumulator.indices), accumulator.last_ready_time});
+    }
+  }
+
+  // A bucket can only be reduced once its last gradient has arrived, and
+  // buckets are reduced in order, so order buckets by the time they would
+  // have been complete in the measured iteration.
+  std::sort(
+      partitions.begin(),
+      partitions.end(),
+      [](const Partition& a, const Partition& b) {
+        return a.last_ready_time < b.last_ready_time;
+      });
+
+  std::vector<std::vector<size_t>> bucket_indices;
+  bucket_indices.reserve(partitions.size());
+  for (auto& partition : partitions) {
+    bucket_indices.emplace_back(std::move(partition.indices));
+  }
+
+  // initialize_buckets takes the lock itself.
+  lock.unlock();
+  initialize_buckets(std::move(bucket_indices));
+}
+
 } // namespace c10d
@@ -47,6 +47,38 @@ class Reducer {
     return backward_stats_;
   }
 
+  // On-the-wire gradient compression applied to dense fp32 buckets.
+  // See Note [Gradient compression in the bucket pipeline] in reducer.cpp.
+  enum class GradCompression : uint8_t {
+    NONE,
+    // Buckets are converted to fp16 before allreduce and back afterwards.
+    FP16,
+    // Buckets are exchanged as rank-`powersgd_rank` factors obtained by a
+    // single power iteration (warm-started across iterations).
+    POWER_SGD,
+  };
+
+  // Selects the compression scheme for subsequent iterations. For POWER_SGD,
+  // `powersgd_rank` controls the rank of the exchanged factors. Both schemes
+  // keep per-bucket error-feedback state so the compression error is carried
+  // into the next iteration instead of lost.
+  void set_grad_compression(GradCompression type, int64_t powersgd_rank = 4);
+
+  // Enables or disables memoization of the unused parameter set computed by
+  // `prepare_for_backward`. While enabled, the autograd graph traversal is
+  // skipped as long as the graph fingerprint matches the one the cached set
+  // was computed for. Disabling clears the cache. Only enable this for models
+  // whose parameter usage pattern is static across iterations. See
+  // Note [Cached unused parameter detection] in reducer.cpp.
+  void set_cache_unused_parameters(bool enable);
+
+  // Re-partitions the buckets using the gradient ready times recorded by
+  // the most recent backward pass (see `backward_stats_`), so that bucket
+  // boundaries follow the order in which gradients actually become ready
+  // instead of reverse parameter order. Must be called outside a backward
+  // pass. See Note [Rebuilding buckets from backward timing] in reducer.cpp.
+  void rebuild_buckets_by_backward_order(size_t bucket_bytes_cap);
+
  protected:
   // Forward declaration.
   struct Bucket;
@@ -74,6 +106,13 @@ class Reducer {
 
   bool has_marked_unused_parameters_;
   std::vector<VariableIndex> unused_parameters_;
+  // Memoized unused parameter set and the graph fingerprint it was computed
+  // for. Only populated while `cache_unused_parameters_` is set. See
+  // Note [Cached unused parameter detection] in reducer.cpp.
+  bool cache_unused_parameters_ = false;
+  bool unused_cache_valid_ = false;
+  uint64_t unused_cache_fingerprint_ = 0;
+  std::vector<VariableIndex> cached_unused_parameters_;
   // Locally used parameter maps indicating if parameters are used locally
   // during the current iteration or no_sync session if no_sync is on. One
   // tensor for each model replica and each tensor is one-dim int32 tensor of
@@ -92,6 +131,10 @@ class Reducer {
   // Work handle for allreduce on local_used_maps_
   std::shared_ptr<c10d::ProcessGroup::Work> local_used_work_;
 
+  // See Note [Gradient compression in the bucket pipeline].
+  GradCompression grad_compression_ = GradCompression::NONE;
+  int64_t powersgd_rank_ = 4;
+
   void mark_variable_ready_dense(VariableIndex index);
 
   void mark_variable_ready_sparse(VariableIndex index);
@@ -102,6 +145,10 @@ class Reducer {
 
   void mark_bucket_ready(size_t bucket_index);
 
+  void allgather_sparse_sizes(Bucket& bucket);
+
+  void allreduce_powersgd(Bucket& bucket);
+
   void finalize_bucket_dense(Bucket& replica);
 
   void finalize_bucket_sparse(Bucket& replica);
@@ -136,6 +183,26 @@ class Reducer {
     // This is reset to `variables.size()` every iteration.
     size_t pending;
 
+    // Gradient compression state, only populated while compression is
+    // enabled. See Note [Gradient compression in the bucket pipeline].
+    //
+    // On-the-wire buffer for the FP16 scheme (half precision copy of
+    // `contents` that is allreduced in its place).
+    at::Tensor compressed;
+    // Error feedback: the part of this replica's gradient the compressed
+    // representation failed to carry, re-added next iteration.
+    at::Tensor error;
+    // POWER_SGD only: zero-padded copy of `contents` viewed as a 2-d matrix,
+    // and the warm-started right factor from the previous iteration.
+    at::Tensor matrix;
+    at::Tensor low_rank_q;
+
+    // Sparse buckets only: this replica's announced number of non-zeros
+    // and the gathered announcements of all participants.
+    // See Note [Sparse gradient pipeline].
+    at::Tensor sparse_nnz;
+    std::vector<at::Tensor> sparse_nnz_out;
+
     // TODO(@pietern)
     // Memory copies from gradient tensors into the bucket are potentially
     // done on different CUDA streams. We record an event for every copy
@@ -6,6 +6,7 @@
 #include <torch/csrc/distributed/rpc/python_rpc_handler.h>
 #include <torch/csrc/distributed/rpc/rpc_agent.h>
 #include <torch/csrc/distributed/rpc/rref_context.h>
+#include <torch/csrc/distributed/rpc/socket_agent.h>
 #include <torch/csrc/distributed/rpc/torchscript_functions.h>
 #include <torch/csrc/distributed/rpc/types.h>
 #include <torch/csrc/jit/python/pybind_utils.h>
@@ -348,6 +349,81 @@ If the future completes with an error, an exception is thrown.
           &ProcessGroupAgent::sync,
           py::call_guard<py::gil_scoped_release>());
 
+  shared_ptr_class_<SocketRpcBackendOptions>(
+      module,
+      "SocketRpcBackendOptions",
+      rpcBackendOptions,
+      R"(
+          The backend options class for ``SocketAgent``, which is derived
+          from ``RpcBackendOptions``.
+
+          Arguments:
+              num_worker_threads (int, optional): The number of threads in
+                  the thread-pool used by ``SocketAgent`` to process
+                  requests and responses (default: 4).
+              rpc_timeout (datetime.timedelta, optional): The timeout for RPC
+                  requests (default: ``timedelta(seconds=60)``).
+              init_method (str, optional): The URL to initialize the
+                  rendezvous store (default: ``env://``).
+      )")
+      .def(
+          py::init<int, std::chrono::milliseconds, std::string>(),
+          py::arg("num_worker_threads") = kDefaultNumSocketThreads,
+          py::arg("rpc_timeout") = kDefaultRpcTimeout,
+          py::arg("init_method") = kDefaultInitMethod)
+      .def_readwrite(
+          "num_worker_threads",
+          &SocketRpcBackendOptions::numWorkerThreads,
+          R"(
+              The number of threads in the thread-pool used by SocketAgent.
+          )");
+
+  module.attr("_DEFAULT_NUM_WORKER_THREADS") =
+      py::cast(kDefaultNumSocketThreads);
+
+  shared_ptr_class_<SocketAgent>(module, "SocketAgent", rpcAgent)
+      .def(
+          py::init<
+              std::string,
+              worker_id_t,
+              int,
+              std::shared_ptr<::c10d::Store>,
+              int,
+              std::chrono::milliseconds>(),
+          py::arg("name"),
+          py::arg("rank"),
+          py::arg("world_size"),
+          py::arg("store"),
+          py::arg("num_worker_threads"),
+          py::arg("rpc_timeout"))
+      .def(
+          "get_worker_info",
+          (const WorkerInfo& (SocketAgent::*)(void)const) &
+              RpcAgent::getWorkerInfo,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "get_worker_info",
+          (const WorkerInfo& (SocketAgent::*)(const std::string&)const) &
+              SocketAgent::getWorkerInfo,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "get_worker_infos",
+          (std::vector<WorkerInfo>(SocketAgent::*)() const) &
+              SocketAgent::getWorkerInfos,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "join",
+          &SocketAgent::join,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "shutdown",
+          &SocketAgent::shutdown,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "sync",
+          &SocketAgent::sync,
+          py::call_guard<py::gil_scoped_release>());
+
   module.def("_is_current_rpc_agent_set", &RpcAgent::isCurrentRpcAgentSet);
 
   module.def("_get_current_rpc_agent", &RpcAgent::getCurrentRpcAgent);
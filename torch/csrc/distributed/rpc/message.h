@@ -44,6 +44,9 @@ enum MessageType {
   CLEANUP_AUTOGRAD_CONTEXT_REQ = 19,
   CLEANUP_AUTOGRAD_CONTEXT_RESP = 20,
 
+  // An OwnerRRef tells users that cached copies of its value are stale.
+  RREF_CACHE_INVALIDATE = 21,
+
   // Other internal message types
   EXCEPTION = 55,
   UNKNOWN = 60
@@ -406,15 +406,33 @@ std::shared_ptr<FutureMessage> ProcessGroupAgent::send(
   return future;
 }
 
+// Note [Zero-copy tensor sections]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Remote messages used to be flattened into a single contiguous buffer by
+// wireSerialize(), which copies every tensor's bytes into the buffer on
+// the way out and back out of it on the way in. For multi-GB tensors both
+// copies dominate the transfer. Instead, we serialize with
+// wireSerializeChunks(): only the section header, the payload and the
+// pickled tensor *metadata* form the header buffer, while each tensor's
+// data travels as its own send, viewed straight out of its storage. The
+// receiver learns the chunk count from the preamble and the chunk sizes
+// from the header, receives each chunk into a freshly allocated buffer,
+// and the unpickler adopts those buffers as tensor storage, so neither
+// side copies tensor data. Self-sends keep the flattened format; aliasing
+// the sender's storages into the locally delivered message would make the
+// callee observe the caller's subsequent mutations.
 void ProcessGroupAgent::handleSend(const SendWork& work) {
-  auto serializedPayload = std::make_unique<std::string>(std::move(
-      wireSerialize(work.message_.payload(), work.message_.tensors())));
+  // See Note [Zero-copy tensor sections].
+  auto serialized =
+      std::make_unique<std::pair<std::string, std::vector<torch::Tensor>>>(
+          wireSerializeChunks(work.message_.payload(), work.message_.tensors()));
 
   std::vector<torch::Tensor> preamble = {torch::tensor(
       {(int64_t)pg_->getRank(),
-       (int64_t)serializedPayload->length(),
+       (int64_t)serialized->first.length(),
        (int64_t)work.message_.type(),
-       (int64_t)work.message_.id()},
+       (int64_t)work.message_.id(),
+       (int64_t)serialized->second.size()},
       {torch::kInt64})};
 
   // ProcessGroup is not thread-safe when sending with the same tag,
@@ -422,22 +440,34 @@ void ProcessGroupAgent::handleSend(const SendWork& work) {
   std::vector<std::shared_ptr<c10d::ProcessGroup::Work>> pendingSends;
   const auto dst = work.to_.id_;
 
-  auto serializedPayloadData = const_cast<char*>(serializedPayload->data());
-  auto serializedPayloadSize = serializedPayload->size();
-  std::string* deleteWhenDone = serializedPayload.release();
-  std::vector<torch::Tensor> payload = {torch::from_blob(
-      reinterpret_cast<void*>(serializedPayloadData),
-      serializedPayloadSize,
+  auto headerData = const_cast<char*>(serialized->first.data());
+  auto headerSize = serialized->first.size();
+  auto* deleteWhenDone = serialized.release();
+  // The blob also owns the chunk views, whose deleters keep the pickled
+  // tensor data alive; the chunk copies handed to send() below hold their
+  // own references, so releasing the blob early is safe.
+  std::vector<torch::Tensor> header = {torch::from_blob(
+      reinterpret_cast<void*>(headerData),
+      headerSize,
       [deleteWhenDone](void*) { delete deleteWhenDone; },
       {torch::kChar})};
-  pendingSends.reserve(2);
+  pendingSends.reserve(2 + deleteWhenDone->second.size());
 
   sendCounts_.increment(dst);
 
   {
     std::lock_guard<std::mutex> guard(sendMutexes_[dst]);
     pendingSends.emplace_back(pg_->send(preamble, dst, dst /* channelTag */));
-    pendingSends.emplace_back(pg_->send(payload, dst, dst /* channelTag */));
+    pendingSends.emplace_back(pg_->send(header, dst, dst /* channelTag */));
+    for (auto& chunk : deleteWhenDone->second) {
+      if (chunk.numel() == 0) {
+        // The receiver reconstructs empty sections locally.
+        continue;
+      }
+      std::vector<torch::Tensor> chunkVec = {chunk};
+      pendingSends.emplace_back(
+          pg_->send(chunkVec, dst, dst /* channelTag */));
+    }
   }
   // Write pendingSends to a global map so that they can be interrupted by
   // ::shutdown().
@@ -495,7 +525,13 @@ void ProcessGroupAgent::enqueueSend(SendWork work) {
 
 bool ProcessGroupAgent::handleRecv(RecvWork& work) {
   torch::Tensor& payload = work.payload_;
-  auto data = wireDeserialize(payload.storage().data(), payload.numel());
+  // Self-sends and tensor-less messages arrive in the flattened format;
+  // remote messages with tensors carry their data out of line.
+  // See Note [Zero-copy tensor sections].
+  auto data = work.chunks_.empty()
+      ? wireDeserialize(payload.storage().data(), payload.numel())
+      : wireDeserializeChunks(
+            payload.storage().data(), payload.numel(), work.chunks_);
   Message message(
       std::move(data.first), std::move(data.second), work.type_, work.id_);
   if (message.isRequest()) {
@@ -695,8 +731,8 @@ void ProcessGroupAgent::listenLoop() {
 
 void ProcessGroupAgent::listenLoopInternal() {
   while (rpcRunning_.load()) {
-    // rank, tensor size, message type
-    std::vector<torch::Tensor> preamble = {torch::empty({4}, {torch::kInt64})};
+    // rank, header size, message type, message id, chunk count
+    std::vector<torch::Tensor> preamble = {torch::empty({5}, {torch::kInt64})};
     auto work = pg_->recvAnysource(preamble, pg_->getRank());
     {
       std::lock_guard<std::mutex> guard(recvWorkMutex_);
@@ -713,12 +749,38 @@ void ProcessGroupAgent::listenLoopInternal() {
     auto size = preamble_items[1];
     MessageType type = MessageType(preamble_items[2]);
     int64_t id = preamble_items[3];
+    int64_t numChunks = preamble_items[4];
 
     std::vector<torch::Tensor> tensors = {torch::empty({size}, {torch::kChar})};
     pg_->recv(tensors, srcRank, pg_->getRank())->wait();
 
-    enqueueRecv(
-        RecvWork(allWorkerInfo_[srcRank], type, id, std::move(tensors[0])));
+    // Receive the out-of-line tensor sections, each into its own buffer
+    // that later becomes the deserialized tensor's storage.
+    // See Note [Zero-copy tensor sections].
+    std::vector<torch::Tensor> chunks;
+    if (numChunks > 0) {
+      const auto chunkSizes =
+          wireChunkSizes(tensors[0].storage().data(), tensors[0].numel());
+      TORCH_INTERNAL_ASSERT(
+          chunkSizes.size() == static_cast<size_t>(numChunks),
+          "Chunk count in preamble does not match wire header.");
+      chunks.reserve(numChunks);
+      for (const auto chunkSize : chunkSizes) {
+        chunks.push_back(
+            torch::empty({(int64_t)chunkSize}, {torch::kChar}));
+        if (chunkSize > 0) {
+          std::vector<torch::Tensor> chunkVec = {chunks.back()};
+          pg_->recv(chunkVec, srcRank, pg_->getRank())->wait();
+        }
+      }
+    }
+
+    enqueueRecv(RecvWork(
+        allWorkerInfo_[srcRank],
+        type,
+        id,
+        std::move(tensors[0]),
+        std::move(chunks)));
   }
 }
 
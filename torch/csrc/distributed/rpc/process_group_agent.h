@@ -48,13 +48,23 @@ struct RecvWork {
       const WorkerInfo& from,
       MessageType type,
       int64_t id,
-      torch::Tensor&& payload)
-      : from_(from), type_(type), id_(id), payload_(payload) {}
+      torch::Tensor&& payload,
+      std::vector<torch::Tensor>&& chunks = {})
+      : from_(from),
+        type_(type),
+        id_(id),
+        payload_(payload),
+        chunks_(chunks) {}
 
   const WorkerInfo& from_;
   const MessageType type_;
   const int64_t id_;
   torch::Tensor payload_;
+  // Out-of-line tensor data received separately from the header when the
+  // chunked wire format is in use; empty for self-sends and tensor-less
+  // messages. See Note [Zero-copy tensor sections] in
+  // process_group_agent.cpp.
+  std::vector<torch::Tensor> chunks_;
 };
 
 class ProcessGroupAgent : public RpcAgent {
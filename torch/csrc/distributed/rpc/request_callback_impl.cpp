@@ -252,7 +252,13 @@ void RequestCallbackImpl::processRpc(
       auto& ctx = RRefContext::getInstance();
       c10::intrusive_ptr<OwnerRRef> rref = ctx.getOwnerRRef(srf.rrefId());
       if (rref->hasValue()) { // optional fast-path
-        markComplete(ScriptRRefFetchRet({rref->getValue()}).toMessage());
+        // NB: read the version before the value, so that a concurrent
+        // setValue can only make the tag older than the returned value,
+        // never newer. A too-old tag is corrected by the subsequent cache
+        // invalidation. See Note [RRef Value Cache] in rref_impl.cpp.
+        auto version = rref->valueVersion();
+        markComplete(
+            ScriptRRefFetchRet({rref->getValue()}, version).toMessage());
         return;
       } else {
         auto whenValueSet = rref->getFuture();
@@ -262,7 +268,9 @@ void RequestCallbackImpl::processRpc(
                 const rpc::Message& /* unused */,
                 const c10::optional<utils::FutureError>& error) {
               if (!error) {
-                Message m = ScriptRRefFetchRet({rref->getValue()}).toMessage();
+                auto version = rref->valueVersion();
+                Message m =
+                    ScriptRRefFetchRet({rref->getValue()}, version).toMessage();
                 m.setId(messageId);
                 responseFuture->markCompleted(std::move(m));
               } else {
@@ -277,6 +285,9 @@ void RequestCallbackImpl::processRpc(
       auto& ctx = RRefContext::getInstance();
       c10::intrusive_ptr<OwnerRRef> rref = ctx.getOwnerRRef(prf.rrefId());
       if (rref->hasValue()) { // optional fast-path
+        // See the version/value read ordering comment in the
+        // SCRIPT_RREF_FETCH_CALL case above.
+        auto version = rref->valueVersion();
         auto value = rref->getValue();
         py::object pyValue;
         {
@@ -286,7 +297,8 @@ void RequestCallbackImpl::processRpc(
         SerializedPyObj result =
             PythonRpcHandler::getInstance().serialize(pyValue);
         markComplete(
-            PythonRRefFetchRet(std::move(result).toIValues()).toMessage());
+            PythonRRefFetchRet(std::move(result).toIValues(), version)
+                .toMessage());
         return;
       }
 
@@ -298,6 +310,7 @@ void RequestCallbackImpl::processRpc(
               const rpc::Message& /* unused */,
               const c10::optional<utils::FutureError>& error) {
             if (!error) {
+              auto version = rref->valueVersion();
               auto value = rref->getValue();
               py::object pyValue;
               {
@@ -307,7 +320,8 @@ void RequestCallbackImpl::processRpc(
               SerializedPyObj result =
                   PythonRpcHandler::getInstance().serialize(pyValue);
               Message m =
-                  PythonRRefFetchRet(std::move(result).toIValues()).toMessage();
+                  PythonRRefFetchRet(std::move(result).toIValues(), version)
+                      .toMessage();
               m.setId(messageId);
               responseFuture->markCompleted(std::move(m));
             } else {
@@ -341,6 +355,13 @@ void RequestCallbackImpl::processRpc(
       markComplete(RRefAck().toMessage());
       return;
     }
+    case MessageType::RREF_CACHE_INVALIDATE: {
+      auto& rci = static_cast<RRefCacheInvalidate&>(rpc);
+      auto& ctx = RRefContext::getInstance();
+      ctx.invalidateUserRRefCaches(rci.rrefId(), rci.version());
+      markComplete(RRefAck().toMessage());
+      return;
+    }
     case MessageType::FORWARD_AUTOGRAD_REQ: {
       auto& rpcWithAutograd = static_cast<RpcWithAutograd&>(rpc);
 
@@ -163,6 +163,66 @@ c10::intrusive_ptr<UserRRef> RRefContext::createUserRRef(
   return c10::make_intrusive<UserRRef>(ownerId, rrefId, forkId, type);
 }
 
+void RRefContext::notifyForksOfMutation(
+    const RRefId& rrefId,
+    uint64_t version) {
+  // Collect the set of workers holding forks of this OwnerRRef. Multiple
+  // forks may live on the same worker, but one invalidation per worker is
+  // enough, as the handler invalidates all local UserRRefs of this RRefId.
+  std::unordered_set<worker_id_t> workerIds;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto rrefIter = forks_.find(rrefId);
+    if (rrefIter == forks_.end()) {
+      return;
+    }
+    for (const auto& forkId : rrefIter->second) {
+      if (forkId.createdOn_ != getWorkerId()) {
+        workerIds.insert(forkId.createdOn_);
+      }
+    }
+  }
+
+  for (const auto workerId : workerIds) {
+    auto fm = agent_->sendWithRetries(
+        agent_->getWorkerInfo(workerId),
+        RRefCacheInvalidate(rrefId, version).toMessage());
+    fm->addCallback([](const Message& /* unused */,
+                       const c10::optional<utils::FutureError>& futErr) {
+      handleException(futErr);
+    });
+  }
+}
+
+void RRefContext::invalidateUserRRefCaches(
+    const RRefId& rrefId,
+    uint64_t version) {
+  // Collect matching UserRRefs while holding the lock, but invoke
+  // invalidateCachedValue with the lock released. Destructing the collected
+  // intrusive_ptrs may trigger release_resources() -> tryDel(), which
+  // re-acquires the lock.
+  std::vector<c10::intrusive_ptr<RRef>> users;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : confirmedUsers_) {
+      auto rref = entry.second.lock();
+      if (rref && rref->rrefId() == rrefId) {
+        users.emplace_back(std::move(rref));
+      }
+    }
+    for (const auto& entry : pendingUsers_) {
+      const auto& rref = entry.second->rref_;
+      if (rref->rrefId() == rrefId) {
+        users.emplace_back(rref);
+      }
+    }
+  }
+  for (auto& user : users) {
+    c10::static_intrusive_pointer_cast<UserRRef>(user)->invalidateCachedValue(
+        version);
+  }
+}
+
 void RRefContext::delUser(
     const worker_id_t owner,
     const RRefId& rrefId,
@@ -176,6 +176,15 @@ class TORCH_API RRefContext {
   // TODO: make this a context guard
   void clearRecordedPendingRRefsOnError();
 
+  // Owner-side: sends RREF_CACHE_INVALIDATE to every worker with a known fork
+  // of the given OwnerRRef, telling them that cached copies of the value
+  // older than ``version`` are stale. See Note [RRef Value Cache] in
+  // rref_impl.cpp.
+  void notifyForksOfMutation(const RRefId& rrefId, uint64_t version);
+  // User-side: handler for RREF_CACHE_INVALIDATE. Drops stale cached values
+  // on all local UserRRefs of the given OwnerRRef.
+  void invalidateUserRRefCaches(const RRefId& rrefId, uint64_t version);
+
   void delUser(
       const worker_id_t owner,
       const RRefId& rrefId,
@@ -1,5 +1,7 @@
 #include <torch/csrc/distributed/rpc/rref_impl.h>
 
+#include <cstdlib>
+
 #include <torch/csrc/distributed/autograd/rpc_messages/rpc_with_autograd.h>
 #include <torch/csrc/distributed/autograd/utils.h>
 #include <torch/csrc/distributed/rpc/rref_context.h>
@@ -9,6 +11,39 @@
 namespace {
 // If the type is subtype of named type, return its qualifiedname, otherwise
 // return its type str.
+// Note [RRef Value Cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// Every UserRRef::toHere() call fetches the value from the owner, even if the
+// owner-side value has not changed since the last fetch. For workloads that
+// repeatedly call to_here() on RRefs holding immutable data (e.g.,
+// pipeline-parallel setups re-reading weight shards), this re-transfers the
+// same tensors over and over. When the TORCH_RPC_RREF_CACHE environment
+// variable is set to "1", UserRRef caches the fetched value locally so that
+// repeated to_here() calls on unchanged values are local hits.
+//
+// Cache entries are tagged with an owner-side version number, which the
+// OwnerRRef bumps on every setValue() call and includes in every fetch
+// response. When setValue() overwrites an existing value, the owner sends
+// RREF_CACHE_INVALIDATE to all workers with known forks, and those workers
+// drop cache entries older than the advertised version. A fetch response that
+// races with an invalidation carries a version older than the invalidation
+// and is not cached.
+//
+// The cache is off by default because a cached value shares tensor storage
+// across to_here() calls: in-place modification of a previously returned
+// value would become visible in later calls, whereas uncached fetches always
+// return fresh copies. It should only be enabled when fetched values are
+// treated as read-only. Also note that invalidation only covers owner-side
+// setValue() calls; the owner cannot observe in-place mutation of tensors
+// inside an already-set value.
+bool rrefValueCacheEnabled() {
+  // Deliberately not latched into a static so that tests (and applications)
+  // can toggle the cache at runtime; the lookup cost is negligible compared
+  // to an RPC round trip.
+  const char* str = std::getenv("TORCH_RPC_RREF_CACHE");
+  return str != nullptr && std::string(str) == "1";
+}
+
 std::string getTypeStr(const c10::TypePtr& type) {
   switch (type->kind()) {
     case c10::TypeKind::FunctionType:
@@ -129,6 +164,15 @@ IValue UserRRef::toHere() {
       RpcAgent::getCurrentRpcAgent()->getWorkerInfo().name_,
       ".");
 
+  // see Note [RRef Value Cache]
+  const bool useCache = rrefValueCacheEnabled();
+  if (useCache) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (cachedValue_.has_value()) {
+      return *cachedValue_;
+    }
+  }
+
   auto agent = RpcAgent::getCurrentRpcAgent();
 
   // ScriptRRefFetchCall message always carries autograd context id even if
@@ -158,12 +202,32 @@ IValue UserRRef::toHere() {
       "or PYTHON_RREF_FETCH_RET");
   RpcCommandBase& rpc = *response;
   auto& rrefFetchRet = static_cast<RRefFetchRet&>(rpc);
+  IValue value;
   if (isPyObj()) {
     // wrap python serialized vector of ivalues into tuple, this
     // made the C++ toHere interface to return single IValue
-    return ivalue::Tuple::create(rrefFetchRet.values());
+    value = ivalue::Tuple::create(rrefFetchRet.values());
   } else {
-    return rrefFetchRet.values().front();
+    value = rrefFetchRet.values().front();
+  }
+
+  if (useCache) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    // Do not cache the value if an invalidation for a newer version arrived
+    // while this fetch was in flight. See Note [RRef Value Cache].
+    if (rrefFetchRet.version() >= invalidatedVersion_) {
+      cachedValue_ = value;
+      cachedVersion_ = rrefFetchRet.version();
+    }
+  }
+  return value;
+}
+
+void UserRRef::invalidateCachedValue(uint64_t version) {
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  invalidatedVersion_ = std::max(invalidatedVersion_, version);
+  if (cachedValue_.has_value() && cachedVersion_ < invalidatedVersion_) {
+    cachedValue_.reset();
   }
 }
 
@@ -226,9 +290,16 @@ std::shared_ptr<FutureMessage> OwnerRRef::getFuture() {
   return ret;
 }
 
+uint64_t OwnerRRef::valueVersion() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return version_;
+}
+
 void OwnerRRef::setValue(IValue&& value) {
   std::unique_lock<std::mutex> lock(mutex_);
+  const bool isMutation = value_.has_value();
   value_ = std::move(value);
+  const uint64_t version = ++version_;
   std::shared_ptr<FutureMessage> future;
   future.swap(future_);
   lock.unlock();
@@ -236,6 +307,11 @@ void OwnerRRef::setValue(IValue&& value) {
   if (future.get() && !future->completed()) {
     future->markCompleted(Message());
   }
+  if (isMutation) {
+    // Overwriting an existing value makes cached copies on users stale.
+    // See Note [RRef Value Cache].
+    RRefContext::getInstance().notifyForksOfMutation(rrefId_, version);
+  }
 }
 
 } // namespace rpc
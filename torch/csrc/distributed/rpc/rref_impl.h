@@ -270,9 +270,16 @@ class TORCH_API UserRRef final : public RRef {
   const ForkId& forkId() const;
 
   // Get of copy of the value from the ``OwnerRRef``. If the value is not ready
-  // yet, this call will block.
+  // yet, this call will block. When the RRef value cache is enabled, repeated
+  // calls on unchanged owner values are served locally. See
+  // Note [RRef Value Cache] in rref_impl.cpp.
   IValue toHere();
 
+  // Drops the locally cached value if it is older than the given owner-side
+  // version. Invoked when this worker receives a RREF_CACHE_INVALIDATE
+  // message from the owner.
+  void invalidateCachedValue(uint64_t version);
+
   void tryDel() override;
 
   // Will be called when refcount reaches 0.
@@ -303,6 +310,16 @@ class TORCH_API UserRRef final : public RRef {
   bool deletedOnOwner_{false};
   // Indicating whether this UserRRef has been confirmed by its owner.
   std::atomic<bool> confirmedByOwner_;
+
+  // State for the optional RRef value cache, guarded by cacheMutex_. See
+  // Note [RRef Value Cache] in rref_impl.cpp.
+  std::mutex cacheMutex_;
+  c10::optional<IValue> cachedValue_;
+  // Owner-side version of the cached value.
+  uint64_t cachedVersion_{0};
+  // Highest version this user has been told about through invalidations.
+  // Fetched values older than this must not be cached.
+  uint64_t invalidatedVersion_{0};
 };
 
 // Keep the template only on the derived class because ``RRefContext`` needs to
@@ -350,10 +367,17 @@ class TORCH_API OwnerRRef final : public RRef {
   // Gets a future that is satisfied when the value is set.
   std::shared_ptr<FutureMessage> getFuture();
 
+  // Returns the current version of the value. The version starts at 0 and is
+  // bumped on every ``setValue`` call, so users can tag cached copies of the
+  // value with it. See Note [RRef Value Cache] in rref_impl.cpp.
+  uint64_t valueVersion() const;
+
  private:
   friend class RRefContext;
 
   c10::optional<IValue> value_;
+  // Bumped on every setValue call, guarded by mutex_.
+  uint64_t version_{0};
   mutable std::mutex mutex_;
   mutable std::condition_variable valueCV_;
   std::shared_ptr<FutureMessage> future_;
@@ -129,8 +129,15 @@ const std::vector<at::IValue>& RRefFetchRet::values() {
   return values_;
 }
 
+uint64_t RRefFetchRet::version() const {
+  return version_;
+}
+
 Message RRefFetchRet::toMessageImpl() && {
+  // The owner-side value version is appended as the last IValue and stripped
+  // off again in fromMessage.
   std::vector<at::IValue> ivalues = values_;
+  ivalues.emplace_back(static_cast<int64_t>(version_));
   std::vector<torch::Tensor> tensor_table;
   auto payload =
       jit::pickle(c10::ivalue::Tuple::create(ivalues), &tensor_table);
@@ -141,16 +148,23 @@ std::unique_ptr<ScriptRRefFetchRet> ScriptRRefFetchRet::fromMessage(
     const Message& message) {
   auto values = toIValues(message, MessageType::SCRIPT_RREF_FETCH_RET);
   TORCH_INTERNAL_ASSERT(
-      values.size() == 1,
-      "RRef of IValue should contain a single IValue, but got ",
+      values.size() == 2,
+      "RRef of IValue should contain a single IValue and a version, but got ",
       values.size());
-  return std::make_unique<ScriptRRefFetchRet>(std::move(values));
+  auto version = static_cast<uint64_t>(values.back().toInt());
+  values.pop_back();
+  return std::make_unique<ScriptRRefFetchRet>(std::move(values), version);
 }
 
 std::unique_ptr<PythonRRefFetchRet> PythonRRefFetchRet::fromMessage(
     const Message& message) {
-  return std::make_unique<PythonRRefFetchRet>(
-      toIValues(message, MessageType::PYTHON_RREF_FETCH_RET));
+  auto values = toIValues(message, MessageType::PYTHON_RREF_FETCH_RET);
+  TORCH_INTERNAL_ASSERT(
+      !values.empty(),
+      "PythonRRefFetchRet expects at least a version IValue from message");
+  auto version = static_cast<uint64_t>(values.back().toInt());
+  values.pop_back();
+  return std::make_unique<PythonRRefFetchRet>(std::move(values), version);
 }
 
 std::unique_ptr<RRefUserDelete> RRefUserDelete::fromMessage(
@@ -189,6 +203,26 @@ std::unique_ptr<RRefForkRequest> RRefForkRequest::fromMessage(
   return std::make_unique<RRefForkRequest>(pair.first, pair.second);
 }
 
+uint64_t RRefCacheInvalidate::version() const {
+  return version_;
+}
+
+Message RRefCacheInvalidate::toMessageImpl() && {
+  return fromIValues(
+      {rrefId_.toIValue(), static_cast<int64_t>(version_)},
+      MessageType::RREF_CACHE_INVALIDATE);
+}
+
+std::unique_ptr<RRefCacheInvalidate> RRefCacheInvalidate::fromMessage(
+    const Message& message) {
+  auto values = toIValues(message, MessageType::RREF_CACHE_INVALIDATE);
+  TORCH_INTERNAL_ASSERT(
+      values.size() == 2, "RRefCacheInvalidate expects 2 IValues from message");
+  return std::make_unique<RRefCacheInvalidate>(
+      RRefId::fromIValue(values[0]),
+      static_cast<uint64_t>(values[1].toInt()));
+}
+
 Message RRefAck::toMessageImpl() && {
   return Message({}, {}, MessageType::RREF_ACK);
 }
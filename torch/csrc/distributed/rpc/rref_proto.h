@@ -81,24 +81,32 @@ class TORCH_API PythonRRefFetchCall final : public RRefMessageBase {
   const worker_id_t fromWorkerId_;
 };
 
-// OwnerRRef uses this message to send the RRef value to a remote UserRRef
+// OwnerRRef uses this message to send the RRef value to a remote UserRRef.
+// The value is tagged with the owner-side version so that the user can cache
+// it and recognize stale cache entries. See Note [RRef Value Cache] in
+// rref_impl.cpp.
 class TORCH_API RRefFetchRet : public RpcCommandBase {
  public:
-  RRefFetchRet(std::vector<at::IValue> values, MessageType type)
-      : values_(std::move(values)), type_(type) {}
+  RRefFetchRet(std::vector<at::IValue> values, MessageType type, uint64_t version)
+      : values_(std::move(values)), type_(type), version_(version) {}
 
   const std::vector<at::IValue>& values();
+  uint64_t version() const;
   Message toMessageImpl() && override;
 
  private:
   std::vector<at::IValue> values_;
   const MessageType type_;
+  const uint64_t version_;
 };
 
 class TORCH_API ScriptRRefFetchRet final : public RRefFetchRet {
  public:
-  explicit ScriptRRefFetchRet(std::vector<at::IValue> values)
-      : RRefFetchRet(std::move(values), MessageType::SCRIPT_RREF_FETCH_RET) {}
+  explicit ScriptRRefFetchRet(std::vector<at::IValue> values, uint64_t version)
+      : RRefFetchRet(
+            std::move(values),
+            MessageType::SCRIPT_RREF_FETCH_RET,
+            version) {}
 
   static std::unique_ptr<ScriptRRefFetchRet> fromMessage(
       const Message& message);
@@ -106,8 +114,11 @@ class TORCH_API ScriptRRefFetchRet final : public RRefFetchRet {
 
 class TORCH_API PythonRRefFetchRet final : public RRefFetchRet {
  public:
-  explicit PythonRRefFetchRet(std::vector<at::IValue> values)
-      : RRefFetchRet(std::move(values), MessageType::PYTHON_RREF_FETCH_RET) {}
+  explicit PythonRRefFetchRet(std::vector<at::IValue> values, uint64_t version)
+      : RRefFetchRet(
+            std::move(values),
+            MessageType::PYTHON_RREF_FETCH_RET,
+            version) {}
 
   static std::unique_ptr<PythonRRefFetchRet> fromMessage(
       const Message& message);
@@ -155,6 +166,25 @@ class TORCH_API RRefForkRequest final : public ForkMessageBase {
   static std::unique_ptr<RRefForkRequest> fromMessage(const Message& message);
 };
 
+// The owner uses this message to tell a user that its cached copies of the
+// RRef value, if any, are stale because the owner-side value was mutated.
+// See Note [RRef Value Cache] in rref_impl.cpp.
+class TORCH_API RRefCacheInvalidate final : public RRefMessageBase {
+ public:
+  RRefCacheInvalidate(const RRefId& rrefId, uint64_t version)
+      : RRefMessageBase(rrefId, MessageType::RREF_CACHE_INVALIDATE),
+        version_(version) {}
+
+  uint64_t version() const;
+
+  Message toMessageImpl() && override;
+  static std::unique_ptr<RRefCacheInvalidate> fromMessage(
+      const Message& message);
+
+ private:
+  const uint64_t version_;
+};
+
 class TORCH_API RRefAck final : public RpcCommandBase {
  public:
   RRefAck() {}
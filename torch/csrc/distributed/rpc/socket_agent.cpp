@@ -0,0 +1,822 @@
+#include <torch/csrc/distributed/rpc/socket_agent.h>
+
+#include <c10/util/C++17.h>
+#include <torch/csrc/distributed/rpc/request_callback_impl.h>
+#include <torch/csrc/distributed/rpc/utils.h>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cstring>
+
+namespace torch {
+namespace distributed {
+namespace rpc {
+
+namespace {
+
+constexpr int kListenBacklog = 64;
+// The per-message preamble, matching the chunked format used by
+// ProcessGroupAgent: source rank, header size, message type, message id,
+// and the number of out-of-line tensor chunks that follow the header.
+constexpr size_t kPreambleFields = 5;
+
+// Reads exactly `size` bytes from `fd`. Returns false if the connection
+// was closed before the first byte (a clean disconnect at a message
+// boundary); throws on error or mid-message EOF.
+bool readFull(int fd, void* dest, size_t size) {
+  char* buf = static_cast<char*>(dest);
+  const size_t total = size;
+  while (size > 0) {
+    ssize_t ret = ::read(fd, buf, size);
+    if (ret == 0) {
+      if (size == total) {
+        return false;
+      }
+      throw std::runtime_error("Connection closed mid-message by peer");
+    } else if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error(
+          c10::str("Failed to read from socket: ", strerror(errno)));
+    }
+    buf += ret;
+    size -= ret;
+  }
+  return true;
+}
+
+// Writes all iovec entries to `fd` with as few syscalls as the kernel
+// allows, handling partial writes and the IOV_MAX limit. Mutates `iovs`.
+void writevFull(int fd, std::vector<struct iovec>& iovs) {
+  size_t idx = 0;
+  while (idx < iovs.size()) {
+    const auto count = std::min(iovs.size() - idx, (size_t)IOV_MAX);
+    ssize_t ret = ::writev(fd, iovs.data() + idx, count);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error(
+          c10::str("Failed to write to socket: ", strerror(errno)));
+    }
+    while (ret > 0) {
+      if ((size_t)ret >= iovs[idx].iov_len) {
+        ret -= iovs[idx].iov_len;
+        ++idx;
+      } else {
+        iovs[idx].iov_base = static_cast<char*>(iovs[idx].iov_base) + ret;
+        iovs[idx].iov_len -= ret;
+        ret = 0;
+      }
+    }
+    // Skip any zero-length entries so the loop makes progress.
+    while (idx < iovs.size() && iovs[idx].iov_len == 0) {
+      ++idx;
+    }
+  }
+}
+
+std::vector<uint8_t> toStoreValue(const std::vector<int64_t>& values) {
+  const auto* data = reinterpret_cast<const uint8_t*>(values.data());
+  return std::vector<uint8_t>(data, data + values.size() * sizeof(int64_t));
+}
+
+std::vector<int64_t> fromStoreValue(const std::vector<uint8_t>& bytes) {
+  std::vector<int64_t> values(bytes.size() / sizeof(int64_t));
+  std::memcpy(values.data(), bytes.data(), bytes.size());
+  return values;
+}
+
+} // namespace
+
+// Note [Direct socket transport]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ProcessGroupAgent routes every RPC through ProcessGroup::send/recv, which
+// adds a full pair-rendezvous round trip per message and serializes traffic
+// to different peers behind the process group's internal machinery. This
+// agent talks to each peer over its own TCP connection instead:
+//
+// - Every rank opens a listening socket in the constructor and publishes
+//   "<name> <host> <port>" on the c10d Store. The blocking Store reads
+//   double as the startup rendezvous, so no ProcessGroup is needed at all.
+// - Outbound connections are created lazily on the first send to a peer and
+//   then kept open, so steady-state sends cost a single writev.
+// - Messages use the chunked wire format (see Note [Zero-copy tensor
+//   sections] in process_group_agent.cpp): the preamble, the header buffer
+//   and every tensor's storage are handed to one scatter-gather writev
+//   without being flattened into an intermediate buffer. The receiver reads
+//   each chunk into a fresh buffer that the unpickler adopts as tensor
+//   storage, so tensor bytes are never copied on either side.
+// - Termination detection mirrors ProcessGroupAgent's counter snapshots
+//   (see Note [Termination Detection] there), except snapshots travel
+//   through the Store instead of an allgather. Since every rank reads the
+//   same set of per-round keys, all ranks agree on whether messages are
+//   still outstanding.
+//
+// Tensors must live on CPU, the same restriction ProcessGroupAgent imposes;
+// peer-to-peer device memory transfer would need an RDMA-capable transport
+// that this build does not depend on.
+
+const SocketAgent::steady_clock_time_point
+    SocketAgent::kInfiniteTimeoutTimePoint =
+        std::chrono::time_point<std::chrono::steady_clock>::max();
+
+SocketAgent::SocketAgent(
+    std::string workerName,
+    worker_id_t rank,
+    int worldSize,
+    std::shared_ptr<::c10d::Store> store,
+    int numWorkerThreads,
+    std::chrono::milliseconds rpcTimeout)
+    : RpcAgent(
+          WorkerInfo(std::move(workerName), (int64_t)rank),
+          std::make_unique<RequestCallbackImpl>(),
+          rpcTimeout),
+      worldSize_(worldSize),
+      store_(std::move(store)),
+      peerFds_(worldSize, -1),
+      sendMutexes_(worldSize),
+      sendCounts_(worldSize),
+      recvCounts_(worldSize),
+      threadPool_(numWorkerThreads) {
+  TORCH_CHECK(
+      worldSize_ > 1,
+      "SocketAgent requires world_size to be at least 2, but got ",
+      worldSize_);
+  exchangeAddresses();
+}
+
+SocketAgent::~SocketAgent() {
+  if (rpcRunning_) {
+    shutdown();
+  }
+  if (listenFd_ >= 0) {
+    ::close(listenFd_);
+  }
+}
+
+void SocketAgent::exchangeAddresses() {
+  listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+  TORCH_CHECK(
+      listenFd_ >= 0, "Failed to create listen socket: ", strerror(errno));
+  int reuse = 1;
+  ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  struct sockaddr_in addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = INADDR_ANY;
+  addr.sin_port = 0;
+  TORCH_CHECK(
+      ::bind(listenFd_, (struct sockaddr*)&addr, sizeof(addr)) == 0,
+      "Failed to bind listen socket: ",
+      strerror(errno));
+  TORCH_CHECK(
+      ::listen(listenFd_, kListenBacklog) == 0,
+      "Failed to listen on socket: ",
+      strerror(errno));
+  socklen_t addrLen = sizeof(addr);
+  TORCH_CHECK(
+      ::getsockname(listenFd_, (struct sockaddr*)&addr, &addrLen) == 0,
+      "Failed to query listen socket address: ",
+      strerror(errno));
+
+  char hostname[256];
+  TORCH_CHECK(
+      ::gethostname(hostname, sizeof(hostname)) == 0,
+      "Failed to get hostname: ",
+      strerror(errno));
+  hostname[sizeof(hostname) - 1] = '\0';
+
+  const auto selfEntry = c10::str(
+      workerInfo_.name_, " ", hostname, " ", ntohs(addr.sin_port));
+  store_->set(
+      c10::str("socket_agent/addr/", workerInfo_.id_),
+      std::vector<uint8_t>(selfEntry.begin(), selfEntry.end()));
+
+  // The blocking get() calls below only return once every rank has
+  // published its address, so this loop is also the startup rendezvous.
+  allWorkerInfo_.reserve(worldSize_);
+  peerAddrs_.reserve(worldSize_);
+  for (worker_id_t rank = 0; rank < (worker_id_t)worldSize_; ++rank) {
+    const auto value = store_->get(c10::str("socket_agent/addr/", rank));
+    const std::string entry(value.begin(), value.end());
+    const auto nameEnd = entry.find(' ');
+    TORCH_CHECK(
+        nameEnd != std::string::npos, "Malformed address entry: ", entry);
+    std::string peerName = entry.substr(0, nameEnd);
+    TORCH_CHECK(
+        nameMap_.find(peerName) == nameMap_.end(),
+        "RpcAgent name ",
+        peerName,
+        " is not unique.");
+    nameMap_[peerName] = rank;
+    allWorkerInfo_.emplace_back(std::move(peerName), rank);
+    peerAddrs_.push_back(entry.substr(nameEnd + 1));
+  }
+  TORCH_CHECK(
+      allWorkerInfo_[workerInfo_.id_].name_ == workerInfo_.name_,
+      "Worker name ",
+      workerInfo_.name_,
+      " does not match the name published for rank ",
+      workerInfo_.id_);
+}
+
+const WorkerInfo& SocketAgent::getWorkerInfo(
+    const std::string& workerName) const {
+  const auto idIter = nameMap_.find(workerName);
+  TORCH_CHECK(
+      idIter != nameMap_.end(), "Unknown destination worker ", workerName);
+  return allWorkerInfo_[idIter->second];
+}
+
+const WorkerInfo& SocketAgent::getWorkerInfo(worker_id_t id) const {
+  return allWorkerInfo_[id];
+}
+
+std::vector<WorkerInfo> SocketAgent::getWorkerInfos() const {
+  return allWorkerInfo_;
+}
+
+void SocketAgent::start() {
+  {
+    std::lock_guard<std::mutex> futureLock{futureMutex_};
+    rpcRunning_.store(true);
+  }
+  listenerThread_ = std::thread(&SocketAgent::listenLoop, this);
+  futureTimeoutThread_ = std::thread(&SocketAgent::pollTimedOutRPCs, this);
+}
+
+void SocketAgent::shutdown() {
+  LOG(INFO) << "Shutting down SocketAgent on rank " << workerInfo_.id_ << ".";
+  std::unique_lock<std::mutex> lock{futureMutex_};
+  if (!rpcRunning_.exchange(false)) {
+    return;
+  }
+  lock.unlock();
+  futureTimeoutCV_.notify_one();
+  futureTimeoutThread_.join();
+  // Unblock accept() and any receive thread blocked in read().
+  ::shutdown(listenFd_, SHUT_RDWR);
+  {
+    std::lock_guard<std::mutex> guard(recvMutex_);
+    for (const auto fd : acceptedFds_) {
+      ::shutdown(fd, SHUT_RDWR);
+    }
+  }
+  listenerThread_.join();
+  for (auto& thread : recvThreads_) {
+    thread.join();
+  }
+  threadPool_.waitWorkComplete();
+  {
+    std::lock_guard<std::mutex> guard(recvMutex_);
+    for (const auto fd : acceptedFds_) {
+      ::close(fd);
+    }
+    acceptedFds_.clear();
+  }
+  for (worker_id_t dst = 0; dst < (worker_id_t)worldSize_; ++dst) {
+    std::lock_guard<std::mutex> guard(sendMutexes_[dst]);
+    if (peerFds_[dst] >= 0) {
+      ::close(peerFds_[dst]);
+      peerFds_[dst] = -1;
+    }
+  }
+}
+
+std::shared_ptr<FutureMessage> SocketAgent::send(
+    const WorkerInfo& to,
+    Message&& message) {
+  TORCH_CHECK(
+      rpcRunning_.load(),
+      "Node ",
+      workerInfo_.id_,
+      " tried to send() a message of type ",
+      message.type(),
+      " but RPC is no longer running on this node.");
+  TORCH_CHECK(
+      to.id_ < (worker_id_t)worldSize_,
+      "Destination rank is out of bound, got ",
+      to.id_,
+      ", but world size is ",
+      worldSize_);
+
+  auto requestId = nextId();
+  auto future = std::make_shared<FutureMessage>();
+  if (message.isRequest()) {
+    auto timeout = rpcTimeout_.load();
+    steady_clock_time_point endTime = timeout.count() == 0
+        ? kInfiniteTimeoutTimePoint
+        : std::chrono::steady_clock::now() + timeout;
+    {
+      std::lock_guard<std::mutex> lock{futureMutex_};
+      futures_[requestId] = FutureInfo{future, endTime, to.id_, timeout};
+    }
+    futureTimeoutCV_.notify_one();
+    message.setId(requestId);
+    ++clientActiveCalls_;
+  } else {
+    future->markCompleted(Message());
+  }
+
+  if (to.id_ == workerInfo_.id_) {
+    // Sending to ourselves: deliver through the local processing path. The
+    // flattened format is used so the delivered message does not alias the
+    // sender's tensor storage; see Note [Zero-copy tensor sections].
+    threadPool_.run(std::bind(
+        [this](const Message& message) {
+          std::string payload;
+          try {
+            payload = wireSerialize(message.payload(), message.tensors());
+            std::lock_guard<std::mutex> guard(countMutex_);
+            ++sendCounts_[workerInfo_.id_];
+          } catch (std::exception& e) {
+            markFutureWithError(message.id(), e.what());
+            return;
+          }
+          auto payloadTensor =
+              torch::empty({(int64_t)payload.size()}, torch::kChar);
+          std::memcpy(
+              payloadTensor.storage().data(), payload.data(), payload.size());
+          bool processed = handleRecv(
+              workerInfo_.id_,
+              message.type(),
+              message.id(),
+              std::move(payloadTensor),
+              {});
+          if (processed) {
+            std::lock_guard<std::mutex> guard(countMutex_);
+            ++recvCounts_[workerInfo_.id_];
+          }
+        },
+        std::move(message)));
+    return future;
+  }
+
+  const auto dst = to.id_;
+  threadPool_.run(std::bind(
+      [this, dst](Message& message) {
+        const auto messageId = message.id();
+        const bool isRequest = message.isRequest();
+        try {
+          sendToPeer(dst, std::move(message));
+        } catch (std::exception& e) {
+          if (isRequest) {
+            markFutureWithError(messageId, e.what());
+          } else {
+            LOG(WARNING) << "Failed to send response to rank " << dst << ": "
+                         << e.what();
+          }
+        }
+      },
+      std::move(message)));
+  return future;
+}
+
+int SocketAgent::connectToPeer(worker_id_t dst) {
+  const auto& addr = peerAddrs_[dst];
+  const auto hostEnd = addr.find(' ');
+  TORCH_CHECK(
+      hostEnd != std::string::npos, "Malformed peer address: ", addr);
+  const std::string host = addr.substr(0, hostEnd);
+  const std::string port = addr.substr(hostEnd + 1);
+
+  struct addrinfo hints;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* result = nullptr;
+  const int err = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &result);
+  TORCH_CHECK(
+      err == 0,
+      "Failed to resolve peer address ",
+      host,
+      ":",
+      port,
+      ": ",
+      gai_strerror(err));
+
+  int fd = -1;
+  for (struct addrinfo* entry = result; entry != nullptr;
+       entry = entry->ai_next) {
+    fd = ::socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+    if (fd < 0) {
+      continue;
+    }
+    if (::connect(fd, entry->ai_addr, entry->ai_addrlen) == 0) {
+      break;
+    }
+    ::close(fd);
+    fd = -1;
+  }
+  ::freeaddrinfo(result);
+  TORCH_CHECK(
+      fd >= 0, "Failed to connect to peer at ", host, ":", port);
+  int noDelay = 1;
+  ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+  return fd;
+}
+
+void SocketAgent::sendToPeer(worker_id_t dst, Message&& message) {
+  // Serialize outside the send lock; only the writev itself needs to be
+  // serialized per peer.
+  auto serialized = wireSerializeChunks(message.payload(), message.tensors());
+  const auto& header = serialized.first;
+  const auto& chunks = serialized.second;
+
+  int64_t preamble[kPreambleFields] = {
+      (int64_t)workerInfo_.id_,
+      (int64_t)header.size(),
+      (int64_t)message.type(),
+      message.id(),
+      (int64_t)chunks.size()};
+
+  std::vector<struct iovec> iovs;
+  iovs.reserve(2 + chunks.size());
+  iovs.push_back({(void*)preamble, sizeof(preamble)});
+  iovs.push_back({(void*)header.data(), header.size()});
+  for (const auto& chunk : chunks) {
+    if (chunk.numel() > 0) {
+      iovs.push_back({chunk.data_ptr(), (size_t)chunk.numel()});
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(sendMutexes_[dst]);
+  if (peerFds_[dst] < 0) {
+    peerFds_[dst] = connectToPeer(dst);
+  }
+  writevFull(peerFds_[dst], iovs);
+  {
+    std::lock_guard<std::mutex> countGuard(countMutex_);
+    ++sendCounts_[dst];
+  }
+}
+
+void SocketAgent::listenLoop() {
+  while (rpcRunning_.load()) {
+    const int fd = ::accept(listenFd_, nullptr, nullptr);
+    if (fd < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      // The listen socket was shut down, or accept failed fatally; either
+      // way there is nothing more to accept.
+      break;
+    }
+    int noDelay = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    std::lock_guard<std::mutex> guard(recvMutex_);
+    acceptedFds_.push_back(fd);
+    recvThreads_.emplace_back(&SocketAgent::recvLoop, this, fd);
+  }
+}
+
+void SocketAgent::recvLoop(int fd) {
+  while (rpcRunning_.load()) {
+    int64_t preamble[kPreambleFields];
+    try {
+      if (!readFull(fd, preamble, sizeof(preamble))) {
+        // The peer closed the connection at a message boundary, which is
+        // how connections are retired during shutdown.
+        return;
+      }
+      const auto srcRank = (worker_id_t)preamble[0];
+      const auto headerSize = preamble[1];
+      const auto type = MessageType(preamble[2]);
+      const auto id = preamble[3];
+      const auto numChunks = preamble[4];
+
+      auto header = torch::empty({headerSize}, torch::kChar);
+      readFull(fd, header.storage().data(), headerSize);
+
+      std::vector<torch::Tensor> chunks;
+      if (numChunks > 0) {
+        const auto chunkSizes =
+            wireChunkSizes(header.storage().data(), headerSize);
+        TORCH_INTERNAL_ASSERT(
+            chunkSizes.size() == (size_t)numChunks,
+            "Chunk count in preamble does not match the message header");
+        std::vector<struct iovec> iovs;
+        chunks.reserve(chunkSizes.size());
+        for (const auto chunkSize : chunkSizes) {
+          chunks.push_back(torch::empty({(int64_t)chunkSize}, torch::kChar));
+          if (chunkSize > 0) {
+            iovs.push_back({chunks.back().data_ptr(), chunkSize});
+          }
+        }
+        // Scatter the payload straight into the chunk buffers; the
+        // unpickler adopts them as tensor storage without another copy.
+        size_t idx = 0;
+        while (idx < iovs.size()) {
+          const auto count = std::min(iovs.size() - idx, (size_t)IOV_MAX);
+          ssize_t ret = ::readv(fd, iovs.data() + idx, count);
+          if (ret == 0) {
+            throw std::runtime_error("Connection closed by peer");
+          } else if (ret < 0) {
+            if (errno == EINTR) {
+              continue;
+            }
+            throw std::runtime_error(
+                c10::str("Failed to read from socket: ", strerror(errno)));
+          }
+          while (ret > 0) {
+            if ((size_t)ret >= iovs[idx].iov_len) {
+              ret -= iovs[idx].iov_len;
+              ++idx;
+            } else {
+              iovs[idx].iov_base =
+                  static_cast<char*>(iovs[idx].iov_base) + ret;
+              iovs[idx].iov_len -= ret;
+              ret = 0;
+            }
+          }
+        }
+      }
+
+      threadPool_.run(std::bind(
+          [this, srcRank, type, id](
+              torch::Tensor& header, std::vector<torch::Tensor>& chunks) {
+            bool processed = false;
+            try {
+              processed = handleRecv(
+                  srcRank, type, id, std::move(header), std::move(chunks));
+            } catch (const std::exception& e) {
+              LOG(INFO) << "Internal error while processing request of type "
+                        << type << " on node " << workerInfo_.id_
+                        << ", from node " << srcRank << " : " << e.what();
+              // Still count it so graceful shutdown does not see this recv
+              // as outstanding.
+              processed = true;
+            }
+            if (processed) {
+              std::lock_guard<std::mutex> guard(countMutex_);
+              ++recvCounts_[srcRank];
+            }
+          },
+          std::move(header),
+          std::move(chunks)));
+    } catch (const std::exception& e) {
+      if (rpcRunning_.load()) {
+        LOG(WARNING) << "SocketAgent on rank " << workerInfo_.id_
+                     << " lost a peer connection: " << e.what();
+      }
+      return;
+    }
+  }
+}
+
+bool SocketAgent::handleRecv(
+    worker_id_t from,
+    MessageType type,
+    int64_t id,
+    torch::Tensor payload,
+    std::vector<torch::Tensor> chunks) {
+  // Self-sends and tensor-less messages arrive in the flattened format;
+  // remote messages with tensors carry their data out of line.
+  auto data = chunks.empty()
+      ? wireDeserialize(payload.storage().data(), payload.numel())
+      : wireDeserializeChunks(payload.storage().data(), payload.numel(), chunks);
+  Message message(std::move(data.first), std::move(data.second), type, id);
+  if (message.isRequest()) {
+    ++serverActiveCalls_;
+    std::shared_ptr<FutureMessage> futureResponse;
+    try {
+      futureResponse = cb_->operator()(message);
+    } catch (const std::exception& e) {
+      futureResponse = std::make_shared<FutureMessage>();
+      futureResponse->setError(e.what());
+    }
+    if (futureResponse->completed()) {
+      --serverActiveCalls_;
+      if (!futureResponse->hasError()) {
+        send(getWorkerInfo(from), std::move(*futureResponse).moveValue());
+      } else {
+        send(
+            getWorkerInfo(from),
+            createExceptionResponse(
+                futureResponse->error()->what(), message.id()));
+      }
+    } else {
+      ++serverActiveAsyncCalls_;
+      auto fromId = from;
+      auto requestId = message.id();
+      futureResponse->addCallback(
+          [this, fromId, requestId, futureResponse](
+              const Message& /* unused */,
+              const c10::optional<utils::FutureError>& err) {
+            --serverActiveCalls_;
+            --serverActiveAsyncCalls_;
+            if (!err) {
+              send(
+                  getWorkerInfo(fromId),
+                  std::move(*futureResponse).moveValue());
+            } else {
+              send(
+                  getWorkerInfo(fromId),
+                  createExceptionResponse(err->what(), requestId));
+            }
+          });
+    }
+  } else if (message.isResponse()) {
+    std::shared_ptr<FutureMessage> fm = nullptr;
+    {
+      std::lock_guard<std::mutex> lock{futureMutex_};
+      const auto futureIt = futures_.find(message.id());
+      if (futureIt == futures_.end()) {
+        // The future already timed out; the thread that timed it out has
+        // accounted for the recv.
+        return false;
+      }
+      fm = futureIt->second.future_;
+      futures_.erase(futureIt);
+    }
+    futureCV_.notify_all();
+    --clientActiveCalls_;
+    if (message.type() == MessageType::EXCEPTION) {
+      fm->setError(
+          std::string(message.payload().begin(), message.payload().end()));
+    } else {
+      fm->markCompleted(std::move(message));
+    }
+  } else {
+    TORCH_INTERNAL_ASSERT(false, "unrecognized message type ", message.type());
+  }
+  return true;
+}
+
+void SocketAgent::markFutureWithError(int64_t id, std::string errorMsg) {
+  std::shared_ptr<FutureMessage> fm = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{futureMutex_};
+    const auto futureIt = futures_.find(id);
+    if (futureIt == futures_.end()) {
+      // The future already timed out and was processed accordingly.
+      return;
+    }
+    fm = futureIt->second.future_;
+    futures_.erase(futureIt);
+  }
+  --clientActiveCalls_;
+  fm->setError(std::move(errorMsg));
+  futureCV_.notify_all();
+}
+
+void SocketAgent::pollTimedOutRPCs() {
+  while (rpcRunning_.load()) {
+    std::unique_lock<std::mutex> lock{futureMutex_};
+    auto minEndTimeInMap = [this]() -> steady_clock_time_point {
+      steady_clock_time_point minEndTime = kInfiniteTimeoutTimePoint;
+      for (const auto& entry : futures_) {
+        minEndTime = std::min(minEndTime, entry.second.endTime_);
+      }
+      return minEndTime;
+    };
+    const auto minEndTime = minEndTimeInMap();
+    // Wake up early if shutdown is requested (`rpcRunning_` is only
+    // modified while holding `futureMutex_`, so the notification cannot be
+    // missed) or if a future with an earlier deadline was added.
+    auto shouldRecomputePredicate = [&]() -> bool {
+      return !rpcRunning_.load() || minEndTimeInMap() < minEndTime;
+    };
+    bool shouldRecompute = true;
+    if (minEndTime == kInfiniteTimeoutTimePoint) {
+      futureTimeoutCV_.wait(lock, shouldRecomputePredicate);
+    } else {
+      shouldRecompute =
+          futureTimeoutCV_.wait_until(lock, minEndTime, shouldRecomputePredicate);
+    }
+    if (shouldRecompute) {
+      continue;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<FutureInfo> timedOutFutures;
+    for (auto it = futures_.begin(); it != futures_.end();
+         /* intentional no increment */) {
+      if (it->second.endTime_ <= now) {
+        timedOutFutures.push_back(it->second);
+        it = futures_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    lock.unlock();
+    futureCV_.notify_all();
+
+    for (const auto& timedOutFuture : timedOutFutures) {
+      auto err = c10::str(
+          "RPC ran for more than ",
+          timedOutFuture.timeout_.count(),
+          " milliseconds and timed out.");
+      const auto exceptionMsg = createExceptionResponse(err, -1);
+      if (!timedOutFuture.future_->hasError()) {
+        --clientActiveCalls_;
+        timedOutFuture.future_->setError(std::string(
+            exceptionMsg.payload().begin(), exceptionMsg.payload().end()));
+        // The response, if it ever arrives, will be dropped by handleRecv,
+        // so account for the recv here to keep the counters consistent.
+        std::lock_guard<std::mutex> guard(countMutex_);
+        ++recvCounts_[timedOutFuture.dstRank_];
+      }
+    }
+  }
+}
+
+bool SocketAgent::hasPendingMessage() {
+  const auto round = syncRound_++;
+  std::vector<int64_t> snapshot;
+  snapshot.reserve(2 * worldSize_);
+  {
+    std::lock_guard<std::mutex> guard(countMutex_);
+    snapshot.insert(snapshot.end(), recvCounts_.begin(), recvCounts_.end());
+    snapshot.insert(snapshot.end(), sendCounts_.begin(), sendCounts_.end());
+  }
+  const auto prefix = c10::str("socket_agent/sync/", round, "/");
+  store_->set(
+      c10::str(prefix, workerInfo_.id_), toStoreValue(snapshot));
+
+  // Every rank reads every other rank's snapshot for this round, so all
+  // ranks evaluate the same predicate and agree on whether to keep waiting.
+  std::vector<std::vector<int64_t>> peerCounts;
+  peerCounts.reserve(worldSize_);
+  for (int rank = 0; rank < worldSize_; ++rank) {
+    peerCounts.push_back(
+        fromStoreValue(store_->get(c10::str(prefix, rank))));
+  }
+  for (int from = 0; from < worldSize_; ++from) {
+    for (int to = 0; to < worldSize_; ++to) {
+      // peerCounts[x] holds recv counts followed by send counts.
+      const auto& sentCnt = peerCounts[from][worldSize_ + to];
+      const auto& recvCnt = peerCounts[to][from];
+      if (sentCnt != recvCnt) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void SocketAgent::barrier() {
+  const auto round = barrierRound_++;
+  const auto prefix = c10::str("socket_agent/barrier/", round, "/");
+  store_->set(c10::str(prefix, workerInfo_.id_), {1});
+  for (int rank = 0; rank < worldSize_; ++rank) {
+    store_->get(c10::str(prefix, rank));
+  }
+}
+
+void SocketAgent::sync() {
+  // Block until all peers agree that all sent messages have been processed.
+  // The store reads inside hasPendingMessage() double as a barrier.
+  do {
+    // Finish all send/recv tasks in the thread pool. As there could be
+    // nested RPC calls, wait again whenever the counters still disagree.
+    threadPool_.waitWorkComplete();
+  } while (hasPendingMessage());
+}
+
+void SocketAgent::join() {
+  sync();
+  std::unique_lock<std::mutex> lock(futureMutex_);
+  futureCV_.wait(lock, [this] { return futures_.empty(); });
+  lock.unlock();
+  barrier();
+}
+
+std::unordered_map<std::string, std::string> SocketAgent::getMetrics() {
+  std::unordered_map<std::string, std::string> metrics;
+  {
+    std::unique_lock<std::mutex> lock(futureMutex_);
+    auto futuresSize = futures_.size();
+    lock.unlock();
+    metrics["agent.num_pending_requests"] = c10::to_string(futuresSize);
+  }
+  metrics["agent.thread_pool_size"] = c10::to_string(threadPool_.size());
+  metrics["agent.num_idle_threads"] = c10::to_string(threadPool_.numAvailable());
+  metrics["agent.client_active_calls"] = c10::to_string(clientActiveCalls_.load());
+  metrics["agent.server_active_calls"] = c10::to_string(serverActiveCalls_.load());
+  metrics["agent.server_active_async_calls"] =
+      c10::to_string(serverActiveAsyncCalls_.load());
+  if (isGILProfilingEnabled()) {
+    const auto count = gilWaitCount_.load();
+    metrics["agent.gil_average_wait_time_us"] = c10::to_string(
+        count == 0 ? 0 : gilWaitTimeUs_.load() / (double)count);
+  }
+  return metrics;
+}
+
+void SocketAgent::addGilWaitTime(
+    const std::chrono::microseconds gilWaitTime) {
+  gilWaitTimeUs_ += gilWaitTime.count();
+  ++gilWaitCount_;
+}
+
+} // namespace rpc
+} // namespace distributed
+} // namespace torch
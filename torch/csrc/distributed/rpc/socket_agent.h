@@ -0,0 +1,185 @@
+#pragma once
+
+#include <c10/core/thread_pool.h>
+#include <c10d/Store.hpp>
+#include <torch/csrc/distributed/rpc/rpc_agent.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace distributed {
+namespace rpc {
+
+constexpr auto kDefaultNumSocketThreads = 4;
+
+struct SocketRpcBackendOptions : public RpcBackendOptions {
+  SocketRpcBackendOptions(
+      int num_worker_threads,
+      std::chrono::milliseconds rpc_timeout,
+      std::string init_method)
+      : RpcBackendOptions(rpc_timeout, init_method),
+        numWorkerThreads(num_worker_threads) {
+    TORCH_CHECK(
+        num_worker_threads > 0,
+        "Cannot create socket RPC backend with ",
+        num_worker_threads,
+        " threads in the thread-pool.");
+  }
+
+  int numWorkerThreads;
+};
+
+// An RpcAgent that sends messages over direct per-peer TCP connections
+// instead of funneling all point-to-point traffic through a ProcessGroup.
+// Peer addresses are exchanged through the c10d Store, connections are
+// established lazily on first send, and messages travel in the chunked wire
+// format so tensor data is written with a single scatter-gather writev and
+// received into buffers the unpickler adopts as storage.
+// See Note [Direct socket transport] in socket_agent.cpp.
+class TORCH_API SocketAgent : public RpcAgent {
+ public:
+  SocketAgent(
+      std::string workerName,
+      worker_id_t rank,
+      int worldSize,
+      std::shared_ptr<::c10d::Store> store,
+      int numWorkerThreads,
+      std::chrono::milliseconds rpcTimeout);
+
+  const WorkerInfo& getWorkerInfo(const std::string& workerName) const override;
+
+  const WorkerInfo& getWorkerInfo(worker_id_t id) const override;
+
+  std::vector<WorkerInfo> getWorkerInfos() const override;
+
+  void join() override;
+
+  void sync() override;
+
+  void start() override;
+
+  void shutdown() override;
+
+  ~SocketAgent() override;
+
+  std::unordered_map<std::string, std::string> getMetrics() override;
+
+ protected:
+  std::shared_ptr<FutureMessage> send(const WorkerInfo& to, Message&& message)
+      override;
+
+ private:
+  using steady_clock_time_point =
+      std::chrono::time_point<std::chrono::steady_clock>;
+
+  static const steady_clock_time_point kInfiniteTimeoutTimePoint;
+
+  struct FutureInfo {
+    std::shared_ptr<FutureMessage> future_;
+    steady_clock_time_point endTime_;
+    int dstRank_;
+    std::chrono::milliseconds timeout_;
+  };
+
+  // Creates the listening socket and publishes "<name> <host> <port>" for
+  // this rank on the store, then blocks on the store until every peer has
+  // published its own entry.
+  void exchangeAddresses();
+  // Accepts inbound connections and spawns one receive thread per peer
+  // connection.
+  void listenLoop();
+  // Reads messages off one accepted connection until it is closed.
+  void recvLoop(int fd);
+  // Serializes and writes a message to the destination rank, connecting
+  // first if no connection exists yet. Runs in the thread pool.
+  void sendToPeer(worker_id_t dst, Message&& message);
+  // Dispatches a fully received message. Returns true if the recv count
+  // for `from` should be incremented (i.e. the message was not a response
+  // to an already timed-out future).
+  bool handleRecv(
+      worker_id_t from,
+      MessageType type,
+      int64_t id,
+      torch::Tensor payload,
+      std::vector<torch::Tensor> chunks);
+  // Opens a TCP connection to the given rank's published address.
+  int connectToPeer(worker_id_t dst);
+  // Marks the future with the given id with an error and removes it from
+  // the futures map, if it is still present.
+  void markFutureWithError(int64_t id, std::string errorMsg);
+  // Periodically scans the futures map for expired RPCs.
+  void pollTimedOutRPCs();
+  // Exchanges send/recv counters of all peers through the store and checks
+  // whether any sent message has not been processed yet. All peers observe
+  // the same snapshot, so they agree on the result.
+  bool hasPendingMessage();
+  // A store-backed barrier across all ranks.
+  void barrier();
+
+  int64_t nextId() {
+    return ++nextId_;
+  }
+
+  const int worldSize_;
+  std::shared_ptr<::c10d::Store> store_;
+
+  // worker name -> rank
+  std::unordered_map<std::string, worker_id_t> nameMap_;
+  std::vector<WorkerInfo> allWorkerInfo_;
+  // "<host> <port>" for every rank, in rank order.
+  std::vector<std::string> peerAddrs_;
+
+  // The listening socket, created in the constructor so that the address
+  // can be published before any peer attempts to connect.
+  int listenFd_ = -1;
+  // Outbound connection per peer; -1 until the first send to that peer.
+  // peerFds_[i] is guarded by sendMutexes_[i], which also serializes writes
+  // so messages are never interleaved on the wire.
+  std::vector<int> peerFds_;
+  std::vector<std::mutex> sendMutexes_;
+  // Inbound connections, guarded by recvMutex_. Receive threads are spawned
+  // by the listener thread and joined in shutdown().
+  std::mutex recvMutex_;
+  std::vector<int> acceptedFds_;
+  std::vector<std::thread> recvThreads_;
+
+  // Send and recv message counters per peer, used by sync()/join() for
+  // termination detection exactly as in ProcessGroupAgent, except that the
+  // snapshots are exchanged through the store rather than an allgather.
+  std::mutex countMutex_;
+  std::vector<int64_t> sendCounts_;
+  std::vector<int64_t> recvCounts_;
+  // Rounds already consumed by hasPendingMessage()/barrier(); keys on the
+  // store must be unique, and all ranks call these collectively so their
+  // local counters stay in agreement.
+  int64_t syncRound_ = 0;
+  int64_t barrierRound_ = 0;
+
+  std::atomic<int64_t> nextId_{0};
+  std::atomic<bool> rpcRunning_{false};
+
+  std::thread listenerThread_;
+  std::thread futureTimeoutThread_;
+  ThreadPool threadPool_;
+
+  std::unordered_map<int64_t, FutureInfo> futures_;
+  mutable std::mutex futureMutex_;
+  std::condition_variable futureCV_;
+  std::condition_variable futureTimeoutCV_;
+
+  std::atomic<int32_t> clientActiveCalls_{0};
+  std::atomic<int32_t> serverActiveCalls_{0};
+  std::atomic<int32_t> serverActiveAsyncCalls_{0};
+  std::atomic<uint64_t> gilWaitTimeUs_{0};
+  std::atomic<uint64_t> gilWaitCount_{0};
+  void addGilWaitTime(const std::chrono::microseconds gilWaitTime) override;
+};
+
+} // namespace rpc
+} // namespace distributed
+} // namespace torch
@@ -13,6 +13,7 @@
 #include <torch/csrc/distributed/rpc/script_call.h>
 #include <torch/csrc/distributed/rpc/script_remote_call.h>
 #include <torch/csrc/distributed/rpc/script_resp.h>
+#include <torch/csrc/jit/serialization/pickle.h>
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/jit/serialization/unpickler.h>
 
@@ -49,6 +50,9 @@ std::unique_ptr<RpcCommandBase> deserializeRequest(const Message& request) {
     case MessageType::RREF_FORK_REQUEST: {
       return RRefForkRequest::fromMessage(request);
     }
+    case MessageType::RREF_CACHE_INVALIDATE: {
+      return RRefCacheInvalidate::fromMessage(request);
+    }
     case MessageType::FORWARD_AUTOGRAD_REQ: {
       return autograd::RpcWithAutograd::fromMessage(request);
     }
@@ -158,12 +162,15 @@ namespace {
 //
 // Note that per the header comments, the format is subject to change,
 // and is best used for rpcs, rather than persistent disk storage.
-std::unordered_map<std::string, std::pair<const char*, size_t>>
-parseWireSections(const void* data, size_t data_size) {
+// Parses the section name/size header and returns a pointer just past its
+// terminating '\n', i.e. to the first section byte.
+const char* parseWireHeader(
+    const void* data,
+    size_t data_size,
+    std::vector<std::pair<std::string, size_t>>& headerEnts) {
   const char* ptr = static_cast<const char*>(data);
   const char* endp = ptr + data_size;
 
-  std::vector<std::pair<std::string, size_t>> headerEnts;
   bool ok = false;
   while (ptr != endp) {
     if (*ptr == '\n') {
@@ -198,6 +205,14 @@ parseWireSections(const void* data, size_t data_size) {
   if (!ok) {
     throw std::runtime_error("failed parse");
   }
+  return ptr;
+}
+
+std::unordered_map<std::string, std::pair<const char*, size_t>>
+parseWireSections(const void* data, size_t data_size) {
+  std::vector<std::pair<std::string, size_t>> headerEnts;
+  const char* ptr = parseWireHeader(data, data_size, headerEnts);
+  const char* endp = static_cast<const char*>(data) + data_size;
 
   std::unordered_map<std::string, std::pair<const char*, size_t>> out;
   for (const auto& headerEnt : headerEnts) {
@@ -264,17 +279,17 @@ std::string wireSerialize(
   }
 
   if (!tensors.empty()) {
-    torch::jit::Pickler pickler(
-        [&](const void* buf, size_t sz) -> size_t {
-          metaEntry.append(static_cast<const char*>(buf), sz);
-          return sz;
+    // One session per sender thread amortizes the pickler's buffer and
+    // memo-table allocations across messages.
+    static thread_local torch::jit::PickleSession pickle_session;
+    pickle_session.pickle(
+        [&](const char* buf, size_t sz) {
+          metaEntry.append(buf, sz);
         },
+        cloneSparseTensors(tensors),
         nullptr);
-    pickler.protocol();
-    pickler.pushIValue(cloneSparseTensors(tensors));
-    pickler.stop();
     // tensorData is in function scope so that the data() pointers stay valid.
-    tensorData = pickler.tensorData();
+    tensorData = pickle_session.takeTensorData();
     entries.push_back({kMeta, metaEntry.data(), metaEntry.size()});
     for (size_t i = 0; i < tensorData.size(); i++) {
       entries.push_back({c10::to_string(i),
@@ -355,6 +370,174 @@ std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
   return {std::move(payload), std::move(tensors)};
 }
 
+std::pair<std::string, std::vector<torch::Tensor>> wireSerializeChunks(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors) {
+  for (const auto& tensor : tensors) {
+    TORCH_CHECK(
+        tensor.device().is_cpu(),
+        "ProcessGroup RPC backend only supports",
+        " CPU tensors, please move your tensors to CPU before sending ",
+        "them over RPC. Found tensor on device: ",
+        tensor.device());
+  }
+
+  std::string metaEntry;
+  // Shared so the chunk views below can keep the pickled tensor data alive
+  // for as long as any of them is.
+  auto tensorData = std::make_shared<std::vector<jit::WriteableTensorData>>();
+
+  if (!tensors.empty()) {
+    static thread_local torch::jit::PickleSession pickle_session;
+    pickle_session.pickle(
+        [&](const char* buf, size_t sz) {
+          metaEntry.append(buf, sz);
+        },
+        cloneSparseTensors(tensors),
+        nullptr);
+    *tensorData = pickle_session.takeTensorData();
+  }
+
+  // The header announces every section, but only the payload and the
+  // pickled metadata follow it in the returned buffer. The tensor sections
+  // travel as separate chunks, straight out of their storages.
+  std::string header;
+  if (!payload.empty()) {
+    header.append(kPayload)
+        .append(" ")
+        .append(c10::to_string(payload.size()))
+        .append("\n");
+  }
+  if (!tensors.empty()) {
+    header.append(kMeta)
+        .append(" ")
+        .append(c10::to_string(metaEntry.size()))
+        .append("\n");
+    for (size_t i = 0; i < tensorData->size(); i++) {
+      header.append(c10::to_string(i))
+          .append(" ")
+          .append(c10::to_string((*tensorData)[i].sizeInBytes()))
+          .append("\n");
+    }
+  }
+  header.push_back('\n');
+
+  std::string out;
+  out.reserve(header.size() + payload.size() + metaEntry.size());
+  out.append(header);
+  if (!payload.empty()) {
+    out.append(payload.data(), payload.size());
+  }
+  out.append(metaEntry);
+
+  std::vector<torch::Tensor> chunks;
+  chunks.reserve(tensorData->size());
+  for (size_t i = 0; i < tensorData->size(); i++) {
+    auto keepAlive = tensorData;
+    chunks.push_back(torch::from_blob(
+        const_cast<char*>((*tensorData)[i].data()),
+        {(int64_t)(*tensorData)[i].sizeInBytes()},
+        [keepAlive](void*) {},
+        {torch::kChar}));
+  }
+  return {std::move(out), std::move(chunks)};
+}
+
+std::vector<size_t> wireChunkSizes(
+    const void* headerData,
+    size_t headerSize) {
+  std::vector<std::pair<std::string, size_t>> headerEnts;
+  parseWireHeader(headerData, headerSize, headerEnts);
+
+  std::vector<size_t> sizes;
+  for (const auto& headerEnt : headerEnts) {
+    if (headerEnt.first != kPayload && headerEnt.first != kMeta) {
+      sizes.push_back(headerEnt.second);
+    }
+  }
+  return sizes;
+}
+
+std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserializeChunks(
+    const void* headerData,
+    size_t headerSize,
+    const std::vector<torch::Tensor>& chunks) {
+  std::vector<std::pair<std::string, size_t>> headerEnts;
+  const char* ptr = parseWireHeader(headerData, headerSize, headerEnts);
+  const char* endp = static_cast<const char*>(headerData) + headerSize;
+
+  // The payload and metadata sections are in line; the rest map onto the
+  // chunk buffers, in header order.
+  std::pair<const char*, size_t> payloadSection{nullptr, 0};
+  std::pair<const char*, size_t> metaSection{nullptr, 0};
+  std::unordered_map<std::string, size_t> chunkIndex;
+  size_t nextChunk = 0;
+  for (const auto& headerEnt : headerEnts) {
+    if (headerEnt.first == kPayload) {
+      payloadSection = {ptr, headerEnt.second};
+      ptr += headerEnt.second;
+    } else if (headerEnt.first == kMeta) {
+      metaSection = {ptr, headerEnt.second};
+      ptr += headerEnt.second;
+    } else {
+      chunkIndex[headerEnt.first] = nextChunk++;
+    }
+  }
+  if (ptr != endp) {
+    throw std::runtime_error("failed bounds");
+  }
+  if (chunkIndex.size() != chunks.size()) {
+    throw std::runtime_error("chunk count mismatch");
+  }
+
+  std::vector<char> payload;
+  if (payloadSection.second != 0) {
+    payload.assign(
+        payloadSection.first, payloadSection.first + payloadSection.second);
+  }
+
+  std::vector<at::Tensor> tensors;
+  if (metaSection.first != nullptr) {
+    size_t metaDataPos = 0;
+    auto metaDataReadFunc = [&](char* buf, size_t n) -> size_t {
+      if (metaDataPos >= metaSection.second || n == 0) {
+        return 0;
+      }
+      size_t toCopy =
+          std::min(metaDataPos + n, metaSection.second) - metaDataPos;
+      memcpy(buf, metaSection.first + metaDataPos, toCopy);
+      metaDataPos += toCopy;
+      return toCopy;
+    };
+    auto sectionReadFunc = [&](const std::string& ename) -> at::DataPtr {
+      auto it = chunkIndex.find(ename);
+      if (it == chunkIndex.end()) {
+        throw std::runtime_error("Couldn't find entity " + ename);
+      }
+      // Hand the chunk buffer itself to the unpickler; the received bytes
+      // become the tensor's storage without another copy. The context
+      // tensor keeps the buffer alive for the storage's lifetime.
+      const auto& chunk = chunks[it->second];
+      auto* ctx = new torch::Tensor(chunk);
+      return at::DataPtr(
+          ctx->data_ptr(),
+          ctx,
+          [](void* ptr) { delete static_cast<torch::Tensor*>(ptr); },
+          at::DeviceType::CPU);
+    };
+
+    // No need to pass typeResolver here, as it always processes string and
+    // tensors only
+    torch::jit::Unpickler unpickler(
+        metaDataReadFunc, nullptr, nullptr, sectionReadFunc, {});
+    auto ival = unpickler.parse_ivalue();
+    for (auto&& t : ival.toTensorList()) {
+      tensors.emplace_back(std::move(t));
+    }
+  }
+  return {std::move(payload), std::move(tensors)};
+}
+
 } // namespace rpc
 } // namespace distributed
 } // namespace torch
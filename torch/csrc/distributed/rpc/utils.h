@@ -39,6 +39,34 @@ TORCH_API std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
     const void* data,
     size_t data_size);
 
+// Zero-copy variant of the wire format above, used by the process group
+// agent for remote messages. Instead of flattening tensor data into the
+// returned buffer, wireSerializeChunks keeps the tensor sections out of
+// line: the returned string holds only the section header, the payload and
+// the pickled tensor metadata, while the chunk tensors are flat CPU byte
+// views aliasing the tensors' storages, to be sent as-is. The header still
+// announces every section (including the out-of-line ones), so the
+// receiver knows how many chunks follow and how large each one is.
+TORCH_API std::pair<std::string, std::vector<torch::Tensor>>
+wireSerializeChunks(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors);
+
+// Returns the byte sizes of the out-of-line chunks announced by a chunked
+// wire header, in the order they are sent.
+TORCH_API std::vector<size_t> wireChunkSizes(
+    const void* headerData,
+    size_t headerSize);
+
+// Inverse of wireSerializeChunks. The chunk buffers (one flat CPU byte
+// tensor per out-of-line section, in wireChunkSizes order) are adopted as
+// the storage of the deserialized tensors rather than copied out of.
+TORCH_API std::pair<std::vector<char>, std::vector<at::Tensor>>
+wireDeserializeChunks(
+    const void* headerData,
+    size_t headerSize,
+    const std::vector<torch::Tensor>& chunks);
+
 // Some Tensors are effectively views of larger Tensors, where only a small
 // subset of the Storage data is referenced. This normally is good and avoids
 // copies when kept locally, but if we naively push the whole Storage over the
@@ -8,6 +8,10 @@
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/operator.h>
+#include <torch/csrc/utils/hash.h>
+
+#include <cstdlib>
+#include <cstring>
 
 namespace torch {
 namespace jit {
@@ -389,6 +393,120 @@ void Module::dump(
             << std::endl;
 }
 
+// Note [Sharing identical tensors across modules]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A process that serves one scripted model from N worker threads typically
+// loads N independent copies of it, and with them N private copies of every
+// weight. The registry below deduplicates those copies at load time: tensors
+// are keyed by a hash of their content (plus dtype and shape), and a loaded
+// tensor whose bytes match an already-registered one is dropped in favor of
+// the registered tensor, so all N modules end up pointing at one storage.
+//
+// The registry holds weak references, so it does not keep weights alive
+// once the modules using them are gone. Sharing is strictly opt-in
+// (TORCH_JIT_SHARE_LOADED_TENSORS=1) because it changes aliasing: an
+// in-place update of a shared tensor through one module is observed by all
+// of them. It is meant for inference processes that never mutate weights
+// after loading.
+
+namespace {
+
+struct TensorShareRegistry {
+  at::Tensor share(const at::Tensor& tensor) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& bucket = registry_[contentHash(tensor)];
+    for (auto it = bucket.begin(); it != bucket.end();) {
+      IValue cached = it->lock();
+      if (cached.isNone()) {
+        // the last module that used this tensor is gone
+        it = bucket.erase(it);
+        continue;
+      }
+      at::Tensor candidate = cached.toTensor();
+      if (contentEqual(tensor, candidate)) {
+        return candidate;
+      }
+      ++it;
+    }
+    bucket.emplace_back(IValue(tensor));
+    return tensor;
+  }
+
+ private:
+  static size_t contentHash(const at::Tensor& tensor) {
+    size_t seed = hash_combine(
+        static_cast<size_t>(tensor.scalar_type()),
+        static_cast<size_t>(tensor.dim()));
+    for (int64_t size : tensor.sizes()) {
+      seed = hash_combine(seed, static_cast<size_t>(size));
+    }
+    // hash the content a word at a time; the caller guarantees contiguity
+    const char* data = static_cast<const char*>(tensor.data_ptr());
+    const size_t nbytes = tensor.numel() * tensor.element_size();
+    size_t word = 0;
+    for (size_t i = 0; i + sizeof(size_t) <= nbytes; i += sizeof(size_t)) {
+      std::memcpy(&word, data + i, sizeof(size_t));
+      seed = hash_combine(seed, word);
+    }
+    word = 0;
+    std::memcpy(&word, data + nbytes - nbytes % sizeof(size_t),
+                nbytes % sizeof(size_t));
+    return hash_combine(seed, word);
+  }
+
+  static bool contentEqual(const at::Tensor& a, const at::Tensor& b) {
+    return a.scalar_type() == b.scalar_type() && a.sizes().equals(b.sizes()) &&
+        a.requires_grad() == b.requires_grad() &&
+        std::memcmp(
+            a.data_ptr(),
+            b.data_ptr(),
+            a.numel() * a.element_size()) == 0;
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::vector<c10::WeakIValue>> registry_;
+};
+
+} // namespace
+
+bool shareLoadedTensorsEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_JIT_SHARE_LOADED_TENSORS");
+    return env != nullptr && std::string(env) != "0";
+  }();
+  return enabled;
+}
+
+at::Tensor shareReadOnlyTensor(const at::Tensor& tensor) {
+  // Only plain dense CPU tensors participate; anything exotic (sparse,
+  // quantized, non-contiguous, GPU-resident) is returned untouched.
+  if (!tensor.defined() || tensor.is_sparse() || tensor.is_quantized() ||
+      tensor.device().type() != at::DeviceType::CPU ||
+      !tensor.is_contiguous() || tensor.numel() == 0) {
+    return tensor;
+  }
+  static TensorShareRegistry registry;
+  return registry.share(tensor);
+}
+
+void shareReadOnlyTensors(Module& module) {
+  for (Module m : module.modules()) {
+    auto obj = m._ivalue();
+    const auto& type = m.type();
+    for (size_t i = 0; i < type->numAttributes(); ++i) {
+      IValue v = obj->getSlot(i);
+      if (!v.isTensor()) {
+        continue;
+      }
+      at::Tensor tensor = v.toTensor();
+      at::Tensor shared = shareReadOnlyTensor(tensor);
+      if (!shared.is_same(tensor)) {
+        obj->setSlot(i, shared);
+      }
+    }
+  }
+}
+
 } // namespace jit
 } // namespace torch
 
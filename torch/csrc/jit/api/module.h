@@ -553,6 +553,22 @@ struct NamedPolicy {
 
 TORCH_API bool& getInlineEverythingMode();
 
+// Content-hash-based sharing of identical tensors across module instances,
+// for processes that load many copies of the same model (e.g. one per worker
+// thread). Opt-in via TORCH_JIT_SHARE_LOADED_TENSORS=1; when enabled, the
+// import path routes every loaded constant and parameter through a
+// process-wide registry so that byte-identical tensors share one storage.
+// The shared tensors must be treated as read-only: an in-place update through
+// one module would be visible in every module that shares the tensor.
+// See Note [Sharing identical tensors across modules] in module.cpp.
+TORCH_API bool shareLoadedTensorsEnabled();
+// Returns a previously registered tensor with identical content, dtype,
+// layout and requires_grad, or registers `tensor` and returns it unchanged.
+TORCH_API at::Tensor shareReadOnlyTensor(const at::Tensor& tensor);
+// Routes every tensor attribute of `module` (recursively) through
+// shareReadOnlyTensor.
+TORCH_API void shareReadOnlyTensors(Module& module);
+
 namespace script {
 // We once had a `script::` namespace that was deleted. This is for backcompat
 // of the public API; new code should not use this type alias.
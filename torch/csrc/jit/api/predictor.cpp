@@ -0,0 +1,52 @@
+#include <torch/csrc/jit/api/predictor.h>
+
+#include <torch/csrc/jit/passes/freeze_module.h>
+
+#include <utility>
+
+namespace torch {
+namespace jit {
+
+Predictor::Predictor(Module module, size_t initial_pool_size) {
+  module.eval();
+  frozen_ = freeze_module(module);
+  for (size_t i = 0; i < initial_pool_size; ++i) {
+    pool_.push_back(frozen_.clone_instance());
+  }
+}
+
+Module Predictor::acquire() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!pool_.empty()) {
+      Module instance = std::move(pool_.back());
+      pool_.pop_back();
+      return instance;
+    }
+  }
+  // Pool exhausted: make a fresh shallow copy outside the lock. The copy
+  // shares every tensor with the frozen module and only duplicates the
+  // attribute slots, so this is cheap even for very large models.
+  return frozen_.clone_instance();
+}
+
+void Predictor::release(Module instance) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  pool_.push_back(std::move(instance));
+}
+
+IValue Predictor::operator()(std::vector<IValue> inputs) {
+  Module instance = acquire();
+  // Return the instance to the pool even if forward throws.
+  struct PoolGuard {
+    Predictor* predictor;
+    Module instance;
+    ~PoolGuard() {
+      predictor->release(std::move(instance));
+    }
+  } guard{this, std::move(instance)};
+  return guard.instance.forward(std::move(inputs));
+}
+
+} // namespace jit
+} // namespace torch
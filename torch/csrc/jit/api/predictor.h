@@ -0,0 +1,52 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+
+#include <mutex>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+/// A thread-safe inference handle for a ScriptModule, in the spirit of the
+/// Caffe2 predictor. The wrapped module is frozen once: parameters and
+/// buffers are folded into its graphs as constants, so every concurrent
+/// caller shares a single copy of the weights. Interpreter-visible mutable
+/// state (attributes the forward method writes to) is isolated by checking a
+/// shallow instance copy out of a pool per call; the copies share all tensor
+/// storage with the frozen module and only duplicate the attribute slots.
+///
+/// Compared to cloning the module per thread, memory cost is one set of
+/// attribute slots per concurrent caller rather than one copy of the weights,
+/// and no external locking is needed:
+///
+///   Predictor predictor(torch::jit::load("model.pt"));
+///   // ... from any number of threads:
+///   auto output = predictor({input});
+struct TORCH_API Predictor {
+  /// Freezes `module` (putting it in eval mode first) and pre-populates the
+  /// instance pool with `initial_pool_size` entries. The pool grows on demand
+  /// if more threads call concurrently than entries exist.
+  explicit Predictor(Module module, size_t initial_pool_size = 0);
+
+  /// Runs the frozen module's `forward` method. Safe to call concurrently
+  /// from any number of threads.
+  IValue operator()(std::vector<IValue> inputs);
+
+  /// The frozen module backing this predictor. Mutating its attributes while
+  /// predictions are running is a data race.
+  const Module& module() const noexcept {
+    return frozen_;
+  }
+
+ private:
+  Module acquire();
+  void release(Module instance);
+
+  Module frozen_;
+  std::mutex mutex_;
+  std::vector<Module> pool_;
+};
+
+} // namespace jit
+} // namespace torch
@@ -12,7 +12,11 @@
 #include <cuda_runtime.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <sstream>
 #include <stdexcept>
 #include <tuple>
@@ -64,6 +68,92 @@ static void getMajorMinor(
   }
 }
 
+// Note [CUDA fusion kernel cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When TORCH_CUDA_FUSION_CACHE_DIR names a (pre-existing, writable)
+// directory, the PTX produced by NVRTC for each fusion group is stored
+// there and reloaded on subsequent constructions, including ones in other
+// processes. This lets N identical workers on one machine pay for each
+// kernel compilation once instead of N times. Entries are keyed by the
+// kernel source, the compute architecture compiled for, and the NVRTC
+// version; the key is repeated in a header inside the file so a hash
+// collision or a stale/truncated file is detected and falls back to a
+// normal compilation. Files are written to a temporary name and renamed
+// into place so concurrent workers never observe partial entries.
+
+static const char* fusionCacheDir() {
+  // Deliberately not cached: tests and long-running processes may change
+  // the environment between compilations.
+  return std::getenv("TORCH_CUDA_FUSION_CACHE_DIR");
+}
+
+static std::string fusionCacheHeader(
+    const std::string& code,
+    const int major,
+    const int minor,
+    const int nvrtc_major,
+    const int nvrtc_minor) {
+  std::stringstream header;
+  header << "// nvrtc " << nvrtc_major << "." << nvrtc_minor << " compute_"
+         << major << minor << " " << std::hash<std::string>()(code) << "\n";
+  return header.str();
+}
+
+static std::string fusionCacheFilename(
+    const char* cache_dir,
+    const std::string& header) {
+  std::stringstream filename;
+  filename << cache_dir << "/" << std::hex
+           << std::hash<std::string>()(header) << ".ptx";
+  return filename.str();
+}
+
+static bool loadFusionCache(
+    const std::string& filename,
+    const std::string& header,
+    std::vector<char>& ptx) {
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::stringstream content;
+  content << file.rdbuf();
+  const std::string entry = content.str();
+  if (entry.size() <= header.size() ||
+      entry.compare(0, header.size(), header) != 0) {
+    return false;
+  }
+  // The stored payload is the exact NVRTC output, including the
+  // terminating NUL cuModuleLoadData expects.
+  ptx.assign(entry.begin() + header.size(), entry.end());
+  return ptx.back() == '\0';
+}
+
+static void saveFusionCache(
+    const std::string& filename,
+    const std::string& header,
+    const std::vector<char>& ptx) {
+  // Writes go to a per-writer temporary name first; the rename is atomic,
+  // so racing workers simply overwrite each other with identical content.
+  const std::string temp_filename = filename + ".tmp." +
+      std::to_string(
+          std::chrono::steady_clock::now().time_since_epoch().count());
+  {
+    std::ofstream file(
+        temp_filename, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file) {
+      return;
+    }
+    file.write(header.data(), header.size());
+    file.write(ptx.data(), ptx.size());
+    if (!file) {
+      std::remove(temp_filename.c_str());
+      return;
+    }
+  }
+  std::rename(temp_filename.c_str(), filename.c_str());
+}
+
 // Compiles the specified kernel and stores the metadata required to run it
 FusedKernelCUDA::FusedKernelCUDA(
     int16_t device,
@@ -103,37 +193,58 @@ FusedKernelCUDA::FusedKernelCUDA(
   int major, minor;
   getMajorMinor(prop_, major, minor);
 
-  // Creates the NVRTC program
-  nvrtcProgram program;
-  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcCreateProgram(
-      &program, code_.c_str(), nullptr, 0, nullptr, nullptr));
+  // Tries the cross-process kernel cache before invoking NVRTC.
+  // See Note [CUDA fusion kernel cache]
+  std::string cache_header;
+  std::string cache_filename;
+  bool cache_hit = false;
+  const char* cache_dir = fusionCacheDir();
+  if (cache_dir) {
+    int nvrtc_major, nvrtc_minor;
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcVersion(&nvrtc_major, &nvrtc_minor));
+    cache_header =
+        fusionCacheHeader(code_, major, minor, nvrtc_major, nvrtc_minor);
+    cache_filename = fusionCacheFilename(cache_dir, cache_header);
+    cache_hit = loadFusionCache(cache_filename, cache_header, ptx_);
+  }
+
+  if (!cache_hit) {
+    // Creates the NVRTC program
+    nvrtcProgram program;
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcCreateProgram(
+        &program, code_.c_str(), nullptr, 0, nullptr, nullptr));
 
 #ifdef __HIP_PLATFORM_HCC__
-  std::vector<const char*> args = {};
+    std::vector<const char*> args = {};
 #else
-  const std::string compute = "--gpu-architecture=compute_" +
-      std::to_string(major) + std::to_string(minor);
-  const std::vector<const char*> args = {
-      "--std=c++14", compute.c_str(), "-default-device"};
+    const std::string compute = "--gpu-architecture=compute_" +
+        std::to_string(major) + std::to_string(minor);
+    const std::vector<const char*> args = {
+        "--std=c++14", compute.c_str(), "-default-device"};
 #endif
-  const auto result =
-      nvrtc().nvrtcCompileProgram(program, args.size(), args.data());
-  if (result != NVRTC_SUCCESS) {
-    size_t logsize;
-    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLogSize(program, &logsize));
-    std::vector<char> log(logsize);
-    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLog(program, log.data()));
-    std::stringstream cu;
-    cu << log.data();
-    throw std::runtime_error(cu.str());
+    const auto result =
+        nvrtc().nvrtcCompileProgram(program, args.size(), args.data());
+    if (result != NVRTC_SUCCESS) {
+      size_t logsize;
+      AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLogSize(program, &logsize));
+      std::vector<char> log(logsize);
+      AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLog(program, log.data()));
+      std::stringstream cu;
+      cu << log.data();
+      throw std::runtime_error(cu.str());
+    }
+    ResourceGuard holdProgram(
+        [&] { AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcDestroyProgram(&program)); });
+    AT_CUDA_NVRTC_CHECK(result);
+    size_t ptx_size;
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTXSize(program, &ptx_size));
+    ptx_.resize(ptx_size);
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTX(program, ptx_.data()));
+
+    if (!cache_filename.empty()) {
+      saveFusionCache(cache_filename, cache_header, ptx_);
+    }
   }
-  ResourceGuard holdProgram(
-      [&] { AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcDestroyProgram(&program)); });
-  AT_CUDA_NVRTC_CHECK(result);
-  size_t ptx_size;
-  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTXSize(program, &ptx_size));
-  ptx_.resize(ptx_size);
-  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTX(program, ptx_.data()));
 
   AT_CUDA_DRIVER_CHECK(nvrtc().cuModuleLoadData(&module_, ptx_.data()));
   AT_CUDA_DRIVER_CHECK(
@@ -1,5 +1,7 @@
 #include "function.h"
+#include <ATen/ATen.h>
 #include <ATen/core/op_registration/op_registration.h>
+#include <ATen/core/stack.h>
 #include <torch/csrc/jit/runtime/instruction.h>
 #include <torch/csrc/jit/runtime/operator.h>
 #include <torch/csrc/jit/runtime/vararg_functions.h>
@@ -11,6 +13,103 @@ namespace jit {
 
 char const* toString(OpCode op);
 namespace mobile {
+namespace {
+
+at::Tensor toOptionalTensor(const c10::IValue& v) {
+  if (v.isNone()) {
+    return at::Tensor();
+  }
+  return v.toTensor();
+}
+
+// Unboxed trampolines for the few ops that dominate op counts in typical
+// mobile models. The generic path below goes through boxed c10 dispatch on
+// every call; for these ops the schema registered with the dispatcher is
+// validated once at load time and the call is bound straight into ATen,
+// with the same peek/drop/pack stack discipline as the kernels in
+// register_mobile_ops.cpp. Returns an empty function when the registered
+// schema does not have the expected shape, in which case the caller keeps
+// the boxed path.
+std::function<void(Stack&)> makeUnboxedTrampoline(
+    const c10::OperatorName& opname,
+    const c10::FunctionSchema& schema) {
+  const auto num_args = schema.arguments().size();
+  if (opname.name == "aten::conv2d" && opname.overload_name.empty() &&
+      num_args == 7) {
+    return [](Stack& stack) {
+#ifdef USE_STATIC_DISPATCH
+      at::AutoNonVariableTypeMode non_var_type_mode(true);
+#endif
+      auto result = at::conv2d(
+          (std::move(peek(stack, 0, 7))).toTensor(),
+          (std::move(peek(stack, 1, 7))).toTensor(),
+          toOptionalTensor(std::move(peek(stack, 2, 7))),
+          (std::move(peek(stack, 3, 7))).toIntVector(),
+          (std::move(peek(stack, 4, 7))).toIntVector(),
+          (std::move(peek(stack, 5, 7))).toIntVector(),
+          (std::move(peek(stack, 6, 7))).toInt());
+      drop(stack, 7);
+      pack(stack, std::move(result));
+    };
+  }
+  if (opname.name == "aten::linear" && opname.overload_name.empty() &&
+      num_args == 3) {
+    return [](Stack& stack) {
+#ifdef USE_STATIC_DISPATCH
+      at::AutoNonVariableTypeMode non_var_type_mode(true);
+#endif
+      auto result = at::linear(
+          (std::move(peek(stack, 0, 3))).toTensor(),
+          (std::move(peek(stack, 1, 3))).toTensor(),
+          toOptionalTensor(std::move(peek(stack, 2, 3))));
+      drop(stack, 3);
+      pack(stack, std::move(result));
+    };
+  }
+  if (opname.name == "aten::relu" && opname.overload_name.empty() &&
+      num_args == 1) {
+    return [](Stack& stack) {
+#ifdef USE_STATIC_DISPATCH
+      at::AutoNonVariableTypeMode non_var_type_mode(true);
+#endif
+      auto result = at::relu((std::move(peek(stack, 0, 1))).toTensor());
+      drop(stack, 1);
+      pack(stack, std::move(result));
+    };
+  }
+  if (opname.name == "aten::add" && opname.overload_name == "Tensor" &&
+      num_args == 3) {
+    return [](Stack& stack) {
+#ifdef USE_STATIC_DISPATCH
+      at::AutoNonVariableTypeMode non_var_type_mode(true);
+#endif
+      auto result = at::add(
+          (std::move(peek(stack, 0, 3))).toTensor(),
+          (std::move(peek(stack, 1, 3))).toTensor(),
+          (std::move(peek(stack, 2, 3))).toScalar());
+      drop(stack, 3);
+      pack(stack, std::move(result));
+    };
+  }
+  if (opname.name == "aten::add" && opname.overload_name == "Scalar" &&
+      num_args == 3) {
+    return [](Stack& stack) {
+#ifdef USE_STATIC_DISPATCH
+      at::AutoNonVariableTypeMode non_var_type_mode(true);
+#endif
+      auto result = at::add(
+          (std::move(peek(stack, 0, 3))).toTensor(),
+          (std::move(peek(stack, 1, 3))).toScalar(),
+          (std::move(peek(stack, 2, 3))).toScalar());
+      drop(stack, 3);
+      pack(stack, std::move(result));
+    };
+  }
+  return nullptr;
+}
+
+} // namespace
+
 Function::Function(c10::QualifiedName name)
     : name_(name), code_(std::make_shared<Code>()) {}
 
@@ -40,9 +139,14 @@ bool Function::append_operator(
   }
   auto op = c10::Dispatcher::singleton().findSchema(opname_c10);
   if (op.has_value()) {
-    fn = [op](Stack& stack) {
-      c10::Dispatcher::singleton().callBoxed(*op, &stack);
-    };
+    // Hot ops get an unboxed trampoline validated against the registered
+    // schema; anything else (or a schema mismatch) takes boxed dispatch.
+    fn = makeUnboxedTrampoline(opname, op->schema());
+    if (!fn) {
+      fn = [op](Stack& stack) {
+        c10::Dispatcher::singleton().callBoxed(*op, &stack);
+      };
+    }
   } else { // Not found in c10 registration, use JIT dispatch
     auto jit_op = findOperatorFor(opname);
     TORCH_CHECK(
@@ -72,74 +72,95 @@ void print_unsupported_ops_and_throw(
   TORCH_CHECK(false, "Following ops cannot be found:", error_message);
 }
 
-void parseMethods(
-    const std::vector<IValue>& vals,
-    mobile::CompilationUnit& mcu) {
-  for (const auto& element : vals) {
-    const auto& m_tuple = element.toTuple()->elements();
-    const std::string& function_name = m_tuple[0].toStringRef();
-    IValue table = m_tuple[1];
+std::unique_ptr<mobile::Function> parseMethod(
+    const std::string& function_name,
+    const IValue& table) {
+  auto function = std::unique_ptr<mobile::Function>(
+      new mobile::Function(c10::QualifiedName(function_name)));
+
+  const auto& ins_list =
+      expect_field(table, "instructions", BYTECODE_INDEX_INSTRUCTION)
+          .toTuple()
+          ->elements();
+  const auto& ops_list =
+      expect_field(table, "operators", BYTECODE_INDEX_OPERATOR)
+          .toTuple()
+          ->elements();
+  const auto& consts_list =
+      expect_field(table, "constants", BYTECODE_INDEX_CONSTANT)
+          .toTuple()
+          ->elements();
+  const auto& types_list =
+      expect_field(table, "types", BYTECODE_INDEX_TYPE).toTuple()->elements();
+  const auto& register_size = expect_field(table, "register_size", 4).toInt();
+
+  for (const auto& ins : ins_list) {
+    auto ins_item = ins.toTuple()->elements();
+    TORCH_CHECK(
+        ins_item.size() == 3,
+        "There should be three parts in an instruction.");
+    OpCode op_code = parseOpCode(ins_item[0].toString()->string().c_str());
+    int X = ins_item[1].toInt();
+    int N = ins_item[2].toInt();
+    function->append_instruction(op_code, X, N);
+  }
 
-    auto function = std::unique_ptr<mobile::Function>(
-        new mobile::Function(c10::QualifiedName(function_name)));
-
-    const auto& ins_list =
-        expect_field(table, "instructions", BYTECODE_INDEX_INSTRUCTION)
-            .toTuple()
-            ->elements();
-    const auto& ops_list =
-        expect_field(table, "operators", BYTECODE_INDEX_OPERATOR)
-            .toTuple()
-            ->elements();
-    const auto& consts_list =
-        expect_field(table, "constants", BYTECODE_INDEX_CONSTANT)
-            .toTuple()
-            ->elements();
-    const auto& types_list =
-        expect_field(table, "types", BYTECODE_INDEX_TYPE).toTuple()->elements();
-    const auto& register_size = expect_field(table, "register_size", 4).toInt();
-
-    for (const auto& ins : ins_list) {
-      auto ins_item = ins.toTuple()->elements();
-      TORCH_CHECK(
-          ins_item.size() == 3,
-          "There should be three parts in an instruction.");
-      OpCode op_code = parseOpCode(ins_item[0].toString()->string().c_str());
-      int X = ins_item[1].toInt();
-      int N = ins_item[2].toInt();
-      function->append_instruction(op_code, X, N);
+  std::unordered_set<std::string> unsupported_op_names;
+  for (const auto& op : ops_list) {
+    auto op_item = op.toTuple()->elements();
+    TORCH_CHECK(
+        op_item.size() == 2,
+        "There should be two parts in an operator name.");
+    auto op_found = function->append_operator(
+        op_item[0].toString()->string(), op_item[1].toString()->string());
+    if (!op_found) {
+      unsupported_op_names.emplace(
+          op_item[0].toString()->string() + "." +
+          op_item[1].toString()->string());
     }
+  }
 
-    std::unordered_set<std::string> unsupported_op_names;
-    for (const auto& op : ops_list) {
-      auto op_item = op.toTuple()->elements();
-      TORCH_CHECK(
-          op_item.size() == 2,
-          "There should be two parts in an operator name.");
-      auto op_found = function->append_operator(
-          op_item[0].toString()->string(), op_item[1].toString()->string());
-      if (!op_found) {
-        unsupported_op_names.emplace(
-            op_item[0].toString()->string() + "." +
-            op_item[1].toString()->string());
-      }
-    }
+  if (!unsupported_op_names.empty()) {
+    print_unsupported_ops_and_throw(unsupported_op_names);
+  };
 
-    if (!unsupported_op_names.empty()) {
-      print_unsupported_ops_and_throw(unsupported_op_names);
-    };
+  for (const auto& constant : consts_list) {
+    function->append_constant(constant);
+  }
 
-    for (const auto& constant : consts_list) {
-      function->append_constant(constant);
-    }
+  for (const auto& t : types_list) {
+    function->append_type(c10::parseType(t.toStringRef()));
+  }
 
-    for (const auto& t : types_list) {
-      function->append_type(c10::parseType(t.toStringRef()));
-    }
+  function->set_register_size(register_size);
 
-    function->set_register_size(register_size);
+  return function;
+}
 
-    mcu.register_function(std::move(function));
+// Registers every method lazily: only the method name is examined here, and
+// the expensive half of loading — instruction decode, operator resolution
+// through the dispatcher, type parsing — is deferred until the method is
+// first looked up. A module with hundreds of methods of which a session
+// calls a handful then pays cold-start cost only for the handful.
+//
+// The bytecode archive is a single pickle read through PyTorchStreamReader,
+// so there is no per-method file section to mmap; what we can and do avoid
+// re-touching is everything downstream of the unpickled table. A
+// consequence of the deferral is that an unsupported operator in a method
+// surfaces at that method's first call rather than at load time.
+void parseMethods(
+    const std::vector<IValue>& vals,
+    mobile::CompilationUnit& mcu) {
+  for (const auto& element : vals) {
+    const auto& m_tuple = element.toTuple()->elements();
+    std::string function_name = m_tuple[0].toStringRef();
+    IValue table = m_tuple[1];
+    c10::QualifiedName qualname(function_name);
+    mcu.register_lazy_function(
+        std::move(qualname),
+        [function_name = std::move(function_name), table = std::move(table)]() {
+          return parseMethod(function_name, table);
+        });
   }
 }
 
@@ -269,11 +290,25 @@ mobile::Module _load_for_mobile(
 
 mobile::Module _load_for_mobile(
     const std::string& filename,
+    c10::optional<at::Device> device,
+    bool use_mmap) {
+  auto reader = torch::make_unique<PyTorchStreamReader>(filename, use_mmap);
+  BytecodeDeserializer deserializer(std::move(reader));
+  return deserializer.deserialize(device);
+}
+
+#if !defined(_WIN32)
+mobile::Module _load_for_mobile_from_fd(
+    int fd,
     c10::optional<at::Device> device) {
-  std::unique_ptr<FileAdapter> rai = std::make_unique<FileAdapter>(filename);
-  auto module = _load_for_mobile(std::move(rai), device);
-  return module;
+  // /proc/self/fd reopens the caller's descriptor, so this works for
+  // regular files as well as ashmem/memfd regions passed between
+  // processes; the mapping then shares physical pages with every other
+  // mapper of the region.
+  return _load_for_mobile(
+      "/proc/self/fd/" + c10::to_string(fd), device, /* use_mmap */ true);
 }
+#endif
 
 mobile::Module _load_for_mobile(
     std::unique_ptr<ReadAdapterInterface> rai,
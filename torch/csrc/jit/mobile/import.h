@@ -16,9 +16,26 @@ TORCH_API mobile::Module _load_for_mobile(
     std::istream& in,
     c10::optional<at::Device> device = c10::nullopt);
 
+// With use_mmap=true, constant tensors and prepacked weights alias a
+// read-only copy-on-write mapping of the model file instead of heap
+// copies, so every process (and every Module in-process) mapping the same
+// file shares one physical copy of the clean weight pages. Falls back to
+// copying reads on Windows and for compressed records; see
+// Note [Memory-mapped record loading] in inline_container.cc.
 TORCH_API mobile::Module _load_for_mobile(
     const std::string& filename,
+    c10::optional<at::Device> device = c10::nullopt,
+    bool use_mmap = false);
+
+#if !defined(_WIN32)
+// Same as above for a model held in a file descriptor — on Android,
+// typically an ashmem or memfd region received from another process, so
+// both processes map the very same pages. The fd is accessed through
+// /proc/self/fd and stays owned by the caller.
+TORCH_API mobile::Module _load_for_mobile_from_fd(
+    int fd,
     c10::optional<at::Device> device = c10::nullopt);
+#endif
 
 TORCH_API mobile::Module _load_for_mobile(
     std::unique_ptr<ReadAdapterInterface> rai,
@@ -10,6 +10,10 @@
 #include <torch/csrc/jit/mobile/observer.h>
 #endif
 
+#if defined(PYTORCH_MOBILE_OP_PROFILING)
+#include <torch/csrc/jit/mobile/profiler.h>
+#endif
+
 namespace torch {
 namespace jit {
 char const* toString(OpCode op);
@@ -48,13 +52,41 @@ bool InterpreterState::run(Stack& stack) {
           }
         }
         RECORD_FUNCTION(code_->op_names_[inst.X].name, stack);
+#endif
+#if defined(PYTORCH_MOBILE_OP_PROFILING)
+        const bool profile = opProfilingEnabled();
+        const uint64_t profile_start =
+            profile ? opProfilingCycleCounter() : 0;
 #endif
         code_->operators_[inst.X](stack);
+#if defined(PYTORCH_MOBILE_OP_PROFILING)
+        if (profile) {
+          recordOpProfile(
+              code_->op_names_[inst.X],
+              pc,
+              profile_start,
+              opProfilingCycleCounter());
+        }
+#endif
         ++pc;
       } break;
       case OPN: {
         stack.push_back(inst.N);
+#if defined(PYTORCH_MOBILE_OP_PROFILING)
+        const bool profile = opProfilingEnabled();
+        const uint64_t profile_start =
+            profile ? opProfilingCycleCounter() : 0;
+#endif
         code_->operators_[inst.X](stack);
+#if defined(PYTORCH_MOBILE_OP_PROFILING)
+        if (profile) {
+          recordOpProfile(
+              code_->op_names_[inst.X],
+              pc,
+              profile_start,
+              opProfilingCycleCounter());
+        }
+#endif
         ++pc;
       } break;
       case INTERFACE_CALL: {
@@ -151,6 +183,10 @@ bool InterpreterState::run(Stack& stack) {
         listUnpack(stack, inst.X);
         ++pc;
       } break;
+      case TUPLE_UNPACK: {
+        tupleUnpack(stack, inst.X);
+        ++pc;
+      } break;
       case TUPLE_CONSTRUCT: {
         tupleConstruct(stack, inst.X);
         ++pc;
@@ -1,4 +1,7 @@
 #include "module.h"
+#include <c10/util/Optional.h>
+#include <caffe2/utils/threadpool/ThreadPool.h>
+#include <caffe2/utils/threadpool/ThreadPoolMobile.h>
 #include <torch/csrc/jit/mobile/interpreter.h>
 #include <torch/csrc/jit/runtime/jit_exception.h>
 #if defined(PYTORCH_MOBILE_OBSERVER)
@@ -19,18 +22,77 @@ const std::string& Function::name() const {
 }
 
 void CompilationUnit::register_function(std::unique_ptr<Function> fn) {
+  std::lock_guard<std::mutex> guard(methods_mutex_);
   methods_.emplace_back(std::move(fn));
 }
 
+void CompilationUnit::register_lazy_function(
+    c10::QualifiedName qualname,
+    std::function<std::unique_ptr<Function>()> loader) {
+  std::lock_guard<std::mutex> guard(methods_mutex_);
+  pending_.push_back({std::move(qualname), std::move(loader)});
+}
+
+Function* CompilationUnit::materialize(size_t pending_index) {
+  auto fn = pending_[pending_index].loader();
+  pending_.erase(pending_.begin() + pending_index);
+  methods_.emplace_back(std::move(fn));
+  return methods_.back().get();
+}
+
+std::vector<std::unique_ptr<Function>>& CompilationUnit::methods() {
+  std::lock_guard<std::mutex> guard(methods_mutex_);
+  while (!pending_.empty()) {
+    materialize(0);
+  }
+  return methods_;
+}
+
 Function* CompilationUnit::find_function(const c10::QualifiedName& qn) {
+  std::lock_guard<std::mutex> guard(methods_mutex_);
   for (auto& fn : methods_) {
     if (fn->qualname() == qn) {
       return fn.get();
     }
   }
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    if (pending_[i].qualname == qn) {
+      return materialize(i);
+    }
+  }
+  return nullptr;
+}
+
+Function* CompilationUnit::find_function_by_basename(
+    const std::string& basename) {
+  std::lock_guard<std::mutex> guard(methods_mutex_);
+  for (auto& fn : methods_) {
+    if (fn->name() == basename) {
+      return fn.get();
+    }
+  }
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    if (pending_[i].qualname.name() == basename) {
+      return materialize(i);
+    }
+  }
   return nullptr;
 }
 
+void Module::set_use_activation_arena(bool enable) {
+  if (enable && activation_arena_ == nullptr) {
+    activation_arena_ = std::make_shared<c10::CPUCachingAllocator>();
+  } else if (!enable) {
+    activation_arena_ = nullptr;
+  }
+}
+
+void Module::trim_activation_arena() {
+  if (activation_arena_) {
+    activation_arena_->trim();
+  }
+}
+
 c10::IValue Module::run_method(const std::string& method_name, Stack stack) {
 #if defined(PYTORCH_MOBILE_OBSERVER)
   auto observer = torch::observerConfig().getModuleObserver();
@@ -48,7 +110,13 @@ c10::IValue Module::run_method(const std::string& method_name, Stack stack) {
 
   auto m = find_method(method_name);
   stack.insert(stack.begin(), object_);
-  m->run(stack);
+  {
+    c10::optional<c10::WithCPUCachingAllocatorGuard> arena_guard;
+    if (activation_arena_) {
+      arena_guard.emplace(activation_arena_.get());
+    }
+    m->run(stack);
+  }
   c10::IValue result = stack.front();
 
 #if defined(PYTORCH_MOBILE_OBSERVER)
@@ -60,12 +128,11 @@ c10::IValue Module::run_method(const std::string& method_name, Stack stack) {
 }
 
 Function* Module::find_method(const std::string& basename) const {
-  for (auto& fn : cu_->methods()) {
-    if (fn->name() == basename) {
-      return fn.get();
-    }
+  auto fn = cu_->find_function_by_basename(basename);
+  if (fn == nullptr) {
+    AT_ERROR("Method '", basename, "' is not defined.");
   }
-  AT_ERROR("Method '", basename, "' is not defined.");
+  return fn;
 }
 
 namespace {
@@ -87,6 +154,26 @@ const std::vector<at::Tensor> Module::parameters() const {
   slot_params_recurse(object_, &params);
   return params;
 }
+
+void warmupThreadPool() {
+  caffe2::mobile_threadpool()->warmup();
+}
+
+void setThreadPoolMode(ThreadPoolMode mode) {
+  caffe2::ThreadPool::PerformanceMode pool_mode;
+  switch (mode) {
+    case ThreadPoolMode::kLatency:
+      pool_mode = caffe2::ThreadPool::PerformanceMode::kLatency;
+      break;
+    case ThreadPoolMode::kPower:
+      pool_mode = caffe2::ThreadPool::PerformanceMode::kPower;
+      break;
+    default:
+      pool_mode = caffe2::ThreadPool::PerformanceMode::kDefault;
+      break;
+  }
+  caffe2::mobile_threadpool()->setPerformanceMode(pool_mode);
+}
 } // namespace mobile
 } // namespace jit
 } // namespace torch
@@ -1,7 +1,11 @@
 #pragma once
 //#include <ATen/core/function_schema.h>
+#include <c10/core/CPUCachingAllocator.h>
 #include <torch/csrc/jit/mobile/function.h>
 
+#include <functional>
+#include <mutex>
+
 namespace torch {
 namespace jit {
 namespace mobile {
@@ -10,13 +14,31 @@ using Stack = std::vector<c10::IValue>;
 class CompilationUnit {
  public:
   void register_function(std::unique_ptr<Function> fn);
-  std::vector<std::unique_ptr<Function>>& methods() {
-    return methods_;
-  }
+  // Registers a method whose bytecode table has not been parsed yet. The
+  // loader runs at most once, the first time the method is looked up, so
+  // load time and the memory dirtied by instruction decode and operator
+  // resolution scale with the methods a session actually calls.
+  void register_lazy_function(
+      c10::QualifiedName qualname,
+      std::function<std::unique_ptr<Function>()> loader);
+  // Materializes all still-pending methods (e.g. for tooling that needs to
+  // enumerate every method) and returns them.
+  std::vector<std::unique_ptr<Function>>& methods();
   Function* find_function(const c10::QualifiedName& qn);
+  Function* find_function_by_basename(const std::string& basename);
 
  private:
+  struct LazyMethod {
+    c10::QualifiedName qualname;
+    std::function<std::unique_ptr<Function>()> loader;
+  };
+
+  // Must be called with methods_mutex_ held.
+  Function* materialize(size_t pending_index);
+
+  std::mutex methods_mutex_;
   std::vector<std::unique_ptr<Function>> methods_;
+  std::vector<LazyMethod> pending_;
 };
 
 class TORCH_API Module {
@@ -38,11 +60,36 @@ class TORCH_API Module {
     return object_->slots();
   }
   const std::vector<at::Tensor> parameters() const;
+  // Serves intermediate (activation) allocations made during run_method
+  // from a per-module caching arena, so steady-state inference reuses the
+  // first iteration's buffers instead of churning the system allocator.
+  // Weights are untouched: they are allocated at load, before any arena
+  // guard is in effect.
+  void set_use_activation_arena(bool enable);
+  bool use_activation_arena() const {
+    return activation_arena_ != nullptr;
+  }
+  // Releases the arena's cached free blocks back to the system (e.g. on a
+  // memory-pressure signal); live allocations are unaffected.
+  void trim_activation_arena();
 
  private:
   c10::intrusive_ptr<c10::ivalue::Object> object_;
   std::shared_ptr<CompilationUnit> cu_;
+  std::shared_ptr<c10::CPUCachingAllocator> activation_arena_;
 };
+
+// Thread-pool controls for app lifecycle management, forwarded to the
+// shared mobile inference pool (caffe2::mobile_threadpool):
+//  - warmupThreadPool pre-spawns the worker threads, so the thread-creation
+//    latency spike lands at app startup instead of in the first inference;
+//  - kLatency pins workers to the fastest (big) cluster, kPower to the
+//    slowest, kDefault restores unrestricted placement — for foreground vs
+//    backgrounded apps on big.LITTLE SoCs. No-ops off Linux/Android.
+enum class ThreadPoolMode : uint8_t { kDefault, kLatency, kPower };
+TORCH_API void warmupThreadPool();
+TORCH_API void setThreadPoolMode(ThreadPoolMode mode);
+
 } // namespace mobile
 } // namespace jit
 } // namespace torch
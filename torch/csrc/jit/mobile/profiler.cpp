@@ -0,0 +1,105 @@
+#include "profiler.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace torch {
+namespace jit {
+namespace mobile {
+
+namespace {
+
+// Sized so a drain cadence of once per inference comfortably covers large
+// models (a few thousand op dispatches) at ~64 bytes per event.
+constexpr size_t kOpProfileRingCapacity = 4096;
+
+struct OpProfileRing {
+  std::mutex mutex;
+  std::array<OpProfileEvent, kOpProfileRingCapacity> events;
+  // Total number of events ever recorded; the ring slot is total %
+  // capacity, so the oldest surviving event is at total - capacity.
+  uint64_t total = 0;
+};
+
+OpProfileRing& ring() {
+  static OpProfileRing instance;
+  return instance;
+}
+
+std::atomic<bool> profiling_enabled{false};
+
+} // namespace
+
+void enableOpProfiling(bool enable) {
+  profiling_enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool opProfilingEnabled() {
+  return profiling_enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t opProfilingCycleCounter() {
+#if defined(__aarch64__)
+  // The virtual counter is readable from EL0 everywhere, unlike the PMU
+  // cycle counter, which needs kernel cooperation.
+  uint64_t count;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(count));
+  return count;
+#elif defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(
+      std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+void recordOpProfile(
+    const c10::OperatorName& op_name,
+    uint32_t pc,
+    uint64_t start_cycles,
+    uint64_t end_cycles) {
+  if (!opProfilingEnabled()) {
+    return;
+  }
+  auto& r = ring();
+  std::lock_guard<std::mutex> guard(r.mutex);
+  OpProfileEvent& event = r.events[r.total % kOpProfileRingCapacity];
+  ++r.total;
+  event.start_cycles = start_cycles;
+  event.duration_cycles = end_cycles - start_cycles;
+  event.pc = pc;
+  if (op_name.overload_name.empty()) {
+    snprintf(event.op_name, sizeof(event.op_name), "%s", op_name.name.c_str());
+  } else {
+    snprintf(
+        event.op_name,
+        sizeof(event.op_name),
+        "%s.%s",
+        op_name.name.c_str(),
+        op_name.overload_name.c_str());
+  }
+}
+
+std::vector<OpProfileEvent> drainOpProfile() {
+  auto& r = ring();
+  std::lock_guard<std::mutex> guard(r.mutex);
+  const uint64_t count = std::min<uint64_t>(r.total, kOpProfileRingCapacity);
+  std::vector<OpProfileEvent> events;
+  events.reserve(count);
+  for (uint64_t i = r.total - count; i < r.total; ++i) {
+    events.push_back(r.events[i % kOpProfileRingCapacity]);
+  }
+  r.total = 0;
+  return events;
+}
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <ATen/core/operator_name.h>
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <cstdint>
+#include <vector>
+
+// Per-op latency instrumentation for the mobile interpreter.
+//
+// When the build defines PYTORCH_MOBILE_OP_PROFILING, the interpreter reads
+// a raw cycle counter around every operator dispatch and appends one event
+// to a fixed-size in-memory ring buffer; a harness drains the buffer with
+// drainOpProfile() at its own cadence (per inference, on app background,
+// etc.) to build per-op latency distributions from the field. The ring
+// overwrites its oldest events when full, so a stalled consumer costs
+// samples, never memory. Without the build flag the interpreter contains no
+// instrumentation and drainOpProfile() returns nothing.
+//
+// Timestamps are raw ticks of the cheapest monotonic counter the target
+// offers (cntvct_el0 on AArch64, rdtsc on x86, a steady-clock fallback
+// elsewhere); the harness is expected to convert to time units using the
+// device's known counter frequency.
+
+namespace torch {
+namespace jit {
+namespace mobile {
+
+struct OpProfileEvent {
+  uint64_t start_cycles;
+  uint64_t duration_cycles;
+  // Bytecode offset of the dispatching instruction, to tell apart multiple
+  // call sites of the same operator.
+  uint32_t pc;
+  // "name.overload" (or just "name"), truncated to fit. Kept inline so
+  // recording never allocates.
+  char op_name[48];
+};
+
+// Toggles recording at run time (cheap atomic check per dispatch). Off by
+// default; has no effect unless built with PYTORCH_MOBILE_OP_PROFILING.
+TORCH_API void enableOpProfiling(bool enable);
+TORCH_API bool opProfilingEnabled();
+
+// Removes and returns the buffered events, oldest first.
+TORCH_API std::vector<OpProfileEvent> drainOpProfile();
+
+// Reads the raw counter used for event timestamps.
+TORCH_API uint64_t opProfilingCycleCounter();
+
+// Appends one completed dispatch to the ring buffer; drops the event
+// silently when profiling is disabled.
+TORCH_API void recordOpProfile(
+    const c10::OperatorName& op_name,
+    uint32_t pc,
+    uint64_t start_cycles,
+    uint64_t end_cycles);
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
@@ -11,6 +11,7 @@
 
 #include <ATen/ATen.h>
 #include <algorithm>
+#include <sstream>
 #include <unordered_map>
 
 namespace torch {
@@ -455,6 +456,158 @@ void BatchMMSide(Block* block, AliasDb& alias_db) {
   }
 }
 
+bool same_dtype_and_device(at::TensorList inputs) {
+  auto expected_type = inputs[0].scalar_type();
+  auto expected_device = inputs[0].device();
+  return (std::all_of(
+      inputs.begin(),
+      inputs.end(),
+      [expected_type, expected_device](const at::Tensor& t) {
+        return t.scalar_type() == expected_type &&
+            t.device() == expected_device;
+      }));
+}
+
+bool shape_is_fast_for_group(const at::Tensor& lhs, const at::Tensor& rhs) {
+  // Stacking copies both operands, so grouping only pays off for small
+  // matrices, where per-call dispatch and BLAS setup cost dominates.
+  return lhs.numel() <= 256 * 256 && rhs.numel() <= 256 * 256;
+}
+
+// Given a group of independent mms with identically shaped operands that
+// share no common side (those are handled by MMBatchSide), stacks both sides
+// and issues a single batched GEMM instead of many small ones. Such groups
+// show up e.g. in the backward of per-head attention projections. The shape
+// agreement is only checked statically to the extent the types are known, so
+// verify at runtime and fall back to a loop of mms otherwise.
+RegisterOperators mm_batch_group_reg({Operator(
+    Symbol::prim("MMBatchGroup"),
+    [](const Node* node) -> Operation {
+      size_t num_mms = node->outputs().size();
+      return [num_mms](Stack& stack) {
+        std::vector<at::Tensor> inputs;
+        inputs.reserve(2 * num_mms);
+        for (auto it = stack.end() - 2 * num_mms; it != stack.end(); ++it) {
+          inputs.push_back(std::move(*it).toTensor());
+        }
+        drop(stack, 2 * num_mms);
+
+        auto lhs_inputs = at::TensorList(inputs).slice(0, num_mms);
+        auto rhs_inputs = at::TensorList(inputs).slice(num_mms);
+        if (have_same_shape(lhs_inputs) && have_same_shape(rhs_inputs) &&
+            same_dtype_and_device(inputs) &&
+            shape_is_fast_for_group(lhs_inputs[0], rhs_inputs[0])) {
+          auto out =
+              at::bmm(at::stack(lhs_inputs, 0), at::stack(rhs_inputs, 0));
+          for (size_t i = 0; i < num_mms; ++i) {
+            stack.emplace_back(out.select(0, i));
+          }
+        } else {
+          for (size_t i = 0; i < num_mms; ++i) {
+            stack.emplace_back(at::mm(lhs_inputs[i], rhs_inputs[i]));
+          }
+        }
+        return 0;
+      };
+    },
+    aliasAnalysisIsSpecialCase())});
+
+// Key describing everything statically known about an mm's operand types.
+// Only mms with equal keys are grouped, so when shapes are known (e.g. with
+// the profiling executor) the runtime fast path in MMBatchGroup is all but
+// guaranteed to hit; unknown dimensions group optimistically and rely on the
+// runtime check.
+std::string mmGroupKey(Node* mm) {
+  std::stringstream key;
+  for (Value* input : mm->inputs()) {
+    auto type = input->type()->cast<TensorType>();
+    if (type) {
+      if (auto scalar_type = type->scalarType()) {
+        key << toString(*scalar_type);
+      }
+      if (auto device = type->device()) {
+        key << *device;
+      }
+      if (auto sizes = type->sizes().concrete_sizes()) {
+        for (auto size : *sizes) {
+          key << 'x' << size;
+        }
+      }
+    }
+    key << '/';
+  }
+  return key.str();
+}
+
+void BatchMMGroup(Block* block, AliasDb& alias_db) {
+  // stack + bmm already wins with a handful of small mms
+  static constexpr size_t min_group_size = 4;
+
+  const auto batch_group = [&](std::vector<Node*>& mms) {
+    AT_ASSERT(mms.size() >= min_group_size);
+    for (int64_t i = static_cast<int64_t>(mms.size()) - 2; i >= 0; --i) {
+      bool move_ok = alias_db.moveBeforeTopologicallyValid(mms[i], mms[i + 1]);
+      AT_ASSERT(move_ok);
+    }
+    WithInsertPoint insert_guard{mms[0]};
+    Graph* graph = mms[0]->owningGraph();
+    Node* batch_mm = graph->create(
+        Symbol::prim("MMBatchGroup"),
+        /*inputs=*/{},
+        /*num_outputs=*/mms.size());
+    graph->insertNode(batch_mm);
+    for (Node* mm : mms) {
+      batch_mm->addInput(mm->inputs().at(0));
+    }
+    for (Node* mm : mms) {
+      batch_mm->addInput(mm->inputs().at(1));
+    }
+    for (size_t i = 0; i < mms.size(); ++i) {
+      mms[i]->output()->replaceAllUsesWith(batch_mm->outputs().at(i));
+    }
+  };
+
+  // Collected in topological order since we iterate the block in order.
+  std::unordered_map<std::string, std::vector<Node*>> groups;
+  for (Node* node : block->nodes()) {
+    if (node->matches("aten::mm(Tensor self, Tensor mat2) -> Tensor")) {
+      if (node->output()->uses().empty()) {
+        continue;
+      }
+      groups[mmGroupKey(node)].push_back(node);
+    } else {
+      for (Block* subblock : node->blocks()) {
+        BatchMMGroup(subblock, alias_db);
+      }
+    }
+  }
+
+  for (auto& entry : groups) {
+    auto& mms = entry.second;
+    if (mms.size() < min_group_size) {
+      continue;
+    }
+    // Filter out dependent mms, exactly like gatherIndependentMMUses does
+    for (size_t i = 0; i < mms.size(); ++i) {
+      if (mms[i] == nullptr)
+        continue;
+      for (size_t j = i + 1; j < mms.size(); ++j) {
+        if (mms[j] == nullptr)
+          continue;
+        if (!alias_db.couldMoveBeforeTopologically(mms[j], mms[i])) {
+          mms[j] = nullptr;
+        }
+      }
+    }
+    auto independent_mms =
+        c10::filter(mms, [](Node* n) { return n != nullptr; });
+    if (independent_mms.size() < min_group_size) {
+      continue;
+    }
+    batch_group(independent_mms);
+  }
+}
+
 bool hasMutableOperators(Block* block) {
   for (auto n : block->nodes()) {
     if (n->kind().is_aten() && n->schema().is_mutable())
@@ -476,6 +629,13 @@ void BatchMM(std::shared_ptr<Graph>& graph) {
   BatchMMTreeReduce(graph->block());
   BatchMMSide(graph->block(), alias_db);
   EliminateDeadCode(graph);
+  // Group leftover independent mms that share no operand into single bmm
+  // calls. Runs after the DCE above so mms already consumed by the two
+  // passes above are not resurrected, with a fresh AliasDb since the graph
+  // has changed.
+  AliasDb group_alias_db(graph);
+  BatchMMGroup(graph->block(), group_alias_db);
+  EliminateDeadCode(graph);
   // It's possible that transpose rearrangements have created sequences of
   // consecutive transposes that didn't exist before.
   PeepholeOptimize(graph);
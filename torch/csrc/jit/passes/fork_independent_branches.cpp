@@ -0,0 +1,197 @@
+#include <torch/csrc/jit/passes/fork_independent_branches.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Branches smaller than this run inline; forking them would cost more in
+// task launch overhead than the parallelism recovers.
+constexpr size_t kMinNodesPerBranch = 2;
+
+// Walks a node (including nested blocks) and reports every value it reads
+// that is defined in `scope`.
+void collectScopeDeps(Node* n, Block* scope, std::vector<Value*>& deps) {
+  for (Value* input : n->inputs()) {
+    if (input->node()->owningBlock() == scope) {
+      deps.push_back(input);
+    }
+  }
+  for (Block* b : n->blocks()) {
+    for (Value* output : b->outputs()) {
+      if (output->node()->owningBlock() == scope) {
+        deps.push_back(output);
+      }
+    }
+    for (Node* inner : b->nodes()) {
+      collectScopeDeps(inner, scope, deps);
+    }
+  }
+}
+
+bool hasSideEffectsRecursive(Node* n) {
+  if (n->hasSideEffects()) {
+    return true;
+  }
+  for (Block* b : n->blocks()) {
+    for (Node* inner : b->nodes()) {
+      if (hasSideEffectsRecursive(inner)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Wraps the given component (in topological order) into a prim::fork node
+// and inserts an aten::wait at the first external use of its result.
+// Returns true on success; on failure the graph is restored.
+bool forkComponent(Graph* graph, const std::vector<Node*>& component) {
+  // Build the fork subgraph around the last node so that every external
+  // input of the component is already defined at the fork's position.
+  Node* fork_node =
+      SubgraphUtils::createSingletonSubgraph(component.back(), prim::fork);
+  for (auto it = component.rbegin() + 1; it != component.rend(); ++it) {
+    SubgraphUtils::mergeNodeIntoSubgraph(*it, fork_node);
+  }
+  if (fork_node->outputs().size() != 1) {
+    // The interpreter's FORK produces a single future; give up on branches
+    // with several externally used results rather than packing tuples.
+    SubgraphUtils::unmergeSubgraph(fork_node);
+    return false;
+  }
+
+  Value* result = fork_node->output();
+  TypePtr elem_type = result->type();
+  result->setType(FutureType::create(elem_type));
+
+  // Wait as late as possible: immediately before the first user, so every
+  // node in between runs concurrently with the forked branch.
+  Node* first_user = nullptr;
+  for (const Use& use : result->uses()) {
+    if (first_user == nullptr || use.user->isBefore(first_user)) {
+      first_user = use.user;
+    }
+  }
+  AT_ASSERT(first_user != nullptr);
+  Node* wait_node =
+      graph->create(aten::wait, {result})->insertBefore(first_user);
+  wait_node->output()->setType(elem_type);
+  const use_list uses = result->uses(); // copy; we mutate the use list
+  for (const Use& use : uses) {
+    if (use.user != wait_node) {
+      use.user->replaceInput(use.offset, wait_node->output());
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+void ForkIndependentBranches(const std::shared_ptr<Graph>& graph) {
+  Block* block = graph->block();
+
+  // Concurrent execution is only safe when nothing in the graph mutates
+  // state or has side effects; with those ruled out, branches that share no
+  // values are independent in the aliasing sense as well.
+  AliasDb alias_db(graph);
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::fork || n->kind() == aten::wait) {
+      // the user is already managing parallelism explicitly
+      return;
+    }
+    if (hasSideEffectsRecursive(n) || alias_db.hasWriters(n)) {
+      return;
+    }
+  }
+
+  // Assign top-level nodes to branches in one topological sweep. A node
+  // whose dependencies all live in a single branch (or in none - graph
+  // inputs and constants are cheap and shared) joins that branch; a node
+  // that joins the results of several branches (e.g. the `cat` or `add`
+  // combining two towers) becomes a "tail" node that stays outside every
+  // branch, along with everything downstream of it.
+  std::unordered_map<Node*, Node*> branch_of; // node -> branch root
+  std::unordered_set<Node*> tail;
+  std::vector<Value*> deps;
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::Constant) {
+      continue;
+    }
+    deps.clear();
+    collectScopeDeps(n, block, deps);
+    Node* root = nullptr;
+    bool is_tail = false;
+    for (Value* dep : deps) {
+      Node* dep_node = dep->node();
+      if (tail.count(dep_node)) {
+        is_tail = true;
+        break;
+      }
+      auto it = branch_of.find(dep_node);
+      if (it == branch_of.end()) {
+        continue; // constant or graph input
+      }
+      if (root == nullptr) {
+        root = it->second;
+      } else if (root != it->second) {
+        is_tail = true;
+        break;
+      }
+    }
+    if (is_tail) {
+      tail.insert(n);
+      continue;
+    }
+    branch_of[n] = root == nullptr ? n : root;
+  }
+
+  std::unordered_map<Node*, std::vector<Node*>> grouped;
+  std::vector<Node*> roots; // in topological order of their first node
+  for (Node* n : block->nodes()) {
+    auto it_branch = branch_of.find(n);
+    if (it_branch == branch_of.end()) {
+      continue;
+    }
+    Node* root = it_branch->second;
+    auto it = grouped.find(root);
+    if (it == grouped.end()) {
+      roots.push_back(root);
+      it = grouped.emplace(root, std::vector<Node*>{}).first;
+    }
+    it->second.push_back(n);
+  }
+
+  std::vector<std::vector<Node*>*> candidates;
+  for (Node* root : roots) {
+    auto& component = grouped.at(root);
+    if (component.size() >= kMinNodesPerBranch) {
+      candidates.push_back(&component);
+    }
+  }
+  if (candidates.size() < 2) {
+    return;
+  }
+
+  // Fork every branch but the last; the last one runs inline on the calling
+  // thread while the forked ones execute on the inter-op pool.
+  for (size_t i = 0; i + 1 < candidates.size(); ++i) {
+    if (forkComponent(graph.get(), *candidates[i])) {
+      GRAPH_UPDATE(
+          "ForkIndependentBranches: forked a branch of ",
+          candidates[i]->size(),
+          " nodes");
+    }
+  }
+}
+
+} // namespace jit
+} // namespace torch
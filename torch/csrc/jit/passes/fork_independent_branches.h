@@ -0,0 +1,18 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Automatic inter-op parallelization. Finds independent branches at the top
+// level of the graph (e.g. the two towers of a two-tower model), wraps each
+// of them except the last into a prim::fork whose result is awaited at the
+// first use, so the branches execute concurrently on the inter-op thread
+// pool without the user writing explicit fork/wait. Branches are only
+// forked when the graph is free of mutation and side effects, so the
+// transformation cannot change observable behavior.
+TORCH_API void ForkIndependentBranches(const std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,177 @@
+#include <torch/csrc/jit/passes/horizontal_fusion.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/canonicalize.h>
+#include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Ops whose semantics depend on dimension indices change meaning once a
+// leading batch dimension is added, so groups containing them are not
+// batched. Everything else the fuser admits is pointwise and commutes with
+// stacking.
+bool hasDimDependentOps(const std::shared_ptr<Graph>& subgraph) {
+  for (Node* n : subgraph->nodes()) {
+    if (n->kind() == prim::ConstantChunk || n->kind() == prim::FusedConcat ||
+        n->kind() == aten::cat) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isCompleteTensor(Value* v) {
+  auto tt = v->type()->cast<TensorType>();
+  return tt && tt->scalarType() && tt->device() &&
+      tt->sizes().concrete_sizes();
+}
+
+// Describes an input for bucketing. Stacking requires statically known
+// matching shapes; inputs without a complete type can only match the very
+// same value, which is passed through unstacked and broadcasts against the
+// leading dimension.
+std::string inputKey(Value* v) {
+  if (!isCompleteTensor(v)) {
+    return "v" + std::to_string(v->unique());
+  }
+  auto tt = v->type()->expect<TensorType>();
+  std::ostringstream oss;
+  oss << "t" << *tt->scalarType() << "/" << *tt->device() << "/";
+  for (int64_t s : *tt->sizes().concrete_sizes()) {
+    oss << s << "x";
+  }
+  return oss.str();
+}
+
+std::string groupKey(Node* n) {
+  std::ostringstream oss;
+  // Canonicalize a copy with unique names dropped so that value naming
+  // inherited from the surrounding graph does not break structural equality.
+  oss << Canonicalize(
+             SubgraphUtils::getSubgraph(n), /*keep_unique_names=*/false)
+             ->toString(false);
+  for (Value* input : n->inputs()) {
+    oss << inputKey(input) << ";";
+  }
+  return oss.str();
+}
+
+void mergeGroups(std::shared_ptr<Graph>& graph, std::vector<Node*>& groups) {
+  // Only groups that can legally run right after the first one join the
+  // batch; the alias db rejects moves across writes to their inputs or
+  // across their own data dependencies.
+  AliasDb aliasDb(graph);
+  Node* first = groups[0];
+  std::vector<Node*> batch = {first};
+  for (size_t i = 1; i < groups.size(); i++) {
+    // A group consuming another batch member's output cannot be batched
+    // with it. Transitive dependencies are rejected by the move below, but
+    // a direct use survives moving right next to the producer.
+    bool dependsOnBatch = false;
+    for (Value* input : groups[i]->inputs()) {
+      dependsOnBatch = dependsOnBatch ||
+          std::find(batch.begin(), batch.end(), input->node()) != batch.end();
+    }
+    if (dependsOnBatch) {
+      continue;
+    }
+    if (aliasDb.moveAfterTopologicallyValid(groups[i], first)) {
+      batch.push_back(groups[i]);
+    }
+  }
+  if (batch.size() < 2) {
+    return;
+  }
+
+  WithInsertPoint guard(first);
+
+  // Stack the inputs that differ between groups along a new leading
+  // dimension; inputs shared by all groups broadcast against it.
+  std::vector<Value*> newInputs(
+      first->inputs().begin(), first->inputs().end());
+  for (size_t j = 0; j < newInputs.size(); j++) {
+    bool shared = true;
+    for (Node* g : batch) {
+      shared = shared && g->input(j) == first->input(j);
+    }
+    if (shared) {
+      continue;
+    }
+    std::vector<Value*> stacked;
+    for (Node* g : batch) {
+      stacked.push_back(g->input(j));
+    }
+    Value* list =
+        graph->insertNode(graph->createList(TensorType::get(), stacked))
+            ->output();
+    newInputs[j] = graph->insert(aten::stack, {list, 0});
+  }
+
+  Node* merged =
+      graph->insertNode(graph->createClone(first, [](Value* v) { return v; }));
+  for (size_t j = 0; j < newInputs.size(); j++) {
+    merged->replaceInput(j, newInputs[j]);
+  }
+  for (Value* output : merged->outputs()) {
+    output->setType(unshapedType(output->type()));
+  }
+
+  // Slice each group's outputs back out of the batched results.
+  for (size_t t = 0; t < batch.size(); t++) {
+    Node* g = batch[t];
+    for (size_t i = 0; i < g->outputs().size(); i++) {
+      Value* slice = graph->insert(
+          aten::select, {merged->output(i), 0, static_cast<int64_t>(t)});
+      slice->setType(g->output(i)->type());
+      g->output(i)->replaceAllUsesWith(slice);
+    }
+  }
+  for (Node* g : batch) {
+    g->destroy();
+  }
+}
+
+void horizontalFuseBlock(Block* block, std::shared_ptr<Graph>& graph) {
+  std::vector<std::string> order;
+  std::unordered_map<std::string, std::vector<Node*>> buckets;
+  for (Node* n : block->nodes()) {
+    for (Block* b : n->blocks()) {
+      horizontalFuseBlock(b, graph);
+    }
+    if (n->kind() != prim::FusionGroup) {
+      continue;
+    }
+    if (hasDimDependentOps(SubgraphUtils::getSubgraph(n))) {
+      continue;
+    }
+    std::string key = groupKey(n);
+    auto& bucket = buckets[key];
+    if (bucket.empty()) {
+      order.push_back(key);
+    }
+    bucket.push_back(n);
+  }
+  for (const std::string& key : order) {
+    if (buckets[key].size() >= 2) {
+      mergeGroups(graph, buckets[key]);
+    }
+  }
+}
+
+} // namespace
+
+void HorizontalFusion(std::shared_ptr<Graph>& graph) {
+  horizontalFuseBlock(graph->block(), graph);
+  GRAPH_DUMP("After HorizontalFusion: ", graph);
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Merges structurally identical fusion groups into a single batched fusion
+// group. Candidate groups must have the same subgraph and corresponding
+// inputs must either be the very same value (it then broadcasts against the
+// new leading dimension) or have statically known matching shapes, in which
+// case they are stacked along a new leading dimension. Each original output
+// is recovered with a select on the batched result. This cuts the number of
+// kernel launches when the same small subgraph is applied to many disjoint
+// slices, at the cost of materializing the stacked inputs.
+TORCH_API void HorizontalFusion(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -157,6 +157,49 @@ void replaceLoopCounter(Node* loop) {
   body->insertOutput(1, result);
 }
 
+void unroll(Node* loop);
+
+// Emits, in place of the given loop:
+//   if trip_count == profiled_len:
+//     <copy of the loop with trip count profiled_len> (then fully unrolled)
+//   else:
+//     <copy of the original loop>
+// Used when the profiling executor observed a single trip count for a loop
+// whose count is not a compile-time constant (e.g. a beam-search decoder
+// that always runs with the configured beam width). The observed count is a
+// prediction, not a guarantee, so the guard is required for correctness.
+void specializeProfiledLoop(Node* loop, int64_t profiled_len) {
+  Graph* graph = loop->owningGraph();
+  WithInsertPoint insert_point_guard{loop};
+
+  Value* trip_count = loop->inputs().at(0);
+  Value* const_len = graph->insertConstant(profiled_len);
+  Value* cond = graph->insert(aten::eq, {trip_count, const_len});
+  Node* versions = graph->insertNode(graph->create(prim::If, 0));
+  versions->addInput(cond);
+  Block* specialized = versions->addBlock();
+  Block* fallback = versions->addBlock();
+
+  auto identity = [](Value* v) { return v; };
+  Node* unrolled = graph->createClone(loop, identity);
+  unrolled->replaceInput(0, const_len);
+  specialized->appendNode(unrolled);
+  Node* original = graph->createClone(loop, identity);
+  fallback->appendNode(original);
+
+  for (size_t i = 0; i < loop->outputs().size(); ++i) {
+    specialized->registerOutput(unrolled->outputs().at(i));
+    fallback->registerOutput(original->outputs().at(i));
+    Value* out = versions->addOutput()->copyMetadata(loop->outputs().at(i));
+    loop->outputs().at(i)->replaceAllUsesWith(out);
+  }
+  loop->destroy();
+
+  // The specialized copy now has a constant trip count, so unrolling it
+  // takes the full-unroll path above.
+  unroll(unrolled);
+}
+
 void unroll(Node* loop) {
   Graph* graph = loop->owningGraph();
   Block* body = loop->blocks().at(0);
@@ -182,6 +225,18 @@ void unroll(Node* loop) {
     return;
   }
 
+  // Profile-guided full unrolling (see ProfilingRecord::insertTripCountProfile
+  // for where the attribute comes from). The attribute is dropped first so
+  // that the clones made below don't try to specialize again.
+  if (loop->hasAttribute(attr::profiled_trip_count)) {
+    int64_t profiled_len = loop->i(attr::profiled_trip_count);
+    loop->removeAttribute(attr::profiled_trip_count);
+    if (profiled_len >= 0 && profiled_len < kMaxBodyRepeats) {
+      specializeProfiledLoop(loop, profiled_len);
+      return;
+    }
+  }
+
   WithInsertPoint insert_point_guard{loop};
 
   // Clone the loop before we unroll it. The clone will become the epilogue.
@@ -0,0 +1,146 @@
+#include <torch/csrc/jit/passes/memory_planning.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/liveness.h>
+
+#include <map>
+#include <unordered_set>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+bool hasControlFlow(Block* block) {
+  for (Node* node : block->nodes()) {
+    if (!node->blocks().empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// A value may only share a buffer if its storage is fully described by its
+// own live range: it must be a top-level tensor that is not a graph output,
+// is never written to in place, does not alias its producer's inputs (views),
+// and does not escape into an aliasing use (e.g. a view taken of it would
+// keep reading the buffer past the value's last liveness point).
+bool isPlannable(
+    Value* v,
+    const AliasDb& aliasDb,
+    const std::unordered_set<Value*>& graph_outputs) {
+  if (!v->type()->isSubtypeOf(TensorType::get())) {
+    return false;
+  }
+  if (graph_outputs.count(v) != 0) {
+    return false;
+  }
+  if (aliasDb.escapesScope({v}) || aliasDb.hasWriters(v)) {
+    return false;
+  }
+  if (aliasDb.mayContainAlias({v}, v->node()->inputs())) {
+    return false;
+  }
+  for (const Use& use : v->uses()) {
+    if (aliasDb.mayContainAlias({v}, use.user->outputs())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+std::unordered_map<Value*, int64_t> PlanMemory(
+    const std::shared_ptr<Graph>& graph) {
+  std::unordered_map<Value*, int64_t> assignment;
+  // Like memonger, restrict planning to straight-line nets; control flow
+  // invalidates the linear lifetime ranges used below.
+  if (hasControlFlow(graph->block())) {
+    GRAPH_UPDATE("PlanMemory: graph has control flow, not planning");
+    return assignment;
+  }
+
+  AliasDb aliasDb(graph, /*isFrozen=*/true);
+  std::unordered_set<Value*> graph_outputs(
+      graph->outputs().begin(), graph->outputs().end());
+
+  // Step 1: linearize the graph and derive each value's last-live index from
+  // the liveness sets. A value is dead after the last node whose live set
+  // contains it; values that never appear die at their definition.
+  std::vector<Node*> order;
+  std::unordered_map<Node*, size_t> node_index;
+  for (Node* node : graph->block()->nodes()) {
+    node_index.emplace(node, order.size());
+    order.push_back(node);
+  }
+  std::unordered_map<Value*, size_t> last_live;
+  for (const auto& entry : BuildLivenessSets(graph)) {
+    auto it = node_index.find(entry.first);
+    if (it == node_index.end()) {
+      continue;
+    }
+    for (Value* v : entry.second) {
+      auto inserted = last_live.emplace(v, it->second);
+      if (!inserted.second && inserted.first->second < it->second) {
+        inserted.first->second = it->second;
+      }
+    }
+  }
+
+  // Step 2: walk the nodes in order and recycle slots greedily. A slot is
+  // released one node after its value's last use, so - as in memonger - an
+  // output of node i can never reuse the buffer of one of node i's inputs.
+  std::vector<int64_t> free_slots;
+  std::map<size_t, std::vector<int64_t>> expiring; // last-live index -> slots
+  int64_t num_slots = 0;
+  for (size_t i = 0; i < order.size(); i++) {
+    while (!expiring.empty() && expiring.begin()->first < i) {
+      auto& slots = expiring.begin()->second;
+      free_slots.insert(free_slots.end(), slots.begin(), slots.end());
+      expiring.erase(expiring.begin());
+    }
+    for (Value* output : order[i]->outputs()) {
+      if (!isPlannable(output, aliasDb, graph_outputs)) {
+        continue;
+      }
+      int64_t slot;
+      if (!free_slots.empty()) {
+        slot = free_slots.back();
+        free_slots.pop_back();
+      } else {
+        slot = num_slots++;
+      }
+      assignment.emplace(output, slot);
+      auto it = last_live.find(output);
+      expiring[it == last_live.end() ? i : it->second].push_back(slot);
+    }
+  }
+
+  // Step 3: record the assignment on the producing nodes so that a runtime
+  // (or a serialized graph) can pick it up without re-running the analysis.
+  for (Node* node : order) {
+    std::vector<int64_t> slots;
+    bool any_planned = false;
+    for (Value* output : node->outputs()) {
+      auto it = assignment.find(output);
+      any_planned |= it != assignment.end();
+      slots.push_back(it == assignment.end() ? -1 : it->second);
+    }
+    if (any_planned) {
+      node->is_(Symbol::attr("memory_slots"), std::move(slots));
+    }
+  }
+  GRAPH_UPDATE(
+      "PlanMemory: ",
+      assignment.size(),
+      " values share ",
+      num_slots,
+      " buffer slots");
+  return assignment;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+#include <memory>
+#include <unordered_map>
+
+namespace torch {
+namespace jit {
+
+// Assigns buffer-reuse slots to the intermediate tensors of an inference
+// graph, porting the greedy lifetime-recycling scheme of caffe2's memonger
+// (caffe2/core/memonger.cc) to the JIT IR. Lifetimes come from
+// BuildLivenessSets: two values whose live ranges do not overlap may receive
+// the same slot, which tells a runtime with out-variant kernels that it can
+// back both with a single buffer.
+//
+// The assignment is recorded on each producing node as an integer-list
+// attribute `memory_slots` aligned with the node's outputs (-1 marks outputs
+// that were not planned) and is also returned to the caller.
+//
+// Like memonger, the pass only handles straight-line graphs (it is a no-op in
+// the presence of control flow) and is meant to run on frozen inference
+// graphs. It conservatively skips graph outputs, values that are written to
+// in place, values that alias their producer's inputs (views), and values
+// whose storage escapes into an aliasing use.
+TORCH_API std::unordered_map<Value*, int64_t> PlanMemory(
+    const std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
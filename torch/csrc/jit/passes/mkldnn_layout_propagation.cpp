@@ -0,0 +1,198 @@
+#include <torch/csrc/jit/passes/mkldnn_layout_propagation.h>
+
+#include <ATen/Config.h>
+
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+
+namespace torch {
+namespace jit {
+
+#if AT_MKLDNN_ENABLED()
+
+namespace {
+
+// Ops with an MkldnnCPU kernel whose first input carries the layout and
+// whose output stays in that layout. The in-place activation variants are
+// rewritten to their out-of-place forms when moved into an MKL-DNN region,
+// since the dense temporary they used to mutate disappears.
+bool isLayoutAgnosticUnary(Node* n) {
+  switch (n->kind()) {
+    case aten::relu:
+    case aten::relu_:
+    case aten::sigmoid:
+    case aten::sigmoid_:
+    case aten::max_pool2d:
+    case aten::avg_pool2d:
+    case aten::adaptive_avg_pool2d:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool isInplace(Node* n) {
+  return n->kind() == aten::relu_ || n->kind() == aten::sigmoid_;
+}
+
+NodeKind outOfPlaceKind(Node* n) {
+  if (n->kind() == aten::relu_) {
+    return aten::relu;
+  }
+  if (n->kind() == aten::sigmoid_) {
+    return aten::sigmoid;
+  }
+  return n->kind();
+}
+
+// Conservatively decides whether `v` is an MKL-DNN layout tensor by
+// walking the producing ops. Only the patterns insertMkldnnPrePackedOps
+// and this pass emit are recognized; anything else (including sparse
+// tensors, whose to_dense must not be touched) reports false.
+bool producesMkldnn(Value* v, int depth = 0) {
+  if (depth > 100) {
+    return false;
+  }
+  Node* n = v->node();
+  switch (n->kind()) {
+    case aten::to_mkldnn:
+    case aten::mkldnn_convolution_relu:
+    case aten::mkldnn_linear:
+      return true;
+    case aten::conv2d:
+    case aten::_convolution:
+    case aten::relu:
+    case aten::sigmoid:
+    case aten::max_pool2d:
+    case aten::avg_pool2d:
+    case aten::adaptive_avg_pool2d:
+    case aten::add:
+      return producesMkldnn(n->input(0), depth + 1);
+    default:
+      return false;
+  }
+}
+
+// True when `v` is the output of aten::to_dense on an MKL-DNN tensor.
+bool isMkldnnExit(Value* v) {
+  return v->node()->kind() == aten::to_dense &&
+      producesMkldnn(v->node()->input(0));
+}
+
+// Re-emits `n` inside the MKL-DNN region: its dense inputs listed in
+// `tensor_inputs` are replaced by the MKL-DNN values feeding their
+// to_dense nodes, and a fresh to_dense is planted on the output so the
+// remaining consumers still see a dense tensor. Consecutive rewrites
+// leave to_dense/to_mkldnn pairs behind that the cancellation rule and
+// dead code elimination clean up.
+void sinkThroughExit(Node* n, at::ArrayRef<size_t> tensor_inputs) {
+  auto graph = n->owningGraph();
+
+  Node* moved = n;
+  if (isInplace(n)) {
+    WithInsertPoint guard(n);
+    moved = graph->create(outOfPlaceKind(n), n->inputs());
+    moved->output()->setType(n->output()->type());
+    graph->insertNode(moved);
+    n->output()->replaceAllUsesWith(moved->output());
+    n->destroy();
+  }
+
+  for (size_t i : tensor_inputs) {
+    moved->replaceInput(i, moved->input(i)->node()->input(0));
+  }
+
+  Node* exit = graph->create(aten::to_dense, {moved->output()});
+  exit->output()->setType(moved->output()->type());
+  exit->insertAfter(moved);
+  moved->output()->replaceAllUsesWith(exit->output());
+  exit->replaceInput(0, moved->output());
+}
+
+void propagateMkldnnLayoutOnBlock(Block* block) {
+  for (auto it = block->nodes().begin(); it != block->nodes().end();) {
+    Node* n = *it;
+    ++it;
+    for (Block* b : n->blocks()) {
+      propagateMkldnnLayoutOnBlock(b);
+    }
+
+    // to_mkldnn(to_dense(x)) is the identity on an MKL-DNN tensor; this is
+    // the boundary the per-op rewrites leave between two adjacent regions.
+    if (n->kind() == aten::to_mkldnn && isMkldnnExit(n->input(0))) {
+      n->output()->replaceAllUsesWith(n->input(0)->node()->input(0));
+      n->destroy();
+      continue;
+    }
+
+    if (isLayoutAgnosticUnary(n) && isMkldnnExit(n->input(0))) {
+      // An in-place op may not mutate a dense value someone else reads.
+      if (isInplace(n) && n->input(0)->uses().size() != 1) {
+        continue;
+      }
+      // mkldnn_avg_pool2d rejects divisor_override.
+      if (n->kind() == aten::avg_pool2d) {
+        auto divisor = toIValue(n->input(6));
+        if (!divisor || !divisor->isNone()) {
+          continue;
+        }
+      }
+      sinkThroughExit(n, {0});
+      continue;
+    }
+
+    // mkldnn_add needs both operands in MKL-DNN layout and does not
+    // broadcast, so only sink adds whose operand shapes are known equal.
+    if (n->kind() == aten::add && n->inputs().size() == 3 &&
+        isMkldnnExit(n->input(0)) && isMkldnnExit(n->input(1))) {
+      auto t0 = n->input(0)->type()->cast<TensorType>();
+      auto t1 = n->input(1)->type()->cast<TensorType>();
+      if (!t0 || !t1) {
+        continue;
+      }
+      auto s0 = t0->sizes().concrete_sizes();
+      auto s1 = t1->sizes().concrete_sizes();
+      if (!s0 || !s1 || *s0 != *s1) {
+        continue;
+      }
+      sinkThroughExit(n, {0, 1});
+      continue;
+    }
+  }
+}
+
+} // namespace
+
+void propagateMkldnnLayout(std::shared_ptr<Graph>& graph) {
+  propagateMkldnnLayoutOnBlock(graph->block());
+  // The sunk ops leave their original to_dense nodes without users.
+  EliminateDeadCode(graph);
+}
+
+void propagateMkldnnLayout(script::Module& module) {
+  for (auto& method : module.get_methods()) {
+    auto graph = method.graph();
+    propagateMkldnnLayout(graph);
+  }
+  for (script::Module m : module.children()) {
+    propagateMkldnnLayout(m);
+  }
+}
+
+#else
+
+void propagateMkldnnLayout(std::shared_ptr<Graph>& graph) {
+  TORCH_INTERNAL_ASSERT(
+      "MKL-DNN is not enabled. Please build with USE_MKLDNN=1");
+}
+
+void propagateMkldnnLayout(script::Module& module) {
+  TORCH_INTERNAL_ASSERT(
+      "MKL-DNN is not enabled. Please build with USE_MKLDNN=1");
+}
+
+#endif
+
+} // namespace jit
+} // namespace torch
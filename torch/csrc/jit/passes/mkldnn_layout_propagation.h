@@ -0,0 +1,21 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Keeps activations in blocked MKL-DNN layout across whole op chains.
+// insertMkldnnPrePackedOps rewrites each conv/linear individually, so a
+// conv-relu-pool chain round-trips through dense layout between every pair
+// of ops. This pass cancels adjacent aten::to_dense / aten::to_mkldnn
+// pairs and pushes the trailing to_dense of an MKL-DNN region down through
+// ops that have MkldnnCPU kernels (relu, sigmoid, the 2d poolings, and
+// same-shape adds), so reorders only remain at true layout boundaries.
+// Run after insertMkldnnPrePackedOps on a frozen module.
+TORCH_API void propagateMkldnnLayout(std::shared_ptr<Graph>& graph);
+TORCH_API void propagateMkldnnLayout(script::Module& module);
+
+} // namespace jit
+} // namespace torch
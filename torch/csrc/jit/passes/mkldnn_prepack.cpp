@@ -0,0 +1,294 @@
+#include <torch/csrc/jit/passes/mkldnn_prepack.h>
+
+#include <ATen/ATen.h>
+#include <ATen/Config.h>
+#include <ATen/core/grad_mode.h>
+
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/subgraph_matcher.h>
+#include <torch/csrc/jit/passes/constant_propagation.h>
+#include <torch/csrc/jit/passes/graph_rewrite_helper.h>
+#include <torch/csrc/jit/passes/mkldnn_layout_propagation.h>
+#include <torch/csrc/jit/passes/subgraph_rewrite.h>
+
+namespace torch {
+namespace jit {
+
+#if AT_MKLDNN_ENABLED()
+
+namespace {
+
+// A weight can be pre-packed when it is a frozen dense fp32 CPU constant.
+bool isPackableWeight(Value* v) {
+  auto ival = toIValue(v);
+  if (!ival || !ival->isTensor()) {
+    return false;
+  }
+  const auto& t = ival->toTensor();
+  return t.defined() && t.device().is_cpu() &&
+      t.scalar_type() == at::kFloat && t.layout() == at::kStrided &&
+      !t.requires_grad();
+}
+
+// Returns the constant tensor bound to `v`, an undefined tensor for a
+// constant None, or nullopt when `v` is not frozen.
+c10::optional<at::Tensor> frozenOptionalTensor(Value* v) {
+  auto ival = toIValue(v);
+  if (!ival) {
+    return c10::nullopt;
+  }
+  if (ival->isNone()) {
+    return at::Tensor();
+  }
+  if (ival->isTensor()) {
+    return ival->toTensor();
+  }
+  return c10::nullopt;
+}
+
+// Folds a frozen inference batch_norm into the preceding conv2d:
+//   scale = gamma / sqrt(running_var + eps)
+//   W' = W * scale,  b' = (b - running_mean) * scale + beta
+// After this the conv feeds whatever followed the batch_norm (typically a
+// relu), exposing the chain to the conv+relu rewrite below.
+void foldFrozenConvBatchNorm(Block* block) {
+  auto graph = block->owningGraph();
+  for (auto it = block->nodes().begin(); it != block->nodes().end();) {
+    Node* bn = *it;
+    ++it;
+    for (Block* b : bn->blocks()) {
+      foldFrozenConvBatchNorm(b);
+    }
+    if (bn->kind() != aten::batch_norm) {
+      continue;
+    }
+    Node* conv = bn->input(0)->node();
+    if (conv->kind() != aten::conv2d || bn->input(0)->uses().size() != 1) {
+      continue;
+    }
+    auto training = constant_as<bool>(bn->input(5));
+    auto eps = constant_as<double>(bn->input(7));
+    if (!training || *training || !eps) {
+      continue;
+    }
+    if (!isPackableWeight(conv->input(1))) {
+      continue;
+    }
+    auto conv_b = frozenOptionalTensor(conv->input(2));
+    auto bn_w = frozenOptionalTensor(bn->input(1));
+    auto bn_b = frozenOptionalTensor(bn->input(2));
+    auto mean = frozenOptionalTensor(bn->input(3));
+    auto var = frozenOptionalTensor(bn->input(4));
+    if (!conv_b || !bn_w || !bn_b || !mean || !var || !mean->defined() ||
+        !var->defined()) {
+      continue;
+    }
+
+    at::NoGradGuard no_grad;
+    at::Tensor conv_w = toIValue(conv->input(1))->toTensor();
+    at::Tensor gamma = bn_w->defined() ? *bn_w : at::ones_like(*mean);
+    at::Tensor beta = bn_b->defined() ? *bn_b : at::zeros_like(*mean);
+    at::Tensor bias = conv_b->defined() ? *conv_b : at::zeros_like(*mean);
+    at::Tensor scale = gamma / at::sqrt(*var + *eps);
+    std::vector<int64_t> scale_shape(conv_w.dim(), 1);
+    scale_shape[0] = -1;
+    at::Tensor new_w = conv_w * scale.reshape(scale_shape);
+    at::Tensor new_b = (bias - *mean) * scale + beta;
+
+    WithInsertPoint guard(conv);
+    conv->replaceInput(1, graph->insertConstant(new_w));
+    conv->replaceInput(2, graph->insertConstant(new_b));
+    bn->output()->replaceAllUsesWith(conv->output());
+    bn->destroy();
+  }
+}
+
+void insertMkldnnConvRelu(std::shared_ptr<Graph>& graph) {
+  graph_rewrite_helper::replaceConvolutionWithConv2d(graph);
+
+  std::string conv_relu_pattern = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[], %dilation:int[], %groups:int):
+        %conv = aten::conv2d(%input, %weight, %bias, %stride, %padding, %dilation, %groups)
+        %r = aten::relu(%conv)
+        return (%r) )";
+  std::string conv_relu_inplace_pattern = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[], %dilation:int[], %groups:int):
+        %conv = aten::conv2d(%input, %weight, %bias, %stride, %padding, %dilation, %groups)
+        %r = aten::relu_(%conv)
+        return (%r) )";
+  // mkldnn_convolution_relu applies the activation as an MKL-DNN post-op
+  // while the conv output is still hot instead of making a second pass
+  // over memory. Note its padding/stride argument order differs from
+  // conv2d.
+  std::string mkldnn_conv_relu_pattern = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[], %dilation:int[], %groups:int):
+        %weight_mkldnn = aten::to_mkldnn(%weight)
+        %weight_packed = aten::mkldnn_reorder_conv2d_weight(
+            %weight_mkldnn, %padding, %stride, %dilation, %groups)
+        %input_mkldnn = aten::to_mkldnn(%input)
+        %output_mkldnn = aten::mkldnn_convolution_relu(
+            %input_mkldnn, %weight_packed, %bias, %padding, %stride, %dilation, %groups)
+        %r = aten::to_dense(%output_mkldnn)
+        return (%r) )";
+
+  auto filter = [](const Match& match,
+                   const std::unordered_map<std::string, Value*>& vmap) {
+    const auto& match_vmap = match.values_map;
+    if (!isPackableWeight(match_vmap.at(vmap.at("weight")))) {
+      return false;
+    }
+    // The conv output must only feed the relu for the fusion to be legal.
+    if (match_vmap.at(vmap.at("conv"))->uses().size() != 1) {
+      return false;
+    }
+    for (const char* param : {"stride", "padding", "dilation", "groups"}) {
+      if (!toIValue(match_vmap.at(vmap.at(param)))) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  SubgraphRewriter conv_relu_rewriter;
+  conv_relu_rewriter.RegisterRewritePattern(
+      conv_relu_pattern, mkldnn_conv_relu_pattern);
+  conv_relu_rewriter.RegisterRewritePattern(
+      conv_relu_inplace_pattern, mkldnn_conv_relu_pattern);
+  conv_relu_rewriter.runOnGraph(graph, filter);
+}
+
+void insertMkldnnLinear(std::shared_ptr<Graph>& graph) {
+  std::string linear_pattern = R"(
+    graph(%input, %weight, %bias):
+        %r = aten::linear(%input, %weight, %bias)
+        return (%r))";
+  // The weight and bias conversions fold into pre-packed constants; only
+  // the activation conversions remain at run time.
+  std::string mkldnn_linear_pattern = R"(
+    graph(%input, %weight, %bias):
+        %weight_mkldnn = aten::to_mkldnn(%weight)
+        %bias_mkldnn = aten::to_mkldnn(%bias)
+        %input_mkldnn = aten::to_mkldnn(%input)
+        %output_mkldnn = aten::mkldnn_linear(
+            %input_mkldnn, %weight_mkldnn, %bias_mkldnn)
+        %r = aten::to_dense(%output_mkldnn)
+        return (%r))";
+
+  // mkldnn_linear requires an MKL-DNN layout bias, so only rewrite calls
+  // where the bias is a frozen tensor as well.
+  auto filter = [](const Match& match,
+                   const std::unordered_map<std::string, Value*>& vmap) {
+    const auto& match_vmap = match.values_map;
+    return isPackableWeight(match_vmap.at(vmap.at("weight"))) &&
+        isPackableWeight(match_vmap.at(vmap.at("bias")));
+  };
+
+  SubgraphRewriter linear_rewriter;
+  linear_rewriter.RegisterRewritePattern(
+      linear_pattern, mkldnn_linear_pattern);
+  linear_rewriter.runOnGraph(graph, filter);
+}
+
+void insertMkldnnConv2d(std::shared_ptr<Graph>& graph) {
+  graph_rewrite_helper::replaceConvolutionWithConv2d(graph);
+
+  std::string conv_2d_pattern = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[], %dilation:int[], %groups:int):
+        %r = aten::conv2d(%input, %weight, %bias, %stride, %padding, %dilation, %groups)
+        return (%r) )";
+  // conv2d dispatches to the MKL-DNN kernel when its input is an MKL-DNN
+  // tensor; the reordered weight is already in the layout the kernel
+  // expects, so no per-call packing happens. The dense bias (or None) is
+  // handled by the kernel directly.
+  std::string mkldnn_conv_2d_pattern = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[], %dilation:int[], %groups:int):
+        %weight_mkldnn = aten::to_mkldnn(%weight)
+        %weight_packed = aten::mkldnn_reorder_conv2d_weight(
+            %weight_mkldnn, %padding, %stride, %dilation, %groups)
+        %input_mkldnn = aten::to_mkldnn(%input)
+        %output_mkldnn = aten::conv2d(
+            %input_mkldnn, %weight_packed, %bias, %stride, %padding, %dilation, %groups)
+        %r = aten::to_dense(%output_mkldnn)
+        return (%r) )";
+
+  // The reorder only folds to a constant when the conv parameters are
+  // frozen constants too; otherwise it would run on every call, which is
+  // exactly the cost this pass removes.
+  auto filter = [](const Match& match,
+                   const std::unordered_map<std::string, Value*>& vmap) {
+    const auto& match_vmap = match.values_map;
+    if (!isPackableWeight(match_vmap.at(vmap.at("weight")))) {
+      return false;
+    }
+    for (const char* param : {"stride", "padding", "dilation", "groups"}) {
+      if (!toIValue(match_vmap.at(vmap.at(param)))) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  SubgraphRewriter conv_rewriter;
+  conv_rewriter.RegisterRewritePattern(
+      conv_2d_pattern, mkldnn_conv_2d_pattern);
+  conv_rewriter.runOnGraph(graph, filter);
+}
+
+} // namespace
+
+void insertMkldnnPrePackedOps(std::shared_ptr<Graph>& graph) {
+  foldFrozenConvBatchNorm(graph->block());
+  insertMkldnnLinear(graph);
+  // Fuse conv+relu chains first; the plain conv rewrite picks up the rest.
+  insertMkldnnConvRelu(graph);
+  insertMkldnnConv2d(graph);
+}
+
+void insertMkldnnPrePackedOps(script::Module& module) {
+  for (auto& method : module.get_methods()) {
+    auto graph = method.graph();
+    insertMkldnnPrePackedOps(graph);
+  }
+  for (script::Module m : module.children()) {
+    insertMkldnnPrePackedOps(m);
+  }
+}
+
+void prePackMkldnnOps(script::Module& module) {
+  for (auto& method : module.get_methods()) {
+    auto graph = method.graph();
+    insertMkldnnPrePackedOps(graph);
+    // Fold the weight conversion/reorder chains (which have all-constant
+    // inputs on a frozen module) into MKL-DNN tensor constants.
+    ConstantPropagation(graph);
+    // Remove the dense round trips the per-op rewrites left between
+    // adjacent MKL-DNN ops.
+    propagateMkldnnLayout(graph);
+  }
+  for (script::Module m : module.children()) {
+    prePackMkldnnOps(m);
+  }
+}
+
+#else
+
+void insertMkldnnPrePackedOps(std::shared_ptr<Graph>& graph) {
+  TORCH_INTERNAL_ASSERT(
+      "MKL-DNN is not enabled. Please build with USE_MKLDNN=1");
+}
+
+void insertMkldnnPrePackedOps(script::Module& module) {
+  TORCH_INTERNAL_ASSERT(
+      "MKL-DNN is not enabled. Please build with USE_MKLDNN=1");
+}
+
+void prePackMkldnnOps(script::Module& module) {
+  TORCH_INTERNAL_ASSERT(
+      "MKL-DNN is not enabled. Please build with USE_MKLDNN=1");
+}
+
+#endif
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Rewrites aten::linear / aten::conv2d calls whose weights are frozen
+// constants into their MKL-DNN equivalents, with the weight conversion and
+// reordering expressed as separate ops on the constant weight so constant
+// propagation folds them into pre-packed opaque tensors. Frozen inference
+// batch_norms following a conv2d are folded into the conv weights first,
+// and conv+relu chains are fused into mkldnn_convolution_relu. Run on a
+// frozen module; per-call weight packing inside MKL-DNN is eliminated.
+TORCH_API void insertMkldnnPrePackedOps(std::shared_ptr<Graph>& graph);
+TORCH_API void insertMkldnnPrePackedOps(script::Module& module);
+
+// Convenience entry point: inserts the pre-packed ops in every method of
+// the (frozen) module and constant-propagates the weight packing chains.
+// The resulting module holds MKL-DNN layout weight constants and cannot be
+// serialized; apply it to the in-memory module used for inference.
+TORCH_API void prePackMkldnnOps(script::Module& module);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,111 @@
+#include <torch/csrc/jit/passes/onnx/deduplicate_initializers.h>
+#include <torch/csrc/jit/passes/onnx/helper.h>
+
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace onnx {
+using namespace ::c10::onnx;
+}
+
+namespace {
+
+bool tensorContentsEqual(const at::Tensor& a, const at::Tensor& b) {
+  // Cheap metadata checks first; at::equal compares element-wise and
+  // requires matching dtype and device.
+  return a.scalar_type() == b.scalar_type() && a.device() == b.device() &&
+      a.sizes() == b.sizes() && at::equal(a, b);
+}
+
+// Returns the representative value for `tensor` from `seen`, inserting
+// (tensor, value) as a new representative when no existing entry has the
+// same contents.
+Value* findOrRecordTensor(
+    std::vector<std::pair<at::Tensor, Value*>>& seen,
+    const at::Tensor& tensor,
+    Value* value) {
+  for (const auto& entry : seen) {
+    if (tensorContentsEqual(entry.first, tensor)) {
+      return entry.second;
+    }
+  }
+  seen.emplace_back(tensor, value);
+  return value;
+}
+
+void eraseUnusedBlockInputs(Block* b) {
+  for (size_t i_1 = b->inputs().size(); i_1 > 0; --i_1) {
+    size_t i = i_1 - 1;
+    if (!b->inputs().at(i)->hasUses()) {
+      b->eraseInput(i);
+    }
+  }
+}
+
+} // namespace
+
+// Shrinks the exported artifact after conversion to ONNX: initializers and
+// onnx::Constant nodes with identical contents are collapsed into a single
+// copy (tracing shared or tied weights, and constant folding, both produce
+// such duplicates), and ONNX subgraphs whose outputs end up unused are
+// pruned. Like constant folding, only the root block is processed.
+void DeduplicateInitializersONNX(
+    Block* b,
+    std::map<std::string, at::Tensor>& paramDict) {
+  AT_ASSERT(b->param_node());
+  auto valsToParamsMap = buildValueToParamsMap(b, paramDict);
+
+  // Redirect uses of duplicated initializers to the first occurrence. The
+  // now-unused block inputs are erased below.
+  std::vector<std::pair<at::Tensor, Value*>> seenInitializers;
+  for (auto* input : b->inputs()) {
+    auto it = valsToParamsMap.find(input);
+    if (it == valsToParamsMap.end()) {
+      // A real graph input, not an initializer.
+      continue;
+    }
+    Value* kept =
+        findOrRecordTensor(seenInitializers, it->second.second, input);
+    if (kept != input) {
+      input->replaceAllUsesWith(kept);
+    }
+  }
+
+  // Collapse onnx::Constant nodes with identical payloads the same way.
+  std::vector<std::pair<at::Tensor, Value*>> seenConstants;
+  for (auto* node : b->nodes()) {
+    if (node->kind() != onnx::Constant || node->outputs().size() != 1 ||
+        node->mustBeNone() || !node->hasAttribute(attr::value) ||
+        node->kindOf(attr::value) != AttributeKind::t) {
+      continue;
+    }
+    Value* kept = findOrRecordTensor(
+        seenConstants, node->t(attr::value), node->output());
+    if (kept != node->output()) {
+      node->output()->replaceAllUsesWith(kept);
+    }
+  }
+
+  // Prune dead ONNX subgraphs: reverse order so that a chain feeding only a
+  // deduplicated value unravels in one sweep. ONNX ops are side-effect free.
+  auto nodes = b->nodes().reverse();
+  for (auto it = nodes.begin(); it != nodes.end(); it++) {
+    auto* node = *it;
+    if (node->kind().is_onnx() && !node->hasUses()) {
+      it.destroyCurrent();
+    }
+  }
+
+  eraseUnusedValuesFromMap(valsToParamsMap);
+  eraseUnusedBlockInputs(b);
+  paramDict.clear();
+  for (const auto& nameTensorParamPair : valsToParamsMap) {
+    paramDict.insert(nameTensorParamPair.second);
+  }
+}
+
+} // namespace jit
+} // namespace torch
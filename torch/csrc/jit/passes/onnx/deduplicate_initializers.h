@@ -0,0 +1,13 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+void DeduplicateInitializersONNX(
+    Block* b,
+    std::map<std::string, at::Tensor>& paramDict);
+
+} // namespace jit
+} // namespace torch
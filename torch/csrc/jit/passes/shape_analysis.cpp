@@ -13,9 +13,13 @@
 #include <ATen/DeviceGuard.h>
 #include <ATen/ExpandUtils.h>
 
+#include <cstdlib>
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -2080,8 +2084,364 @@ class ShapePropagator {
 };
 } // anonymous namespace
 
+namespace {
+
+// Note [Shape propagation caching]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Complete shape propagation is rerun from scratch for every input
+// specialization, even when a new spec differs from a previous one only in
+// the batch dimension. Since the propagator may fall back to actually
+// running an operator on representative tensors, this is the dominant cost
+// of per-shape recompilation for some models. When TORCH_JIT_SHAPE_CACHE=1
+// we memoize propagation results instead:
+//
+//  - Specs are bucketed by a "shape class": the graph printed with all
+//    size information erased, plus each input's rank, dtype, device,
+//    requires_grad, and the mask of size-1 dims. The ones-mask matters
+//    because broadcasting (and the expand nodes broadcastBinary inserts)
+//    branches on which dims are 1, so specs that broadcast differently
+//    must not share a class.
+//  - A spec identical to a recorded one reuses its types directly.
+//  - With two or more recorded specs in a class, a new spec is answered by
+//    deriving each result dimension either as a constant (its value agreed
+//    across all recorded specs) or as a copy of an input size/stride whose
+//    value it tracked verbatim in every recorded spec. Dimensions that are
+//    computed from the inputs (chunk remainders, view products, ...) fail
+//    both tests and force a real propagation, which then enriches the
+//    class. Classes where propagation mutated the graph structure are
+//    marked uncacheable.
+//
+// The cache only ever reproduces type assignments that full propagation
+// was observed to make for the same erased graph; a miss at any point
+// falls back to the real propagator.
+bool shapeCacheEnabled() {
+  const char* enable_c_str = std::getenv("TORCH_JIT_SHAPE_CACHE");
+  if (!enable_c_str) {
+    return false;
+  }
+  return std::string(enable_c_str) == "1";
+}
+
+struct ShapeCacheEntry {
+  // Types of the graph inputs this entry was recorded for.
+  std::vector<TypePtr> input_types;
+  // Types of every value in the graph, in traversal order, after a full
+  // propagation ran.
+  std::vector<TypePtr> value_types;
+};
+
+struct ShapeCacheClass {
+  std::vector<ShapeCacheEntry> entries;
+  // Set when propagation inserted nodes (e.g. broadcast expands); the
+  // value enumeration is then size-dependent and cannot be replayed.
+  bool uncacheable = false;
+};
+
+std::mutex shape_cache_mutex;
+std::unordered_map<std::string, ShapeCacheClass> shape_cache;
+size_t shape_cache_hits = 0;
+constexpr size_t kMaxShapeCacheClasses = 512;
+constexpr size_t kMaxShapeCacheEntriesPerClass = 8;
+
+void collectValues(Block* block, std::vector<Value*>& values) {
+  for (Value* input : block->inputs()) {
+    values.push_back(input);
+  }
+  for (Node* node : block->nodes()) {
+    for (Block* sub_block : node->blocks()) {
+      collectValues(sub_block, values);
+    }
+    for (Value* output : node->outputs()) {
+      values.push_back(output);
+    }
+  }
+}
+
+std::string shapeCacheKey(const std::shared_ptr<Graph>& graph) {
+  auto copy = graph->copy();
+  std::vector<Value*> values;
+  collectValues(copy->block(), values);
+  for (Value* v : values) {
+    v->setType(unshapedType(v->type()));
+  }
+  std::stringstream ss;
+  ss << copy->toString(/*print_source_locations=*/false);
+  for (Value* input : graph->inputs()) {
+    ss << "<";
+    if (auto tt = input->type()->cast<TensorType>()) {
+      if (tt->scalarType()) {
+        ss << *tt->scalarType();
+      }
+      ss << "/";
+      if (tt->device()) {
+        ss << *tt->device();
+      }
+      ss << "/";
+      if (tt->requiresGrad()) {
+        ss << *tt->requiresGrad();
+      }
+      ss << "/";
+      if (auto sizes = tt->sizes().concrete_sizes()) {
+        for (int64_t s : *sizes) {
+          ss << (s == 1 ? "1" : "n");
+        }
+      } else {
+        ss << "?";
+      }
+    } else {
+      ss << input->type()->str();
+    }
+    ss << ">";
+  }
+  return ss.str();
+}
+
+// Every concrete size and stride of every complete tensor input, flattened
+// in a deterministic order; result dims are matched against these.
+std::vector<int64_t> inputDimValues(const std::vector<TypePtr>& input_types) {
+  std::vector<int64_t> dims;
+  for (const TypePtr& type : input_types) {
+    auto tt = type->cast<TensorType>();
+    if (!tt) {
+      continue;
+    }
+    auto sizes = tt->sizes().concrete_sizes();
+    auto strides = tt->strides().concrete_sizes();
+    if (!sizes || !strides) {
+      continue;
+    }
+    dims.insert(dims.end(), sizes->begin(), sizes->end());
+    dims.insert(dims.end(), strides->begin(), strides->end());
+  }
+  return dims;
+}
+
+bool sameInputTypes(
+    const std::vector<TypePtr>& a,
+    const std::vector<TypePtr>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (*a[i] != *b[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Resolves one result dimension for a new spec: a constant if its value
+// agreed across all recorded entries, otherwise the value of an input
+// size/stride it tracked verbatim in every entry. Fails when neither
+// pattern holds or candidate input positions disagree on the new value.
+c10::optional<int64_t> resolveDim(
+    const std::vector<const ShapeCacheEntry*>& entries,
+    const std::vector<std::vector<int64_t>>& entry_input_dims,
+    const std::vector<int64_t>& new_input_dims,
+    const std::vector<int64_t>& entry_values) {
+  bool constant = true;
+  for (size_t k = 1; k < entry_values.size(); ++k) {
+    if (entry_values[k] != entry_values[0]) {
+      constant = false;
+      break;
+    }
+  }
+  if (constant) {
+    return entry_values[0];
+  }
+  c10::optional<int64_t> resolved;
+  for (size_t pos = 0; pos < new_input_dims.size(); ++pos) {
+    bool tracks = true;
+    for (size_t k = 0; k < entries.size(); ++k) {
+      if (entry_input_dims[k][pos] != entry_values[k]) {
+        tracks = false;
+        break;
+      }
+    }
+    if (!tracks) {
+      continue;
+    }
+    if (resolved && *resolved != new_input_dims[pos]) {
+      return c10::nullopt;
+    }
+    resolved = new_input_dims[pos];
+  }
+  return resolved;
+}
+
+bool applyCachedTypes(
+    const ShapeCacheClass& cls,
+    const std::vector<TypePtr>& input_types,
+    const std::vector<Value*>& values) {
+  std::vector<const ShapeCacheEntry*> entries;
+  for (const ShapeCacheEntry& entry : cls.entries) {
+    entries.push_back(&entry);
+  }
+
+  // Exact match: replay the recorded types directly.
+  for (const ShapeCacheEntry* entry : entries) {
+    if (sameInputTypes(entry->input_types, input_types) &&
+        entry->value_types.size() == values.size()) {
+      for (size_t i = 0; i < values.size(); ++i) {
+        values[i]->setType(entry->value_types[i]);
+      }
+      return true;
+    }
+  }
+
+  if (entries.size() < 2) {
+    return false;
+  }
+  for (const ShapeCacheEntry* entry : entries) {
+    if (entry->value_types.size() != values.size() ||
+        entry->input_types.size() != input_types.size()) {
+      return false;
+    }
+  }
+
+  std::vector<std::vector<int64_t>> entry_input_dims;
+  for (const ShapeCacheEntry* entry : entries) {
+    entry_input_dims.push_back(inputDimValues(entry->input_types));
+  }
+  std::vector<int64_t> new_input_dims = inputDimValues(input_types);
+  for (const auto& dims : entry_input_dims) {
+    if (dims.size() != new_input_dims.size()) {
+      return false;
+    }
+  }
+
+  std::vector<TypePtr> new_types;
+  new_types.reserve(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    const TypePtr& first = entries[0]->value_types[i];
+    bool all_equal = true;
+    for (const ShapeCacheEntry* entry : entries) {
+      if (*entry->value_types[i] != *first) {
+        all_equal = false;
+        break;
+      }
+    }
+    if (all_equal) {
+      new_types.push_back(first);
+      continue;
+    }
+    // Types differ across entries; they must all be complete tensors of
+    // the same rank whose dims we can resolve one by one.
+    auto first_tt = first->cast<TensorType>();
+    if (!first_tt) {
+      return false;
+    }
+    std::vector<std::vector<int64_t>> entry_sizes;
+    std::vector<std::vector<int64_t>> entry_strides;
+    for (const ShapeCacheEntry* entry : entries) {
+      auto tt = entry->value_types[i]->cast<TensorType>();
+      if (!tt || tt->scalarType() != first_tt->scalarType() ||
+          tt->device() != first_tt->device() ||
+          tt->requiresGrad() != first_tt->requiresGrad()) {
+        return false;
+      }
+      auto sizes = tt->sizes().concrete_sizes();
+      auto strides = tt->strides().concrete_sizes();
+      if (!sizes || !strides || sizes->size() != strides->size() ||
+          (!entry_sizes.empty() && sizes->size() != entry_sizes[0].size())) {
+        return false;
+      }
+      entry_sizes.push_back(std::move(*sizes));
+      entry_strides.push_back(std::move(*strides));
+    }
+    size_t ndim = entry_sizes[0].size();
+    std::vector<int64_t> new_sizes(ndim);
+    std::vector<int64_t> new_strides(ndim);
+    std::vector<int64_t> entry_values(entries.size());
+    for (size_t d = 0; d < ndim; ++d) {
+      for (size_t k = 0; k < entries.size(); ++k) {
+        entry_values[k] = entry_sizes[k][d];
+      }
+      auto resolved =
+          resolveDim(entries, entry_input_dims, new_input_dims, entry_values);
+      if (!resolved) {
+        return false;
+      }
+      new_sizes[d] = *resolved;
+      for (size_t k = 0; k < entries.size(); ++k) {
+        entry_values[k] = entry_strides[k][d];
+      }
+      resolved =
+          resolveDim(entries, entry_input_dims, new_input_dims, entry_values);
+      if (!resolved) {
+        return false;
+      }
+      new_strides[d] = *resolved;
+    }
+    new_types.push_back(first_tt->withSizesStrides(new_sizes, new_strides));
+  }
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i]->setType(new_types[i]);
+  }
+  return true;
+}
+
+} // anonymous namespace
+
 void PropagateInputShapes(const std::shared_ptr<Graph>& graph) {
+  if (!shapeCacheEnabled()) {
+    ShapePropagator(graph).PropagateShapeOnBlock(graph->block());
+    return;
+  }
+
+  // See Note [Shape propagation caching]
+  std::string key = shapeCacheKey(graph);
+  std::vector<TypePtr> input_types;
+  for (Value* input : graph->inputs()) {
+    input_types.push_back(input->type());
+  }
+  std::vector<Value*> values;
+  collectValues(graph->block(), values);
+
+  {
+    std::lock_guard<std::mutex> lock(shape_cache_mutex);
+    auto it = shape_cache.find(key);
+    if (it != shape_cache.end() && !it->second.uncacheable &&
+        applyCachedTypes(it->second, input_types, values)) {
+      ++shape_cache_hits;
+      return;
+    }
+  }
+
+  size_t num_values_before = values.size();
   ShapePropagator(graph).PropagateShapeOnBlock(graph->block());
+
+  values.clear();
+  collectValues(graph->block(), values);
+  std::lock_guard<std::mutex> lock(shape_cache_mutex);
+  auto& cls = shape_cache[key];
+  if (values.size() != num_values_before) {
+    cls.uncacheable = true;
+    cls.entries.clear();
+    return;
+  }
+  if (cls.uncacheable || shape_cache.size() > kMaxShapeCacheClasses ||
+      cls.entries.size() >= kMaxShapeCacheEntriesPerClass) {
+    return;
+  }
+  ShapeCacheEntry entry;
+  entry.input_types = std::move(input_types);
+  for (Value* v : values) {
+    entry.value_types.push_back(v->type());
+  }
+  cls.entries.push_back(std::move(entry));
+}
+
+void ClearShapePropagationCache() {
+  std::lock_guard<std::mutex> lock(shape_cache_mutex);
+  shape_cache.clear();
+  shape_cache_hits = 0;
+}
+
+size_t GetShapePropagationCacheHits() {
+  std::lock_guard<std::mutex> lock(shape_cache_mutex);
+  return shape_cache_hits;
 }
 
 namespace {
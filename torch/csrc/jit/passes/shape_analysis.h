@@ -1,6 +1,7 @@
 #pragma once
 
 #include <torch/csrc/WindowsTorchApiMacro.h>
+#include <cstddef>
 #include <memory>
 
 namespace torch {
@@ -11,5 +12,10 @@ struct Graph;
 TORCH_API void EraseShapeInformation(const std::shared_ptr<Graph>& graph);
 TORCH_API void PropagateInputShapes(const std::shared_ptr<Graph>& graph);
 
+// See Note [Shape propagation caching] in shape_analysis.cpp. The cache is
+// enabled with TORCH_JIT_SHAPE_CACHE=1; these hooks exist for tests.
+TORCH_API void ClearShapePropagationCache();
+TORCH_API size_t GetShapePropagationCacheHits();
+
 } // namespace jit
 } // namespace torch
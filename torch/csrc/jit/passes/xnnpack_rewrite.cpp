@@ -86,6 +86,156 @@ void insertPrePackedConv2dOp(std::shared_ptr<Graph>& graph) {
   rewriter.runOnGraph(graph);
 }
 
+// Folds a hardtanh following a prepacked linear/conv2d run into the
+// prepack's output_min/output_max, so the clamp happens inside the XNNPACK
+// kernel's output pass instead of as a separate NCHW op. The clamp bounds
+// must be constants: they are baked into the packed weights once
+// FoldPrePackingOps runs.
+void fuseHardtanhWithPackedOps(std::shared_ptr<Graph>& graph) {
+  std::string linear_prepack_run_hardtanh_fused = R"(
+    graph(%input, %weight, %bias, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %output_min, %output_max)
+        %res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        return (%res))";
+
+  std::string linear_prepack_run_hardtanh = R"(
+    graph(%input, %weight, %bias, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %dummy_min_max, %dummy_min_max)
+        %linear_res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        %res = aten::hardtanh(%linear_res, %output_min, %output_max)
+        return (%res))";
+
+  std::string conv2d_prepack_run_hardtanh_fused = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %output_min, %output_max)
+        %r = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        return (%r) )";
+
+  std::string conv2d_prepack_run_hardtanh = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %dummy_min_max, %dummy_min_max)
+        %conv2d_res = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        %r = aten::hardtanh(%conv2d_res, %output_min, %output_max)
+        return (%r) )";
+
+  std::string linear_prepack_run_hardtanh_inplace = R"(
+    graph(%input, %weight, %bias, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %dummy_min_max, %dummy_min_max)
+        %linear_res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        %res = aten::hardtanh_(%linear_res, %output_min, %output_max)
+        return (%res))";
+
+  std::string conv2d_prepack_run_hardtanh_inplace = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %dummy_min_max, %dummy_min_max)
+        %conv2d_res = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        %r = aten::hardtanh_(%conv2d_res, %output_min, %output_max)
+        return (%r) )";
+
+  // Only fuse when the clamp bounds are constants; non-constant bounds
+  // cannot be baked into the packed weights.
+  auto filter = [](const Match& match,
+                   const std::unordered_map<std::string, Value*>& vmap) {
+    const auto& match_vmap = match.values_map;
+    return match_vmap.at(vmap.at("output_min"))->node()->kind() ==
+        prim::Constant &&
+        match_vmap.at(vmap.at("output_max"))->node()->kind() == prim::Constant;
+  };
+
+  SubgraphRewriter rewriter;
+  rewriter.RegisterRewritePattern(
+      linear_prepack_run_hardtanh, linear_prepack_run_hardtanh_fused);
+  rewriter.RegisterRewritePattern(
+      conv2d_prepack_run_hardtanh, conv2d_prepack_run_hardtanh_fused);
+  rewriter.RegisterRewritePattern(
+      linear_prepack_run_hardtanh_inplace, linear_prepack_run_hardtanh_fused);
+  rewriter.RegisterRewritePattern(
+      conv2d_prepack_run_hardtanh_inplace, conv2d_prepack_run_hardtanh_fused);
+  rewriter.runOnGraph(graph, filter);
+}
+
+// Same as above for relu: output_min becomes 0, output_max stays unbounded.
+void fuseReluWithPackedOps(std::shared_ptr<Graph>& graph) {
+  std::string linear_prepack_run_relu_fused = R"(
+    graph(%input, %weight, %bias, %dummy_min_max):
+        %output_min: float = prim::Constant[value=0.]()
+        %output_max: None = prim::Constant()
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %output_min, %output_max)
+        %res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        return (%res))";
+
+  std::string linear_prepack_run_relu = R"(
+    graph(%input, %weight, %bias, %dummy_min_max):
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %dummy_min_max, %dummy_min_max)
+        %linear_res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        %res = aten::relu(%linear_res)
+        return (%res))";
+
+  std::string conv2d_prepack_run_relu_fused = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %dummy_min_max):
+        %output_min: float = prim::Constant[value=0.]()
+        %output_max: None = prim::Constant()
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %output_min, %output_max)
+        %r = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        return (%r) )";
+
+  std::string conv2d_prepack_run_relu = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %dummy_min_max):
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %dummy_min_max, %dummy_min_max)
+        %conv2d_res = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        %r = aten::relu(%conv2d_res)
+        return (%r) )";
+
+  std::string linear_prepack_run_relu_inplace = R"(
+    graph(%input, %weight, %bias, %dummy_min_max):
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %dummy_min_max, %dummy_min_max)
+        %linear_res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        %res = aten::relu_(%linear_res)
+        return (%res))";
+
+  std::string conv2d_prepack_run_relu_inplace = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %dummy_min_max):
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %dummy_min_max, %dummy_min_max)
+        %conv2d_res = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        %r = aten::relu_(%conv2d_res)
+        return (%r) )";
+
+  SubgraphRewriter rewriter;
+  rewriter.RegisterRewritePattern(
+      linear_prepack_run_relu, linear_prepack_run_relu_fused);
+  rewriter.RegisterRewritePattern(
+      conv2d_prepack_run_relu, conv2d_prepack_run_relu_fused);
+  rewriter.RegisterRewritePattern(
+      linear_prepack_run_relu_inplace, linear_prepack_run_relu_fused);
+  rewriter.RegisterRewritePattern(
+      conv2d_prepack_run_relu_inplace, conv2d_prepack_run_relu_fused);
+  rewriter.runOnGraph(graph);
+}
+
 } // namespace
 
 void insertPrePackedOps(std::shared_ptr<Graph>& graph) {
@@ -93,6 +243,17 @@ void insertPrePackedOps(std::shared_ptr<Graph>& graph) {
   insertPrePackedConv2dOp(graph);
 }
 
+void fusePrePackedLinearConvWithClamp(script::Module& module) {
+  for (auto& method : module.get_methods()) {
+    auto graph = method.graph();
+    fuseHardtanhWithPackedOps(graph);
+    fuseReluWithPackedOps(graph);
+  }
+  for (script::Module m : module.children()) {
+    fusePrePackedLinearConvWithClamp(m);
+  }
+}
+
 void insertPrePackedOps(script::Module& module) {
   for (auto& method : module.get_methods()) {
     auto graph = method.graph();
@@ -117,6 +278,7 @@ void optimizeForMobile(script::Module& m) {
   m = FoldConvBatchNorm2d(m);
   m = freeze_module(m);
   insertPrePackedOps(m);
+  fusePrePackedLinearConvWithClamp(m);
   FoldPrePackingOps(m);
 }
 
@@ -132,6 +294,11 @@ void insertPrePackedOps(script::Module& module) {
       "XNNPACK is not enabled. Please build with USE_XNNPACK=1");
 }
 
+void fusePrePackedLinearConvWithClamp(script::Module& module) {
+  TORCH_INTERNAL_ASSERT(
+      "XNNPACK is not enabled. Please build with USE_XNNPACK=1");
+}
+
 void FoldPrePackingOps(script::Module& m) {
   TORCH_INTERNAL_ASSERT(
       "XNNPACK is not enabled. Please build with USE_XNNPACK=1");
@@ -7,6 +7,7 @@ namespace torch {
 namespace jit {
 TORCH_API void insertPrePackedOps(std::shared_ptr<Graph>& graph);
 TORCH_API void insertPrePackedOps(script::Module& module);
+TORCH_API void fusePrePackedLinearConvWithClamp(script::Module& module);
 TORCH_API void FoldPrePackingOps(script::Module& module);
 TORCH_API void optimizeForMobile(script::Module& module);
 } // namespace jit
@@ -20,6 +20,7 @@
 #include <torch/csrc/jit/passes/freeze_module.h>
 #include <torch/csrc/jit/passes/fuse_linear.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
+#include <torch/csrc/jit/passes/fork_independent_branches.h>
 #include <torch/csrc/jit/passes/inline_fork_wait.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/passes/loop_unrolling.h>
@@ -28,6 +29,7 @@
 #include <torch/csrc/jit/passes/onnx.h>
 #include <torch/csrc/jit/passes/onnx/cast_all_constant_to_floating.h>
 #include <torch/csrc/jit/passes/onnx/constant_fold.h>
+#include <torch/csrc/jit/passes/onnx/deduplicate_initializers.h>
 #include <torch/csrc/jit/passes/onnx/fixup_onnx_conditionals.h>
 #include <torch/csrc/jit/passes/onnx/fixup_onnx_loop.h>
 #include <torch/csrc/jit/passes/onnx/peephole.h>
@@ -44,6 +46,9 @@
 #include <torch/csrc/jit/passes/subgraph_rewrite.h>
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 #include <torch/csrc/jit/passes/utils/check_alias_annotation.h>
+#include <torch/csrc/jit/passes/mkldnn_layout_propagation.h>
+#include <torch/csrc/jit/passes/mkldnn_prepack.h>
+#include <torch/csrc/jit/passes/horizontal_fusion.h>
 #include <torch/csrc/jit/passes/xnnpack_rewrite.h>
 #include <torch/csrc/jit/python/pybind_utils.h>
 #include <torch/csrc/jit/python/python_arg_flatten.h>
@@ -144,6 +149,16 @@ void initJITBindings(PyObject* module) {
             return paramsDict;
           },
           pybind11::return_value_policy::move)
+      .def(
+          "_jit_pass_onnx_deduplicate_initializers",
+          [](std::shared_ptr<Graph>& graph,
+             std::map<std::string, at::Tensor>& paramsDict) {
+            DeduplicateInitializersONNX(
+                graph->block(),
+                paramsDict); // overload resolution
+            return paramsDict;
+          },
+          pybind11::return_value_policy::move)
       .def("_jit_pass_onnx_scalar_type_analysis", ScalarTypeAnalysisForONNX)
       .def(
           "_jit_pass_onnx_prepare_inplace_ops_for_onnx",
@@ -301,6 +316,7 @@ void initJITBindings(PyObject* module) {
       .def("_jit_pass_remove_expands", RemoveExpands)
       .def("_jit_pass_erase_number_types", EraseNumberTypes)
       .def("_jit_pass_inline_fork_wait", InlineForkWait)
+      .def("_jit_pass_fork_independent_branches", ForkIndependentBranches)
       .def("_jit_pass_inline", Inline)
       .def("_jit_pass_prepare_division_for_onnx", PrepareDivisionForONNX)
       .def(
@@ -415,6 +431,13 @@ void initJITBindings(PyObject* module) {
             getBailoutDepth() = depth;
             return old_depth;
           })
+      .def(
+          "_jit_set_guard_free_streak",
+          [](size_t streak) {
+            size_t old_streak = getGuardFreeStreak();
+            getGuardFreeStreak() = streak;
+            return old_streak;
+          })
       .def(
           "_jit_set_inline_everything_mode",
           [](bool enabled) { getInlineEverythingMode() = enabled; })
@@ -488,12 +511,36 @@ void initJITBindings(PyObject* module) {
       .def(
           "_jit_pass_insert_prepacked_ops",
           [](script::Module& module) { return insertPrePackedOps(module); })
+      .def(
+          "_jit_pass_fuse_clamp_w_prepacked_linear_conv",
+          [](script::Module& module) {
+            return fusePrePackedLinearConvWithClamp(module);
+          })
       .def(
           "_jit_pass_fold_prepacking_ops",
           [](script::Module& module) { return FoldPrePackingOps(module); })
       .def(
           "_jit_pass_optimize_for_mobile",
           [](script::Module& module) { return optimizeForMobile(module); })
+      .def(
+          "_jit_pass_insert_mkldnn_prepacked_ops",
+          [](std::shared_ptr<Graph>& graph) {
+            return insertMkldnnPrePackedOps(graph);
+          })
+      .def(
+          "_jit_pass_mkldnn_prepack",
+          [](script::Module& module) { return prePackMkldnnOps(module); })
+      .def(
+          "_jit_pass_mkldnn_layout_propagation",
+          [](std::shared_ptr<Graph>& graph) {
+            return propagateMkldnnLayout(graph);
+          })
+      .def(
+          "_jit_pass_mkldnn_layout_propagation",
+          [](script::Module& module) { return propagateMkldnnLayout(module); })
+      .def(
+          "_jit_pass_horizontal_fusion",
+          [](std::shared_ptr<Graph>& graph) { return HorizontalFusion(graph); })
       .def(
           "_jit_pass_onnx_unpack_quantized_weights",
           [](std::shared_ptr<Graph>& graph,
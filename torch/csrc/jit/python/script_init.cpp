@@ -1373,7 +1373,8 @@ void initJitScriptBindings(PyObject* module) {
       std::shared_ptr<logging::LockingLogger>>(m, "LockingLogger")
       .def(py::init<>())
       .def("set_aggregation_type", &logging::LockingLogger::setAggregationType)
-      .def("get_counter_val", &logging::LockingLogger::getCounterValue);
+      .def("get_counter_val", &logging::LockingLogger::getCounterValue)
+      .def("get_counters", &logging::LockingLogger::getCounters);
   py::class_<
       logging::NoopLogger,
       logging::LoggerBase,
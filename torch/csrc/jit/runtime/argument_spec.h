@@ -17,6 +17,19 @@ namespace jit {
 // GraphExecutor creates specializations of Graphs for different
 // dimensionalitities and types of inputs.
 
+// Note [ArgumentSpec shape classes]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ArgumentSpec deliberately records only each input's shape class -- its
+// dimensionality -- and not its concrete sizes. A workload that sees
+// thousands of distinct sequence lengths therefore maps onto a single spec
+// (and a single cached ExecutionPlan) as long as rank, dtype, device, and
+// requires_grad stay stable: plans are compiled to be valid for every
+// member of the shape class, so the plan cache hit rate is independent of
+// size diversity. Exact sizes and strides are only captured by
+// CompleteArgumentSpec, which is not used as a plan cache key. When adding
+// fields to ArgumentSpec, keep them to properties that compilation
+// actually specializes on; anything finer fragments the plan cache.
+
 inline static at::Device ConvertIntToCPUOrCUDA(int device) {
   return device < 0 ? at::kCPU : at::Device(at::DeviceType::CUDA, device);
 }
@@ -41,10 +41,16 @@
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/jit/runtime/logging.h>
 
+#include <torch/csrc/jit/ir/irparser.h>
+
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -481,6 +487,96 @@ void GraphExecutorImplBase::run(Stack& stack) {
   last_executed_optimized_graph = plan.graph;
 }
 
+// Note [On-disk compilation cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Optimizing a spec from scratch can take seconds on large graphs, and the
+// work is repeated on every process start. When TORCH_JIT_COMPILE_CACHE_DIR
+// points at a writable directory, the legacy executor persists the optimized
+// graph of every compiled spec there as printed IR, and consults the
+// directory before compiling, so restarts of long-running services skip the
+// optimization pipeline for specs they have seen before.
+//
+// Execution plans themselves cannot be persisted (they hold resolved
+// operator pointers), but rebuilding a plan from an already-optimized graph
+// is cheap. Each cache entry stores a header - the specialized input graph
+// plus the spec hash - followed by the optimized IR; the header is compared
+// on load so a hash collision or a stale entry from a different model falls
+// through to normal compilation. Entries are only written when the printed
+// IR parses back successfully, so graphs containing constructs the IR
+// parser cannot reconstruct (differentiable subgraphs, fusion groups,
+// tensor constants) silently skip the cache. Corrupt or truncated files are
+// likewise rejected at parse time.
+static const char* compileCacheDir() {
+  return std::getenv("TORCH_JIT_COMPILE_CACHE_DIR");
+}
+
+static std::string compileCacheHeader(
+    const std::shared_ptr<Graph>& opt_graph,
+    const ArgumentSpec& spec) {
+  std::ostringstream header;
+  header << "# spec " << spec.hashCode() << "\n";
+  opt_graph->print(header, /*print_source_locations=*/false);
+  return header.str();
+}
+
+static std::string compileCacheFilename(
+    const char* cache_dir,
+    const std::string& header) {
+  std::ostringstream name;
+  name << cache_dir << "/" << std::hex << std::hash<std::string>()(header)
+       << ".ir";
+  return name.str();
+}
+
+static std::shared_ptr<Graph> loadCompileCache(
+    const std::string& filename,
+    const std::string& header) {
+  std::ifstream in(filename);
+  if (!in) {
+    return nullptr;
+  }
+  std::ostringstream buffer;
+  buffer << in.rdbuf();
+  const std::string contents = buffer.str();
+  if (contents.size() <= header.size() ||
+      contents.compare(0, header.size(), header) != 0) {
+    return nullptr;
+  }
+  auto graph = std::make_shared<Graph>();
+  try {
+    parseIR(contents.substr(header.size()), graph.get());
+  } catch (const std::exception&) {
+    return nullptr;
+  }
+  return graph;
+}
+
+static void saveCompileCache(
+    const std::string& filename,
+    const std::string& header,
+    const std::shared_ptr<Graph>& opt_graph) {
+  std::ostringstream body_stream;
+  opt_graph->print(body_stream, /*print_source_locations=*/false);
+  const std::string body = body_stream.str();
+  try {
+    Graph reparsed;
+    parseIR(body, &reparsed);
+  } catch (const std::exception&) {
+    return; // this graph doesn't round trip through the IR parser
+  }
+  // Write through a temporary file so a reader never sees a partial entry;
+  // concurrent writers of the same spec produce identical contents.
+  const std::string tmp_filename = filename + ".tmp";
+  {
+    std::ofstream out(tmp_filename, std::ofstream::trunc);
+    if (!out) {
+      return;
+    }
+    out << header << body;
+  }
+  std::rename(tmp_filename.c_str(), filename.c_str());
+}
+
 // a Graph can be created via tracing, or via a language-based frontend
 // GraphExecutor runs it. It can run the same graph on many different sizes
 // and different requires_grad states, and handles specializations for each
@@ -540,30 +636,58 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
             logging::runtime_counters::EXECUTION_PLAN_CACHE_HIT, 1.0);
         return it->second;
       }
+      auto compile_start = logging::timePoint();
       auto plan = compileSpec(spec);
       auto r = plan_cache.emplace(std::move(spec), std::move(plan));
       logging::getLogger()->addStatValue(
           logging::runtime_counters::EXECUTION_PLAN_CACHE_MISS, 1.0);
+      logging::getLogger()->addStatValue(
+          logging::runtime_counters::PLAN_COMPILATIONS, 1.0);
+      logging::recordDurationSince(
+          logging::runtime_counters::PLAN_COMPILE_TIME_NS, compile_start);
       return r.first->second;
     }
   }
 
+  // Phase 0. Inline functions, then clean up any artifacts that the inliner
+  //          left in that may inhibit optimization. None of this depends on
+  //          the ArgumentSpec, so it is done once and cached: rerunning the
+  //          inliner on a fresh copy of the graph used to dominate the
+  //          latency of a plan-cache miss on large models, even though every
+  //          spec produced the same result. Callers must hold compile_mutex.
+  const std::shared_ptr<Graph>& getOrCreatePreprocessedGraph() {
+    if (!preprocessed_graph) {
+      auto g = graph->copy();
+      Inline(*g);
+      LowerGradOf(*g);
+      LowerSimpleTuples(g);
+      ConstantPooling(g);
+      runRequiredPasses(g);
+      preprocessed_graph = g;
+    }
+    return preprocessed_graph;
+  }
+
   ExecutionPlan compileSpec(const ArgumentSpec& spec) {
-    auto opt_graph = graph->copy();
+    auto opt_graph = getOrCreatePreprocessedGraph()->copy();
     SOURCE_DUMP("Optimizing the following function:", opt_graph);
     arg_spec_creator_.specializeTypes(*opt_graph, spec);
 
-    // Phase 0. Inline functions, then clean up any artifacts that the inliner
-    //          left in that may inhibit optimization
-    Inline(*opt_graph);
-    LowerGradOf(*opt_graph);
-    specializeAutogradZero(*opt_graph);
-    LowerSimpleTuples(opt_graph);
-    ConstantPooling(opt_graph);
+    // See Note [On-disk compilation cache]
+    std::string cache_filename;
+    std::string cache_header;
+    if (const char* cache_dir = compileCacheDir()) {
+      cache_header = compileCacheHeader(opt_graph, spec);
+      cache_filename = compileCacheFilename(cache_dir, cache_header);
+      if (auto cached = loadCompileCache(cache_filename, cache_header)) {
+        return ExecutionPlan(cached, function_name_);
+      }
+    }
 
     // Phase 1. Specialize to input definedness (this is very important for
     //          gradient graphs), and run required passes to bring the graph
     //          to an executable form.
+    specializeAutogradZero(*opt_graph);
     runRequiredPasses(opt_graph);
 
     // Phase 2. Propagate detailed information about the spec through the
@@ -609,6 +733,9 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
     }
     // Make sure there are no leftovers from any passes.
     EliminateDeadCode(opt_graph);
+    if (!cache_filename.empty()) {
+      saveCompileCache(cache_filename, cache_header, opt_graph);
+    }
     return ExecutionPlan(opt_graph, function_name_);
   }
 
@@ -619,6 +746,11 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
   // unused). The compiled version of graph.
   ExecutionPlan fallback;
 
+  // Cached result of the spec-independent phase of compileSpec (inlining and
+  // lowering); per-spec compilation starts from a copy of this graph.
+  // Guarded by compile_mutex.
+  std::shared_ptr<Graph> preprocessed_graph;
+
   // Mapping from argument configurations to optimized versions of the graph
   // that are specialized to the spec.
   std::unordered_map<ArgumentSpec, ExecutionPlan> plan_cache;
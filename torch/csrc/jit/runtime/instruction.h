@@ -41,6 +41,7 @@ namespace jit {
   _(GET_ATTR, "S") /* get attribute from slot X in an Object */             \
   _(SET_ATTR, "S") /* set attribute to slot X in an Object */               \
   _(LIST_UNPACK, "I") /* unpack list expecting length I */                  \
+  _(TUPLE_UNPACK, "I") /* unpack tuple expecting length I */                \
   _(TUPLE_CONSTRUCT, "I") /* construct a tuple using X inputs */            \
   _(NAMED_TUPLE_CONSTRUCT,                                                  \
     "TI") /* construct a tuple of type X, using N inputs */                 \
@@ -17,9 +17,12 @@
 #include <torch/csrc/jit/runtime/graph_executor.h>
 #include <torch/csrc/jit/runtime/instruction.h>
 #include <torch/csrc/jit/runtime/jit_exception.h>
+#include <torch/csrc/jit/runtime/logging.h>
 #include <torch/csrc/jit/runtime/operator.h>
 #include <torch/csrc/jit/runtime/vararg_functions.h>
 
+#include <atomic>
+#include <cstdlib>
 #include <exception>
 #include <iostream>
 #include <memory>
@@ -343,6 +346,33 @@ struct BailoutBlock {
   std::vector<Instruction> instructions; // ends in a TAIL_CALL
 };
 
+// Note [Interpreter trace specialization]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// For small, latency-sensitive inference graphs the generic instruction loop
+// itself shows up in profiles: every operator invocation costs several
+// dispatches (LOADs for the arguments, the OP itself, STOREs for the
+// results). When TORCH_JIT_TRACE_SPECIALIZE is set, a CodeImpl that has run
+// kTraceSpecializationThreshold times and contains only straight-line code
+// (no control flow, calls, guards, or futures) is flattened into a trace of
+// steps, roughly one per operator, each carrying a pre-resolved Operation
+// pointer, the register/constant slots to push before the call, and the
+// register slots to file results into afterwards. Replaying the trace
+// performs exactly the same stack operations in the same order as the
+// instruction loop, so behavior is unchanged; it just collapses the
+// per-instruction decode into one dispatch per operator. Code with control
+// flow keeps using the generic loop.
+static bool traceSpecializationEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_JIT_TRACE_SPECIALIZE");
+    return env && std::atoi(env) != 0;
+  }();
+  return enabled;
+}
+
+// Number of executions before a CodeImpl is considered hot enough to pay for
+// building a specialized trace.
+static constexpr size_t kTraceSpecializationThreshold = 3;
+
 struct CodeImpl {
   friend struct InterpreterState;
   std::vector<Instruction> instructions_;
@@ -390,6 +420,121 @@ struct CodeImpl {
   std::vector<std::unique_ptr<Function>> bailout_functions_;
   size_t remaining_bailout_depth_;
 
+  // See Note [Interpreter trace specialization]
+  struct TraceStep {
+    enum class Input : uint8_t { LOAD, MOVE, CONST };
+    // Pre-resolved operation; nullptr for steps that only shuffle values
+    // (e.g. storing the function inputs or pushing the outputs for RET).
+    Operation* op = nullptr;
+    bool is_varargs = false;
+    uint16_t num_args = 0;
+    // pc of the last instruction folded into this step, for error reporting
+    size_t pc = 0;
+    std::vector<std::pair<Input, int32_t>> inputs;
+    std::vector<int32_t> stores; // registers, in pop order (see STOREN)
+    uint16_t drops = 0;
+    std::vector<int32_t> clears; // registers reset to IValue() (DROPR)
+  };
+  struct SpecializedTrace {
+    std::vector<TraceStep> steps;
+  };
+  std::atomic<size_t> run_count_{0};
+  std::once_flag trace_built_;
+  std::unique_ptr<SpecializedTrace> trace_;
+
+  // Returns the flattened trace once this code is hot, or nullptr if it
+  // isn't hot yet or cannot be flattened.
+  SpecializedTrace* getSpecializedTrace() {
+    if (run_count_.fetch_add(1, std::memory_order_relaxed) + 1 <
+        kTraceSpecializationThreshold) {
+      return nullptr;
+    }
+    std::call_once(trace_built_, [this] { trace_ = buildSpecializedTrace(); });
+    return trace_.get();
+  }
+
+  std::unique_ptr<SpecializedTrace> buildSpecializedTrace() {
+    // Only straight-line code can be flattened: a single RET at the end and
+    // no control flow, calls, or guards anywhere (those opcodes hit the
+    // default case below).
+    if (instructions_.empty() || instructions_.back().op != RET) {
+      return nullptr;
+    }
+    auto trace = std::make_unique<SpecializedTrace>();
+    TraceStep step;
+    // A step replays its parts in a fixed order: inputs, op, stores, drops,
+    // clears. phase tracks how far into that order the current step is; an
+    // instruction belonging to an earlier phase starts a new step, so
+    // instructions are never reordered relative to each other.
+    int phase = 0;
+    auto flush = [&]() {
+      if (step.op != nullptr || !step.inputs.empty() || !step.stores.empty() ||
+          step.drops > 0 || !step.clears.empty()) {
+        trace->steps.emplace_back(std::move(step));
+      }
+      step = TraceStep();
+      phase = 0;
+    };
+    auto advance = [&](int next_phase, size_t pc) {
+      if (next_phase < phase) {
+        flush();
+      }
+      phase = next_phase;
+      step.pc = pc;
+    };
+    for (size_t pc = 0; pc + 1 < instructions_.size(); ++pc) {
+      const Instruction& inst = instructions_[pc];
+      switch (inst.op) {
+        case LOAD:
+          advance(0, pc);
+          step.inputs.emplace_back(TraceStep::Input::LOAD, inst.X);
+          break;
+        case MOVE:
+          advance(0, pc);
+          step.inputs.emplace_back(TraceStep::Input::MOVE, inst.X);
+          break;
+        case LOADC:
+          advance(0, pc);
+          step.inputs.emplace_back(TraceStep::Input::CONST, inst.X);
+          break;
+        case OP:
+        case OPN:
+          if (step.op != nullptr) {
+            flush();
+          }
+          advance(1, pc);
+          step.op = &operator_table_[inst.X];
+          step.is_varargs = inst.op == OPN;
+          step.num_args = inst.N;
+          break;
+        case STORE:
+          advance(2, pc);
+          step.stores.push_back(inst.X);
+          break;
+        case STOREN:
+          advance(2, pc);
+          // pop order, matching the STOREN case in the instruction loop
+          for (int32_t i = inst.N; i > 0; --i) {
+            step.stores.push_back(inst.X + i - 1);
+          }
+          break;
+        case DROP:
+          advance(3, pc);
+          ++step.drops;
+          break;
+        case DROPR:
+          advance(4, pc);
+          step.clears.push_back(inst.X);
+          break;
+        default:
+          // control flow, calls, guards, etc. - keep the generic loop
+          return nullptr;
+      }
+    }
+    flush();
+    return trace;
+  }
+
   CodeImpl(
       const std::shared_ptr<Graph>& graph,
       std::string function_name,
@@ -709,6 +854,11 @@ struct CodeImpl {
     insertInstruction(LIST_UNPACK, node->outputs().size());
   }
 
+  void emitTupleUnpack(Node* node) {
+    emitLoadInputs(node->inputs());
+    insertInstruction(TUPLE_UNPACK, node->outputs().size());
+  }
+
   void emitTupleConstruct(Node* node) {
     bool named =
         node->output()->type()->expect<TupleType>()->name().has_value();
@@ -805,6 +955,9 @@ struct CodeImpl {
       case prim::ListUnpack:
         emitListUnpack(node);
         break;
+      case prim::TupleUnpack:
+        emitTupleUnpack(node);
+        break;
       case prim::TupleConstruct:
         emitTupleConstruct(node);
         break;
@@ -989,6 +1142,47 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     *af = ActiveFrame(frames.back());
   }
 
+  // Replays a flattened trace; performs the same stack operations in the
+  // same order as the instruction loop would.
+  // See Note [Interpreter trace specialization]
+  void runTrace(
+      Stack& stack,
+      ActiveFrame& af,
+      const CodeImpl::SpecializedTrace& trace) {
+    for (const auto& step : trace.steps) {
+      // keep the pc roughly current so errors still format a stack trace
+      af.pc = step.pc;
+      for (const auto& input : step.inputs) {
+        switch (input.first) {
+          case CodeImpl::TraceStep::Input::LOAD:
+            stack.emplace_back(reg(input.second));
+            break;
+          case CodeImpl::TraceStep::Input::MOVE:
+            stack.emplace_back(std::move(reg(input.second)));
+            break;
+          case CodeImpl::TraceStep::Input::CONST:
+            stack.emplace_back(af.constants[input.second]);
+            break;
+        }
+      }
+      if (step.op != nullptr) {
+        if (step.is_varargs) {
+          stack.push_back(step.num_args);
+        }
+        (*step.op)(stack);
+      }
+      for (int32_t r : step.stores) {
+        reg(r) = pop(stack);
+      }
+      for (uint16_t i = 0; i < step.drops; ++i) {
+        pop(stack);
+      }
+      for (int32_t r : step.clears) {
+        reg(r) = IValue();
+      }
+    }
+  }
+
   bool runImpl(Stack& stack) {
     // if we have never run before, then we might have to return the
     // stack when we suspend, record where it starts so we return the right
@@ -1004,6 +1198,22 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 
     ActiveFrame af(frames.back());
     try {
+      if (traceSpecializationEnabled() && frames.size() == 1 && af.pc == 0) {
+        if (auto* trace = frames.back().function->getSpecializedTrace()) {
+          runTrace(stack, af, *trace);
+          // the flattened trace ends in RET; complete as the RET case does
+          if (future_) {
+            auto num_outputs = frames.back().function->n_outputs;
+            if (num_outputs == 1) {
+              future_->markCompleted(stack.back());
+            } else {
+              future_->markCompleted(c10::ivalue::Tuple::create(
+                  jit::last(stack, num_outputs).vec()));
+            }
+          }
+          return false;
+        }
+      }
       while (true) {
         // std::cout << "RUNNING ";
         // frames.back().function->dump(std::cout, af.pc);
@@ -1200,6 +1410,20 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
               const TypePtr& expected = af.types[inst.X];
               bool comp = expected->cast<TensorType>()
                               ->isCompatibleWithInCurrentExecutionContext(t);
+              if (!comp) {
+                logging::getLogger()->addStatValue(
+                    logging::runtime_counters::GUARD_FAILURES, 1.0);
+                // Attribute the failure to the guard's BailOut node so a
+                // single hot guard can be found in the stats.
+                Node* source =
+                    frames.back().function->instructions_source_[af.pc];
+                if (source && source->hasAttribute(attr::index)) {
+                  logging::getLogger()->addStatValue(
+                      std::string(logging::runtime_counters::GUARD_FAILURES) +
+                          ".bailout_" + c10::to_string(source->i(attr::index)),
+                      1.0);
+                }
+              }
               push(stack, comp);
             }
             ++af.pc;
@@ -1211,6 +1435,13 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
                 frames.back().function->remaining_bailout_depth_ > 0
                 ? frames.back().function->remaining_bailout_depth_ - 1
                 : 0;
+            // TAIL_CALL is only emitted for taken bailouts, so this counts
+            // every bailout transfer along with how much depth is left.
+            logging::getLogger()->addStatValue(
+                logging::runtime_counters::BAILOUTS_TRIGGERED, 1.0);
+            logging::getLogger()->addStatValue(
+                logging::runtime_counters::BAILOUT_REMAINING_DEPTH,
+                remaining_bailout_depth);
             const Code& code = af.functions[inst.X]
                                    ->get_executor()
                                    .getPlanFor(stack, remaining_bailout_depth)
@@ -1232,6 +1463,10 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             listUnpack(stack, inst.X);
             ++af.pc;
           } break;
+          case TUPLE_UNPACK: {
+            tupleUnpack(stack, inst.X);
+            ++af.pc;
+          } break;
           case TUPLE_CONSTRUCT: {
             tupleConstruct(stack, inst.X);
             ++af.pc;
@@ -36,6 +36,20 @@ int64_t LockingLogger::getCounterValue(const std::string& name) const {
   throw std::runtime_error("Unknown aggregation type!");
 }
 
+std::unordered_map<std::string, int64_t> LockingLogger::getCounters() const {
+  std::unordered_map<std::string, int64_t> result;
+  std::unique_lock<std::mutex> lk(m);
+  for (const auto& entry : raw_counters) {
+    AggregationType type = agg_types.count(entry.first)
+        ? agg_types.at(entry.first)
+        : AggregationType::SUM;
+    result[entry.first] = type == AggregationType::AVG
+        ? entry.second.sum / static_cast<int64_t>(entry.second.count)
+        : entry.second.sum;
+  }
+  return result;
+}
+
 void LockingLogger::setAggregationType(
     const std::string& stat_name,
     AggregationType type) {
@@ -40,6 +40,10 @@ class TORCH_API LockingLogger : public LoggerBase {
  public:
   void addStatValue(const std::string& stat_name, int64_t val) override;
   virtual int64_t getCounterValue(const std::string& name) const;
+  // Snapshot of every counter seen so far, aggregated according to its
+  // aggregation type. This is the export surface for runtime stats
+  // scrapers; one lock acquisition for the whole map.
+  virtual std::unordered_map<std::string, int64_t> getCounters() const;
   enum class AggregationType { SUM, AVG };
   void setAggregationType(const std::string& stat_name, AggregationType type);
   ~LockingLogger() {}
@@ -72,12 +76,32 @@ constexpr const char* EXECUTION_PLAN_CACHE_HIT =
     "pytorch_runtime.execution_plan_cache_hit";
 constexpr const char* EXECUTION_PLAN_CACHE_MISS =
     "pytorch_runtime.execution_plan_cache_miss";
+constexpr const char* PLAN_COMPILATIONS = "pytorch_runtime.plan_compilations";
+// Wall time of each compilation, in nanoseconds. Set the aggregation type
+// to AVG for mean compile latency, or leave SUM for total time spent
+// compiling.
+constexpr const char* PLAN_COMPILE_TIME_NS =
+    "pytorch_runtime.plan_compile_time_ns";
+constexpr const char* GUARD_FAILURES = "pytorch_runtime.guard_failures";
+// Per-guard failure counts appear as GUARD_FAILURES plus a
+// ".bailout_<index>" suffix identifying the prim::BailOut node.
+constexpr const char* BAILOUTS_TRIGGERED =
+    "pytorch_runtime.bailouts_triggered";
+// remaining_bailout_depth at each taken bailout; AVG shows how deep the
+// bailout chains actually get.
+constexpr const char* BAILOUT_REMAINING_DEPTH =
+    "pytorch_runtime.bailout_remaining_depth";
 
 inline std::vector<const char*> allRuntimeCounters() {
   return {GRAPH_EXECUTORS_CONSTRUCTED,
           GRAPH_EXECUTOR_INVOCATIONS,
           EXECUTION_PLAN_CACHE_HIT,
-          EXECUTION_PLAN_CACHE_MISS};
+          EXECUTION_PLAN_CACHE_MISS,
+          PLAN_COMPILATIONS,
+          PLAN_COMPILE_TIME_NS,
+          GUARD_FAILURES,
+          BAILOUTS_TRIGGERED,
+          BAILOUT_REMAINING_DEPTH};
 }
 
 } // namespace runtime_counters
@@ -20,6 +20,7 @@
 #include <torch/csrc/jit/passes/requires_grad_analysis.h>
 #include <torch/csrc/jit/passes/shape_analysis.h>
 #include <torch/csrc/jit/passes/specialize_autogradzero.h>
+#include <torch/csrc/jit/runtime/logging.h>
 
 namespace torch {
 namespace jit {
@@ -34,6 +35,8 @@ static std::atomic<bool> profiling_mode{true};
 
 static std::atomic<size_t> num_profiled_runs{1};
 static std::atomic<size_t> bailout_depth{1};
+// See Note [Guard-free execution tier]; 0 disables the tier.
+static std::atomic<size_t> guard_free_streak{0};
 
 std::atomic<bool>& getProfilingMode() {
   return profiling_mode;
@@ -50,6 +53,10 @@ std::atomic<size_t>& getBailoutDepth() {
   return bailout_depth;
 }
 
+std::atomic<size_t>& getGuardFreeStreak() {
+  return guard_free_streak;
+}
+
 static bool needsGradientInProfilingMode(Block* b) {
   for (auto n : b->nodes()) {
     if (n->kind() == prim::BailOut) {
@@ -88,7 +95,8 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
   ConstantPropagation(copy);
   runOptimization(copy);
 
-  if (needsGradientInProfilingMode(copy->block())) {
+  optimized_needs_gradient_ = needsGradientInProfilingMode(copy->block());
+  if (optimized_needs_gradient_) {
     auto diff_nodes = CreateAutodiffSubgraphs(
         copy,
         getAutodiffSubgraphInlining() ? autodiffSubgraphNodeThreshold : 1);
@@ -111,6 +119,52 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
   GRAPH_DUMP("Optimized Graph : ", copy);
 }
 
+// Note [Guard-free execution tier]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// prim::Guard checks re-verify the profiled tensor properties on every
+// single run, long after the workload has stabilized. When
+// getGuardFreeStreak() is non-zero and the inputs have matched the same
+// CompleteArgumentSpec for that many consecutive runs, we compile a second
+// plan in which every guard is replaced by its profiled type assumption,
+// and choose between the two plans with a single spec comparison at entry.
+// Shapes of intermediates are deterministic functions of the input shapes
+// for the ops the profiler instruments, so the entry check subsumes the
+// in-body guards; a run with different inputs simply takes the regular
+// guarded plan, whose bailout machinery stays intact. The tier is
+// restricted to graphs that do not need gradients.
+static void removeGuards(Block* block) {
+  for (auto it = block->nodes().begin(); it != block->nodes().end();) {
+    Node* n = *it;
+    ++it;
+    for (Block* ib : n->blocks()) {
+      removeGuards(ib);
+    }
+    if (n->kind() == prim::Guard) {
+      n->input()->setType(n->output()->type());
+      n->output()->replaceAllUsesWith(n->input());
+      n->destroy();
+    }
+  }
+}
+
+void ProfilingGraphExecutorImpl::runGuardFreeOptimizations(
+    std::shared_ptr<Graph>& copy) {
+  InsertGuards(copy);
+  LowerGradOf(*copy);
+  EliminateRedundantGuards(copy);
+  removeGuards(copy->block());
+  GRAPH_DUMP("After removeGuards: ", copy);
+  specializeAutogradZero(*copy);
+
+  runRequiredPasses(copy);
+  PeepholeOptimize(copy);
+  ConstantPropagation(copy);
+  runOptimization(copy);
+  runNondiffOptimization(copy, true);
+  EliminateDeadCode(copy);
+  GRAPH_DUMP("Guard-free Graph : ", copy);
+}
+
 void ProfilingGraphExecutorImpl::runProfilingInsensitiveOptimizations(
     std::shared_ptr<Graph>& copy) {
   LowerGradOf(*copy);
@@ -147,39 +201,93 @@ ExecutionPlan ProfilingGraphExecutorImpl::getPlanFor(
   GRAPH_DEBUG("Running ProfilingGraphExecutorImpl ", this);
 
   if (optimized_plan_) {
+    logging::getLogger()->addStatValue(
+        logging::runtime_counters::EXECUTION_PLAN_CACHE_HIT, 1.0);
+    // See Note [Guard-free execution tier]
+    size_t streak = getGuardFreeStreak();
+    if (streak == 0 || optimized_needs_gradient_ || !pr_ || !pr_->ready()) {
+      return *optimized_plan_;
+    }
+    CompleteArgumentSpec spec(
+        autograd::GradMode::is_enabled(), last(stack, num_inputs));
+    if (guard_free_plan_) {
+      if (expected_spec_ && spec == *expected_spec_) {
+        return *guard_free_plan_;
+      }
+      return *optimized_plan_;
+    }
+    if (expected_spec_ && spec == *expected_spec_) {
+      if (++spec_streak_ >= streak) {
+        auto compile_start = logging::timePoint();
+        auto copy = pr_->graph()->copy();
+        runGuardFreeOptimizations(copy);
+        guard_free_plan_ = ExecutionPlan(copy, function_name_);
+        logging::getLogger()->addStatValue(
+            logging::runtime_counters::PLAN_COMPILATIONS, 1.0);
+        logging::recordDurationSince(
+            logging::runtime_counters::PLAN_COMPILE_TIME_NS, compile_start);
+        return *guard_free_plan_;
+      }
+    } else {
+      expected_spec_ = spec;
+      spec_streak_ = 1;
+    }
     return *optimized_plan_;
   }
 
   // simple executor
   if (remaining_bailout_depth == 0) {
+    auto compile_start = logging::timePoint();
     auto copy = graph->copy();
     runProfilingInsensitiveOptimizations(copy);
     GRAPH_DUMP("Optimized SimpleExecutor Graph : ", copy);
     optimized_plan_ = ExecutionPlan(copy, function_name_);
+    logging::getLogger()->addStatValue(
+        logging::runtime_counters::EXECUTION_PLAN_CACHE_MISS, 1.0);
+    logging::getLogger()->addStatValue(
+        logging::runtime_counters::PLAN_COMPILATIONS, 1.0);
+    logging::recordDurationSince(
+        logging::runtime_counters::PLAN_COMPILE_TIME_NS, compile_start);
     return *optimized_plan_;
   }
 
   // if a profiling graph hasn't been created yet
   if (!pr_) {
+    auto compile_start = logging::timePoint();
     auto copy = graph->copy();
     runProfilingInsensitiveOptimizations(copy);
     pr_ = ProfilingRecord::instrumentGraph(copy);
     auto pr_copy = pr_->graph()->copy();
     GRAPH_DUMP("Profiled Graph: ", pr_copy);
     profiling_plan_ = ExecutionPlan(pr_copy, function_name_);
+    logging::getLogger()->addStatValue(
+        logging::runtime_counters::EXECUTION_PLAN_CACHE_MISS, 1.0);
+    logging::getLogger()->addStatValue(
+        logging::runtime_counters::PLAN_COMPILATIONS, 1.0);
+    logging::recordDurationSince(
+        logging::runtime_counters::PLAN_COMPILE_TIME_NS, compile_start);
     // fall-through
   }
 
   // profile until a graph is ready
   if (!pr_->ready()) {
+    logging::getLogger()->addStatValue(
+        logging::runtime_counters::EXECUTION_PLAN_CACHE_HIT, 1.0);
     return *profiling_plan_;
   }
 
+  auto compile_start = logging::timePoint();
   auto copy = pr_->graph()->copy();
   runProfilingOptimizations(copy);
   // cache
   optimized_plan_ =
       ExecutionPlan(copy, function_name_, remaining_bailout_depth);
+  logging::getLogger()->addStatValue(
+      logging::runtime_counters::EXECUTION_PLAN_CACHE_MISS, 1.0);
+  logging::getLogger()->addStatValue(
+      logging::runtime_counters::PLAN_COMPILATIONS, 1.0);
+  logging::recordDurationSince(
+      logging::runtime_counters::PLAN_COMPILE_TIME_NS, compile_start);
   return *optimized_plan_;
 }
 
@@ -17,10 +17,16 @@ struct ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
  private:
   void runProfilingInsensitiveOptimizations(std::shared_ptr<Graph>& graph);
   void runProfilingOptimizations(std::shared_ptr<Graph>& graph);
+  void runGuardFreeOptimizations(std::shared_ptr<Graph>& graph);
   std::unique_ptr<ProfilingRecord> pr_;
   c10::optional<ExecutionPlan>
       profiling_plan_; // plan to run in order to profiling the code
   c10::optional<ExecutionPlan> optimized_plan_;
+  // See Note [Guard-free execution tier]
+  c10::optional<ExecutionPlan> guard_free_plan_;
+  c10::optional<CompleteArgumentSpec> expected_spec_;
+  size_t spec_streak_ = 0;
+  bool optimized_needs_gradient_ = false;
 };
 
 } // namespace jit
@@ -81,6 +81,33 @@ void ProfilingRecord::insertShapeProfile(Node* n, Value* i) {
   n->replaceInputWith(i, pn->output());
 }
 
+// Records the trip counts a loop actually runs with. If every profiling run
+// sees the same count, it is stored on the loop node as
+// attr::profiled_trip_count, which UnrollLoops uses to emit a fully unrolled
+// version guarded by a runtime check on the count; a varying count is
+// recorded as -1 and ignored. The profile node has no outputs, so guard
+// insertion leaves it alone and removeProfilingNodes cleans it up.
+void ProfilingRecord::insertTripCountProfile(Node* n) {
+  Value* trip_count = n->inputs().at(0);
+  if (trip_count->node()->kind() == prim::Constant) {
+    // constant-length loops are unrolled directly, no need to profile
+    return;
+  }
+
+  std::function<void(Stack&)> trip_count_profiler = [this, n](Stack& stack) {
+    int64_t count = pop(stack).toInt();
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    if (!n->hasAttribute(attr::profiled_trip_count)) {
+      n->i_(attr::profiled_trip_count, count);
+    } else if (n->i(attr::profiled_trip_count) != count) {
+      n->i_(attr::profiled_trip_count, -1);
+    }
+  };
+
+  auto pn = createProfileNode(trip_count_profiler, {trip_count});
+  pn->insertBefore(n);
+}
+
 void ProfilingRecord::instrumentBlock(Block* block) {
   for (auto it = block->nodes().begin(); it != block->nodes().end(); ++it) {
     auto n = *it;
@@ -93,6 +120,10 @@ void ProfilingRecord::instrumentBlock(Block* block) {
       insertShapeProfile(n, i);
     }
 
+    if (n->kind() == prim::Loop) {
+      insertTripCountProfile(n);
+    }
+
     for (auto b : n->blocks()) {
       instrumentBlock(b);
     }
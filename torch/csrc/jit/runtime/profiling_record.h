@@ -40,6 +40,7 @@ struct ProfilingRecord {
       at::ArrayRef<Value*> inputs);
   void instrumentBlock(Block* block);
   void insertShapeProfile(Node* n, Value* i);
+  void insertTripCountProfile(Node* n);
   ProfilingRecord(std::shared_ptr<Graph> g);
 };
 
@@ -14,7 +14,10 @@ namespace {
 // TODO This currently only handles tensors with requires_grad==False correctly.
 //      It should also handle autograd.
 Operator createOperatorFromC10(const c10::OperatorHandle& op) {
-  return Operator(op, [op](Stack& stack) {
+  // shared_ptr because the stack function is copied around; the cached
+  // handle itself must persist for its kernel table cache to pay off
+  auto cached = std::make_shared<c10::CachedOperatorHandle>(op);
+  return Operator(op, [op, cached](Stack& stack) {
     RECORD_FUNCTION(op.schema().name(), stack);
     const auto input_size = op.schema().arguments().size();
     const auto output_size = op.schema().returns().size();
@@ -112,10 +115,10 @@ Operator createOperatorFromC10(const c10::OperatorHandle& op) {
 #ifdef USE_STATIC_DISPATCH
     {
       at::AutoNonVariableTypeMode non_var_type_mode(true);
-      c10::Dispatcher::singleton().callBoxed(op, &stack);
+      cached->callBoxed(&stack);
     }
 #else
-      c10::Dispatcher::singleton().callBoxed(op, &stack);
+      cached->callBoxed(&stack);
 #endif // USE_STATIC_DISPATCH
 
     if (tracer_state) {
@@ -8,6 +8,17 @@ void tupleUnpack(Stack& stack) {
   stack.insert(stack.end(), tuple->elements().begin(), tuple->elements().end());
 }
 
+void tupleUnpack(Stack& stack, size_t num_outputs) {
+  auto tuple = pop(stack).toTuple();
+  TORCH_CHECK(
+      tuple->elements().size() == num_outputs,
+      "Expected ",
+      num_outputs,
+      " elements in a tuple but found ",
+      tuple->elements().size());
+  stack.insert(stack.end(), tuple->elements().begin(), tuple->elements().end());
+}
+
 void format(Stack& stack, size_t num_inputs) {
   // static const std::regex unsupported_options("\\{(.*?)\\}");
   auto format = peek(stack, 0, num_inputs).toStringRef();
@@ -9,6 +9,8 @@ namespace jit {
 
 void tupleUnpack(Stack& stack);
 
+void tupleUnpack(Stack& stack, size_t num_outputs);
+
 void format(Stack& stack, size_t num_inputs);
 
 void listUnpack(Stack& stack, size_t num_outputs);
@@ -6,6 +6,7 @@
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/onnx/onnx.h>
 
+#include <future>
 #include <ostream>
 
 namespace torch {
@@ -71,6 +72,24 @@ TORCH_API void ExportModule(
     const ExtraFilesMap& metadata = ExtraFilesMap(),
     bool bytecode_format = false);
 
+// Asynchronous checkpointing: the module is serialized into an in-memory
+// buffer on the calling thread (the snapshot), and the buffer is written
+// to `filename` on a background thread, so a training loop resumes as
+// soon as the snapshot is taken instead of stalling on disk I/O.
+//
+// The buffer owns a copy of all tensor payloads, so in-place parameter
+// updates after this returns do not race with the write. The module must
+// not be structurally modified (attributes added/removed, methods
+// recompiled) while the snapshot is being taken on the calling thread.
+// The returned future completes when the file is fully written and
+// rethrows any write error from get(). Holding the snapshot costs one
+// serialized copy of the model until the write finishes.
+TORCH_API std::future<void> ExportModuleAsync(
+    const Module& module,
+    const std::string& filename,
+    const ExtraFilesMap& metadata = ExtraFilesMap(),
+    bool bytecode_format = false);
+
 // Write the bytes of a pickle archive and the tensors referenced inside that
 // archive
 TORCH_API void writeArchiveAndTensors(
@@ -11,8 +11,14 @@
 #include <caffe2/serialize/inline_container.h>
 
 #include <ATen/ATen.h>
+#include <ATen/Parallel.h>
 
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace torch {
@@ -39,6 +45,75 @@ static IValue Table(
   return Tup(std::move(ivalue_entries));
 }
 
+// Export-time peephole over the bytecode stream. The server Code emitter
+// leans on register shuffles that are pure bookkeeping for the lite
+// interpreter, so we compact what can be proven dead here, at export, and
+// ship fewer instructions instead of making the interpreter smarter.
+//
+// Removed pairs (only when no jump targets either instruction):
+//   STORE r; MOVE r  — pops into r and immediately pushes it back out.
+//                      A stack identity, and r is dead afterwards: MOVE is
+//                      only emitted for a register's last use.
+//   LOAD r; DROP     — pushes a register copy and discards it.
+// Relative jump offsets (JF/JMP/LOOP) crossing a removed pair are
+// retargeted; fall-through into a removed pair needs no fixup since the
+// pair was a no-op.
+void compactInstructions(std::vector<Instruction>& instructions) {
+  const auto is_jump = [](OpCode op) {
+    return op == JF || op == JMP || op == LOOP;
+  };
+
+  std::vector<bool> is_target(instructions.size(), false);
+  for (size_t i = 0; i < instructions.size(); ++i) {
+    if (is_jump(instructions[i].op)) {
+      const int64_t target = static_cast<int64_t>(i) + instructions[i].X;
+      if (target >= 0 && target < static_cast<int64_t>(instructions.size())) {
+        is_target[target] = true;
+      }
+    }
+  }
+
+  std::vector<bool> remove(instructions.size(), false);
+  for (size_t i = 0; i + 1 < instructions.size(); ++i) {
+    if (is_target[i] || is_target[i + 1]) {
+      continue;
+    }
+    const Instruction& a = instructions[i];
+    const Instruction& b = instructions[i + 1];
+    const bool store_move = a.op == STORE && b.op == MOVE && a.X == b.X;
+    const bool load_drop = a.op == LOAD && b.op == DROP;
+    if (store_move || load_drop) {
+      remove[i] = remove[i + 1] = true;
+      ++i; // pairs must not overlap
+    }
+  }
+
+  std::vector<int32_t> new_index(instructions.size(), 0);
+  int32_t kept = 0;
+  for (size_t i = 0; i < instructions.size(); ++i) {
+    new_index[i] = kept;
+    if (!remove[i]) {
+      ++kept;
+    }
+  }
+
+  std::vector<Instruction> compacted;
+  compacted.reserve(kept);
+  for (size_t i = 0; i < instructions.size(); ++i) {
+    if (remove[i]) {
+      continue;
+    }
+    Instruction ins = instructions[i];
+    if (is_jump(ins.op)) {
+      // Jump targets are never removed (see is_target above).
+      const int64_t target = static_cast<int64_t>(i) + ins.X;
+      ins.X = new_index[target] - new_index[i];
+    }
+    compacted.push_back(ins);
+  }
+  instructions.swap(compacted);
+}
+
 c10::IValue getFunctionTuple(const Function& func) {
   auto graph = func.graph()->copy();
   Inline(*graph);
@@ -78,6 +153,91 @@ c10::IValue getFunctionTuple(const Function& func) {
     }
   }
 
+  compactInstructions(instructions_copy);
+
+  // Deduplicate the operator table, rewriting OP/OPN indices. A model that
+  // calls aten::add fifty times then carries one table entry (and the
+  // mobile loader resolves one dispatch target) instead of fifty.
+  std::vector<c10::OperatorName> deduped_opnames;
+  std::unordered_map<std::string, int32_t> opname_to_index;
+  size_t op_occurrence = 0;
+  for (auto& ins : instructions_copy) {
+    if (ins.op != OP && ins.op != OPN) {
+      continue;
+    }
+    // opnames was collected one entry per OP/OPN occurrence above, which
+    // is also how the table was serialized before deduplication existed.
+    const auto& opname = opnames.at(op_occurrence++);
+    const auto key = opname.name + "." + opname.overload_name;
+    auto it = opname_to_index.find(key);
+    if (it == opname_to_index.end()) {
+      it = opname_to_index
+               .emplace(key, static_cast<int32_t>(deduped_opnames.size()))
+               .first;
+      deduped_opnames.push_back(opname);
+    }
+    ins.X = it->second;
+  }
+
+  // constants
+  //
+  // Make a copy of the constants and append the method names
+  // that we emitted for the converted INTERFACE_CALL nodes above.
+  auto constants = code.constant_table();
+  for (auto& method_name : method_names) {
+    constants.emplace_back(std::move(method_name));
+  }
+
+  // Deduplicate primitive constants, rewriting LOADC and INTERFACE_CALL
+  // indices. Containers and tensors are left alone: their equality is
+  // identity-sensitive. Doubles compare bit-exact so -0.0 and 0.0 stay
+  // distinct.
+  const auto is_simple_constant = [](const IValue& v) {
+    return v.isInt() || v.isDouble() || v.isBool() || v.isString() ||
+        v.isNone();
+  };
+  const auto same_constant = [](const IValue& a, const IValue& b) {
+    if (a.isInt() && b.isInt()) {
+      return a.toInt() == b.toInt();
+    }
+    if (a.isDouble() && b.isDouble()) {
+      const double x = a.toDouble();
+      const double y = b.toDouble();
+      return std::memcmp(&x, &y, sizeof(double)) == 0;
+    }
+    if (a.isBool() && b.isBool()) {
+      return a.toBool() == b.toBool();
+    }
+    if (a.isString() && b.isString()) {
+      return a.toStringRef() == b.toStringRef();
+    }
+    return a.isNone() && b.isNone();
+  };
+  std::vector<IValue> deduped_constants;
+  std::vector<int32_t> constant_remap(constants.size());
+  for (size_t i = 0; i < constants.size(); ++i) {
+    int32_t found = -1;
+    if (is_simple_constant(constants[i])) {
+      for (size_t j = 0; j < deduped_constants.size(); ++j) {
+        if (same_constant(constants[i], deduped_constants[j])) {
+          found = static_cast<int32_t>(j);
+          break;
+        }
+      }
+    }
+    if (found == -1) {
+      found = static_cast<int32_t>(deduped_constants.size());
+      deduped_constants.push_back(constants[i]);
+    }
+    constant_remap[i] = found;
+  }
+  for (auto& ins : instructions_copy) {
+    if (ins.op == LOADC || ins.op == INTERFACE_CALL) {
+      ins.X = constant_remap.at(ins.X);
+    }
+  }
+  constants.swap(deduped_constants);
+
   // instructions
   std::vector<IValue> instructions;
   instructions.reserve(instructions_copy.size());
@@ -87,20 +247,11 @@ c10::IValue getFunctionTuple(const Function& func) {
 
   // operators
   std::vector<IValue> operators;
-  operators.reserve(opnames.size());
-  for (const auto& opname : opnames) {
+  operators.reserve(deduped_opnames.size());
+  for (const auto& opname : deduped_opnames) {
     operators.emplace_back(Tup({opname.name, opname.overload_name}));
   }
 
-  // constants
-  //
-  // Make a copy of the constants and append the method names
-  // that we emitted for the converted INTERFACE_CALL nodes above.
-  auto constants = code.constant_table();
-  for (auto& method_name : method_names) {
-    constants.emplace_back(std::move(method_name));
-  }
-
   // types
   std::vector<IValue> types;
   types.reserve(code.type_table().size());
@@ -332,5 +483,46 @@ void ExportModule(
   serializer.serialize(module, extra_files, bytecode_format);
 }
 
+std::future<void> ExportModuleAsync(
+    const Module& module,
+    const std::string& filename,
+    const ExtraFilesMap& extra_files,
+    bool bytecode_format) {
+  // Snapshot phase, on the calling thread: serialize into memory. The
+  // buffer owns a copy of every tensor payload, so the caller can keep
+  // updating parameters in place while the write is in flight. This is
+  // the expensive-but-fast part (pickling plus one memcpy of the
+  // weights); the slow part, disk I/O, is deferred below.
+  auto buffer = std::make_shared<std::vector<char>>();
+  ScriptModuleSerializer serializer(
+      [&buffer](const void* buf, size_t nbytes) -> size_t {
+        const char* data = static_cast<const char*>(buf);
+        buffer->insert(buffer->end(), data, data + nbytes);
+        return nbytes;
+      });
+  serializer.serialize(module, extra_files, bytecode_format);
+
+  // Write phase, on a background thread.
+  auto promise = std::make_shared<std::promise<void>>();
+  auto future = promise->get_future();
+  at::launch([buffer, promise, filename]() {
+    try {
+      std::ofstream out(
+          filename,
+          std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+      out.write(buffer->data(), buffer->size());
+      out.close();
+      if (!out) {
+        throw std::runtime_error(
+            "writing checkpoint to " + filename + " failed");
+      }
+      promise->set_value();
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  });
+  return future;
+}
+
 } // namespace jit
 } // namespace torch
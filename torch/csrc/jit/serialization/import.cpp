@@ -17,9 +17,14 @@
 #include "caffe2/serialize/istream_adapter.h"
 
 #include <ATen/ATen.h>
+#include <ATen/Parallel.h>
 
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <unordered_map>
 #include <vector>
 
@@ -54,12 +59,33 @@ void postSetStateValidate(const IValue& v) {
   }
 }
 
+// Note [Lazy submodule materialization]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The whole module hierarchy is pickled into a single data.pkl stream, so
+// the object graph itself cannot be partially unpickled. What dominates
+// load time and memory, though, are the tensor payload records. When a
+// caller asks for one submodule (load(filename, submodule_path, device)),
+// we unpickle the graph with read_record returning empty DataPtrs whose
+// context holds the record key instead of reading the payloads, walk to
+// the requested submodule, and then fetch records only for storages
+// reachable from it (in parallel, like the eager prefetch above). The
+// rest of the graph is dropped without its payloads ever being read.
+//
+// Classes with a __setstate__ may compute on their input tensors during
+// unpickling (packed quantized weights do), so __setstate__ inputs are
+// materialized eagerly and never stay lazy.
+
+static void deleteLazyRecordKey(void* ctx) {
+  delete static_cast<std::string*>(ctx);
+}
+
 IValue readArchiveAndTensors(
     const std::string& archive_name,
     c10::optional<TypeResolver> type_resolver,
     c10::optional<ObjLoader> obj_loader,
     c10::optional<at::Device> device,
-    PyTorchStreamReader& stream_reader) {
+    PyTorchStreamReader& stream_reader,
+    bool lazy_tensors) {
   std::string picklename = archive_name + ".pkl";
   at::DataPtr pickle_ptr;
   size_t pickle_size;
@@ -80,8 +106,61 @@ IValue readArchiveAndTensors(
   };
 
   std::string archive_name_plus_slash = archive_name + "/";
+
+  // Read all tensor records of this archive up front, in parallel. The
+  // unpickler consumes them strictly sequentially (one BINPERSID at a
+  // time), which leaves fast storage mostly idle; fetching them
+  // concurrently saturates disk bandwidth instead. getRecord is
+  // thread-safe, and for file-backed archives the reads use independent
+  // positional I/O.
+  std::vector<std::string> tensor_record_names;
+  if (!lazy_tensors) {
+    for (const auto& record : stream_reader.getAllRecords()) {
+      // getAllRecords returns names prefixed with the zip folder name,
+      // while getRecord takes names relative to it.
+      auto pos = record.find_first_of('/');
+      if (pos == std::string::npos) {
+        continue;
+      }
+      std::string relative_name = record.substr(pos + 1);
+      if (relative_name.compare(
+              0, archive_name_plus_slash.size(), archive_name_plus_slash) ==
+          0) {
+        tensor_record_names.push_back(std::move(relative_name));
+      }
+    }
+  }
+  std::vector<std::tuple<at::DataPtr, size_t>> prefetched_records(
+      tensor_record_names.size());
+  at::parallel_for(
+      0, tensor_record_names.size(), 1, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          prefetched_records[i] =
+              stream_reader.getRecord(tensor_record_names[i]);
+        }
+      });
+  std::unordered_map<std::string, at::DataPtr> prefetched;
+  prefetched.reserve(tensor_record_names.size());
+  for (size_t i = 0; i < tensor_record_names.size(); ++i) {
+    prefetched.emplace(
+        std::move(tensor_record_names[i]),
+        std::move(std::get<0>(prefetched_records[i])));
+  }
+
   auto read_record = [&](const std::string& name) {
     std::string ss = archive_name_plus_slash + name;
+    if (lazy_tensors) {
+      // See Note [Lazy submodule materialization]: hand back an empty
+      // DataPtr that remembers which record it stands for.
+      return at::DataPtr(
+          nullptr, new std::string(ss), deleteLazyRecordKey, at::kCPU);
+    }
+    auto it = prefetched.find(ss);
+    if (it != prefetched.end()) {
+      auto data = std::move(it->second);
+      prefetched.erase(it);
+      return data;
+    }
     return std::get<0>(stream_reader.getRecord(ss));
   };
 
@@ -97,6 +176,113 @@ IValue readArchiveAndTensors(
 
 namespace {
 
+// Opt-in flag for mmap-backed loading of file archives: tensor records
+// alias a copy-on-write mapping of the file instead of being copied into
+// freshly allocated memory, so load time no longer scales with the tensor
+// payload and clean pages are shared across processes. See
+// Note [Memory-mapped record loading] in
+// caffe2/serialize/inline_container.cc.
+bool mmapLoadEnabled() {
+  const char* flag = std::getenv("TORCH_JIT_LOAD_MMAP");
+  return flag != nullptr && std::strcmp(flag, "1") == 0;
+}
+
+// Verify that we're loading a zip archive and not a torch.save pickle archive
+// (marked by the 0x80 0x02 bytes at the start)
+void verifyNotSavePickle(ReadAdapterInterface& rai) {
+  uint8_t first_short[2];
+  rai.read(
+      /*pos=*/0,
+      /*buf=*/&first_short,
+      /*n=*/2,
+      /*what=*/"checking archive");
+  if (first_short[0] == 0x80 && first_short[1] == 0x02) {
+    // NB: zip files by spec can start with any data, so technically they might
+    // start with 0x80 0x02, but in practice zip files start with a file entry
+    // which begins with 0x04034b50. Furthermore, PyTorch will never produce zip
+    // files that do not start with the file entry, so it is relatively safe to
+    // perform this check.
+    TORCH_CHECK(
+        false,
+        "`torch::jit::load()` received a file from `torch.save()`, "
+        "but `torch::jit::load()` can only load files"
+        " produced by `torch.jit.save()`");
+  }
+}
+
+// See Note [Lazy submodule materialization]. Walks an IValue graph and
+// collects every storage whose payload is still an unread record,
+// deduplicated so shared storages (views) are fetched once.
+void collectLazyStorages(
+    const IValue& value,
+    std::unordered_set<const void*>& visited,
+    std::vector<std::pair<c10::StorageImpl*, std::string>>& pending) {
+  if (value.isTensor()) {
+    const at::Tensor& tensor = value.toTensor();
+    if (!tensor.defined() || !tensor.has_storage()) {
+      return;
+    }
+    const at::Storage& storage = tensor.storage();
+    const at::DataPtr& data_ptr = storage.unsafeGetStorageImpl()->data_ptr();
+    if (data_ptr.get() != nullptr ||
+        data_ptr.get_deleter() != &deleteLazyRecordKey) {
+      return;
+    }
+    if (!visited.insert(storage.unsafeGetStorageImpl()).second) {
+      return;
+    }
+    pending.emplace_back(
+        storage.unsafeGetStorageImpl(),
+        *static_cast<std::string*>(data_ptr.get_context()));
+  } else if (value.isTensorList()) {
+    for (const at::Tensor& tensor : value.toTensorList()) {
+      collectLazyStorages(tensor, visited, pending);
+    }
+  } else if (value.isTuple()) {
+    for (const auto& element : value.toTuple()->elements()) {
+      collectLazyStorages(element, visited, pending);
+    }
+  } else if (value.isList()) {
+    for (const auto& element : value.toListRef()) {
+      collectLazyStorages(element, visited, pending);
+    }
+  } else if (value.isGenericDict()) {
+    for (const auto& entry : value.toGenericDict()) {
+      collectLazyStorages(entry.key(), visited, pending);
+      collectLazyStorages(entry.value(), visited, pending);
+    }
+  } else if (value.isObject()) {
+    auto obj = value.toObject();
+    if (!visited.insert(obj.get()).second) {
+      return;
+    }
+    for (const auto& slot : obj->slots()) {
+      collectLazyStorages(slot, visited, pending);
+    }
+  }
+}
+
+// Fetches the pending records in parallel and installs them into their
+// storages, mirroring the eager prefetch in readArchiveAndTensors.
+void materializeLazyStorages(
+    const std::vector<std::pair<c10::StorageImpl*, std::string>>& pending,
+    PyTorchStreamReader& reader) {
+  at::parallel_for(0, pending.size(), 1, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      at::DataPtr record;
+      size_t record_size;
+      std::tie(record, record_size) = reader.getRecord(pending[i].second);
+      c10::StorageImpl* impl = pending[i].first;
+      TORCH_CHECK(
+          record_size >= impl->capacity(),
+          "record ",
+          pending[i].second,
+          " is smaller than the storage it backs");
+      impl->set_data_ptr(std::move(record));
+    }
+  });
+}
+
 // This is a deserializer class which loads script modules from pt files.
 // Content of the file is written using PyTorchStreamWriter, for details please
 // check caffe2/serialize/inline_container.h.
@@ -120,10 +306,11 @@ class ScriptModuleDeserializer final {
 
   Module deserialize(
       c10::optional<at::Device> device,
-      ExtraFilesMap& extra_files);
+      ExtraFilesMap& extra_files,
+      const std::string& submodule_path = "");
 
  private:
-  IValue readArchive(const std::string& archive_name);
+  IValue readArchive(const std::string& archive_name, bool lazy_tensors = false);
 
   std::shared_ptr<CompilationUnit> compilation_unit_;
   std::unique_ptr<PyTorchStreamReader> reader_;
@@ -133,7 +320,9 @@ class ScriptModuleDeserializer final {
   std::string export_prefix_ = "code/";
 };
 
-IValue ScriptModuleDeserializer::readArchive(const std::string& archive_name) {
+IValue ScriptModuleDeserializer::readArchive(
+    const std::string& archive_name,
+    bool lazy_tensors) {
   auto type_resolver = [&](const c10::QualifiedName& qn) {
     auto cls = source_importer_.loadNamedType(qn)->expect<ClassType>();
     return c10::StrongTypePtr(compilation_unit_, std::move(cls));
@@ -148,6 +337,14 @@ IValue ScriptModuleDeserializer::readArchive(const std::string& archive_name) {
     size_t n = cls->numAttributes();
     if (checkHasValidSetGetState(cls)) {
       auto obj = c10::ivalue::Object::create(type, n);
+      if (lazy_tensors) {
+        // See Note [Lazy submodule materialization]: __setstate__ may
+        // compute on its input tensors, so they cannot stay lazy.
+        std::unordered_set<const void*> visited;
+        std::vector<std::pair<c10::StorageImpl*, std::string>> pending;
+        collectLazyStorages(input, visited, pending);
+        materializeLazyStorages(pending, *reader_);
+      }
       // XXX: Do not optimize __setstate__, so that we don't try to
       // specialize the class before it is initialized.
       setGraphExecutorOptimize(false);
@@ -175,13 +372,22 @@ IValue ScriptModuleDeserializer::readArchive(const std::string& archive_name) {
     }
   };
 
+  // Lazy archives are unpickled onto CPU; the caller applies the target
+  // device after materialization, since moving a lazy storage to an
+  // accelerator would force its payload to be read.
   return readArchiveAndTensors(
-      archive_name, type_resolver, obj_loader, device_, *reader_.get());
+      archive_name,
+      type_resolver,
+      obj_loader,
+      lazy_tensors ? c10::optional<at::Device>(at::kCPU) : device_,
+      *reader_.get(),
+      lazy_tensors);
 }
 
 Module ScriptModuleDeserializer::deserialize(
     c10::optional<at::Device> device,
-    ExtraFilesMap& extra_files) {
+    ExtraFilesMap& extra_files,
+    const std::string& submodule_path) {
   C10_LOG_API_USAGE_ONCE("torch.script.load");
   device_ = device;
   // Load extra files.
@@ -205,9 +411,55 @@ Module ScriptModuleDeserializer::deserialize(
   }
   auto tuple = readArchive("constants").toTuple();
   for (auto constant : tuple->elements()) {
-    constants_table_.push_back(constant.toTensor());
+    auto tensor = constant.toTensor();
+    if (shareLoadedTensorsEnabled()) {
+      // See Note [Sharing identical tensors across modules]
+      tensor = shareReadOnlyTensor(tensor);
+    }
+    constants_table_.push_back(std::move(tensor));
+  }
+  if (!submodule_path.empty()) {
+    // See Note [Lazy submodule materialization]
+    auto obj = readArchive("data", /*lazy_tensors=*/true).toObject();
+    std::istringstream path_stream(submodule_path);
+    std::string attr_name;
+    while (std::getline(path_stream, attr_name, '.')) {
+      TORCH_CHECK(
+          obj->type()->findAttributeSlot(attr_name),
+          "submodule path '",
+          submodule_path,
+          "': '",
+          attr_name,
+          "' is not an attribute of ",
+          obj->type()->python_str());
+      IValue child = obj->getAttr(attr_name);
+      TORCH_CHECK(
+          child.isObject(),
+          "submodule path '",
+          submodule_path,
+          "': '",
+          attr_name,
+          "' is not a submodule");
+      obj = child.toObject();
+    }
+    std::unordered_set<const void*> visited;
+    std::vector<std::pair<c10::StorageImpl*, std::string>> pending;
+    collectLazyStorages(obj, visited, pending);
+    materializeLazyStorages(pending, *reader_);
+    auto m = Module(std::move(obj));
+    if (shareLoadedTensorsEnabled()) {
+      shareReadOnlyTensors(m);
+    }
+    if (device_) {
+      m.to(*device_);
+    }
+    return m;
+  }
+  auto m = Module(readArchive("data").toObject());
+  if (shareLoadedTensorsEnabled()) {
+    shareReadOnlyTensors(m);
   }
-  return Module(readArchive("data").toObject());
+  return m;
 }
 
 } // namespace
@@ -227,7 +479,8 @@ Module import_ir_module(
     const std::string& filename,
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files) {
-  auto reader = torch::make_unique<PyTorchStreamReader>(filename);
+  auto reader =
+      torch::make_unique<PyTorchStreamReader>(filename, mmapLoadEnabled());
   ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
   return deserializer.deserialize(device, extra_files);
 }
@@ -256,34 +509,46 @@ Module load(
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files) {
   std::unique_ptr<FileAdapter> rai = std::make_unique<FileAdapter>(filename);
+  if (mmapLoadEnabled()) {
+    // The mmap-backed reader needs the file name, so it cannot be reached
+    // through the ReadAdapterInterface overload.
+    verifyNotSavePickle(*rai);
+    rai.reset();
+    auto reader =
+        torch::make_unique<PyTorchStreamReader>(filename, /*use_mmap=*/true);
+    auto cu = std::make_shared<CompilationUnit>();
+    ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
+    return deserializer.deserialize(device, extra_files);
+  }
   auto module = load(std::move(rai), device, extra_files);
   return module;
 }
 
+Module load(
+    const std::string& filename,
+    const std::string& submodule_path,
+    c10::optional<at::Device> device) {
+  // See Note [Lazy submodule materialization]
+  std::unique_ptr<FileAdapter> rai = std::make_unique<FileAdapter>(filename);
+  verifyNotSavePickle(*rai);
+  std::unique_ptr<PyTorchStreamReader> reader;
+  if (mmapLoadEnabled()) {
+    rai.reset();
+    reader =
+        torch::make_unique<PyTorchStreamReader>(filename, /*use_mmap=*/true);
+  } else {
+    reader = torch::make_unique<PyTorchStreamReader>(std::move(rai));
+  }
+  auto cu = std::make_shared<CompilationUnit>();
+  ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
+  return deserializer.deserialize(device, default_extra_files, submodule_path);
+}
+
 Module load(
     std::unique_ptr<ReadAdapterInterface> rai,
     c10::optional<c10::Device> device,
     ExtraFilesMap& extra_files) {
-  // Verify that we're loading a zip archive and not a torch.save pickle archive
-  // (marked by the 0x80 0x02 bytes at the start)
-  uint8_t first_short[2];
-  rai->read(
-      /*pos=*/0,
-      /*buf=*/&first_short,
-      /*n=*/2,
-      /*what=*/"checking archive");
-  if (first_short[0] == 0x80 && first_short[1] == 0x02) {
-    // NB: zip files by spec can start with any data, so technically they might
-    // start with 0x80 0x02, but in practice zip files start with a file entry
-    // which begins with 0x04034b50. Furthermore, PyTorch will never produce zip
-    // files that do not start with the file entry, so it is relatively safe to
-    // perform this check.
-    TORCH_CHECK(
-        false,
-        "`torch::jit::load()` received a file from `torch.save()`, "
-        "but `torch::jit::load()` can only load files"
-        " produced by `torch.jit.save()`");
-  }
+  verifyNotSavePickle(*rai);
 
   auto reader = torch::make_unique<PyTorchStreamReader>(std::move(rai));
   auto cu = std::make_shared<CompilationUnit>();
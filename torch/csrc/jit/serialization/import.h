@@ -65,12 +65,25 @@ TORCH_API Module load(
     c10::optional<c10::Device> device = c10::nullopt,
     ExtraFilesMap& extra_files = default_extra_files);
 
+/// Loads only the submodule at the given dot-separated attribute path
+/// (e.g. "encoder" or "encoder.layer1") from a serialized `Module`,
+/// reading tensor payloads solely for storages reachable from that
+/// submodule. For an encoder-decoder checkpoint this loads the encoder
+/// without paying for the decoder's weights in time or memory. The
+/// returned module is materialized on CPU unless `device` is given.
+/// See Note [Lazy submodule materialization] in import.cpp.
+TORCH_API Module load(
+    const std::string& filename,
+    const std::string& submodule_path,
+    c10::optional<c10::Device> device = c10::nullopt);
+
 TORCH_API IValue readArchiveAndTensors(
     const std::string& archive_name,
     c10::optional<TypeResolver> type_resolver,
     c10::optional<ObjLoader> obj_loader,
     c10::optional<at::Device> device,
-    caffe2::serialize::PyTorchStreamReader& stream_reader);
+    caffe2::serialize::PyTorchStreamReader& stream_reader,
+    bool lazy_tensors = false);
 
 } // namespace jit
 } // namespace torch
@@ -33,6 +33,22 @@ std::vector<char> pickle(
   return data;
 }
 
+PickleSession::PickleSession() : pickler_(nullptr, nullptr) {}
+
+void PickleSession::pickle(
+    std::function<void(const char* data_start, size_t data_len)> writer,
+    const IValue& ivalue,
+    std::vector<at::Tensor>* tensor_table) {
+  pickler_.reset(std::move(writer), tensor_table);
+  pickler_.protocol();
+  pickler_.pushIValue(ivalue);
+  pickler_.stop();
+}
+
+std::vector<WriteableTensorData> PickleSession::takeTensorData() {
+  return pickler_.takeTensorData();
+}
+
 // This has to live here instead of the C++ API to mirror torch.save since the
 // mobile build excludes the C++ API
 std::vector<char> pickle_save(const at::IValue& ivalue) {
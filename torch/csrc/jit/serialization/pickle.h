@@ -52,6 +52,37 @@ TORCH_API std::vector<char> pickle(
     const IValue& ivalue,
     std::vector<at::Tensor>* tensor_table = nullptr);
 
+/// A reusable serializer for high-rate pipelines (RPC agents, the C++
+/// DataLoader): one session keeps a single Pickler alive and amortizes
+/// its write buffer and memo-table allocations across many messages,
+/// instead of rebuilding that state per `jit::pickle` call.
+///
+/// Each `pickle` call still produces an independent, self-delimiting
+/// pickle stream (memo ids may not cross stream boundaries), written
+/// through `writer` — typically into a caller-managed ring buffer, since
+/// the session never allocates output storage itself.
+///
+/// A session is not thread-safe; use one per producer thread.
+class TORCH_API PickleSession {
+ public:
+  PickleSession();
+
+  /// Serialize one value as a complete pickle stream. Semantics match
+  /// the free `jit::pickle` function, including `tensor_table` handling.
+  void pickle(
+      std::function<void(const char* data_start, size_t data_len)> writer,
+      const IValue& ivalue,
+      std::vector<at::Tensor>* tensor_table = nullptr);
+
+  /// Moves out the tensor payloads gathered by the last `pickle` call
+  /// when no `tensor_table` was given, so the session does not keep the
+  /// message's storages alive after the caller is done with them.
+  std::vector<WriteableTensorData> takeTensorData();
+
+ private:
+  Pickler pickler_;
+};
+
 /// Save a `torch::IValue` in a format that can be loaded by both
 /// `torch::pickle_load` in C++ and `torch.load` in Python.
 TORCH_API std::vector<char> pickle_save(const IValue& ivalue);
@@ -3,6 +3,7 @@
 #ifdef USE_DISTRIBUTED
 #include <torch/csrc/distributed/rpc/rref_context.h>
 #endif
+#include <TH/THAllocator.h>
 #include <aten/src/ATen/quantized/Quantizer.h>
 #include <torch/csrc/jit/api/function_impl.h>
 #include <torch/csrc/jit/serialization/pickler.h>
@@ -26,6 +27,23 @@ Pickler::~Pickler() {
   flush();
 }
 
+void Pickler::reset(
+    std::function<void(const char*, size_t)> writer,
+    std::vector<at::Tensor>* tensor_table) {
+  writer_ = std::move(writer);
+  tensor_table_ = tensor_table;
+  bufferPos_ = 0;
+  stack_.clear();
+  memo_id_ = 0;
+  memoized_ivalue_map_.clear();
+  memoized_ivalues_.clear();
+  tensor_data_.clear();
+  memoized_storage_map_.clear();
+  memoized_globals_map_.clear();
+  memoized_strings_map_.clear();
+  memoized_devices_map_.clear();
+}
+
 void Pickler::protocol() {
   push<PickleOpCode>(PickleOpCode::PROTO);
   push<uint8_t>(PROTOCOL_VERSION);
@@ -268,6 +286,24 @@ void Pickler::pushString(const std::string& string) {
   }
 }
 
+// Note [Shared-memory tensor views]
+// Processes on the same host often exchange tensors whose storages already
+// live in a file- or shm-backed mapping (e.g. tensors allocated through
+// tensor.share_memory_() or loaded via THMapAllocator). The default pickle
+// path still copies the full payload into the stream. When a Pickler is
+// constructed with use_shm_views=true, such storages are instead written as
+// a "shm_storage" persistent-id tuple that carries only the mapping's
+// (filename, flags, numel); the unpickler re-attaches to the same mapping
+// with TH_ALLOCATOR_MAPPED_NOCREATE, making the transfer O(metadata).
+//
+// Scope: this covers storages owned by THMapAllocator and
+// THRefcountedMapAllocator. Storages managed by the libshm daemon
+// (THManagedMapAllocator) live in torch_python, not libtorch, and keep
+// using the Python-side reducers. Storages that are not mapped at all fall
+// through to the ordinary payload path, so a mixed pickle stays valid.
+// Both ends must be on the same host and the mapping must outlive the
+// receiver's use of the tensor; callers opt in precisely because the
+// Pickler cannot check either condition.
 void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
   const at::Storage& storage = tensor.storage();
   void* addr = storage.unsafeGetStorageImpl();
@@ -277,6 +313,35 @@ void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
     return;
   }
 
+  if (use_shm_views_ && tensor.device().is_cpu()) {
+    THMapAllocator* allocator =
+        THRefcountedMapAllocator::fromDataPtr(storage.data_ptr());
+    bool refcounted = allocator != nullptr;
+    if (!refcounted) {
+      allocator = THMapAllocator::fromDataPtr(storage.data_ptr());
+    }
+    if (allocator != nullptr && allocator->filename()[0] != '\0' &&
+        (allocator->flags() &
+         (TH_ALLOCATOR_MAPPED_SHARED | TH_ALLOCATOR_MAPPED_SHAREDMEM))) {
+      // See Note [Shared-memory tensor views]
+      push<PickleOpCode>(PickleOpCode::MARK);
+      pushString("shm_storage");
+      std::string data_type =
+          std::string(toString(tensor.scalar_type())).append("Storage");
+      pushGlobal("torch", data_type);
+      pushString(allocator->filename());
+      pushInt(allocator->flags());
+      pushInt(tensor.storage().size());
+      pushBool(refcounted);
+      push<PickleOpCode>(PickleOpCode::TUPLE);
+      push<PickleOpCode>(PickleOpCode::BINPERSID);
+      memoized_storage_map_[addr] = pushNextBinPut();
+      // Deliberately no tensor_data_ entry: the payload never leaves the
+      // shared mapping.
+      return;
+    }
+  }
+
   // Tuple for persistent_load
   push<PickleOpCode>(PickleOpCode::MARK);
   // typename
@@ -301,10 +366,8 @@ void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
 }
 
 void Pickler::pushBytes(const std::string& string) {
-  static const size_t kSmallStr = 32;
-  if (string.size() <= kSmallStr &&
-      bufferPos_ + string.size() <= buffer_.size()) {
-    // Small string that fits: buffer the data.
+  if (bufferPos_ + string.size() <= buffer_.size()) {
+    // String that fits in the remaining buffer: buffer the data.
     memcpy(buffer_.data() + bufferPos_, string.data(), string.size());
     bufferPos_ += string.size();
   } else {
@@ -6,6 +6,7 @@
 #include <ATen/core/ivalue.h>
 #include <ATen/core/jit_type.h>
 #include <c10/util/ArrayRef.h>
+#include <c10/util/flat_hash_map.h>
 #include <torch/csrc/utils/disallow_copy.h>
 
 namespace torch {
@@ -116,15 +117,30 @@ class Pickler {
   TH_DISALLOW_COPY_AND_ASSIGN(Pickler);
 
  public:
+  // When use_shm_views is true, tensors whose storages live in shared
+  // memory are pickled as (filename, flags, numel) handles instead of
+  // payloads, and the unpickling process attaches to the same mapping.
+  // Only valid when both ends are on the same host. See
+  // Note [Shared-memory tensor views] in pickler.cpp.
   Pickler(
       std::function<void(const char*, size_t)> writer,
       std::vector<at::Tensor>* tensor_table,
-      std::vector<c10::ClassTypePtr>* memorized_class_types = nullptr)
+      std::vector<c10::ClassTypePtr>* memorized_class_types = nullptr,
+      bool use_shm_views = false)
       : writer_(writer),
         tensor_table_(tensor_table),
-        memorized_class_types_(memorized_class_types) {}
+        memorized_class_types_(memorized_class_types),
+        use_shm_views_(use_shm_views) {}
   ~Pickler();
 
+  // Rebinds the output and tensor table and clears all per-stream state
+  // (memo tables, pending tensor data) while keeping allocated capacity,
+  // so one Pickler can serialize many independent messages without
+  // reallocating its buffer and maps each time. Used by PickleSession.
+  void reset(
+      std::function<void(const char*, size_t)> writer,
+      std::vector<at::Tensor>* tensor_table);
+
   // Push protocol onto the stack
   void protocol();
 
@@ -140,6 +156,12 @@ class Pickler {
     return tensor_data_;
   }
 
+  // Moves the gathered tensor payloads out, so a reused pickler does not
+  // keep the previous message's storages alive until the next reset().
+  std::vector<WriteableTensorData> takeTensorData() {
+    return std::move(tensor_data_);
+  }
+
   void pushEmptyDict();
   void pushDict(const IValue& ivalue);
   void pushInt(int64_t value);
@@ -200,7 +222,11 @@ class Pickler {
   // the left of a '::', its type cannot be deduced by the compiler so one must
   // explicitly instantiate the template, i.e. push<int>(int) works, push(int)
   // does not)
-  static constexpr size_t kBufferSize = 256;
+  // The buffer is large so that pickling a big structure (e.g. a
+  // million-element list) invokes writer_ once every 64KB rather than
+  // every few opcodes; the std::function indirection per call is what
+  // made large pickles CPU-bound.
+  static constexpr size_t kBufferSize = 64 * 1024;
   template <typename T>
   void push(typename std::common_type<T>::type value) {
     const char* begin = reinterpret_cast<const char*>(&value);
@@ -216,8 +242,9 @@ class Pickler {
   // Code shouldn't call writer_ directly without first flush()ing.
   std::function<void(const char*, size_t)> writer_;
 
-  // Buffer to avoid calling a writer_ on a per-byte basis.
-  std::array<char, kBufferSize> buffer_;
+  // Buffer to avoid calling a writer_ on a per-byte basis. Heap-allocated
+  // so Pickler stays cheap to put on the stack.
+  std::vector<char> buffer_ = std::vector<char>(kBufferSize);
   size_t bufferPos_{0};
 
   // Stack of opcodes/data
@@ -232,8 +259,10 @@ class Pickler {
   uint32_t memo_id_ = 0;
 
   // Memoization of IValues that have been written (index in table is used for
-  // BINPUT opcodes) to enable shared references
-  std::unordered_map<const void*, uint32_t> memoized_ivalue_map_;
+  // BINPUT opcodes) to enable shared references. Open-addressing maps:
+  // these are probed once per pickled value, so lookup cost matters more
+  // than iteration or stability.
+  ska::flat_hash_map<const void*, uint32_t> memoized_ivalue_map_;
 
   // because we de-dup ivalues based on their raw pointer address in the above
   // map we need to keep all the memoized values alive during the pickle.
@@ -244,14 +273,17 @@ class Pickler {
   // List of all the types that it wrote, inspect from the IValues it wrote.
   std::vector<c10::ClassTypePtr>* memorized_class_types_;
 
+  // See Note [Shared-memory tensor views] in pickler.cpp
+  bool use_shm_views_;
+
   // List of tensor storages to serialize in the same binary as the pickle data
   // similar to ivalues, they are memoized using BINPUT
   std::vector<WriteableTensorData> tensor_data_;
-  std::unordered_map<const void*, uint32_t> memoized_storage_map_;
+  ska::flat_hash_map<const void*, uint32_t> memoized_storage_map_;
 
-  std::unordered_map<std::string, uint32_t> memoized_globals_map_;
-  std::unordered_map<std::string, uint32_t> memoized_strings_map_;
-  std::unordered_map<std::string, uint32_t> memoized_devices_map_;
+  ska::flat_hash_map<std::string, uint32_t> memoized_globals_map_;
+  ska::flat_hash_map<std::string, uint32_t> memoized_strings_map_;
+  ska::flat_hash_map<std::string, uint32_t> memoized_devices_map_;
 };
 
 // returns a (tensor, record_size) for a tensor, converting it to a CPU tensor
@@ -3,6 +3,7 @@
 #ifdef USE_DISTRIBUTED
 #include <torch/csrc/distributed/rpc/rref_context.h>
 #endif
+#include <TH/THAllocator.h>
 #include <torch/csrc/jit/api/function_impl.h>
 #include <torch/csrc/jit/mobile/type_parser.h>
 #include <torch/csrc/jit/serialization/pickler.h>
@@ -398,10 +399,36 @@ PickleOpCode Unpickler::readInstruction() {
     } break;
     case PickleOpCode::BINPERSID: {
       auto args = pop(stack_).toTuple()->elements();
+      const std::string& persid_key = args.at(0).toStringRef();
+      if (persid_key == "shm_storage") {
+        // See Note [Shared-memory tensor views] in pickler.cpp: attach to
+        // the sender's shared mapping instead of reading a payload record.
+        at::ScalarType type = args.at(1).toScalarType();
+        const std::string& filename = args.at(2).toStringRef();
+        // The sender may have created the mapping; we only ever attach.
+        int flags = static_cast<int>(args.at(3).toInt());
+        flags &= ~TH_ALLOCATOR_MAPPED_EXCLUSIVE;
+        flags |= TH_ALLOCATOR_MAPPED_NOCREATE;
+        int64_t numel = args.at(4).toInt();
+        bool refcounted = args.at(5).toBool();
+        auto dtype = at::CPU(type).typeMeta();
+        size_t nbytes = numel * dtype.itemsize();
+        at::DataPtr storage_ptr = refcounted
+            ? THRefcountedMapAllocator::makeDataPtr(
+                  filename.c_str(), flags, nbytes, nullptr)
+            : THMapAllocator::makeDataPtr(
+                  filename.c_str(), flags, nbytes, nullptr);
+        at::Storage storage(
+            dtype,
+            numel,
+            std::move(storage_ptr),
+            /*allocator=*/nullptr,
+            /*resizable=*/false);
+        stack_.push_back(at::empty({0}, at::CPU(type).options()).set_(storage));
+        break;
+      }
       AT_ASSERT(
-          args.at(0).toStringRef() == "storage",
-          "unknown PERSID key ",
-          args.at(0).toStringRef());
+          persid_key == "storage", "unknown PERSID key ", persid_key);
       at::ScalarType type = args.at(1).toScalarType();
       const std::string& key = args.at(2).toStringRef();
       at::Device device(args.at(3).toStringRef());
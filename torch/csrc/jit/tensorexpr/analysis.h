@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_set>
+
 #include <torch/csrc/jit/tensorexpr/ir.h>
 #include <torch/csrc/jit/tensorexpr/ir_visitor.h>
 #include <torch/csrc/jit/tensorexpr/stmt.h>
@@ -28,6 +30,27 @@ class HasRand : public IRVisitor {
   Stmt* stmt_;
   bool has_rand_ = false;
 };
+
+// Collects all Var nodes referenced by a statement.
+class VarFinder : public IRVisitor {
+ public:
+  static std::unordered_set<const Var*> find(Stmt* s) {
+    VarFinder finder;
+    s->accept(&finder);
+    return finder.vars();
+  }
+
+  const std::unordered_set<const Var*>& vars() const {
+    return vars_;
+  }
+
+ private:
+  void visit(const Var* v) override {
+    vars_.insert(v);
+  }
+
+  std::unordered_set<const Var*> vars_;
+};
 } // namespace tensorexpr
 } // namespace jit
 } // namespace torch
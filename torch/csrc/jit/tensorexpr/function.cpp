@@ -21,6 +21,36 @@ static void unpack_dim_args(
   }
 }
 
+// Flattens the multi-dimensional index given by `args` into the linear
+// offset of a contiguous buffer with the given dims.
+static const Expr* flatten_index(
+    const std::vector<const Expr*>& dims,
+    const std::vector<const Var*>& args) {
+  std::vector<ExprHandle> strides(dims.size());
+  for (size_t i = 0; i < strides.size(); i++) {
+    if (i == strides.size() - 1) {
+      strides[i] = ExprHandle(1);
+      continue;
+    }
+    ExprHandle stride = ExprHandle(dims[i + 1]);
+    for (size_t j = i + 2; j < dims.size(); j++) {
+      stride = stride * ExprHandle(dims[j]);
+    }
+    strides[i] = stride;
+  }
+
+  ExprHandle total_index = int32_t{0};
+  for (size_t i = 0; i < dims.size(); i++) {
+    ExprHandle index = VarHandle(args[i]) * ExprHandle(strides[i]);
+    if (i == 0) {
+      total_index = index;
+    } else {
+      total_index = total_index + index;
+    }
+  }
+  return total_index.node();
+}
+
 } // namespace
 
 Tensor* Compute(
@@ -106,37 +136,71 @@ Tensor* Compute(
   return new Tensor(func, 0);
 }
 
-Stmt* Function::ElementStmt(size_t index) {
-  std::vector<ExprHandle> strides(dims_.size());
-  for (size_t i = 0; i < strides.size(); i++) {
-    if (i == strides.size() - 1) {
-      strides[i] = ExprHandle(1);
-      continue;
-    }
-    ExprHandle stride = ExprHandle(dims_[i + 1]);
-    for (size_t j = i + 2; j < dims_.size(); j++) {
-      stride = stride * ExprHandle(dims_[j]);
-    }
-    strides[i] = stride;
+// Creates a tensor that reduces the axes given by reduce_dim_args into the
+// dimensions given by dim_args. `body_func` receives the output indices
+// followed by the reduce indices and produces the value of one element of
+// the reduced axes; `reducer` describes how elements are folded into the
+// accumulator. The accumulator lives in the output buffer itself, so the
+// producers referenced by `body_func` can be inlined into the reduce loops
+// and the whole pipeline runs in a single pass over the inputs.
+Tensor* Reduce(
+    const std::string& func_name,
+    const std::vector<DimArg>& dim_args,
+    const Reducer& reducer,
+    const std::function<ExprHandle(const std::vector<VarHandle>&)>& body_func,
+    const std::vector<DimArg>& reduce_dim_args) {
+  if (reduce_dim_args.empty()) {
+    throw malformed_input();
   }
 
-  ExprHandle total_index = int32_t{0};
-  for (size_t i = 0; i < dims_.size(); i++) {
-    ExprHandle index = VarHandle(this->args_[i]) * ExprHandle(strides[i]);
-    if (i == 0) {
-      total_index = index;
-    } else {
-      total_index = total_index + index;
-    }
-  }
+  std::vector<const Expr*> dims;
+  std::vector<const Var*> args;
+  unpack_dim_args(dim_args, &dims, &args);
+  std::vector<const Expr*> reduce_dims;
+  std::vector<const Var*> reduce_args;
+  unpack_dim_args(reduce_dim_args, &reduce_dims, &reduce_args);
+
+  std::vector<const Var*> all_args(args);
+  all_args.insert(all_args.end(), reduce_args.begin(), reduce_args.end());
+  ExprHandle body = body_func(VarVectorToVarHandleVector(all_args));
+
+  // Fold the element into the accumulator stored in the output buffer;
+  // the enclosing output loops initialize it first (see
+  // Function::InitStmt and LoopNest::lowerToStmt).
+  const Var* func_var = new Var(func_name, kHandle);
+  ExprHandle accumulator = Load::make(
+      body.dtype(),
+      VarHandle(func_var),
+      ExprHandle(flatten_index(dims, args)),
+      ExprHandle(1));
+  const Expr* combined = reducer.combine(accumulator, body).node();
+  const Expr* initializer = reducer.initializer(body.dtype()).node();
+
+  Function* func = new Function(
+      func_var, dims, args, combined, reduce_dims, reduce_args, initializer);
+  return new Tensor(func, 0);
+}
 
+Stmt* Function::ElementStmt(size_t index) {
+  const Expr* total_index = flatten_index(dims_, args_);
   const Expr* mask = new IntImm(1);
 
   Stmt* update_stmt =
-      new Store(func_var(index), total_index.node(), body(index), mask);
+      new Store(func_var(index), total_index, body(index), mask);
   return update_stmt;
 }
 
+Stmt* Function::InitStmt(size_t index) {
+  if (!is_reduction()) {
+    throw malformed_input();
+  }
+
+  const Expr* total_index = flatten_index(dims_, args_);
+  const Expr* mask = new IntImm(1);
+
+  return new Store(func_var(index), total_index, initializers_[index], mask);
+}
+
 } // namespace tensorexpr
 } // namespace jit
 } // namespace torch
@@ -34,6 +34,24 @@ class Function : public KernelScopedObject {
       func_vars_[i] = new Var(func_names[i], kHandle);
     }
   }
+  // A reduction: `body` folds the elements of the reduced axes into the
+  // accumulator stored in the output buffer, which is initialized with
+  // `initializer` before the reduce loops run (see Reduce()).
+  Function(
+      const Var* func_var,
+      const std::vector<const Expr*>& dims,
+      const std::vector<const Var*>& args,
+      const Expr* body,
+      const std::vector<const Expr*>& reduce_dims,
+      const std::vector<const Var*>& reduce_args,
+      const Expr* initializer)
+      : func_vars_({func_var}),
+        dims_(dims),
+        args_(args),
+        bodies_({body}),
+        reduce_dims_(reduce_dims),
+        reduce_args_(reduce_args),
+        initializers_({initializer}) {}
 
   int ndim() const {
     return dims_.size();
@@ -59,6 +77,40 @@ class Function : public KernelScopedObject {
     return args_;
   }
 
+  bool is_reduction() const {
+    return !reduce_dims_.empty();
+  }
+  int reduce_ndim() const {
+    return reduce_dims_.size();
+  }
+  const Expr* reduce_dim(int index) const {
+    if (index < 0 || index >= reduce_ndim()) {
+      throw out_of_range_index();
+    }
+
+    return reduce_dims_[index];
+  }
+  const std::vector<const Expr*>& reduce_dims() const {
+    return reduce_dims_;
+  }
+  const Var* reduce_arg(int index) const {
+    if (index < 0 || index >= reduce_ndim()) {
+      throw out_of_range_index();
+    }
+
+    return reduce_args_[index];
+  }
+  const std::vector<const Var*>& reduce_args() const {
+    return reduce_args_;
+  }
+  const Expr* initializer(size_t index) const {
+    if (index >= initializers_.size()) {
+      throw out_of_range_index();
+    }
+
+    return initializers_[index];
+  }
+
   std::vector<const Expr*> bodies() const {
     return bodies_;
   }
@@ -81,12 +133,16 @@ class Function : public KernelScopedObject {
   }
 
   Stmt* ElementStmt(size_t index);
+  Stmt* InitStmt(size_t index);
 
  private:
   std::vector<const Var*> func_vars_;
   std::vector<const Expr*> dims_;
   std::vector<const Var*> args_;
   std::vector<const Expr*> bodies_;
+  std::vector<const Expr*> reduce_dims_;
+  std::vector<const Var*> reduce_args_;
+  std::vector<const Expr*> initializers_;
 };
 
 } // namespace tensorexpr
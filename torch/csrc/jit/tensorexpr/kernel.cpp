@@ -1,5 +1,11 @@
 #include <torch/csrc/jit/tensorexpr/kernel.h>
 
+#include <c10/core/MemoryFormat.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/tensorexpr/analysis.h>
 #include <torch/csrc/jit/tensorexpr/ir_printer.h>
@@ -29,6 +35,23 @@ int& getTECudaPointwiseBlockSize() {
   return te_cuda_pointwise_block_size;
 }
 
+// Note [TensorExpr schedule autotuning]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The CPU loop schedule below (vectorize by 8, parallelize the outer
+// loops) is a reasonable default but not the best choice for every fusion
+// group. Setting TORCH_TENSOREXPR_AUTOTUNE=1 makes the LLVM backend compile
+// a small set of candidate schedules instead and defer the choice to the
+// first call, which times every candidate on the real kernel arguments and
+// keeps the fastest. A kernel in this fuser is compiled per fusion group
+// against complete tensor types, so the kernel instance is the shape class
+// and one measurement covers all later calls. The candidate set is kept
+// deliberately small because each candidate costs a full compile.
+static bool teAutotuneEnabled() {
+  static const char* enable_c_str = std::getenv("TORCH_TENSOREXPR_AUTOTUNE");
+  static bool enable = enable_c_str && std::string(enable_c_str) == "1";
+  return enable;
+}
+
 } // namespace tensorexpr
 } // namespace jit
 } // namespace torch
@@ -948,9 +971,91 @@ Tensor* TensorExprKernel::computeValue(const torch::jit::Value* v) {
   }
 }
 
-void TensorExprKernel::lowerToBackend(BackendType backendType) {
+// Find the outer-most For loops in the given statement.
+static std::vector<For*> findOuterLoops(Stmt* s) {
+  std::vector<For*> outerLoops;
+  if (For* rootF = dynamic_cast<For*>(s)) {
+    outerLoops.push_back(rootF);
+  } else if (Block* body = dynamic_cast<Block*>(s)) {
+    std::vector<Block*> blocks = {body};
+    while (blocks.size()) {
+      Block* b = blocks.back();
+      blocks.pop_back();
+
+      for (Stmt* s2 : b->stmts()) {
+        if (For* f = dynamic_cast<For*>(s2)) {
+          outerLoops.push_back(f);
+        } else if (Block* b2 = dynamic_cast<Block*>(s2)) {
+          blocks.push_back(b2);
+        }
+      }
+    }
+  }
+  return outerLoops;
+}
+
+// Returns true if the type describes a complete 4-d tensor whose strides
+// are channels-last and not also plain contiguous (degenerate dims can make
+// the two layouts identical, in which case there is nothing to gain).
+static bool isChannelsLast2d(const TensorTypePtr& tt) {
+  if (!tt) {
+    return false;
+  }
+  auto sizes = tt->sizes().concrete_sizes();
+  auto strides = tt->strides().concrete_sizes();
+  if (!sizes || !strides || sizes->size() != 4) {
+    return false;
+  }
+  if (*strides != c10::get_channels_last_strides_2d(*sizes)) {
+    return false;
+  }
+  std::vector<int64_t> contiguous(sizes->size());
+  int64_t acc = 1;
+  for (size_t i = sizes->size(); i > 0; i--) {
+    contiguous[i - 1] = acc;
+    acc *= (*sizes)[i - 1];
+  }
+  return *strides != contiguous;
+}
+
+std::unique_ptr<CodeGen> TensorExprKernel::lowerToCodeGen(
+    BackendType backendType,
+    int vectorWidth,
+    bool parallel) {
   std::vector<Tensor*> tensorOutputs(tensorOutputs_);
 
+  // Note [Channels-last outputs]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Inputs are read through their profiled strides (see bindInput), so
+  // channels-last inputs need no conversion. Outputs, however, are stored
+  // in the dense order of their loop axes, which is NCHW-contiguous; in a
+  // channels-last model that forces a layout conversion after every fusion
+  // group. When the profiled output type carries channels-last strides we
+  // instead compute a wrapper tensor whose axes are ordered N, H, W, C and
+  // inline the logical tensor into it: the wrapper's dense buffer is then
+  // exactly the channels-last layout of the logical NCHW output, and
+  // runKernel allocates the output with MemoryFormat::ChannelsLast.
+  if (backendType != kCudaCodeGen) {
+    for (size_t i = 0; i < tensorOutputs_.size(); i++) {
+      if (!tensorOutputChannelsLast_[i]) {
+        continue;
+      }
+      Tensor* tensor = tensorOutputs_[i];
+      Tensor* nhwc = Compute(
+          tensor->func_var()->name_hint() + "_nhwc",
+          {ExprHandle(tensor->dim(0)),
+           ExprHandle(tensor->dim(2)),
+           ExprHandle(tensor->dim(3)),
+           ExprHandle(tensor->dim(1))},
+          [tensor](
+              const VarHandle& n,
+              const VarHandle& h,
+              const VarHandle& w,
+              const VarHandle& c) { return tensor->call({n, c, h, w}); });
+      tensorOutputs[i] = nhwc;
+    }
+  }
+
   if (backendType == BackendType::kCudaCodeGen) {
     for (size_t tensorIdx = 0; tensorIdx < tensorOutputs_.size(); tensorIdx++) {
       Tensor* tensor = tensorOutputs_[tensorIdx];
@@ -1004,6 +1109,15 @@ void TensorExprKernel::lowerToBackend(BackendType backendType) {
       l.computeInline(loop);
     }
   }
+  // Fold the logical NCHW output computation into its channels-last
+  // wrapper; see Note [Channels-last outputs].
+  if (backendType != kCudaCodeGen) {
+    for (size_t i = 0; i < tensorOutputs_.size(); i++) {
+      if (tensorOutputChannelsLast_[i]) {
+        l.computeInline(l.getLoopBodyFor(tensorOutputs_[i]));
+      }
+    }
+  }
   if (backendType == kCudaCodeGen) {
     for (size_t i = 0; i < tensorOutputs_.size(); i++) {
       l.computeInline(l.getLoopBodyFor(tensorOutputs_[i]));
@@ -1051,26 +1165,9 @@ void TensorExprKernel::lowerToBackend(BackendType backendType) {
     l.prepareForCodegen();
 
     std::vector<For*> innerLoops;
-    std::vector<For*> worklist;
 
     // Find outer-most For loops
-    if (For* rootF = dynamic_cast<For*>(l.root_stmt())) {
-      worklist.push_back(rootF);
-    } else if (Block* body = dynamic_cast<Block*>(l.root_stmt())) {
-      std::vector<Block*> blocks = {body};
-      while (blocks.size()) {
-        Block* b = blocks.back();
-        blocks.pop_back();
-
-        for (Stmt* s : b->stmts()) {
-          if (For* f = dynamic_cast<For*>(s)) {
-            worklist.push_back(f);
-          } else if (Block* b2 = dynamic_cast<Block*>(s)) {
-            blocks.push_back(b2);
-          }
-        }
-      }
-    }
+    std::vector<For*> worklist = findOuterLoops(l.root_stmt());
 
     // Traverse the For loop nest find inner-most loops, which are
     // vectorization candidates.
@@ -1099,17 +1196,29 @@ void TensorExprKernel::lowerToBackend(BackendType backendType) {
       For* split1;
       For* tail1;
 
-      l.splitWithTail(loop, 8, &outer1, &split1, &tail1);
+      l.splitWithTail(loop, vectorWidth, &outer1, &split1, &tail1);
       l.vectorize(split1);
 
-      if (tail1) {
+      if (tail1 && vectorWidth > 4) {
         For* outer2;
         For* split2;
         For* tail2;
-        l.splitWithTail(tail1, 4, &outer2, &split2, &tail2);
+        l.splitWithTail(tail1, vectorWidth / 2, &outer2, &split2, &tail2);
         l.vectorize(split2);
       }
     }
+
+    // Spread the outer-most loops across CPU threads. Re-discover them
+    // since splitting a one-dimensional loop above replaces it. Loops
+    // containing random ops stay serial so a kernel invocation keeps a
+    // single RNG stream.
+    if (parallel) {
+      for (For* loop : findOuterLoops(l.root_stmt())) {
+        if (!torch::jit::tensorexpr::HasRand(loop).has_rand()) {
+          l.setParallel(loop);
+        }
+      }
+    }
   }
 
   l.prepareForCodegen();
@@ -1134,7 +1243,7 @@ void TensorExprKernel::lowerToBackend(BackendType backendType) {
 
   // Generate code.
   std::string codegenName;
-  switch (backendType_) {
+  switch (backendType) {
     case kCudaCodeGen:
       codegenName = "cuda_codegen";
       break;
@@ -1147,12 +1256,30 @@ void TensorExprKernel::lowerToBackend(BackendType backendType) {
     default:
       throw std::runtime_error(
           "invalid backend type: " +
-          std::to_string(static_cast<int>(backendType_)));
+          std::to_string(static_cast<int>(backendType)));
+  }
+
+  return CreateCodeGen(codegenName, stmt, params, device_);
+}
+
+void TensorExprKernel::lowerToBackend(BackendType backendType) {
+  const int kDefaultVectorWidth = 8;
+
+  // See Note [TensorExpr schedule autotuning]. Kernels with random ops are
+  // excluded: timing them would consume extra RNG draws.
+  if (backendType == kLLVMCodeGen && teAutotuneEnabled() && !hasRandom_) {
+    for (int width : {4, 8, 16}) {
+      scheduleCandidates_.push_back(
+          lowerToCodeGen(backendType, width, /*parallel=*/true));
+    }
+    scheduleCandidates_.push_back(lowerToCodeGen(
+        backendType, kDefaultVectorWidth, /*parallel=*/false));
+    return;
   }
 
   codegenCache_.emplace(
       torch::get_hash(device_),
-      CreateCodeGen(codegenName, stmt, params, device_));
+      lowerToCodeGen(backendType, kDefaultVectorWidth, /*parallel=*/true));
 }
 
 template <typename T>
@@ -1280,12 +1407,44 @@ void TensorExprKernel::pickAndCheckBackendType(
   }
 }
 
+// Times each candidate schedule on the real kernel arguments and keeps the
+// fastest; see Note [TensorExpr schedule autotuning]. Every candidate
+// computes identical results into the same output buffers, so the extra
+// calls only rewrite data the winning call produces anyway.
+void TensorExprKernel::pickBestCandidate(
+    const std::vector<CodeGen::CallArg>& runArgs) {
+  const int kTimedIters = 3;
+  size_t best = 0;
+  double bestTime = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < scheduleCandidates_.size(); i++) {
+    CodeGen* codegen = scheduleCandidates_[i].get();
+    // Warm up once so JIT finalization and cache effects are not timed.
+    codegen->call(runArgs);
+    auto start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < kTimedIters; iter++) {
+      codegen->call(runArgs);
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < bestTime) {
+      bestTime = elapsed.count();
+      best = i;
+    }
+  }
+  codegenCache_.emplace(
+      torch::get_hash(device_), std::move(scheduleCandidates_[best]));
+  scheduleCandidates_.clear();
+}
+
 void TensorExprKernel::codeGenRun(
     const std::vector<CodeGen::CallArg>& runArgs) {
   switch (backendType_) {
     case kSimpleIREval:
     case kLLVMCodeGen:
     case kCudaCodeGen:
+      if (!scheduleCandidates_.empty()) {
+        pickBestCandidate(runArgs);
+      }
       codegenCache_.at(torch::get_hash(device_))->call(runArgs);
       break;
     default:
@@ -1460,6 +1619,9 @@ void TensorExprKernel::compile() {
       throw malformed_input();
     }
     tensorOutputs_.emplace_back(tensors_.at(output->unique()));
+    // See Note [Channels-last outputs].
+    tensorOutputChannelsLast_.push_back(
+        isChannelsLast2d(output->type()->cast<TensorType>()));
     tensors_.erase(output->unique());
   }
 }
@@ -1517,7 +1679,8 @@ void TensorExprKernel::runKernel(Stack& stack) {
   }
 
   std::vector<at::Tensor> outputs;
-  for (auto& o : tensorOutputs_) {
+  for (size_t i = 0; i < tensorOutputs_.size(); i++) {
+    Tensor* o = tensorOutputs_[i];
     std::vector<int64_t> tensorSize;
     for (const Expr* dim : o->dims()) {
       auto it = varToSize.find(dim);
@@ -1532,8 +1695,15 @@ void TensorExprKernel::runKernel(Stack& stack) {
       }
     }
 
+    // See Note [Channels-last outputs].
+    auto memoryFormat =
+        (backendType_ != kCudaCodeGen && tensorOutputChannelsLast_[i])
+        ? at::MemoryFormat::ChannelsLast
+        : at::MemoryFormat::Contiguous;
     outputs.push_back(at::empty(
-        tensorSize, c10::TensorOptions(tensorType(o)).device(device_)));
+        tensorSize,
+        c10::TensorOptions(tensorType(o)).device(device_),
+        memoryFormat));
     runArgs.emplace_back(outputs.back().data_ptr());
   }
 
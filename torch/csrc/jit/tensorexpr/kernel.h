@@ -154,10 +154,17 @@ class TensorExprKernel {
 
   Tensor* computeValue(const torch::jit::Value* v);
 
+  std::unique_ptr<CodeGen> lowerToCodeGen(
+      BackendType backendType,
+      int vectorWidth,
+      bool parallel);
+
   void lowerToBackend(BackendType backendType);
 
   void pickAndCheckBackendType(const at::ArrayRef<IValue>& inputs);
 
+  void pickBestCandidate(const std::vector<CodeGen::CallArg>& runArgs);
+
   void codeGenRun(const std::vector<CodeGen::CallArg>& runArgs);
 
   void bindInput(const torch::jit::Value* input);
@@ -208,9 +215,15 @@ class TensorExprKernel {
   int64_t nInputs_ = 0;
   std::vector<KernelArg> kernelArgs_;
   std::vector<Tensor*> tensorOutputs_;
+  // Per-output flag for channels-last materialization; see Note
+  // [Channels-last outputs] in kernel.cpp.
+  std::vector<bool> tensorOutputChannelsLast_;
   std::unordered_map<int64_t, Tensor*> tensors_;
   std::unordered_map<int64_t, VarHandle> scalars_;
   std::unordered_map<size_t, std::unique_ptr<CodeGen>> codegenCache_;
+  // Candidate schedules awaiting the first call; see Note [TensorExpr
+  // schedule autotuning] in kernel.cpp.
+  std::vector<std::unique_ptr<CodeGen>> scheduleCandidates_;
   KernelArena kernelArena_;
   BackendType backendType_ = BackendType::kUninitialized;
   at::Device device_ = at::kCPU;
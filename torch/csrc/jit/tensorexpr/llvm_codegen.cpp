@@ -15,6 +15,9 @@
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 
+#include <ATen/Parallel.h>
+
+#include <torch/csrc/jit/tensorexpr/analysis.h>
 #include <torch/csrc/jit/tensorexpr/buffer.h>
 #include <torch/csrc/jit/tensorexpr/execution_counter.h>
 #include <torch/csrc/jit/tensorexpr/ir.h>
@@ -28,6 +31,32 @@ using namespace torch::jit::tensorexpr;
 DEFINE_TRIGGER(llvm_codegen_created);
 DEFINE_TRIGGER(llvm_codegen_executed);
 
+extern "C" {
+
+typedef void (*ParallelCallee)(int64_t index, int8_t* packed_data);
+
+// Trampoline called from JIT-compiled code to run a parallel loop through
+// at::parallel_for. `func` is a compiled closure that executes a single
+// iteration given the loop index and the packed captured variables.
+void DispatchParallel(
+    int8_t* func,
+    int64_t start,
+    int64_t stop,
+    int8_t* packed_data) noexcept {
+  // No exception may propagate through the JIT-compiled frame.
+  try {
+    ParallelCallee callee = reinterpret_cast<ParallelCallee>(func);
+    at::parallel_for(start, stop, 1, [&](int64_t f_begin, int64_t f_end) {
+      for (int64_t index = f_begin; index < f_end; index++) {
+        callee(index, packed_data);
+      }
+    });
+  } catch (...) {
+  }
+}
+
+} // extern "C"
+
 namespace torch {
 namespace jit {
 namespace tensorexpr {
@@ -115,6 +144,10 @@ class LLVMCodeGenImpl : public IRVisitor {
       llvm::Value* mask,
       llvm::Value* val);
 
+  llvm::Value* packFuncArgs(const std::vector<llvm::Value*>& func_args);
+  std::vector<llvm::Value*> unpackFuncArgs(llvm::Value* packed, int arg_count);
+  void processParallelFor(const For* v);
+
   void optimize(llvm::Module& M);
 };
 } // namespace tensorexpr
@@ -897,7 +930,165 @@ void LLVMCodeGenImpl::visit(const Load* v) {
   value_ = load;
 }
 
+// Packs the values captured by a parallel loop body into an aggregate
+// struct so they can be forwarded through the dispatch trampoline.
+llvm::Value* LLVMCodeGenImpl::packFuncArgs(
+    const std::vector<llvm::Value*>& func_args) {
+  if (func_args.empty()) {
+    return llvm::ConstantPointerNull::get(
+        llvm::Type::getInt8PtrTy(getContext()));
+  }
+  std::vector<llvm::Type*> arg_types(func_args.size());
+  for (size_t idx = 0; idx < func_args.size(); idx++) {
+    arg_types[idx] = func_args[idx]->getType();
+  }
+  llvm::StructType* packed_type = llvm::StructType::create(arg_types);
+  llvm::Value* zero = llvm::ConstantInt::get(IntTy_, 0);
+  llvm::Value* one = llvm::ConstantInt::get(IntTy_, 1);
+  llvm::Value* packed = irb_.CreateAlloca(packed_type, one);
+  for (size_t idx = 0; idx < func_args.size(); idx++) {
+    llvm::Value* dst_ptr = irb_.CreateInBoundsGEP(
+        packed, {zero, llvm::ConstantInt::get(IntTy_, idx)});
+    irb_.CreateStore(func_args[idx], dst_ptr);
+  }
+  return packed;
+}
+
+// Loads the captured values back out of the aggregate struct.
+std::vector<llvm::Value*> LLVMCodeGenImpl::unpackFuncArgs(
+    llvm::Value* packed,
+    int arg_count) {
+  std::vector<llvm::Value*> func_args(arg_count);
+  llvm::Value* zero = llvm::ConstantInt::get(IntTy_, 0);
+  for (int idx = 0; idx < arg_count; idx++) {
+    llvm::Value* dst_ptr = irb_.CreateInBoundsGEP(
+        packed, {zero, llvm::ConstantInt::get(IntTy_, idx)});
+    func_args[idx] = irb_.CreateLoad(dst_ptr);
+  }
+  return func_args;
+}
+
+// Lowers a For loop marked parallel by outlining its body into a closure
+// function and dispatching the iteration range through at::parallel_for
+// (via the DispatchParallel trampoline above).
+void LLVMCodeGenImpl::processParallelFor(const For* v) {
+  // Compute the iteration bounds in the enclosing function.
+  v->start()->accept(this);
+  auto start = this->value_;
+  v->stop()->accept(this);
+  auto stop = this->value_;
+
+  // Collect the variables the loop body captures from the enclosing
+  // scope. Variables bound inside the body (nested loop indices, lets)
+  // are not resolvable yet and get bound during body codegen as usual.
+  std::vector<const Var*> closure_vars;
+  std::vector<llvm::Value*> closure_vals;
+  for (const Var* var : VarFinder::find(v->body())) {
+    if (var == v->var()) {
+      continue;
+    }
+    if (varToArg_.count(var)) {
+      closure_vars.push_back(var);
+      closure_vals.push_back(fn_->arg_begin() + varToArg_.at(var));
+    } else if (varToVal_.count(var)) {
+      closure_vars.push_back(var);
+      closure_vals.push_back(varToVal_.at(var));
+    }
+  }
+  llvm::Value* packed = packFuncArgs(closure_vals);
+
+  auto VoidTy = llvm::Type::getVoidTy(getContext());
+  auto Int8PtrTy = llvm::Type::getInt8PtrTy(getContext());
+
+  // Create the closure: void(int64_t index, int8_t* packed_data).
+  auto closure_type =
+      llvm::FunctionType::get(VoidTy, {LongTy_, Int8PtrTy}, false);
+  auto closure = llvm::Function::Create(
+      closure_type,
+      llvm::Function::PrivateLinkage,
+      fn_->getName() + "_parallel_loop",
+      module_.get());
+  closure->addFnAttr(llvm::Attribute::NoUnwind);
+
+  auto old_fn = fn_;
+  auto old_ip = irb_.saveIP();
+  fn_ = closure;
+  irb_.SetInsertPoint(llvm::BasicBlock::Create(getContext(), "entry", fn_));
+
+  // Unpack the captured variables inside the closure.
+  std::vector<llvm::Value*> unpacked;
+  if (!closure_vars.empty()) {
+    auto typed_packed =
+        irb_.CreatePointerCast(closure->arg_begin() + 1, packed->getType());
+    unpacked = unpackFuncArgs(typed_packed, closure_vars.size());
+  }
+
+  // Rebind the captured variables to the unpacked values; the kernel's
+  // argument bindings are not valid inside the closure.
+  std::vector<int> old_args(closure_vars.size(), -1);
+  std::vector<llvm::Value*> old_vals(closure_vars.size(), nullptr);
+  for (size_t i = 0; i < closure_vars.size(); i++) {
+    const Var* var = closure_vars[i];
+    auto arg_it = varToArg_.find(var);
+    if (arg_it != varToArg_.end()) {
+      old_args[i] = arg_it->second;
+      varToArg_.erase(arg_it);
+    }
+    auto val_it = varToVal_.find(var);
+    if (val_it != varToVal_.end()) {
+      old_vals[i] = val_it->second;
+    }
+    varToVal_[var] = unpacked[i];
+  }
+
+  // Bind the loop index; For indices are 32-bit in this IR.
+  auto index = irb_.CreateTrunc(closure->arg_begin(), IntTy_);
+  varToVal_.emplace(v->var(), index);
+
+  if (v->body()) {
+    v->body()->accept(this);
+  }
+  irb_.CreateRetVoid();
+
+  // Restore the enclosing function's bindings.
+  varToVal_.erase(v->var());
+  for (size_t i = 0; i < closure_vars.size(); i++) {
+    const Var* var = closure_vars[i];
+    if (old_args[i] != -1) {
+      varToArg_[var] = old_args[i];
+    }
+    if (old_vals[i] != nullptr) {
+      varToVal_[var] = old_vals[i];
+    } else {
+      varToVal_.erase(var);
+    }
+  }
+  fn_ = old_fn;
+  irb_.restoreIP(old_ip);
+
+  // Dispatch the iteration range through at::parallel_for.
+  auto dispatcher_callee = module_->getOrInsertFunction(
+      "DispatchParallel",
+      llvm::FunctionType::get(
+          VoidTy, {Int8PtrTy, LongTy_, LongTy_, Int8PtrTy}, false),
+      {});
+  auto dispatcher = llvm::cast<llvm::Function>(dispatcher_callee.getCallee());
+  dispatcher->addFnAttr(llvm::Attribute::NoUnwind);
+  irb_.CreateCall(
+      dispatcher,
+      {irb_.CreatePointerCast(closure, Int8PtrTy),
+       irb_.CreateSExt(start, LongTy_),
+       irb_.CreateSExt(stop, LongTy_),
+       irb_.CreatePointerCast(packed, Int8PtrTy)});
+  value_ = llvm::ConstantInt::get(IntTy_, 0);
+}
+
 void LLVMCodeGenImpl::visit(const For* v) {
+  if (v->loop_options().is_parallel()) {
+    processParallelFor(v);
+    return;
+  }
+
   // Create "start" and "stop" values.
   v->start()->accept(this);
   auto start = this->value_;
@@ -9,6 +9,14 @@
 #include <string>
 #include <vector>
 
+// Defined in llvm_codegen.cpp; runs a compiled loop body closure over an
+// iteration range with at::parallel_for.
+extern "C" void DispatchParallel(
+    int8_t* func,
+    int64_t start,
+    int64_t stop,
+    int8_t* packed_data) noexcept;
+
 namespace llvm {
 namespace orc {
 
@@ -29,6 +37,9 @@ class TORCH_API PytorchLLVMJITImpl {
     MangleAndInterner Mangle(LLJ->getExecutionSession(), LLJ->getDataLayout());
 
     // Register implementations of intrinsics
+    cantFail(LLJ->defineAbsolute(
+        *Mangle("DispatchParallel"),
+        {llvm::pointerToJITTargetAddress(&DispatchParallel), {}}));
     cantFail(LLJ->defineAbsolute(
         *Mangle("log10f"), {llvm::pointerToJITTargetAddress(&log10f), {}}));
     cantFail(LLJ->defineAbsolute(
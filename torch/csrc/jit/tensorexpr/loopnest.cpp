@@ -652,12 +652,21 @@ Stmt* LoopNest::lowerToStmt(Tensor* t) {
   stmt_to_tensor_[body] = t;
   tensor_to_stmt_[t] = body;
 
-  if (f->ndim() == 0) {
+  if (f->ndim() == 0 && f->reduce_ndim() == 0) {
     return body;
   }
 
-  if (f->ndim() == 0) {
-    throw malformed_input();
+  // For a reduction, the innermost loops iterate the reduced axes and
+  // fold elements into the accumulator, which is initialized right
+  // before them inside the output loops.
+  for (size_t i = 0; i < f->reduce_ndim(); i++) {
+    // Going in reverse order: from innermost loop to the outermost
+    size_t dim_index = f->reduce_ndim() - i - 1;
+    Range r(new IntImm(0), f->reduce_dim(dim_index));
+    body = new For(f->reduce_arg(dim_index), r.start(), r.stop(), body);
+  }
+  if (f->reduce_ndim() > 0) {
+    body = new Block({f->InitStmt(0), body});
   }
 
   for (size_t i = 0; i < f->ndim(); i++) {
@@ -671,7 +680,13 @@ Stmt* LoopNest::lowerToStmt(Tensor* t) {
 
 void LoopNest::computeInline(Stmt* s) {
   // TODO: check if `s` is a body of a loop
-  inlined_functions_.insert(stmt_to_tensor_.at(s)->function());
+  Function* f = stmt_to_tensor_.at(s)->function();
+  if (f->is_reduction()) {
+    // A reduction accumulates into its buffer and cannot be inlined into
+    // its consumers; they read the reduced result through a Load instead.
+    return;
+  }
+  inlined_functions_.insert(f);
 }
 
 void LoopNest::computeInlineWithRandom(Stmt* s) {
@@ -871,6 +886,10 @@ void LoopNest::setGPUThreadIndex(For* f, int thread_index) {
   f->set_gpu_thread_index(thread_index);
 }
 
+void LoopNest::setParallel(For* f) {
+  f->set_parallel();
+}
+
 Stmt* LoopNest::getLoopBodyFor(Tensor* t) const {
   return tensor_to_stmt_.at(t);
 }
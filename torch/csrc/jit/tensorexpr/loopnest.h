@@ -40,6 +40,7 @@ class TORCH_API LoopNest {
 
   void setGPUBlockIndex(For* f, int idx);
   void setGPUThreadIndex(For* f, int idx);
+  void setParallel(For* f);
 
  private:
   std::vector<Tensor*> findAllNeededTensors(
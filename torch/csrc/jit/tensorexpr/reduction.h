@@ -1,7 +1,8 @@
 #pragma once
 
 #include <functional>
-#include <vector>
+#include <limits>
+#include <utility>
 
 #include <torch/csrc/jit/tensorexpr/expr.h>
 #include <torch/csrc/jit/tensorexpr/ir.h>
@@ -10,83 +11,56 @@ namespace torch {
 namespace jit {
 namespace tensorexpr {
 
-class Function : public KernelScopedObject {
+// An aggregate operation used by Reduce() to combine the elements of the
+// reduced axes. It provides the identity value the accumulator starts from
+// and the interaction that folds one element into the accumulator.
+class Reducer {
  public:
-  Function(
-      const std::string& func_name,
-      const std::vector<const Expr*>& dims,
-      const std::vector<const Var*>& args,
-      const Expr* body)
-      : func_vars_({VarHandle(func_name, kHandle).node()}),
-        dims_(dims),
-        args_(args),
-        bodies_({body}) {}
-  Function(
-      const std::vector<std::string>& func_names,
-      const std::vector<const Expr*>& dims,
-      const std::vector<const Var*>& args,
-      const std::vector<const Expr*>& bodies)
-      : func_vars_(func_names.size()),
-        dims_(dims),
-        args_(args),
-        bodies_(bodies) {
-    for (size_t i = 0; i < func_names.size(); i++) {
-      func_vars_[i] = new Var(func_names[i], kHandle);
-    }
-  }
-
-  int ndim() const {
-    return dims_.size();
-  }
-  const Expr* dim(int index) const {
-    if (index < 0 || index >= ndim()) {
-      throw out_of_range_index();
-    }
-
-    return dims_[index];
-  }
-  const std::vector<const Expr*>& dims() const {
-    return dims_;
-  }
-  const Var* arg(int index) const {
-    if (index < 0 || index >= ndim()) {
-      throw out_of_range_index();
-    }
+  using InitFn = std::function<ExprHandle(Dtype)>;
+  using InteractionFn =
+      std::function<ExprHandle(const ExprHandle&, const ExprHandle&)>;
 
-    return args_[index];
-  }
-  const std::vector<const Var*>& args() const {
-    return args_;
-  }
+  Reducer(InitFn init, InteractionFn interaction)
+      : init_(std::move(init)), interaction_(std::move(interaction)) {}
 
-  std::vector<const Expr*> bodies() const {
-    return bodies_;
+  ExprHandle initializer(Dtype dtype) const {
+    return init_(dtype);
   }
-  const Expr* body(size_t index) const {
-    if (index >= bodies_.size()) {
-      throw out_of_range_index();
-    }
 
-    return bodies_[index];
+  ExprHandle combine(const ExprHandle& accumulator, const ExprHandle& value)
+      const {
+    return interaction_(accumulator, value);
   }
 
-  std::vector<const Var*> func_vars() const {
-    return func_vars_;
-  }
-  const Var* func_var(size_t index) const {
-    if (index >= func_vars_.size()) {
-      throw out_of_range_index();
-    }
-    return func_vars_[index];
-  }
+ private:
+  InitFn init_;
+  InteractionFn interaction_;
+};
 
-  Stmt* ElementStmt(size_t index);
+// Sums the elements of the reduced axes.
+class Sum : public Reducer {
+ public:
+  Sum()
+      : Reducer(
+            [](Dtype dtype) { return Cast::make(dtype, ExprHandle(0)); },
+            [](const ExprHandle& accumulator, const ExprHandle& value) {
+              return accumulator + value;
+            }) {}
+};
 
- private:
-  std::vector<const Var*> func_vars_;
-  std::vector<const Expr*> dims_;
-  std::vector<const Var*> args_;
-  std::vector<const Expr*> bodies_;
+// Takes the maximum of the elements of the reduced axes. Only meaningful
+// for floating point dtypes.
+class Maximum : public Reducer {
+ public:
+  Maximum()
+      : Reducer(
+            [](Dtype dtype) {
+              return Cast::make(
+                  dtype, ExprHandle(-std::numeric_limits<float>::infinity()));
+            },
+            [](const ExprHandle& accumulator, const ExprHandle& value) {
+              return Max::make(accumulator, value, true);
+            }) {}
 };
 
 } // namespace tensorexpr
@@ -419,12 +419,26 @@ class LoopOptions {
     gpu_thread_index_ = index;
   }
 
+  // CPU parallel execution (at::parallel_for)
+  bool is_parallel() const {
+    return is_parallel_;
+  }
+
+  void set_parallel() {
+    if (is_gpu_block_index() || is_gpu_thread_index()) {
+      throw std::runtime_error("Cannot make a GPU-bound axis parallel");
+    }
+    is_parallel_ = true;
+  }
+
   std::string ToString() const {
     std::ostringstream oss;
     if (is_gpu_block_index()) {
       oss << gpu_block_index_str();
     } else if (is_gpu_thread_index()) {
       oss << gpu_thread_index_str();
+    } else if (is_parallel()) {
+      oss << "parallel";
     }
     return oss.str();
   }
@@ -432,6 +446,7 @@ class LoopOptions {
  private:
   int gpu_block_index_ = -1;
   int gpu_thread_index_ = -1;
+  bool is_parallel_ = false;
 };
 
 class For : public StmtNode<For> {
@@ -525,6 +540,10 @@ class For : public StmtNode<For> {
     loop_options_.set_gpu_thread_index(thread_index);
   }
 
+  void set_parallel() {
+    loop_options_.set_parallel();
+  }
+
  private:
   const Var* var_;
   const Expr* start_;
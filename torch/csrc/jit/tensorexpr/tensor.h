@@ -5,6 +5,7 @@
 
 #include <torch/csrc/jit/tensorexpr/expr.h>
 #include <torch/csrc/jit/tensorexpr/function.h>
+#include <torch/csrc/jit/tensorexpr/reduction.h>
 
 namespace torch {
 namespace jit {
@@ -108,6 +109,16 @@ TORCH_API Tensor* Compute(
     const std::vector<DimArg>& dim_args,
     const std::function<ExprHandle(const std::vector<VarHandle>&)>& body_func);
 
+// Creates a tensor that reduces the axes given by reduce_dim_args into the
+// dimensions given by dim_args; body_func receives the output indices
+// followed by the reduce indices.
+TORCH_API Tensor* Reduce(
+    const std::string& func_name,
+    const std::vector<DimArg>& dim_args,
+    const Reducer& reducer,
+    const std::function<ExprHandle(const std::vector<VarHandle>&)>& body_func,
+    const std::vector<DimArg>& reduce_dim_args);
+
 class FunctionCall : public CallNode<FunctionCall> {
  public:
   using BaseClass = CallNode<FunctionCall>;
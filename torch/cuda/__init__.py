@@ -317,6 +317,34 @@ def stream(stream):
         torch._C._cuda_setStream(src_prev_stream._cdata)
 
 
+@contextlib.contextmanager
+def matmul_precision(mode):
+    r"""Context-manager that scopes the cuBLAS math mode for matmuls.
+
+    The mode is thread-local, so precision can be traded for speed per call
+    site: run attention score matmuls under ``"precise"`` while MLP blocks
+    use ``"fast"``.
+
+    Arguments:
+        mode (str): one of ``"default"``, ``"fast"`` (additionally allows
+            fp32 matmuls to run on tensor cores with the inputs implicitly
+            down-converted to fp16; accumulation stays fp32) and
+            ``"precise"`` (keeps even fp16 matmuls off the tensor-op path).
+
+    Example::
+
+        with torch.cuda.matmul_precision('fast'):
+            hidden = mlp(hidden)  # reduced-precision tensor-op matmuls
+    """
+    _lazy_init()
+    prev = torch._C._cuda_getBlasMathMode()
+    torch._C._cuda_setBlasMathMode(mode)
+    try:
+        yield
+    finally:
+        torch._C._cuda_setBlasMathMode(prev)
+
+
 def device_count():
     r"""Returns the number of GPUs available."""
     if is_available():
@@ -396,6 +424,10 @@ from .memory import *
 
 from .random import *
 
+from .graphs import CUDAGraph
+
+from .readback import ScalarFuture, async_item
+
 ################################################################################
 # Define Storage and Tensor classes
 ################################################################################
@@ -0,0 +1,63 @@
+import torch
+
+
+class CUDAGraph(object):
+    r"""Records a sequence of CUDA work into a CUDA graph and replays it with
+    a single launch.
+
+    Capture must run under a non-default stream after the workload has been
+    warmed up, and every replay re-executes against the same device buffers:
+    shapes must be static, inputs must be copied into the tensors used during
+    capture (and outputs read from the tensors it produced). Memory backing
+    those tensors is kept alive by the caching allocator until :meth:`reset`
+    or garbage collection.
+
+    Example::
+
+        s = torch.cuda.Stream()
+        s.wait_stream(torch.cuda.current_stream())
+        with torch.cuda.stream(s):
+            model(static_input)  # warmup
+            g = torch.cuda.CUDAGraph()
+            g.capture_begin()
+            static_output = model(static_input)
+            g.capture_end()
+        torch.cuda.current_stream().wait_stream(s)
+
+        static_input.copy_(next_input)
+        g.replay()
+        result = static_output.clone()
+
+    Requires CUDA 10.2 or later.
+    """
+
+    def __init__(self):
+        self._handle = None
+
+    def capture_begin(self):
+        r"""Begins capturing CUDA work on the current stream."""
+        if self._handle is not None:
+            raise RuntimeError("This CUDAGraph has already captured a graph")
+        torch._C._cuda_graphCaptureBegin()
+
+    def capture_end(self):
+        r"""Ends capture and instantiates the graph for replay."""
+        self._handle = torch._C._cuda_graphCaptureEnd()
+
+    def replay(self):
+        r"""Replays the captured work on the current stream."""
+        if self._handle is None:
+            raise RuntimeError("This CUDAGraph has not captured a graph yet")
+        torch._C._cuda_graphReplay(self._handle)
+
+    def reset(self):
+        r"""Destroys the captured graph and releases its pinned memory."""
+        if self._handle is not None:
+            torch._C._cuda_graphFree(self._handle)
+            self._handle = None
+
+    def __del__(self):
+        try:
+            self.reset()
+        except Exception:
+            pass
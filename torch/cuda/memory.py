@@ -86,6 +86,26 @@ def empty_cache():
         torch._C._cuda_emptyCache()
 
 
+def compact_cache():
+    r"""Releases the cached large-pool segments held by the caching allocator
+    while keeping the small-block cache intact.
+
+    Intended as a cheap compaction point between batches for workloads with
+    variable allocation sizes: pending stream-ordered frees are drained first
+    so idle segments have coalesced, and the released segments let the driver
+    hand out contiguous memory again. Combine with the
+    ``PYTORCH_CUDA_MAX_SPLIT_MB`` environment variable, which keeps the
+    largest cached segments from being split (and thereby pinned) by small
+    allocations.
+
+    .. note::
+        See :ref:`cuda-memory-management` for more details about GPU memory
+        management.
+    """
+    if is_initialized():
+        torch._C._cuda_compactCache()
+
+
 def memory_stats(device=None):
     r"""Returns a dictionary of CUDA memory allocator statistics for a
     given device.
@@ -169,6 +189,45 @@ def memory_stats_as_nested_dict(device=None):
     return torch._C._cuda_memoryStats(device)
 
 
+def host_memory_stats():
+    r"""Returns a dictionary of pinned host memory pool statistics.
+
+    Pinned (page-locked) host buffers used for asynchronous H2D/D2H copies
+    are cached in a process-wide pool with size-class recycling, so this
+    function takes no device argument. The layout mirrors
+    :func:`~torch.cuda.memory_stats`:
+
+    - ``"allocation.{current,peak,allocated,freed}"``: number of pinned
+      allocations handed out to client code.
+    - ``"allocated_bytes.{current,peak,allocated,freed}"``: amount of pinned
+      memory handed out, rounded to size classes.
+    - ``"reserved_bytes.{current,peak,allocated,freed}"``: amount of pinned
+      memory held by the pool, both free and used.
+    - ``"num_host_allocs"``: number of ``cudaHostAlloc`` calls (pool misses).
+    - ``"num_reuses"``: number of requests served from a cached slab.
+
+    Set the ``PYTORCH_PINNED_PREALLOC`` environment variable to reserve
+    spare slabs of a size class whenever that class misses the pool.
+    """
+    result = []
+
+    def _recurse_add_to_result(prefix, obj):
+        if isinstance(obj, dict):
+            if len(prefix) > 0:
+                prefix += "."
+            for k, v in obj.items():
+                _recurse_add_to_result(prefix + k, v)
+        else:
+            result.append((prefix, obj))
+
+    if not is_initialized():
+        return collections.OrderedDict()
+    _recurse_add_to_result("", torch._C._cuda_hostMemoryStats())
+    result.sort()
+
+    return collections.OrderedDict(result)
+
+
 def reset_accumulated_memory_stats(device=None):
     r"""Resets the "accumulated" (historical) stats tracked by the CUDA memory allocator.
 
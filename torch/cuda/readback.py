@@ -0,0 +1,77 @@
+import torch
+
+# One readback stream per device so enqueued copies never serialize the
+# compute stream; created lazily on first use.
+_readback_streams = {}
+
+
+def _get_readback_stream(device):
+    stream = _readback_streams.get(device)
+    if stream is None:
+        stream = torch.cuda.Stream(device=device)
+        _readback_streams[device] = stream
+    return stream
+
+
+class ScalarFuture(object):
+    r"""A pending device-to-host scalar readback, created by
+    :func:`~torch.cuda.async_item`.
+
+    The copy runs on a per-device side stream into a pinned host buffer, so
+    creating the future never blocks. Call :meth:`query` to poll and
+    :meth:`value` to wait for and return the Python number.
+    """
+
+    def __init__(self, tensor):
+        if not tensor.is_cuda:
+            raise ValueError("async_item expects a CUDA tensor")
+        if tensor.numel() != 1:
+            raise ValueError(
+                "async_item expects a tensor with one element, got {}"
+                .format(tensor.numel()))
+        tensor = tensor.detach()
+        stream = _get_readback_stream(tensor.device.index)
+        stream.wait_stream(torch.cuda.current_stream(tensor.device))
+        with torch.cuda.stream(stream):
+            self._buffer = torch.empty(
+                (), dtype=tensor.dtype, pin_memory=True)
+            self._buffer.copy_(tensor.reshape(()), non_blocking=True)
+            self._event = torch.cuda.Event()
+            self._event.record(stream)
+        # The source is now in use on the side stream; keep the caching
+        # allocator from handing its memory out before the copy lands.
+        tensor.record_stream(stream)
+
+    def query(self):
+        r"""Returns True if the readback has completed."""
+        return self._event.query()
+
+    def value(self):
+        r"""Waits for the readback to complete and returns the value as a
+        Python number."""
+        self._event.synchronize()
+        return self._buffer.item()
+
+
+def async_item(tensor):
+    r"""Starts a non-blocking device-to-host readback of a one-element CUDA
+    tensor and returns a :class:`~torch.cuda.ScalarFuture`.
+
+    Unlike :meth:`~torch.Tensor.item`, which synchronizes the current stream
+    before returning, this enqueues the copy on a per-device side stream and
+    returns immediately, so metric collection never serializes the GPU.
+    Typical use is deferred logging: collect futures during the step and
+    resolve them at reporting time, when the values have long since landed.
+
+    Example::
+
+        losses = []
+        for inputs, target in loader:
+            loss = step(inputs, target)
+            losses.append(torch.cuda.async_item(loss))
+        print([f.value() for f in losses])
+
+    Arguments:
+        tensor (Tensor): a CUDA tensor with exactly one element.
+    """
+    return ScalarFuture(tensor)
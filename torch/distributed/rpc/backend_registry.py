@@ -142,3 +142,48 @@ register_backend(
     _process_group_construct_rpc_backend_options_handler,
     _process_group_init_backend_handler,
 )
+
+
+def _socket_construct_rpc_backend_options_handler(
+    rpc_timeout,
+    init_method,
+    num_worker_threads=rpc_constants.DEFAULT_NUM_WORKER_THREADS,
+    **kwargs
+):
+    from . import SocketRpcBackendOptions
+
+    return SocketRpcBackendOptions(
+        rpc_timeout=rpc_timeout,
+        init_method=init_method,
+        num_worker_threads=num_worker_threads,
+    )
+
+
+def _socket_init_backend_handler(store, name, rank, world_size, rpc_backend_options):
+    from . import SocketAgent
+
+    if world_size is None or world_size < 2:
+        raise RuntimeError(
+            "SocketAgent requires world_size to be at least 2, but got {}".format(
+                world_size
+            )
+        )
+
+    # Unlike the process group backend, the socket backend exchanges peer
+    # addresses directly through the store and talks to each peer over a
+    # dedicated TCP connection, so no default process group is created.
+    return SocketAgent(
+        name,
+        rank,
+        world_size,
+        store,
+        rpc_backend_options.num_worker_threads,
+        rpc_backend_options.rpc_timeout,
+    )
+
+
+register_backend(
+    "SOCKET",
+    _socket_construct_rpc_backend_options_handler,
+    _socket_init_backend_handler,
+)
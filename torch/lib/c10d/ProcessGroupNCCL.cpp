@@ -4,6 +4,8 @@
 #include <tuple>
 #include <unordered_set>
 
+#include <unistd.h>
+
 #include <THC/THC.h>
 
 #include <ATen/cuda/CUDAContext.h>
@@ -286,6 +288,26 @@ ProcessGroupNCCL::ProcessGroupNCCL(
         std::string(NCCL_BLOCKING_WAIT));
   }
 
+  char* hierarchicalAllreduce = getenv(NCCL_HIERARCHICAL_ALLREDUCE);
+  try {
+    if (hierarchicalAllreduce != nullptr) {
+      auto val = std::stoi(hierarchicalAllreduce);
+      if (val == 1) {
+        // Compose allreduce from intra-node and inter-node phases when
+        // the rank topology allows it.
+        hierarchicalAllreduce_ = true;
+      } else if (val != 0) {
+        throw std::runtime_error(
+            "Invalid value for environment variable: " +
+            std::string(NCCL_HIERARCHICAL_ALLREDUCE));
+      }
+    }
+  } catch (std::exception& e) {
+    throw std::runtime_error(
+        "Invalid value for environment variable: " +
+        std::string(NCCL_HIERARCHICAL_ALLREDUCE));
+  }
+
 #ifdef ENABLE_NCCL_ERROR_CHECKING
   ncclCommWatchdogThread_ =
       std::thread(&ProcessGroupNCCL::ncclCommWatchdog, this);
@@ -535,6 +557,114 @@ std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getNCCLComm(
   return devNCCLCommMap_[devicesKey];
 }
 
+bool ProcessGroupNCCL::resolveHierarchicalTopology() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (topologyResolved_) {
+    return hierarchyEligible_;
+  }
+
+  char hostname[256];
+  if (gethostname(hostname, sizeof(hostname)) != 0) {
+    throw std::runtime_error(
+        "gethostname failed while resolving rank topology");
+  }
+  hostname[sizeof(hostname) - 1] = '\0';
+  std::string host(hostname);
+
+  // Publish our hostname and collect everybody else's. The store blocks
+  // in get() until the peer has published, so this doubles as a barrier.
+  store_->set(
+      "hier_hostname:" + std::to_string(rank_),
+      std::vector<uint8_t>(host.begin(), host.end()));
+
+  // Group ranks by hostname, in order of first appearance.
+  std::vector<std::vector<int>> nodeRanks;
+  std::unordered_map<std::string, size_t> nodeIndex;
+  for (int r = 0; r < size_; r++) {
+    auto vec = store_->get("hier_hostname:" + std::to_string(r));
+    std::string peer(vec.begin(), vec.end());
+    auto it = nodeIndex.find(peer);
+    if (it == nodeIndex.end()) {
+      it = nodeIndex.emplace(peer, nodeRanks.size()).first;
+      nodeRanks.emplace_back();
+    }
+    if (r == rank_) {
+      nodeId_ = it->second;
+      localRank_ = nodeRanks[it->second].size();
+    }
+    nodeRanks[it->second].push_back(r);
+  }
+
+  numNodes_ = nodeRanks.size();
+  localSize_ = nodeRanks[nodeId_].size();
+
+  // The hierarchy only pays off across nodes, and the cross-node groups
+  // are only well formed when every node holds the same number of ranks.
+  hierarchyEligible_ = numNodes_ > 1 && localSize_ > 1;
+  for (const auto& ranks : nodeRanks) {
+    if (ranks.size() != static_cast<size_t>(localSize_)) {
+      hierarchyEligible_ = false;
+    }
+  }
+
+  topologyResolved_ = true;
+  return hierarchyEligible_;
+}
+
+std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getSubgroupNCCLComm(
+    const std::string& commKey,
+    const std::vector<at::Device>& devices,
+    int groupRank,
+    int groupSize) {
+  TORCH_INTERNAL_ASSERT(devices.size() == 1);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (devNCCLCommMap_.find(commKey) != devNCCLCommMap_.end()) {
+      // Reuse the cached communicator if there is one.
+      return devNCCLCommMap_[commKey];
+    }
+  }
+
+  // The subgroup leader creates the unique ID and publishes it under the
+  // commKey. Unlike broadcastUniqueNCCLID, which keys off a sequence
+  // number and assumes rank 0 leads, every subgroup has its own leader
+  // and therefore needs its own store key.
+  ncclUniqueId ncclID;
+  if (groupRank == 0) {
+    C10D_NCCL_CHECK(ncclGetUniqueId(&ncclID));
+    auto vec = std::vector<uint8_t>(
+        reinterpret_cast<uint8_t*>(&ncclID),
+        reinterpret_cast<uint8_t*>(&ncclID) + NCCL_UNIQUE_ID_BYTES);
+    store_->set("hier_id:" + commKey, vec);
+  } else {
+    auto vec = store_->get("hier_id:" + commKey);
+    TORCH_CHECK(vec.size() == NCCL_UNIQUE_ID_BYTES);
+    std::memcpy(&ncclID, vec.data(), vec.size());
+  }
+
+  at::cuda::OptionalCUDAGuard gpuGuard;
+  gpuGuard.set_index(devices[0].index());
+
+  std::vector<std::shared_ptr<NCCLComm>> ncclComms;
+  ncclComms.push_back(NCCLComm::create(groupSize, groupRank, ncclID));
+
+  std::vector<at::cuda::CUDAStream> streamVal;
+  streamVal.push_back(at::cuda::getStreamFromPool());
+
+  ncclStreams_.emplace(commKey, std::move(streamVal));
+  ncclEvents_.emplace(
+      std::piecewise_construct,
+      std::make_tuple(commKey),
+      std::make_tuple(devices.size()));
+
+  // Hold the lock before modifying the cache.
+  std::lock_guard<std::mutex> lock(mutex_);
+  ncclIdToCommMap_.emplace(buildNcclUniqueIdStr(ncclID), ncclComms);
+  devNCCLCommMap_.emplace(commKey, std::move(ncclComms));
+  return devNCCLCommMap_[commKey];
+}
+
 namespace {
 
 // Check that all `tensors' have the same type and shape and are distributed
@@ -698,11 +828,44 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::collective(
       [](std::vector<at::cuda::CUDAStream>&) {});
 }
 
+// Note [Hierarchical allreduce]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A flat ring allreduce treats every link the same, so with N nodes of L
+// ranks each the inter-node fabric carries nearly the full bucket size
+// per rank even though it is typically an order of magnitude slower than
+// the intra-node links. When ranks are grouped by node we can instead:
+//
+//   1. reduce-scatter within the node, leaving each local rank with a
+//      1/L-th shard of the node-local sum,
+//   2. allreduce each shard across nodes, between the ranks that occupy
+//      the same position on their respective nodes,
+//   3. allgather the globally reduced shards within the node.
+//
+// Only step 2 crosses the node boundary and it moves 1/L-th of the data,
+// cutting inter-node traffic by the node size. The composition is exact
+// for any associative, commutative reduction, which covers every op we
+// map to NCCL.
+//
+// Node membership is discovered by exchanging hostnames through the store
+// (see resolveHierarchicalTopology) and the hierarchy is used only when
+// there is more than one node, more than one rank per node, and every
+// node holds the same number of ranks. The path further requires a single
+// GPU per process; the multi-device-per-process layout would interleave
+// the device and node dimensions in the rank space. Everything else falls
+// back to the flat allreduce. Enablement (NCCL_HIERARCHICAL_ALLREDUCE or
+// setHierarchicalAllreduce) must agree across ranks since it changes the
+// sequence of collectives issued on the shared communicators.
 std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce(
     std::vector<at::Tensor>& tensors,
     const AllreduceOptions& opts) {
   check_gpu_tensors(tensors);
 
+  // See Note [Hierarchical allreduce].
+  if (hierarchicalAllreduce_ && tensors.size() == 1 &&
+      tensors[0].numel() > 0 && resolveHierarchicalTopology()) {
+    return hierarchicalAllreduce(tensors, opts);
+  }
+
   return collective(
       tensors,
       tensors,
@@ -721,6 +884,109 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce(
       });
 }
 
+std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::hierarchicalAllreduce(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  const auto devices = getDeviceList(tensors);
+  const auto key = getKeyFromDevices(devices);
+
+  // One communicator among the ranks of this node, and one among the
+  // ranks that occupy this position on their respective nodes.
+  const auto localKey = "hier_local:" + std::to_string(nodeId_) + ":" + key;
+  const auto crossKey = "hier_cross:" + std::to_string(localRank_) + ":" + key;
+  auto& localComms =
+      getSubgroupNCCLComm(localKey, devices, localRank_, localSize_);
+  auto& crossComms = getSubgroupNCCLComm(crossKey, devices, nodeId_, numNodes_);
+
+  // All three phases run on the local communicator's NCCL stream, so the
+  // cross-node phase is ordered after the intra-node reduce-scatter (and
+  // before the allgather) simply by stream order.
+  syncStreams(devices, ncclEvents_[localKey], ncclStreams_[localKey]);
+
+  auto work = initWork(devices);
+
+  auto& tensor = tensors[0];
+  at::cuda::CUDAStream& ncclStream = ncclStreams_[localKey][0];
+
+  const auto count = tensor.numel();
+  const auto shard = (count + localSize_ - 1) / localSize_;
+  const auto dataType = getNcclDataType(tensor.scalar_type());
+
+  at::cuda::CUDAGuard gpuGuard(devices[0]);
+
+  // Staging buffer, padded so it splits into localSize_ equal shards. The
+  // pad elements are reduced and gathered like any others but never
+  // copied back. It is allocated on the NCCL stream so the caching
+  // allocator already associates it with its usage stream.
+  at::Tensor flat;
+  {
+    at::cuda::CUDAStreamGuard streamGuard(ncclStream);
+    flat = at::empty({shard * localSize_}, tensor.options());
+    flat.narrow(0, 0, count).copy_(tensor.view({count}), true);
+  }
+
+  // See [Sync Streams].
+  c10::cuda::CUDACachingAllocator::recordStream(
+      tensor.storage().data_ptr(), ncclStream);
+
+  void* flatPtr = flat.data_ptr();
+  void* shardPtr = static_cast<uint8_t*>(flatPtr) +
+      localRank_ * shard * tensor.element_size();
+
+  // The phases must issue in separate NCCL groups; within a single group
+  // NCCL is free to aggregate operations, which would break the ordering
+  // between them.
+  {
+    AutoNcclGroup nccl_group_guard;
+    // 1. Intra-node reduce-scatter, in place into this rank's shard.
+    C10D_NCCL_CHECK(ncclReduceScatter(
+        flatPtr,
+        shardPtr,
+        shard,
+        dataType,
+        ncclOp[opts.reduceOp],
+        localComms[0]->getNcclComm(),
+        ncclStream.stream()));
+  }
+  {
+    AutoNcclGroup nccl_group_guard;
+    // 2. Inter-node allreduce of the shard.
+    C10D_NCCL_CHECK(ncclAllReduce(
+        shardPtr,
+        shardPtr,
+        shard,
+        dataType,
+        ncclOp[opts.reduceOp],
+        crossComms[0]->getNcclComm(),
+        ncclStream.stream()));
+  }
+  {
+    AutoNcclGroup nccl_group_guard;
+    // 3. Intra-node allgather of the reduced shards, in place.
+    C10D_NCCL_CHECK(ncclAllGather(
+        shardPtr,
+        flatPtr,
+        shard,
+        dataType,
+        localComms[0]->getNcclComm(),
+        ncclStream.stream()));
+  }
+
+  {
+    at::cuda::CUDAStreamGuard streamGuard(ncclStream);
+    tensor.view({count}).copy_(flat.narrow(0, 0, count), true);
+  }
+
+  // Event should only be recorded after the ncclGroupEnd()
+  work->cudaEvents_[0].record(ncclStream);
+  work->ncclComms_ = {localComms[0], crossComms[0]};
+  work->blockingWait_ = blockingWait_;
+  work->opTimeout_ = opTimeout_;
+  work->store_ = store_;
+
+  return work;
+}
+
 std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce_coalesced(
     std::vector<at::Tensor>& tensors,
     const AllreduceCoalescedOptions& opts) {
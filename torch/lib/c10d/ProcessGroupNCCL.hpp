@@ -17,6 +17,12 @@ namespace c10d {
 // non-blocking.
 constexpr const char* NCCL_BLOCKING_WAIT = "NCCL_BLOCKING_WAIT";
 
+// Environment variable which controls whether allreduce is composed from
+// intra-node and inter-node phases when the rank topology allows it.
+// See Note [Hierarchical allreduce] in ProcessGroupNCCL.cpp.
+constexpr const char* NCCL_HIERARCHICAL_ALLREDUCE =
+    "NCCL_HIERARCHICAL_ALLREDUCE";
+
 // ProcessGroupNCCL implements NCCL bindings for c10d.
 //
 // All functions of the class are expected to be called in the same order
@@ -174,6 +180,16 @@ class ProcessGroupNCCL : public ProcessGroup {
       const AllreduceCoalescedOptions& opts =
           AllreduceCoalescedOptions()) override;
 
+  // Enables or disables the hierarchical allreduce composition for this
+  // process group. Since it changes the sequence of collectives issued on
+  // the shared communicators, it must be set to the same value on every
+  // rank. The NCCL_HIERARCHICAL_ALLREDUCE environment variable provides
+  // the initial value. See Note [Hierarchical allreduce] in
+  // ProcessGroupNCCL.cpp.
+  void setHierarchicalAllreduce(bool enable) {
+    hierarchicalAllreduce_ = enable;
+  }
+
   std::shared_ptr<ProcessGroup::Work> reduce(
       std::vector<at::Tensor>& tensors,
       const ReduceOptions& opts = ReduceOptions()) override;
@@ -238,6 +254,28 @@ class ProcessGroupNCCL : public ProcessGroup {
       const std::string& devicesKey,
       const std::vector<at::Device>& devices);
 
+  // Helper that creates (or returns the cached) NCCL communicator spanning
+  // a subset of the ranks in this process group. The subgroup leader
+  // (groupRank 0) publishes the NCCL unique ID in the store under a key
+  // derived from `commKey`, which must therefore be distinct per subgroup.
+  // Used by the hierarchical allreduce.
+  std::vector<std::shared_ptr<NCCLComm>>& getSubgroupNCCLComm(
+      const std::string& commKey,
+      const std::vector<at::Device>& devices,
+      int groupRank,
+      int groupSize);
+
+  // Exchanges hostnames through the store to discover which ranks share a
+  // node. Returns true if the topology is eligible for hierarchical
+  // allreduce: more than one node, more than one rank per node, and the
+  // same number of ranks on every node. The result is cached.
+  bool resolveHierarchicalTopology();
+
+  // See Note [Hierarchical allreduce] in ProcessGroupNCCL.cpp.
+  std::shared_ptr<ProcessGroup::Work> hierarchicalAllreduce(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
   // Wrapper method which can be overridden for tests.
   virtual std::exception_ptr checkForNCCLErrors(
       const std::vector<std::shared_ptr<NCCLComm>>& ncclComms);
@@ -372,6 +410,20 @@ class ProcessGroupNCCL : public ProcessGroup {
   // Timeout for operations. This is only used when blockingWait_ is enabled.
   std::chrono::milliseconds opTimeout_;
 
+  // Hierarchical allreduce state.
+  // See Note [Hierarchical allreduce] in ProcessGroupNCCL.cpp.
+  bool hierarchicalAllreduce_ = false;
+  bool topologyResolved_ = false;
+  bool hierarchyEligible_ = false;
+
+  // Index of this rank's node, this rank's position within its node, the
+  // number of ranks per node, and the number of nodes. Only valid once
+  // `topologyResolved_` is set.
+  int nodeId_ = 0;
+  int localRank_ = 0;
+  int localSize_ = 1;
+  int numNodes_ = 1;
+
   // Set of communicators that this process group has aborted and their
   // ncclUniqueId has been written to the store. We don't need a lock
   // for this map since only the watchdog thread accesses this set. The
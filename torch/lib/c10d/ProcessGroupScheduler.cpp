@@ -0,0 +1,457 @@
+#include <c10d/ProcessGroupScheduler.hpp>
+
+#include <limits>
+
+namespace c10d {
+
+namespace {
+
+// The c10d library does not depend on torch/csrc, so flattening is done
+// with plain ATen calls instead of torch::utils::flatten_dense_tensors.
+at::Tensor flattenTensors(const std::vector<at::Tensor>& tensors) {
+  std::vector<at::Tensor> flat;
+  flat.reserve(tensors.size());
+  for (const auto& tensor : tensors) {
+    flat.push_back(tensor.contiguous().view({-1}));
+  }
+  return at::cat(flat);
+}
+
+std::vector<at::Tensor> unflattenTensors(
+    const at::Tensor& flat,
+    const std::vector<at::Tensor>& shaped) {
+  std::vector<at::Tensor> outputs;
+  outputs.reserve(shaped.size());
+  int64_t offset = 0;
+  for (const auto& tensor : shaped) {
+    const auto numel = tensor.numel();
+    outputs.push_back(flat.narrow(0, offset, numel).view(tensor.sizes()));
+    offset += numel;
+  }
+  return outputs;
+}
+
+} // namespace
+
+// Note [Collective fusion and scheduling]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Collectives from independent modules arrive interleaved and each one
+// pays the full launch and latency cost of the underlying process group.
+// This wrapper queues them and lets a background thread issue them in
+// batches, fusing adjacent compatible allreduce/broadcast calls into a
+// single flattened call.
+//
+// The central correctness problem is that every rank must issue the same
+// sequence of calls on the underlying process group. Flushing purely on a
+// local timer would break this: one rank's window may close after three
+// queued operations, another's after four, and the fused tensors would no
+// longer match. Instead, every flush starts with a negotiation round: an
+// allreduce(MIN) of each rank's queued-operation count. All ranks receive
+// the same minimum, issue exactly that many operations from their
+// (identical, per the usage contract) queues, and therefore produce
+// identical fusion groups. The negotiation rounds themselves are ordinary
+// collectives issued from a single thread, so they stay ordered with
+// respect to the batches they precede.
+//
+// Because negotiated flushes are the only thing that touches the
+// underlying process group, there is no truly out-of-band "bypass" lane:
+// reordering an operation around a fused batch on the same communicator
+// would again diverge between ranks. Priority is therefore expressed in
+// time rather than order: operations at or below priorityBytesThreshold
+// (and operations a caller is blocked on in wait()) make the background
+// thread negotiate immediately instead of waiting out the fusion window,
+// so a loss-scalar allreduce is only ever delayed by the negotiation
+// itself, not by the batching window.
+//
+// Shutdown is collective: the destructor joins one final negotiation
+// round contributing a "stopping" flag, and only exits once every rank
+// contributes it. Callers must wait on all outstanding work objects
+// before destroying the wrapper on any rank.
+
+ProcessGroupScheduler::ProcessGroupScheduler(
+    std::shared_ptr<ProcessGroup> processGroup,
+    Options options)
+    : ProcessGroup(processGroup->getRank(), processGroup->getSize()),
+      pg_(std::move(processGroup)),
+      options_(options),
+      shared_(std::make_shared<Shared>()) {
+  schedulerThread_ = std::thread(&ProcessGroupScheduler::runLoop, this);
+}
+
+ProcessGroupScheduler::~ProcessGroupScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(shared_->mutex);
+    stop_ = true;
+  }
+  shared_->cv.notify_all();
+  schedulerThread_.join();
+}
+
+bool ProcessGroupScheduler::WorkScheduled::wait() {
+  // Flag the scheduler so the flush happens at the next negotiation round
+  // instead of after the fusion window.
+  ++shared_->urgent;
+  shared_->cv.notify_all();
+  try {
+    const auto ret = ProcessGroup::Work::wait();
+    --shared_->urgent;
+    return ret;
+  } catch (...) {
+    --shared_->urgent;
+    throw;
+  }
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::scheduleOp(Op op) {
+  op.work = std::make_shared<WorkScheduled>(shared_);
+  auto work = op.work;
+  {
+    std::lock_guard<std::mutex> lock(shared_->mutex);
+    TORCH_CHECK(!stop_, "ProcessGroupScheduler is shutting down");
+    if (!everScheduled_) {
+      everScheduled_ = true;
+      // The negotiation tensor lives where the data lives, so NCCL-backed
+      // groups negotiate over device tensors and Gloo over CPU tensors.
+      const auto& reference =
+          op.tensors.empty() ? at::Tensor() : op.tensors.front();
+      negotiationOptions_ = reference.defined()
+          ? reference.options().dtype(at::kLong)
+          : at::TensorOptions().dtype(at::kLong);
+    }
+    op.urgent = op.bytes <= options_.priorityBytesThreshold;
+    if (op.urgent) {
+      ++pendingUrgent_;
+    }
+    queue_.push_back(std::move(op));
+  }
+  shared_->cv.notify_all();
+  return work;
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::schedulePassthrough(
+    std::function<std::shared_ptr<ProcessGroup::Work>()> issue) {
+  Op op;
+  op.type = OpType::OTHER;
+  op.issue = std::move(issue);
+  return scheduleOp(std::move(op));
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::allreduce(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  Op op;
+  if (tensors.size() == 1 && tensors.front().is_non_overlapping_and_dense()) {
+    op.type = OpType::ALLREDUCE;
+    op.tensors = tensors;
+    op.allreduceOpts = opts;
+    op.bytes = tensors.front().numel() * tensors.front().element_size();
+    return scheduleOp(std::move(op));
+  }
+  auto copy = tensors;
+  return schedulePassthrough(
+      [this, copy, opts]() mutable { return pg_->allreduce(copy, opts); });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::broadcast(
+    std::vector<at::Tensor>& tensors,
+    const BroadcastOptions& opts) {
+  Op op;
+  if (tensors.size() == 1 && tensors.front().is_non_overlapping_and_dense()) {
+    op.type = OpType::BROADCAST;
+    op.tensors = tensors;
+    op.broadcastOpts = opts;
+    op.bytes = tensors.front().numel() * tensors.front().element_size();
+    return scheduleOp(std::move(op));
+  }
+  auto copy = tensors;
+  return schedulePassthrough(
+      [this, copy, opts]() mutable { return pg_->broadcast(copy, opts); });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::allreduce_coalesced(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceCoalescedOptions& opts) {
+  auto copy = tensors;
+  return schedulePassthrough([this, copy, opts]() mutable {
+    return pg_->allreduce_coalesced(copy, opts);
+  });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::reduce(
+    std::vector<at::Tensor>& tensors,
+    const ReduceOptions& opts) {
+  auto copy = tensors;
+  return schedulePassthrough(
+      [this, copy, opts]() mutable { return pg_->reduce(copy, opts); });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::allgather(
+    std::vector<std::vector<at::Tensor>>& outputs,
+    std::vector<at::Tensor>& inputs,
+    const AllgatherOptions& opts) {
+  auto outputsCopy = outputs;
+  auto inputsCopy = inputs;
+  return schedulePassthrough([this, outputsCopy, inputsCopy, opts]() mutable {
+    return pg_->allgather(outputsCopy, inputsCopy, opts);
+  });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::allgather_base(
+    at::Tensor& outputBuffer,
+    at::Tensor& inputBuffer,
+    const AllgatherOptions& opts) {
+  auto output = outputBuffer;
+  auto input = inputBuffer;
+  return schedulePassthrough([this, output, input, opts]() mutable {
+    return pg_->allgather_base(output, input, opts);
+  });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::allgather_coalesced(
+    std::vector<std::vector<at::Tensor>>& outputTensorLists,
+    std::vector<at::Tensor>& inputTensors,
+    const AllgatherOptions& opts) {
+  auto outputsCopy = outputTensorLists;
+  auto inputsCopy = inputTensors;
+  return schedulePassthrough([this, outputsCopy, inputsCopy, opts]() mutable {
+    return pg_->allgather_coalesced(outputsCopy, inputsCopy, opts);
+  });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::gather(
+    std::vector<std::vector<at::Tensor>>& outputs,
+    std::vector<at::Tensor>& inputs,
+    const GatherOptions& opts) {
+  auto outputsCopy = outputs;
+  auto inputsCopy = inputs;
+  return schedulePassthrough([this, outputsCopy, inputsCopy, opts]() mutable {
+    return pg_->gather(outputsCopy, inputsCopy, opts);
+  });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::scatter(
+    std::vector<at::Tensor>& outputs,
+    std::vector<std::vector<at::Tensor>>& inputs,
+    const ScatterOptions& opts) {
+  auto outputsCopy = outputs;
+  auto inputsCopy = inputs;
+  return schedulePassthrough([this, outputsCopy, inputsCopy, opts]() mutable {
+    return pg_->scatter(outputsCopy, inputsCopy, opts);
+  });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::reduce_scatter(
+    std::vector<at::Tensor>& outputs,
+    std::vector<std::vector<at::Tensor>>& inputs,
+    const ReduceScatterOptions& opts) {
+  auto outputsCopy = outputs;
+  auto inputsCopy = inputs;
+  return schedulePassthrough([this, outputsCopy, inputsCopy, opts]() mutable {
+    return pg_->reduce_scatter(outputsCopy, inputsCopy, opts);
+  });
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::send(
+    std::vector<at::Tensor>& tensors,
+    int dstRank,
+    int tag) {
+  // Point-to-point operations are matched by tag, not by issue order, so
+  // they do not need to go through the negotiated queue.
+  return pg_->send(tensors, dstRank, tag);
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::recv(
+    std::vector<at::Tensor>& tensors,
+    int srcRank,
+    int tag) {
+  return pg_->recv(tensors, srcRank, tag);
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::recvAnysource(
+    std::vector<at::Tensor>& tensors,
+    int tag) {
+  return pg_->recvAnysource(tensors, tag);
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupScheduler::barrier(
+    const BarrierOptions& opts) {
+  return schedulePassthrough(
+      [this, opts]() mutable { return pg_->barrier(opts); });
+}
+
+bool ProcessGroupScheduler::fusable(const Op& a, const Op& b) {
+  if (a.type != b.type) {
+    return false;
+  }
+  const auto& ta = a.tensors.front();
+  const auto& tb = b.tensors.front();
+  if (ta.scalar_type() != tb.scalar_type() || ta.device() != tb.device()) {
+    return false;
+  }
+  if (a.type == OpType::ALLREDUCE) {
+    return a.allreduceOpts.reduceOp == b.allreduceOpts.reduceOp;
+  }
+  if (a.type == OpType::BROADCAST) {
+    // Single tensor implies rootTensor 0 on both.
+    return a.broadcastOpts.rootRank == b.broadcastOpts.rootRank;
+  }
+  return false;
+}
+
+std::pair<int64_t, bool> ProcessGroupScheduler::negotiate(
+    int64_t pending,
+    bool stopping) {
+  // Stopping ranks place no bound on the agreed count; active ranks with
+  // an empty queue contribute zero. The second element is the MIN of the
+  // stopping flags, so it only becomes 1 once every rank is shutting down.
+  const int64_t count =
+      stopping ? std::numeric_limits<int64_t>::max() : pending;
+  auto tensor =
+      at::tensor({count, stopping ? int64_t(1) : int64_t(0)})
+          .to(negotiationOptions_);
+  std::vector<at::Tensor> tensors = {tensor};
+  AllreduceOptions opts;
+  opts.reduceOp = ReduceOp::MIN;
+  pg_->allreduce(tensors, opts)->wait();
+  const auto result = tensors.front().to(at::kCPU);
+  const auto* data = result.data_ptr<int64_t>();
+  const auto agreed =
+      data[0] == std::numeric_limits<int64_t>::max() ? int64_t(0) : data[0];
+  return std::make_pair(agreed, data[1] == 1);
+}
+
+void ProcessGroupScheduler::runLoop() {
+  std::unique_lock<std::mutex> lock(shared_->mutex);
+  while (true) {
+    shared_->cv.wait_for(lock, options_.fusionWindow, [&] {
+      return stop_ || pendingUrgent_ > 0 || shared_->urgent.load() > 0;
+    });
+    if (!everScheduled_) {
+      if (stop_) {
+        // No rank has scheduled anything (the operation streams are
+        // identical), so there are no negotiation rounds to unwind.
+        return;
+      }
+      continue;
+    }
+    const auto pending = (int64_t)queue_.size();
+    const auto stopping = stop_;
+    lock.unlock();
+    const auto agreed = negotiate(pending, stopping);
+    lock.lock();
+    if (agreed.first > 0) {
+      TORCH_INTERNAL_ASSERT(
+          agreed.first <= (int64_t)queue_.size(),
+          "Negotiated more collectives than are queued; the ranks did not "
+          "issue the same sequence of operations.");
+      std::vector<Op> batch;
+      batch.reserve(agreed.first);
+      for (int64_t i = 0; i < agreed.first; ++i) {
+        if (queue_.front().urgent) {
+          --pendingUrgent_;
+        }
+        batch.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+      lock.unlock();
+      issueOps(std::move(batch));
+      lock.lock();
+    }
+    if (agreed.second) {
+      return;
+    }
+  }
+}
+
+void ProcessGroupScheduler::issueOps(std::vector<Op> ops) {
+  struct InFlight {
+    std::shared_ptr<ProcessGroup::Work> work;
+    std::vector<Op> ops;
+    // Single-element vector holding the fused buffer; empty when the
+    // operation was issued directly on the caller's tensors.
+    std::vector<at::Tensor> flat;
+    std::exception_ptr issueError;
+  };
+
+  // Issue everything first so transfers overlap, then complete in order.
+  std::vector<InFlight> inFlight;
+  size_t i = 0;
+  while (i < ops.size()) {
+    InFlight entry;
+    size_t j = i + 1;
+    if (ops[i].type != OpType::OTHER) {
+      size_t bytes = ops[i].bytes;
+      while (j < ops.size() && fusable(ops[i], ops[j]) &&
+             bytes + ops[j].bytes <= options_.fusionBytesCap) {
+        bytes += ops[j].bytes;
+        ++j;
+      }
+    }
+    for (size_t k = i; k < j; ++k) {
+      entry.ops.push_back(std::move(ops[k]));
+    }
+    try {
+      if (entry.ops.size() > 1) {
+        std::vector<at::Tensor> inputs;
+        inputs.reserve(entry.ops.size());
+        for (const auto& op : entry.ops) {
+          inputs.push_back(op.tensors.front());
+        }
+        entry.flat = {flattenTensors(inputs)};
+        if (entry.ops.front().type == OpType::ALLREDUCE) {
+          entry.work =
+              pg_->allreduce(entry.flat, entry.ops.front().allreduceOpts);
+        } else {
+          auto opts = entry.ops.front().broadcastOpts;
+          opts.rootTensor = 0;
+          entry.work = pg_->broadcast(entry.flat, opts);
+        }
+      } else {
+        auto& op = entry.ops.front();
+        switch (op.type) {
+          case OpType::ALLREDUCE:
+            entry.work = pg_->allreduce(op.tensors, op.allreduceOpts);
+            break;
+          case OpType::BROADCAST:
+            entry.work = pg_->broadcast(op.tensors, op.broadcastOpts);
+            break;
+          case OpType::OTHER:
+            entry.work = op.issue();
+            break;
+        }
+      }
+    } catch (...) {
+      entry.issueError = std::current_exception();
+    }
+    inFlight.push_back(std::move(entry));
+    i = j;
+  }
+
+  for (auto& entry : inFlight) {
+    auto eptr = entry.issueError;
+    if (!eptr) {
+      try {
+        entry.work->wait();
+      } catch (...) {
+        eptr = std::current_exception();
+      }
+    }
+    if (!eptr && !entry.flat.empty()) {
+      // Scatter the fused result back into the callers' tensors.
+      std::vector<at::Tensor> shaped;
+      shaped.reserve(entry.ops.size());
+      for (const auto& op : entry.ops) {
+        shaped.push_back(op.tensors.front());
+      }
+      const auto outputs = unflattenTensors(entry.flat.front(), shaped);
+      for (size_t k = 0; k < outputs.size(); ++k) {
+        entry.ops[k].tensors.front().copy_(outputs[k], /*non_blocking=*/true);
+      }
+    }
+    for (auto& op : entry.ops) {
+      op.work->markCompleted(eptr);
+    }
+  }
+}
+
+} // namespace c10d
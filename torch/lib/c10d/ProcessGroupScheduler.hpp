@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <c10d/ProcessGroup.hpp>
+
+namespace c10d {
+
+// ProcessGroupScheduler batches and fuses collectives issued against an
+// underlying ProcessGroup.
+//
+// Collectives are queued instead of being issued immediately. A background
+// thread periodically agrees with all other ranks on how many queued
+// operations every rank has seen, issues exactly that many, and fuses
+// adjacent compatible allreduce or broadcast calls into a single flattened
+// call on the underlying process group. Small operations (and operations
+// that are waited on) skip the batching window.
+//
+// As with ProcessGroupRoundRobin, all functions of the class are expected
+// to be called in the same order across all processes in the process
+// group; destruction is likewise expected to happen collectively, after
+// all outstanding work objects have been waited on.
+// See Note [Collective fusion and scheduling] in ProcessGroupScheduler.cpp.
+class ProcessGroupScheduler final : public ProcessGroup {
+ public:
+  struct Options {
+    // How long the background thread lets operations accumulate before
+    // negotiating a flush with the other ranks.
+    std::chrono::milliseconds fusionWindow = std::chrono::milliseconds(5);
+    // Fused calls are capped at this many bytes.
+    size_t fusionBytesCap = 25 * 1024 * 1024;
+    // Operations no larger than this skip the batching window, so small
+    // latency-critical collectives (e.g. loss scalars) are issued at the
+    // next negotiation round instead of waiting out the window.
+    size_t priorityBytesThreshold = 8 * 1024;
+  };
+
+  explicit ProcessGroupScheduler(
+      std::shared_ptr<ProcessGroup> processGroup,
+      Options options = Options());
+
+  ~ProcessGroupScheduler() override;
+
+  std::shared_ptr<ProcessGroup::Work> broadcast(
+      std::vector<at::Tensor>& tensors,
+      const BroadcastOptions& opts = BroadcastOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> allreduce(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts = AllreduceOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> allreduce_coalesced(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceCoalescedOptions& opts =
+          AllreduceCoalescedOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> reduce(
+      std::vector<at::Tensor>& tensors,
+      const ReduceOptions& opts = ReduceOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> allgather(
+      std::vector<std::vector<at::Tensor>>& outputs,
+      std::vector<at::Tensor>& inputs,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> allgather_base(
+      at::Tensor& outputBuffer,
+      at::Tensor& inputBuffer,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> allgather_coalesced(
+      std::vector<std::vector<at::Tensor>>& outputTensorLists,
+      std::vector<at::Tensor>& inputTensors,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> gather(
+      std::vector<std::vector<at::Tensor>>& outputs,
+      std::vector<at::Tensor>& inputs,
+      const GatherOptions& opts = GatherOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> scatter(
+      std::vector<at::Tensor>& outputs,
+      std::vector<std::vector<at::Tensor>>& inputs,
+      const ScatterOptions& opts = ScatterOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> reduce_scatter(
+      std::vector<at::Tensor>& outputs,
+      std::vector<std::vector<at::Tensor>>& inputs,
+      const ReduceScatterOptions& opts = ReduceScatterOptions()) override;
+
+  std::shared_ptr<ProcessGroup::Work> send(
+      std::vector<at::Tensor>& tensors,
+      int dstRank,
+      int tag) override;
+
+  std::shared_ptr<ProcessGroup::Work> recv(
+      std::vector<at::Tensor>& tensors,
+      int srcRank,
+      int tag) override;
+
+  std::shared_ptr<ProcessGroup::Work> recvAnysource(
+      std::vector<at::Tensor>& tensors,
+      int tag) override;
+
+  std::shared_ptr<ProcessGroup::Work> barrier(
+      const BarrierOptions& opts = BarrierOptions()) override;
+
+ private:
+  // State shared between the scheduler and its outstanding work objects.
+  // Work objects bump `urgent` while a caller is blocked in wait() so the
+  // background thread flushes immediately instead of waiting out the
+  // fusion window.
+  struct Shared {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::atomic<int64_t> urgent{0};
+  };
+
+  class WorkScheduled : public ProcessGroup::Work {
+   public:
+    explicit WorkScheduled(std::shared_ptr<Shared> shared)
+        : shared_(std::move(shared)) {}
+
+    bool wait() override;
+
+    // Called by the scheduler thread once the underlying (possibly fused)
+    // operation has completed.
+    void markCompleted(std::exception_ptr eptr) {
+      finish(std::move(eptr));
+    }
+
+   private:
+    std::shared_ptr<Shared> shared_;
+  };
+
+  enum class OpType : uint8_t { ALLREDUCE, BROADCAST, OTHER };
+
+  struct Op {
+    OpType type;
+    // Populated for fusable operations (single dense tensor).
+    std::vector<at::Tensor> tensors;
+    AllreduceOptions allreduceOpts;
+    BroadcastOptions broadcastOpts;
+    // Everything else carries a closure that issues the call on the
+    // underlying process group when its turn comes.
+    std::function<std::shared_ptr<ProcessGroup::Work>()> issue;
+    std::shared_ptr<WorkScheduled> work;
+    size_t bytes = 0;
+    bool urgent = false;
+  };
+
+  // Appends an operation to the queue and wakes the background thread.
+  std::shared_ptr<ProcessGroup::Work> scheduleOp(Op op);
+  // Convenience wrapper building an OTHER op from a closure.
+  std::shared_ptr<ProcessGroup::Work> schedulePassthrough(
+      std::function<std::shared_ptr<ProcessGroup::Work>()> issue);
+  // Background thread: negotiate with peers and issue agreed batches.
+  void runLoop();
+  // Agrees with all ranks on the number of queued operations to issue.
+  // Returns the agreed count and whether all ranks are shutting down.
+  std::pair<int64_t, bool> negotiate(int64_t pending, bool stopping);
+  // Issues a batch of operations in order, fusing adjacent compatible
+  // allreduces/broadcasts, and completes their work objects.
+  void issueOps(std::vector<Op> ops);
+  // Whether two fusable operations may share one flattened call.
+  static bool fusable(const Op& a, const Op& b);
+
+  std::shared_ptr<ProcessGroup> pg_;
+  const Options options_;
+  std::shared_ptr<Shared> shared_;
+
+  // All members below are guarded by shared_->mutex.
+  std::deque<Op> queue_;
+  // Number of queued ops flagged urgent (small or explicitly waited on).
+  int64_t pendingUrgent_ = 0;
+  // Negotiation rounds only start once the first operation has been
+  // scheduled, because the negotiation tensor lives on the same device as
+  // the data. All ranks schedule the same stream of operations, so they
+  // agree on when rounds begin.
+  bool everScheduled_ = false;
+  at::TensorOptions negotiationOptions_;
+  bool stop_ = false;
+
+  std::thread schedulerThread_;
+};
+
+} // namespace c10d
@@ -0,0 +1,114 @@
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <c10d/FileStore.hpp>
+#include <c10d/ProcessGroupGloo.hpp>
+#include <c10d/ProcessGroupScheduler.hpp>
+#include <c10d/test/TestUtils.hpp>
+
+using namespace c10d::test;
+
+namespace {
+
+std::shared_ptr<::c10d::ProcessGroupScheduler> createScheduler(
+    const std::string& path,
+    int rank,
+    int size) {
+  auto store = std::make_shared<::c10d::FileStore>(path, size);
+  ::c10d::ProcessGroupGloo::Options options;
+  options.timeout = std::chrono::milliseconds(5000);
+  options.devices.push_back(
+      ::c10d::ProcessGroupGloo::createDeviceForHostname("127.0.0.1"));
+  auto pg =
+      std::make_shared<::c10d::ProcessGroupGloo>(store, rank, size, options);
+  ::c10d::ProcessGroupScheduler::Options schedulerOptions;
+  // Keep the window small so the test exercises multiple flushes.
+  schedulerOptions.fusionWindow = std::chrono::milliseconds(2);
+  return std::make_shared<::c10d::ProcessGroupScheduler>(
+      std::move(pg), schedulerOptions);
+}
+
+void runAllreduce(const std::string& path, int rank, int size) {
+  auto pg = createScheduler(path, rank, size);
+
+  // A mix of fusable same-shape allreduces and a tiny one that takes the
+  // priority path.
+  constexpr auto numOps = 8;
+  std::vector<std::vector<at::Tensor>> tensors;
+  std::vector<std::shared_ptr<::c10d::ProcessGroup::Work>> work;
+  for (auto i = 0; i < numOps; i++) {
+    tensors.push_back({at::ones({16, 16}) * (rank + i)});
+    work.push_back(pg->allreduce(tensors.back()));
+  }
+  std::vector<at::Tensor> scalar = {at::ones({1}) * rank};
+  auto scalarWork = pg->allreduce(scalar);
+
+  for (auto& w : work) {
+    w->wait();
+  }
+  scalarWork->wait();
+
+  const auto rankSum = (size * (size - 1)) / 2;
+  for (auto i = 0; i < numOps; i++) {
+    const auto expected = rankSum + size * i;
+    const auto* data = tensors[i][0].data_ptr<float>();
+    for (auto j = 0; j < tensors[i][0].numel(); j++) {
+      EXPECT_EQ(data[j], expected);
+    }
+  }
+  EXPECT_EQ(scalar[0].data_ptr<float>()[0], rankSum);
+}
+
+void runBroadcast(const std::string& path, int rank, int size) {
+  auto pg = createScheduler(path, rank, size);
+
+  constexpr auto numOps = 4;
+  constexpr auto rootRank = 0;
+  std::vector<std::vector<at::Tensor>> tensors;
+  std::vector<std::shared_ptr<::c10d::ProcessGroup::Work>> work;
+  for (auto i = 0; i < numOps; i++) {
+    // Only the root's values survive the broadcast.
+    const auto value = rank == rootRank ? i + 1 : -1;
+    tensors.push_back({at::ones({16, 16}) * value});
+    ::c10d::BroadcastOptions options;
+    options.rootRank = rootRank;
+    work.push_back(pg->broadcast(tensors.back(), options));
+  }
+  for (auto& w : work) {
+    w->wait();
+  }
+
+  for (auto i = 0; i < numOps; i++) {
+    const auto* data = tensors[i][0].data_ptr<float>();
+    for (auto j = 0; j < tensors[i][0].numel(); j++) {
+      EXPECT_EQ(data[j], i + 1);
+    }
+  }
+}
+
+void spawnRanks(
+    const std::string& path,
+    int size,
+    void (*fn)(const std::string&, int, int)) {
+  std::vector<std::thread> threads;
+  for (auto rank = 0; rank < size; rank++) {
+    threads.emplace_back([=] { fn(path, rank, size); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace
+
+TEST(ProcessGroupSchedulerTest, testFusedAllreduce) {
+  TemporaryFile file;
+  spawnRanks(file.path, 4, runAllreduce);
+}
+
+TEST(ProcessGroupSchedulerTest, testFusedBroadcast) {
+  TemporaryFile file;
+  spawnRanks(file.path, 4, runBroadcast);
+}
@@ -437,6 +437,78 @@ class DistributedDataParallel(Module):
         finally:
             self.require_backward_grad_sync = old_require_backward_grad_sync
 
+    def set_grad_compression(self, compression, powersgd_rank=4):
+        r"""
+        Selects on-the-wire gradient compression for subsequent iterations.
+
+        Compressed buckets keep per-bucket error-feedback state, so the
+        compression error is carried into the next iteration rather than
+        lost.
+
+        Arguments:
+            compression (str): one of ``"none"``, ``"fp16"`` (buckets are
+                allreduced in half precision) and ``"powersgd"`` (buckets are
+                exchanged as low-rank factors from a warm-started power
+                iteration).
+            powersgd_rank (int): rank of the exchanged factors for
+                ``"powersgd"`` (default: 4).
+        """
+        mapping = {
+            "none": dist.GradCompression.NONE,
+            "fp16": dist.GradCompression.FP16,
+            "powersgd": dist.GradCompression.POWER_SGD,
+        }
+        if compression not in mapping:
+            raise ValueError(
+                "expected one of {}, got '{}'".format(
+                    sorted(mapping.keys()), compression))
+        self.reducer.set_grad_compression(mapping[compression], powersgd_rank)
+
+    def cache_unused_parameters(self, enable=True):
+        r"""
+        Memoizes the unused parameter set computed by
+        ``find_unused_parameters=True``.
+
+        While enabled, the per-iteration autograd graph traversal that
+        detects unused parameters is skipped as long as a fingerprint of the
+        model outputs' grad functions is unchanged, and the memoized set is
+        reused. The fingerprint only covers the output nodes and their direct
+        inputs, so this must only be enabled for models whose parameter usage
+        pattern is static across iterations (e.g., after warm-up). Disabling
+        clears the memoized set.
+
+        Arguments:
+            enable (bool): whether to memoize the unused parameter set.
+                Default: ``True``.
+        """
+        self.reducer.set_cache_unused_parameters(enable)
+
+    def rebucket_by_backward_order(self, bucket_cap_mb=None):
+        r"""
+        Re-partitions gradient buckets using the gradient ready times
+        measured during the most recent backward pass.
+
+        The initial bucket assignment assumes gradients become ready in
+        reverse parameter order. When that assumption does not hold for a
+        model, re-bucketing after a few warm-up iterations lets buckets
+        fill (and their allreduce launch) in the order gradients actually
+        arrive, improving overlap of communication with backward.
+
+        Must be called outside of a backward pass, at the same point in
+        training on every process, so that all processes arrive at the
+        same bucket assignment.
+
+        Arguments:
+            bucket_cap_mb (int, optional): bucket size cap in megabytes for
+                the new assignment. Defaults to the ``bucket_cap_mb`` this
+                module was constructed with.
+        """
+        if bucket_cap_mb is None:
+            bucket_bytes_cap = self.bucket_bytes_cap
+        else:
+            bucket_bytes_cap = int(bucket_cap_mb * 1024 * 1024)
+        self.reducer.rebuild_buckets_by_backward_order(bucket_bytes_cap)
+
     def forward(self, *inputs, **kwargs):
         if self.require_forward_param_sync:
             self._sync_params()
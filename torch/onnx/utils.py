@@ -393,6 +393,11 @@ def _model_to_graph(model, args, verbose=False,
                                                             _export_onnx_opset_version)
         torch._C._jit_pass_dce_allow_deleting_nodes_with_side_effects(graph)
 
+    # Collapse initializers and Constant nodes with identical contents into a
+    # single copy and prune any ONNX subgraphs that end up dead, so shared or
+    # tied weights are not serialized multiple times.
+    params_dict = torch._C._jit_pass_onnx_deduplicate_initializers(graph, params_dict)
+
     # For ONNX opset < 9, constants only have three data types: float16, float, double.
     # In this pass transform constants of other data types to float/double + cast operator.
     if _export_onnx_opset_version < 9:
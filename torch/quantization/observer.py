@@ -7,7 +7,19 @@ from functools import partial
 
 import torch
 import torch.nn as nn
-from torch._jit_internal import List, Optional
+from torch._jit_internal import List, Optional, Tuple
+
+def _tensor_min_max(x):
+    # type: (torch.Tensor) -> Tuple[torch.Tensor, torch.Tensor]
+    r"""Returns the min and max of ``x`` in one pass over the data.
+
+    ``torch._min_max`` only has a CPU kernel; fall back to two separate
+    reductions elsewhere.
+    """
+    if x.is_cuda:
+        return torch.min(x), torch.max(x)
+    return torch._min_max(x)
+
 
 def _with_args(cls_or_self, **kwargs):
     r"""Wrapper that allows creation of class factories.
@@ -337,12 +349,13 @@ class MinMaxObserver(_ObserverBase):
         x = x_orig.detach()  # avoid keeping autograd tape
         min_val = self.min_val
         max_val = self.max_val
+        x_min, x_max = _tensor_min_max(x)
         if min_val.numel() == 0 or max_val.numel() == 0:
-            min_val = torch.min(x)
-            max_val = torch.max(x)
+            min_val = x_min
+            max_val = x_max
         else:
-            min_val = torch.min(torch.min(x), min_val)
-            max_val = torch.max(torch.max(x), max_val)
+            min_val = torch.min(x_min, min_val)
+            max_val = torch.max(x_max, max_val)
         self.min_val = min_val
         self.max_val = max_val
         return x_orig
@@ -428,12 +441,13 @@ class MovingAverageMinMaxObserver(MinMaxObserver):
         x = x_orig.detach()  # avoid keeping autograd tape
         min_val = self.min_val
         max_val = self.max_val
+        x_min, x_max = _tensor_min_max(x)
         if min_val.numel() == 0 or max_val.numel() == 0:
-            min_val = torch.min(x)
-            max_val = torch.max(x)
+            min_val = x_min
+            max_val = x_max
         else:
-            min_val = min_val + self.averaging_constant * (torch.min(x) - min_val)
-            max_val = max_val + self.averaging_constant * (torch.max(x) - max_val)
+            min_val = min_val + self.averaging_constant * (x_min - min_val)
+            max_val = max_val + self.averaging_constant * (x_max - max_val)
         self.min_val = min_val
         self.max_val = max_val
         return x_orig
@@ -882,14 +896,12 @@ class HistogramObserver(_ObserverBase):
         min_val = self.min_val
         max_val = self.max_val
         if min_val.numel() == 0 or max_val.numel() == 0:
-            min_val = torch.min(x)
-            max_val = torch.max(x)
+            min_val, max_val = _tensor_min_max(x)
             self.min_val = min_val
             self.max_val = max_val
             self.histogram = torch.histc(x, self.bins, min=min_val, max=max_val)
         else:
-            new_min = torch.min(x)
-            new_max = torch.max(x)
+            new_min, new_max = _tensor_min_max(x)
             combined_min = torch.min(new_min, min_val)
             combined_max = torch.max(new_max, max_val)
             # combine the existing histogram and new histogram into 1 histogram
@@ -202,6 +202,16 @@ class LSTMDynamicModel(torch.nn.Module):
         x = self.lstm(x)
         return x
 
+class GRUDynamicModel(torch.nn.Module):
+    def __init__(self):
+        super(GRUDynamicModel, self).__init__()
+        self.qconfig = default_qconfig
+        self.gru = torch.nn.GRU(2, 2).to(dtype=torch.float)
+
+    def forward(self, x):
+        x = self.gru(x)
+        return x
+
 class ConvModel(torch.nn.Module):
     def __init__(self):
         super(ConvModel, self).__init__()
@@ -1,4 +1,5 @@
 import concurrent.futures
+import os
 import sys
 import time
 import unittest
@@ -909,6 +910,24 @@ class RpcTest(RpcAgentTestFixture):
         )
         self.assertEqual(rref.to_here(), torch.ones(n, n) * 2)
 
+    @dist_init
+    def test_builtin_remote_ret_cached(self):
+        # With the RRef value cache enabled, repeated to_here() calls on an
+        # unchanged owner value must keep returning the correct result.
+        os.environ["TORCH_RPC_RREF_CACHE"] = "1"
+        try:
+            n = self.rank + 1
+            dst_rank = n % self.world_size
+            rref = rpc.remote(
+                worker_name(dst_rank),
+                torch.add,
+                args=(torch.ones(n, n), torch.ones(n, n)),
+            )
+            for _ in range(3):
+                self.assertEqual(rref.to_here(), torch.ones(n, n) * 2)
+        finally:
+            del os.environ["TORCH_RPC_RREF_CACHE"]
+
     @dist_init
     def test_builtin_remote_self(self):
         rref = rpc.remote(